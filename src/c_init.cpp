@@ -29,6 +29,7 @@
 #include "conf.h"
 
 FILE *con_term = NULL;
+UPX_THREAD_LOCAL ConsoleCapture *con_capture = NULL;
 
 #if (USE_CONSOLE)
 
@@ -142,21 +143,106 @@ console_t console_init =
 };
 
 
+#endif /* USE_CONSOLE */
+
+
+/*************************************************************************
+//
+**************************************************************************/
+
 void __acc_cdecl_va con_fprintf(FILE *f, const char *format, ...)
 {
     va_list args;
-    char buf[80*25];
 
+#if !(USE_CONSOLE)
+    if (!con_capture)
+    {
+        va_start(args, format);
+        vfprintf(f, format, args);
+        va_end(args);
+        return;
+    }
+#endif
+
+    char buf[80*25];
     va_start(args, format);
     upx_vsnprintf(buf, sizeof(buf), format,args);
     va_end(args);
 
+    if (con_capture)
+    {
+        con_capture->append(f, buf);
+        return;
+    }
+#if (USE_CONSOLE)
     if (con == me)
         init(f,-1,-1);
     assert(con != me);
     con->print0(f,buf);
+#endif
 }
 
-#endif /* USE_CONSOLE */
+
+/*************************************************************************
+// ConsoleCapture
+//
+// Each record is a tag byte followed by a NUL terminated string.
+**************************************************************************/
+
+enum { CAPTURE_STDERR = 1, CAPTURE_RAW = 2 };
+
+ConsoleCapture::ConsoleCapture() :
+    buf(NULL), len(0), capacity(0)
+{
+}
+
+ConsoleCapture::~ConsoleCapture()
+{
+    free(buf);
+}
+
+void ConsoleCapture::append(FILE *f, const char *s, bool raw)
+{
+    assert(f == stdout || f == stderr);
+    unsigned l = (unsigned) strlen(s);
+    if (l == 0)
+        return;
+    if (len + 1 + l + 1 > capacity)
+    {
+        unsigned c = capacity ? capacity : 1024;
+        while (len + 1 + l + 1 > c)
+            c *= 2;
+        char *p = (char *) realloc(buf, c);
+        if (p == NULL)
+            throw std::bad_alloc();
+        buf = p;
+        capacity = c;
+    }
+    buf[len] = (char) ((f == stderr ? CAPTURE_STDERR : 0) | (raw ? CAPTURE_RAW : 0));
+    memcpy(buf + len + 1, s, l + 1);
+    len += 1 + l + 1;
+}
+
+void ConsoleCapture::replay()
+{
+    assert(con_capture != this);
+    for (unsigned i = 0; i < len; )
+    {
+        int tag = buf[i];
+        const char *s = buf + i + 1;
+        FILE *f = (tag & CAPTURE_STDERR) ? stderr : stdout;
+        // keep stdout and stderr in order, just like the serial code does
+        fflush(stdout); fflush(stderr);
+        if (tag & CAPTURE_RAW)
+            fputs(s, f);
+        else
+            con_fprintf(f, "%s", s);
+        i += 1 + (unsigned) strlen(s) + 1;
+    }
+    fflush(stdout); fflush(stderr);
+    free(buf);
+    buf = NULL;
+    len = capacity = 0;
+}
 
 /* vim:set ts=4 sw=4 et: */
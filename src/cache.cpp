@@ -0,0 +1,393 @@
+/* cache.cpp --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2020 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+#include "conf.h"
+#include "cache.h"
+#include "thread.h"
+
+
+/*************************************************************************
+// entry layout (all values little endian):
+//   0  magic "UPXc"
+//   4  entry kind
+//   8  key
+//  16  u_len (or overlap overhead)
+//  20  c_len
+//  24  upx_compress_result_t fields (compressed streams only)
+//  ..  compressed data
+**************************************************************************/
+
+#define CACHE_MAGIC         "UPXc"
+#define CACHE_SUFFIX        ".upxc"
+#define CACHE_HEADER_SIZE   24
+
+enum { CACHE_COMPRESSED = 1, CACHE_OVERLAP = 2 };
+
+// number of 32-bit words in a stored upx_compress_result_t
+#define CACHE_RESULT_WORDS  (4 + 8 + 16 + 1)
+
+
+bool upx_cache_enabled(void)
+{
+    return opt->cache_dir != NULL && opt->cache_dir[0];
+}
+
+
+// FNV-1a
+static upx_uint64_t fnv1a(upx_uint64_t h, const upx_bytep p, unsigned len)
+{
+    for (unsigned i = 0; i < len; i++)
+    {
+        h ^= p[i];
+        h *= ACC_UINT64_C(1099511628211);
+    }
+    return h;
+}
+
+
+upx_cache_key_t upx_cache_key(const upx_bytep buf, unsigned len,
+                              const void *params, unsigned params_len)
+{
+    upx_uint64_t h = ACC_UINT64_C(14695981039346656037);
+    h = fnv1a(h, (const upx_bytep) params, params_len);
+    if (buf)
+        h = fnv1a(h, buf, len);
+    return h ? h : 1;
+}
+
+
+static bool getPath(char *path, unsigned size, upx_cache_key_t key)
+{
+    int r = upx_snprintf(path, size, "%s/%08x%08x" CACHE_SUFFIX, opt->cache_dir,
+                         (unsigned) (key >> 32), (unsigned) key);
+    return r > 0 && (unsigned) r < size;
+}
+
+
+static void setHeader(upx_bytep h, int kind, upx_cache_key_t key,
+                      unsigned v1, unsigned v2)
+{
+    memcpy(h, CACHE_MAGIC, 4);
+    set_le32(h + 4, kind);
+    set_le32(h + 8, (unsigned) key);
+    set_le32(h + 12, (unsigned) (key >> 32));
+    set_le32(h + 16, v1);
+    set_le32(h + 20, v2);
+}
+
+
+static bool checkHeader(const upx_bytep h, int kind, upx_cache_key_t key)
+{
+    return memcmp(h, CACHE_MAGIC, 4) == 0
+        && get_le32(h + 4) == (unsigned) kind
+        && get_le32(h + 8) == (unsigned) key
+        && get_le32(h + 12) == (unsigned) (key >> 32);
+}
+
+
+// upx_compress_result_t is stored field by field so that the
+// entries do not depend on the host byte order or struct layout
+static void setResult(upx_bytep p, const upx_compress_result_t *r)
+{
+    unsigned v[CACHE_RESULT_WORDS];
+    unsigned n = 0;
+    v[n++] = r->method; v[n++] = r->level;
+    v[n++] = r->u_len; v[n++] = r->c_len;
+    const lzma_compress_result_t &lz = r->result_lzma;
+    v[n++] = lz.pos_bits; v[n++] = lz.lit_pos_bits;
+    v[n++] = lz.lit_context_bits; v[n++] = lz.dict_size;
+    v[n++] = lz.fast_mode; v[n++] = lz.num_fast_bytes;
+    v[n++] = lz.match_finder_cycles; v[n++] = lz.num_probs;
+    for (unsigned i = 0; i < 16; i++)
+        v[n++] = (unsigned) r->result_ucl.result[i];
+    v[n++] = r->result_zlib.dummy;
+    assert(n == CACHE_RESULT_WORDS);
+    for (unsigned i = 0; i < n; i++)
+        set_le32(p + 4 * i, v[i]);
+}
+
+
+static void getResult(const upx_bytep p, upx_compress_result_t *r)
+{
+    unsigned v[CACHE_RESULT_WORDS];
+    for (unsigned i = 0; i < CACHE_RESULT_WORDS; i++)
+        v[i] = get_le32(p + 4 * i);
+    unsigned n = 0;
+    r->reset();
+    r->method = v[n++]; r->level = v[n++];
+    r->u_len = v[n++]; r->c_len = v[n++];
+    lzma_compress_result_t &lz = r->result_lzma;
+    lz.pos_bits = v[n++]; lz.lit_pos_bits = v[n++];
+    lz.lit_context_bits = v[n++]; lz.dict_size = v[n++];
+    lz.fast_mode = v[n++]; lz.num_fast_bytes = v[n++];
+    lz.match_finder_cycles = v[n++]; lz.num_probs = v[n++];
+    for (unsigned i = 0; i < 16; i++)
+        r->result_ucl.result[i] = v[n++];
+    r->result_zlib.dummy = v[n++];
+    assert(n == CACHE_RESULT_WORDS);
+}
+
+
+/*************************************************************************
+// low-level file access
+**************************************************************************/
+
+static FILE *openEntry(upx_cache_key_t key, char *path, unsigned size)
+{
+    if (!upx_cache_enabled() || !getPath(path, size, key))
+        return NULL;
+    return fopen(path, "rb");
+}
+
+
+// mark a cache hit for upx_cache_trim()
+static void touchEntry(const char *path)
+{
+#if (HAVE_UTIME)
+    int r = utime(path, NULL);
+    UNUSED(r);
+#else
+    UNUSED(path);
+#endif
+}
+
+
+// Write to a temporary file first so that concurrent readers (other
+// threads or other UPX processes sharing the cache) never see a
+// partial entry.
+static void writeEntry(upx_cache_key_t key, const upx_bytep h,
+                       const void *p1, unsigned l1, const void *p2, unsigned l2)
+{
+    static Mutex tmp_mutex;
+    static unsigned tmp_counter = 0;
+
+    char path[ACC_FN_PATH_MAX + 1];
+    char tmp[ACC_FN_PATH_MAX + 1];
+    if (!upx_cache_enabled() || !getPath(path, sizeof(path), key))
+        return;
+    unsigned counter;
+    {
+        MutexLocker lock(&tmp_mutex);
+        counter = tmp_counter++;
+    }
+    unsigned pid = 0;
+#if (HAVE_UNISTD_H)
+    pid = (unsigned) getpid();
+#endif
+    int r = upx_snprintf(tmp, sizeof(tmp), "%s.%u.%u.tmp", path, pid, counter);
+    if (r <= 0 || (unsigned) r >= sizeof(tmp))
+        return;
+
+    FILE *f = fopen(tmp, "wb");
+    if (f == NULL)
+        return;
+    bool ok = fwrite(h, 1, CACHE_HEADER_SIZE, f) == CACHE_HEADER_SIZE;
+    if (ok && l1)
+        ok = fwrite(p1, 1, l1, f) == l1;
+    if (ok && l2)
+        ok = fwrite(p2, 1, l2, f) == l2;
+    if (fclose(f) != 0)
+        ok = false;
+    if (ok && rename(tmp, path) == 0)
+        return;
+    r = unlink(tmp);
+    UNUSED(r);
+}
+
+
+/*************************************************************************
+// compressed streams
+**************************************************************************/
+
+bool upx_cache_get_compressed(upx_cache_key_t key, unsigned u_len,
+                              upx_bytep out, unsigned out_size, unsigned *c_len,
+                              upx_compress_result_t *cresult)
+{
+    char path[ACC_FN_PATH_MAX + 1];
+    FILE *f = openEntry(key, path, sizeof(path));
+    if (f == NULL)
+        return false;
+
+    upx_byte h[CACHE_HEADER_SIZE];
+    upx_byte res[4 * CACHE_RESULT_WORDS];
+    bool ok = fread(h, 1, sizeof(h), f) == sizeof(h)
+        && checkHeader(h, CACHE_COMPRESSED, key)
+        && get_le32(h + 16) == u_len;
+    const unsigned len = ok ? get_le32(h + 20) : 0;
+    ok = ok && len > 0 && len <= out_size
+        && fread(res, 1, sizeof(res), f) == sizeof(res)
+        && fread(out, 1, len, f) == len
+        && fgetc(f) == EOF;
+    fclose(f);
+    if (!ok)
+        return false;
+
+    *c_len = len;
+    getResult(res, cresult);
+    touchEntry(path);
+    return true;
+}
+
+
+void upx_cache_put_compressed(upx_cache_key_t key, unsigned u_len,
+                              const upx_bytep in, unsigned c_len,
+                              const upx_compress_result_t *cresult)
+{
+    upx_byte h[CACHE_HEADER_SIZE];
+    upx_byte res[4 * CACHE_RESULT_WORDS];
+    setHeader(h, CACHE_COMPRESSED, key, u_len, c_len);
+    setResult(res, cresult);
+    writeEntry(key, h, res, sizeof(res), in, c_len);
+}
+
+
+/*************************************************************************
+// overlap overhead
+**************************************************************************/
+
+bool upx_cache_get_overlap(upx_cache_key_t key, unsigned *overhead)
+{
+    char path[ACC_FN_PATH_MAX + 1];
+    FILE *f = openEntry(key, path, sizeof(path));
+    if (f == NULL)
+        return false;
+
+    upx_byte h[CACHE_HEADER_SIZE];
+    bool ok = fread(h, 1, sizeof(h), f) == sizeof(h)
+        && checkHeader(h, CACHE_OVERLAP, key)
+        && fgetc(f) == EOF;
+    fclose(f);
+    if (!ok)
+        return false;
+
+    *overhead = get_le32(h + 16);
+    touchEntry(path);
+    return true;
+}
+
+
+void upx_cache_put_overlap(upx_cache_key_t key, unsigned overhead)
+{
+    upx_byte h[CACHE_HEADER_SIZE];
+    setHeader(h, CACHE_OVERLAP, key, overhead, 0);
+    writeEntry(key, h, NULL, 0, NULL, 0);
+}
+
+
+/*************************************************************************
+// LRU eviction
+**************************************************************************/
+
+#if (HAVE_DIRENT_H)
+
+struct CacheFile
+{
+    time_t mtime;
+    upx_uint64_t size;
+    char name[24];
+
+    static int __acc_cdecl_qsort compare(const void *p1, const void *p2)
+    {
+        const CacheFile *e1 = (const CacheFile *) p1;
+        const CacheFile *e2 = (const CacheFile *) p2;
+        if (e1->mtime != e2->mtime)
+            return e1->mtime < e2->mtime ? -1 : 1;
+        return strcmp(e1->name, e2->name);
+    }
+};
+
+
+static bool isEntryName(const char *n)
+{
+    if (strlen(n) != 16 + strlen(CACHE_SUFFIX))
+        return false;
+    for (int i = 0; i < 16; i++)
+        if (!isxdigit((unsigned char) n[i]))
+            return false;
+    return strcmp(n + 16, CACHE_SUFFIX) == 0;
+}
+
+#endif
+
+
+void upx_cache_trim(void)
+{
+#if (HAVE_DIRENT_H)
+    if (!upx_cache_enabled() || opt->cache_size <= 0)
+        return;
+    const upx_uint64_t limit = (upx_uint64_t) opt->cache_size << 20;
+
+    DIR *dir = opendir(opt->cache_dir);
+    if (dir == NULL)
+        return;
+    CacheFile *files = NULL;
+    unsigned nfiles = 0, nalloc = 0;
+    upx_uint64_t total = 0;
+    char path[ACC_FN_PATH_MAX + 1];
+    struct dirent *d;
+    while ((d = readdir(dir)) != NULL)
+    {
+        if (!isEntryName(d->d_name))
+            continue;
+        int r = upx_snprintf(path, sizeof(path), "%s/%s", opt->cache_dir, d->d_name);
+        struct stat st;
+        if (r <= 0 || (unsigned) r >= sizeof(path) || stat(path, &st) != 0)
+            continue;
+        if (nfiles == nalloc)
+        {
+            unsigned n = nalloc ? 2 * nalloc : 256;
+            CacheFile *p = (CacheFile *) realloc(files, mem_size(sizeof(CacheFile), n));
+            if (p == NULL)
+                break;
+            files = p;
+            nalloc = n;
+        }
+        CacheFile *e = &files[nfiles++];
+        e->mtime = st.st_mtime;
+        e->size = st.st_size;
+        strcpy(e->name, d->d_name);
+        total += e->size;
+    }
+    closedir(dir);
+
+    if (total > limit)
+    {
+        // oldest first
+        qsort(files, nfiles, sizeof(*files), CacheFile::compare);
+        for (unsigned i = 0; i < nfiles && total > limit; i++)
+        {
+            int r = upx_snprintf(path, sizeof(path), "%s/%s", opt->cache_dir, files[i].name);
+            if (r > 0 && (unsigned) r < sizeof(path) && unlink(path) == 0)
+                total -= files[i].size;
+        }
+    }
+    free(files);
+#endif
+}
+
+/* vim:set ts=4 sw=4 et: */
@@ -0,0 +1,67 @@
+/* cache.h --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2020 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+#ifndef __UPX_CACHE_H
+#define __UPX_CACHE_H 1
+
+/*************************************************************************
+// persistent compression cache (see "--cache-dir")
+//
+// Entries are plain files named after a 64-bit key that covers the
+// uncompressed data and all parameters which influence the compressed
+// stream. The cache is strictly best-effort: any I/O error simply
+// results in a cache miss and never makes packing fail.
+**************************************************************************/
+
+typedef upx_uint64_t upx_cache_key_t;
+
+bool upx_cache_enabled(void);
+
+// never returns 0, so 0 can be used as "no key"
+upx_cache_key_t upx_cache_key(const upx_bytep buf, unsigned len,
+                              const void *params, unsigned params_len);
+
+// compressed stream plus compression results
+bool upx_cache_get_compressed(upx_cache_key_t key, unsigned u_len,
+                              upx_bytep out, unsigned out_size, unsigned *c_len,
+                              upx_compress_result_t *cresult);
+void upx_cache_put_compressed(upx_cache_key_t key, unsigned u_len,
+                              const upx_bytep in, unsigned c_len,
+                              const upx_compress_result_t *cresult);
+
+// overlap overhead (see Packer::findOverlapOverhead())
+bool upx_cache_get_overlap(upx_cache_key_t key, unsigned *overhead);
+void upx_cache_put_overlap(upx_cache_key_t key, unsigned overhead);
+
+// remove least recently used entries until the cache fits "--cache-size"
+void upx_cache_trim(void);
+
+
+#endif /* already included */
+
+/* vim:set ts=4 sw=4 et: */
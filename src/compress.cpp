@@ -35,16 +35,350 @@
 //
 **************************************************************************/
 
+static unsigned adler32_scalar(const upx_byte *buf, unsigned len, unsigned adler)
+{
+#if 1
+    return upx_ucl_adler32(buf, len, adler);
+#else
+    return upx_zlib_adler32(buf, len, adler);
+#endif
+}
+
+
+#if (ACC_ARCH_AMD64 || ACC_ARCH_I386) && (ACC_CC_CLANG || ACC_CC_GNUC >= 0x040900L)
+#include <immintrin.h>
+
+// Process the buffer in blocks of "width" bytes: per block, sad() adds
+// up the bytes for s1, and maddubs() with the weights width..1 gives
+// the part of s2 that comes from inside the block. The s1 values at
+// the start of each block are accumulated in vs1_0 and scaled by width
+// later. The modulo is taken once every NMAX bytes, as in zlib.
+#define ADLER32_VECTOR(name, attr, vec, width, setzero, set1_16, loadu, add32, sad, maddubs, madd, hsum, weights) \
+attr static unsigned name(const upx_byte *buf, unsigned len, unsigned adler) \
+{ \
+    const unsigned BASE = 65521; \
+    const unsigned NMAX = 5552 / width * width; \
+    unsigned s1 = adler & 0xffff; \
+    unsigned s2 = (adler >> 16) & 0xffff; \
+    const vec v_zero = setzero(); \
+    const vec v_ones = set1_16(1); \
+    const vec v_weights = weights; \
+    while (len >= width) \
+    { \
+        const unsigned n = (len < NMAX ? len : NMAX) / width * width; \
+        len -= n; \
+        s2 += s1 * n; \
+        vec vs1 = v_zero, vs1_0 = v_zero, vs2 = v_zero; \
+        for (const upx_byte *end = buf + n; buf < end; buf += width) \
+        { \
+            const vec v = loadu((const vec *) buf); \
+            vs1_0 = add32(vs1_0, vs1); \
+            vs1 = add32(vs1, sad(v, v_zero)); \
+            vs2 = add32(vs2, madd(maddubs(v, v_weights), v_ones)); \
+        } \
+        s1 += hsum(vs1); \
+        s2 += width * (hsum(vs1_0) % BASE) + hsum(vs2); \
+        s1 %= BASE; \
+        s2 %= BASE; \
+    } \
+    adler = s1 | (s2 << 16); \
+    return len ? adler32_scalar(buf, len, adler) : adler; \
+}
+
+__attribute__((__target__("ssse3")))
+static inline unsigned adler32_hsum_sse(__m128i v)
+{
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4e));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xb1));
+    return (unsigned) _mm_cvtsi128_si32(v);
+}
+
+__attribute__((__target__("avx2")))
+static inline unsigned adler32_hsum_avx(__m256i v)
+{
+    return adler32_hsum_sse(_mm_add_epi32(_mm256_castsi256_si128(v),
+                                          _mm256_extracti128_si256(v, 1)));
+}
+
+ADLER32_VECTOR(adler32_ssse3, __attribute__((__target__("ssse3"))),
+    __m128i, 16, _mm_setzero_si128, _mm_set1_epi16, _mm_loadu_si128, _mm_add_epi32,
+    _mm_sad_epu8, _mm_maddubs_epi16, _mm_madd_epi16, adler32_hsum_sse,
+    _mm_setr_epi8(16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1))
+ADLER32_VECTOR(adler32_avx2, __attribute__((__target__("avx2"))),
+    __m256i, 32, _mm256_setzero_si256, _mm256_set1_epi16, _mm256_loadu_si256, _mm256_add_epi32,
+    _mm256_sad_epu8, _mm256_maddubs_epi16, _mm256_madd_epi16, adler32_hsum_avx,
+    _mm256_setr_epi8(32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,
+                     16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1))
+
+#undef ADLER32_VECTOR
+
+typedef unsigned (*adler32_t)(const upx_byte *, unsigned, unsigned);
+
+static adler32_t adler32_select()
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return adler32_avx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return adler32_ssse3;
+    return adler32_scalar;
+}
+
+#else
+
+typedef unsigned (*adler32_t)(const upx_byte *, unsigned, unsigned);
+
+static adler32_t adler32_select()
+{
+    return adler32_scalar;
+}
+
+#endif
+
+
 unsigned upx_adler32(const void *buf, unsigned len, unsigned adler)
 {
     if (len == 0)
         return adler;
     assert(buf != NULL);
-#if 1
-    return upx_ucl_adler32(buf, len, adler);
+    // select the implementation once by cpu features
+    static const adler32_t adler32 = adler32_select();
+    return adler32((const upx_byte *) buf, len, adler);
+}
+
+
+// Return the adler32 of the concatenation of two buffers, given
+// adler1 of the first buffer and adler2 and len2 of the second one.
+// Same algorithm as adler32_combine() in zlib.
+unsigned upx_adler32_combine(unsigned adler1, unsigned adler2, unsigned len2)
+{
+    const unsigned BASE = 65521;    // largest prime smaller than 65536
+    unsigned rem = len2 % BASE;
+    unsigned sum1 = adler1 & 0xffff;
+    unsigned sum2 = (rem * sum1) % BASE;
+    sum1 += (adler2 & 0xffff) + BASE - 1;
+    sum2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) + BASE - rem;
+    if (sum1 >= BASE) sum1 -= BASE;
+    if (sum1 >= BASE) sum1 -= BASE;
+    if (sum2 >= 2 * BASE) sum2 -= 2 * BASE;
+    if (sum2 >= BASE) sum2 -= BASE;
+    return sum1 | (sum2 << 16);
+}
+
+
+/*************************************************************************
+// CRC-32C (Castagnoli), the optional checksum of the PackHeader
+**************************************************************************/
+
+#define CRC32C_POLY 0x82f63b78u     // reflected
+
+// slicing-by-8 tables
+struct Crc32cTables
+{
+    upx_uint32_t t[8][256];
+    Crc32cTables()
+    {
+        for (unsigned i = 0; i < 256; i++)
+        {
+            upx_uint32_t c = i;
+            for (int k = 0; k < 8; k++)
+                c = (c >> 1) ^ (CRC32C_POLY & (0u - (c & 1)));
+            t[0][i] = c;
+        }
+        for (unsigned i = 0; i < 256; i++)
+            for (int j = 1; j < 8; j++)
+                t[j][i] = (t[j-1][i] >> 8) ^ t[0][t[j-1][i] & 0xff];
+    }
+};
+
+static unsigned crc32c_scalar(const upx_byte *p, unsigned len, unsigned crc)
+{
+    static const Crc32cTables tables;
+    const upx_uint32_t (*t)[256] = tables.t;
+    upx_uint32_t c = ~crc;
+    for ( ; len >= 8; p += 8, len -= 8)
+    {
+        c ^= get_le32(p);
+        const upx_uint32_t h = get_le32(p + 4);
+        c = t[7][c & 0xff] ^ t[6][(c >> 8) & 0xff] ^ t[5][(c >> 16) & 0xff] ^ t[4][c >> 24] ^
+            t[3][h & 0xff] ^ t[2][(h >> 8) & 0xff] ^ t[1][(h >> 16) & 0xff] ^ t[0][h >> 24];
+    }
+    while (len-- > 0)
+        c = (c >> 8) ^ t[0][(c ^ *p++) & 0xff];
+    return ~c;
+}
+
+
+// Return the crc of the concatenation of two buffers, given crc1 of
+// the first buffer and crc2 and len2 of the second one.
+// Same algorithm as crc32_combine() in zlib: apply len2 zero bytes to
+// crc1 by repeated squaring of the GF(2) matrix of the crc shift.
+static upx_uint32_t gf2_matrix_times(const upx_uint32_t *mat, upx_uint32_t vec)
+{
+    upx_uint32_t sum = 0;
+    for ( ; vec; vec >>= 1, mat++)
+        if (vec & 1)
+            sum ^= *mat;
+    return sum;
+}
+
+static void gf2_matrix_square(upx_uint32_t *square, const upx_uint32_t *mat)
+{
+    for (int n = 0; n < 32; n++)
+        square[n] = gf2_matrix_times(mat, mat[n]);
+}
+
+unsigned upx_crc32c_combine(unsigned crc1, unsigned crc2, unsigned len2)
+{
+    if (len2 == 0)
+        return crc1;
+    upx_uint32_t even[32], odd[32];
+    // operator for one zero bit
+    odd[0] = CRC32C_POLY;
+    upx_uint32_t row = 1;
+    for (int n = 1; n < 32; n++, row <<= 1)
+        odd[n] = row;
+    gf2_matrix_square(even, odd);   // 2 zero bits
+    gf2_matrix_square(odd, even);   // 4 zero bits
+    // apply len2 zero bytes to crc1; the first square gives one byte
+    upx_uint32_t c = crc1;
+    do {
+        gf2_matrix_square(even, odd);
+        if (len2 & 1)
+            c = gf2_matrix_times(even, c);
+        len2 >>= 1;
+        if (len2 == 0)
+            break;
+        gf2_matrix_square(odd, even);
+        if (len2 & 1)
+            c = gf2_matrix_times(odd, c);
+        len2 >>= 1;
+    } while (len2 != 0);
+    return c ^ crc2;
+}
+
+
+#if (ACC_ARCH_AMD64 || ACC_ARCH_I386) && (ACC_CC_CLANG || ACC_CC_GNUC >= 0x040900L)
+
+#if (ACC_ARCH_AMD64)
+// The crc32 instruction has a latency of 3 cycles, but a throughput
+// of 1 per cycle, so three interleaved streams over adjacent blocks are
+// about three times as fast. shift_block[] and shift_2block[] move a
+// crc register over one and two blocks of zero bytes.
+#define CRC32C_BLOCK 4096
+
+struct Crc32cShift
+{
+    upx_uint32_t shift_block[32];
+    upx_uint32_t shift_2block[32];
+    Crc32cShift()
+    {
+        for (int k = 0; k < 32; k++)
+        {
+            shift_block[k] = upx_crc32c_combine(1u << k, 0, CRC32C_BLOCK);
+            shift_2block[k] = upx_crc32c_combine(1u << k, 0, 2 * CRC32C_BLOCK);
+        }
+    }
+};
+#endif
+
+__attribute__((__target__("sse4.2")))
+static unsigned crc32c_sse42(const upx_byte *p, unsigned len, unsigned crc)
+{
+    upx_uint32_t c = ~crc;
+#if (ACC_ARCH_AMD64)
+    if (len >= 3 * CRC32C_BLOCK)
+    {
+        static const Crc32cShift shift;
+        do {
+            upx_uint64_t c0 = c, c1 = 0, c2 = 0;
+            for (unsigned i = 0; i < CRC32C_BLOCK; i += 8)
+            {
+                c0 = _mm_crc32_u64(c0, get_le64(p + i));
+                c1 = _mm_crc32_u64(c1, get_le64(p + i + CRC32C_BLOCK));
+                c2 = _mm_crc32_u64(c2, get_le64(p + i + 2 * CRC32C_BLOCK));
+            }
+            c = gf2_matrix_times(shift.shift_2block, (upx_uint32_t) c0) ^
+                gf2_matrix_times(shift.shift_block, (upx_uint32_t) c1) ^ (upx_uint32_t) c2;
+            p += 3 * CRC32C_BLOCK;
+            len -= 3 * CRC32C_BLOCK;
+        } while (len >= 3 * CRC32C_BLOCK);
+    }
+    upx_uint64_t c64 = c;
+    for ( ; len >= 8; p += 8, len -= 8)
+        c64 = _mm_crc32_u64(c64, get_le64(p));
+    c = (upx_uint32_t) c64;
+#endif
+    for ( ; len >= 4; p += 4, len -= 4)
+        c = _mm_crc32_u32(c, get_le32(p));
+    while (len-- > 0)
+        c = _mm_crc32_u8(c, *p++);
+    return ~c;
+}
+
+typedef unsigned (*crc32c_t)(const upx_byte *, unsigned, unsigned);
+
+static crc32c_t crc32c_select()
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2"))
+        return crc32c_sse42;
+    return crc32c_scalar;
+}
+
 #else
-    return upx_zlib_adler32(buf, len, adler);
+
+typedef unsigned (*crc32c_t)(const upx_byte *, unsigned, unsigned);
+
+static crc32c_t crc32c_select()
+{
+    return crc32c_scalar;
+}
+
 #endif
+
+
+unsigned upx_crc32c(const void *buf, unsigned len, unsigned crc)
+{
+    if (len == 0)
+        return crc;
+    assert(buf != NULL);
+    // select the implementation once by cpu features
+    static const crc32c_t crc32c = crc32c_select();
+    return crc32c((const upx_byte *) buf, len, crc);
+}
+
+
+#undef CRC32C_POLY
+#undef CRC32C_BLOCK
+
+
+/*************************************************************************
+// the checksum of PackHeader::u_adler and c_adler
+**************************************************************************/
+
+unsigned upx_checksum_init(int kind)
+{
+    if (kind == UPX_CHECKSUM_CRC32C)
+        return 0;
+    assert(kind == UPX_CHECKSUM_ADLER32);
+    return 1;
+}
+
+unsigned upx_checksum(int kind, const void *buf, unsigned len, unsigned prev)
+{
+    if (kind == UPX_CHECKSUM_CRC32C)
+        return upx_crc32c(buf, len, prev);
+    assert(kind == UPX_CHECKSUM_ADLER32);
+    return upx_adler32(buf, len, prev);
+}
+
+unsigned upx_checksum_combine(int kind, unsigned sum1, unsigned sum2, unsigned len2)
+{
+    if (kind == UPX_CHECKSUM_CRC32C)
+        return upx_crc32c_combine(sum1, sum2, len2);
+    assert(kind == UPX_CHECKSUM_ADLER32);
+    return upx_adler32_combine(sum1, sum2, len2);
 }
 
 
@@ -122,6 +456,12 @@ int upx_compress           ( const upx_bytep src, unsigned  src_len,
         throwInternalError("unknown compression method");
     }
 
+    // Give up if the output exceeds the budget. The LZMA and zlib back
+    // ends already stop as soon as they pass it; UCL cannot be aborted,
+    // so for UCL this only saves the work after compression.
+    if (r == UPX_E_OK && cconf && cconf->max_c_len && *dst_len > cconf->max_c_len)
+        r = UPX_E_OUTPUT_OVERRUN;
+
 #if 1
     // debug
     cresult->c_len = *dst_len;
@@ -215,4 +555,23 @@ int upx_test_overlap       ( const upx_bytep buf,
     return r;
 }
 
+
+// Compute the smallest src_off for which upx_test_overlap() succeeds
+// with a single decoding pass. Not all methods support this, so
+// callers must be prepared to fall back to upx_test_overlap().
+int upx_find_overlap       ( const upx_bytep src, unsigned  src_len,
+                                   unsigned* dst_len, unsigned* src_off,
+                                   int method )
+{
+    int r = UPX_E_ERROR;
+
+    assert(*dst_len > 0);
+    *src_off = 0;
+
+    if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method))
+        r = upx_nrv_find_overlap(src, src_len, dst_len, src_off, method);
+
+    return r;
+}
+
 /* vim:set ts=4 sw=4 et: */
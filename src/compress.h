@@ -126,6 +126,12 @@ unsigned upx_zlib_crc32  (const void *buf, unsigned len, unsigned crc);
 #endif
 
 
+// NRV2B/NRV2D/NRV2E streams; see compress_overlap.cpp
+int upx_nrv_find_overlap   ( const upx_bytep src, unsigned  src_len,
+                                   unsigned* dst_len, unsigned* src_off,
+                                   int method );
+
+
 #endif /* already included */
 
 /* vim:set ts=4 sw=4 et: */
@@ -29,6 +29,7 @@
 #include "conf.h"
 #include "compress.h"
 #include "mem.h"
+#include "thread.h"
 
 #if (ACC_CC_CLANG)
 #  pragma clang diagnostic ignored "-Wshadow"
@@ -56,6 +57,7 @@ void lzma_compress_config_t::reset()
     fast_mode = 2;
     num_fast_bytes.reset();
     match_finder_cycles = 0;
+    num_threads.reset();
 
     max_num_probs = 0;
 }
@@ -229,6 +231,9 @@ error:
 #undef _WIN32
 #undef _WIN32_WCE
 #undef COMPRESS_MF_MT
+#if (WITH_LZMA_MT)
+#  define COMPRESS_MF_MT 1
+#endif
 #undef _NO_EXCEPTIONS
 #include "C/Common/MyInitGuid.h"
 //#include "C/7zip/Compress/LZMA/LZMADecoder.h"
@@ -289,12 +294,18 @@ struct ProgressInfo : public ICompressProgressInfo, public CMyUnknownImp
     MY_UNKNOWN_IMP
     STDMETHOD(SetRatioInfo)(const UInt64 *inSize, const UInt64 *outSize);
     upx_callback_p cb;
+    unsigned max_c_len; bool overrun;
 };
 
 STDMETHODIMP ProgressInfo::SetRatioInfo(const UInt64 *inSize, const UInt64 *outSize)
 {
     if (cb && cb->nprogress)
         cb->nprogress(cb, (unsigned) *inSize, (unsigned) *outSize);
+    // stop as soon as the output is over budget
+    if (max_c_len && *outSize > max_c_len) {
+        overrun = true;
+        return E_FAIL;
+    }
     return S_OK;
 }
 
@@ -306,6 +317,9 @@ STDMETHODIMP ProgressInfo::SetRatioInfo(const UInt64 *inSize, const UInt64 *outS
 #include "C/7zip/Common/OutBuffer.cpp"
 #include "C/7zip/Common/StreamUtils.cpp"
 #include "C/7zip/Compress/LZ/LZInWindow.cpp"
+#if (WITH_LZMA_MT)
+#include "C/7zip/Compress/LZ/MT/MT.cpp"
+#endif
 //#include "C/7zip/Compress/LZ/LZOutWindow.cpp"
 //#include "C/7zip/Compress/LZMA/LZMADecoder.cpp"
 #include "C/7zip/Compress/LZMA/LZMAEncoder.cpp"
@@ -313,6 +327,65 @@ STDMETHODIMP ProgressInfo::SetRatioInfo(const UInt64 *inSize, const UInt64 *outS
 #undef RC_NORMALIZE
 
 
+/*************************************************************************
+// Setting up an encoder allocates the match finder tables, so keep
+// encoders around for the next call. CEncoder::Create() only reallocates
+// when the dictionary size changes. At most one encoder per thread is
+// in use at any time, which also bounds the size of the pool.
+**************************************************************************/
+
+namespace MyLzma {
+
+struct EncoderPool
+{
+    enum { MAX_ENCODERS = 64 };
+    Mutex mutex;
+    NCompress::NLZMA::CEncoder *encoders[MAX_ENCODERS];
+    unsigned nencoders;
+
+    EncoderPool() : nencoders(0) { }
+    ~EncoderPool() {
+        while (nencoders > 0)
+            delete encoders[--nencoders];
+    }
+    NCompress::NLZMA::CEncoder *get() {
+        {
+            MutexLocker lock(&mutex);
+            if (nencoders > 0)
+                return encoders[--nencoders];
+        }
+        return new NCompress::NLZMA::CEncoder;
+    }
+    void put(NCompress::NLZMA::CEncoder *enc) {
+        {
+            MutexLocker lock(&mutex);
+            if (nencoders < MAX_ENCODERS) {
+                encoders[nencoders++] = enc;
+                return;
+            }
+        }
+        delete enc;
+    }
+};
+
+static EncoderPool encoder_pool;
+
+struct PooledEncoder
+{
+    NCompress::NLZMA::CEncoder *enc;
+    bool reuse;
+    PooledEncoder() : enc(encoder_pool.get()), reuse(true) { }
+    ~PooledEncoder() {
+        if (reuse)
+            encoder_pool.put(enc);
+        else
+            delete enc;
+    }
+};
+
+} // namespace
+
+
 int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
                                    upx_bytep dst, unsigned* dst_len,
                                    upx_callback_p cb,
@@ -335,9 +408,12 @@ int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
 
     MyLzma::ProgressInfo progress; progress.AddRef();
     progress.cb = cb;
+    progress.max_c_len = cconf_parm ? cconf_parm->max_c_len : 0;
+    progress.overrun = false;
 
-    NCompress::NLZMA::CEncoder enc;
-    const PROPID propIDs[8] = {
+    MyLzma::PooledEncoder pooled;
+    NCompress::NLZMA::CEncoder &enc = *pooled.enc;
+    const PROPID propIDs[9] = {
         NCoderPropID::kPosStateBits,        // 0  pb    _posStateBits(2)
         NCoderPropID::kLitPosBits,          // 1  lp    _numLiteralPosStateBits(0)
         NCoderPropID::kLitContextBits,      // 2  lc    _numLiteralContextBits(3)
@@ -345,10 +421,11 @@ int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
         NCoderPropID::kAlgorithm,           // 4  fm    _fastmode
         NCoderPropID::kNumFastBytes,        // 5  fb
         NCoderPropID::kMatchFinderCycles,   // 6  mfc   _matchFinderCycles, _cutValue
-        NCoderPropID::kMatchFinder          // 7  mf
+        NCoderPropID::kMatchFinder,         // 7  mf
+        NCoderPropID::kMultiThread          // 8  mt    _multiThread
     };
-    PROPVARIANT pr[8];
-    const unsigned nprops = 8;
+    PROPVARIANT pr[9];
+    unsigned nprops = 8;
     static const wchar_t matchfinder[] = L"BT4";
     assert(NCompress::NLZMA::FindMatchFinder(matchfinder) >= 0);
     pr[7].vt = VT_BSTR; pr[7].bstrVal = ACC_PCAST(BSTR, ACC_UNCONST_CAST(wchar_t *, matchfinder));
@@ -363,6 +440,15 @@ int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
     pr[4].uintVal = res->fast_mode;
     pr[5].uintVal = res->num_fast_bytes;
     pr[6].uintVal = res->match_finder_cycles;
+    // The multi-threaded match finder runs the BT4 search on a helper
+    // thread ahead of the encoder; the compressed stream is identical.
+    // Always set it, as a pooled encoder keeps the previous setting.
+    // (The SDK only knows this property when built with COMPRESS_MF_MT.)
+#if (WITH_LZMA_MT)
+    pr[8].vt = VT_BOOL;
+    pr[8].boolVal = (lcconf && upx_thread_get_nthreads(lcconf->num_threads) > 1) ? VARIANT_TRUE : VARIANT_FALSE;
+    nprops = 9;
+#endif
 
     try {
 
@@ -387,11 +473,16 @@ int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
     } catch (...) {
         rh = E_OUTOFMEMORY;
     }
+    // do not reuse an encoder in an unknown state
+    if (rh == E_OUTOFMEMORY)
+        pooled.reuse = false;
 
     assert(is.b_pos <=  src_len);
     assert(os.b_pos <= *dst_len);
     if (rh == E_OUTOFMEMORY)
         r = UPX_E_OUT_OF_MEMORY;
+    else if (progress.overrun)
+        r = UPX_E_OUTPUT_OVERRUN;
     else if (os.overflow)
     {
         assert(os.b_pos == *dst_len);
@@ -423,6 +514,68 @@ error:
 #include "C/7zip/Compress/LZMA_C/LzmaDecode.h"
 #include "C/7zip/Compress/LZMA_C/LzmaDecode.c"
 
+// Same idea as EncoderPool above, for plain buffers: the probability
+// tables of the decoder (no need to clear a reused table, LzmaDecode()
+// initializes all probabilities itself) and the scratch buffer of
+// upx_lzma_test_overlap().
+namespace MyLzma {
+
+template <class T>
+struct BufferPool
+{
+    enum { MAX_BUFFERS = 64 };
+    Mutex mutex;
+    T *buffers[MAX_BUFFERS];
+    unsigned sizes[MAX_BUFFERS];
+    unsigned nbuffers;
+
+    BufferPool() : nbuffers(0) { }
+    ~BufferPool() {
+        while (nbuffers > 0)
+            free(buffers[--nbuffers]);
+    }
+    T *get(unsigned n, unsigned *size) {
+        T *too_small = NULL;
+        {
+            MutexLocker lock(&mutex);
+            for (unsigned i = 0; i < nbuffers; i++)
+                if (sizes[i] >= n) {
+                    T *p = buffers[i];
+                    *size = sizes[i];
+                    --nbuffers;
+                    buffers[i] = buffers[nbuffers];
+                    sizes[i] = sizes[nbuffers];
+                    return p;
+                }
+            // none fits: drop one, so that outgrown buffers do not pile up
+            if (nbuffers > 0)
+                too_small = buffers[--nbuffers];
+        }
+        free(too_small);
+        *size = n;
+        return (T *) malloc(sizeof(T) * n);
+    }
+    void put(T *p, unsigned size) {
+        if (p == NULL)
+            return;
+        {
+            MutexLocker lock(&mutex);
+            if (nbuffers < MAX_BUFFERS) {
+                buffers[nbuffers] = p;
+                sizes[nbuffers] = size;
+                nbuffers++;
+                return;
+            }
+        }
+        free(p);
+    }
+};
+
+static BufferPool<CProb> probs_pool;
+static BufferPool<upx_byte> overlap_pool;
+
+} // namespace
+
 int upx_lzma_decompress    ( const upx_bytep src, unsigned  src_len,
                                    upx_bytep dst, unsigned* dst_len,
                                    int method,
@@ -435,6 +588,7 @@ int upx_lzma_decompress    ( const upx_bytep src, unsigned  src_len,
     COMPILE_TIME_ASSERT(LZMA_LIT_SIZE == 768)
 
     CLzmaDecoderState s; memset(&s, 0, sizeof(s));
+    unsigned probs_size = 0;
     SizeT src_out = 0, dst_out = 0;
     int r = UPX_E_ERROR;
     int rh;
@@ -462,7 +616,7 @@ int upx_lzma_decompress    ( const upx_bytep src, unsigned  src_len,
         UNUSED(res);
         //printf("\nlzma_decompress config: %u %u %u %u %u\n", res->pos_bits, res->lit_pos_bits, res->lit_context_bits, res->dict_size, res->num_probs);
     }
-    s.Probs = (CProb *) malloc(sizeof(CProb) * LzmaGetNumProbs(&s.Properties));
+    s.Probs = MyLzma::probs_pool.get(LzmaGetNumProbs(&s.Properties), &probs_size);
     if (!s.Probs)
     {
         r = UPX_E_OUT_OF_MEMORY;
@@ -480,7 +634,7 @@ int upx_lzma_decompress    ( const upx_bytep src, unsigned  src_len,
 
 error:
     *dst_len = dst_out;
-    free(s.Probs);
+    MyLzma::probs_pool.put(s.Probs, probs_size);
     return r;
 }
 
@@ -498,20 +652,24 @@ int upx_lzma_test_overlap  ( const upx_bytep buf,
 {
     assert(M_IS_LZMA(method));
 
-    MemBuffer b(src_off + src_len);
+    // findOverlapOverhead() calls this many times in a row, so reuse
+    // the scratch buffer instead of allocating one for every probe
+    unsigned b_size = 0;
+    upx_bytep b = MyLzma::overlap_pool.get(src_off + src_len, &b_size);
+    if (!b)
+        return UPX_E_OUT_OF_MEMORY;
     memcpy(b + src_off, buf + src_off, src_len);
     unsigned saved_dst_len = *dst_len;
     int r = upx_lzma_decompress(b + src_off, src_len, b, dst_len, method, cresult);
-    if (r != UPX_E_OK)
-        return r;
-    if (*dst_len != saved_dst_len)
-        return UPX_E_ERROR;
+    if (r == UPX_E_OK && *dst_len != saved_dst_len)
+        r = UPX_E_ERROR;
     // NOTE: there is a very tiny possibility that decompression has
     //   succeeded but the data is not restored correctly because of
     //   in-place buffer overlapping, so we use an extra memcmp().
-    if (tbuf != NULL && memcmp(tbuf, b, *dst_len) != 0)
-        return UPX_E_ERROR;
-    return UPX_E_OK;
+    if (r == UPX_E_OK && tbuf != NULL && memcmp(tbuf, b, *dst_len) != 0)
+        r = UPX_E_ERROR;
+    MyLzma::overlap_pool.put(b, b_size);
+    return r;
 }
 
 
@@ -0,0 +1,245 @@
+/* compress_overlap.cpp --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2020 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+#include "conf.h"
+#include "compress.h"
+
+
+/*************************************************************************
+// Compute the smallest src_off for which an in-place decompression
+// (compressed data at buf[src_off], output at buf[0]) never overwrites
+// input that has not been read yet. This is what the test_overlap
+// functions of UCL check for a given src_off, but here we only need
+// a single pass: simply track the worst distance between output
+// and input position, using the very same checkpoints.
+//
+// The decoders below do not produce any output; they only mirror the
+// bitstream parsing of UCL's n2b_d.c, n2d_d.c and n2e_d.c.
+**************************************************************************/
+
+struct NrvBits8
+{
+    unsigned bb;
+    NrvBits8() : bb(0) { }
+    int getbit(const upx_bytep src, unsigned src_len, unsigned &ilen) {
+        if (bb & 0x7f)
+            bb *= 2;
+        else {
+            if (ilen >= src_len) return -1;
+            bb = src[ilen++] * 2 + 1;
+        }
+        return (bb >> 8) & 1;
+    }
+};
+
+struct NrvBitsLe16
+{
+    unsigned bb;
+    NrvBitsLe16() : bb(0) { }
+    int getbit(const upx_bytep src, unsigned src_len, unsigned &ilen) {
+        bb *= 2;
+        if (!(bb & 0xffff)) {
+            if (src_len - ilen < 2) return -1;
+            bb = get_le16(src + ilen) * 2 + 1;
+            ilen += 2;
+        }
+        return (bb >> 16) & 1;
+    }
+};
+
+struct NrvBitsLe32
+{
+    unsigned bb, bc;
+    NrvBitsLe32() : bb(0), bc(0) { }
+    int getbit(const upx_bytep src, unsigned src_len, unsigned &ilen) {
+        if (bc > 0)
+            return (bb >> --bc) & 1;
+        if (src_len - ilen < 4) return -1;
+        bb = get_le32(src + ilen);
+        ilen += 4;
+        bc = 31;
+        return (bb >> 31) & 1;
+    }
+};
+
+
+template <class T>
+static int nrv_find_overlap(const upx_bytep src, unsigned src_len,
+                            unsigned *dst_len, unsigned *src_off, int method)
+{
+    T bits;
+    const bool is_2b = M_IS_NRV2B(method);
+    const bool is_2e = M_IS_NRV2E(method);
+    const unsigned oend = *dst_len;
+    unsigned ilen = 0, olen = 0;
+    unsigned last_m_off = 1;
+    unsigned need = 0;
+    int b;
+
+#define GETBIT(v) \
+    do { if ((b = bits.getbit(src, src_len, ilen)) < 0) goto input_overrun; \
+         v = (unsigned) b; } while (0)
+    // UCL fails with UCL_E_OVERLAP_OVERRUN if olen > src_off + ilen here
+#define CHECKPOINT \
+    do { if (olen > ilen && olen - ilen > need) need = olen - ilen; } while (0)
+
+    *src_off = 0;
+    for (;;)
+    {
+        unsigned m_off, m_len, x;
+
+        for (;;)
+        {
+            GETBIT(x);
+            if (!x)
+                break;
+            // literal
+            if (ilen >= src_len)
+                goto input_overrun;
+            if (olen >= oend)
+                goto output_overrun;
+            CHECKPOINT;
+            olen++; ilen++;
+        }
+
+        m_off = 1;
+        for (;;)
+        {
+            GETBIT(x); m_off = m_off*2 + x;
+            GETBIT(x);
+            if (x)
+                break;
+            if (!is_2b)
+                { GETBIT(x); m_off = (m_off-1)*2 + x; }
+        }
+        m_len = 0;
+        if (m_off == 2)
+        {
+            m_off = last_m_off;
+            if (!is_2b)
+                GETBIT(m_len);
+        }
+        else
+        {
+            if (ilen >= src_len)
+                goto input_overrun;
+            m_off = (m_off-3)*256 + src[ilen++];
+            if (m_off == 0xffffffffu)
+                break;
+            if (!is_2b)
+            {
+                m_len = (m_off ^ 0xffffffffu) & 1;
+                m_off >>= 1;
+            }
+            last_m_off = ++m_off;
+        }
+        if (is_2b)
+            GETBIT(m_len);
+
+        if (is_2e)
+        {
+            if (m_len)
+                { GETBIT(x); m_len = 1 + x; }
+            else
+            {
+                GETBIT(x);
+                if (x)
+                    { GETBIT(x); m_len = 3 + x; }
+                else
+                {
+                    m_len++;
+                    do {
+                        GETBIT(x); m_len = m_len*2 + x;
+                        GETBIT(x);
+                    } while (!x);
+                    m_len += 3;
+                }
+            }
+        }
+        else
+        {
+            GETBIT(x); m_len = m_len*2 + x;
+            if (m_len == 0)
+            {
+                m_len++;
+                do {
+                    GETBIT(x); m_len = m_len*2 + x;
+                    GETBIT(x);
+                } while (!x);
+                m_len += 2;
+            }
+        }
+        m_len += (m_off > (is_2b ? 0xd00u : 0x500u));
+
+        // match of m_len + 1 bytes
+        if (m_len >= oend - olen)
+            goto output_overrun;
+        if (m_off > olen)
+            return UPX_E_ERROR;
+        olen += m_len + 1;
+        CHECKPOINT;
+    }
+#undef GETBIT
+#undef CHECKPOINT
+
+    *dst_len = olen;
+    *src_off = need;
+    return ilen == src_len ? UPX_E_OK : UPX_E_INPUT_NOT_CONSUMED;
+
+input_overrun:
+    *dst_len = olen;
+    return UPX_E_INPUT_OVERRUN;
+output_overrun:
+    *dst_len = olen;
+    return UPX_E_OUTPUT_OVERRUN;
+}
+
+
+int upx_nrv_find_overlap   ( const upx_bytep src, unsigned  src_len,
+                                   unsigned* dst_len, unsigned* src_off,
+                                   int method )
+{
+    switch (method)
+    {
+    case M_NRV2B_8:
+    case M_NRV2D_8:
+    case M_NRV2E_8:
+        return nrv_find_overlap<NrvBits8>(src, src_len, dst_len, src_off, method);
+    case M_NRV2B_LE16:
+    case M_NRV2D_LE16:
+    case M_NRV2E_LE16:
+        return nrv_find_overlap<NrvBitsLe16>(src, src_len, dst_len, src_off, method);
+    case M_NRV2B_LE32:
+    case M_NRV2D_LE32:
+    case M_NRV2E_LE32:
+        return nrv_find_overlap<NrvBitsLe32>(src, src_len, dst_len, src_off, method);
+    }
+    return UPX_E_ERROR;
+}
+
+/* vim:set ts=4 sw=4 et: */
@@ -104,6 +104,9 @@ int upx_zlib_compress      ( const upx_bytep src, unsigned  src_len,
     s.next_out = dst;
     s.avail_out = *dst_len;
     s.total_in = s.total_out = 0;
+    // deflate() runs out of space one byte past the budget
+    if (cconf_parm && cconf_parm->max_c_len && cconf_parm->max_c_len < *dst_len)
+        s.avail_out = cconf_parm->max_c_len + 1;
 
     zr = deflateInit2(&s, level, Z_DEFLATED, 0 - (int)window_bits,
                       mem_level, strategy);
@@ -111,7 +114,16 @@ int upx_zlib_compress      ( const upx_bytep src, unsigned  src_len,
         goto error;
     zr = deflate(&s, Z_FINISH);
     if (zr != Z_STREAM_END)
+    {
+        if ((zr == Z_OK || zr == Z_BUF_ERROR) && s.avail_out == 0 &&
+            cconf_parm && cconf_parm->max_c_len)
+        {
+            (void) deflateEnd(&s);
+            *dst_len = s.total_out;
+            return UPX_E_OUTPUT_OVERRUN;
+        }
         goto error;
+    }
     zr = deflateEnd(&s);
     if (zr != Z_OK)
         goto error;
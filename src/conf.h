@@ -132,6 +132,28 @@ typedef unsigned char   upx_byte;
 #define WITH_LZMA 0x443
 #define WITH_UCL 1
 #define WITH_ZLIB 1
+#if !defined(WITH_THREADS)
+#  define WITH_THREADS 0
+#endif
+// per-thread state for "--jobs"; without it all files are processed serially
+#if (WITH_THREADS) && (ACC_CC_CLANG || ACC_CC_GNUC)
+#  define UPX_THREAD_LOCAL  __thread
+#  define WITH_THREAD_LOCAL 1
+#elif (WITH_THREADS) && (ACC_CC_MSC)
+#  define UPX_THREAD_LOCAL  __declspec(thread)
+#  define WITH_THREAD_LOCAL 1
+#else
+#  define UPX_THREAD_LOCAL  /*empty*/
+#  define WITH_THREAD_LOCAL 0
+#endif
+// LZMA match finder helper thread; needs the SDK's LZ/MT code, which
+// uses the Win32 thread and event API and has only been built there
+#if !defined(WITH_LZMA_MT)
+#  define WITH_LZMA_MT 0
+#endif
+#if (WITH_LZMA_MT) && !(ACC_OS_WIN32 || ACC_OS_WIN64)
+#  error "WITH_LZMA_MT is only supported on Windows targets"
+#endif
 #if (WITH_UCL)
 #  define ucl_compress_config_t REAL_ucl_compress_config_t
 #  include <ucl/uclconf.h>
@@ -533,6 +555,7 @@ struct lzma_compress_config_t
     typedef OptVar<unsigned,  3u, 0u,   8u> lit_context_bits_t;     // lc
     typedef OptVar<unsigned, (1u<<22), 1u, (1u<<30) > dict_size_t;
     typedef OptVar<unsigned, 64u, 5u, 273u> num_fast_bytes_t;
+    typedef OptVar<unsigned,  1u, 0u, 256u> num_threads_t;          // 0 means all CPUs
 
     pos_bits_t          pos_bits;           // pb
     lit_pos_bits_t      lit_pos_bits;       // lp
@@ -541,6 +564,7 @@ struct lzma_compress_config_t
     unsigned            fast_mode;
     num_fast_bytes_t    num_fast_bytes;
     unsigned            match_finder_cycles;
+    num_threads_t       num_threads;        // does not change the output
 
     unsigned            max_num_probs;
 
@@ -573,7 +597,8 @@ struct upx_compress_config_t
     lzma_compress_config_t  conf_lzma;
     ucl_compress_config_t   conf_ucl;
     zlib_compress_config_t  conf_zlib;
-    void reset() { conf_lzma.reset(); conf_ucl.reset(); conf_zlib.reset(); }
+    unsigned                max_c_len;  // output budget; 0 means no limit
+    void reset() { conf_lzma.reset(); conf_ucl.reset(); conf_zlib.reset(); max_c_len = 0; }
 };
 
 #define NULL_cconf  ((upx_compress_config_t *) NULL)
@@ -691,7 +716,8 @@ void infoWriting(const char *what, long size);
 
 
 // work.cpp
-void do_one_file(const char *iname, char *oname);
+struct UiTotals;
+void do_one_file(const char *iname, char *oname, UiTotals *totals);
 void do_files(int i, int argc, char *argv[]);
 
 
@@ -706,7 +732,17 @@ void show_version(int);
 
 // compress.cpp
 unsigned upx_adler32(const void *buf, unsigned len, unsigned adler=1);
+unsigned upx_adler32_combine(unsigned adler1, unsigned adler2, unsigned len2);
 unsigned upx_crc32(const void *buf, unsigned len, unsigned crc=0);
+unsigned upx_crc32c(const void *buf, unsigned len, unsigned crc=0);
+unsigned upx_crc32c_combine(unsigned crc1, unsigned crc2, unsigned len2);
+
+// checksum kinds for PackHeader::u_adler and c_adler
+#define UPX_CHECKSUM_ADLER32    0
+#define UPX_CHECKSUM_CRC32C     1
+unsigned upx_checksum_init(int kind);
+unsigned upx_checksum(int kind, const void *buf, unsigned len, unsigned prev);
+unsigned upx_checksum_combine(int kind, unsigned sum1, unsigned sum2, unsigned len2);
 
 int upx_compress           ( const upx_bytep src, unsigned  src_len,
                                    upx_bytep dst, unsigned* dst_len,
@@ -724,6 +760,9 @@ int upx_test_overlap       ( const upx_bytep buf,
                                    unsigned* dst_len,
                                    int method,
                              const upx_compress_result_t *cresult );
+int upx_find_overlap       ( const upx_bytep src, unsigned  src_len,
+                                   unsigned* dst_len, unsigned* src_off,
+                                   int method );
 
 
 #if (ACC_OS_CYGWIN || ACC_OS_DOS16 || ACC_OS_DOS32 || ACC_OS_EMX || ACC_OS_OS2 || ACC_OS_OS216 || ACC_OS_WIN16 || ACC_OS_WIN32 || ACC_OS_WIN64)
@@ -122,14 +122,6 @@ typedef struct
 console_t;
 
 
-#if defined(__GNUC__)
-void __acc_cdecl_va con_fprintf(FILE *f, const char *format, ...)
-        __attribute__((__format__(printf,2,3)));
-#else
-void __acc_cdecl_va con_fprintf(FILE *f, const char *format, ...);
-#endif
-
-
 #define FG_BLACK     0x00
 #define FG_BLUE      0x01
 #define FG_GREEN     0x02
@@ -165,6 +157,13 @@ void __acc_cdecl_va con_fprintf(FILE *f, const char *format, ...);
 
 extern FILE *con_term;
 
+#if defined(__GNUC__)
+void __acc_cdecl_va con_fprintf(FILE *f, const char *format, ...)
+        __attribute__((__format__(printf,2,3)));
+#else
+void __acc_cdecl_va con_fprintf(FILE *f, const char *format, ...);
+#endif
+
 #if (USE_CONSOLE)
 
 extern int con_mode;
@@ -183,8 +182,31 @@ extern console_t console_screen;
 #else
 
 #define con_fg(f,x)     0
-#define con_fprintf     fprintf
 
 #endif /* USE_CONSOLE */
 
+
+/*************************************************************************
+// capture the output of a thread, so that the messages of files which
+// are processed concurrently can be written in order (see do_files())
+**************************************************************************/
+
+class ConsoleCapture : private noncopyable
+{
+public:
+    ConsoleCapture();
+    ~ConsoleCapture();
+    // "raw" output bypasses the console, see pr_print()
+    void append(FILE *f, const char *s, bool raw = false);
+    // write out and forget everything captured so far
+    void replay();
+private:
+    char *buf;
+    unsigned len;
+    unsigned capacity;
+};
+
+// if set, con_fprintf() and the msg.cpp functions append to this capture
+extern UPX_THREAD_LOCAL ConsoleCapture *con_capture;
+
 /* vim:set ts=4 sw=4 et: */
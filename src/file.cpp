@@ -29,6 +29,25 @@
 #include "conf.h"
 #include "file.h"
 #include "mem.h"
+#if (HAVE_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
+#if (ACC_OS_POSIX)
+#  include <sys/uio.h>
+#  define USE_WRITEV 1
+#endif
+#if defined(__linux__)
+#  include <sys/sendfile.h>
+#  include <sys/syscall.h>
+#  define USE_SENDFILE 1
+#  if defined(__NR_copy_file_range)
+#    define USE_COPY_FILE_RANGE 1
+#  endif
+#endif
+
+// OutputFile writes out chunks of this size, at aligned file offsets
+#define OUTPUT_BUFFER_SIZE  (256 * 1024)
+#define OUTPUT_BUFFER_ALIGN 4096
 
 
 /*************************************************************************
@@ -220,13 +239,16 @@ off_t FileBase::st_size() const
 //
 **************************************************************************/
 
-InputFile::InputFile()
+InputFile::InputFile() :
+    _length_orig(0), _map(NULL), _map_size(0), _map_pos(0)
 {
 }
 
 
 InputFile::~InputFile()
 {
+    // FileBase::~FileBase() cannot call our close()
+    unmap();
 }
 
 
@@ -252,9 +274,28 @@ void InputFile::sopen(const char *name, int flags, int shflags)
 }
 
 
+bool InputFile::close()
+{
+    unmap();
+    return super::close();
+}
+
+
 int InputFile::read(void *buf, int len)
 {
-    return super::read(buf, len);
+    if (_map == NULL)
+        return super::read(buf, len);
+    if (!isOpen() || len < 0)
+        throwIOException("bad read");
+    mem_size_assert(1, len); // sanity check
+    off_t l = _map_size - _map_pos;
+    if (l <= 0)
+        return 0;
+    if (l > len)
+        l = len;
+    memcpy(buf, _map + _map_pos, (size_t) l);
+    _map_pos += l;
+    return (int) l;
 }
 
 int InputFile::readx(void *buf, int len)
@@ -291,7 +332,38 @@ int InputFile::readx(MemBuffer &buf, int len)
 
 off_t InputFile::seek(upx_int64_t off64, int whence)
 {
-    off_t pos = super::seek(off64, whence);
+    off_t pos;
+    if (_map == NULL)
+        pos = super::seek(off64, whence);
+    else
+    {
+        // same as FileBase::seek(), but without lseek()
+        mem_size_assert(1, off64 >= 0 ? off64 : -off64); // sanity check
+        off_t off = ACC_ICONV(off_t, off64);
+        if (!isOpen())
+            throwIOException("bad seek 1");
+        if (whence == SEEK_SET) {
+            if (off < 0)
+                throwIOException("bad seek 2");
+            off += _offset;
+        }
+        else if (whence == SEEK_END) {
+            if (off > 0)
+                throwIOException("bad seek 3");
+            off += _offset + _length;
+        }
+        else if (whence != SEEK_CUR)
+            throwIOException("seek error", EINVAL);
+        // FileBase::seek() returns the relative offset for SEEK_CUR, so
+        // "bad seek 4" below does not catch a SEEK_CUR past the end
+        // there; do the same here and let read() return 0 instead
+        pos = off - _offset;
+        if (whence == SEEK_CUR)
+            off += _map_pos;
+        if (off < 0)
+            throwIOException("seek error", EINVAL);
+        _map_pos = off;
+    }
     if (_length < pos)
         throwIOException("bad seek 4");
     return pos;
@@ -300,7 +372,11 @@ off_t InputFile::seek(upx_int64_t off64, int whence)
 
 off_t InputFile::tell() const
 {
-    return super::tell();
+    if (_map == NULL)
+        return super::tell();
+    if (!isOpen())
+        throwIOException("bad tell");
+    return _map_pos - _offset;
 }
 
 off_t InputFile::st_size_orig() const
@@ -308,18 +384,95 @@ off_t InputFile::st_size_orig() const
     return _length_orig;
 }
 
+
+bool InputFile::map()
+{
+#if (HAVE_SYS_MMAN_H) && defined(MAP_PRIVATE)
+    if (_map != NULL)
+        return true;
+    if (!isOpen() || _fd < 0 || _offset != 0 || _length <= 0 || !mem_size_valid_bytes(_length))
+        return false;
+    off_t pos = super::tell();
+    void *p = ::mmap(NULL, (size_t) _length, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (p == MAP_FAILED)
+        return false;
+    _map = (upx_byte *) p;
+    _map_size = _length;
+    _map_pos = pos;
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+void InputFile::unmap()
+{
+#if (HAVE_SYS_MMAN_H) && defined(MAP_PRIVATE)
+    if (_map != NULL)
+        (void) ::munmap(_map, (size_t) _map_size);
+#endif
+    _map = NULL;
+    _map_size = 0;
+    _map_pos = 0;
+}
+
+
+int InputFile::readView(MemBuffer &buf, int len)
+{
+    assert(buf.getVoidPtr() == NULL);
+    if (_map != NULL && len > 0 && _map_pos <= _map_size && len <= _map_size - _map_pos)
+    {
+        // a separate mapping, so that patching buf does not affect read()
+        if (buf.allocMapped(_fd, _map_pos, len))
+        {
+            _map_pos += len;
+            return len;
+        }
+    }
+    buf.alloc(len);
+    return readx(buf.getVoidPtr(), len);
+}
+
+
+int InputFile::getFd() const
+{
+    // the descriptor is only positioned on demand, e.g. for dup()
+    if (_map != NULL && ::lseek(_fd, _map_pos, SEEK_SET) < 0)
+        throwIOException("seek error", errno);
+    return _fd;
+}
+
 /*************************************************************************
 //
 **************************************************************************/
 
 OutputFile::OutputFile() :
-    bytes_written(0)
+    bytes_written(0), wb(NULL), wb_len(0), wb_cap(0), wb_pos(0), w_pos(0),
+    wb_seekable(true)
 {
 }
 
 
 OutputFile::~OutputFile()
 {
+    // FileBase::~FileBase() cannot call our close(), and the data
+    // does not matter any longer if an exception is on its way
+    try {
+        flush();
+    } catch (...) {
+    }
+    ::free(wb);
+    wb = NULL;
+}
+
+
+bool OutputFile::close()
+{
+    if (isOpen())
+        flush();
+    wb_len = 0;
+    return super::close();
 }
 
 
@@ -369,10 +522,186 @@ bool OutputFile::openStdout(int flags, bool force)
 
 void OutputFile::write(const void *buf, int len)
 {
-    super::write(buf, len);
+    if (!isOpen() || len < 0)
+        throwIOException("bad write");
+    mem_size_assert(1, len); // sanity check
+    const upx_byte *p = (const upx_byte *) buf;
+    if (wb_len > 0 && (w_pos < wb_pos || w_pos > wb_pos + wb_len))
+        flush();
+    if (len == 0)
+        return;
+    if (wb_len == 0)
+        startBuffer(-1);
+    unsigned o = ACC_ICONV(unsigned, w_pos - wb_pos);
+    if (o + len <= wb_cap)
+    {
+        // append to or patch the pending data
+        memcpy(wb + o, p, len);
+        if (wb_len < o + len)
+            wb_len = o + len;
+        w_pos += len;
+    }
+    else if (o < wb_len)
+    {
+        // a patch that runs past the end of the buffer
+        flush();
+        super::write(p, len);
+    }
+    else
+    {
+        // write the pending data and the aligned part of buf in one go,
+        // and keep the rest
+        off_t end = w_pos + len;
+        unsigned tail = ACC_ICONV(unsigned, end % OUTPUT_BUFFER_ALIGN);
+        flushWith(p, len - tail);
+        if (tail > 0)
+        {
+            startBuffer(end - tail);
+            memcpy(wb, p + len - tail, tail);
+            wb_len = tail;
+            w_pos = end;
+        }
+    }
     bytes_written += len;
 }
 
+
+// start an empty buffer at the current position of the descriptor
+void OutputFile::startBuffer(off_t pos)
+{
+    assert(wb_len == 0);
+    if (wb == NULL)
+    {
+        wb = (upx_byte *) ::malloc(OUTPUT_BUFFER_SIZE);
+        if (wb == NULL)
+            throwOutOfMemoryException();
+    }
+    if (pos < 0)
+    {
+        pos = ::lseek(_fd, 0, SEEK_CUR);
+        wb_seekable = (pos >= 0);
+        if (pos < 0)
+            pos = 0;    // a pipe - only the relative offsets matter
+    }
+    wb_pos = w_pos = pos;
+    wb_cap = OUTPUT_BUFFER_SIZE - ACC_ICONV(unsigned, pos % OUTPUT_BUFFER_ALIGN);
+}
+
+
+void OutputFile::flush()
+{
+    flushWith(NULL, 0);
+}
+
+
+// write the pending data followed by buf, which must be contiguous
+void OutputFile::flushWith(const void *buf, unsigned len)
+{
+    const unsigned n = wb_len;
+    wb_len = 0;
+    if (n == 0)
+    {
+        if (len > 0)
+            super::write(buf, len);
+        return;
+    }
+    assert(len == 0 || w_pos == wb_pos + n);
+    if (wb_seekable && ::lseek(_fd, wb_pos, SEEK_SET) < 0)
+        throwIOException("seek error", errno);
+#if (USE_WRITEV)
+    struct iovec iov[2];
+    iov[0].iov_base = (void *) wb;
+    iov[0].iov_len = n;
+    iov[1].iov_base = ACC_UNCONST_CAST(void *, buf);
+    iov[1].iov_len = len;
+    errno = 0;
+    long l = (long) ::writev(_fd, iov, len > 0 ? 2 : 1);
+    if (l < 0 && errno != EINTR)
+        throwIOException("write error", errno);
+    if (l < 0)
+        l = 0;
+    // complete a short write the slow way
+    if ((unsigned long) l < n)
+        super::write(wb + l, n - l);
+    l = (unsigned long) l < n ? 0 : l - n;
+    if ((unsigned long) l < len)
+        super::write((const upx_byte *) buf + l, len - l);
+#else
+    super::write(wb, n);
+    if (len > 0)
+        super::write(buf, len);
+#endif
+    // move the descriptor back to the logical position after a patch
+    if (len == 0 && wb_seekable && w_pos != wb_pos + n)
+        if (::lseek(_fd, w_pos, SEEK_SET) < 0)
+            throwIOException("seek error", errno);
+}
+
+
+off_t OutputFile::copyFrom(InputFile *f, off_t len)
+{
+#if (USE_SENDFILE)
+    if (!isOpen() || !f->isOpen() || len <= 0)
+        return 0;
+    const off_t pos = f->tell();
+    const int ifd = f->getFd();     // positions a mapped file
+    const int ofd = getFd();        // flushes the buffer
+    if (ifd < 0 || ofd < 0)
+        return 0;
+    const off_t ipos = ::lseek(ifd, 0, SEEK_CUR);
+    if (ipos < 0)
+        return 0;
+    // try copy_file_range() first, then sendfile(); on any error the
+    // caller copies the rest
+    bool use_cfr = true;
+    off_t done = 0;
+    while (done < len)
+    {
+        size_t n = (size_t) UPX_MIN(len - done, (off_t) 0x40000000);
+        long l;
+        errno = 0;
+#if (USE_COPY_FILE_RANGE)
+        if (use_cfr)
+        {
+            upx_int64_t o = ipos + done;
+            l = (long) ::syscall(__NR_copy_file_range, ifd, &o, ofd, (void *) NULL, n, 0u);
+            if (l < 0 && errno != EINTR)
+            {
+                use_cfr = false;    // ENOSYS, EXDEV, EINVAL for a pipe, ...
+                continue;
+            }
+        }
+        else
+#endif
+        {
+            off_t o = ipos + done;
+            l = (long) ::sendfile(ofd, ifd, &o, n);
+            if (l < 0 && errno != EINTR)
+                break;
+        }
+        if (l == 0)
+            break;
+        if (l > 0)
+            done += l;
+    }
+    UNUSED(use_cfr);
+    // both descriptors have moved - keep our positions in sync
+    f->seek(pos + done, SEEK_SET);
+    bytes_written += done;
+    return done;
+#else
+    UNUSED(f); UNUSED(len);
+    return 0;
+#endif
+}
+
+
+int OutputFile::getFd()
+{
+    flush();
+    return _fd;
+}
+
 off_t OutputFile::st_size() const
 {
     if (opt->to_stdout) {  // might be a pipe ==> .st_size is invalid
@@ -382,6 +711,8 @@ off_t OutputFile::st_size() const
     my_st.st_size = 0;
     if (::fstat(_fd, &my_st) != 0)
         throwIOException(_name, errno);
+    if (wb_len > 0 && my_st.st_size < wb_pos + wb_len)
+        return wb_pos + wb_len;
     return my_st.st_size;
 }
 
@@ -422,9 +753,35 @@ off_t OutputFile::seek(upx_int64_t off64, int whence)
         _length = bytes_written;  // necessary
     } break;
     }
+    if (wb_len > 0)
+    {
+        // same target as FileBase::seek()
+        off_t target = -1;
+        if (whence == SEEK_SET && off >= 0)
+            target = off + _offset;
+        else if (whence == SEEK_END && off <= 0)
+            target = off + _offset + _length;
+        else if (whence == SEEK_CUR)
+            target = w_pos + off;
+        if (target >= wb_pos && target <= wb_pos + wb_len)
+        {
+            w_pos = target; // inside the pending data - no need to flush
+            // FileBase::seek() returns the relative offset for SEEK_CUR
+            return (whence == SEEK_CUR ? off : target) - _offset;
+        }
+        flush();
+    }
     return super::seek(off,whence);
 }
 
+off_t OutputFile::tell() const
+{
+    // the descriptor is still at wb_pos while data is pending
+    if (wb_len > 0 && wb_seekable)
+        return w_pos - _offset;
+    return super::tell();
+}
+
 // WARNING: fsync() does not exist in some Windows environments.
 // This trick works only on UNIX-like systems.
 //int OutputFile::read(void *buf, int len)
@@ -438,6 +795,7 @@ off_t OutputFile::seek(upx_int64_t off64, int whence)
 
 void OutputFile::set_extent(off_t offset, off_t length)
 {
+    flush();
     super::set_extent(offset, length);
     bytes_written = 0;
     if (0==offset && (off_t)~0u==length) {
@@ -449,6 +807,7 @@ void OutputFile::set_extent(off_t offset, off_t length)
 
 off_t OutputFile::unset_extent()
 {
+    flush();
     off_t l = ::lseek(_fd, 0, SEEK_END);
     if (l < 0)
         throwIOException("lseek error", errno);
@@ -471,14 +830,142 @@ void OutputFile::dump(const char *name, const void *buf, int len, int flags)
 
 
 /*************************************************************************
-//
+// MemoryInputFile
 **************************************************************************/
 
-#if 0
+MemoryInputFile::MemoryInputFile() :
+    b(NULL), b_size(0), b_pos(0)
+{
+}
+
+
+MemoryInputFile::~MemoryInputFile()
+{
+    b = NULL;
+}
+
+
+void MemoryInputFile::open(const void *buf, unsigned size, const char *name)
+{
+    close();
+    if (buf == NULL || !mem_size_valid_bytes(size))
+        throwIOException("bad open");
+    b = (const upx_byte *) buf;
+    b_size = size;
+    b_pos = 0;
+    _name = name;
+    _length = size;
+    _length_orig = size;
+    // the packers look at these
+    st.st_mode = S_IFREG | 0755;
+    st.st_size = size;
+}
+
+
+bool MemoryInputFile::close()
+{
+    b = NULL;
+    b_size = 0;
+    b_pos = 0;
+    _name = NULL;
+    _offset = 0;
+    _length = 0;
+    return true;
+}
+
+
+int MemoryInputFile::read(void *buf, int len)
+{
+    if (!isOpen() || len < 0)
+        throwIOException("bad read");
+    mem_size_assert(1, len); // sanity check
+    unsigned l = b_pos < b_size ? b_size - b_pos : 0;
+    if (l > (unsigned) len)
+        l = len;
+    memcpy(buf, b + b_pos, l);
+    b_pos += l;
+    return (int) l;
+}
+
+int MemoryInputFile::readx(void *buf, int len)
+{
+    int l = this->read(buf, len);
+    if (l != len)
+        throwEOFException();
+    return l;
+}
+
+
+off_t MemoryInputFile::seek(upx_int64_t off64, int whence)
+{
+    mem_size_assert(1, off64 >= 0 ? off64 : -off64); // sanity check
+    off_t off = ACC_ICONV(off_t, off64);
+    if (!isOpen())
+        throwIOException("bad seek 1");
+    if (whence == SEEK_SET) {
+        if (off < 0)
+            throwIOException("bad seek 2");
+        off += _offset;
+    }
+    else if (whence == SEEK_END) {
+        if (off > 0)
+            throwIOException("bad seek 3");
+        off += _offset + _length;
+    }
+    else if (whence == SEEK_CUR)
+        off += b_pos;
+    if (off < 0 || !mem_size_valid_bytes(off))
+        throwIOException("seek error", EINVAL);
+    off_t pos = off - _offset;
+    if (_length < pos)
+        throwIOException("bad seek 4");
+    b_pos = (unsigned) off;
+    return pos;
+}
+
+
+off_t MemoryInputFile::tell() const
+{
+    if (!isOpen())
+        throwIOException("bad tell");
+    return b_pos - _offset;
+}
+
+
+/*************************************************************************
+// MemoryOutputFile
+**************************************************************************/
 
 MemoryOutputFile::MemoryOutputFile() :
-    b(NULL), b_size(0), b_pos(0), bytes_written(0)
+    b(NULL), b_size(0), b_len(0), b_pos(0), is_open(false)
+{
+}
+
+
+MemoryOutputFile::~MemoryOutputFile()
+{
+    free(b);
+    b = NULL;
+}
+
+
+void MemoryOutputFile::open(const char *name)
+{
+    close();
+    b_len = 0;
+    b_pos = 0;
+    _name = name;
+    bytes_written = 0;
+    is_open = true;
+}
+
+
+bool MemoryOutputFile::close()
 {
+    is_open = false;
+    _offset = 0;
+    _length = 0;
+    return true;
 }
 
 
@@ -486,16 +973,99 @@ void MemoryOutputFile::write(const void *buf, int len)
 {
     if (!isOpen() || len < 0)
         throwIOException("bad write");
-    if (len == 0)
-        return;
-    if (b_pos + len > b_size)
-        throwIOException("write error",ENOSPC);
+    mem_size_assert(1, len); // sanity check
+    mem_size_assert(1, b_pos + (upx_uint64_t) len);
+    unsigned end = b_pos + len;
+    if (end > b_size)
+    {
+        unsigned n = b_size ? b_size : 64 * 1024;
+        while (n < end)
+            n = mem_size_valid_bytes((upx_uint64_t) n * 2) ? n * 2 : end;
+        upx_byte *p = (upx_byte *) realloc(b, n);
+        if (p == NULL)
+            throwOutOfMemoryException();
+        b = p;
+        b_size = n;
+    }
+    if (b_pos > b_len)                  // a seek past the end leaves a hole
+        memset(b + b_len, 0, b_pos - b_len);
     memcpy(b + b_pos, buf, len);
-    b_pos += len;
+    b_pos = end;
+    if (b_len < end)
+        b_len = end;
     bytes_written += len;
 }
 
 
-#endif /* if 0 */
+off_t MemoryOutputFile::st_size() const
+{
+    if (opt->to_stdout)
+        return bytes_written;
+    return b_len;
+}
+
+
+off_t MemoryOutputFile::seek(upx_int64_t off64, int whence)
+{
+    mem_size_assert(1, off64 >= 0 ? off64 : -off64); // sanity check
+    off_t off = ACC_ICONV(off_t, off64);
+    assert(!opt->to_stdout);
+    if (!isOpen())
+        throwIOException("bad seek 1");
+    // same bookkeeping as OutputFile::seek()
+    switch (whence) {
+    case SEEK_SET: {
+        if (bytes_written < off) {
+            bytes_written = off;
+        }
+        _length = bytes_written;
+        if (off < 0)
+            throwIOException("bad seek 2");
+        off += _offset;
+    } break;
+    case SEEK_END: {
+        _length = bytes_written;
+        if (off > 0)
+            throwIOException("bad seek 3");
+        off += _offset + _length;
+    } break;
+    case SEEK_CUR: {
+        off += b_pos;
+    } break;
+    }
+    if (off < 0 || !mem_size_valid_bytes(off))
+        throwIOException("seek error", EINVAL);
+    b_pos = (unsigned) off;
+    return off - _offset;
+}
+
+
+off_t MemoryOutputFile::tell() const
+{
+    if (!isOpen())
+        throwIOException("bad tell");
+    return b_pos - _offset;
+}
+
+
+void MemoryOutputFile::set_extent(off_t offset, off_t length)
+{
+    FileBase::set_extent(offset, length);
+    bytes_written = 0;
+    if (0==offset && (off_t)~0u==length) {
+        st.st_size = b_len;
+        _length = b_len - offset;
+    }
+}
+
+
+off_t MemoryOutputFile::unset_extent()
+{
+    b_pos = b_len;
+    _offset = 0;
+    _length = b_len;
+    bytes_written = _length;
+    return _length;
+}
 
 /* vim:set ts=4 sw=4 et: */
@@ -109,8 +109,24 @@ public:
     virtual off_t seek(upx_int64_t off, int whence);
     virtual off_t tell() const;
     virtual off_t st_size_orig() const;
+    virtual bool close();
+
+    // Map the whole file read-only. After that read() and seek() do not
+    // need any system calls.
+    virtual bool map();
+    bool isMapped() const { return _map != NULL; }
+    // like readx(), but if the file is mapped then the empty buf becomes
+    // a copy-on-write view of the file instead of a copy
+    virtual int readView(MemBuffer &buf, int len);
+    // hides FileBase::getFd() - positions the descriptor if mapped
+    int getFd() const;
+
 protected:
     off_t _length_orig;
+    upx_byte *_map;
+    off_t _map_size;
+    off_t _map_pos;             // absolute, i.e. not relative to the extent
+    void unmap();
 };
 
 
@@ -140,47 +156,97 @@ public:
 
     off_t getBytesWritten() const { return bytes_written; }
     virtual off_t st_size() const;  // { return _length; }
+    virtual bool close();
 
     // FIXME - these won't work when using the '--stdout' option
     virtual off_t seek(upx_int64_t off, int whence);
+    virtual off_t tell() const;     // includes the pending data
     virtual void rewrite(const void *buf, int len);
 
+    // write out all buffered data
+    virtual void flush();
+    // let the kernel copy up to len bytes from the current position of
+    // f; returns the number of bytes copied, which may be 0
+    virtual off_t copyFrom(InputFile *f, off_t len);
+    // hides FileBase::getFd() - flushes first
+    int getFd();
+
     // util
     static void dump(const char *name, const void *buf, int len, int flags=-1);
 
 protected:
     off_t bytes_written;
+
+    // Small writes are gathered in wb, and seeking back into the
+    // pending data (e.g. to patch a header) just moves w_pos.
+    upx_byte *wb;
+    unsigned wb_len;            // pending bytes
+    unsigned wb_cap;            // wb_pos + wb_cap is aligned
+    off_t wb_pos;               // file offset of wb[0]
+    off_t w_pos;                // logical file offset while wb_len > 0
+    bool wb_seekable;
+    void startBuffer(off_t pos);
+    void flushWith(const void *buf, unsigned len);
 };
 
 
 /*************************************************************************
-//
+// in-memory files for libupx.cpp; they have no file descriptor
 **************************************************************************/
 
-#if 0 /* NOT USED */
-class MemoryOutputFile : public FileBase
+class MemoryInputFile : public InputFile
 {
-    typedef FileBase super;
+    typedef InputFile super;
 public:
-    MemoryOutputFile();
-    virtual ~MemoryOutputFile() { b = NULL; }
+    MemoryInputFile();
+    virtual ~MemoryInputFile();
 
-    virtual bool close() { b = NULL; return true; }
+    // the buffer is not copied and must stay valid
+    virtual void open(const void *buf, unsigned size, const char *name);
+    virtual bool close();
     virtual bool isOpen() const { return b != NULL; }
-    virtual void open(void *buf, unsigned size)
-        { b = (upx_bytep) buf; b_size = size; }
-
-    virtual void write(const void *buf, int len);
 
-    off_t getBytesWritten() const { return bytes_written; }
+    virtual int read(void *buf, int len);
+    virtual int readx(void *buf, int len);
+    virtual off_t seek(upx_int64_t off, int whence);
+    virtual off_t tell() const;
 
 protected:
-    upx_bytep b;
+    const upx_byte *b;
     unsigned b_size;
     unsigned b_pos;
-    off_t bytes_written;
 };
-#endif /* if 0 */
+
+
+class MemoryOutputFile : public OutputFile
+{
+    typedef OutputFile super;
+public:
+    MemoryOutputFile();
+    virtual ~MemoryOutputFile();
+
+    virtual void open(const char *name);
+    virtual bool close();
+    virtual bool isOpen() const { return is_open; }
+
+    virtual void write(const void *buf, int len);
+    virtual void set_extent(off_t offset, off_t length);
+    virtual off_t unset_extent();  // returns actual length
+    virtual off_t st_size() const;
+    virtual off_t seek(upx_int64_t off, int whence);
+    virtual off_t tell() const;
+
+    // the contents, also valid after close()
+    const upx_byte *getBuffer() const { return b; }
+    unsigned getLength() const { return b_len; }
+
+protected:
+    upx_byte *b;
+    unsigned b_size;    // allocated
+    unsigned b_len;     // file size
+    unsigned b_pos;     // file position
+    bool is_open;
+};
 
 
 #endif /* already included */
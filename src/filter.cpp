@@ -49,25 +49,28 @@ void initFilter(Filter *f, upx_byte *buf, unsigned buf_len)
 // get a FilterEntry
 **************************************************************************/
 
-const FilterImp::FilterEntry *FilterImp::getFilter(int id)
+bool FilterImp::initFilterMap(unsigned char *filter_map)
 {
-    static bool done = false;
-    static unsigned char filter_map[256];
-
-    if (!done)
+    assert(n_filters <= 254);       // as 0xff means "empty slot"
+    memset(filter_map, 0xff, 256);
+    for (int i = 0; i < n_filters; i++)
     {
-        // init the filter_map[]
-        assert(n_filters <= 254);       // as 0xff means "empty slot"
-        memset(filter_map, 0xff, sizeof(filter_map));
-        for (int i = 0; i < n_filters; i++)
-        {
-            int filter_id = filters[i].id;
-            assert(filter_id >= 0 && filter_id <= 255);
-            assert(filter_map[filter_id] == 0xff);
-            filter_map[filter_id] = (unsigned char) i;
-        }
-        done = true;
+        int filter_id = filters[i].id;
+        assert(filter_id >= 0 && filter_id <= 255);
+        assert(filter_map[filter_id] == 0xff);
+        filter_map[filter_id] = (unsigned char) i;
     }
+    return true;
+}
+
+
+const FilterImp::FilterEntry *FilterImp::getFilter(int id)
+{
+    static unsigned char filter_map[256];
+    // one-time init of the filter_map[]; guarded by the compiler,
+    // as filters may get used on multiple threads
+    static const bool done = initFilterMap(filter_map);
+    UNUSED(done);
 
     if (id < 0 || id > 255)
         return NULL;
@@ -119,13 +122,23 @@ void Filter::init(int id_, unsigned addvalue_)
 
 bool Filter::filter(upx_byte *buf_, unsigned buf_len_)
 {
-    initFilter(this, buf_, buf_len_);
+    return filter(buf_, buf_len_, buf_);
+}
+
+
+bool Filter::filter(const upx_byte *src, unsigned buf_len_, upx_byte *dst)
+{
+    initFilter(this, dst, buf_len_);
 
     const FilterImp::FilterEntry * const fe = FilterImp::getFilter(id);
     if (fe == NULL)
         throwInternalError("filter-1");
     if (fe->id == 0)
+    {
+        if (src != dst)
+            memcpy(dst, src, buf_len);
         return true;
+    }
     if (buf_len < fe->min_buf_len)
         return false;
     if (fe->max_buf_len && buf_len > fe->max_buf_len)
@@ -135,12 +148,22 @@ bool Filter::filter(upx_byte *buf_, unsigned buf_len_)
 
     // save checksum
     this->adler = 0;
-    if (clevel != 1)
+    if (src == dst && clevel != 1)
         this->adler = upx_adler32(this->buf, this->buf_len);
 
     //printf("filter: %02x %p %d\n", this->id, this->buf, this->buf_len);
     //OutputFile::dump("filter.dat", buf, buf_len);
-    int r = (*fe->do_filter)(this);
+    int r;
+    if (src == dst)
+        r = (*fe->do_filter)(this);
+    else if (fe->do_filter_copy)
+        r = (*fe->do_filter_copy)(this, src);
+    else
+    {
+        // no single-pass version of this filter
+        memcpy(dst, src, buf_len);
+        r = (*fe->do_filter)(this);
+    }
     //printf("filter: %02x %d\n", fe->id, r);
     if (r > 0)
         throwFilterException();
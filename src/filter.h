@@ -57,6 +57,10 @@ public:
     void init(int id=0, unsigned addvalue=0);
 
     bool filter(upx_byte *buf, unsigned buf_len);
+    // filter a copy of src into dst; src is left unmodified, so there
+    // is nothing to restore and no checksum is saved. The calltrick
+    // filters do this in a single pass, the others copy first.
+    bool filter(const upx_byte *src, unsigned buf_len, upx_byte *dst);
     void unfilter(upx_byte *buf, unsigned buf_len, bool verify_checksum=false);
     void verifyUnfilter();
     bool scan(const upx_byte *buf, unsigned buf_len);
@@ -117,10 +121,14 @@ private:
         int (*do_filter)(Filter *);         // filter a buffer
         int (*do_unfilter)(Filter *);       // unfilter a buffer
         int (*do_scan)(Filter *);           // scan a buffer
+        // optional: filter src[] into buf in a single pass (same as a
+        // memcpy() followed by do_filter); src[] must not overlap buf
+        int (*do_filter_copy)(Filter *, const upx_byte *src);
     };
 
     // get a specific filter entry
     static const FilterEntry *getFilter(int id);
+    static bool initFilterMap(unsigned char *filter_map);
 
 private:
     // strictly private filter database
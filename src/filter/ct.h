@@ -28,360 +28,130 @@
 
 
 /*************************************************************************
-// 16-bit calltrick ("naive")
+// 16- and 32-bit calltrick ("naive")
+//
+// CallTrick<Cond, From, To>::filter() rewrites the operand of every
+// instruction that Cond accepts from a relative From value into an
+// absolute To value, unfilter() converts it back and scan() only counts.
+// filter_copy() does the same as filter(), but reads a separate source
+// buffer and copies the bytes in between, all in one pass.
 **************************************************************************/
 
-#define CT16(f, cond, addvalue, get, set) \
-    upx_byte *b = f->buf; \
-    upx_byte *b_end = b + f->buf_len - 3; \
-    do { \
-        if (cond) \
-        { \
-            b += 1; \
-            unsigned a = (unsigned) (b - f->buf); \
-            f->lastcall = a; \
-            set(b, get(b) + (addvalue)); \
-            f->calls++; \
-            b += 2 - 1; \
-        } \
-    } while (++b < b_end); \
-    if (f->lastcall) f->lastcall += 2; \
+struct CtLE16
+{
+    enum { size = 2 };
+    static unsigned get(const upx_byte *p) { return get_le16(p); }
+    static void set(upx_byte *p, unsigned v) { set_le16(p, v); }
+};
+
+struct CtBE16
+{
+    enum { size = 2 };
+    static unsigned get(const upx_byte *p) { return get_be16(p); }
+    static void set(upx_byte *p, unsigned v) { set_be16(p, v); }
+};
+
+struct CtLE32
+{
+    enum { size = 4 };
+    static unsigned get(const upx_byte *p) { return get_le32(p); }
+    static void set(upx_byte *p, unsigned v) { set_le32(p, v); }
+};
+
+struct CtBE32
+{
+    enum { size = 4 };
+    static unsigned get(const upx_byte *p) { return get_be32(p); }
+    static void set(upx_byte *p, unsigned v) { set_be32(p, v); }
+};
+
+
+enum { CT_SCAN, CT_FILTER, CT_UNFILTER };
+
+template <class Cond, class Get, class Set, int mode>
+static int ct_run(Filter *f)
+{
+    const unsigned n = Get::size;
+    upx_byte *b = f->buf;
+    upx_byte *b_end = b + f->buf_len - (n + 1);
+    do {
+        b = scan_calls_ptr(b, b_end, Cond::kind);
+        if (Cond::test(b, 0, 0))
+        {
+            b += 1;
+            unsigned a = (unsigned) (b - f->buf);
+            f->lastcall = a;
+            if (mode == CT_FILTER)
+                Set::set(b, Get::get(b) + a + f->addvalue);
+            else if (mode == CT_UNFILTER)
+                Set::set(b, Get::get(b) - a - f->addvalue);
+            f->calls++;
+            b += n - 1;
+        }
+    } while (++b < b_end);
+    if (f->lastcall) f->lastcall += n;
     return 0;
-
-
-
-// filter: e8, e9, e8e9
-static int f_ct16_e8(Filter *f)
-{
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_le16, set_le16)
-}
-
-static int f_ct16_e9(Filter *f)
-{
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_le16, set_le16)
-}
-
-static int f_ct16_e8e9(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le16, set_le16)
-}
-
-
-// unfilter: e8, e9, e8e9
-static int u_ct16_e8(Filter *f)
-{
-    CT16(f, (*b == 0xe8), 0 - a - f->addvalue, get_le16, set_le16)
-}
-
-static int u_ct16_e9(Filter *f)
-{
-    CT16(f, (*b == 0xe9), 0 - a - f->addvalue, get_le16, set_le16)
-}
-
-static int u_ct16_e8e9(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_le16, set_le16)
-}
-
-
-// scan: e8, e9, e8e9
-static int s_ct16_e8(Filter *f)
-{
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_le16, set_dummy)
-}
-
-static int s_ct16_e9(Filter *f)
-{
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_le16, set_dummy)
-}
-
-static int s_ct16_e8e9(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le16, set_dummy)
-}
-
-
-// filter: e8, e9, e8e9 with bswap le->be
-static int f_ct16_e8_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_le16, set_be16)
-}
-
-static int f_ct16_e9_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_le16, set_be16)
-}
-
-static int f_ct16_e8e9_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le16, set_be16)
-}
-
-
-// unfilter: e8, e9, e8e9 with bswap le->be
-static int u_ct16_e8_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe8), 0 - a - f->addvalue, get_be16, set_le16)
-}
-
-static int u_ct16_e9_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe9), 0 - a - f->addvalue, get_be16, set_le16)
-}
-
-static int u_ct16_e8e9_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_be16, set_le16)
-}
-
-
-// scan: e8, e9, e8e9 with bswap le->be
-static int s_ct16_e8_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_be16, set_dummy)
-}
-
-static int s_ct16_e9_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_be16, set_dummy)
 }
 
-static int s_ct16_e8e9_bswap_le(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_be16, set_dummy)
-}
-
-
-// filter: e8, e9, e8e9 with bswap be->le
-static int f_ct16_e8_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_be16, set_le16)
-}
-
-static int f_ct16_e9_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_be16, set_le16)
-}
-
-static int f_ct16_e8e9_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_be16, set_le16)
-}
-
-
-// unfilter: e8, e9, e8e9 with bswap be->le
-static int u_ct16_e8_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe8), 0 - a - f->addvalue, get_le16, set_be16)
-}
-
-static int u_ct16_e9_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe9), 0 - a - f->addvalue, get_le16, set_be16)
-}
-
-static int u_ct16_e8e9_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_le16, set_be16)
-}
-
-
-// scan: e8, e9, e8e9 with bswap be->le
-static int s_ct16_e8_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_le16, set_dummy)
-}
-
-static int s_ct16_e9_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_le16, set_dummy)
-}
-
-static int s_ct16_e8e9_bswap_be(Filter *f)
-{
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le16, set_dummy)
-}
-
-
-#undef CT16
-
-
-/*************************************************************************
-// 32-bit calltrick ("naive")
-**************************************************************************/
-
-#define CT32(f, cond, addvalue, get, set) \
-    upx_byte *b = f->buf; \
-    upx_byte *b_end = b + f->buf_len - 5; \
-    do { \
-        if (cond) \
-        { \
-            b += 1; \
-            unsigned a = (unsigned) (b - f->buf); \
-            f->lastcall = a; \
-            set(b, get(b) + (addvalue)); \
-            f->calls++; \
-            b += 4 - 1; \
-        } \
-    } while (++b < b_end); \
-    if (f->lastcall) f->lastcall += 4; \
+// same as ct_run<CT_FILTER>() on a copy of src[]
+template <class Cond, class Get, class Set>
+static int ct_copy(Filter *f, const upx_byte *src)
+{
+    const unsigned n = Get::size;
+    upx_byte *const d = f->buf;
+    const upx_byte *b = src;
+    const upx_byte *b_end = b + f->buf_len - (n + 1);
+    const upx_byte *done = src;     // src[0 .. done) is already in d[]
+    do {
+        b = scan_calls_ptr(b, b_end, Cond::kind);
+        if (Cond::test(b, 0, 0))
+        {
+            b += 1;
+            unsigned a = (unsigned) (b - src);
+            f->lastcall = a;
+            memcpy(d + (done - src), done, b - done);
+            Set::set(d + a, Get::get(b) + a + f->addvalue);
+            f->calls++;
+            done = b + n;
+            b += n - 1;
+        }
+    } while (++b < b_end);
+    memcpy(d + (done - src), done, src + f->buf_len - done);
+    if (f->lastcall) f->lastcall += n;
     return 0;
-
-
-// filter: e8, e9, e8e9
-static int f_ct32_e8(Filter *f)
-{
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_le32, set_le32)
-}
-
-static int f_ct32_e9(Filter *f)
-{
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_le32, set_le32)
-}
-
-static int f_ct32_e8e9(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le32, set_le32)
-}
-
-
-// unfilter: e8, e9, e8e9
-static int u_ct32_e8(Filter *f)
-{
-    CT32(f, (*b == 0xe8), 0 - a - f->addvalue, get_le32, set_le32)
-}
-
-static int u_ct32_e9(Filter *f)
-{
-    CT32(f, (*b == 0xe9), 0 - a - f->addvalue, get_le32, set_le32)
-}
-
-static int u_ct32_e8e9(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_le32, set_le32)
-}
-
-
-// scan: e8, e9, e8e9
-static int s_ct32_e8(Filter *f)
-{
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_le32, set_dummy)
-}
-
-static int s_ct32_e9(Filter *f)
-{
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_le32, set_dummy)
-}
-
-static int s_ct32_e8e9(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le32, set_dummy)
-}
-
-
-// filter: e8, e9, e8e9 with bswap le->be
-static int f_ct32_e8_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_le32, set_be32)
-}
-
-static int f_ct32_e9_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_le32, set_be32)
-}
-
-static int f_ct32_e8e9_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le32, set_be32)
-}
-
-
-// unfilter: e8, e9, e8e9 with bswap le->be
-static int u_ct32_e8_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe8), 0 - a - f->addvalue, get_be32, set_le32)
-}
-
-static int u_ct32_e9_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe9), 0 - a - f->addvalue, get_be32, set_le32)
-}
-
-static int u_ct32_e8e9_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_be32, set_le32)
-}
-
-
-// scan: e8, e9, e8e9 with bswap le->be
-static int s_ct32_e8_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_be32, set_dummy)
-}
-
-static int s_ct32_e9_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_be32, set_dummy)
-}
-
-static int s_ct32_e8e9_bswap_le(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_be32, set_dummy)
-}
-
-
-// filter: e8, e9, e8e9 with bswap be->le
-static int f_ct32_e8_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_be32, set_le32)
-}
-
-static int f_ct32_e9_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_be32, set_le32)
-}
-
-static int f_ct32_e8e9_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_be32, set_le32)
-}
-
-
-// unfilter: e8, e9, e8e9 with bswap be->le
-static int u_ct32_e8_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe8), 0 - a - f->addvalue, get_le32, set_be32)
-}
-
-static int u_ct32_e9_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe9), 0 - a - f->addvalue, get_le32, set_be32)
-}
-
-static int u_ct32_e8e9_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_le32, set_be32)
-}
-
-
-// scan: e8, e9, e8e9 with bswap be->le
-static int s_ct32_e8_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_le32, set_dummy)
-}
-
-static int s_ct32_e9_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_le32, set_dummy)
-}
-
-static int s_ct32_e8e9_bswap_be(Filter *f)
-{
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le32, set_dummy)
 }
 
+template <class Cond, class From, class To>
+struct CallTrick
+{
+    static int filter(Filter *f)   { return ct_run<Cond, From, To, CT_FILTER>(f); }
+    static int unfilter(Filter *f) { return ct_run<Cond, To, From, CT_UNFILTER>(f); }
+    static int scan(Filter *f)     { return ct_run<Cond, From, To, CT_SCAN>(f); }
+    static int filter_copy(Filter *f, const upx_byte *src)
+        { return ct_copy<Cond, From, To>(f, src); }
+};
+
+
+typedef CallTrick<CondE8,   CtLE16, CtLE16> ct16_e8;
+typedef CallTrick<CondE9,   CtLE16, CtLE16> ct16_e9;
+typedef CallTrick<CondE8E9, CtLE16, CtLE16> ct16_e8e9;
+typedef CallTrick<CondE8,   CtLE16, CtBE16> ct16_e8_bswap_le;
+typedef CallTrick<CondE9,   CtLE16, CtBE16> ct16_e9_bswap_le;
+typedef CallTrick<CondE8E9, CtLE16, CtBE16> ct16_e8e9_bswap_le;
+typedef CallTrick<CondE8,   CtBE16, CtLE16> ct16_e8_bswap_be;
+typedef CallTrick<CondE9,   CtBE16, CtLE16> ct16_e9_bswap_be;
+typedef CallTrick<CondE8E9, CtBE16, CtLE16> ct16_e8e9_bswap_be;
+
+typedef CallTrick<CondE8,   CtLE32, CtLE32> ct32_e8;
+typedef CallTrick<CondE9,   CtLE32, CtLE32> ct32_e9;
+typedef CallTrick<CondE8E9, CtLE32, CtLE32> ct32_e8e9;
+typedef CallTrick<CondE8,   CtLE32, CtBE32> ct32_e8_bswap_le;
+typedef CallTrick<CondE9,   CtLE32, CtBE32> ct32_e9_bswap_le;
+typedef CallTrick<CondE8E9, CtLE32, CtBE32> ct32_e8e9_bswap_le;
+typedef CallTrick<CondE8,   CtBE32, CtLE32> ct32_e8_bswap_be;
+typedef CallTrick<CondE9,   CtBE32, CtLE32> ct32_e9_bswap_be;
+typedef CallTrick<CondE8E9, CtBE32, CtLE32> ct32_e8e9_bswap_be;
 
-#undef CT32
 
 /*************************************************************************
 // 24-bit ARM calltrick ("naive")
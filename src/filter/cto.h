@@ -4,6 +4,7 @@
 
    Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
    Copyright (C) 1996-2020 Laszlo Molnar
+   Copyright (C) 2000-2020 John F. Reiser
    All Rights Reserved.
 
    UPX and the UCL library are free software; you can redistribute them
@@ -23,23 +24,24 @@
 
    Markus F.X.J. Oberhumer              Laszlo Molnar
    <markus@oberhumer.com>               <ezerotven+github@gmail.com>
- */
 
+   John F. Reiser
+   <jreiser@users.sourceforge.net>
+ */
 
 
 /*************************************************************************
-// filter / scan
+// cto calltrick
+//
+// CallTrickCto<Cond> converts the relative 32-bit operand of each call
+// that Cond accepts into an absolute big-endian address whose high byte
+// is the cto8 mark. This backs the cto, ctoj and ctok filter ids.
 **************************************************************************/
 
-static int F(Filter *f)
+template <class Cond, bool do_filter>
+static int cto_run(Filter *f)
 {
-#ifdef U
-    // filter
     upx_byte *b = f->buf;
-#else
-    // scan
-    const upx_byte *b = f->buf;
-#endif
     const unsigned addvalue = f->addvalue;
     const unsigned size = f->buf_len;
 
@@ -57,9 +59,10 @@ static int F(Filter *f)
         // So, a call to a destination that is outside the buffer
         // must not conflict with the mark.
         // Note that unsigned comparison checks both edges of buffer.
-        for (ic = 0; ic < size - 5; ic++)
+        for (ic = scan_calls(b,0,size - 5,Cond::kind); ic < size - 5;
+             ic = scan_calls(b,ic + 1,size - 5,Cond::kind))
         {
-            if (!COND(b,ic))
+            if (!Cond::test(b,ic,lastcall))
                 continue;
             jc = get_le32(b+ic+1)+ic+1;
             if (jc < size)
@@ -75,34 +78,30 @@ static int F(Filter *f)
             return -1;
     }
     const unsigned char cto8 = f->cto;
-#ifdef U
     const unsigned cto = (unsigned)f->cto << 24;
-#endif
 
-    for (ic = 0; ic < size - 5; ic++)
+    for (ic = scan_calls(b,0,size - 5,Cond::kind); ic < size - 5;
+         ic = scan_calls(b,ic + 1,size - 5,Cond::kind))
     {
-        if (!COND(b,ic))
+        if (!Cond::test(b,ic,lastcall))
             continue;
         jc = get_le32(b+ic+1)+ic+1;
         // try to detect 'real' calls only
         if (jc < size)
         {
             assert(jc + addvalue < (1u << 24)); // hi 8 bits won't be cto8
-#ifdef U
-            set_be32(b+ic+1,jc+addvalue+cto);
-#endif
+            if (do_filter)
+                set_be32(b+ic+1,jc+addvalue+cto);
             if (ic - lastnoncall < 5)
             {
                 // check the last 4 bytes before this call
                 for (kc = 4; kc; kc--)
-                    if (COND(b,ic-kc) && b[ic-kc+1] == cto8)
+                    if (Cond::test(b,ic-kc,lastcall) && b[ic-kc+1] == cto8)
                         break;
                 if (kc)
                 {
-#ifdef U
-                    // restore original
-                    set_le32(b+ic+1,jc-ic-1);
-#endif
+                    if (do_filter) // restore original
+                        set_le32(b+ic+1,jc-ic-1);
                     if (b[ic+1] == cto8)
                         return 1;           // fail - buffer not restored
                     lastnoncall = ic;
@@ -133,22 +132,20 @@ static int F(Filter *f)
 }
 
 
-/*************************************************************************
-// unfilter
-**************************************************************************/
-
-#ifdef U
-static int U(Filter *f)
+template <class Cond>
+static int cto_unfilter(Filter *f)
 {
     upx_byte *b = f->buf;
     const unsigned size5 = f->buf_len - 5;
     const unsigned addvalue = f->addvalue;
     const unsigned cto = (unsigned)f->cto << 24;
+    unsigned lastcall = 0;
 
     unsigned ic, jc;
 
-    for (ic = 0; ic < size5; ic++)
-        if (COND(b,ic))
+    for (ic = scan_calls(b,0,size5,Cond::kind); ic < size5;
+         ic = scan_calls(b,ic + 1,size5,Cond::kind))
+        if (Cond::test(b,ic,lastcall))
         {
             jc = get_be32(b+ic+1);
             if (b[ic+1] == f->cto)
@@ -156,17 +153,34 @@ static int U(Filter *f)
                 set_le32(b+ic+1,jc-ic-1-addvalue-cto);
                 f->calls++;
                 ic += 4;
-                f->lastcall = ic+1;
+                f->lastcall = lastcall = ic+1;
             }
             else
                 f->noncalls++;
         }
     return 0;
 }
-#endif
 
 
-#undef F
-#undef U
+template <class Cond>
+struct CallTrickCto
+{
+    static int filter(Filter *f)   { return cto_run<Cond, true>(f); }
+    static int unfilter(Filter *f) { return cto_unfilter<Cond>(f); }
+    static int scan(Filter *f)     { return cto_run<Cond, false>(f); }
+};
+
+
+typedef CallTrickCto<CondE8>      cto32_e8_bswap_le;
+typedef CallTrickCto<CondE9>      cto32_e9_bswap_le;
+typedef CallTrickCto<CondE8E9>    cto32_e8e9_bswap_le;
+
+// with jmp: the same as cto32_e8e9, but a different id for the stubs
+typedef CallTrickCto<CondE8E9>    ctoj32_e8e9_bswap_le;
+
+// with jmp, and with jcc for ids 0x?9 .. 0x?f
+typedef CallTrickCto<CondE8E9>    ctok32_e8e9_bswap_le;
+typedef CallTrickCto<CondE8E9Jcc> ctok32_e8e9_jcc_bswap_le;
+
 
 /* vim:set ts=4 sw=4 et: */
@@ -0,0 +1,203 @@
+/* scan.h -- find calltrick candidates
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2020 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+/*************************************************************************
+// The x86 calltrick filters only act on a few opcodes, so the bytes
+// in between can be skipped with vector compares.
+//
+// scan_calls(b, ic, end, kind) returns the smallest x in [ic, end)
+// where b[x] is one of the opcode bytes given by kind, or end if there
+// is none. It must find every position where COND() could be true;
+// COND() itself is still evaluated by the filter.
+**************************************************************************/
+
+#define SCAN_E8     1           // call
+#define SCAN_E9     2           // jmp
+#define SCAN_E8E9   3
+#define SCAN_JCC    4           // second byte of 0x0f 0x8x
+
+typedef unsigned (*scan_calls_t)(const upx_byte *, unsigned, unsigned, unsigned);
+
+
+// the reference version
+static unsigned scan_calls_scalar(const upx_byte *b, unsigned ic, unsigned end, unsigned kind)
+{
+    switch (kind)
+    {
+    case SCAN_E8:
+        for ( ; ic < end; ic++)
+            if (b[ic] == 0xe8)
+                return ic;
+        break;
+    case SCAN_E9:
+        for ( ; ic < end; ic++)
+            if (b[ic] == 0xe9)
+                return ic;
+        break;
+    case SCAN_E8E9:
+        for ( ; ic < end; ic++)
+            if ((b[ic] | 1) == 0xe9)
+                return ic;
+        break;
+    default:
+        assert(kind == (SCAN_E8E9 | SCAN_JCC));
+        for ( ; ic < end; ic++)
+            if ((b[ic] | 1) == 0xe9 || (b[ic] & 0xf0) == 0x80)
+                return ic;
+        break;
+    }
+    return end;
+}
+
+
+#if (ACC_ARCH_AMD64 || ACC_ARCH_I386) && (ACC_CC_CLANG || ACC_CC_GNUC >= 0x040900L)
+#include <immintrin.h>
+
+#define SCAN_CALLS_VECTOR(name, attr, vec, width, set1, loadu, cmpeq, and_, or_, movemask) \
+attr static unsigned name(const upx_byte *b, unsigned ic, unsigned end, unsigned kind) \
+{ \
+    const vec v_one = set1(1); \
+    const vec v_e8 = set1((char) 0xe8); \
+    const vec v_e9 = set1((char) 0xe9); \
+    const vec v_f0 = set1((char) 0xf0); \
+    const vec v_80 = set1((char) 0x80); \
+    for ( ; ic < end && end - ic >= width; ic += width) \
+    { \
+        const vec v = loadu((const vec *) (b + ic)); \
+        vec m; \
+        if (kind == SCAN_E8) \
+            m = cmpeq(v, v_e8); \
+        else if (kind == SCAN_E9) \
+            m = cmpeq(v, v_e9); \
+        else \
+            m = cmpeq(or_(v, v_one), v_e9); \
+        if (kind & SCAN_JCC) \
+            m = or_(m, cmpeq(and_(v, v_f0), v_80)); \
+        const unsigned mask = (unsigned) movemask(m); \
+        if (mask) \
+            return ic + __builtin_ctz(mask); \
+    } \
+    return scan_calls_scalar(b, ic, end, kind); \
+}
+
+SCAN_CALLS_VECTOR(scan_calls_sse2, __attribute__((__target__("sse2"))),
+    __m128i, 16, _mm_set1_epi8, _mm_loadu_si128, _mm_cmpeq_epi8,
+    _mm_and_si128, _mm_or_si128, _mm_movemask_epi8)
+SCAN_CALLS_VECTOR(scan_calls_avx2, __attribute__((__target__("avx2"))),
+    __m256i, 32, _mm256_set1_epi8, _mm256_loadu_si256, _mm256_cmpeq_epi8,
+    _mm256_and_si256, _mm256_or_si256, _mm256_movemask_epi8)
+
+#undef SCAN_CALLS_VECTOR
+
+static scan_calls_t scan_calls_select()
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return scan_calls_avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return scan_calls_sse2;
+    return scan_calls_scalar;
+}
+
+#else
+
+static scan_calls_t scan_calls_select()
+{
+    return scan_calls_scalar;
+}
+
+#endif
+
+
+static unsigned scan_calls(const upx_byte *b, unsigned ic, unsigned end, unsigned kind)
+{
+    // select the kernel once by cpu features
+    static const scan_calls_t scan = scan_calls_select();
+    return scan(b, ic, end, kind);
+}
+
+
+// pointer version for the "naive" CT16/CT32 loops: returns the next
+// candidate in [b, b_end), or b_end - 1 (which is no candidate) if there
+// is none; an empty range is returned unchanged
+static const upx_byte *scan_calls_ptr(const upx_byte *b, const upx_byte *b_end, unsigned kind)
+{
+    if (b >= b_end)
+        return b;
+    const unsigned n = (unsigned) (b_end - b);
+    const unsigned x = scan_calls(b, 0, n, kind);
+    return b + (x < n ? x : n - 1);
+}
+
+static upx_byte *scan_calls_ptr(upx_byte *b, const upx_byte *b_end, unsigned kind)
+{
+    return b + (scan_calls_ptr((const upx_byte *) b, b_end, kind) - b);
+}
+
+
+
+/*************************************************************************
+// opcode predicates for the calltrick templates in ct.h and cto.h
+//
+// test(b, x, lastcall) is true if b[x] starts an instruction that the
+// filter should look at; kind is the matching scan_calls() kind.
+**************************************************************************/
+
+struct CondE8
+{
+    enum { kind = SCAN_E8 };
+    static bool test(const upx_byte *b, unsigned x, unsigned)
+        { return b[x] == 0xe8; }
+};
+
+struct CondE9
+{
+    enum { kind = SCAN_E9 };
+    static bool test(const upx_byte *b, unsigned x, unsigned)
+        { return b[x] == 0xe9; }
+};
+
+struct CondE8E9
+{
+    enum { kind = SCAN_E8E9 };
+    static bool test(const upx_byte *b, unsigned x, unsigned)
+        { return b[x] == 0xe8 || b[x] == 0xe9; }
+};
+
+// also the second byte of a "0x0f 0x8Y" jcc, unless it is the byte
+// right after the previous call
+struct CondE8E9Jcc
+{
+    enum { kind = SCAN_E8E9 | SCAN_JCC };
+    static bool test(const upx_byte *b, unsigned x, unsigned lastcall)
+        { return CondE8E9::test(b, x, lastcall) ||
+                 (lastcall != x && 0xf == b[x-1] && 0x80 <= b[x] && b[x] <= 0x8f); }
+};
+
+
+/* vim:set ts=4 sw=4 et: */
@@ -46,6 +46,7 @@ umin(unsigned const a, unsigned const b)
 **************************************************************************/
 
 #include "filter/getcto.h"
+#include "filter/scan.h"
 
 
 /*************************************************************************
@@ -62,62 +63,10 @@ umin(unsigned const a, unsigned const b)
 
 
 /*************************************************************************
-// cto calltrick
+// cto calltrick, also with jmp and optional jcc
 **************************************************************************/
 
-#define COND(b,x)               (b[x] == 0xe8)
-#define F                       f_cto32_e8_bswap_le
-#define U                       u_cto32_e8_bswap_le
 #include "filter/cto.h"
-#define F                       s_cto32_e8_bswap_le
-#include "filter/cto.h"
-#undef COND
-
-#define COND(b,x)               (b[x] == 0xe9)
-#define F                       f_cto32_e9_bswap_le
-#define U                       u_cto32_e9_bswap_le
-#include "filter/cto.h"
-#define F                       s_cto32_e9_bswap_le
-#include "filter/cto.h"
-#undef COND
-
-#define COND(b,x)               (b[x] == 0xe8 || b[x] == 0xe9)
-#define F                       f_cto32_e8e9_bswap_le
-#define U                       u_cto32_e8e9_bswap_le
-#include "filter/cto.h"
-#define F                       s_cto32_e8e9_bswap_le
-#include "filter/cto.h"
-#undef COND
-
-
-/*************************************************************************
-// cto calltrick with jmp
-**************************************************************************/
-
-#define COND(b,x,lastcall) (b[x] == 0xe8 || b[x] == 0xe9)
-#define F                       f_ctoj32_e8e9_bswap_le
-#define U                       u_ctoj32_e8e9_bswap_le
-#include "filter/ctoj.h"
-#define F                       s_ctoj32_e8e9_bswap_le
-#include "filter/ctoj.h"
-#undef COND
-
-
-/*************************************************************************
-// cto calltrick with jmp, optional jcc
-**************************************************************************/
-
-#define COND1(b,x)     (b[x] == 0xe8 || b[x] == 0xe9)
-#define COND2(b,x,lc)  (lc!=(x) && 0xf==b[(x)-1] && 0x80<=b[x] && b[x]<=0x8f)
-#define COND(b,x,lc,id) (COND1(b,x) || ((9<=(0xf&(id))) && COND2(b,x,lc)))
-#define F                       f_ctok32_e8e9_bswap_le
-#define U                       u_ctok32_e8e9_bswap_le
-#include "filter/ctok.h"
-#define F                       s_ctok32_e8e9_bswap_le
-#include "filter/ctok.h"
-#undef COND
-#undef COND2
-#undef COND1
 
 
 /*************************************************************************
@@ -170,95 +119,95 @@ umin(unsigned const a, unsigned const b)
 
 const FilterImp::FilterEntry FilterImp::filters[] = {
     // no filter
-    { 0x00, 0,          0, NULL, NULL, NULL },
+    { 0x00, 0,          0, NULL, NULL, NULL, NULL },
 
     // 16-bit calltrick
-    { 0x01, 4,          0, f_ct16_e8, u_ct16_e8, s_ct16_e8 },
-    { 0x02, 4,          0, f_ct16_e9, u_ct16_e9, s_ct16_e9 },
-    { 0x03, 4,          0, f_ct16_e8e9, u_ct16_e8e9, s_ct16_e8e9 },
-    { 0x04, 4,          0, f_ct16_e8_bswap_le, u_ct16_e8_bswap_le, s_ct16_e8_bswap_le },
-    { 0x05, 4,          0, f_ct16_e9_bswap_le, u_ct16_e9_bswap_le, s_ct16_e9_bswap_le },
-    { 0x06, 4,          0, f_ct16_e8e9_bswap_le, u_ct16_e8e9_bswap_le, s_ct16_e8e9_bswap_le },
-    { 0x07, 4,          0, f_ct16_e8_bswap_be, u_ct16_e8_bswap_be, s_ct16_e8_bswap_be },
-    { 0x08, 4,          0, f_ct16_e9_bswap_be, u_ct16_e9_bswap_be, s_ct16_e9_bswap_be },
-    { 0x09, 4,          0, f_ct16_e8e9_bswap_be, u_ct16_e8e9_bswap_be, s_ct16_e8e9_bswap_be },
+    { 0x01, 4,          0, ct16_e8::filter, ct16_e8::unfilter, ct16_e8::scan, ct16_e8::filter_copy },
+    { 0x02, 4,          0, ct16_e9::filter, ct16_e9::unfilter, ct16_e9::scan, ct16_e9::filter_copy },
+    { 0x03, 4,          0, ct16_e8e9::filter, ct16_e8e9::unfilter, ct16_e8e9::scan, ct16_e8e9::filter_copy },
+    { 0x04, 4,          0, ct16_e8_bswap_le::filter, ct16_e8_bswap_le::unfilter, ct16_e8_bswap_le::scan, ct16_e8_bswap_le::filter_copy },
+    { 0x05, 4,          0, ct16_e9_bswap_le::filter, ct16_e9_bswap_le::unfilter, ct16_e9_bswap_le::scan, ct16_e9_bswap_le::filter_copy },
+    { 0x06, 4,          0, ct16_e8e9_bswap_le::filter, ct16_e8e9_bswap_le::unfilter, ct16_e8e9_bswap_le::scan, ct16_e8e9_bswap_le::filter_copy },
+    { 0x07, 4,          0, ct16_e8_bswap_be::filter, ct16_e8_bswap_be::unfilter, ct16_e8_bswap_be::scan, ct16_e8_bswap_be::filter_copy },
+    { 0x08, 4,          0, ct16_e9_bswap_be::filter, ct16_e9_bswap_be::unfilter, ct16_e9_bswap_be::scan, ct16_e9_bswap_be::filter_copy },
+    { 0x09, 4,          0, ct16_e8e9_bswap_be::filter, ct16_e8e9_bswap_be::unfilter, ct16_e8e9_bswap_be::scan, ct16_e8e9_bswap_be::filter_copy },
 
     // 16-bit swaptrick
-    { 0x0a, 4,          0, f_sw16_e8, u_sw16_e8, s_sw16_e8 },
-    { 0x0b, 4,          0, f_sw16_e9, u_sw16_e9, s_sw16_e9 },
-    { 0x0c, 4,          0, f_sw16_e8e9, u_sw16_e8e9, s_sw16_e8e9 },
+    { 0x0a, 4,          0, f_sw16_e8, u_sw16_e8, s_sw16_e8, NULL },
+    { 0x0b, 4,          0, f_sw16_e9, u_sw16_e9, s_sw16_e9, NULL },
+    { 0x0c, 4,          0, f_sw16_e8e9, u_sw16_e8e9, s_sw16_e8e9, NULL },
 
     // 16-bit call-/swaptrick
-    { 0x0d, 4,          0, f_ctsw16_e8_e9, u_ctsw16_e8_e9, s_ctsw16_e8_e9 },
-    { 0x0e, 4,          0, f_ctsw16_e9_e8, u_ctsw16_e9_e8, s_ctsw16_e9_e8 },
+    { 0x0d, 4,          0, f_ctsw16_e8_e9, u_ctsw16_e8_e9, s_ctsw16_e8_e9, NULL },
+    { 0x0e, 4,          0, f_ctsw16_e9_e8, u_ctsw16_e9_e8, s_ctsw16_e9_e8, NULL },
 
     // 32-bit calltrick
-    { 0x11, 6,          0, f_ct32_e8, u_ct32_e8, s_ct32_e8 },
-    { 0x12, 6,          0, f_ct32_e9, u_ct32_e9, s_ct32_e9 },
-    { 0x13, 6,          0, f_ct32_e8e9, u_ct32_e8e9, s_ct32_e8e9 },
-    { 0x14, 6,          0, f_ct32_e8_bswap_le, u_ct32_e8_bswap_le, s_ct32_e8_bswap_le },
-    { 0x15, 6,          0, f_ct32_e9_bswap_le, u_ct32_e9_bswap_le, s_ct32_e9_bswap_le },
-    { 0x16, 6,          0, f_ct32_e8e9_bswap_le, u_ct32_e8e9_bswap_le, s_ct32_e8e9_bswap_le },
-    { 0x17, 6,          0, f_ct32_e8_bswap_be, u_ct32_e8_bswap_be, s_ct32_e8_bswap_be },
-    { 0x18, 6,          0, f_ct32_e9_bswap_be, u_ct32_e9_bswap_be, s_ct32_e9_bswap_be },
-    { 0x19, 6,          0, f_ct32_e8e9_bswap_be, u_ct32_e8e9_bswap_be, s_ct32_e8e9_bswap_be },
+    { 0x11, 6,          0, ct32_e8::filter, ct32_e8::unfilter, ct32_e8::scan, ct32_e8::filter_copy },
+    { 0x12, 6,          0, ct32_e9::filter, ct32_e9::unfilter, ct32_e9::scan, ct32_e9::filter_copy },
+    { 0x13, 6,          0, ct32_e8e9::filter, ct32_e8e9::unfilter, ct32_e8e9::scan, ct32_e8e9::filter_copy },
+    { 0x14, 6,          0, ct32_e8_bswap_le::filter, ct32_e8_bswap_le::unfilter, ct32_e8_bswap_le::scan, ct32_e8_bswap_le::filter_copy },
+    { 0x15, 6,          0, ct32_e9_bswap_le::filter, ct32_e9_bswap_le::unfilter, ct32_e9_bswap_le::scan, ct32_e9_bswap_le::filter_copy },
+    { 0x16, 6,          0, ct32_e8e9_bswap_le::filter, ct32_e8e9_bswap_le::unfilter, ct32_e8e9_bswap_le::scan, ct32_e8e9_bswap_le::filter_copy },
+    { 0x17, 6,          0, ct32_e8_bswap_be::filter, ct32_e8_bswap_be::unfilter, ct32_e8_bswap_be::scan, ct32_e8_bswap_be::filter_copy },
+    { 0x18, 6,          0, ct32_e9_bswap_be::filter, ct32_e9_bswap_be::unfilter, ct32_e9_bswap_be::scan, ct32_e9_bswap_be::filter_copy },
+    { 0x19, 6,          0, ct32_e8e9_bswap_be::filter, ct32_e8e9_bswap_be::unfilter, ct32_e8e9_bswap_be::scan, ct32_e8e9_bswap_be::filter_copy },
 
     // 32-bit swaptrick
-    { 0x1a, 6,          0, f_sw32_e8, u_sw32_e8, s_sw32_e8 },
-    { 0x1b, 6,          0, f_sw32_e9, u_sw32_e9, s_sw32_e9 },
-    { 0x1c, 6,          0, f_sw32_e8e9, u_sw32_e8e9, s_sw32_e8e9 },
+    { 0x1a, 6,          0, f_sw32_e8, u_sw32_e8, s_sw32_e8, NULL },
+    { 0x1b, 6,          0, f_sw32_e9, u_sw32_e9, s_sw32_e9, NULL },
+    { 0x1c, 6,          0, f_sw32_e8e9, u_sw32_e8e9, s_sw32_e8e9, NULL },
 
     // 32-bit call-/swaptrick
-    { 0x1d, 6,          0, f_ctsw32_e8_e9, u_ctsw32_e8_e9, s_ctsw32_e8_e9 },
-    { 0x1e, 6,          0, f_ctsw32_e9_e8, u_ctsw32_e9_e8, s_ctsw32_e9_e8 },
+    { 0x1d, 6,          0, f_ctsw32_e8_e9, u_ctsw32_e8_e9, s_ctsw32_e8_e9, NULL },
+    { 0x1e, 6,          0, f_ctsw32_e9_e8, u_ctsw32_e9_e8, s_ctsw32_e9_e8, NULL },
 
     // 32-bit cto calltrick
-    { 0x24, 6, 0x00ffffff, f_cto32_e8_bswap_le, u_cto32_e8_bswap_le, s_cto32_e8_bswap_le },
-    { 0x25, 6, 0x00ffffff, f_cto32_e9_bswap_le, u_cto32_e9_bswap_le, s_cto32_e9_bswap_le },
-    { 0x26, 6, 0x00ffffff, f_cto32_e8e9_bswap_le, u_cto32_e8e9_bswap_le, s_cto32_e8e9_bswap_le },
+    { 0x24, 6, 0x00ffffff, cto32_e8_bswap_le::filter, cto32_e8_bswap_le::unfilter, cto32_e8_bswap_le::scan, NULL },
+    { 0x25, 6, 0x00ffffff, cto32_e9_bswap_le::filter, cto32_e9_bswap_le::unfilter, cto32_e9_bswap_le::scan, NULL },
+    { 0x26, 6, 0x00ffffff, cto32_e8e9_bswap_le::filter, cto32_e8e9_bswap_le::unfilter, cto32_e8e9_bswap_le::scan, NULL },
 
     // 32-bit cto calltrick with jmp
-    { 0x36, 6, 0x00ffffff, f_ctoj32_e8e9_bswap_le, u_ctoj32_e8e9_bswap_le, s_ctoj32_e8e9_bswap_le },
+    { 0x36, 6, 0x00ffffff, ctoj32_e8e9_bswap_le::filter, ctoj32_e8e9_bswap_le::unfilter, ctoj32_e8e9_bswap_le::scan, NULL },
 
     // 32-bit calltrick with jmp, optional jcc; runtime can unfilter more than one block
-    { 0x46, 6, 0x00ffffff, f_ctok32_e8e9_bswap_le, u_ctok32_e8e9_bswap_le, s_ctok32_e8e9_bswap_le },
-    { 0x49, 6, 0x00ffffff, f_ctok32_e8e9_bswap_le, u_ctok32_e8e9_bswap_le, s_ctok32_e8e9_bswap_le },
+    { 0x46, 6, 0x00ffffff, ctok32_e8e9_bswap_le::filter, ctok32_e8e9_bswap_le::unfilter, ctok32_e8e9_bswap_le::scan, NULL },
+    { 0x49, 6, 0x00ffffff, ctok32_e8e9_jcc_bswap_le::filter, ctok32_e8e9_jcc_bswap_le::unfilter, ctok32_e8e9_jcc_bswap_le::scan, NULL },
 
     // 24-bit calltrick for arm
-    { 0x50, 8, 0x01ffffff, f_ct24arm_le, u_ct24arm_le, s_ct24arm_le },
-    { 0x51, 8, 0x01ffffff, f_ct24arm_be, u_ct24arm_be, s_ct24arm_be },
+    { 0x50, 8, 0x01ffffff, f_ct24arm_le, u_ct24arm_le, s_ct24arm_le, NULL },
+    { 0x51, 8, 0x01ffffff, f_ct24arm_be, u_ct24arm_be, s_ct24arm_be, NULL },
 
     // 26-bit calltrick for arm64
-    { 0x52, 8, 0x03ffffff, f_ct26arm_le, u_ct26arm_le, s_ct26arm_le },
+    { 0x52, 8, 0x03ffffff, f_ct26arm_le, u_ct26arm_le, s_ct26arm_le, NULL },
 
     // 32-bit cto calltrick with jmp and jcc(swap 0x0f/0x8Y) and relative renumbering
-    { 0x80, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le },
-    { 0x81, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le },
-    { 0x82, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le },
-    { 0x83, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le },
-    { 0x84, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le },
-    { 0x85, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le },
-    { 0x86, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le },
-    { 0x87, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le },
+    { 0x80, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le, NULL },
+    { 0x81, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le, NULL },
+    { 0x82, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le, NULL },
+    { 0x83, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le, NULL },
+    { 0x84, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le, NULL },
+    { 0x85, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le, NULL },
+    { 0x86, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le, NULL },
+    { 0x87, 8, 0x00ffffff, f_ctojr32_e8e9_bswap_le, u_ctojr32_e8e9_bswap_le, s_ctojr32_e8e9_bswap_le, NULL },
 
     // simple delta filter
-    { 0x90, 2,          0, f_sub8_1, u_sub8_1, s_sub8_1 },
-    { 0x91, 3,          0, f_sub8_2, u_sub8_2, s_sub8_2 },
-    { 0x92, 4,          0, f_sub8_3, u_sub8_3, s_sub8_3 },
-    { 0x93, 5,          0, f_sub8_4, u_sub8_4, s_sub8_4 },
+    { 0x90, 2,          0, f_sub8_1, u_sub8_1, s_sub8_1, NULL },
+    { 0x91, 3,          0, f_sub8_2, u_sub8_2, s_sub8_2, NULL },
+    { 0x92, 4,          0, f_sub8_3, u_sub8_3, s_sub8_3, NULL },
+    { 0x93, 5,          0, f_sub8_4, u_sub8_4, s_sub8_4, NULL },
 
-    { 0xa0,99,          0, f_sub16_1, u_sub16_1, s_sub16_1 },
-    { 0xa1,99,          0, f_sub16_2, u_sub16_2, s_sub16_2 },
-    { 0xa2,99,          0, f_sub16_3, u_sub16_3, s_sub16_3 },
-    { 0xa3,99,          0, f_sub16_4, u_sub16_4, s_sub16_4 },
+    { 0xa0,99,          0, f_sub16_1, u_sub16_1, s_sub16_1, NULL },
+    { 0xa1,99,          0, f_sub16_2, u_sub16_2, s_sub16_2, NULL },
+    { 0xa2,99,          0, f_sub16_3, u_sub16_3, s_sub16_3, NULL },
+    { 0xa3,99,          0, f_sub16_4, u_sub16_4, s_sub16_4, NULL },
 
-    { 0xb0,99,          0, f_sub32_1, u_sub32_1, s_sub32_1 },
-    { 0xb1,99,          0, f_sub32_2, u_sub32_2, s_sub32_2 },
-    { 0xb2,99,          0, f_sub32_3, u_sub32_3, s_sub32_3 },
-    { 0xb3,99,          0, f_sub32_4, u_sub32_4, s_sub32_4 },
+    { 0xb0,99,          0, f_sub32_1, u_sub32_1, s_sub32_1, NULL },
+    { 0xb1,99,          0, f_sub32_2, u_sub32_2, s_sub32_2, NULL },
+    { 0xb2,99,          0, f_sub32_3, u_sub32_3, s_sub32_3, NULL },
+    { 0xb3,99,          0, f_sub32_4, u_sub32_4, s_sub32_4, NULL },
 
     // PowerPC branch+call trick
-    { 0xd0, 8,          0, f_ppcbxx, u_ppcbxx, s_ppcbxx },
+    { 0xd0, 8,          0, f_ppcbxx, u_ppcbxx, s_ppcbxx, NULL },
 };
 
 const int FilterImp::n_filters = TABLESIZE(filters);
@@ -139,8 +139,9 @@ struct PackerNames
 static void show_all_packers(FILE *f, int verbose)
 {
     options_t o; o.reset();
-    PackerNames pn; pn.o = &o;
-    PackMaster::visitAllPackers(PackerNames::visit, NULL, &o, &pn);
+    PackContext ctx(&o);
+    PackerNames pn; pn.o = &ctx.options;
+    PackMaster::visitAllPackers(PackerNames::visit, NULL, &ctx, &pn);
     qsort(pn.names, pn.names_count, sizeof(PackerNames::Entry), PackerNames::cmp_fname);
     size_t pos = 0;
     for (size_t i = 0; i < pn.names_count; ++i)
@@ -221,6 +222,13 @@ void show_help(int verbose)
         con_fprintf(f,
                     "  --brute             try all available compression methods & filters [slow]\n"
                     "  --ultra-brute       try even more compression variants [very slow]\n"
+                    "  --threads=#         use # threads where possible; 0 = all CPUs\n"
+                    "  --jobs=#            process # files at the same time; 0 = all CPUs\n"
+                    "  --prescreen=#       with --brute: only try the # most promising filters\n"
+                    "  --cache-dir=DIR     reuse compression results stored in DIR\n"
+                    "  --cache-size=#      limit the cache to # MiB [default: 1024]\n"
+                    "  --lzma-threads=#    run the LZMA match finder on a helper thread if # > 1\n"
+                    "  --checksum=crc32c   store crc32c checksums [faster to test; newer UPX only]\n"
                     "\n");
         fg = con_fg(f,FG_YELLOW);
         con_fprintf(f,"Backup options:\n");
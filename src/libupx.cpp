@@ -0,0 +1,244 @@
+/* libupx.cpp -- in-memory packing API
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2020 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+
+#include "conf.h"
+#include "compress.h"
+#include "file.h"
+#include "packmast.h"
+#include "packer.h"
+#include "libupx.h"
+
+
+/*************************************************************************
+// util
+**************************************************************************/
+
+static UPX_THREAD_LOCAL char last_error[256];
+
+static void set_error(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    upx_vsnprintf(last_error, sizeof(last_error), format, args);
+    va_end(args);
+}
+
+static void set_error(const Throwable &e)
+{
+    const char *name = prettyName(typeid(e).name());
+    if (e.getMsg())
+        set_error("%s: %s", name, e.getMsg());
+    else
+        set_error("%s", name);
+}
+
+// the same as main() does; guarded by the compiler
+static bool lib_init()
+{
+    if (upx_ucl_init() != 0)
+        return false;
+    if (upx_lzma_init() != 0 || upx_zlib_init() != 0)
+        return false;
+#if (WITH_NRV)
+    if (upx_nrv_init() != 0)
+        return false;
+#endif
+    return true;
+}
+
+// see set_method() and "--brute" in main.cpp
+static bool set_options(options_t *o, const upx_lib_options_t *lo)
+{
+    if (lo->brute >= 1)
+    {
+        o->ultra_brute = lo->brute >= 2;
+        o->all_methods = true;
+        o->all_methods_use_lzma = true;
+        o->method = -1;
+        o->all_filters = true;
+        o->filter = -1;
+        o->crp.crp_ucl.m_size = 999999;
+        o->level = 10;
+    }
+    else
+    {
+        if (lo->method != UPX_LIB_METHOD_DEFAULT)
+        {
+            if (!Packer::isValidCompressionMethod(lo->method))
+                return false;
+            o->method = lo->method;
+        }
+        if (lo->level < 0 || lo->level > 10)
+            return false;
+        if (lo->level > 0)
+            o->level = lo->level;
+    }
+    if (lo->threads < 0)
+        return false;
+    o->threads = lo->threads;
+    o->force = lo->force ? 1 : 0;
+    o->exact = lo->exact ? true : false;
+    return true;
+}
+
+
+/*************************************************************************
+// pack or unpack one buffer, like do_one_file()
+**************************************************************************/
+
+static int lib_run(int cmd, const void *in, unsigned long in_len,
+                   const upx_lib_options_t *lo, upx_lib_write_t out_cb, void *user)
+{
+    static const bool init_ok = lib_init();
+    last_error[0] = 0;
+    if (!init_ok)
+    {
+        set_error("initialization failed");
+        return UPX_LIB_E_ERROR;
+    }
+
+    upx_lib_options_t lo_default;
+    if (lo == NULL)
+    {
+        upx_lib_options_init(&lo_default);
+        lo = &lo_default;
+    }
+    if (in == NULL || out_cb == NULL)
+    {
+        set_error("invalid argument");
+        return UPX_LIB_E_ERROR;
+    }
+    if (in_len < 512)
+    {
+        set_error("file is too small");
+        return UPX_LIB_E_ERROR;
+    }
+    if (!mem_size_valid_bytes(in_len))
+    {
+        set_error("file is too large");
+        return UPX_LIB_E_ERROR;
+    }
+
+    options_t o;
+    o.reset();
+    o.cmd = cmd;
+    o.verbose = -1;
+    o.console = CON_NONE;
+    o.overlay = o.COPY_OVERLAY;
+    o.backup = 0;
+    if (cmd == CMD_COMPRESS && !set_options(&o, lo))
+    {
+        set_error("invalid options");
+        return UPX_LIB_E_ERROR;
+    }
+    const char *name = lo->name ? lo->name : "<memory>";
+
+    try {
+        MemoryInputFile fi;
+        fi.open(in, (unsigned) in_len, name);
+        MemoryOutputFile fo;
+        fo.open(name);
+
+        // all messages get captured and are dropped
+        ConsoleCapture capture;
+        PackContext ctx(&o, NULL, &capture);
+        {
+            PackMaster pm(&fi, &ctx);
+            if (cmd == CMD_COMPRESS)
+                pm.pack(&fo);
+            else
+                pm.unpack(&fo);
+        }
+        fo.closex();
+        fi.closex();
+
+        if (out_cb(user, fo.getBuffer(), fo.getLength()) != 0)
+        {
+            set_error("callback failed");
+            return UPX_LIB_E_CALLBACK;
+        }
+    } catch (const NotPackedException &e) {
+        set_error(e);
+        return UPX_LIB_E_NOT_PACKED;
+    } catch (const CantPackException &e) {
+        set_error(e);
+        return UPX_LIB_E_CANT_PACK;
+    } catch (const CantUnpackException &e) {
+        set_error(e);
+        return UPX_LIB_E_CANT_UNPACK;
+    } catch (const OutOfMemoryException &e) {
+        set_error(e);
+        return UPX_LIB_E_OUT_OF_MEMORY;
+    } catch (const Throwable &e) {
+        set_error(e);
+        return UPX_LIB_E_ERROR;
+    } catch (const std::bad_alloc &) {
+        set_error("out of memory");
+        return UPX_LIB_E_OUT_OF_MEMORY;
+    } catch (const std::exception &e) {
+        set_error("unhandled exception: %s", prettyName(e.what()));
+        return UPX_LIB_E_ERROR;
+    } catch (...) {
+        set_error("unhandled exception");
+        return UPX_LIB_E_ERROR;
+    }
+    return UPX_LIB_OK;
+}
+
+
+/*************************************************************************
+// public API
+**************************************************************************/
+
+void upx_lib_options_init(upx_lib_options_t *options)
+{
+    memset(options, 0, sizeof(*options));
+    options->threads = 1;
+}
+
+int upx_pack_buffer(const void *in, unsigned long in_len,
+                    const upx_lib_options_t *options,
+                    upx_lib_write_t out_cb, void *user)
+{
+    return lib_run(CMD_COMPRESS, in, in_len, options, out_cb, user);
+}
+
+int upx_unpack_buffer(const void *in, unsigned long in_len,
+                      const upx_lib_options_t *options,
+                      upx_lib_write_t out_cb, void *user)
+{
+    return lib_run(CMD_DECOMPRESS, in, in_len, options, out_cb, user);
+}
+
+const char *upx_lib_last_error(void)
+{
+    return last_error;
+}
+
+/* vim:set ts=4 sw=4 et: */
@@ -0,0 +1,108 @@
+/* libupx.h -- in-memory packing API
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2020 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+
+#ifndef __UPX_LIBUPX_H
+#define __UPX_LIBUPX_H 1
+
+/*************************************************************************
+// A plain C interface for packing and unpacking executables in memory.
+// Link with libupx.a or libupx.so (see "make libupx" in src/Makefile).
+//
+// All functions are thread-safe; each call works on its own copy of
+// the options. Nothing is written to the console.
+**************************************************************************/
+
+/* the library is built with hidden visibility; these are its only exports */
+#if !defined(UPX_LIB_API)
+#  if (defined(__GNUC__) && (__GNUC__ >= 4)) || defined(__clang__)
+#    define UPX_LIB_API __attribute__((__visibility__("default")))
+#  else
+#    define UPX_LIB_API
+#  endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* return values */
+#define UPX_LIB_OK              0
+#define UPX_LIB_E_ERROR         (-1)    /* invalid input or internal error */
+#define UPX_LIB_E_CANT_PACK     (-2)    /* unknown format, already packed, ... */
+#define UPX_LIB_E_NOT_PACKED    (-3)    /* not packed by UPX */
+#define UPX_LIB_E_CANT_UNPACK   (-4)
+#define UPX_LIB_E_OUT_OF_MEMORY (-5)
+#define UPX_LIB_E_CALLBACK      (-6)    /* the callback returned non-zero */
+
+/* compression methods */
+#define UPX_LIB_METHOD_DEFAULT  0
+#define UPX_LIB_METHOD_NRV2B    2
+#define UPX_LIB_METHOD_NRV2D    5
+#define UPX_LIB_METHOD_NRV2E    8
+#define UPX_LIB_METHOD_LZMA     14
+
+typedef struct
+{
+    int level;          /* 1..9, 10 is "--best"; 0 means the default */
+    int method;         /* UPX_LIB_METHOD_xxx */
+    int brute;          /* 1 is "--brute", 2 is "--ultra-brute" */
+    int threads;        /* like "--threads"; 0 means all CPUs */
+    int force;          /* like "--force" */
+    int exact;          /* like "--exact" */
+    const char *name;   /* file name for messages and for formats that
+                           look at the extension; may be NULL */
+} upx_lib_options_t;
+
+/* Receives the whole output. A non-zero return value is passed on
+   as UPX_LIB_E_CALLBACK. The buffer is only valid during the call. */
+typedef int (*upx_lib_write_t)(void *user, const void *buf, unsigned long len);
+
+/* Set the defaults; same as memset() to 0 and threads = 1. */
+UPX_LIB_API void upx_lib_options_init(upx_lib_options_t *options);
+
+/* options may be NULL */
+UPX_LIB_API int upx_pack_buffer(const void *in, unsigned long in_len,
+                                const upx_lib_options_t *options,
+                                upx_lib_write_t out_cb, void *user);
+
+/* only options->name is used; options may be NULL */
+UPX_LIB_API int upx_unpack_buffer(const void *in, unsigned long in_len,
+                                  const upx_lib_options_t *options,
+                                  upx_lib_write_t out_cb, void *user);
+
+/* A message for the last error of the calling thread, or "". */
+UPX_LIB_API const char *upx_lib_last_error(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* already included */
+
+/* vim:set ts=4 sw=4 et: */
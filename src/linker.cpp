@@ -27,6 +27,7 @@
 
 #include "conf.h"
 #include "linker.h"
+#include "thread.h"
 
 static unsigned hex(unsigned char c) { return (c & 0xf) + (c > '9' ? 9 : 0); }
 
@@ -41,7 +42,7 @@ static bool update_capacity(unsigned size, unsigned *capacity) {
 }
 
 static void __acc_cdecl_va internal_error(const char *format, ...) {
-    static char buf[1024];
+    char buf[1024];
     va_list ap;
 
     va_start(ap, format);
@@ -51,24 +52,110 @@ static void __acc_cdecl_va internal_error(const char *format, ...) {
     throwInternalError(buf);
 }
 
+/*************************************************************************
+// LinkerArena
+**************************************************************************/
+
+struct LinkerArena::Chunk {
+    Chunk *next;
+    enum { HEADER_SIZE = 16, DATA_SIZE = 16384 - HEADER_SIZE };
+};
+
+LinkerArena::~LinkerArena() {
+    while (chunks != NULL) {
+        Chunk *c = chunks;
+        chunks = c->next;
+        free(c);
+    }
+}
+
+void *LinkerArena::alloc(size_t size) {
+    COMPILE_TIME_ASSERT(sizeof(Chunk) <= Chunk::HEADER_SIZE)
+    size = (size + 15) & ~(size_t) 15;
+    if (size <= avail) {
+        void *p = ptr;
+        ptr += size;
+        avail -= size;
+        return p;
+    }
+    // large blocks get a chunk of their own which does not replace the current one
+    const bool large = size > Chunk::DATA_SIZE / 4;
+    const size_t data_size = large ? size : (size_t) Chunk::DATA_SIZE;
+    Chunk *c = (Chunk *) malloc(Chunk::HEADER_SIZE + data_size);
+    if (c == NULL)
+        throwOutOfMemoryException();
+    char *p = (char *) c + Chunk::HEADER_SIZE;
+    if (large && chunks != NULL) {
+        c->next = chunks->next;
+        chunks->next = c;
+    } else {
+        c->next = chunks;
+        chunks = c;
+        if (!large) {
+            ptr = p + size;
+            avail = data_size - size;
+        }
+    }
+    return p;
+}
+
+char *LinkerArena::strdup(const char *s) {
+    size_t len = strlen(s) + 1;
+    char *p = (char *) alloc(len);
+    memcpy(p, s, len);
+    return p;
+}
+
+/*************************************************************************
+// hash tables of the sections and symbols by name
+**************************************************************************/
+
+static unsigned name_hash(const char *s) {
+    unsigned h = 2166136261u; // FNV-1a
+    for (; *s; s++)
+        h = (h ^ (unsigned char) *s) * 16777619u;
+    return h;
+}
+
+template <class T>
+static T *index_find(T *const *index, unsigned size, const char *name) {
+    if (size == 0)
+        return NULL;
+    for (unsigned i = name_hash(name) & (size - 1); index[i] != NULL; i = (i + 1) & (size - 1))
+        if (strcmp(index[i]->name, name) == 0)
+            return index[i];
+    return NULL;
+}
+
+// n is the number of items in the index; keep it at most half full
+template <class T>
+static void index_add(T ***index, unsigned *size, unsigned n, T *item) {
+    if (2 * (n + 1) > *size) {
+        const unsigned old_size = *size;
+        T **const old_index = *index;
+        *size = old_size ? 2 * old_size : 64;
+        *index = (T **) calloc(*size, sizeof(T *));
+        if (*index == NULL)
+            throwOutOfMemoryException();
+        for (unsigned i = 0; i < old_size; i++)
+            if (old_index[i] != NULL)
+                index_add(index, size, 0, old_index[i]);
+        free(old_index);
+    }
+    unsigned i = name_hash(item->name) & (*size - 1);
+    while ((*index)[i] != NULL)
+        i = (i + 1) & (*size - 1);
+    (*index)[i] = item;
+}
+
 /*************************************************************************
 // Section
 **************************************************************************/
 
-ElfLinker::Section::Section(const char *n, const void *i, unsigned s, unsigned a)
-    : name(NULL), output(NULL), size(s), offset(0), p2align(a), next(NULL) {
-    name = strdup(n);
+ElfLinker::Section::Section(const char *n, void *i, unsigned s, unsigned a)
+    : name(n), input(i), output(NULL), size(s), offset(0), p2align(a), next(NULL) {
     assert(name != NULL);
-    input = malloc(s + 1);
     assert(input != NULL);
-    if (s != 0)
-        memcpy(input, i, s);
-    ((char *) input)[s] = 0;
-}
-
-ElfLinker::Section::~Section() {
-    free(name);
-    free(input);
 }
 
 /*************************************************************************
@@ -76,14 +163,11 @@ ElfLinker::Section::~Section() {
 **************************************************************************/
 
 ElfLinker::Symbol::Symbol(const char *n, Section *s, upx_uint64_t o)
-    : name(NULL), section(s), offset(o) {
-    name = strdup(n);
+    : name(n), section(s), offset(o) {
     assert(name != NULL);
     assert(section != NULL);
 }
 
-ElfLinker::Symbol::~Symbol() { free(name); }
-
 /*************************************************************************
 // Relocation
 **************************************************************************/
@@ -99,28 +183,26 @@ ElfLinker::Relocation::Relocation(const Section *s, unsigned o, const char *t, c
 **************************************************************************/
 
 ElfLinker::ElfLinker()
-    : bele(&N_BELE_RTP::le_policy), input(NULL), output(NULL), head(NULL), tail(NULL),
-      sections(NULL), symbols(NULL), relocations(NULL), nsections(0), nsections_capacity(0),
-      nsymbols(0), nsymbols_capacity(0), nrelocations(0), nrelocations_capacity(0),
-      reloc_done(false) {}
+    : bele(&N_BELE_RTP::le_policy), input(NULL), output(NULL), output_capacity(0), head(NULL),
+      tail(NULL), sections(NULL), symbols(NULL), relocations(NULL), nsections(0),
+      nsections_capacity(0), nsymbols(0), nsymbols_capacity(0), nrelocations(0),
+      nrelocations_capacity(0), section_index(NULL), section_index_size(0), symbol_index(NULL),
+      symbol_index_size(0), reloc_done(false) {}
 
 ElfLinker::~ElfLinker() {
     delete[] input;
     delete[] output;
 
-    unsigned ic;
-    for (ic = 0; ic < nsections; ic++)
-        delete sections[ic];
+    // the sections, symbols and relocations themselves live in the arena
     free(sections);
-    for (ic = 0; ic < nsymbols; ic++)
-        delete symbols[ic];
     free(symbols);
-    for (ic = 0; ic < nrelocations; ic++)
-        delete relocations[ic];
     free(relocations);
+    free(section_index);
+    free(symbol_index);
 }
 
-void ElfLinker::init(const void *pdata_v, int plen) {
+// parse a stub loader; this is slow, so init() only does this once per stub
+void ElfLinker::parse(const void *pdata_v, int plen) {
     const upx_byte *pdata = (const upx_byte *) pdata_v;
     if (plen >= 16 && memcmp(pdata, "UPX#", 4) == 0) {
         // decompress pre-compressed stub-loader
@@ -156,10 +238,10 @@ void ElfLinker::init(const void *pdata_v, int plen) {
     }
     input[inputlen] = 0; // NUL terminate
 
-    output = new upx_byte[inputlen ? inputlen : 0x4000];
-    outputlen = 0;
-
-    if ((int) strlen("Sections:\n"
+    if (inputlen >= 8 && memcmp(input + inputlen - 4, "UPXL", 4) == 0) {
+        // binary link tables appended by stub/scripts/objinfo.py
+        preprocessLinkInfo(get_le32(input + inputlen - 8));
+    } else if ((int) strlen("Sections:\n"
                      "SYMBOL TABLE:\n"
                      "RELOCATION RECORDS FOR ") < inputlen) {
         int pos = find(input, inputlen, "Sections:\n", 10);
@@ -175,7 +257,149 @@ void ElfLinker::init(const void *pdata_v, int plen) {
         preprocessSections(psections, psymbols);
         preprocessSymbols(psymbols, prelocs);
         preprocessRelocations(prelocs, (char *) input + inputlen);
+    }
+}
+
+// copy the result of parse() from a parsed stub
+void ElfLinker::copyParsed(const ElfLinker *t) {
+    assert(input == NULL && nsections == 0);
+    inputlen = t->inputlen;
+    input = new upx_byte[inputlen + 1];
+    memcpy(input, t->input, inputlen + 1);
+
+    unsigned ic;
+    for (ic = 0; ic < t->nsections; ic++) {
+        const Section *sec = t->sections[ic];
+        ElfLinker::addSection(sec->name, sec->input, sec->size, sec->p2align);
+    }
+    for (ic = 0; ic < t->nsymbols; ic++) {
+        const Symbol *sym = t->symbols[ic];
+        addSymbol(sym->name, findSection(sym->section->name), sym->offset);
+    }
+    for (ic = 0; ic < t->nrelocations; ic++) {
+        const Relocation *rel = t->relocations[ic];
+        // the type string points into the input
+        const char *type = rel->type;
+        if (type >= (const char *) t->input && type < (const char *) t->input + t->inputlen)
+            type = (const char *) input + (type - (const char *) t->input);
+        addRelocation(findSection(rel->section->name), rel->offset, type,
+                      findSymbol(rel->value->name), rel->add);
+    }
+}
+
+/*************************************************************************
+// per-process cache of parsed stubs, keyed by the stub data
+**************************************************************************/
+
+struct ParsedStubCache {
+    enum { MAX_STUBS = 256 };
+    struct Entry {
+        upx_byte *data;
+        int len;
+        const ElfLinker *linker;
+    };
+    Mutex mutex;
+    Entry entries[MAX_STUBS];
+    unsigned nentries;
+
+    ParsedStubCache() : nentries(0) {}
+    ~ParsedStubCache() {
+        while (nentries > 0) {
+            Entry *e = &entries[--nentries];
+            delete[] e->data;
+            delete e->linker;
+        }
+    }
+    const ElfLinker *find(const void *data, int len) const {
+        for (unsigned i = 0; i < nentries; i++)
+            if (entries[i].len == len && memcmp(entries[i].data, data, len) == 0)
+                return entries[i].linker;
+        return NULL;
+    }
+    // takes ownership of linker; returns false if the cache is full
+    bool add(const void *data, int len, const ElfLinker *linker) {
+        if (nentries >= MAX_STUBS)
+            return false;
+        Entry *e = &entries[nentries];
+        e->data = new upx_byte[len + 1];
+        memcpy(e->data, data, len);
+        e->len = len;
+        e->linker = linker;
+        nentries++;
+        return true;
+    }
+};
+
+static ParsedStubCache parsed_stub_cache;
+
+void ElfLinker::init(const void *pdata, int plen) {
+    MutexLocker lock(&parsed_stub_cache.mutex);
+    const ElfLinker *t = parsed_stub_cache.find(pdata, plen);
+    ElfLinker *tmp = NULL;
+    if (t == NULL) {
+        tmp = new ElfLinker();
+        try {
+            tmp->parse(pdata, plen);
+        } catch (...) {
+            delete tmp;
+            throw;
+        }
+        t = tmp;
+        if (parsed_stub_cache.add(pdata, plen, tmp))
+            tmp = NULL;
+    }
+    copyParsed(t);
+    delete tmp;
+
+    output_capacity = inputlen ? inputlen : 0x4000;
+    output = new upx_byte[output_capacity];
+    outputlen = 0;
+
+    if (nsections > 0) // see parse()
         addLoader("*UND*");
+}
+
+// see stub/scripts/objinfo.py for the layout of the tables
+void ElfLinker::preprocessLinkInfo(unsigned pos) {
+    assert(pos + 16 <= (unsigned) inputlen - 8);
+    const upx_byte *const info = input + pos;
+    const unsigned info_len = inputlen - 8 - pos;
+    const unsigned nsec = get_le32(info + 0);
+    const unsigned nsym = get_le32(info + 4);
+    const unsigned nrel = get_le32(info + 8);
+    const unsigned strtab = get_le32(info + 12);
+    assert(nsec < 0x10000 && nsym < 0x10000 && nrel < 0x10000);
+    assert(16 + 16 * nsec + 16 * nsym + 24 * nrel == strtab);
+    assert(strtab < info_len && info[info_len - 1] == 0);
+    const char *const strings = (const char *) info + strtab;
+    const unsigned strings_len = info_len - strtab;
+
+    const upx_byte *p = info + 16;
+    unsigned ic;
+    for (ic = 0; ic < nsec; ic++, p += 16) {
+        const unsigned name = get_le32(p);
+        const unsigned offset = get_le32(p + 4);
+        const unsigned size = get_le32(p + 8);
+        assert(name < strings_len);
+        assert(offset <= pos && size <= pos - offset);
+        addSection(strings + name, input + offset, size, get_le32(p + 12));
+    }
+    addSection("*ABS*", NULL, 0, 0);
+    addSection("*UND*", NULL, 0, 0);
+
+    for (ic = 0; ic < nsym; ic++, p += 16) {
+        const unsigned name = get_le32(p);
+        const unsigned section = get_le32(p + 4);
+        assert(name < strings_len && section < nsections);
+        addSymbol(strings + name, sections[section], get_le64(p + 8));
+    }
+    for (ic = 0; ic < nrel; ic++, p += 24) {
+        const unsigned section = get_le32(p);
+        const unsigned type = get_le32(p + 8);
+        const unsigned symbol = get_le32(p + 12);
+        assert(section < nsections && type < strings_len && symbol < nsymbols);
+        addRelocation(sections[section], get_le32(p + 4), strings + type, symbols[symbol],
+                      get_le64(p + 16));
     }
 }
 
@@ -293,18 +517,18 @@ void ElfLinker::preprocessRelocations(char *start, char *end) {
 }
 
 ElfLinker::Section *ElfLinker::findSection(const char *name, bool fatal) const {
-    for (unsigned ic = 0; ic < nsections; ic++)
-        if (strcmp(sections[ic]->name, name) == 0)
-            return sections[ic];
+    Section *section = index_find(section_index, section_index_size, name);
+    if (section != NULL)
+        return section;
     if (fatal)
         internal_error("unknown section %s\n", name);
     return NULL;
 }
 
 ElfLinker::Symbol *ElfLinker::findSymbol(const char *name, bool fatal) const {
-    for (unsigned ic = 0; ic < nsymbols; ic++)
-        if (strcmp(symbols[ic]->name, name) == 0)
-            return symbols[ic];
+    Symbol *symbol = index_find(symbol_index, symbol_index_size, name);
+    if (symbol != NULL)
+        return symbol;
     if (fatal)
         internal_error("unknown symbol %s\n", name);
     return NULL;
@@ -321,14 +545,35 @@ ElfLinker::Section *ElfLinker::addSection(const char *sname, const void *sdata,
     assert(sname[0]);
     assert(sname[strlen(sname) - 1] != ':');
     assert(findSection(sname, false) == NULL);
-    Section *sec = new Section(sname, sdata, slen, p2align);
+    char *sinput = (char *) arena.alloc(slen + 1);
+    if (slen != 0)
+        memcpy(sinput, sdata, slen);
+    sinput[slen] = 0;
+    Section *sec =
+        new (arena.alloc(sizeof(Section))) Section(internName(sname), sinput, slen, p2align);
+    index_add(&section_index, &section_index_size, nsections, sec);
     sections[nsections++] = sec;
     return sec;
 }
 
+// section symbols share the name of their section
+const char *ElfLinker::internName(const char *name) {
+    const Section *section = index_find(section_index, section_index_size, name);
+    if (section != NULL)
+        return section->name;
+    const Symbol *symbol = index_find(symbol_index, symbol_index_size, name);
+    if (symbol != NULL)
+        return symbol->name;
+    return arena.strdup(name);
+}
+
 ElfLinker::Symbol *ElfLinker::addSymbol(const char *name, const char *section,
                                         upx_uint64_t offset) {
     // printf("addSymbol: %s %s 0x%x\n", name, section, offset);
+    return addSymbol(name, findSection(section), offset);
+}
+
+ElfLinker::Symbol *ElfLinker::addSymbol(const char *name, Section *section, upx_uint64_t offset) {
     if (update_capacity(nsymbols, &nsymbols_capacity))
         symbols = static_cast<Symbol **>(realloc(symbols, nsymbols_capacity * sizeof(Symbol *)));
     assert(symbols != NULL);
@@ -336,18 +581,26 @@ ElfLinker::Symbol *ElfLinker::addSymbol(const char *name, const char *section,
     assert(name[0]);
     assert(name[strlen(name) - 1] != ':');
     assert(findSymbol(name, false) == NULL);
-    Symbol *sym = new Symbol(name, findSection(section), offset);
+    Symbol *sym = new (arena.alloc(sizeof(Symbol))) Symbol(internName(name), section, offset);
+    index_add(&symbol_index, &symbol_index_size, nsymbols, sym);
     symbols[nsymbols++] = sym;
     return sym;
 }
 
 ElfLinker::Relocation *ElfLinker::addRelocation(const char *section, unsigned off, const char *type,
                                                 const char *symbol, upx_uint64_t add) {
+    return addRelocation(findSection(section), off, type, findSymbol(symbol), add);
+}
+
+ElfLinker::Relocation *ElfLinker::addRelocation(const Section *section, unsigned off,
+                                                const char *type, const Symbol *symbol,
+                                                upx_uint64_t add) {
     if (update_capacity(nrelocations, &nrelocations_capacity))
         relocations = static_cast<Relocation **>(
             realloc(relocations, (nrelocations_capacity) * sizeof(Relocation *)));
     assert(relocations != NULL);
-    Relocation *rel = new Relocation(findSection(section), off, type, findSymbol(symbol), add);
+    Relocation *rel =
+        new (arena.alloc(sizeof(Relocation))) Relocation(section, off, type, symbol, add);
     relocations[nrelocations++] = rel;
     return rel;
 }
@@ -377,6 +630,7 @@ int ElfLinker::addLoader(const char *sname) {
         if (sect[0] == '+') // alignment
         {
             assert(tail);
+            reserveOutput(16);
             unsigned l = hex(sect[2]) - tail->offset - tail->size;
             unsigned m = hex(sect[1]);
             if (m) {
@@ -391,6 +645,7 @@ int ElfLinker::addLoader(const char *sname) {
             }
         } else {
             Section *section = findSection(sect);
+            reserveOutput((section->p2align ? 1u << section->p2align : 0) + section->size);
             if (section->p2align) {
                 assert(tail);
                 assert(tail != section);
@@ -419,6 +674,25 @@ int ElfLinker::addLoader(const char *sname) {
     return outputlen;
 }
 
+// make room for len more bytes of output; the stub input no longer
+// bounds the size of the loader since the link tables are binary
+void ElfLinker::reserveOutput(unsigned len) {
+    if (outputlen + len <= (unsigned) output_capacity)
+        return;
+    unsigned capacity = output_capacity ? output_capacity : 0x4000;
+    while (capacity < outputlen + len)
+        capacity *= 2;
+    upx_byte *new_output = New(upx_byte, capacity);
+    if (outputlen)
+        memcpy(new_output, output, outputlen);
+    for (unsigned ic = 0; ic < nsections; ic++)
+        if (sections[ic]->output)
+            sections[ic]->output = new_output + (sections[ic]->output - output);
+    delete[] output;
+    output = new_output;
+    output_capacity = capacity;
+}
+
 void ElfLinker::addLoader(const char *s, va_list ap) {
     while (s != NULL) {
         addLoader(s);
@@ -28,6 +28,25 @@
 #ifndef __UPX_LINKER_H
 #define __UPX_LINKER_H 1
 
+/*************************************************************************
+// LinkerArena - the names, sections, symbols and relocations of a
+// linker are allocated from here and released together
+**************************************************************************/
+
+class LinkerArena : private noncopyable {
+public:
+    LinkerArena() : chunks(NULL), ptr(NULL), avail(0) {}
+    ~LinkerArena();
+    void *alloc(size_t size);
+    char *strdup(const char *s);
+
+private:
+    struct Chunk;
+    Chunk *chunks;
+    char *ptr;
+    size_t avail;
+};
+
 /*************************************************************************
 // ElfLinker
 **************************************************************************/
@@ -46,6 +65,7 @@ protected:
     int inputlen;
     upx_byte *output;
     int outputlen;
+    int output_capacity;
 
     Section *head;
     Section *tail;
@@ -61,18 +81,35 @@ protected:
     unsigned nrelocations;
     unsigned nrelocations_capacity;
 
+    // open addressing hash tables of the sections and symbols by name
+    Section **section_index;
+    unsigned section_index_size;
+    Symbol **symbol_index;
+    unsigned symbol_index_size;
+
+    LinkerArena arena;
+
     bool reloc_done;
 
 protected:
+    void parse(const void *pdata, int plen);
+    void copyParsed(const ElfLinker *parsed);
+    void preprocessLinkInfo(unsigned pos);
+    void reserveOutput(unsigned len);
     void preprocessSections(char *start, char *end);
     void preprocessSymbols(char *start, char *end);
     void preprocessRelocations(char *start, char *end);
     Section *findSection(const char *name, bool fatal = true) const;
     Symbol *findSymbol(const char *name, bool fatal = true) const;
 
+    const char *internName(const char *name);
+
     Symbol *addSymbol(const char *name, const char *section, upx_uint64_t offset);
+    Symbol *addSymbol(const char *name, Section *section, upx_uint64_t offset);
     Relocation *addRelocation(const char *section, unsigned off, const char *type,
                               const char *symbol, upx_uint64_t add);
+    Relocation *addRelocation(const Section *section, unsigned off, const char *type,
+                              const Symbol *symbol, upx_uint64_t add);
 
 public:
     ElfLinker();
@@ -116,7 +153,7 @@ protected:
 };
 
 struct ElfLinker::Section : private noncopyable {
-    char *name;
+    const char *name;
     void *input;
     upx_byte *output;
     unsigned size;
@@ -124,17 +161,16 @@ struct ElfLinker::Section : private noncopyable {
     unsigned p2align; // log2
     Section *next;
 
-    Section(const char *n, const void *i, unsigned s, unsigned a = 0);
-    ~Section();
+    // name and input are owned by the arena of the linker
+    Section(const char *n, void *i, unsigned s, unsigned a = 0);
 };
 
 struct ElfLinker::Symbol : private noncopyable {
-    char *name;
+    const char *name;
     Section *section;
     upx_uint64_t offset;
 
     Symbol(const char *n, Section *s, upx_uint64_t o);
-    ~Symbol();
 };
 
 struct ElfLinker::Relocation : private noncopyable {
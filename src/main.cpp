@@ -53,6 +53,9 @@ void options_t::reset()
     o->method = M_NONE;
     o->level = -1;
     o->filter = FT_NONE;
+    o->threads = 1;
+    o->jobs = 1;
+    o->cache_size = 1024;
 
     o->backup = -1;
     o->overlay = -1;
@@ -81,7 +84,7 @@ void options_t::reset()
 }
 
 static options_t global_options;
-options_t *opt = &global_options;
+UPX_THREAD_LOCAL options_t *opt = &global_options;
 
 static int done_output_name = 0;
 
@@ -678,6 +681,31 @@ static int do_option(int optc, const char *arg)
     case 525:                               // --exact
         opt->exact = true;
         break;
+    case 529:                               // --threads=
+        getoptvar(&opt->threads, 0, 256, arg);
+        break;
+    case 530:                               // --prescreen=
+        getoptvar(&opt->prescreen, 0, 255, arg);
+        break;
+    case 531:                               // --cache-dir=
+        if (!mfx_optarg || !mfx_optarg[0])
+            e_optarg(arg);
+        opt->cache_dir = mfx_optarg;
+        break;
+    case 532:                               // --cache-size=
+        getoptvar(&opt->cache_size, 0, 1024*1024, arg);
+        break;
+    case 533:                               // --jobs=
+        getoptvar(&opt->jobs, 0, 256, arg);
+        break;
+    case 534:                               // --checksum=
+        if (mfx_optarg && strcmp(mfx_optarg,"adler32") == 0)
+            opt->checksum_kind = UPX_CHECKSUM_ADLER32;
+        else if (mfx_optarg && strcmp(mfx_optarg,"crc32c") == 0)
+            opt->checksum_kind = UPX_CHECKSUM_CRC32C;
+        else
+            e_optarg(arg);
+        break;
     // compression runtime parameters
     case 801:
         getoptvar(&opt->crp.crp_ucl.c_flags, 0, 3, arg);
@@ -715,6 +743,15 @@ static int do_option(int optc, const char *arg)
     case 816:
         getoptvar(&opt->crp.crp_lzma.num_fast_bytes, arg);
         break;
+    case 817:                               // --lzma-threads=
+#if (WITH_LZMA_MT)
+        getoptvar(&opt->crp.crp_lzma.num_threads, arg);
+#else
+        fflush(con_term);
+        fprintf(stderr,"%s: option '%s' needs a UPX built with WITH_LZMA_MT\n", argv0, arg);
+        e_exit(EXIT_USAGE);
+#endif
+        break;
     case 821:
         getoptvar(&opt->crp.crp_zlib.mem_level, arg);
         break;
@@ -971,6 +1008,12 @@ static const struct mfx_option longopts[] =
     {"filter",           0x31, 0, 521},     // --filter=
     {"no-filter",        0x10, 0, 522},
     {"small",            0x10, 0, 520},
+    {"threads",          0x31, 0, 529},     // --threads=
+    {"prescreen",        0x31, 0, 530},     // --prescreen=
+    {"cache-dir",        0x31, 0, 531},     // --cache-dir=
+    {"cache-size",       0x31, 0, 532},     // --cache-size=
+    {"jobs",             0x31, 0, 533},     // --jobs=
+    {"checksum",         0x31, 0, 534},     // --checksum=
     // compression runtime parameters
     {"crp-nrv-cf",       0x31, 0, 801},
     {"crp-nrv-sl",       0x31, 0, 802},
@@ -991,6 +1034,7 @@ static const struct mfx_option longopts[] =
     {"crp-lzma-lc",      0x31, 0, 813},
     {"crp-lzma-ds",      0x31, 0, 814},
     {"crp-lzma-fb",      0x31, 0, 816},
+    {"lzma-threads",     0x31, 0, 817},     // --lzma-threads=
     {"crp-zlib-ml",      0x31, 0, 821},
     {"crp-zlib-wb",      0x31, 0, 822},
     {"crp-zlib-st",      0x31, 0, 823},
@@ -1115,6 +1159,10 @@ static const struct mfx_option longopts[] =
 
     // compression settings
     {"exact",            0x10, 0, 525},     // user requires byte-identical decompression
+    {"threads",          0x31, 0, 529},     // --threads=
+    {"prescreen",        0x31, 0, 530},     // --prescreen=
+    {"jobs",             0x31, 0, 533},     // --jobs=
+    {"checksum",         0x31, 0, 534},     // --checksum=
 
     // compression method
     {"nrv2b",            0x10, 0, 702},     // --nrv2b
@@ -1402,7 +1450,8 @@ __acc_static_noinline void upx_sanity_check(void)
 // main entry point
 **************************************************************************/
 
-#if !(WITH_GUI)
+// the library has no main(), see libupx.cpp
+#if !(WITH_GUI) && !(WITH_LIBUPX)
 
 #if (ACC_ARCH_M68K && ACC_OS_TOS && ACC_CC_GNUC) && defined(__MINT__)
 extern "C" { extern long _stksize; long _stksize = 256 * 1024L; }
@@ -1560,6 +1609,6 @@ int __acc_cdecl_main main(int argc, char *argv[])
     return exit_code;
 }
 
-#endif /* !(WITH_GUI) */
+#endif /* !(WITH_GUI) && !(WITH_LIBUPX) */
 
 /* vim:set ts=4 sw=4 et: */
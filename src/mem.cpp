@@ -28,6 +28,9 @@
 
 #include "conf.h"
 #include "mem.h"
+#if (HAVE_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
 
 
 /*************************************************************************
@@ -62,7 +65,7 @@ __acc_static_forceinline bool use_simple_mcheck() { return true; }
 **************************************************************************/
 
 MemBuffer::MemBuffer(upx_uint64_t size) :
-    b(NULL), b_size(0)
+    b(NULL), b_size(0), b_map(NULL), b_map_size(0)
 {
     alloc(size);
 }
@@ -90,7 +93,15 @@ void MemBuffer::dealloc()
     if (b != NULL)
     {
         checkState();
-        if (use_simple_mcheck())
+        if (b_map != NULL)
+        {
+#if (HAVE_SYS_MMAN_H) && defined(MAP_PRIVATE)
+            (void) ::munmap(b_map, b_map_size);
+#endif
+            b_map = NULL;
+            b_map_size = 0;
+        }
+        else if (use_simple_mcheck())
         {
             // remove magic constants
             set_be32(b - 8, 0);
@@ -170,7 +181,7 @@ void MemBuffer::checkState() const
 {
     if (!b)
         throwInternalError("block not allocated");
-    if (use_simple_mcheck())
+    if (use_simple_mcheck() && b_map == NULL)
     {
         if (get_be32(b - 4) != MAGIC1(b))
             throwInternalError("memory clobbered before allocated block 1");
@@ -210,4 +221,32 @@ void MemBuffer::alloc(upx_uint64_t size)
     //fill(0, b_size, (rand() & 0xff) | 1); // debug
 }
 
+
+bool MemBuffer::allocMapped(int fd, upx_uint64_t offset, unsigned size)
+{
+    assert(b == NULL);
+    assert(b_size == 0);
+    //
+    assert(size > 0);
+#if (HAVE_SYS_MMAN_H) && defined(MAP_PRIVATE) && defined(_SC_PAGESIZE)
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (fd < 0 || page_size <= 0 || !mem_size_valid_bytes(offset + size))
+        return false;
+    unsigned delta = ACC_ICONV(unsigned, offset % page_size);
+    size_t bytes = mem_size(1, size, delta);
+    // writes only change our private copy of the pages, never the file
+    void *p = ::mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, (off_t) (offset - delta));
+    if (p == MAP_FAILED)
+        return false;
+    b_map = p;
+    b_map_size = bytes;
+    b = (unsigned char *) p + delta;
+    b_size = size;
+    return true;
+#else
+    UNUSED(fd); UNUSED(offset);
+    return false;
+#endif
+}
+
 /* vim:set ts=4 sw=4 et: */
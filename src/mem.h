@@ -37,7 +37,7 @@
 class MemBuffer
 {
 public:
-    MemBuffer() : b(NULL), b_size(0) { }
+    MemBuffer() : b(NULL), b_size(0), b_map(NULL), b_map_size(0) { }
     explicit MemBuffer(upx_uint64_t size);
     ~MemBuffer();
 
@@ -48,11 +48,16 @@ public:
     void allocForCompression(unsigned uncompressed_size, unsigned extra=0);
     void allocForUncompression(unsigned uncompressed_size, unsigned extra=0);
 
+    // map size bytes of the file fd at offset with private copy-on-write
+    // pages; returns false if that is not possible here
+    bool allocMapped(int fd, upx_uint64_t offset, unsigned size);
+
     void dealloc();
 
     void checkState() const;
 
     unsigned getSize() const { return b_size; }
+    bool isMapped() const { return b_map != NULL; }
 
     operator       unsigned char * ()       { return b; }
     operator const unsigned char * () const { return b; }
@@ -72,6 +77,8 @@ public:
 private:
     unsigned char *b;
     unsigned b_size;
+    void *b_map;                // if set, b points into this mapping
+    size_t b_map_size;
 
     static unsigned global_alloc_counter;
 
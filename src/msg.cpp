@@ -34,7 +34,7 @@
 // we write all error messages to both stderr and stdout ?
 **************************************************************************/
 
-static int pr_need_nl = 0;
+static UPX_THREAD_LOCAL int pr_need_nl = 0;
 
 
 void printSetNl(int need_nl)
@@ -44,15 +44,11 @@ void printSetNl(int need_nl)
 
 void printClearLine(FILE *f)
 {
-    static char clear_line_msg[1+79+1+1];
-    if (!clear_line_msg[0])
-    {
-        char *msg = clear_line_msg;
-        msg[0] = '\r';
-        memset(msg+1,' ',79);
-        msg[80] = '\r';
-        msg[81] = 0;
-    }
+    char clear_line_msg[1+79+1+1];
+    clear_line_msg[0] = '\r';
+    memset(clear_line_msg+1,' ',79);
+    clear_line_msg[80] = '\r';
+    clear_line_msg[81] = 0;
 
     fflush(stdout); fflush(stderr);
     if (f == NULL)
@@ -65,7 +61,9 @@ void printClearLine(FILE *f)
 
 static void pr_print(bool c, const char *msg)
 {
-    if (c && !opt->to_stdout)
+    if (con_capture)
+        con_capture->append(stderr, msg, !(c && !opt->to_stdout));
+    else if (c && !opt->to_stdout)
         con_fprintf(stderr, "%s", msg);
     else
         fprintf(stderr, "%s", msg);
@@ -90,7 +88,8 @@ static void pr_error(const char *iname, const char *msg, bool is_warning)
     // At least I can use some colors then...
     bool c = acc_isatty(STDERR_FILENO) ? 1 : 0;
 
-    int fg = con_fg(stderr,FG_BRTRED);
+    // no colors for captured output
+    int fg = con_capture ? 0 : con_fg(stderr,FG_BRTRED);
     upx_snprintf(buf+strlen(buf),sizeof(buf)-strlen(buf),"%s: ", progname);
     pr_print(c,buf);
     //(void)con_fg(stderr,FG_RED);
@@ -100,7 +99,8 @@ static void pr_error(const char *iname, const char *msg, bool is_warning)
     pr_print(c,msg);
     pr_print(c,"\n");
     fflush(stdout); fflush(stderr);
-    fg = con_fg(stderr,fg);
+    if (!con_capture)
+        fg = con_fg(stderr,fg);
 
     UNUSED(is_warning);
     UNUSED(fg);
@@ -174,7 +174,7 @@ void printUnhandledException(const char *iname, const std::exception *e)
 // FIXME: should use colors and a consistent layout here
 **************************************************************************/
 
-static int info_header = 0;
+static UPX_THREAD_LOCAL int info_header = 0;
 
 
 static void info_print(const char *msg)
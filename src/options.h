@@ -65,6 +65,12 @@ struct options_t {
     bool no_filter;         // force no filter
     bool prefer_ucl;        // prefer UCL
     bool exact;             // user requires byte-identical decompression
+    int threads;            // number of compression threads; 0 means all CPUs
+    int jobs;               // number of files packed concurrently; 0 means all CPUs
+    int prescreen;          // only try the N most promising filters; 0 means all
+    const char *cache_dir;  // persistent compression cache; NULL means none
+    int cache_size;         // cache size limit in MiB; 0 means no limit
+    int checksum_kind;      // UPX_CHECKSUM_xxx stored in the pack header
 
     // other options
     int backup;
@@ -164,7 +170,8 @@ struct options_t {
     void reset();
 };
 
-extern struct options_t *opt;
+// each thread has its own current options, see PackMaster
+extern UPX_THREAD_LOCAL struct options_t *opt;
 
 
 #endif /* already included */
@@ -117,13 +117,18 @@ funpad4(InputFile *fi)
     return d;
 }
 
-static void alloc_file_image(MemBuffer &mb, off_t size)
+// Read the first size bytes of the file.  If the file is mapped then
+// an empty mb becomes a copy-on-write view, so that even large shared
+// libraries are not duplicated in memory.
+static void read_file_image(InputFile *f, MemBuffer &mb, off_t size)
 {
     assert(mem_size_valid_bytes(size));
+    f->seek(0, SEEK_SET);
     if (mb.getVoidPtr() == NULL) {
-        mb.alloc(size);
+        f->readView(mb, size);
     } else {
         assert((u32_t)size <= mb.getSize());
+        f->readx(mb, size);
     }
 }
 
@@ -275,16 +280,12 @@ PackLinuxElf32::PackLinuxElf32help1(InputFile *f)
 
     if (f && Elf32_Ehdr::ET_DYN!=e_type) {
         unsigned const len = sz_phdrs + e_phoff;
-        alloc_file_image(file_image, len);
-        f->seek(0, SEEK_SET);
-        f->readx(file_image, len);
+        read_file_image(f, file_image, len);
         phdri= (Elf32_Phdr       *)(e_phoff + file_image);  // do not free() !!
     }
     if (f && Elf32_Ehdr::ET_DYN==e_type) {
         // The DT_SYMTAB has no designated length.  Read the whole file.
-        alloc_file_image(file_image, file_size);
-        f->seek(0, SEEK_SET);
-        f->readx(file_image, file_size);
+        read_file_image(f, file_image, file_size);
         phdri= (Elf32_Phdr *)(e_phoff + file_image);  // do not free() !!
         shdri= (Elf32_Shdr *)(e_shoff + file_image);  // do not free() !!
         if (opt->cmd != CMD_COMPRESS) {
@@ -753,16 +754,12 @@ PackLinuxElf64::PackLinuxElf64help1(InputFile *f)
 
     if (f && Elf64_Ehdr::ET_DYN!=e_type) {
         unsigned const len = sz_phdrs + e_phoff;
-        alloc_file_image(file_image, len);
-        f->seek(0, SEEK_SET);
-        f->readx(file_image, len);
+        read_file_image(f, file_image, len);
         phdri= (Elf64_Phdr       *)(e_phoff + file_image);  // do not free() !!
     }
     if (f && Elf64_Ehdr::ET_DYN==e_type) {
         // The DT_SYMTAB has no designated length.  Read the whole file.
-        alloc_file_image(file_image, file_size);
-        f->seek(0, SEEK_SET);
-        f->readx(file_image, file_size);
+        read_file_image(f, file_image, file_size);
         phdri= (Elf64_Phdr *)(e_phoff + file_image);  // do not free() !!
         shdri= (Elf64_Shdr *)(e_shoff + file_image);  // do not free() !!
         if (opt->cmd != CMD_COMPRESS) {
@@ -2000,9 +1997,7 @@ bool PackLinuxElf32::canPack()
 
     if (Elf32_Ehdr::ET_DYN==get_te16(&ehdr->e_type)) {
         // The DT_SYMTAB has no designated length.  Read the whole file.
-        alloc_file_image(file_image, file_size);
-        fi->seek(0, SEEK_SET);
-        fi->readx(file_image, file_size);
+        read_file_image(fi, file_image, file_size);
         memcpy(&ehdri, ehdr, sizeof(Elf32_Ehdr));
         phdri= (Elf32_Phdr *)((size_t)e_phoff + file_image);  // do not free() !!
         shdri= (Elf32_Shdr *)((size_t)e_shoff + file_image);  // do not free() !!
@@ -2350,9 +2345,7 @@ PackLinuxElf64::canPack()
 
     if (Elf64_Ehdr::ET_DYN==get_te16(&ehdr->e_type)) {
         // The DT_SYMTAB has no designated length.  Read the whole file.
-        alloc_file_image(file_image, file_size);
-        fi->seek(0, SEEK_SET);
-        fi->readx(file_image, file_size);
+        read_file_image(fi, file_image, file_size);
         memcpy(&ehdri, ehdr, sizeof(Elf64_Ehdr));
         phdri= (Elf64_Phdr *)((size_t)e_phoff + file_image);  // do not free() !!
         shdri= (Elf64_Shdr *)((size_t)e_shoff + file_image);  // do not free() !!
@@ -4466,8 +4459,8 @@ void PackLinuxElf64::unpack(OutputFile *fo)
     unsigned const u_phnum = get_te16(&ehdr->e_phnum);
     unsigned total_in = 0;
     unsigned total_out = 0;
-    unsigned c_adler = upx_adler32(NULL, 0);
-    unsigned u_adler = upx_adler32(NULL, 0);
+    unsigned c_adler = upx_checksum_init(ph.checksum_kind);
+    unsigned u_adler = upx_checksum_init(ph.checksum_kind);
 #define MAX_ELF_HDR 1024
     if ((MAX_ELF_HDR - sizeof(Elf64_Ehdr))/sizeof(Elf64_Phdr) < u_phnum) {
         throwCantUnpack("bad compressed e_phnum");
@@ -5419,8 +5412,8 @@ void PackLinuxElf32::unpack(OutputFile *fo)
     unsigned const u_phnum = get_te16(&ehdr->e_phnum);
     unsigned total_in = 0;
     unsigned total_out = 0;
-    unsigned c_adler = upx_adler32(NULL, 0);
-    unsigned u_adler = upx_adler32(NULL, 0);
+    unsigned c_adler = upx_checksum_init(ph.checksum_kind);
+    unsigned u_adler = upx_checksum_init(ph.checksum_kind);
 #define MAX_ELF_HDR 512
     if ((MAX_ELF_HDR - sizeof(Elf32_Ehdr))/sizeof(Elf32_Phdr) < u_phnum) {
         throwCantUnpack("bad compressed e_phnum");
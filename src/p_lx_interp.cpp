@@ -236,8 +236,8 @@ void PackLinuxElf32x86interp::unpack(OutputFile *fo)
 
     unsigned total_in = 0;
     unsigned total_out = 0;
-    unsigned c_adler = upx_adler32(NULL, 0);
-    unsigned u_adler = upx_adler32(NULL, 0);
+    unsigned c_adler = upx_checksum_init(ph.checksum_kind);
+    unsigned u_adler = upx_checksum_init(ph.checksum_kind);
     off_t ptload0hi=0, ptload1lo=0, ptload1sz=0;
 
     // decompress PT_LOAD
@@ -1436,8 +1436,8 @@ void PackMachBase<T>::unpack(OutputFile *fo)
 
     unsigned total_in = 0;
     unsigned total_out = 0;
-    unsigned c_adler = upx_adler32(NULL, 0);
-    unsigned u_adler = upx_adler32(NULL, 0);
+    unsigned c_adler = upx_checksum_init(ph.checksum_kind);
+    unsigned u_adler = upx_checksum_init(ph.checksum_kind);
 
     fi->seek(- (off_t)(sizeof(bhdr) + ph.c_len), SEEK_CUR);
     for (unsigned k = 0; k < ncmds; ++k) {
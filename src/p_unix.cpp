@@ -37,6 +37,8 @@
 #include "packer.h"
 #include "p_unix.h"
 #include "p_elf.h"
+#include "thread.h"
+#include "ui.h"
 
 // do not change
 #define BLOCKSIZE       (512*1024)
@@ -174,7 +176,7 @@ int PackUnix::pack2(OutputFile *fo, Filter &ft)
         // compressWithFilters() updates u_adler _inside_ compress();
         // that is, AFTER filtering.  We want BEFORE filtering,
         // so that decompression checks the end-to-end checksum.
-        unsigned const end_u_adler = upx_adler32(ibuf, ph.u_len, ph.u_adler);
+        unsigned const end_u_adler = upx_checksum(ph.checksum_kind, ibuf, ph.u_len, ph.u_adler);
         compressWithFilters(&ft, OVERHEAD, NULL_cconf, filter_strategy,
             !!n_block++);  // check compression ratio only on first block
 
@@ -191,7 +193,7 @@ int PackUnix::pack2(OutputFile *fo, Filter &ft)
             // block is not compressible
             ph.c_len = ph.u_len;
             // must manually update checksum of compressed data
-            ph.c_adler = upx_adler32(ibuf, ph.u_len, ph.saved_c_adler);
+            ph.c_adler = upx_checksum(ph.checksum_kind, ibuf, ph.u_len, ph.saved_c_adler);
         }
 
         // write block header
@@ -325,6 +327,16 @@ void PackUnix::packExtent(
     unsigned hdr_u_len
 )
 {
+    // Blocks without filter are independent of the Packer state,
+    // so they can get compressed on multiple threads.
+    if (ft == NULL && hdr_u_len == 0 && x.size > (off_t)blocksize) {
+        unsigned const nthreads = upx_thread_get_nthreads(opt->threads);
+        if (nthreads > 1) {
+            packBlocksMT(x, total_in, total_out, fo, nthreads);
+            return;
+        }
+    }
+
     unsigned const init_u_adler = ph.u_adler;
     unsigned const init_c_adler = ph.c_adler;
     MemBuffer hdr_ibuf;
@@ -354,7 +366,7 @@ void PackUnix::packExtent(
             // compressWithFilters() updates u_adler _inside_ compress();
             // that is, AFTER filtering.  We want BEFORE filtering,
             // so that decompression checks the end-to-end checksum.
-            end_u_adler = upx_adler32(ibuf, ph.u_len, ph.u_adler);
+            end_u_adler = upx_checksum(ph.checksum_kind, ibuf, ph.u_len, ph.u_adler);
             ft->buf_len = l;
 
                 // compressWithFilters() requirements?
@@ -384,7 +396,7 @@ void PackUnix::packExtent(
             ph.c_len = ph.u_len;
             memcpy(obuf, ibuf, ph.c_len);
             // must update checksum of compressed data
-            ph.c_adler = upx_adler32(ibuf, ph.u_len, ph.saved_c_adler);
+            ph.c_adler = upx_checksum(ph.checksum_kind, ibuf, ph.u_len, ph.saved_c_adler);
         }
 
         // write block sizes
@@ -399,10 +411,10 @@ void PackUnix::packExtent(
                 throwInternalError("header compression failed");
             if (hdr_c_len >= hdr_u_len)
                 throwInternalError("header compression size increase");
-            ph.saved_u_adler = upx_adler32(hdr_ibuf, hdr_u_len, init_u_adler);
-            ph.saved_c_adler = upx_adler32(hdr_obuf, hdr_c_len, init_c_adler);
-            ph.u_adler = upx_adler32(ibuf, ph.u_len, ph.saved_u_adler);
-            ph.c_adler = upx_adler32(obuf, ph.c_len, ph.saved_c_adler);
+            ph.saved_u_adler = upx_checksum(ph.checksum_kind, hdr_ibuf, hdr_u_len, init_u_adler);
+            ph.saved_c_adler = upx_checksum(ph.checksum_kind, hdr_obuf, hdr_c_len, init_c_adler);
+            ph.u_adler = upx_checksum(ph.checksum_kind, ibuf, ph.u_len, ph.saved_u_adler);
+            ph.c_adler = upx_checksum(ph.checksum_kind, obuf, ph.c_len, ph.saved_c_adler);
             end_u_adler = ph.u_adler;
             memset(&tmp, 0, sizeof(tmp));
             set_te32(&tmp.sz_unc, hdr_u_len);
@@ -446,12 +458,177 @@ void PackUnix::packExtent(
     }
 }
 
+/*************************************************************************
+// packExtent() for blocks without filter, using multiple threads.
+// Each block gets compressed and verified using its own PackHeader and
+// adler32 values starting at 1; these are combined into the running
+// checksums when writing the blocks in order.
+**************************************************************************/
+
+struct PackUnix::PackBlocks
+{
+    enum { MAX_BLOCKS = 64 };
+
+    const PackUnix *packer;
+    PackHeader *ph[MAX_BLOCKS];
+    MemBuffer ibuf[MAX_BLOCKS];
+    MemBuffer obuf[MAX_BLOCKS];
+    MemBuffer vbuf[MAX_BLOCKS];     // for verifying
+
+    explicit PackBlocks(const PackUnix *p) : packer(p) {
+        for (unsigned k = 0; k < MAX_BLOCKS; k++)
+            ph[k] = NULL;
+    }
+    ~PackBlocks() {
+        for (unsigned k = 0; k < MAX_BLOCKS; k++)
+            delete ph[k];
+    }
+
+    // must be called from the main thread
+    void init(unsigned k, const PackHeader &ph0, unsigned l)
+    {
+        if (ph[k] == NULL)
+            ph[k] = new PackHeader(ph0);
+        PackHeader &xph = *ph[k];
+        xph = ph0;
+        xph.c_len = xph.u_len = l;
+        xph.overlap_overhead = 0;
+        xph.u_adler = xph.c_adler = upx_checksum_init(xph.checksum_kind);
+        xph.saved_u_adler = xph.saved_c_adler = xph.u_adler;
+        if (obuf[k].getSize() == 0) {
+            obuf[k].allocForCompression(packer->blocksize);
+            vbuf[k].allocForCompression(packer->blocksize);
+        }
+    }
+
+    void run(unsigned k)
+    {
+        PackHeader &xph = *ph[k];
+        // compress
+        (void) packer->compress(xph, ibuf[k], xph.u_len, obuf[k], NULL, NULL);    // ignore return value
+        if (xph.c_len < xph.u_len) {
+            xph.overlap_overhead = OVERHEAD;
+            if (!ph_testOverlappingDecompression(xph, obuf[k], ibuf[k], xph.overlap_overhead)) {
+                // not in-place compressible
+                xph.c_len = xph.u_len;
+            }
+        }
+        if (xph.c_len >= xph.u_len) {
+            // block is not compressible
+            xph.c_len = xph.u_len;
+            // must update checksum of compressed data
+            xph.c_adler = upx_checksum(xph.checksum_kind, ibuf[k], xph.u_len, xph.saved_c_adler);
+        }
+        else if (!ph_skipVerify(xph)) {
+            // same as verifyOverlappingDecompression(), but on a copy
+            unsigned offset = (xph.u_len + xph.overlap_overhead) - xph.c_len;
+            if (offset + xph.c_len <= vbuf[k].getSize()) {
+                memcpy(vbuf[k] + offset, obuf[k], xph.c_len);
+                ph_decompress(xph, vbuf[k] + offset, vbuf[k], true, NULL);
+            }
+        }
+    }
+};
+
+
+void PackUnix::packBlockTask(void *user, unsigned index)
+{
+    ((PackBlocks *) user)->run(index);
+}
+
+
+void PackUnix::packBlocksMT(
+    const Extent &x,
+    unsigned &total_in,
+    unsigned &total_out,
+    OutputFile *fo,
+    unsigned nthreads
+)
+{
+    PackBlocks pb(this);
+    unsigned const nbatch = UPX_MIN(nthreads, (unsigned) PackBlocks::MAX_BLOCKS);
+    bool task_ok[PackBlocks::MAX_BLOCKS];
+
+    fi->seek(x.offset, SEEK_SET);
+    for (off_t rest = x.size; 0 != rest; ) {
+        // read the next batch of blocks
+        unsigned n = 0;
+        for (; n < nbatch && 0 != rest; n++) {
+            if (pb.ibuf[n].getSize() == 0)
+                pb.ibuf[n].alloc(blocksize);
+            int l = fi->readx(pb.ibuf[n], UPX_MIN(rest, (off_t)blocksize));
+            if (l == 0) {
+                rest = 0;
+                break;
+            }
+            rest -= l;
+            pb.init(n, ph, l);
+        }
+        upx_thread_run_tasks(packBlockTask, &pb, n, nthreads, task_ok);
+
+        // write blocks in order
+        for (unsigned k = 0; k < n; k++) {
+            if (!task_ok[k]) {
+                // redo in this thread so that the exception propagates
+                pb.init(k, ph, pb.ph[k]->u_len);
+                pb.run(k);
+            }
+            if (uip->ui_pass >= 0)
+                uip->ui_pass++;
+            PackHeader const &xph = *pb.ph[k];
+
+            // write block sizes
+            b_info tmp;
+            memset(&tmp, 0, sizeof(tmp));
+            set_te32(&tmp.sz_unc, xph.u_len);
+            set_te32(&tmp.sz_cpr, xph.c_len);
+            if (xph.c_len < xph.u_len) {
+                tmp.b_method = (unsigned char) xph.method;
+            }
+            fo->write(&tmp, sizeof(tmp));
+            b_len += sizeof(b_info);
+
+            // write compressed data
+            if (xph.c_len < xph.u_len) {
+                fo->write(pb.obuf[k], xph.c_len);
+            }
+            else {
+                fo->write(pb.ibuf[k], xph.u_len);
+            }
+
+            // chain the checksums, and leave ph as the serial loop would
+            unsigned const u_adler = upx_checksum_combine(xph.checksum_kind, ph.u_adler, xph.u_adler, xph.u_len);
+            unsigned const c_adler = upx_checksum_combine(xph.checksum_kind, ph.c_adler, xph.c_adler, xph.c_len);
+            unsigned const saved_u_adler = ph.u_adler;
+            unsigned const saved_c_adler = ph.c_adler;
+            ph = xph;
+            ph.u_adler = u_adler;
+            ph.c_adler = c_adler;
+            ph.saved_u_adler = saved_u_adler;
+            ph.saved_c_adler = saved_c_adler;
+
+            total_in += xph.u_len;
+            total_out += xph.c_len;
+        }
+    }
+}
+
 void PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
     unsigned &total_in, unsigned &total_out,
     unsigned &c_adler, unsigned &u_adler,
     bool first_PF_X, unsigned szb_info, bool is_rewrite
 )
 {
+    // Blocks can be decompressed independently on multiple threads.
+    if (wanted > blocksize) {
+        unsigned const nthreads = upx_thread_get_nthreads(opt->threads);
+        if (nthreads > 1) {
+            unpackBlocksMT(wanted, fo, total_in, total_out, c_adler, u_adler,
+                           first_PF_X, szb_info, is_rewrite, nthreads);
+            return;
+        }
+    }
+
     b_info hdr; memset(&hdr, 0, sizeof(hdr));
     while (wanted) {
         fi->readx(&hdr, szb_info);
@@ -471,7 +648,7 @@ void PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
         int j = blocksize + OVERHEAD - sz_cpr;
         fi->readx(ibuf+j, sz_cpr);
         // update checksum of compressed data
-        c_adler = upx_adler32(ibuf + j, sz_cpr, c_adler);
+        c_adler = upx_checksum(ph.checksum_kind, ibuf + j, sz_cpr, c_adler);
         // decompress
         if (sz_cpr < sz_unc)
         {
@@ -498,7 +675,7 @@ void PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
             j = 0;
         }
         // update checksum of uncompressed data
-        u_adler = upx_adler32(ibuf + j, sz_unc, u_adler);
+        u_adler = upx_checksum(ph.checksum_kind, ibuf + j, sz_unc, u_adler);
         total_in  += sz_cpr;
         total_out += sz_unc;
         // write block
@@ -516,6 +693,156 @@ void PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
     }
 }
 
+
+/*************************************************************************
+// unpackExtent() using multiple threads: read a batch of blocks,
+// decompress and unfilter them in parallel, then merge the checksums
+// of the blocks and write them in order.
+**************************************************************************/
+
+struct PackUnix::UnpackBlocks
+{
+    enum { MAX_BLOCKS = 64 };
+
+    struct Block
+    {
+        explicit Block(const PackHeader &ph0) : ph(ph0), ft(ph0.level) { }
+        PackHeader ph;
+        Filter ft;              // ft.id == 0 means no filter
+        off_t c_pos;            // file offset of compressed data
+        unsigned c_off;         // offset of compressed data in buf
+        unsigned u_off;         // offset of uncompressed data in buf
+        unsigned c_adler;
+        unsigned u_adler;
+    };
+
+    Block *block[MAX_BLOCKS];
+    MemBuffer buf[MAX_BLOCKS];
+
+    UnpackBlocks() {
+        for (unsigned k = 0; k < MAX_BLOCKS; k++)
+            block[k] = NULL;
+    }
+    ~UnpackBlocks() {
+        for (unsigned k = 0; k < MAX_BLOCKS; k++)
+            delete block[k];
+    }
+
+    void run(unsigned k)
+    {
+        Block &b = *block[k];
+        unsigned const init = upx_checksum_init(b.ph.checksum_kind);
+        b.c_adler = upx_checksum(b.ph.checksum_kind, buf[k] + b.c_off, b.ph.c_len, init);
+        b.u_off = b.c_off;
+        if (b.ph.c_len < b.ph.u_len) {
+            ph_decompress(b.ph, buf[k] + b.c_off, buf[k], false, NULL);
+            if (b.ft.id != 0)
+                b.ft.unfilter(buf[k], b.ph.u_len);
+            b.u_off = 0;
+        }
+        b.u_adler = upx_checksum(b.ph.checksum_kind, buf[k] + b.u_off, b.ph.u_len, init);
+    }
+};
+
+
+void PackUnix::unpackBlockTask(void *user, unsigned index)
+{
+    ((UnpackBlocks *) user)->run(index);
+}
+
+
+void PackUnix::unpackBlocksMT(unsigned wanted, OutputFile *fo,
+    unsigned &total_in, unsigned &total_out,
+    unsigned &c_adler, unsigned &u_adler,
+    bool first_PF_X, unsigned szb_info, bool is_rewrite,
+    unsigned nthreads
+)
+{
+    UnpackBlocks ub;
+    unsigned const nbatch = UPX_MIN(nthreads, (unsigned) UnpackBlocks::MAX_BLOCKS);
+    bool task_ok[UnpackBlocks::MAX_BLOCKS];
+    b_info hdr; memset(&hdr, 0, sizeof(hdr));
+    while (wanted) {
+        // scan the b_info chain and read the next batch of blocks
+        unsigned n = 0;
+        for (; n < nbatch && wanted; n++) {
+            fi->readx(&hdr, szb_info);
+            int const sz_unc = get_te32(&hdr.sz_unc);
+            int const sz_cpr = get_te32(&hdr.sz_cpr);
+
+            if (sz_unc <= 0 || sz_cpr <= 0)
+                throwCantUnpack("corrupt b_info");
+            if (sz_cpr > sz_unc || sz_unc > (int)blocksize)
+                throwCantUnpack("corrupt b_info");
+            if (wanted < (unsigned)sz_unc)
+                throwCantUnpack("corrupt b_info");
+            wanted -= sz_unc;
+
+            if (ub.block[n] == NULL) {
+                ub.block[n] = new UnpackBlocks::Block(ph);
+                ub.buf[n].alloc(blocksize + OVERHEAD);
+            }
+            UnpackBlocks::Block &b = *ub.block[n];
+            b.ph = ph;
+            b.ph.u_len = sz_unc;
+            b.ph.c_len = sz_cpr;
+            b.ph.filter_cto = hdr.b_cto8;
+            b.ft.init(0, 0);
+            if (sz_cpr < sz_unc) {
+                if (12==szb_info) { // modern per-block filter
+                    if (hdr.b_ftid) {
+                        b.ft.init(hdr.b_ftid, 0);
+                        b.ft.cto = hdr.b_cto8;
+                    }
+                }
+                else { // ancient per-file filter
+                    if (first_PF_X) { // Elf32_Ehdr is never filtered
+                        first_PF_X = false;  // but everything else might be
+                    }
+                    else if (ph.filter) {
+                        b.ft.init(ph.filter, 0);
+                        b.ft.cto = (unsigned char) ph.filter_cto;
+                    }
+                }
+            }
+            b.c_off = blocksize + OVERHEAD - sz_cpr;
+            b.c_pos = fi->tell();
+            fi->readx(ub.buf[n] + b.c_off, sz_cpr);
+        }
+        upx_thread_run_tasks(unpackBlockTask, &ub, n, nthreads, task_ok);
+
+        // write blocks in order
+        for (unsigned k = 0; k < n; k++) {
+            UnpackBlocks::Block const &b = *ub.block[k];
+            if (!task_ok[k]) {
+                // redo in this thread so that the exception propagates;
+                // in-place decompression may have clobbered the input
+                off_t const pos = fi->tell();
+                fi->seek(b.c_pos, SEEK_SET);
+                fi->readx(ub.buf[k] + b.c_off, b.ph.c_len);
+                ub.run(k);
+                fi->seek(pos, SEEK_SET);
+            }
+            c_adler = upx_checksum_combine(b.ph.checksum_kind, c_adler, b.c_adler, b.ph.c_len);
+            u_adler = upx_checksum_combine(b.ph.checksum_kind, u_adler, b.u_adler, b.ph.u_len);
+            total_in  += b.ph.c_len;
+            total_out += b.ph.u_len;
+            // write block
+            if (fo) {
+                if (is_rewrite) {
+                    fo->rewrite(ub.buf[k] + b.u_off, b.ph.u_len);
+                }
+                else {
+                    fo->write(ub.buf[k] + b.u_off, b.ph.u_len);
+                }
+            }
+            ph.u_len = b.ph.u_len;
+            ph.c_len = b.ph.c_len;
+            ph.filter_cto = b.ph.filter_cto;
+        }
+    }
+}
+
 /*************************************************************************
 // Generic Unix canUnpack().
 **************************************************************************/
@@ -563,8 +890,8 @@ void PackUnix::unpack(OutputFile *fo)
         ? sizeof(bhdr.sz_unc) + sizeof(bhdr.sz_cpr)  // old style
         : sizeof(bhdr);
 
-    unsigned c_adler = upx_adler32(NULL, 0);
-    unsigned u_adler = upx_adler32(NULL, 0);
+    unsigned c_adler = upx_checksum_init(ph.checksum_kind);
+    unsigned u_adler = upx_checksum_init(ph.checksum_kind);
 
     // defaults for ph.version == 8
     unsigned orig_file_size = 0;
@@ -623,7 +950,7 @@ void PackUnix::unpack(OutputFile *fo)
             throwCantUnpack("corrupt b_info");
         fi->readx(buf+i, sz_cpr);
         // update checksum of compressed data
-        c_adler = upx_adler32(buf + i, sz_cpr, c_adler);
+        c_adler = upx_checksum(ph.checksum_kind, buf + i, sz_cpr, c_adler);
         // decompress
         if (sz_cpr < sz_unc) {
             decompress(buf+i, buf, false);
@@ -636,7 +963,7 @@ void PackUnix::unpack(OutputFile *fo)
             i = 0;
         }
         // update checksum of uncompressed data
-        u_adler = upx_adler32(buf + i, sz_unc, u_adler);
+        u_adler = upx_checksum(ph.checksum_kind, buf + i, sz_unc, u_adler);
         total_in  += sz_cpr;
         total_out += sz_unc;
         // write block
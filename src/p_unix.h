@@ -74,10 +74,18 @@ protected:
     virtual void packExtent(const Extent &x,
         unsigned &total_in, unsigned &total_out, Filter *, OutputFile *,
         unsigned hdr_len = 0);
+    void packBlocksMT(const Extent &x,
+        unsigned &total_in, unsigned &total_out, OutputFile *,
+        unsigned nthreads);
     virtual void unpackExtent(unsigned wanted, OutputFile *fo,
         unsigned &total_in, unsigned &total_out,
         unsigned &c_adler, unsigned &u_adler,
         bool first_PF_X, unsigned szb_info, bool is_rewrite = false);
+    void unpackBlocksMT(unsigned wanted, OutputFile *fo,
+        unsigned &total_in, unsigned &total_out,
+        unsigned &c_adler, unsigned &u_adler,
+        bool first_PF_X, unsigned szb_info, bool is_rewrite,
+        unsigned nthreads);
 
     int exetype;
     unsigned blocksize;
@@ -119,6 +127,14 @@ protected:
 
     // do not change !!!
     enum { OVERHEAD = 2048 };
+
+private:
+    // private to packBlocksMT()
+    struct PackBlocks;
+    static void packBlockTask(void *user, unsigned index);
+    // private to unpackBlocksMT()
+    struct UnpackBlocks;
+    static void unpackBlockTask(void *user, unsigned index);
 };
 
 
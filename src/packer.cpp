@@ -27,11 +27,14 @@
 
 
 #include "conf.h"
+#include "compress.h"
 #include "file.h"
 #include "packer.h"
 #include "filter.h"
 #include "linker.h"
 #include "ui.h"
+#include "thread.h"
+#include "cache.h"
 
 
 /*************************************************************************
@@ -41,7 +44,7 @@
 Packer::Packer(InputFile *f) :
     bele(NULL),
     fi(f), file_size(-1), ph_format(-1), ph_version(-1),
-    uip(NULL), linker(NULL),
+    uip(NULL), ctx(NULL), linker(NULL),
     last_patch(NULL), last_patch_len(0), last_patch_off(0)
 {
     if (fi != NULL)
@@ -190,25 +193,133 @@ bool ph_skipVerify(const PackHeader &ph)
 bool Packer::compress(upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
                       const upx_compress_config_t *cconf_parm)
 {
-    ph.u_len = i_len;
-    ph.c_len = 0;
-    assert(ph.level >= 1); assert(ph.level <= 10);
-
     // Avoid too many progress bar updates. 64 is s->bar_len in ui.cpp.
-    unsigned step = (ph.u_len < 64*1024) ? 0 : ph.u_len / 64;
+    unsigned step = (i_len < 64*1024) ? 0 : i_len / 64;
+#if (WITH_NRV)
+    if (M_IS_NRV2B(ph.method) || M_IS_NRV2D(ph.method) || M_IS_NRV2E(ph.method))
+        if (ph.level >= 7 || (ph.level >= 4 && i_len >= 512*1024))
+            step = 0;
+#endif
+    if (uip->ui_pass >= 0)
+        uip->ui_pass++;
+    uip->startCallback(i_len, step, uip->ui_pass, uip->ui_total_passes);
+    uip->firstCallback();
+
+    bool r;
+    try {
+        r = compress(ph, i_ptr, i_len, o_ptr, cconf_parm, uip->getCallback());
+    } catch (...) {
+        uip->endCallback();
+        throw;
+    }
+    //uip->finalCallback(ph.u_len, ph.c_len);
+    uip->endCallback();
+    return r;
+}
+
+
+// Everything that can influence the compressed stream must go into
+// the key, see cache.h. This includes the UPX version (for the entry
+// layout and Packer::compress() itself) and the compression libraries.
+static void getCodecVersions(char *buf, unsigned size)
+{
+    const char *v[4] = { NULL, NULL, NULL, NULL };
+#if (WITH_NRV)
+    v[0] = upx_nrv_version_string();
+#endif
+#if (WITH_UCL)
+    v[1] = upx_ucl_version_string();
+#endif
+#if (WITH_ZLIB)
+    v[2] = upx_zlib_version_string();
+#endif
+#if (WITH_LZMA)
+    v[3] = upx_lzma_version_string();
+#endif
+    upx_snprintf(buf, size, "nrv %s ucl %s zlib %s lzma %s",
+                 v[0] ? v[0] : "-", v[1] ? v[1] : "-",
+                 v[2] ? v[2] : "-", v[3] ? v[3] : "-");
+}
+
+static upx_cache_key_t getCacheKey(const PackHeader &xph, const upx_bytep i_ptr,
+                                   const upx_compress_config_t &cconf)
+{
+    struct {
+        unsigned p[9];
+        char versions[128];
+        unsigned c[32];
+    } k;
+    mem_clear(&k, sizeof(k));
+    k.p[0] = UPX_VERSION_HEX;
+    k.p[1] = xph.u_len;
+    k.p[2] = xph.format;
+    k.p[3] = xph.method;
+    k.p[4] = xph.level;
+    k.p[5] = xph.filter;
+    k.p[6] = xph.filter_cto;
+    k.p[7] = opt->prefer_ucl;
+    k.p[8] = sizeof(upx_compress_result_t);
+    getCodecVersions(k.versions, sizeof(k.versions));
+    // Add each parameter by value: the padding of the config structs is
+    // indeterminate, so hashing them raw could change the key between runs.
+    // max_c_len and the LZMA num_threads never change a successful result.
+    unsigned n = 0;
+#define K(x)        k.c[n++] = (unsigned) (x)
+#define KOPT(x)     K(x.v); K(x.is_set)
+    const lzma_compress_config_t &lz = cconf.conf_lzma;
+    KOPT(lz.pos_bits); KOPT(lz.lit_pos_bits); KOPT(lz.lit_context_bits);
+    KOPT(lz.dict_size); K(lz.fast_mode); KOPT(lz.num_fast_bytes);
+    K(lz.match_finder_cycles); K(lz.max_num_probs);
+    const ucl_compress_config_t &uc = cconf.conf_ucl;
+    K(uc.bb_endian); K(uc.bb_size); K(uc.max_offset); K(uc.max_match);
+    K(uc.s_level); K(uc.h_level); K(uc.p_level); K(uc.c_flags); K(uc.m_size);
+    const zlib_compress_config_t &zc = cconf.conf_zlib;
+    KOPT(zc.mem_level); KOPT(zc.window_bits); KOPT(zc.strategy);
+#undef KOPT
+#undef K
+    assert(n <= TABLESIZE(k.c));
+    return upx_cache_key(i_ptr, xph.u_len, &k, sizeof(k));
+}
+
+
+// A cache entry is only used if it decompresses to exactly i_ptr[];
+// a corrupt, stale or colliding entry is just a cache miss.
+static bool verifyCachedStream(const PackHeader &xph, const upx_bytep i_ptr,
+                               const upx_bytep o_ptr)
+{
+    if (xph.c_len == 0 || xph.c_len >= xph.u_len)
+        return false;
+    MemBuffer tmp(xph.u_len);
+    unsigned new_len = xph.u_len;
+    int r = upx_decompress(o_ptr, xph.c_len, tmp, &new_len, xph.method, &xph.compress_result);
+    if (r == UPX_E_OUT_OF_MEMORY)
+        throwOutOfMemoryException();
+    return r == UPX_E_OK && new_len == xph.u_len && memcmp(tmp, i_ptr, xph.u_len) == 0;
+}
+
+
+// Does not touch any Packer state or the UI, so this can be called
+// concurrently on private buffers (see compressWithFilters()).
+bool Packer::compress(PackHeader &xph, upx_bytep i_ptr, unsigned i_len,
+                      upx_bytep o_ptr, const upx_compress_config_t *cconf_parm,
+                      upx_callback_p cb) const
+{
+    xph.u_len = i_len;
+    xph.c_len = 0;
+    assert(xph.level >= 1); assert(xph.level <= 10);
 
     // save current checksums
-    ph.saved_u_adler = ph.u_adler;
-    ph.saved_c_adler = ph.c_adler;
+    xph.saved_u_adler = xph.u_adler;
+    xph.saved_c_adler = xph.c_adler;
     // update checksum of uncompressed data
-    ph.u_adler = upx_adler32(i_ptr, ph.u_len, ph.u_adler);
+    xph.u_adler = upx_checksum(xph.checksum_kind, i_ptr, xph.u_len, xph.u_adler);
 
     // set compression parameters
     upx_compress_config_t cconf; cconf.reset();
     if (cconf_parm)
         cconf = *cconf_parm;
     // cconf options
-    if (M_IS_NRV2B(ph.method) || M_IS_NRV2D(ph.method) || M_IS_NRV2E(ph.method))
+    if (M_IS_NRV2B(xph.method) || M_IS_NRV2D(xph.method) || M_IS_NRV2E(xph.method))
     {
         if (opt->crp.crp_ucl.c_flags != -1)
             cconf.conf_ucl.c_flags = opt->crp.crp_ucl.c_flags;
@@ -220,90 +331,106 @@ bool Packer::compress(upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
             cconf.conf_ucl.max_offset = opt->crp.crp_ucl.max_offset;
         if (opt->crp.crp_ucl.max_match != UINT_MAX && opt->crp.crp_ucl.max_match < cconf.conf_ucl.max_match)
             cconf.conf_ucl.max_match = opt->crp.crp_ucl.max_match;
-#if (WITH_NRV)
-        if (ph.level >= 7 || (ph.level >= 4 && ph.u_len >= 512*1024))
-            step = 0;
-#endif
     }
-    if (M_IS_LZMA(ph.method))
+    if (M_IS_LZMA(xph.method))
     {
         oassign(cconf.conf_lzma.pos_bits, opt->crp.crp_lzma.pos_bits);
         oassign(cconf.conf_lzma.lit_pos_bits, opt->crp.crp_lzma.lit_pos_bits);
         oassign(cconf.conf_lzma.lit_context_bits, opt->crp.crp_lzma.lit_context_bits);
         oassign(cconf.conf_lzma.dict_size, opt->crp.crp_lzma.dict_size);
         oassign(cconf.conf_lzma.num_fast_bytes, opt->crp.crp_lzma.num_fast_bytes);
+        oassign(cconf.conf_lzma.num_threads, opt->crp.crp_lzma.num_threads);
     }
-    if (M_IS_DEFLATE(ph.method))
+    if (M_IS_DEFLATE(xph.method))
     {
         oassign(cconf.conf_zlib.mem_level, opt->crp.crp_zlib.mem_level);
         oassign(cconf.conf_zlib.window_bits, opt->crp.crp_zlib.window_bits);
         oassign(cconf.conf_zlib.strategy, opt->crp.crp_zlib.strategy);
     }
-    if (uip->ui_pass >= 0)
-        uip->ui_pass++;
-    uip->startCallback(ph.u_len, step, uip->ui_pass, uip->ui_total_passes);
-    uip->firstCallback();
 
-    //OutputFile::dump("data.raw", in, ph.u_len);
+    //OutputFile::dump("data.raw", in, xph.u_len);
 
-    // compress
-    int r = upx_compress(i_ptr, ph.u_len, o_ptr, &ph.c_len,
-                         uip->getCallback(),
-                         ph.method, ph.level, &cconf, &ph.compress_result);
+    // try the persistent cache first
+    bool cached = false;
+    xph.cache_key = 0;
+    if (upx_cache_enabled())
+    {
+        xph.cache_key = getCacheKey(xph, i_ptr, cconf);
+        cached = upx_cache_get_compressed(xph.cache_key, xph.u_len,
+                                          o_ptr, MemBuffer::getSizeForCompression(xph.u_len),
+                                          &xph.c_len, &xph.compress_result);
+        if (cached && !verifyCachedStream(xph, i_ptr, o_ptr))
+        {
+            cached = false;
+            xph.c_len = 0;
+            memset(&xph.compress_result, 0, sizeof(xph.compress_result));
+        }
+        if (cached && cconf.max_c_len && xph.c_len > cconf.max_c_len)
+            return false;   // over budget
+    }
 
-    //uip->finalCallback(ph.u_len, ph.c_len);
-    uip->endCallback();
+    // compress
+    int r = UPX_E_OK;
+    if (!cached)
+        r = upx_compress(i_ptr, xph.u_len, o_ptr, &xph.c_len,
+                         cb,
+                         xph.method, xph.level, &cconf, &xph.compress_result);
 
     if (r == UPX_E_OUT_OF_MEMORY)
         throwOutOfMemoryException();
+    if (r == UPX_E_OUTPUT_OVERRUN && cconf.max_c_len)
+        return false;   // over budget
     if (r != UPX_E_OK)
         throwInternalError("compression failed");
 
-    if (M_IS_NRV2B(ph.method) || M_IS_NRV2D(ph.method) || M_IS_NRV2E(ph.method))
+    if (M_IS_NRV2B(xph.method) || M_IS_NRV2D(xph.method) || M_IS_NRV2E(xph.method))
     {
-        const ucl_uint *res = ph.compress_result.result_ucl.result;
-        //ph.min_offset_found = res[0];
-        ph.max_offset_found = res[1];
-        //ph.min_match_found = res[2];
-        ph.max_match_found = res[3];
-        //ph.min_run_found = res[4];
-        ph.max_run_found = res[5];
-        ph.first_offset_found = res[6];
-        //ph.same_match_offsets_found = res[7];
+        const ucl_uint *res = xph.compress_result.result_ucl.result;
+        //xph.min_offset_found = res[0];
+        xph.max_offset_found = res[1];
+        //xph.min_match_found = res[2];
+        xph.max_match_found = res[3];
+        //xph.min_run_found = res[4];
+        xph.max_run_found = res[5];
+        xph.first_offset_found = res[6];
+        //xph.same_match_offsets_found = res[7];
         if (cconf_parm)
         {
-            assert(cconf.conf_ucl.max_offset == 0 || cconf.conf_ucl.max_offset >= ph.max_offset_found);
-            assert(cconf.conf_ucl.max_match == 0 || cconf.conf_ucl.max_match >= ph.max_match_found);
+            assert(cconf.conf_ucl.max_offset == 0 || cconf.conf_ucl.max_offset >= xph.max_offset_found);
+            assert(cconf.conf_ucl.max_match == 0 || cconf.conf_ucl.max_match >= xph.max_match_found);
         }
     }
 
-    //printf("\nPacker::compress: %d/%d: %7d -> %7d\n", ph.method, ph.level, ph.u_len, ph.c_len);
-    if (!checkCompressionRatio(ph.u_len, ph.c_len))
+    //printf("\nPacker::compress: %d/%d: %7d -> %7d\n", xph.method, xph.level, xph.u_len, xph.c_len);
+    if (!checkCompressionRatio(xph.u_len, xph.c_len))
         return false;
     // return in any case if not compressible
-    if (ph.c_len >= ph.u_len)
+    if (xph.c_len >= xph.u_len)
         return false;
 
     // update checksum of compressed data
-    ph.c_adler = upx_adler32(o_ptr, ph.c_len, ph.c_adler);
-    // Decompress and verify. Skip this when using the fastest level.
-    if (!ph_skipVerify(ph))
+    xph.c_adler = upx_checksum(xph.checksum_kind, o_ptr, xph.c_len, xph.c_adler);
+    // Decompress and verify. Skip this when using the fastest level,
+    // or when a cache entry was already verified above.
+    if (!cached && !ph_skipVerify(xph))
     {
         // decompress
-        unsigned new_len = ph.u_len;
-        r = upx_decompress(o_ptr, ph.c_len, i_ptr, &new_len, ph.method, &ph.compress_result);
+        unsigned new_len = xph.u_len;
+        r = upx_decompress(o_ptr, xph.c_len, i_ptr, &new_len, xph.method, &xph.compress_result);
         if (r == UPX_E_OUT_OF_MEMORY)
             throwOutOfMemoryException();
-        //printf("%d %d: %d %d %d\n", ph.method, r, ph.c_len, ph.u_len, new_len);
+        //printf("%d %d: %d %d %d\n", xph.method, r, xph.c_len, xph.u_len, new_len);
         if (r != UPX_E_OK)
             throwInternalError("decompression failed");
-        if (new_len != ph.u_len)
+        if (new_len != xph.u_len)
             throwInternalError("decompression failed (size error)");
 
         // verify decompression
-        if (ph.u_adler != upx_adler32(i_ptr, ph.u_len, ph.saved_u_adler))
+        if (xph.u_adler != upx_checksum(xph.checksum_kind, i_ptr, xph.u_len, xph.saved_u_adler))
             throwInternalError("decompression failed (checksum error)");
     }
+    if (xph.cache_key && !cached)
+        upx_cache_put_compressed(xph.cache_key, xph.u_len, o_ptr, xph.c_len, &xph.compress_result);
     return true;
 }
 
@@ -364,7 +491,7 @@ void ph_decompress(PackHeader &ph, const upx_bytep in, upx_bytep out,
     // verify checksum of compressed data
     if (verify_checksum)
     {
-        adler = upx_adler32(in, ph.c_len, ph.saved_c_adler);
+        adler = upx_checksum(ph.checksum_kind, in, ph.c_len, ph.saved_c_adler);
         if (adler != ph.c_adler)
             throwChecksumError();
     }
@@ -385,7 +512,7 @@ void ph_decompress(PackHeader &ph, const upx_bytep in, upx_bytep out,
     {
         if (ft)
             ft->unfilter(out, ph.u_len);
-        adler = upx_adler32(out, ph.u_len, ph.saved_u_adler);
+        adler = upx_checksum(ph.checksum_kind, out, ph.u_len, ph.saved_u_adler);
         if (adler != ph.u_adler)
             throwChecksumError();
     }
@@ -403,7 +530,6 @@ void Packer::decompress(const upx_bytep in, upx_bytep out,
 // overlapping decompression
 **************************************************************************/
 
-static
 bool ph_testOverlappingDecompression(const PackHeader &ph,
                                      const upx_bytep buf,
                                      const upx_bytep tbuf,
@@ -436,6 +562,29 @@ bool ph_testOverlappingDecompression(const PackHeader &ph,
 }
 
 
+// Compute the smallest overlap_overhead for which
+// ph_testOverlappingDecompression() succeeds, in a single decoding pass.
+// Returns 0 if this is not supported for ph.method.
+unsigned ph_getOverlapOverhead(const PackHeader &ph, const upx_bytep buf)
+{
+    if (ph.c_len >= ph.u_len)
+        return 0;
+
+    unsigned src_off = 0;
+    unsigned new_len = ph.u_len;
+    int r = upx_find_overlap(buf, ph.c_len, &new_len, &src_off, ph.method);
+    if (r != UPX_E_OK || new_len != ph.u_len || src_off + ph.c_len < ph.u_len)
+        return 0;
+
+    // same adjustments as in ph_testOverlappingDecompression() above
+    unsigned extra = 0;
+    if (M_IS_NRV2B(ph.method) || M_IS_NRV2D(ph.method) || M_IS_NRV2E(ph.method))
+        extra = 3;
+    unsigned overlap_overhead = src_off + ph.c_len - ph.u_len + extra;
+    return UPX_MAX(overlap_overhead, 5 + extra);
+}
+
+
 bool Packer::testOverlappingDecompression(const upx_bytep buf, const upx_bytep tbuf,
                                           unsigned overlap_overhead) const
 {
@@ -491,6 +640,9 @@ void Packer::verifyOverlappingDecompression(upx_bytep o_ptr, unsigned o_size, Fi
 // Find overhead for in-place decompression in a heuristic way
 // (using a binary search). Return 0 on error.
 //
+// For methods supported by upx_find_overlap() the minimum is computed
+// in a single decoding pass and the search needs no more test runs.
+//
 // To speed up things:
 //   - you can pass the range of an acceptable interval (so that
 //     we can succeed early)
@@ -507,18 +659,42 @@ unsigned Packer::findOverlapOverhead(const upx_bytep buf,
     // prepare to deal with very pessimistic values
     unsigned low = 1;
     unsigned high = UPX_MIN(ph.u_len + 512, upper_limit);
-    // but be optimistic for first try (speedup)
-    unsigned m = UPX_MIN(16u, high);
-    //
+
+    // a cached result only needs to be confirmed by a single test
+    upx_cache_key_t key = 0;
+    if (ph.cache_key)
+    {
+        const unsigned k[5] = { 1, range, upper_limit,
+                                (unsigned) ph.cache_key, (unsigned) (ph.cache_key >> 32) };
+        key = upx_cache_key(NULL, 0, k, sizeof(k));
+        unsigned o = 0;
+        if (upx_cache_get_overlap(key, &o) && o >= low && o <= high)
+            if (testOverlappingDecompression(buf, tbuf, o))
+                return o;
+    }
+
     unsigned overhead = 0;
     unsigned nr = 0;          // statistics
 
+    // Try the single-pass computation first, and confirm that it is
+    // indeed minimal. The search below still runs so that the result
+    // (which need not be the minimum if range > 1) stays the same,
+    // but its probes are then answered without decompressing.
+    unsigned o_min = ph_getOverlapOverhead(ph, buf);
+    if (o_min < low || o_min > high || !testOverlappingDecompression(buf, tbuf, o_min))
+        o_min = 0;
+    else if (o_min > low && testOverlappingDecompression(buf, tbuf, o_min - 1))
+        o_min = 0;
+
+    // but be optimistic for first try (speedup)
+    unsigned m = UPX_MIN(16u, high);
+
     while (high >= low)
     {
         assert(m >= low); assert(m <= high);
         assert(m < overhead || overhead == 0);
         nr++;
-        bool success = testOverlappingDecompression(buf, tbuf, m);
+        bool success = o_min ? m >= o_min : testOverlappingDecompression(buf, tbuf, m);
         //printf("testOverlapOverhead(%d): %d %d: %d -> %d\n", nr, low, high, m, (int)success);
         if (success)
         {
@@ -540,6 +716,8 @@ unsigned Packer::findOverlapOverhead(const upx_bytep buf,
     //printf("findOverlapOverhead: %d (%d tries)\n", overhead, nr);
     if (overhead == 0)
         throwInternalError("this is an oo bug");
+    if (key)
+        upx_cache_put_overlap(key, overhead);
 
     UNUSED(nr);
     return overhead;
@@ -602,18 +780,21 @@ void Packer::copyOverlay(OutputFile *fo, unsigned overlay,
     if (do_seek)
         fi->seek(-(off_t)overlay, SEEK_END);
 
+    // between regular files the kernel can copy the data for us
+    overlay -= (unsigned) fo->copyFrom(fi, overlay);
+
     // get buffer size, align to improve i/o speed
     unsigned buf_size = buf->getSize();
     if (buf_size > 65536)
         buf_size = ALIGN_DOWN(buf_size, 4096u);
     assert((int)buf_size > 0);
 
-    do {
+    while (overlay > 0) {
         unsigned len = overlay < buf_size ? overlay : buf_size;
         fi->readx(buf, len);
         fo->write(buf, len);
         overlay -= len;
-    } while (overlay > 0);
+    }
     buf->checkState();
 }
 
@@ -670,7 +851,8 @@ void Packer::initPackHeader()
     ph.format = getFormat();
     ph.method = M_NONE;
     ph.level = -1;
-    ph.u_adler = ph.c_adler = ph.saved_u_adler = ph.saved_c_adler = upx_adler32(NULL,0);
+    ph.checksum_kind = UPX_CHECKSUM_ADLER32;
+    ph.u_adler = ph.c_adler = ph.saved_u_adler = ph.saved_c_adler = upx_checksum_init(ph.checksum_kind);
     ph.buf_offset = 0;
     ph.u_file_size = file_size;
 }
@@ -689,6 +871,9 @@ void Packer::updatePackHeader()
     //
     assert(isValidCompressionMethod(ph.method));
     assert(1 <= ph.level && ph.level <= 10);
+    //
+    ph.checksum_kind = opt->checksum_kind;
+    ph.u_adler = ph.c_adler = ph.saved_u_adler = ph.saved_c_adler = upx_checksum_init(ph.checksum_kind);
 }
 
 
@@ -1054,7 +1239,7 @@ unsigned Packer::unoptimizeReloc64(upx_byte **in, upx_byte *image,
 static const char *getIdentstr(unsigned *size, int small)
 {
     // IMPORTANT: we do NOT change "http://upx.sf.net"
-    static char identbig[] =
+    static const char identbig[] =
         "\n\0"
         "$Info: "
         "This file is packed with the UPX executable packer http://upx.sf.net $"
@@ -1063,37 +1248,13 @@ static const char *getIdentstr(unsigned *size, int small)
         UPX_VERSION_STRING4
         " Copyright (C) 1996-" UPX_VERSION_YEAR " the UPX Team. All Rights Reserved. $"
         "\n";
-    static char identsmall[] =
+    static const char identsmall[] =
         "\n"
         "$Id: UPX "
         "(C) 1996-" UPX_VERSION_YEAR " the UPX Team. All Rights Reserved. http://upx.sf.net $"
         "\n";
-    static char identtiny[] = UPX_VERSION_STRING4;
-
-    static int done;
-    if (!done && (opt->debug.fake_stub_version[0] || opt->debug.fake_stub_year[0]))
-    {
-        struct strinfo_t { char *s; int size; };
-        static const strinfo_t strlist[] = {
-            { identbig,   (int)sizeof(identbig) },
-            { identsmall, (int)sizeof(identsmall) },
-            { identtiny,  (int)sizeof(identtiny) },
-        { NULL, 0 } };
-        const strinfo_t* iter;
-
-        for (iter = strlist; iter->s; ++iter)
-        {
-            if (opt->debug.fake_stub_version[0])
-                mem_replace(iter->s, iter->size, UPX_VERSION_STRING4, 4, opt->debug.fake_stub_version);
-            if (opt->debug.fake_stub_year[0])
-                mem_replace(iter->s, iter->size, UPX_VERSION_YEAR, 4, opt->debug.fake_stub_year);
-        }
-        done = 1;
-    }
-
+    static const char identtiny[] = UPX_VERSION_STRING4;
 
-    if (small < 0)
-        small = opt->small;
     if (small >= 2)
     {
         *size = sizeof(identtiny);
@@ -1120,8 +1281,21 @@ void Packer::initLoader(const void *pdata, int plen, int small)
     linker->init(pdata, plen);
 
     unsigned size;
-    char const * const ident = getIdentstr(&size, small);
-    linker->addSection("IDENTSTR", ident, size, 0);
+    char const * const ident = getIdentstr(&size, small < 0 ? opt->small : small);
+    if (opt->debug.fake_stub_version[0] || opt->debug.fake_stub_year[0])
+    {
+        // patch a private copy, as the options may differ between files
+        char buf[256];
+        assert(size <= sizeof(buf));
+        memcpy(buf, ident, size);
+        if (opt->debug.fake_stub_version[0])
+            mem_replace(buf, size, UPX_VERSION_STRING4, 4, opt->debug.fake_stub_version);
+        if (opt->debug.fake_stub_year[0])
+            mem_replace(buf, size, UPX_VERSION_YEAR, 4, opt->debug.fake_stub_year);
+        linker->addSection("IDENTSTR", buf, size, 0);
+    }
+    else
+        linker->addSection("IDENTSTR", ident, size, 0);
 }
 
 
@@ -1359,6 +1533,129 @@ done:
 }
 
 
+// Prefer smaller total size, then smaller loaders, then less overlap_overhead.
+static bool isBetterCompression(const PackHeader &xph, unsigned lsize, unsigned hdr_c_len,
+                                const PackHeader &best_ph, unsigned best_lsize, unsigned best_hdr_c_len)
+{
+    if (xph.c_len + lsize + hdr_c_len < best_ph.c_len + best_lsize + best_hdr_c_len)
+        return true;
+    if (xph.c_len + lsize + hdr_c_len == best_ph.c_len + best_lsize + best_hdr_c_len)
+    {
+        // prefer smaller loaders
+        if (lsize + hdr_c_len < best_lsize + best_hdr_c_len)
+            return true;
+        if (lsize + hdr_c_len == best_lsize + best_hdr_c_len)
+        {
+            // prefer less overlap_overhead
+            if (xph.overlap_overhead < best_ph.overlap_overhead)
+                return true;
+        }
+    }
+    return false;
+}
+
+
+// A trial cannot win once its compressed size exceeds this budget.
+static unsigned getTrialBudget(const PackHeader &best_ph, unsigned best_lsize,
+                               unsigned best_hdr_c_len, unsigned hdr_c_len)
+{
+    unsigned best = best_ph.c_len + best_lsize + best_hdr_c_len;
+    return (best > hdr_c_len) ? best - hdr_c_len : 1;
+}
+
+
+/*************************************************************************
+// compressWithFilters() trials that can run on multiple threads.
+// Each trial filters into and compresses a private copy of the input;
+// everything that touches the Packer state (findOverlapOverhead(),
+// buildLoader(), the UI) stays in the calling thread.
+**************************************************************************/
+
+struct Packer::CompressTrials
+{
+    enum { MAX_TRIALS = 64 };
+
+    struct Trial
+    {
+        Trial() : ft(0) { }
+        PackHeader ph;
+        Filter ft;
+        upx_compress_config_t cconf;
+        bool filtered;          // filter success
+        bool compressed;        // compress() success
+    };
+
+    const Packer *packer;
+    const PackHeader &orig_ph;
+    const Filter &orig_ft;
+    const upx_bytep i_ptr;
+    unsigned i_len;
+    unsigned f_off;
+    unsigned f_len;
+    const upx_compress_config_t *cconf;
+
+    Trial trial[MAX_TRIALS];
+    MemBuffer ibuf[MAX_TRIALS];
+    MemBuffer obuf[MAX_TRIALS];
+
+    CompressTrials(const Packer *p, const PackHeader &ph0, const Filter &ft0,
+                   const upx_bytep i, unsigned il, unsigned fo, unsigned fl,
+                   const upx_compress_config_t *c) :
+        packer(p), orig_ph(ph0), orig_ft(ft0),
+        i_ptr(i), i_len(il), f_off(fo), f_len(fl), cconf(c) { }
+
+    // must be called from the main thread
+    void init(unsigned k, int method, int filter_id, unsigned max_c_len)
+    {
+        Trial &t = trial[k];
+        // get fresh packheader
+        t.ph = orig_ph;
+        t.ph.method = method;
+        t.ph.filter = filter_id;
+        t.ph.overlap_overhead = 0;
+        // get fresh filter
+        t.ft = orig_ft;
+        t.ft.init(t.ph.filter, orig_ft.addvalue);
+        packer->optimizeFilter(&t.ft, i_ptr + f_off, f_len);
+        t.cconf.reset();
+        if (cconf)
+            t.cconf = *cconf;
+        t.cconf.max_c_len = max_c_len;
+        t.filtered = t.compressed = false;
+        if (ibuf[k].getSize() == 0)
+        {
+            ibuf[k].alloc(i_len);
+            obuf[k].allocForCompression(i_len);
+        }
+    }
+
+    void run(unsigned k)
+    {
+        Trial &t = trial[k];
+        upx_bytep ip = ibuf[k];
+        memcpy(ip, i_ptr, f_off);
+        memcpy(ip + f_off + f_len, i_ptr + f_off + f_len, i_len - f_off - f_len);
+        t.filtered = t.ft.filter(i_ptr + f_off, f_len, ip + f_off);
+        if (t.ft.id != 0 && t.ft.calls == 0)
+        {
+            // filter did not do anything
+            t.filtered = false;
+        }
+        if (!t.filtered)
+            return;
+        t.ph.filter_cto = t.ft.cto;
+        t.ph.n_mru = t.ft.n_mru;
+        t.compressed = packer->compress(t.ph, ip, i_len, obuf[k], &t.cconf, NULL);
+    }
+};
+
+
+void Packer::compressTrialTask(void *user, unsigned index)
+{
+    ((CompressTrials *) user)->run(index);
+}
+
+
 void Packer::compressWithFilters(upx_bytep i_ptr, unsigned i_len,
                                  upx_bytep o_ptr,
                                  upx_bytep f_ptr, unsigned f_len,
@@ -1392,6 +1689,9 @@ void Packer::compressWithFilters(upx_bytep i_ptr, unsigned i_len,
     int filters[256];
     int nfilters = prepareFilters(filters, filter_strategy, getFilters());
     assert(nfilters > 0); assert(nfilters < 256);
+    if (filter_strategy >= 0 && opt->prescreen > 0)
+        nfilters = prescreenFilters(filters, nfilters, f_ptr, f_len, &orig_ft, opt->prescreen);
+    assert(nfilters > 0);
 #if 0
     printf("compressWithFilters: m(%d):", nmethods);
     for (int i = 0; i < nmethods; i++) printf(" %d", methods[i]);
@@ -1411,9 +1711,133 @@ void Packer::compressWithFilters(upx_bytep i_ptr, unsigned i_len,
     // Working buffer for compressed data. Don't waste memory and allocate as needed.
     upx_bytep o_tmp = o_ptr;
     MemBuffer o_tmp_buf;
+    // Input for compress(); see below.
+    upx_bytep c_ptr = i_ptr;
+    MemBuffer c_buf;
 
     // compress using all methods/filters
     int nfilters_success_total = 0;
+    const unsigned nthreads = upx_thread_get_nthreads(opt->threads);
+    if (nthreads > 1 && filter_strategy >= 0 && nmethods * nfilters > 1 &&
+        f_ptr >= i_ptr && f_ptr + f_len <= i_ptr + i_len)
+    {
+        // Same search as the serial loop below, but run the trials in
+        // batches on multiple threads. The results get reduced in the
+        // serial order, so the outcome is exactly the same.
+        // Only done when every trial is run anyway: by default the serial
+        // loop stops at the first successful filter of each method, and
+        // running the other filters ahead of time would just waste work.
+        CompressTrials tt(this, orig_ph, orig_ft, i_ptr, i_len,
+                          ptr_diff(f_ptr, i_ptr), f_len, cconf);
+        unsigned hdr_c_lens[256];
+        int nfilters_success_mm[256];
+        for (int mm = 0; mm < nmethods; mm++)
+        {
+            assert(isValidCompressionMethod(methods[mm]));
+            hdr_c_lens[mm] = 0;
+            nfilters_success_mm[mm] = 0;
+            if (hdr_ptr != NULL && hdr_len)
+            {
+                if (o_tmp == o_ptr)
+                {
+                    o_tmp_buf.allocForCompression(hdr_len);
+                    o_tmp = o_tmp_buf;
+                }
+                int r = upx_compress(hdr_ptr, hdr_len, o_tmp, &hdr_c_lens[mm],
+                                     NULL, methods[mm], 10, NULL, NULL);
+                if (r != UPX_E_OK)
+                    throwInternalError("header compression failed");
+                if (hdr_c_lens[mm] >= hdr_len)
+                    throwInternalError("header compression size increase");
+            }
+        }
+
+        const unsigned ntrials = nmethods * nfilters;
+        const unsigned nbatch = UPX_MIN(nthreads, (unsigned) CompressTrials::MAX_TRIALS);
+        for (unsigned first = 0; first < ntrials; first += nbatch)
+        {
+            const unsigned n = UPX_MIN(nbatch, ntrials - first);
+            bool task_ok[CompressTrials::MAX_TRIALS];
+            for (unsigned k = 0; k < n; k++)
+            {
+                const int mm = (first + k) / nfilters, ff = (first + k) % nfilters;
+                assert(isValidFilter(filters[ff]));
+                tt.init(k, methods[mm], filters[ff],
+                        getTrialBudget(best_ph, best_ph_lsize, best_hdr_c_len, hdr_c_lens[mm]));
+            }
+            upx_thread_run_tasks(compressTrialTask, &tt, n, nthreads, task_ok);
+
+            for (unsigned k = 0; k < n; k++)
+            {
+                const int mm = (first + k) / nfilters, ff = (first + k) % nfilters;
+                CompressTrials::Trial &t = tt.trial[k];
+                if (!task_ok[k])
+                {
+                    // redo in this thread so that the exception propagates
+                    tt.init(k, methods[mm], filters[ff],
+                            getTrialBudget(best_ph, best_ph_lsize, best_hdr_c_len, hdr_c_lens[mm]));
+                    tt.run(k);
+                }
+                if (!t.filtered)
+                {
+                    // filter failed or was useless - adjust ui passes
+                    if (uip->ui_pass >= 0)
+                        uip->ui_pass++;
+                    continue;
+                }
+                nfilters_success_total++;
+                nfilters_success_mm[mm]++;
+                if (uip->ui_pass >= 0)
+                    uip->ui_pass++;
+                if (t.compressed)
+                {
+                    const unsigned hdr_c_len = hdr_c_lens[mm];
+                    ph = t.ph;
+                    unsigned lsize = 0;
+                    // findOverlapOperhead() might be slow; omit if already too big.
+                    if (ph.c_len + lsize + hdr_c_len <= best_ph.c_len + best_ph_lsize + best_hdr_c_len)
+                    {
+                        // get results
+                        ph.overlap_overhead = findOverlapOverhead(tt.obuf[k], tt.ibuf[k], overlap_range);
+                        buildLoader(&t.ft);
+                        lsize = getLoaderSize();
+                        assert(lsize > 0);
+                    }
+                    if (isBetterCompression(ph, lsize, hdr_c_len, best_ph, best_ph_lsize, best_hdr_c_len))
+                    {
+                        assert((int)ph.overlap_overhead > 0);
+                        // update o_ptr[] with best version
+                        memcpy(o_ptr, tt.obuf[k], ph.c_len);
+                        // save compression results
+                        best_ph = ph;
+                        best_ph_lsize = lsize;
+                        best_hdr_c_len = hdr_c_len;
+                        best_ft = t.ft;
+                        best_ft.buf = f_ptr;    // not the private copy
+                    }
+                }
+            }
+        }
+        for (int mm = 0; mm < nmethods; mm++)
+            assert(nfilters_success_mm[mm] > 0);
+        goto done;
+    }
+
+    // Filter into a scratch copy of the input, so that the original
+    // stays untouched and need not be unfiltered and verified after
+    // each trial. Only the filter range changes from trial to trial.
+    if (f_ptr >= i_ptr && f_ptr + f_len <= i_ptr + i_len)
+    {
+        for (int ff = 0; ff < nfilters; ff++)
+            if (filters[ff] != 0)
+            {
+                c_buf.alloc(i_len);
+                memcpy(c_buf, i_ptr, i_len);
+                c_ptr = c_buf;
+                break;
+            }
+    }
+
     for (int mm = 0; mm < nmethods; mm++) // for all methods
     {
         assert(isValidCompressionMethod(methods[mm]));
@@ -1447,7 +1871,7 @@ void Packer::compressWithFilters(upx_bytep i_ptr, unsigned i_len,
             ft.init(ph.filter, orig_ft.addvalue);
             // filter
             optimizeFilter(&ft, f_ptr, f_len);
-            bool success = ft.filter(f_ptr, f_len);
+            bool success = ft.filter(f_ptr, f_len, c_ptr + (f_ptr - i_ptr));
             if (ft.id != 0 && ft.calls == 0)
             {
                 // filter did not do anything - no need to call ft.unfilter()
@@ -1478,15 +1902,20 @@ void Packer::compressWithFilters(upx_bytep i_ptr, unsigned i_len,
             nfilters_success_mm++;
             ph.filter_cto = ft.cto;
             ph.n_mru = ft.n_mru;
+            // stop compression early once this trial cannot win anymore
+            upx_compress_config_t trial_cconf; trial_cconf.reset();
+            if (cconf)
+                trial_cconf = *cconf;
+            trial_cconf.max_c_len = getTrialBudget(best_ph, best_ph_lsize, best_hdr_c_len, hdr_c_len);
             // compress
-            if (compress(i_ptr, i_len, o_tmp, cconf))
+            if (compress(c_ptr, i_len, o_tmp, &trial_cconf))
             {
                 unsigned lsize = 0;
                 // findOverlapOperhead() might be slow; omit if already too big.
                 if (ph.c_len + lsize + hdr_c_len <= best_ph.c_len + best_ph_lsize + best_hdr_c_len)
                 {
                     // get results
-                    ph.overlap_overhead = findOverlapOverhead(o_tmp, i_ptr, overlap_range);
+                    ph.overlap_overhead = findOverlapOverhead(o_tmp, c_ptr, overlap_range);
                     buildLoader(&ft);
                     lsize = getLoaderSize();
                     assert(lsize > 0);
@@ -1496,22 +1925,7 @@ void Packer::compressWithFilters(upx_bytep i_ptr, unsigned i_len,
                        ph.c_len, lsize, hdr_c_len, ph.c_len + lsize + hdr_c_len,
                        best_ph.c_len, best_ph_lsize, best_hdr_c_len, best_ph.c_len + best_ph_lsize + best_hdr_c_len);
 #endif  //}
-                bool update = false;
-                if (ph.c_len + lsize + hdr_c_len < best_ph.c_len + best_ph_lsize + best_hdr_c_len)
-                    update = true;
-                else if (ph.c_len + lsize + hdr_c_len == best_ph.c_len + best_ph_lsize + best_hdr_c_len)
-                {
-                    // prefer smaller loaders
-                    if (lsize  + hdr_c_len < best_ph_lsize + best_hdr_c_len)
-                        update = true;
-                    else if (lsize + hdr_c_len == best_ph_lsize + best_hdr_c_len)
-                    {
-                        // prefer less overlap_overhead
-                        if (ph.overlap_overhead < best_ph.overlap_overhead)
-                            update = true;
-                    }
-                }
-                if (update)
+                if (isBetterCompression(ph, lsize, hdr_c_len, best_ph, best_ph_lsize, best_hdr_c_len))
                 {
                     assert((int)ph.overlap_overhead > 0);
                     // update o_ptr[] with best version
@@ -1522,16 +1936,19 @@ void Packer::compressWithFilters(upx_bytep i_ptr, unsigned i_len,
                     best_ph_lsize = lsize;
                     best_hdr_c_len = hdr_c_len;
                     best_ft = ft;
+                    best_ft.buf = f_ptr;    // not the scratch copy
                 }
             }
             // restore - unfilter with verify
-            ft.unfilter(f_ptr, f_len, true);
+            if (c_ptr == i_ptr)
+                ft.unfilter(f_ptr, f_len, true);
             if (filter_strategy < 0)
                 break;
         }
         assert(nfilters_success_mm > 0);
     }
 
+done:
     // postconditions 1)
     assert(nfilters_success_total > 0);
     assert(best_ph.u_len == orig_ph.u_len);
@@ -35,6 +35,7 @@ class InputFile;
 class OutputFile;
 class Packer;
 class PackMaster;
+struct PackContext;
 class UiPacker;
 class Filter;
 
@@ -73,6 +74,7 @@ public:
     int filter;
     int filter_cto;
     int n_mru;                  // FIXME: rename to filter_misc
+    int checksum_kind;          // UPX_CHECKSUM_xxx of u_adler and c_adler
     int header_checksum;
 
     // support fields for verifying decompression
@@ -92,6 +94,7 @@ public:
     unsigned max_run_found;
     unsigned first_offset_found;
     //unsigned same_match_offsets_found;
+    upx_uint64_t cache_key;     // see cache.h; 0 if not cached
 
     // info fields set by Packer::compressWithFilters()
     unsigned overlap_overhead;
@@ -102,7 +105,8 @@ bool ph_skipVerify(const PackHeader &ph);
 void ph_decompress(PackHeader &ph, const upx_bytep in, upx_bytep out,
                    bool verify_checksum, Filter *ft);
 bool ph_testOverlappingDecompression(const PackHeader &ph, const upx_bytep buf,
-                                     unsigned overlap_overhead);
+                                     const upx_bytep tbuf, unsigned overlap_overhead);
+unsigned ph_getOverlapOverhead(const PackHeader &ph, const upx_bytep buf);
 
 
 /*************************************************************************
@@ -113,7 +117,7 @@ bool ph_testOverlappingDecompression(const PackHeader &ph, const upx_bytep buf,
 
 class Packer
 {
-    //friend class PackMaster;
+    friend class PackMaster;
     friend class UiPacker;
 protected:
     Packer(InputFile *f);
@@ -171,6 +175,8 @@ protected:
     // main compression drivers
     virtual bool compress(upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
                           const upx_compress_config_t *cconf = NULL);
+    bool compress(PackHeader &xph, upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
+                  const upx_compress_config_t *cconf, upx_callback_p cb) const;
     virtual void decompress(const upx_bytep in, upx_bytep out,
                             bool verify_checksum = true, Filter *ft = NULL);
     virtual bool checkDefaultCompressionRatio(unsigned u_len, unsigned c_len) const;
@@ -260,6 +266,9 @@ protected:
     // filter handling [see packer_f.cpp]
     virtual bool isValidFilter(int filter_id) const;
     virtual void optimizeFilter(Filter *, const upx_byte *, unsigned) const { }
+    int prescreenFilters(int *filters, int nfilters,
+                         upx_bytep f_ptr, unsigned f_len,
+                         const Filter *ft, int keep) const;
     virtual void addFilter32(int filter_id);
     virtual void defineFilterSymbols(const Filter *ft);
 
@@ -314,9 +323,17 @@ protected:
     // UI handler
     UiPacker *uip;
 
+    // set by PackMaster
+    PackContext *ctx;
+
     // linker
     Linker *linker;
 
+private:
+    // private to compressWithFilters()
+    struct CompressTrials;
+    static void compressTrialTask(void *user, unsigned index);
+
 private:
     // private to checkPatch()
     void *last_patch;
@@ -42,6 +42,87 @@ bool Packer::isValidFilter(int filter_id) const
 }
 
 
+/*************************************************************************
+// prescreenFilters - cheaply rank the candidate filters and keep only
+// the "keep" most promising ones (plus the "no filter" fallback).
+// The estimate is a fast NRV2B level 1 compression of a filtered
+// sample of the buffer; filters[] keeps its original order.
+**************************************************************************/
+
+int Packer::prescreenFilters(int *filters, int nfilters,
+                             upx_bytep f_ptr, unsigned f_len,
+                             const Filter *orig_ft, int keep) const
+{
+    if (keep <= 0 || nfilters <= keep + 1 || f_len == 0)
+        return nfilters;
+
+    // sample: up to 16 windows of 16 KiB, evenly spread over the buffer.
+    // Only the windows get filtered, each one into its own part of the
+    // sample, so the rest of the buffer is never touched.
+    unsigned nwin = 16, win_len = 16 * 1024;
+    if (f_len <= nwin * win_len)
+    {
+        nwin = 1;
+        win_len = f_len;
+    }
+    const unsigned s_len = nwin * win_len;
+    MemBuffer sample(s_len);
+    MemBuffer sample_out;
+    sample_out.allocForCompression(s_len);
+
+    unsigned scores[256];
+    for (int i = 0; i < nfilters; i++)
+    {
+        Filter ft = *orig_ft;
+        ft.init(filters[i], orig_ft->addvalue);
+        optimizeFilter(&ft, f_ptr, f_len);
+        unsigned calls = 0, nfiltered = 0;
+        for (unsigned w = 0; w < nwin; w++)
+        {
+            const upx_bytep src = f_ptr + w * (f_len / nwin);
+            Filter wft = ft;
+            if (wft.filter(src, win_len, sample + w * win_len))
+            {
+                calls += wft.calls;
+                nfiltered++;
+            }
+            else
+                memcpy(sample + w * win_len, src, win_len);
+        }
+        if (nfiltered == 0 || (ft.id != 0 && calls == 0))
+        {
+            // filter failed or was useless
+            scores[i] = UINT_MAX;
+            continue;
+        }
+        unsigned c_len = 0;
+        int r = upx_compress(sample, s_len, sample_out, &c_len,
+                             NULL, M_NRV2B_LE32, 1, NULL, NULL);
+        scores[i] = (r == UPX_E_OK) ? c_len : s_len;
+    }
+
+    // keep the "keep" best ones; "no filter" always stays as fallback
+    bool selected[256];
+    for (int i = 0; i < nfilters; i++)
+        selected[i] = (filters[i] == 0);
+    for (int n = 0; n < keep; n++)
+    {
+        int best = -1;
+        for (int i = 0; i < nfilters; i++)
+            if (!selected[i] && scores[i] != UINT_MAX && (best < 0 || scores[i] < scores[best]))
+                best = i;
+        if (best < 0)
+            break;
+        selected[best] = true;
+    }
+    int j = 0;
+    for (int i = 0; i < nfilters; i++)
+        if (selected[i])
+            filters[j++] = filters[i];
+    return j;
+}
+
+
 /*************************************************************************
 // addFilter32
 **************************************************************************/
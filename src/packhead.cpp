@@ -35,7 +35,7 @@
 // least to detect older versions, so this is a little bit messy.
 **************************************************************************/
 
-PackHeader::PackHeader() : version(-1), format(-1) {}
+PackHeader::PackHeader() : version(-1), format(-1), cache_key(0) {}
 
 /*************************************************************************
 // simple checksum for the header itself (since version 10)
@@ -54,6 +54,15 @@ static unsigned char get_packheader_checksum(const upx_bytep buf, int len) {
     return (unsigned char) c;
 }
 
+/*************************************************************************
+// The kind of checksum in u_adler and c_adler is stored in the high
+// nibble of the level byte. Unless it is adler32, bit 6 of the version
+// byte is set as well, so that older versions of UPX refuse the file
+// ("need a newer version of UPX") instead of reporting checksum errors.
+**************************************************************************/
+
+#define VERSION_CHECKSUM_KIND 0x40
+
 /*************************************************************************
 //
 **************************************************************************/
@@ -147,6 +156,12 @@ void PackHeader::putPackHeader(upx_bytep p) {
     p[5] = (unsigned char) format;
     p[6] = (unsigned char) method;
     p[7] = (unsigned char) level;
+    if (checksum_kind != UPX_CHECKSUM_ADLER32) {
+        assert(version < VERSION_CHECKSUM_KIND && level < 16);
+        assert(checksum_kind > 0 && checksum_kind < 8);
+        p[4] |= VERSION_CHECKSUM_KIND;
+        p[7] |= checksum_kind << 4;
+    }
 
     // header_checksum
     assert(size == getPackHeaderSize());
@@ -180,6 +195,14 @@ bool PackHeader::fillPackHeader(const upx_bytep buf, int blen) {
     method = p[6];
     level = p[7];
     filter_cto = 0;
+    checksum_kind = UPX_CHECKSUM_ADLER32;
+    if (version != 0xff && (version & VERSION_CHECKSUM_KIND)) {
+        version &= ~VERSION_CHECKSUM_KIND;
+        checksum_kind = (level >> 4) & 7;
+        level &= 15;
+        if (checksum_kind != UPX_CHECKSUM_CRC32C)
+            throwCantUnpack("unknown checksum");
+    }
 
     if (opt->debug.debug_level) {
         fprintf(stderr, "  fillPackHeader  version=%d  format=%d  method=%d  level=%d\n", version,
@@ -57,23 +57,29 @@
 //
 **************************************************************************/
 
-PackMaster::PackMaster(InputFile *f, options_t *o) : fi(f), p(NULL) {
-    // replace global options with local options
-    saved_opt = o;
-    if (o) {
-        memcpy(&this->local_options, o, sizeof(*o)); // struct copy
-        opt = &this->local_options;
-    }
+PackContext::PackContext(const options_t *o, UiTotals *t, ConsoleCapture *c)
+    : totals(t), capture(c), update_c_len(0), update_u_len(0), update_fc_len(0),
+      update_fu_len(0) {
+    memcpy(&this->options, o, sizeof(*o)); // struct copy
+}
+
+PackMaster::PackMaster(InputFile *f, PackContext *ctx_) : fi(f), p(NULL), ctx(ctx_) {
+    // switch this thread to the context
+    saved_opt = opt;
+    saved_capture = con_capture;
+    opt = &ctx->options;
+    con_capture = ctx->capture;
 }
 
 PackMaster::~PackMaster() {
     fi = NULL;
     delete p;
     p = NULL;
-    // restore global options
-    if (saved_opt)
-        opt = saved_opt;
+    // restore the thread's previous state
+    opt = saved_opt;
+    con_capture = saved_capture;
     saved_opt = NULL;
+    saved_capture = NULL;
 }
 
 /*************************************************************************
@@ -129,22 +135,95 @@ static Packer *try_unpack(Packer *p, void *user) {
     return NULL;
 }
 
+/*************************************************************************
+// magic-byte dispatch
+//
+// The start of the file is classified once, so that visitAllPackers()
+// only has to instantiate the packers which could possibly match.
+// The mask of a packer must cover everything that its canPack() and
+// canUnpack() accept - if in doubt use K_ALL.
+**************************************************************************/
+
+enum {
+    K_EXE = 1 << 0,     // MZ, ZM, BW, LE, PE, PMW1, Adam and i386 COFF
+    K_ELF = 1 << 1,
+    K_MACHO = 1 << 2,   // feedface and feedfacf, both byte orders
+    K_FAT = 1 << 3,     // cafebabe: Mach fat binaries and Java classes
+    K_AOUT = 1 << 4,    // OMAGIC, NMAGIC, ZMAGIC and QMAGIC
+    K_SCRIPT = 1 << 5,  // #!
+    K_TOS = 1 << 6,
+    K_PS1 = 1 << 7,
+    K_BOOT = 1 << 8,    // x86 boot sector (zImage, bzImage)
+    K_ARMZ = 1 << 9,    // ARM zImage
+    K_ALL = 0xffffffff,
+    K_UNIX = K_ELF | K_AOUT | K_SCRIPT | K_FAT
+};
+
+static unsigned getFileKinds(InputFile *f) {
+    if (f == NULL)
+        return K_ALL;
+    unsigned char buf[512];
+    int len;
+    try {
+        f->seek(0, SEEK_SET);
+        len = f->read(buf, sizeof(buf));
+        f->seek(0, SEEK_SET);
+    } catch (const IOException &) {
+        return K_ALL;
+    }
+    if (len < 8) // let the packers complain
+        return K_ALL;
+
+    unsigned kinds = 0;
+    const unsigned le16 = get_le16(buf);
+    const unsigned le32 = get_le32(buf);
+    const unsigned be32 = get_be32(buf);
+    if (le16 == 0x5a4d || le16 == 0x4d5a || le16 == 0x014c || memcmp(buf, "BW", 2) == 0 ||
+        memcmp(buf, "LE", 2) == 0 || memcmp(buf, "PE\0\0", 4) == 0 ||
+        memcmp(buf, "PMW1", 4) == 0 || memcmp(buf, "Adam", 4) == 0)
+        kinds |= K_EXE;
+    if (memcmp(buf, "\x7f\x45\x4c\x46", 4) == 0)
+        kinds |= K_ELF;
+    if (be32 == 0xfeedface || be32 == 0xfeedfacf || le32 == 0xfeedface || le32 == 0xfeedfacf)
+        kinds |= K_MACHO;
+    if (be32 == 0xcafebabe || le32 == 0xcafebabe)
+        kinds |= K_FAT;
+    if (le32 == 0x00640107 || le32 == 0x00640108 || le32 == 0x0064010b || le32 == 0x006400cc)
+        kinds |= K_AOUT;
+    if (memcmp(buf, "#!", 2) == 0)
+        kinds |= K_SCRIPT;
+    if (get_be16(buf) == 0x601a)
+        kinds |= K_TOS;
+    if (memcmp(buf, "PS-X EXE", 8) == 0 || memcmp(buf, "EXE X-SP", 8) == 0)
+        kinds |= K_PS1;
+    if (len >= 512 && get_le16(buf + 510) == 0xaa55)
+        kinds |= K_BOOT;
+    if (le32 == 0xe1a00000 || be32 == 0xe1a00000)
+        kinds |= K_ARMZ;
+    return kinds;
+}
+
 /*************************************************************************
 //
 **************************************************************************/
 
-Packer *PackMaster::visitAllPackers(visit_func_t func, InputFile *f, const options_t *o,
+Packer *PackMaster::visitAllPackers(visit_func_t func, InputFile *f, PackContext *ctx,
                                     void *user) {
+    const options_t *const o = &ctx->options;
+    const unsigned file_kinds = getFileKinds(f);
     Packer *p = NULL;
 
-#define D(Klass)                                                                                   \
+#define D(Klass, kinds)                                                                            \
     ACC_BLOCK_BEGIN                                                                                \
-    Klass *const kp = new Klass(f);                                                                \
-    if (o->debug.debug_level)                                                                      \
-        fprintf(stderr, "visitAllPackers: (ver=%d, fmt=%3d) %s\n", kp->getVersion(),               \
-                kp->getFormat(), #Klass);                                                          \
-    if ((p = func(kp, user)) != NULL)                                                              \
-        return p;                                                                                  \
+    if (file_kinds & (kinds)) {                                                                    \
+        Klass *const kp = new Klass(f);                                                            \
+        kp->ctx = ctx;                                                                             \
+        if (o->debug.debug_level)                                                                  \
+            fprintf(stderr, "visitAllPackers: (ver=%d, fmt=%3d) %s\n", kp->getVersion(),           \
+                    kp->getFormat(), #Klass);                                                      \
+        if ((p = func(kp, user)) != NULL)                                                          \
+            return p;                                                                              \
+    }                                                                                              \
     ACC_BLOCK_END
 
     // note: order of tries is important !
@@ -153,99 +232,99 @@ Packer *PackMaster::visitAllPackers(visit_func_t func, InputFile *f, const optio
     // .exe
     //
     if (!o->dos_exe.force_stub) {
-        D(PackDjgpp2);
-        D(PackTmt);
-        D(PackWcle);
-        D(PackW64Pep);
-        D(PackW32Pe);
+        D(PackDjgpp2, K_EXE);
+        D(PackTmt, K_EXE);
+        D(PackWcle, K_EXE);
+        D(PackW64Pep, K_EXE);
+        D(PackW32Pe, K_EXE);
     }
-    D(PackArmPe);
-    D(PackExe);
+    D(PackArmPe, K_EXE);
+    D(PackExe, K_EXE);
 
     //
     // atari
     //
-    D(PackTos);
+    D(PackTos, K_TOS);
 
     //
     // linux kernel
     //
-    D(PackVmlinuxARMEL);
-    D(PackVmlinuxARMEB);
-    D(PackVmlinuxPPC32);
-    D(PackVmlinuxPPC64LE);
-    D(PackVmlinuxAMD64);
-    D(PackVmlinuxI386);
-    D(PackVmlinuzI386);
-    D(PackBvmlinuzI386);
-    D(PackVmlinuzARMEL);
+    D(PackVmlinuxARMEL, K_ELF);
+    D(PackVmlinuxARMEB, K_ELF);
+    D(PackVmlinuxPPC32, K_ELF);
+    D(PackVmlinuxPPC64LE, K_ELF);
+    D(PackVmlinuxAMD64, K_ELF);
+    D(PackVmlinuxI386, K_ELF);
+    D(PackVmlinuzI386, K_BOOT);
+    D(PackBvmlinuzI386, K_BOOT);
+    D(PackVmlinuzARMEL, K_ARMZ);
 
     //
     // linux
     //
     if (!o->o_unix.force_execve) {
         if (o->o_unix.use_ptinterp) {
-            D(PackLinuxElf32x86interp);
+            D(PackLinuxElf32x86interp, K_ELF);
         }
-        D(PackFreeBSDElf32x86);
-        D(PackNetBSDElf32x86);
-        D(PackOpenBSDElf32x86);
-        D(PackLinuxElf32x86);
-        D(PackLinuxElf64amd);
-        D(PackLinuxElf32armLe);
-        D(PackLinuxElf32armBe);
-        D(PackLinuxElf64arm);
-        D(PackLinuxElf32ppc);
-        D(PackLinuxElf64ppc);
-        D(PackLinuxElf64ppcle);
-        D(PackLinuxElf32mipsel);
-        D(PackLinuxElf32mipseb);
-        D(PackLinuxI386sh);
+        D(PackFreeBSDElf32x86, K_ELF);
+        D(PackNetBSDElf32x86, K_ELF);
+        D(PackOpenBSDElf32x86, K_ELF);
+        D(PackLinuxElf32x86, K_ELF);
+        D(PackLinuxElf64amd, K_ELF);
+        D(PackLinuxElf32armLe, K_ELF);
+        D(PackLinuxElf32armBe, K_ELF);
+        D(PackLinuxElf64arm, K_ELF);
+        D(PackLinuxElf32ppc, K_ELF);
+        D(PackLinuxElf64ppc, K_ELF);
+        D(PackLinuxElf64ppcle, K_ELF);
+        D(PackLinuxElf32mipsel, K_ELF);
+        D(PackLinuxElf32mipseb, K_ELF);
+        D(PackLinuxI386sh, K_UNIX);
     }
-    D(PackBSDI386);
-    D(PackMachFat);   // cafebabe conflict
-    D(PackLinuxI386); // cafebabe conflict
+    D(PackBSDI386, K_UNIX);
+    D(PackMachFat, K_FAT);     // cafebabe conflict
+    D(PackLinuxI386, K_UNIX); // cafebabe conflict
 
     //
     // psone
     //
-    D(PackPs1);
+    D(PackPs1, K_PS1);
 
     //
     // .sys and .com
     //
-    D(PackSys);
-    D(PackCom);
+    D(PackSys, K_ALL);
+    D(PackCom, K_ALL);
 
     // Mach (MacOS X PowerPC)
-    D(PackDylibAMD64);
-    D(PackMachPPC32);
-    D(PackMachPPC64LE);
-    D(PackMachI386);
-    D(PackMachAMD64);
-    D(PackMachARMEL);
-    D(PackMachARM64EL);
+    D(PackDylibAMD64, K_MACHO);
+    D(PackMachPPC32, K_MACHO);
+    D(PackMachPPC64LE, K_MACHO);
+    D(PackMachI386, K_MACHO);
+    D(PackMachAMD64, K_MACHO);
+    D(PackMachARMEL, K_MACHO);
+    D(PackMachARM64EL, K_MACHO);
 
     // 2010-03-12  omit these because PackMachBase<T>::pack4dylib (p_mach.cpp)
     // does not understand what the Darwin (Apple Mac OS X) dynamic loader
     // assumes about .dylib file structure.
-    //   D(PackDylibI386);
-    //   D(PackDylibPPC32);
+    //   D(PackDylibI386, K_MACHO);
+    //   D(PackDylibPPC32, K_MACHO);
 
     return NULL;
 #undef D
 }
 
-Packer *PackMaster::getPacker(InputFile *f) {
-    Packer *pp = visitAllPackers(try_pack, f, opt, f);
+Packer *PackMaster::getPacker(InputFile *f, PackContext *ctx) {
+    Packer *pp = visitAllPackers(try_pack, f, ctx, f);
     if (!pp)
         throwUnknownExecutableFormat();
     pp->assertPacker();
     return pp;
 }
 
-Packer *PackMaster::getUnpacker(InputFile *f) {
-    Packer *pp = visitAllPackers(try_unpack, f, opt, f);
+Packer *PackMaster::getUnpacker(InputFile *f, PackContext *ctx) {
+    Packer *pp = visitAllPackers(try_unpack, f, ctx, f);
     if (!pp)
         throwNotPacked();
     pp->assertPacker();
@@ -257,34 +336,34 @@ Packer *PackMaster::getUnpacker(InputFile *f) {
 **************************************************************************/
 
 void PackMaster::pack(OutputFile *fo) {
-    p = getPacker(fi);
+    p = getPacker(fi, ctx);
     fi = NULL;
     p->doPack(fo);
 }
 
 void PackMaster::unpack(OutputFile *fo) {
-    p = getUnpacker(fi);
+    p = getUnpacker(fi, ctx);
     p->assertPacker();
     fi = NULL;
     p->doUnpack(fo);
 }
 
 void PackMaster::test() {
-    p = getUnpacker(fi);
+    p = getUnpacker(fi, ctx);
     fi = NULL;
     p->doTest();
 }
 
 void PackMaster::list() {
-    p = getUnpacker(fi);
+    p = getUnpacker(fi, ctx);
     fi = NULL;
     p->doList();
 }
 
 void PackMaster::fileInfo() {
-    p = visitAllPackers(try_unpack, fi, opt, fi);
+    p = visitAllPackers(try_unpack, fi, ctx, fi);
     if (!p)
-        p = visitAllPackers(try_pack, fi, opt, fi);
+        p = visitAllPackers(try_pack, fi, ctx, fi);
     if (!p)
         throwUnknownExecutableFormat(NULL, 1); // make a warning here
     p->assertPacker();
@@ -31,14 +31,44 @@
 class Packer;
 class InputFile;
 class OutputFile;
+struct UiTotals;
+
+/*************************************************************************
+// everything that is needed to process one file
+//
+// Contexts do not share any mutable state except for the totals, so
+// independent files can be processed on different threads.
+//
+// Only PackMaster, Packer::ctx and the UI take the context explicitly.
+// The format code, compress.cpp and the filters still read the options
+// through the global "opt", which is per-thread and points into the
+// active context (see PackMaster below); they are not reentrant in any
+// other way, so e.g. one thread cannot interleave two files.
+**************************************************************************/
+
+struct PackContext {
+    explicit PackContext(const options_t *o, UiTotals *t = NULL, ConsoleCapture *c = NULL);
+
+    options_t options;          // private copy of the options
+    UiTotals *totals;           // may be shared by several contexts, or NULL
+    ConsoleCapture *capture;    // if set, all output goes here
+    // the sizes of the file, see UiPacker::uiConfirmUpdate()
+    unsigned update_c_len;
+    unsigned update_u_len;
+    unsigned update_fc_len;
+    unsigned update_fu_len;
+};
 
 /*************************************************************************
 // interface for work.cpp
+//
+// While a PackMaster exists "opt" and "con_capture" of the current
+// thread refer to its context.
 **************************************************************************/
 
 class PackMaster {
 public:
-    PackMaster(InputFile *f, options_t *o = NULL);
+    PackMaster(InputFile *f, PackContext *ctx);
     virtual ~PackMaster();
 
     void pack(OutputFile *fo);
@@ -48,18 +78,19 @@ public:
     void fileInfo();
 
     typedef Packer *(*visit_func_t)(Packer *p, void *user);
-    static Packer *visitAllPackers(visit_func_t, InputFile *f, const options_t *, void *user);
+    static Packer *visitAllPackers(visit_func_t, InputFile *f, PackContext *ctx, void *user);
 
 private:
     InputFile *fi;
     Packer *p;
+    PackContext *ctx;
 
-    static Packer *getPacker(InputFile *f);
-    static Packer *getUnpacker(InputFile *f);
+    static Packer *getPacker(InputFile *f, PackContext *ctx);
+    static Packer *getUnpacker(InputFile *f, PackContext *ctx);
 
-    // setup local options for each file
-    options_t local_options;
+    // the thread's previous state
     options_t *saved_opt;
+    ConsoleCapture *saved_capture;
 };
 
 #endif /* already included */
@@ -755,6 +755,7 @@ public:
             osize += sections[ic]->size;
         output = New(upx_byte, osize);
         outputlen = 0;
+        output_capacity = osize;
 
         // sort the sections by name before adding them all
         qsort(sections, nsections, sizeof (Section*), ImportLinker::compare);
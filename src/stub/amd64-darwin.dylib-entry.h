@@ -1,5 +1,5 @@
 /* amd64-darwin.dylib-entry.h
-   created from amd64-darwin.dylib-entry.bin, 9507 (0x2523) bytes
+   created from amd64-darwin.dylib-entry.bin, 7074 (0x1ba2) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_DARWIN_DYLIB_ENTRY_SIZE    9507
-#define STUB_AMD64_DARWIN_DYLIB_ENTRY_ADLER32 0xa53ac8b4
-#define STUB_AMD64_DARWIN_DYLIB_ENTRY_CRC32   0xea0b4ebf
+#define STUB_AMD64_DARWIN_DYLIB_ENTRY_SIZE    7074
+#define STUB_AMD64_DARWIN_DYLIB_ENTRY_ADLER32 0xf0c46bec
+#define STUB_AMD64_DARWIN_DYLIB_ENTRY_CRC32   0x812d48c4
 
-unsigned char stub_amd64_darwin_dylib_entry[9507] = {
+unsigned char stub_amd64_darwin_dylib_entry[7074] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0, 32, 25,  0,  0,  0,  0,  0,  0,
@@ -427,208 +427,56 @@ unsigned char stub_amd64_darwin_dylib_entry[9507] = {
 /* 0x1840 */  86, 94,172, 60,128,114, 10, 60,143,119,  6,128,126,254, 15,116,
 /* 0x1850 */   6, 44,232, 60,  1,119,228, 72, 57,206,115, 22, 86,173, 40,208,
 /* 0x1860 */ 117,223, 95, 15,200, 41,248,  1,216,171, 72, 57,206,115,  3,172,
-/* 0x1870 */ 235,223, 91,195,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1880 */ 101,108,102, 54, 52, 45,120, 56, 54, 45, 54, 52, 10, 10, 83,101,
-/* 0x1890 */  99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101,
-/* 0x18a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32,
-/* 0x18b0 */  32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18c0 */  32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18d0 */  32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102,
-/* 0x18e0 */  32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32,
-/* 0x18f0 */  48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32,
-/* 0x1900 */  48, 48, 48, 48, 48, 48, 49,100, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1920 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1930 */  48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1940 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1950 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95,
-/* 0x1960 */  72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1970 */  54, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53,100,
-/* 0x19a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x19b0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78,
-/* 0x19c0 */  82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x19d0 */  48, 48, 48, 98, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1a00 */  48, 99, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1a10 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1a20 */  79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32,
-/* 0x1a30 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 97, 49, 32,
-/* 0x1a40 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55,100, 32, 32, 50,
-/* 0x1a70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1a80 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1a90 */  32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1aa0 */  32, 48, 48, 48, 48, 48, 48, 57, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 50, 49,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1ae0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1af0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76, 90, 77,
-/* 0x1b00 */  65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 54, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 98,
-/* 0x1b40 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1b50 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1b60 */  76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x1b70 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102, 55, 32, 32, 48,
-/* 0x1b80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b90 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 53, 32, 32, 50, 42, 42,
-/* 0x1bb0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1bc0 */  68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1bd0 */  69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102, 55,
-/* 0x1be0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 48, 99, 32, 32,
-/* 0x1c10 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1c20 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77,
-/* 0x1c30 */  65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c40 */  48, 49, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 48,
-/* 0x1c70 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c80 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32,
-/* 0x1c90 */  78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1cd0 */  49, 55, 49, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1ce0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1cf0 */  49, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 32, 32, 32,
-/* 0x1d00 */  32, 48, 48, 48, 48, 48, 48, 49, 49, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d30 */  48, 48, 48, 49, 55, 49, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1d40 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1d50 */  89, 10, 32, 49, 49, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 32,
-/* 0x1d60 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 52, 56, 32, 32, 48, 48,
-/* 0x1d70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  32, 32, 48, 48, 48, 48, 49, 55, 50, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1da0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1db0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66,
-/* 0x1dc0 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1de0 */ 100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x1e00 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1e20 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1e40 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x1e60 */  65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65,
-/* 0x1e80 */  73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67,
-/* 0x1ea0 */  72, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x1ec0 */  90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77,
-/* 0x1ee0 */  65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 10,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f10 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48,
-/* 0x1f20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f30 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1f50 */  82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1f80 */  32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x1fa0 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1fc0 */  69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1fe0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2000 */  68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x2020 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2040 */  68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2060 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84,
-/* 0x2080 */  65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103,
-/* 0x20b0 */  32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88,
-/* 0x20c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20d0 */  48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 48, 48, 49, 49, 32,103, 32, 32, 32, 32, 32,
-/* 0x20f0 */  32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48,
-/* 0x2100 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,110,100,
-/* 0x2110 */  95,100,101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76,
-/* 0x2120 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x2130 */  70, 79, 82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78, 88, 93, 58,
-/* 0x2140 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2150 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2160 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 88, 56, 54,
-/* 0x2180 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 77, 65, 67,
-/* 0x2190 */  72, 77, 65, 73, 78, 90, 43, 48,120,102,102,102,102,102,102,102,
-/* 0x21a0 */ 102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67,
-/* 0x21b0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x21c0 */  82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x21d0 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x21e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x21f0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 97,102, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x2210 */  51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43,
-/* 0x2220 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 53, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x2250 */  50, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 43,
-/* 0x2260 */  48,120,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x2270 */ 102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x2280 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50,
-/* 0x2290 */  68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32,
-/* 0x22a0 */  32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x22c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 54, 32, 82, 95,
-/* 0x22d0 */  88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x22e0 */  78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48,
-/* 0x22f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 88,
-/* 0x2310 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 77,
-/* 0x2320 */  65, 67, 72, 77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,102,
-/* 0x2330 */ 102,102,102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76,
-/* 0x2340 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x2350 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70,
-/* 0x2360 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x2370 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2380 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 48, 48, 56, 98, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x23a0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x23b0 */  68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23c0 */  48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 48, 53, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80,
-/* 0x23e0 */  67, 51, 50, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x23f0 */  89, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x2400 */ 102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2410 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x2420 */  77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2430 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2440 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2450 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x2470 */  51, 50, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x2480 */  48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2490 */  48, 48, 49, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x24a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77, 65,
-/* 0x24b0 */  67, 72, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x24c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x24d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x24e0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24f0 */  48, 49, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32,
-/* 0x2500 */  32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 43,
-/* 0x2510 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x2520 */  52, 99, 10
+/* 0x1870 */ 235,223, 91,195, 12,  0,  0,  0, 14,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1880 */ 136,  2,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 29,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0, 10,  0,  0,  0, 93,  0,  0,  0,102,  0,  0,  0,
+/* 0x18a0 */   0,  0,  0,  0, 19,  0,  0,  0,195,  0,  0,  0,186,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0, 25,  0,  0,  0,125,  1,  0,  0,161,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0, 31,  0,  0,  0, 30,  2,  0,  0,147,  0,  0,  0,
+/* 0x18d0 */   0,  0,  0,  0, 37,  0,  0,  0,177,  2,  0,  0,100,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0, 48,  0,  0,  0, 21,  3,  0,  0,247,  9,  0,  0,
+/* 0x18f0 */   0,  0,  0,  0, 59,  0,  0,  0, 12, 13,  0,  0,247,  9,  0,  0,
+/* 0x1900 */   0,  0,  0,  0, 70,  0,  0,  0,  3, 23,  0,  0, 24,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0, 81,  0,  0,  0, 27, 23,  0,  0,  0,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0, 90,  0,  0,  0, 27, 23,  0,  0, 17,  0,  0,  0,
+/* 0x1930 */   0,  0,  0,  0,100,  0,  0,  0, 44, 23,  0,  0, 72,  1,  0,  0,
+/* 0x1940 */   0,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1950 */   0,  0,  0,  0, 70,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */   0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,100,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */   0,  0,  0,  0, 19,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0, 25,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0, 31,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0, 37,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0, 48,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0, 59,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0, 81,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,117,  0,  0,  0, 10,  0,  0,  0, 17,  0,  0,  0,
+/* 0x1a20 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,132,  0,  0,  0,
+/* 0x1a30 */   3,  0,  0,  0,252,255,255,255,255,255,255,255,  2,  0,  0,  0,
+/* 0x1a40 */ 175,  0,  0,  0,132,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1a50 */   0,  0,  0,  0,  2,  0,  0,  0, 92,  0,  0,  0,132,  0,  0,  0,
+/* 0x1a60 */   2,  0,  0,  0,252,255,255,255,255,255,255,255,  3,  0,  0,  0,
+/* 0x1a70 */ 150,  0,  0,  0,132,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  3,  0,  0,  0, 92,  0,  0,  0,132,  0,  0,  0,
+/* 0x1a90 */   2,  0,  0,  0,252,255,255,255,255,255,255,255,  4,  0,  0,  0,
+/* 0x1aa0 */ 139,  0,  0,  0,132,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  4,  0,  0,  0, 83,  0,  0,  0,132,  0,  0,  0,
+/* 0x1ac0 */   2,  0,  0,  0,252,255,255,255,255,255,255,255,  5,  0,  0,  0,
+/* 0x1ad0 */   6,  0,  0,  0,132,  0,  0,  0,  1,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1ae0 */   0,  0,  0,  0, 11,  0,  0,  0, 28,  0,  0,  0,146,  0,  0,  0,
+/* 0x1af0 */   3,  0,  0,  0, 76,  1,  0,  0,  0,  0,  0,  0, 77, 65, 67, 72,
+/* 0x1b00 */  77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78,
+/* 0x1b10 */  82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,
+/* 0x1b20 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x1b30 */  95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50,
+/* 0x1b40 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86,
+/* 0x1b50 */  95, 84, 65, 73, 76,  0, 77, 65, 67, 72, 77, 65, 73, 78, 89,  0,
+/* 0x1b60 */  77, 65, 67, 72, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,
+/* 0x1b70 */   0,101,110,100, 95,100,101, 99,111,109,112,114,101,115,115,  0,
+/* 0x1b80 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,  0, 82, 95,
+/* 0x1b90 */  88, 56, 54, 95, 54, 52, 95, 51, 50,  0,116, 24,  0,  0, 85, 80,
+/* 0x1ba0 */  88, 76
 };
@@ -1,5 +1,5 @@
 /* amd64-linux.elf-entry.h
-   created from amd64-linux.elf-entry.bin, 9547 (0x254b) bytes
+   created from amd64-linux.elf-entry.bin, 7026 (0x1b72) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_ELF_ENTRY_SIZE    9547
-#define STUB_AMD64_LINUX_ELF_ENTRY_ADLER32 0x2d4db3d3
-#define STUB_AMD64_LINUX_ELF_ENTRY_CRC32   0x3ab292c4
+#define STUB_AMD64_LINUX_ELF_ENTRY_SIZE    7026
+#define STUB_AMD64_LINUX_ELF_ENTRY_ADLER32 0x20be40be
+#define STUB_AMD64_LINUX_ELF_ENTRY_CRC32   0x8dcedc58
 
-unsigned char stub_amd64_linux_elf_entry[9547] = {
+unsigned char stub_amd64_linux_elf_entry[7026] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,224, 24,  0,  0,  0,  0,  0,  0,
@@ -423,214 +423,57 @@ unsigned char stub_amd64_linux_elf_entry[9547] = {
 /* 0x1800 */  73,137,213,173, 80,173, 65,144, 72,137,247, 94,255,213, 89, 94,
 /* 0x1810 */  95, 93,106,  5, 90,106, 10, 88, 15,  5, 65,255,229, 93,232, 60,
 /* 0x1820 */ 255,255,255, 47,112,114,111, 99, 47,115,101,108,102, 47,101,120,
-/* 0x1830 */ 101,  0,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x1840 */ 116, 32,101,108,102, 54, 52, 45,120, 56, 54, 45, 54, 52, 10, 10,
-/* 0x1850 */  83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,
-/* 0x1860 */ 109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101,
-/* 0x1870 */  32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1880 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1890 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,
-/* 0x18a0 */ 102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10,
-/* 0x18b0 */  32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32,
-/* 0x18c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48,
-/* 0x18d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x18e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x18f0 */  48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1900 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1910 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82,
-/* 0x1920 */  86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1930 */  48, 48, 54, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1950 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1960 */  52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1970 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50,
-/* 0x1980 */  32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 98, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x19c0 */  48, 48, 48, 98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x19d0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x19e0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68,
-/* 0x19f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 97,
-/* 0x1a00 */  49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 54,102, 32,
-/* 0x1a30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1a40 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1a50 */  10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32,
-/* 0x1a60 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 51, 32, 32, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1a80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1a90 */  32, 48, 48, 48, 48, 48, 50, 49, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1aa0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1ab0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76,
-/* 0x1ac0 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1ad0 */  48, 48, 48, 54, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1b00 */  50, 97, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1b10 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1b20 */  79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1b30 */  67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102, 55, 32,
-/* 0x1b40 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b60 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48, 55, 32, 32, 50,
-/* 0x1b70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1b80 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65,
-/* 0x1b90 */  95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,
-/* 0x1ba0 */ 102, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 99,102,101,
-/* 0x1bd0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1be0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76,
-/* 0x1bf0 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1c00 */  48, 48, 48, 49, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x1c30 */  54,102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1c40 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1c50 */  57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1c80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1c90 */  48, 48, 49, 55, 48,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1ca0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1cb0 */  10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32,
-/* 0x1cc0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 51, 97, 32, 32, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1cf0 */  32, 48, 48, 48, 48, 49, 55, 48,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1d00 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1d10 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69,
-/* 0x1d20 */  76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1d30 */  48, 48, 48,101,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x1d60 */  55, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d70 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1d80 */  79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76,
-/* 0x1d90 */  69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95,
-/* 0x1db0 */  72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1de0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1df0 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e20 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1e30 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1e60 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76,
-/* 0x1e80 */  70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1ea0 */  69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1ec0 */  78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1ee0 */  69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ef0 */  48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1f10 */  32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1f30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f40 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48,
-/* 0x1f50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1f60 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1f80 */  77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69,
-/* 0x1fa0 */  76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1fc0 */  77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1fe0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x2000 */  77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2020 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x2040 */  86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2060 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x2080 */  78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x20b0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x20c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79, 95, 66, 73, 78,
-/* 0x20d0 */  70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x20e0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77,
-/* 0x20f0 */  65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2100 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2110 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2120 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x2130 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x2140 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,100, 50, 10, 10,
-/* 0x2160 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2170 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10,
-/* 0x2180 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2190 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21a0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21b0 */  48, 48, 48, 48, 48, 48, 48, 97,102, 32, 82, 95, 88, 56, 54, 95,
-/* 0x21c0 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x21d0 */  72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21f0 */  48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x2200 */  52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x2210 */  73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,102,102,102,
-/* 0x2220 */ 102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2230 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2240 */  78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2250 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2260 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2270 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57,
-/* 0x2280 */  54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32,
-/* 0x2290 */  32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48,
-/* 0x22a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 99,
-/* 0x22c0 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x22d0 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 43, 48,120,102,102,
-/* 0x22e0 */ 102,102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10,
-/* 0x22f0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2300 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10,
-/* 0x2310 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2320 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2330 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 48, 48, 56, 98, 32, 82, 95, 88, 56, 54, 95,
-/* 0x2350 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x2360 */  72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2370 */  48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2380 */  48, 48, 48, 48, 48, 48, 53, 51, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x2390 */  52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x23a0 */  73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,102,102,102,
-/* 0x23b0 */ 102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x23c0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x23d0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x23e0 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x23f0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2400 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2410 */  48, 48, 48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x2420 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2430 */  67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2440 */  48, 48, 48, 48, 49, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2450 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2460 */  69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2470 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2480 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2490 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24a0 */  48, 48, 49, 56, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x24b0 */  51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43,
-/* 0x24c0 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x24e0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77,
-/* 0x24f0 */  65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2500 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,101, 98,
-/* 0x2530 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32, 32,
-/* 0x2540 */  32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1830 */ 101,  0,  0,  0,  0,  0, 12,  0,  0,  0, 14,  0,  0,  0, 10,  0,
+/* 0x1840 */   0,  0,160,  2,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 15,  0,
+/* 0x1850 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 79,  0,  0,  0,102,  0,
+/* 0x1860 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0,181,  0,  0,  0,186,  0,
+/* 0x1870 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,111,  1,  0,  0,161,  0,
+/* 0x1880 */   0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 16,  2,  0,  0,147,  0,
+/* 0x1890 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,163,  2,  0,  0,100,  0,
+/* 0x18a0 */   0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  7,  3,  0,  0,247,  9,
+/* 0x18b0 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,254, 12,  0,  0,247,  9,
+/* 0x18c0 */   0,  0,  0,  0,  0,  0, 69,  0,  0,  0,245, 22,  0,  0, 24,  0,
+/* 0x18d0 */   0,  0,  0,  0,  0,  0, 80,  0,  0,  0, 13, 23,  0,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 13, 23,  0,  0, 58,  0,
+/* 0x18f0 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 71, 23,  0,  0,239,  0,
+/* 0x1900 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x1930 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1950 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1960 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1990 */   0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,114,  0,  0,  0, 13,  0,  0,  0,173,222,
+/* 0x19e0 */ 173,222,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,122,  0,
+/* 0x19f0 */   0,  0,  3,  0,  0,  0,210,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+/* 0x1a00 */   0,  0,175,  0,  0,  0,122,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 92,  0,  0,  0,122,  0,
+/* 0x1a20 */   0,  0,  2,  0,  0,  0,252,255,255,255,255,255,255,255,  3,  0,
+/* 0x1a30 */   0,  0,150,  0,  0,  0,122,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 92,  0,  0,  0,122,  0,
+/* 0x1a50 */   0,  0,  2,  0,  0,  0,252,255,255,255,255,255,255,255,  4,  0,
+/* 0x1a60 */   0,  0,139,  0,  0,  0,122,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 83,  0,  0,  0,122,  0,
+/* 0x1a80 */   0,  0,  2,  0,  0,  0,252,255,255,255,255,255,255,255,  5,  0,
+/* 0x1a90 */   0,  0,  6,  0,  0,  0,122,  0,  0,  0,  1,  0,  0,  0, 18,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 24,  0,  0,  0,122,  0,
+/* 0x1ab0 */   0,  0,  3,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x1ac0 */   0,  0,235,  0,  0,  0,136,  0,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78,
+/* 0x1ae0 */  82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82,
+/* 0x1af0 */  86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69,
+/* 0x1b00 */  76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0,
+/* 0x1b10 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95,
+/* 0x1b20 */  68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 69,
+/* 0x1b30 */  76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,
+/* 0x1b40 */   0, 95,115,116, 97,114,116,  0, 79, 95, 66, 73, 78, 70, 79,  0,
+/* 0x1b50 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,  0, 82, 95,
+/* 0x1b60 */  88, 56, 54, 95, 54, 52, 95, 51, 50,  0, 54, 24,  0,  0, 85, 80,
+/* 0x1b70 */  88, 76
 };
@@ -1,5 +1,5 @@
 /* amd64-linux.shlib-init.h
-   created from amd64-linux.shlib-init.bin, 9569 (0x2561) bytes
+   created from amd64-linux.shlib-init.bin, 7171 (0x1c03) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_SHLIB_INIT_SIZE    9569
-#define STUB_AMD64_LINUX_SHLIB_INIT_ADLER32 0x5cfdec03
-#define STUB_AMD64_LINUX_SHLIB_INIT_CRC32   0x7b17ca0f
+#define STUB_AMD64_LINUX_SHLIB_INIT_SIZE    7171
+#define STUB_AMD64_LINUX_SHLIB_INIT_ADLER32 0x116698bb
+#define STUB_AMD64_LINUX_SHLIB_INIT_CRC32   0x3d14796e
 
-unsigned char stub_amd64_linux_shlib_init[9569] = {
+unsigned char stub_amd64_linux_shlib_init[7171] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,168, 25,  0,  0,  0,  0,  0,  0,
@@ -436,203 +436,53 @@ unsigned char stub_amd64_linux_shlib_init[9569] = {
 /* 0x18d0 */   2,243,165, 94, 89, 81, 87,131,193,  3,193,233,  2,243,165, 72,
 /* 0x18e0 */ 139,117,168, 72,137,125,168,139, 78,252,243,164, 72,139,117,208,
 /* 0x18f0 */  72,137,125,208,139, 78,252,243,164, 72,137,198, 87,139, 78,252,
-/* 0x1900 */ 243,164,195,102,105,108,101, 32,102,111,114,109, 97,116, 32,101,
-/* 0x1910 */ 108,102, 54, 52, 45,120, 56, 54, 45, 54, 52, 10, 10, 83,101, 99,
-/* 0x1920 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x1930 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x1940 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1950 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1960 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x1970 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x1980 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x19c0 */  48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x19d0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x19e0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72,
-/* 0x19f0 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1a00 */  54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 54, 32,
-/* 0x1a30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1a40 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82,
-/* 0x1a50 */  86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1a60 */  48, 48, 98, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1a90 */  98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1aa0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1ab0 */  78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32, 32,
-/* 0x1ac0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 97, 49, 32, 32,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ae0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 54, 32, 32, 50, 42,
-/* 0x1b00 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1b10 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1b20 */  52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 57, 51, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1b50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1b60 */  48, 48, 48, 50, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1b70 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1b80 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76, 90, 77, 65,
-/* 0x1b90 */  95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  54, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 97, 97,
-/* 0x1bd0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1be0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1bf0 */  89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1c00 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102, 55, 32, 32, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  32, 32, 48, 48, 48, 48, 48, 51, 48,101, 32, 32, 50, 42, 42, 48,
-/* 0x1c40 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1c50 */  79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1c60 */  67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102, 55, 32,
-/* 0x1c70 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 48, 53, 32, 32, 50,
-/* 0x1ca0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1cb0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65,
-/* 0x1cc0 */  95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1cd0 */  49, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 54,102, 99,
-/* 0x1d00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1d10 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78,
-/* 0x1d20 */  82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1d30 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x1d60 */  55, 49, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d70 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1d80 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32,
-/* 0x1d90 */  48, 48, 48, 48, 48, 48, 51, 97, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1dc0 */  48, 48, 49, 55, 49, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1dd0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1de0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77,
-/* 0x1df0 */  65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1e00 */  98, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 52,101,
-/* 0x1e30 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1e40 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79,
-/* 0x1e50 */  76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1e70 */  32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95,
-/* 0x1e90 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1eb0 */  77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1ed0 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x1ef0 */  70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1f10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1f30 */  78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x1f50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1f60 */  32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f80 */  69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1fa0 */  32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1fd0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1ff0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x2010 */  86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2040 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2060 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2080 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48,
-/* 0x2090 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x20a0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x20c0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48,
-/* 0x20d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x20e0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2100 */  32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x2120 */  86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2140 */  69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116,
-/* 0x2160 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2170 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73,
-/* 0x2180 */  78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x21a0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x21b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82,
-/* 0x21c0 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x21d0 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,100, 10, 10, 82, 69,
-/* 0x21f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2200 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70,
-/* 0x2210 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x2220 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2230 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 48, 97,102, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x2250 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69,
-/* 0x2260 */  65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x2290 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x22a0 */  89, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x22b0 */ 102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x22c0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x22d0 */  86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x22e0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x22f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 54, 32,
-/* 0x2310 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x2320 */  32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82,
-/* 0x2350 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x2360 */  32, 69, 76, 70, 77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,
-/* 0x2370 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69,
-/* 0x2380 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2390 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70,
-/* 0x23a0 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x23b0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23c0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48, 48, 56, 98, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x23e0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69,
-/* 0x23f0 */  65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2400 */  48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2410 */  48, 48, 48, 48, 53, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x2420 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2430 */  89, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x2440 */ 102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2450 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x2460 */  77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2470 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2480 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2490 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24a0 */  48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x24b0 */  51, 50, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x24c0 */  48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 48, 49, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x24e0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76,
-/* 0x24f0 */  70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x2500 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x2510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2520 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2530 */  49, 56, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x2540 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120,
-/* 0x2550 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x2560 */  10
+/* 0x1900 */ 243,164,195, 12,  0,  0,  0, 13,  0,  0,  0,  9,  0,  0,  0,120,
+/* 0x1910 */   2,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 22,  0,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  9,  0,  0,  0, 86,  0,  0,  0,102,  0,  0,  0,  0,
+/* 0x1930 */   0,  0,  0, 18,  0,  0,  0,188,  0,  0,  0,186,  0,  0,  0,  0,
+/* 0x1940 */   0,  0,  0, 24,  0,  0,  0,118,  1,  0,  0,161,  0,  0,  0,  0,
+/* 0x1950 */   0,  0,  0, 30,  0,  0,  0, 23,  2,  0,  0,147,  0,  0,  0,  0,
+/* 0x1960 */   0,  0,  0, 36,  0,  0,  0,170,  2,  0,  0,100,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0, 47,  0,  0,  0, 14,  3,  0,  0,247,  9,  0,  0,  0,
+/* 0x1980 */   0,  0,  0, 58,  0,  0,  0,  5, 13,  0,  0,247,  9,  0,  0,  0,
+/* 0x1990 */   0,  0,  0, 69,  0,  0,  0,252, 22,  0,  0, 24,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0, 80,  0,  0,  0, 20, 23,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0, 89,  0,  0,  0, 20, 23,  0,  0, 58,  0,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0, 98,  0,  0,  0, 78, 23,  0,  0,181,  1,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */   0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,114,  0,  0,  0,  3,
+/* 0x1ab0 */   0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,175,
+/* 0x1ac0 */   0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  2,  0,  0,  0, 92,  0,  0,  0,114,  0,  0,  0,  2,
+/* 0x1ae0 */   0,  0,  0,252,255,255,255,255,255,255,255,  3,  0,  0,  0,150,
+/* 0x1af0 */   0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  3,  0,  0,  0, 92,  0,  0,  0,114,  0,  0,  0,  2,
+/* 0x1b10 */   0,  0,  0,252,255,255,255,255,255,255,255,  4,  0,  0,  0,139,
+/* 0x1b20 */   0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  4,  0,  0,  0, 83,  0,  0,  0,114,  0,  0,  0,  2,
+/* 0x1b40 */   0,  0,  0,252,255,255,255,255,255,255,255,  5,  0,  0,  0,  6,
+/* 0x1b50 */   0,  0,  0,114,  0,  0,  0,  1,  0,  0,  0, 18,  0,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0, 10,  0,  0,  0, 24,  0,  0,  0,114,  0,  0,  0,  3,
+/* 0x1b70 */   0,  0,  0,252,255,255,255,255,255,255,255, 69, 76, 70, 77, 65,
+/* 0x1b80 */  73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86,
+/* 0x1b90 */  50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76,
+/* 0x1ba0 */  90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x1bb0 */  69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0,
+/* 0x1bc0 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 84,
+/* 0x1bd0 */  65, 73, 76,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70,
+/* 0x1be0 */  77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0, 82, 95, 88,
+/* 0x1bf0 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50,  0,  3, 25,  0,  0, 85,
+/* 0x1c00 */  80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* amd64-win64.pep.h
-   created from amd64-win64.pep.bin, 21047 (0x5237) bytes
+   created from amd64-win64.pep.bin, 10561 (0x2941) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_WIN64_PEP_SIZE    21047
-#define STUB_AMD64_WIN64_PEP_ADLER32 0xf6019eac
-#define STUB_AMD64_WIN64_PEP_CRC32   0x49c903ee
+#define STUB_AMD64_WIN64_PEP_SIZE    10561
+#define STUB_AMD64_WIN64_PEP_ADLER32 0x8ea99e7e
+#define STUB_AMD64_WIN64_PEP_CRC32   0x2277bbfd
 
-unsigned char stub_amd64_win64_pep[21047] = {
+unsigned char stub_amd64_win64_pep[10561] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,168, 27,  0,  0,  0,  0,  0,  0,
@@ -440,916 +440,261 @@ unsigned char stub_amd64_win64_pep[21047] = {
 /* 0x1910 */  81, 82, 65, 80, 72,131,236, 40,255,208, 72,131,196, 40, 65, 88,
 /* 0x1920 */  90, 89,235,229, 94,195, 85, 80, 88, 33,161,216,208,213,  0,  0,
 /* 0x1930 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x1940 */   0,  0,  0,  0,  0, 45,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x1950 */ 116, 32,101,108,102, 54, 52, 45,120, 56, 54, 45, 54, 52, 10, 10,
-/* 0x1960 */  83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,
-/* 0x1970 */ 109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101,
-/* 0x1980 */  32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1990 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32,
-/* 0x19a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,
-/* 0x19b0 */ 102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10,
-/* 0x19c0 */  32, 32, 48, 32, 83, 84, 65, 82, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x19d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1a00 */  48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1a10 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1a20 */  76, 89, 10, 32, 32, 49, 32, 80, 69, 73, 83, 68, 76, 76, 48, 32,
-/* 0x1a30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48,
-/* 0x1a40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1a50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a60 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x1a70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1a80 */  68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 80, 69, 73, 83, 68, 76,
-/* 0x1a90 */  76, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57,
-/* 0x1aa0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52,102, 32, 32,
-/* 0x1ad0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1ae0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1af0 */  32, 32, 51, 32, 80, 69, 77, 65, 73, 78, 48, 49, 32, 32, 32, 32,
-/* 0x1b00 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 50, 32, 32, 48, 48, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1b20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 53, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1b40 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1b50 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 80, 69,
-/* 0x1b60 */  73, 67, 79, 78, 83, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1bb0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1bc0 */  78, 76, 89, 10, 32, 32, 53, 32, 80, 69, 73, 67, 79, 78, 83, 50,
-/* 0x1bd0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32,
-/* 0x1be0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c00 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 49, 32, 32, 50, 42,
-/* 0x1c10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1c20 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1c30 */  54, 32, 80, 69, 84, 76, 83, 72, 65, 75, 32, 32, 32, 32, 32, 32,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1c70 */  48, 48, 48, 48, 55, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1c80 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1c90 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 80, 69, 77, 65,
-/* 0x1ca0 */  73, 78, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 97,
-/* 0x1ce0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1cf0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 80,
-/* 0x1d00 */  69, 77, 65, 73, 78, 48, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1d10 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d50 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1d60 */  57, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32,
-/* 0x1d70 */  48, 48, 48, 48, 48, 48, 54, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1db0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1dc0 */  10, 32, 49, 48, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32,
-/* 0x1dd0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 56, 51, 32, 32, 48, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e00 */  32, 48, 48, 48, 48, 48, 48,101, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1e10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1e20 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 78,
-/* 0x1e30 */  82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1e40 */  48, 48, 48, 57, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e70 */  49, 54,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e80 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1e90 */  79, 78, 76, 89, 10, 32, 49, 50, 32, 78, 82, 86, 50, 69, 32, 32,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 97, 97, 32,
-/* 0x1eb0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102,102, 32, 32, 50,
-/* 0x1ee0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1ef0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1f00 */  49, 51, 32, 76, 90, 77, 65, 95, 72, 69, 65, 68, 32, 32, 32, 32,
-/* 0x1f10 */  32, 48, 48, 48, 48, 48, 48, 49, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1f30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1f40 */  48, 48, 48, 48, 50, 97, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1f50 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1f60 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 52, 32, 76, 90, 77,
-/* 0x1f70 */  65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1f80 */  48, 53, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 98,
-/* 0x1fb0 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1fc0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53, 32,
-/* 0x1fd0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 57,102, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2010 */  48, 51, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2020 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2030 */  49, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32,
-/* 0x2040 */  32, 48, 48, 48, 48, 48, 57,102, 55, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2060 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2070 */  48, 48, 48, 48,100, 48,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2080 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2090 */  89, 10, 32, 49, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x20a0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 52, 32, 32, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x20c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20d0 */  32, 32, 48, 48, 48, 48, 49, 55, 48, 53, 32, 32, 50, 42, 42, 48,
-/* 0x20e0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x20f0 */  79, 78, 76, 89, 10, 32, 49, 56, 32, 76, 90, 77, 65, 95, 84, 65,
-/* 0x2100 */  73, 76, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x2110 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2120 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 49, 57, 32, 32, 50,
-/* 0x2140 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2150 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 57, 32, 80, 69, 77, 65,
-/* 0x2160 */  73, 78, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2180 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 49, 98,
-/* 0x21a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x21b0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 48, 32, 80,
-/* 0x21c0 */  69, 84, 76, 83, 72, 65, 75, 50, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x2200 */  55, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2210 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50,
-/* 0x2220 */  49, 32, 80, 69, 67, 84, 84, 80, 79, 83, 32, 32, 32, 32, 32, 32,
-/* 0x2230 */  48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2250 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2260 */  48, 48, 49, 55, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2270 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2280 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 50, 32, 80, 69, 67, 84,
-/* 0x2290 */  84, 78, 85, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x22a0 */  48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22c0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 50, 55,
-/* 0x22d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x22e0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 51, 32, 80,
-/* 0x22f0 */  69, 70, 73, 76, 84, 69, 82, 52, 57, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 53, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2320 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x2330 */  55, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2340 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2350 */  79, 78, 76, 89, 10, 32, 50, 52, 32, 80, 69, 73, 77, 80, 79, 82,
-/* 0x2360 */  84, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32,
-/* 0x2370 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2380 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 55, 99, 32, 32, 50,
-/* 0x23a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x23b0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x23c0 */  50, 53, 32, 80, 69, 73, 66, 89, 79, 82, 68, 32, 32, 32, 32, 32,
-/* 0x23d0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x23e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x23f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2400 */  48, 48, 48, 49, 55, 98, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2410 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2420 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 54, 32, 80, 69, 75,
-/* 0x2430 */  51, 50, 79, 82, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2440 */  48, 49, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2450 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 98,
-/* 0x2470 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2480 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2490 */  76, 89, 10, 32, 50, 55, 32, 80, 69, 73, 77, 79, 82, 68, 49, 32,
-/* 0x24a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x24c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 32, 32, 48, 48, 48, 48, 49, 55, 99, 52, 32, 32, 50, 42, 42,
-/* 0x24e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x24f0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 56,
-/* 0x2500 */  32, 80, 69, 73, 77, 80, 79, 82, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2510 */  48, 48, 48, 48, 48, 50, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2540 */  48, 49, 55, 99,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2550 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2560 */  65, 68, 79, 78, 76, 89, 10, 32, 50, 57, 32, 80, 69, 73, 69, 82,
-/* 0x2570 */  68, 76, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2580 */  98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2590 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55,101,102, 32,
-/* 0x25b0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x25c0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 48, 32, 80, 69,
-/* 0x25d0 */  73, 69, 82, 69, 88, 69, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x25e0 */  48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25f0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2600 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55,
-/* 0x2610 */ 102, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2620 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2630 */  78, 76, 89, 10, 32, 51, 49, 32, 80, 69, 73, 77, 68, 79, 78, 69,
-/* 0x2640 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32,
-/* 0x2650 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2660 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2670 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 56, 48, 48, 32, 32, 50, 42,
-/* 0x2680 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2690 */  65, 68, 79, 78, 76, 89, 10, 32, 51, 50, 32, 80, 69, 82, 69, 76,
-/* 0x26a0 */  79, 67, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26b0 */  55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26c0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56, 48, 52, 32,
-/* 0x26e0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x26f0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2700 */  10, 32, 51, 51, 32, 80, 69, 82, 69, 76, 79, 67, 50, 32, 32, 32,
-/* 0x2710 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x2720 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2730 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2740 */  32, 48, 48, 48, 48, 49, 56, 48, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2750 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2760 */  78, 76, 89, 10, 32, 51, 52, 32, 80, 69, 82, 69, 76, 79, 67, 51,
-/* 0x2770 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51, 48, 32, 32,
-/* 0x2780 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2790 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27a0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 56, 48,102, 32, 32, 50, 42,
-/* 0x27b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x27c0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x27d0 */  53, 32, 82, 69, 76, 54, 52, 66, 73, 71, 32, 32, 32, 32, 32, 32,
-/* 0x27e0 */  48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x27f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2800 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2810 */  48, 48, 49, 56, 51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2820 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2830 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 54, 32, 82, 69, 76, 79,
-/* 0x2840 */  67, 54, 52, 74, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2850 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2860 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2870 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56, 52, 57,
-/* 0x2880 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2890 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x28a0 */  89, 10, 32, 51, 55, 32, 80, 69, 82, 76, 79, 72, 73, 48, 32, 32,
-/* 0x28b0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48,
-/* 0x28c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x28d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28e0 */  32, 32, 48, 48, 48, 48, 49, 56, 52, 98, 32, 32, 50, 42, 42, 48,
-/* 0x28f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2900 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 56, 32,
-/* 0x2910 */  80, 69, 82, 69, 76, 76, 79, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2920 */  48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2930 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2940 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2950 */  49, 56, 53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2960 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2970 */  51, 57, 32, 80, 69, 82, 69, 76, 72, 73, 48, 32, 32, 32, 32, 32,
-/* 0x2980 */  32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2990 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x29a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x29b0 */  48, 48, 48, 49, 56, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x29c0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x29d0 */  89, 10, 32, 52, 48, 32, 80, 69, 68, 69, 80, 72, 65, 75, 32, 32,
-/* 0x29e0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 98, 32, 32, 48, 48,
-/* 0x29f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2a00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a10 */  32, 32, 48, 48, 48, 48, 49, 56, 54,101, 32, 32, 50, 42, 42, 48,
-/* 0x2a20 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2a30 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49, 32,
-/* 0x2a40 */  80, 69, 84, 76, 83, 67, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2a50 */  48, 48, 48, 48, 49, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a60 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2a70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2a80 */  49, 56, 98, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2a90 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2aa0 */  68, 79, 78, 76, 89, 10, 32, 52, 50, 32, 80, 69, 77, 65, 73, 78,
-/* 0x2ab0 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2ac0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ad0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ae0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,100, 52, 32, 32,
-/* 0x2af0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2b00 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 51, 32, 67, 76, 69,
-/* 0x2b10 */  65, 82, 83, 84, 65, 67, 75, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2b20 */  48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b30 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,100,
-/* 0x2b50 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2b60 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 52, 32,
-/* 0x2b70 */  80, 69, 77, 65, 73, 78, 50, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2b80 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b90 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2ba0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2bb0 */  49, 56,101, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2bc0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2bd0 */  52, 53, 32, 80, 69, 73, 83, 68, 76, 76, 57, 32, 32, 32, 32, 32,
-/* 0x2be0 */  32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2bf0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2c00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2c10 */  48, 48, 48, 49, 56,101, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2c20 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2c30 */  89, 10, 32, 52, 54, 32, 80, 69, 82, 69, 84, 85, 82, 78, 32, 32,
-/* 0x2c40 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48,
-/* 0x2c50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c70 */  32, 32, 48, 48, 48, 48, 49, 56,102, 55, 32, 32, 50, 42, 42, 48,
-/* 0x2c80 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2c90 */  79, 78, 76, 89, 10, 32, 52, 55, 32, 80, 69, 68, 79, 74, 85, 77,
-/* 0x2ca0 */  80, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x2cb0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cc0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cd0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,102, 98, 32, 32, 50,
-/* 0x2ce0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2cf0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2d00 */  52, 56, 32, 80, 69, 84, 76, 83, 67, 50, 32, 32, 32, 32, 32, 32,
-/* 0x2d10 */  32, 48, 48, 48, 48, 48, 48, 50, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2d30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2d40 */  48, 48, 48, 49, 57, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2d50 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2d60 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 57, 32, 85, 80, 88,
-/* 0x2d70 */  49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d80 */  48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d90 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2da0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50,
-/* 0x2db0 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2dc0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66,
-/* 0x2dd0 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2de0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2df0 */ 100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48,
-/* 0x2e00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x2e10 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e20 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32, 32, 32, 32, 80,
-/* 0x2e30 */  69, 73, 77, 68, 79, 78, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e40 */  48, 48, 48, 48, 48, 48, 48, 48, 32,105,109,112,111,114,116,115,
-/* 0x2e50 */  95,100,111,110,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e60 */  48, 48, 48, 48, 50, 98, 32,108, 32, 32, 32, 32, 32, 32, 32, 80,
-/* 0x2e70 */  69, 73, 77, 80, 79, 82, 84,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,110,101,120,116, 95,102,117,
-/* 0x2e90 */ 110, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ea0 */  48, 48, 97, 32,108, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77,
-/* 0x2eb0 */  79, 82, 68, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ec0 */  48, 48, 48, 48, 48, 32, 98,121,110, 97,109,101, 10, 48, 48, 48,
-/* 0x2ed0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 56, 32,108, 32,
-/* 0x2ee0 */  32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 80, 79, 82, 50,  9, 48,
-/* 0x2ef0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2f00 */ 110,101,120,116, 95,105,109,112, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f10 */  48, 48, 48, 48, 48, 48, 48, 48, 97, 32,108, 32, 32, 32, 32, 32,
-/* 0x2f20 */  32, 32, 80, 69, 73, 77, 80, 79, 82, 50,  9, 48, 48, 48, 48, 48,
-/* 0x2f30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,114,115,
-/* 0x2f40 */ 116, 95,105,109,112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f50 */  48, 48, 48, 48, 48, 50, 32,108, 32, 32, 32, 32, 32, 32, 32, 82,
-/* 0x2f60 */  69, 76, 79, 67, 54, 52, 74,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f70 */  48, 48, 48, 48, 48, 48, 48, 48, 32,114,101,108,111, 99, 95,101,
-/* 0x2f80 */ 110,100,120, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f90 */  48, 48, 49, 51, 32,108, 32, 32, 32, 32, 32, 32, 32, 80, 69, 82,
-/* 0x2fa0 */  69, 76, 79, 67, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fb0 */  48, 48, 48, 48, 48, 48, 32,114,101,108,111, 99, 95, 97,100,100,
-/* 0x2fc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fd0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 84, 76, 83, 67,
-/* 0x2fe0 */  50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ff0 */  48, 48, 32, 80, 69, 84, 76, 83, 67, 50, 10, 48, 48, 48, 48, 48,
-/* 0x3000 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3010 */  32,100, 32, 32, 80, 69, 77, 65, 73, 78, 50, 49,  9, 48, 48, 48,
-/* 0x3020 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x3030 */  77, 65, 73, 78, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3040 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3050 */  83, 84, 65, 82, 84,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3060 */  48, 48, 48, 48, 48, 48, 32, 83, 84, 65, 82, 84, 10, 48, 48, 48,
-/* 0x3070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3080 */  32, 32, 32,100, 32, 32, 80, 69, 73, 83, 68, 76, 76, 48,  9, 48,
-/* 0x3090 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x30a0 */  80, 69, 73, 83, 68, 76, 76, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x30c0 */  32, 32, 80, 69, 73, 83, 68, 76, 76, 49,  9, 48, 48, 48, 48, 48,
-/* 0x30d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 83,
-/* 0x30e0 */  68, 76, 76, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x3100 */  77, 65, 73, 78, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3110 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 48, 49,
-/* 0x3120 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3130 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 67, 79, 78,
-/* 0x3140 */  83, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3150 */  48, 48, 48, 32, 80, 69, 73, 67, 79, 78, 83, 49, 10, 48, 48, 48,
-/* 0x3160 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3170 */  32, 32, 32,100, 32, 32, 80, 69, 73, 67, 79, 78, 83, 50,  9, 48,
-/* 0x3180 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3190 */  80, 69, 73, 67, 79, 78, 83, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x31b0 */  32, 32, 80, 69, 84, 76, 83, 72, 65, 75,  9, 48, 48, 48, 48, 48,
-/* 0x31c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 84, 76,
-/* 0x31d0 */  83, 72, 65, 75, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x31f0 */  77, 65, 73, 78, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3200 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 48, 50,
-/* 0x3210 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3220 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77, 65, 73, 78,
-/* 0x3230 */  48, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3240 */  48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 48, 51, 10, 48, 48, 48,
-/* 0x3250 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3260 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48,
-/* 0x3270 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x3280 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3290 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x32a0 */  68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32b0 */  48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x32d0 */  32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x32f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3300 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 72, 69, 65,
-/* 0x3310 */  68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3320 */  48, 48, 32, 76, 90, 77, 65, 95, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x3330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3340 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x3350 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3360 */  48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x3370 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3380 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3390 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33a0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x33b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x33c0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x33d0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33e0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x33f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3400 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x3410 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3420 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x3430 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3440 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 84, 65, 73, 76,  9,
-/* 0x3450 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3460 */  32, 76, 90, 77, 65, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48,
-/* 0x3470 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3480 */  32,100, 32, 32, 80, 69, 77, 65, 73, 78, 49, 48,  9, 48, 48, 48,
-/* 0x3490 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x34a0 */  77, 65, 73, 78, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x34c0 */  80, 69, 84, 76, 83, 72, 65, 75, 50,  9, 48, 48, 48, 48, 48, 48,
-/* 0x34d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 84, 76, 83,
-/* 0x34e0 */  72, 65, 75, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x3500 */  67, 84, 84, 80, 79, 83,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3510 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 67, 84, 84, 80, 79, 83,
-/* 0x3520 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3530 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 67, 84, 84, 78,
-/* 0x3540 */  85, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3550 */  48, 48, 48, 32, 80, 69, 67, 84, 84, 78, 85, 76, 10, 48, 48, 48,
-/* 0x3560 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3570 */  32, 32, 32,100, 32, 32, 80, 69, 70, 73, 76, 84, 69, 82, 52, 57,
-/* 0x3580 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3590 */  48, 32, 80, 69, 70, 73, 76, 84, 69, 82, 52, 57, 10, 48, 48, 48,
-/* 0x35a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x35b0 */  32, 32, 32,100, 32, 32, 80, 69, 73, 77, 80, 79, 82, 84,  9, 48,
-/* 0x35c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x35d0 */  80, 69, 73, 77, 80, 79, 82, 84, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x35f0 */  32, 32, 80, 69, 73, 66, 89, 79, 82, 68,  9, 48, 48, 48, 48, 48,
-/* 0x3600 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 66,
-/* 0x3610 */  89, 79, 82, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3620 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x3630 */  75, 51, 50, 79, 82, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3640 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 75, 51, 50, 79, 82, 68,
-/* 0x3650 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3660 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77, 79, 82,
-/* 0x3670 */  68, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3680 */  48, 48, 48, 32, 80, 69, 73, 77, 79, 82, 68, 49, 10, 48, 48, 48,
-/* 0x3690 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x36a0 */  32, 32, 32,100, 32, 32, 80, 69, 73, 77, 80, 79, 82, 50,  9, 48,
-/* 0x36b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x36c0 */  80, 69, 73, 77, 80, 79, 82, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x36e0 */  32, 32, 80, 69, 73, 69, 82, 68, 76, 76,  9, 48, 48, 48, 48, 48,
-/* 0x36f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 69,
-/* 0x3700 */  82, 68, 76, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3710 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x3720 */  73, 69, 82, 69, 88, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3730 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 69, 82, 69, 88, 69,
-/* 0x3740 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3750 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77, 68, 79,
-/* 0x3760 */  78, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3770 */  48, 48, 48, 32, 80, 69, 73, 77, 68, 79, 78, 69, 10, 48, 48, 48,
-/* 0x3780 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3790 */  32, 32, 32,100, 32, 32, 80, 69, 82, 69, 76, 79, 67, 49,  9, 48,
-/* 0x37a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x37b0 */  80, 69, 82, 69, 76, 79, 67, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x37d0 */  32, 32, 80, 69, 82, 69, 76, 79, 67, 50,  9, 48, 48, 48, 48, 48,
-/* 0x37e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 82, 69,
-/* 0x37f0 */  76, 79, 67, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x3810 */  82, 69, 76, 79, 67, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3820 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 82, 69, 76, 79, 67, 51,
-/* 0x3830 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3840 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 54, 52, 66,
-/* 0x3850 */  73, 71,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3860 */  48, 48, 48, 32, 82, 69, 76, 54, 52, 66, 73, 71, 10, 48, 48, 48,
-/* 0x3870 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3880 */  32, 32, 32,100, 32, 32, 82, 69, 76, 79, 67, 54, 52, 74,  9, 48,
-/* 0x3890 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x38a0 */  82, 69, 76, 79, 67, 54, 52, 74, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x38c0 */  32, 32, 80, 69, 82, 76, 79, 72, 73, 48,  9, 48, 48, 48, 48, 48,
-/* 0x38d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 82, 76,
-/* 0x38e0 */  79, 72, 73, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x3900 */  82, 69, 76, 76, 79, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3910 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 82, 69, 76, 76, 79, 48,
-/* 0x3920 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3930 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69, 76, 72,
-/* 0x3940 */  73, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3950 */  48, 48, 48, 32, 80, 69, 82, 69, 76, 72, 73, 48, 10, 48, 48, 48,
-/* 0x3960 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3970 */  32, 32, 32,100, 32, 32, 80, 69, 68, 69, 80, 72, 65, 75,  9, 48,
-/* 0x3980 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3990 */  80, 69, 68, 69, 80, 72, 65, 75, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x39b0 */  32, 32, 80, 69, 84, 76, 83, 67,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 84, 76, 83, 67,
-/* 0x39d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77, 65, 73, 78,
-/* 0x39f0 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a00 */  48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 50, 48, 10, 48, 48, 48,
-/* 0x3a10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3a20 */  32, 32, 32,100, 32, 32, 67, 76, 69, 65, 82, 83, 84, 65, 67, 75,
-/* 0x3a30 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a40 */  48, 32, 67, 76, 69, 65, 82, 83, 84, 65, 67, 75, 10, 48, 48, 48,
-/* 0x3a50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3a60 */  32, 32, 32,100, 32, 32, 80, 69, 73, 83, 68, 76, 76, 57,  9, 48,
-/* 0x3a70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3a80 */  80, 69, 73, 83, 68, 76, 76, 57, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3aa0 */  32, 32, 80, 69, 82, 69, 84, 85, 82, 78,  9, 48, 48, 48, 48, 48,
-/* 0x3ab0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 82, 69,
-/* 0x3ac0 */  84, 85, 82, 78, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ad0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x3ae0 */  68, 79, 74, 85, 77, 80,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3af0 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 68, 79, 74, 85, 77, 80,
-/* 0x3b00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b10 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88, 49, 72, 69,
-/* 0x3b20 */  65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b30 */  48, 48, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x3b40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x3b50 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x3b60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116, 97,
-/* 0x3b70 */ 114,116, 95,111,102, 95, 99,111,109,112,114,101,115,115,101,100,
-/* 0x3b80 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b90 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x3ba0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bb0 */  32,115,116, 97,114,116, 95,111,102, 95,117,110, 99,111,109,112,
-/* 0x3bc0 */ 114,101,115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bd0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3be0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bf0 */  48, 48, 48, 48, 48, 48, 32,105, 99,111,110, 95,111,102,102,115,
-/* 0x3c00 */ 101,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c10 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x3c20 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c30 */  48, 48, 32,105, 99,111,110, 95,100,101,108,116, 97, 10, 48, 48,
-/* 0x3c40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3c50 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x3c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,116,108,
-/* 0x3c70 */ 115, 95, 97,100,100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3c80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3c90 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ca0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,116,108,115, 95,118, 97,
-/* 0x3cb0 */ 108,117,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3cc0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x3cd0 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ce0 */  48, 48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48,
-/* 0x3cf0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3d00 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x3d10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3d20 */ 122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3d30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3d40 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114,
-/* 0x3d60 */  95, 98,117,102,102,101,114, 95,115,116, 97,114,116, 10, 48, 48,
-/* 0x3d70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3d80 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x3d90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,
-/* 0x3da0 */ 108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x3db0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x3dc0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x3dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,
-/* 0x3de0 */ 101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3df0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e00 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e10 */  48, 48, 48, 48, 48, 48, 32, 99,111,109,112,114,101,115,115,101,
-/* 0x3e20 */ 100, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3e30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3e40 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116, 97,114,116, 95,
-/* 0x3e60 */ 111,102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48,
-/* 0x3e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x3e80 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3e90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,111, 97,100, 76,
-/* 0x3ea0 */ 105, 98,114, 97,114,121, 65, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3eb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ec0 */  32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ed0 */  48, 48, 48, 48, 48, 48, 48, 32,107,101,114,110,101,108, 51, 50,
-/* 0x3ee0 */  95,111,114,100,105,110, 97,108,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3ef0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3f00 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 71,101,116, 80,114,111,
-/* 0x3f20 */  99, 65,100,100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f40 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 69,120,105,116, 80,114,111,
-/* 0x3f60 */  99,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f70 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x3f80 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f90 */  48, 48, 48, 48, 32,115,116, 97,114,116, 95,111,102, 95,114,101,
-/* 0x3fa0 */ 108,111, 99,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fb0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x3fc0 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fd0 */  48, 48, 48, 48, 32,114,101,108,111, 99, 95,100,101,108,116, 10,
-/* 0x3fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x4000 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4010 */  86,105,114,116,117, 97,108, 80,114,111,116,101, 99,116, 10, 48,
-/* 0x4020 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4030 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x4040 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,118,
-/* 0x4050 */ 112, 95, 98, 97,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4060 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4070 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4080 */  48, 48, 48, 48, 48, 48, 32,118,112, 95,115,105,122,101, 10, 48,
-/* 0x4090 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x40a0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x40b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,
-/* 0x40c0 */ 119,114,105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40d0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x40e0 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40f0 */  48, 48, 48, 32,116,108,115, 95,109,111,100,117,108,101, 95, 98,
-/* 0x4100 */  97,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4110 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x4120 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4130 */  48, 48, 48, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,
-/* 0x4140 */ 114,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4150 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x4160 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4170 */  48, 48, 32,116,108,115, 95, 99, 97,108,108, 98, 97, 99,107,115,
-/* 0x4180 */  95,112,116,114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4190 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69,
-/* 0x41a0 */  73, 83, 68, 76, 76, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x41b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x41c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x41d0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x41e0 */  48, 53, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x41f0 */  32, 32, 32, 32, 32, 80, 69, 77, 65, 73, 78, 50, 49, 45, 48,120,
-/* 0x4200 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x4210 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4220 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 77, 65, 73, 78,
-/* 0x4230 */  48, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x4240 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4250 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4260 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82,
-/* 0x4270 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x4280 */  32,115,116, 97,114,116, 95,111,102, 95, 99,111,109,112,114,101,
-/* 0x4290 */ 115,115,101,100, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42a0 */  48, 48, 48, 48, 48, 48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42b0 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x42c0 */  52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,114,116,
-/* 0x42d0 */  95,111,102, 95,117,110, 99,111,109,112,114,101,115,115,101,100,
-/* 0x42e0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x42f0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 67, 79, 78,
-/* 0x4300 */  83, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x4310 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4320 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x4340 */  95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32,
-/* 0x4350 */  32,105, 99,111,110, 95,111,102,102,115,101,116, 10, 10, 82, 69,
-/* 0x4360 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4370 */  32, 70, 79, 82, 32, 91, 80, 69, 73, 67, 79, 78, 83, 50, 93, 58,
-/* 0x4380 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4390 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43a0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x43b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88, 56, 54,
-/* 0x43c0 */  95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,105, 99,111,
-/* 0x43d0 */ 110, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43e0 */  48, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 88, 56, 54, 95,
-/* 0x43f0 */  54, 52, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32,105, 99,111,110,
-/* 0x4400 */  95,100,101,108,116, 97, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4410 */  48, 48, 48, 48, 48, 56, 48, 48, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4420 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4430 */  82, 32, 91, 80, 69, 84, 76, 83, 72, 65, 75, 93, 58, 10, 79, 70,
-/* 0x4440 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x4450 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4460 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4470 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x4480 */  95, 51, 50, 83, 32, 32, 32, 32, 32, 32,116,108,115, 95, 97,100,
-/* 0x4490 */ 100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44a0 */  48, 48, 48, 48, 48, 98, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x44b0 */  51, 50, 32, 32, 32, 32, 32, 32, 32,116,108,115, 95,118, 97,108,
-/* 0x44c0 */ 117,101, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 56, 48, 48,
-/* 0x44d0 */  48, 48, 48, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x44e0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x44f0 */  82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4500 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4520 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55,100,
-/* 0x4530 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x4540 */  32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48,
-/* 0x4550 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 98, 10, 10,
-/* 0x4560 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4570 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10,
-/* 0x4580 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4590 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x45a0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x45b0 */  48, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 88, 56, 54, 95,
-/* 0x45c0 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x45d0 */  72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x45e0 */  48, 48, 48, 48, 48, 49, 98, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x45f0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4600 */  91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4610 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4620 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4630 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4640 */  97, 49, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x4650 */  32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120,
-/* 0x4660 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 98,
-/* 0x4670 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4680 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 72,
-/* 0x4690 */  69, 65, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x46a0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x46b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x46c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x46d0 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x46e0 */  32, 32,108,122,109, 97, 95,117, 95,108,101,110, 43, 48,120, 48,
-/* 0x46f0 */  48, 48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48, 48, 48, 10,
-/* 0x4700 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x4710 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32, 32,
-/* 0x4720 */  32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 43, 48,120,
-/* 0x4730 */  48, 48, 48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4740 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4750 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 67, 84, 84, 80,
-/* 0x4760 */  79, 83, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x4770 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4780 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4790 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x47a0 */  95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32,
-/* 0x47b0 */  32,102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,
-/* 0x47c0 */ 116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x47d0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69,
-/* 0x47e0 */  70, 73, 76, 84, 69, 82, 52, 57, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x47f0 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4800 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4810 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4820 */  48, 48, 48, 55, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50,
-/* 0x4830 */  83, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x4840 */ 110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4850 */  48, 48, 48, 48, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 56,
-/* 0x4860 */  32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,
-/* 0x4870 */ 116,111, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4880 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 77,
-/* 0x4890 */  80, 79, 82, 84, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x48a0 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x48b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x48c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x48d0 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32,
-/* 0x48e0 */  32, 32, 32, 99,111,109,112,114,101,115,115,101,100, 95,105,109,
-/* 0x48f0 */ 112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4900 */  48, 48, 48, 48, 49, 48, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x4910 */  80, 67, 56, 32, 32, 32, 32, 32, 32,105,109,112,111,114,116,115,
-/* 0x4920 */  95,100,111,110,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4930 */  48, 48, 48, 48, 49, 56, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x4940 */  51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,
-/* 0x4950 */ 102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4960 */  48, 48, 48, 48, 48, 48, 48, 48, 50, 53, 32, 82, 95, 88, 56, 54,
-/* 0x4970 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 76,111, 97,
-/* 0x4980 */ 100, 76,105, 98,114, 97,114,121, 65, 45, 48,120, 48, 48, 48, 48,
-/* 0x4990 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 10, 82, 69,
-/* 0x49a0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x49b0 */  32, 70, 79, 82, 32, 91, 80, 69, 73, 66, 89, 79, 82, 68, 93, 58,
-/* 0x49c0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49d0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49e0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x49f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 88, 56, 54,
-/* 0x4a00 */  95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 98,121,110,
-/* 0x4a10 */  97,109,101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4a20 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 75,
-/* 0x4a30 */  51, 50, 79, 82, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4a40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4a60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a70 */  99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32,
-/* 0x4a80 */  32, 32, 32, 32,107,101,114,110,101,108, 51, 50, 95,111,114,100,
-/* 0x4a90 */ 105,110, 97,108,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4aa0 */  48, 48, 48, 48, 49, 49, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x4ab0 */  80, 67, 56, 32, 32, 32, 32, 32, 32,110,101,120,116, 95,105,109,
-/* 0x4ac0 */ 112, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4ad0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 77, 79,
-/* 0x4ae0 */  82, 68, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x4af0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4b00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4b10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x4b20 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4b30 */  32, 32,102,105,114,115,116, 95,105,109,112, 10, 10, 82, 69, 76,
-/* 0x4b40 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4b50 */  70, 79, 82, 32, 91, 80, 69, 73, 77, 80, 79, 82, 50, 93, 58, 10,
-/* 0x4b60 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b70 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b80 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b90 */  48, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 88, 56, 54, 95,
-/* 0x4ba0 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 71,101,116, 80,
-/* 0x4bb0 */ 114,111, 99, 65,100,100,114,101,115,115, 45, 48,120, 48, 48, 48,
-/* 0x4bc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 48, 48,
-/* 0x4bd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 48, 32, 82,
-/* 0x4be0 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4bf0 */  32,110,101,120,116, 95,102,117,110, 99, 10, 10, 82, 69, 76, 79,
-/* 0x4c00 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4c10 */  79, 82, 32, 91, 80, 69, 73, 69, 82, 69, 88, 69, 93, 58, 10, 79,
-/* 0x4c20 */  70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c30 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c40 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c50 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x4c60 */  52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69,120,105,116, 80,
-/* 0x4c70 */ 114,111, 99,101,115,115, 45, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c80 */  48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4c90 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4ca0 */  82, 32, 91, 80, 69, 82, 69, 76, 79, 67, 49, 93, 58, 10, 79, 70,
-/* 0x4cb0 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x4cc0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4cd0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ce0 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x4cf0 */  95, 51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,
-/* 0x4d00 */ 111,102, 95,114,101,108,111, 99,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4d10 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4d20 */  82, 32, 91, 80, 69, 82, 69, 76, 79, 67, 51, 93, 58, 10, 79, 70,
-/* 0x4d30 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x4d40 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d50 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d60 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x4d70 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32,114,101,108,111, 99, 95,
-/* 0x4d80 */ 101,110,100,120, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4d90 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69,
-/* 0x4da0 */  76, 54, 52, 66, 73, 71, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4db0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4dc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4dd0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4de0 */  48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32,
-/* 0x4df0 */  32, 32, 32, 32, 32,114,101,108,111, 99, 95, 97,100,100, 10, 10,
-/* 0x4e00 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4e10 */  68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 54, 52, 74,
-/* 0x4e20 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e30 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e40 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4e50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 88,
-/* 0x4e60 */  56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,114,
-/* 0x4e70 */ 101,108,111, 99, 95, 97,100,100, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4e80 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4e90 */  32, 91, 80, 69, 82, 76, 79, 72, 73, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4ea0 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x4eb0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ec0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ed0 */  48, 48, 48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x4ee0 */  51, 50, 83, 32, 32, 32, 32, 32, 32,114,101,108,111, 99, 95,100,
-/* 0x4ef0 */ 101,108,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4f00 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 68,
-/* 0x4f10 */  69, 80, 72, 65, 75, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4f20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4f30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4f40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f50 */  51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32,
-/* 0x4f60 */  32, 32, 32, 32, 86,105,114,116,117, 97,108, 80,114,111,116,101,
-/* 0x4f70 */  99,116, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f80 */  48, 48, 48, 48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f90 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x4fa0 */  51, 50, 83, 32, 32, 32, 32, 32, 32,118,112, 95, 98, 97,115,101,
-/* 0x4fb0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4fc0 */ 102, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32,
-/* 0x4fd0 */  32, 32, 32, 32,118,112, 95,115,105,122,101, 43, 48,120, 48, 48,
-/* 0x4fe0 */  48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48, 48, 48, 10, 48,
-/* 0x4ff0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 99, 32,
-/* 0x5000 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32,
-/* 0x5010 */  32, 32,115,119,114,105, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5020 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5030 */  80, 69, 84, 76, 83, 67, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5050 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5060 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5070 */  48, 50, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x5080 */  32, 32, 32, 32, 32, 80, 69, 84, 76, 83, 67, 50, 45, 48,120, 48,
-/* 0x5090 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 10,
-/* 0x50a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 97,
-/* 0x50b0 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32,
-/* 0x50c0 */  32, 32, 32,116,108,115, 95,109,111,100,117,108,101, 95, 98, 97,
-/* 0x50d0 */ 115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50e0 */  48, 49, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x50f0 */  50, 32, 32, 32, 32, 32, 80, 69, 84, 76, 83, 67, 50, 45, 48,120,
-/* 0x5100 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x5110 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5120 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 68, 79, 74, 85,
-/* 0x5130 */  77, 80, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x5140 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5150 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5160 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x5170 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x5180 */  32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,121, 45,
-/* 0x5190 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x51a0 */  48, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x51b0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 84, 76,
-/* 0x51c0 */  83, 67, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x51d0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x51e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x51f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x5200 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x5210 */  32, 32,116,108,115, 95, 99, 97,108,108, 98, 97, 99,107,115, 95,
-/* 0x5220 */ 112,116,114, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5230 */  48, 48, 48, 48, 48, 52, 10
+/* 0x1940 */   0,  0,  0,  0,  0, 45, 50,  0,  0,  0, 83,  0,  0,  0, 41,  0,
+/* 0x1950 */   0,  0, 56, 12,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,
+/* 0x1960 */   0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 64,  0,  0,  0, 15,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 79,  0,  0,  0,  9,  0,
+/* 0x1980 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0, 88,  0,  0,  0, 18,  0,
+/* 0x1990 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,106,  0,  0,  0,  7,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0, 42,  0,  0,  0,113,  0,  0,  0,  9,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0, 51,  0,  0,  0,122,  0,  0,  0, 16,  0,
+/* 0x19c0 */   0,  0,  0,  0,  0,  0, 60,  0,  0,  0,138,  0,  0,  0,  1,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0, 69,  0,  0,  0,139,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  0,  0, 78,  0,  0,  0,139,  0,  0,  0, 96,  0,
+/* 0x19f0 */   0,  0,  0,  0,  0,  0, 87,  0,  0,  0,235,  0,  0,  0,131,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0, 93,  0,  0,  0,110,  1,  0,  0,145,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0, 99,  0,  0,  0,255,  1,  0,  0,170,  0,
+/* 0x1a20 */   0,  0,  0,  0,  0,  0,105,  0,  0,  0,169,  2,  0,  0, 20,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0,115,  0,  0,  0,189,  2,  0,  0, 90,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,126,  0,  0,  0, 23,  3,  0,  0,247,  9,
+/* 0x1a50 */   0,  0,  0,  0,  0,  0,137,  0,  0,  0, 14, 13,  0,  0,247,  9,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0,148,  0,  0,  0,  5, 23,  0,  0, 20,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0,159,  0,  0,  0, 25, 23,  0,  0,  2,  0,
+/* 0x1a80 */   0,  0,  0,  0,  0,  0,169,  0,  0,  0, 27, 23,  0,  0,  1,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0,  0,178,  0,  0,  0, 28, 23,  0,  0,  4,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0,188,  0,  0,  0, 32, 23,  0,  0,  7,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  0,  0,197,  0,  0,  0, 39, 23,  0,  0,  3,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0,  0,206,  0,  0,  0, 42, 23,  0,  0, 82,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0,217,  0,  0,  0,124, 23,  0,  0, 52,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  0,  0,226,  0,  0,  0,176, 23,  0,  0,  2,  0,
+/* 0x1af0 */   0,  0,  0,  0,  0,  0,235,  0,  0,  0,178, 23,  0,  0, 18,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,244,  0,  0,  0,196, 23,  0,  0, 10,  0,
+/* 0x1b10 */   0,  0,  0,  0,  0,  0,253,  0,  0,  0,206, 23,  0,  0, 33,  0,
+/* 0x1b20 */   0,  0,  0,  0,  0,  0,  6,  1,  0,  0,239, 23,  0,  0, 11,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0, 15,  1,  0,  0,250, 23,  0,  0,  6,  0,
+/* 0x1b40 */   0,  0,  0,  0,  0,  0, 24,  1,  0,  0,  0, 24,  0,  0,  4,  0,
+/* 0x1b50 */   0,  0,  0,  0,  0,  0, 33,  1,  0,  0,  4, 24,  0,  0,  7,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0,  0, 42,  1,  0,  0, 11, 24,  0,  0,  4,  0,
+/* 0x1b70 */   0,  0,  0,  0,  0,  0, 51,  1,  0,  0, 15, 24,  0,  0, 48,  0,
+/* 0x1b80 */   0,  0,  0,  0,  0,  0, 60,  1,  0,  0, 63, 24,  0,  0, 10,  0,
+/* 0x1b90 */   0,  0,  0,  0,  0,  0, 69,  1,  0,  0, 73, 24,  0,  0,  2,  0,
+/* 0x1ba0 */   0,  0,  0,  0,  0,  0, 78,  1,  0,  0, 75, 24,  0,  0, 10,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  0,  0, 87,  1,  0,  0, 85, 24,  0,  0, 11,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0, 96,  1,  0,  0, 96, 24,  0,  0, 14,  0,
+/* 0x1bd0 */   0,  0,  0,  0,  0,  0,105,  1,  0,  0,110, 24,  0,  0, 75,  0,
+/* 0x1be0 */   0,  0,  0,  0,  0,  0,114,  1,  0,  0,185, 24,  0,  0, 27,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  0,  0,121,  1,  0,  0,212, 24,  0,  0,  4,  0,
+/* 0x1c00 */   0,  0,  0,  0,  0,  0,130,  1,  0,  0,216, 24,  0,  0, 16,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,  0,141,  1,  0,  0,232, 24,  0,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,  0,150,  1,  0,  0,232, 24,  0,  0, 15,  0,
+/* 0x1c30 */   0,  0,  0,  0,  0,  0,159,  1,  0,  0,247, 24,  0,  0,  4,  0,
+/* 0x1c40 */   0,  0,  0,  0,  0,  0,168,  1,  0,  0,251, 24,  0,  0,  5,  0,
+/* 0x1c50 */   0,  0,  0,  0,  0,  0,177,  1,  0,  0,  0, 25,  0,  0, 38,  0,
+/* 0x1c60 */   0,  0,  0,  0,  0,  0,185,  1,  0,  0, 38, 25,  0,  0, 32,  0,
+/* 0x1c70 */   0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,  0,  0,194,  1,  0,  0, 31,  0,  0,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0,  0,  0,207,  1,  0,  0, 24,  0,  0,  0, 43,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  0,  0,217,  1,  0,  0, 27,  0,  0,  0, 10,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  0,  0,224,  1,  0,  0, 28,  0,  0,  0, 24,  0,
+/* 0x1cc0 */   0,  0,  0,  0,  0,  0,233,  1,  0,  0, 28,  0,  0,  0, 10,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0,243,  1,  0,  0, 36,  0,  0,  0,  2,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,254,  1,  0,  0, 34,  0,  0,  0, 19,  0,
+/* 0x1cf0 */   0,  0,  0,  0,  0,  0,177,  1,  0,  0, 48,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0,  0,141,  1,  0,  0, 44,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  0,  0, 51,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,  0,  0, 87,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0,  0,  0, 93,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,  0,105,  0,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0,  0,  0,115,  0,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,  0,  0,126,  0,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,  0,137,  0,  0,  0, 16,  0,  0,  0,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0,  0,  0,148,  0,  0,  0, 17,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0,159,  0,  0,  0, 18,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,  0,169,  0,  0,  0, 19,  0,  0,  0,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0,  0,  0,178,  0,  0,  0, 20,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0,188,  0,  0,  0, 21,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,197,  0,  0,  0, 22,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,  0,  0,206,  0,  0,  0, 23,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,  0,  0,217,  0,  0,  0, 24,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0,  0,226,  0,  0,  0, 25,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,  0,  0,235,  0,  0,  0, 26,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  0,  0,244,  0,  0,  0, 27,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,253,  0,  0,  0, 28,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0,  0,  6,  1,  0,  0, 29,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0,  0, 15,  1,  0,  0, 30,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0,  0, 24,  1,  0,  0, 31,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,  0,  0, 33,  1,  0,  0, 32,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,  0, 42,  1,  0,  0, 33,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  0,  0, 51,  1,  0,  0, 34,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,  0,  0, 60,  1,  0,  0, 35,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  0,  0, 69,  1,  0,  0, 36,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,  0, 78,  1,  0,  0, 37,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0,  0,  0, 87,  1,  0,  0, 38,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  0,  0, 96,  1,  0,  0, 39,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,  0,105,  1,  0,  0, 40,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,  0,  0,114,  1,  0,  0, 41,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  0,  0,121,  1,  0,  0, 42,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0,130,  1,  0,  0, 43,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  0,  0,150,  1,  0,  0, 45,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  0,  0,159,  1,  0,  0, 46,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,168,  1,  0,  0, 47,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  0,  0,185,  1,  0,  0, 49,  0,  0,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,  0,  8,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2010 */ 173,222,  0,  0,  0,  0, 28,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2020 */ 173,222,  0,  0,  0,  0, 50,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2030 */ 173,222,  0,  0,  0,  0, 62,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2040 */ 173,222,  0,  0,  0,  0, 73,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2050 */ 173,222,  0,  0,  0,  0, 85,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2060 */ 173,222,  0,  0,  0,  0, 95,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2070 */ 173,222,  0,  0,  0,  0,106,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2080 */ 173,222,  0,  0,  0,  0,117,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2090 */ 173,222,  0,  0,  0,  0,137,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x20a0 */ 173,222,  0,  0,  0,  0,151,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x20b0 */ 173,222,  0,  0,  0,  0,162,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x20c0 */ 173,222,  0,  0,  0,  0,181,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x20d0 */ 173,222,  0,  0,  0,  0,198,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x20e0 */ 173,222,  0,  0,  0,  0,211,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x20f0 */ 173,222,  0,  0,  0,  0,229,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2100 */ 173,222,  0,  0,  0,  0,244,  2,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2110 */ 173,222,  0,  0,  0,  0,  0,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2120 */ 173,222,  0,  0,  0,  0, 16,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2130 */ 173,222,  0,  0,  0,  0, 27,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2140 */ 173,222,  0,  0,  0,  0, 42,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2150 */ 173,222,  0,  0,  0,  0, 50,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2160 */ 173,222,  0,  0,  0,  0, 58,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2170 */ 173,222,  0,  0,  0,  0, 63,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2180 */ 173,222,  0,  0,  0,  0, 79,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x2190 */ 173,222,  0,  0,  0,  0, 94,  3,  0,  0, 51,  0,  0,  0,173,222,
+/* 0x21a0 */ 173,222,  0,  0,  0,  0,  2,  0,  0,  0,  5,  0,  0,  0,112,  3,
+/* 0x21b0 */   0,  0,  9,  0,  0,  0,252,255,255,255,255,255,255,255,  3,  0,
+/* 0x21c0 */   0,  0,  7,  0,  0,  0,112,  3,  0,  0, 57,  0,  0,  0,252,255,
+/* 0x21d0 */ 255,255,255,255,255,255,  3,  0,  0,  0, 14,  0,  0,  0,126,  3,
+/* 0x21e0 */   0,  0, 58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x21f0 */   0,  0,  3,  0,  0,  0,126,  3,  0,  0, 59,  0,  0,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  3,  0,  0,  0,126,  3,
+/* 0x2210 */   0,  0, 59,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x2220 */   0,  0,  7,  0,  0,  0,139,  3,  0,  0, 60,  0,  0,  0,  0,128,
+/* 0x2230 */   0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  3,  0,  0,  0,126,  3,
+/* 0x2240 */   0,  0, 61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x2250 */   0,  0, 11,  0,  0,  0,151,  3,  0,  0, 62,  0,  0,  0,  0,  0,
+/* 0x2260 */   0,128,  0,  0,  0,  0, 10,  0,  0,  0,125,  0,  0,  0,112,  3,
+/* 0x2270 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2280 */   0,  0,136,  0,  0,  0,112,  3,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x2290 */   0,  0,  0,  0,  0,  0, 12,  0,  0,  0,161,  0,  0,  0,112,  3,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 13,  0,
+/* 0x22b0 */   0,  0,  1,  0,  0,  0,151,  3,  0,  0, 63,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0,128,  0,  0,  0,  0, 13,  0,  0,  0, 16,  0,  0,  0,151,  3,
+/* 0x22d0 */   0,  0, 64,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0, 21,  0,
+/* 0x22e0 */   0,  0,  3,  0,  0,  0,126,  3,  0,  0, 65,  0,  0,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,  0,  0, 23,  0,  0,  0,  7,  0,  0,  0,126,  3,
+/* 0x2300 */   0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,
+/* 0x2310 */   0,  0, 12,  0,  0,  0,163,  3,  0,  0, 67,  0,  0,  0,  0,  0,
+/* 0x2320 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  7,  0,  0,  0,126,  3,
+/* 0x2330 */   0,  0, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,
+/* 0x2340 */   0,  0, 16,  0,  0,  0,174,  3,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x2350 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0, 24,  0,  0,  0,126,  3,
+/* 0x2360 */   0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,
+/* 0x2370 */   0,  0, 37,  0,  0,  0,112,  3,  0,  0, 70,  0,  0,  0,252,255,
+/* 0x2380 */ 255,255,255,255,255,255, 25,  0,  0,  0,  1,  0,  0,  0,174,  3,
+/* 0x2390 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,
+/* 0x23a0 */   0,  0, 12,  0,  0,  0,126,  3,  0,  0, 71,  0,  0,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0,  0,  0, 26,  0,  0,  0, 17,  0,  0,  0,174,  3,
+/* 0x23c0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x23d0 */   0,  0,  9,  0,  0,  0,174,  3,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,  0,  0, 28,  0,  0,  0, 15,  0,  0,  0,112,  3,
+/* 0x23f0 */   0,  0, 72,  0,  0,  0,252,255,255,255,255,255,255,255, 28,  0,
+/* 0x2400 */   0,  0, 32,  0,  0,  0,174,  3,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  2,  0,  0,  0,112,  3,
+/* 0x2420 */   0,  0, 73,  0,  0,  0,252,255,255,255,255,255,255,255, 32,  0,
+/* 0x2430 */   0,  0,  3,  0,  0,  0,126,  3,  0,  0, 74,  0,  0,  0,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,  0,  0, 34,  0,  0,  0, 14,  0,  0,  0,174,  3,
+/* 0x2450 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,
+/* 0x2460 */   0,  0,  3,  0,  0,  0,174,  3,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2470 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  1,  0,  0,  0,174,  3,
+/* 0x2480 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,
+/* 0x2490 */   0,  0,  6,  0,  0,  0,126,  3,  0,  0, 75,  0,  0,  0,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  3,  0,  0,  0,112,  3,
+/* 0x24b0 */   0,  0, 76,  0,  0,  0,252,255,255,255,255,255,255,255, 40,  0,
+/* 0x24c0 */   0,  0, 10,  0,  0,  0,126,  3,  0,  0, 77,  0,  0,  0,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0, 15,  0,  0,  0,151,  3,
+/* 0x24e0 */   0,  0, 78,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0, 40,  0,
+/* 0x24f0 */   0,  0, 44,  0,  0,  0,126,  3,  0,  0, 79,  0,  0,  0,  0,  0,
+/* 0x2500 */   0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  2,  0,  0,  0,112,  3,
+/* 0x2510 */   0,  0,  8,  0,  0,  0,251,255,255,255,255,255,255,255, 41,  0,
+/* 0x2520 */   0,  0, 10,  0,  0,  0,126,  3,  0,  0, 80,  0,  0,  0,  0,  0,
+/* 0x2530 */   0,  0,  0,  0,  0,  0, 41,  0,  0,  0, 22,  0,  0,  0,112,  3,
+/* 0x2540 */   0,  0,  8,  0,  0,  0,252,255,255,255,255,255,255,255, 47,  0,
+/* 0x2550 */   0,  0,  1,  0,  0,  0,112,  3,  0,  0, 81,  0,  0,  0,252,255,
+/* 0x2560 */ 255,255,255,255,255,255, 48,  0,  0,  0,  5,  0,  0,  0,112,  3,
+/* 0x2570 */   0,  0, 82,  0,  0,  0,252,255,255,255,255,255,255,255, 83, 84,
+/* 0x2580 */  65, 82, 84,  0, 80, 69, 73, 83, 68, 76, 76, 48,  0, 80, 69, 73,
+/* 0x2590 */  83, 68, 76, 76, 49,  0, 80, 69, 77, 65, 73, 78, 48, 49,  0, 80,
+/* 0x25a0 */  69, 73, 67, 79, 78, 83, 49,  0, 80, 69, 73, 67, 79, 78, 83, 50,
+/* 0x25b0 */   0, 80, 69, 84, 76, 83, 72, 65, 75,  0, 80, 69, 77, 65, 73, 78,
+/* 0x25c0 */  48, 50,  0, 80, 69, 77, 65, 73, 78, 48, 51,  0, 78, 82, 86, 95,
+/* 0x25d0 */  72, 69, 65, 68,  0, 78, 82, 86, 50, 66,  0, 78, 82, 86, 50, 68,
+/* 0x25e0 */   0, 78, 82, 86, 50, 69,  0, 76, 90, 77, 65, 95, 72, 69, 65, 68,
+/* 0x25f0 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x2600 */  95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50,
+/* 0x2610 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90, 77,
+/* 0x2620 */  65, 95, 84, 65, 73, 76,  0, 80, 69, 77, 65, 73, 78, 49, 48,  0,
+/* 0x2630 */  80, 69, 84, 76, 83, 72, 65, 75, 50,  0, 80, 69, 67, 84, 84, 80,
+/* 0x2640 */  79, 83,  0, 80, 69, 67, 84, 84, 78, 85, 76,  0, 80, 69, 70, 73,
+/* 0x2650 */  76, 84, 69, 82, 52, 57,  0, 80, 69, 73, 77, 80, 79, 82, 84,  0,
+/* 0x2660 */  80, 69, 73, 66, 89, 79, 82, 68,  0, 80, 69, 75, 51, 50, 79, 82,
+/* 0x2670 */  68,  0, 80, 69, 73, 77, 79, 82, 68, 49,  0, 80, 69, 73, 77, 80,
+/* 0x2680 */  79, 82, 50,  0, 80, 69, 73, 69, 82, 68, 76, 76,  0, 80, 69, 73,
+/* 0x2690 */  69, 82, 69, 88, 69,  0, 80, 69, 73, 77, 68, 79, 78, 69,  0, 80,
+/* 0x26a0 */  69, 82, 69, 76, 79, 67, 49,  0, 80, 69, 82, 69, 76, 79, 67, 50,
+/* 0x26b0 */   0, 80, 69, 82, 69, 76, 79, 67, 51,  0, 82, 69, 76, 54, 52, 66,
+/* 0x26c0 */  73, 71,  0, 82, 69, 76, 79, 67, 54, 52, 74,  0, 80, 69, 82, 76,
+/* 0x26d0 */  79, 72, 73, 48,  0, 80, 69, 82, 69, 76, 76, 79, 48,  0, 80, 69,
+/* 0x26e0 */  82, 69, 76, 72, 73, 48,  0, 80, 69, 68, 69, 80, 72, 65, 75,  0,
+/* 0x26f0 */  80, 69, 84, 76, 83, 67,  0, 80, 69, 77, 65, 73, 78, 50, 48,  0,
+/* 0x2700 */  67, 76, 69, 65, 82, 83, 84, 65, 67, 75,  0, 80, 69, 77, 65, 73,
+/* 0x2710 */  78, 50, 49,  0, 80, 69, 73, 83, 68, 76, 76, 57,  0, 80, 69, 82,
+/* 0x2720 */  69, 84, 85, 82, 78,  0, 80, 69, 68, 79, 74, 85, 77, 80,  0, 80,
+/* 0x2730 */  69, 84, 76, 83, 67, 50,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0,
+/* 0x2740 */ 105,109,112,111,114,116,115, 95,100,111,110,101,  0,110,101,120,
+/* 0x2750 */ 116, 95,102,117,110, 99,  0, 98,121,110, 97,109,101,  0,110,101,
+/* 0x2760 */ 120,116, 95,105,109,112,  0,102,105,114,115,116, 95,105,109,112,
+/* 0x2770 */   0,114,101,108,111, 99, 95,101,110,100,120,  0,114,101,108,111,
+/* 0x2780 */  99, 95, 97,100,100,  0,115,116, 97,114,116, 95,111,102, 95, 99,
+/* 0x2790 */ 111,109,112,114,101,115,115,101,100,  0,115,116, 97,114,116, 95,
+/* 0x27a0 */ 111,102, 95,117,110, 99,111,109,112,114,101,115,115,101,100,  0,
+/* 0x27b0 */ 105, 99,111,110, 95,111,102,102,115,101,116,  0,105, 99,111,110,
+/* 0x27c0 */  95,100,101,108,116, 97,  0,116,108,115, 95, 97,100,100,114,101,
+/* 0x27d0 */ 115,115,  0,116,108,115, 95,118, 97,108,117,101,  0,108,122,109,
+/* 0x27e0 */  97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,
+/* 0x27f0 */ 101,110,  0,102,105,108,116,101,114, 95, 98,117,102,102,101,114,
+/* 0x2800 */  95,115,116, 97,114,116,  0,102,105,108,116,101,114, 95,108,101,
+/* 0x2810 */ 110,103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0,
+/* 0x2820 */  99,111,109,112,114,101,115,115,101,100, 95,105,109,112,111,114,
+/* 0x2830 */ 116,115,  0,115,116, 97,114,116, 95,111,102, 95,105,109,112,111,
+/* 0x2840 */ 114,116,115,  0, 76,111, 97,100, 76,105, 98,114, 97,114,121, 65,
+/* 0x2850 */   0,107,101,114,110,101,108, 51, 50, 95,111,114,100,105,110, 97,
+/* 0x2860 */ 108,115,  0, 71,101,116, 80,114,111, 99, 65,100,100,114,101,115,
+/* 0x2870 */ 115,  0, 69,120,105,116, 80,114,111, 99,101,115,115,  0,115,116,
+/* 0x2880 */  97,114,116, 95,111,102, 95,114,101,108,111, 99,115,  0,114,101,
+/* 0x2890 */ 108,111, 99, 95,100,101,108,116,  0, 86,105,114,116,117, 97,108,
+/* 0x28a0 */  80,114,111,116,101, 99,116,  0,118,112, 95, 98, 97,115,101,  0,
+/* 0x28b0 */ 118,112, 95,115,105,122,101,  0,115,119,114,105,  0,116,108,115,
+/* 0x28c0 */  95,109,111,100,117,108,101, 95, 98, 97,115,101,  0,111,114,105,
+/* 0x28d0 */ 103,105,110, 97,108, 95,101,110,116,114,121,  0,116,108,115, 95,
+/* 0x28e0 */  99, 97,108,108, 98, 97, 99,107,115, 95,112,116,114,  0, 82, 95,
+/* 0x28f0 */  88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,  0, 82, 95, 88, 56,
+/* 0x2900 */  54, 95, 54, 52, 95, 51, 50, 83,  0, 82, 95, 88, 56, 54, 95, 54,
+/* 0x2910 */  52, 95, 49, 54,  0, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50,
+/* 0x2920 */   0, 82, 95, 88, 56, 54, 95, 54, 52, 95, 56,  0, 82, 95, 88, 56,
+/* 0x2930 */  54, 95, 54, 52, 95, 80, 67, 56,  0, 70, 25,  0,  0, 85, 80, 88,
+/* 0x2940 */  76
 };
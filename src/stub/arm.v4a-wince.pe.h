@@ -1,5 +1,5 @@
 /* arm.v4a-wince.pe.h
-   created from arm.v4a-wince.pe.bin, 15590 (0x3ce6) bytes
+   created from arm.v4a-wince.pe.bin, 9326 (0x246e) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V4A_WINCE_PE_SIZE    15590
-#define STUB_ARM_V4A_WINCE_PE_ADLER32 0xc8464102
-#define STUB_ARM_V4A_WINCE_PE_CRC32   0x014083fa
+#define STUB_ARM_V4A_WINCE_PE_SIZE    9326
+#define STUB_ARM_V4A_WINCE_PE_ADLER32 0x83bf2391
+#define STUB_ARM_V4A_WINCE_PE_CRC32   0x03d93a1e
 
-unsigned char stub_arm_v4a_wince_pe[15590] = {
+unsigned char stub_arm_v4a_wince_pe[9326] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 156, 15,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -268,747 +268,355 @@ unsigned char stub_arm_v4a_wince_pe[15590] = {
 /* 0x0e50 */  65,  2,  0, 42,  9,  0, 94,225, 73,  2,  0, 10,  1,224,142,226,
 /* 0x0e60 */   4,  0,157,229,  0, 16,157,229, 92, 32,157,229, 14, 48, 96,224,
 /* 0x0e70 */   0,  0,160,227,  0, 48,129,229,  0,176,130,229, 74,  2,  0,234,
-/* 0x0e80 */   1,  0,160,227, 48,208,141,226,240,143,189,232,102,105,108,101,
-/* 0x0e90 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,108,105,
-/* 0x0ea0 */ 116,116,108,101, 97,114,109, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x0eb0 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x0ec0 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x0ed0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x0ee0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x0ef0 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 68,108,108,
-/* 0x0f00 */  83,116, 97,114,116, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x0f10 */  48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x0f20 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x0f30 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x0f40 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x0f50 */  76, 89, 10, 32, 32, 49, 32, 69,120,101, 83,116, 97,114,116, 32,
-/* 0x0f60 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 52, 32, 32, 48,
-/* 0x0f70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0f80 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 99, 32, 32, 50, 42, 42,
-/* 0x0f90 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x0fa0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50,
-/* 0x0fb0 */  32, 80,114,111, 99,101,115,115, 69,110,100, 32, 32, 32, 32, 48,
-/* 0x0fc0 */  48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0fd0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x0fe0 */  48, 48, 48, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x0ff0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1000 */  32, 32, 51, 32, 85,110,102,105,108,116,101,114, 95, 48,120, 53,
-/* 0x1010 */  48, 32, 48, 48, 48, 48, 48, 48, 52, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1020 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1030 */  48, 48, 48, 48, 48, 48, 57, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1040 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1050 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 82,101,
-/* 0x1060 */ 108,111, 99,115, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1070 */  48, 48, 54, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1080 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1090 */ 101, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x10a0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x10b0 */  78, 76, 89, 10, 32, 32, 53, 32, 73,109,112,111,114,116,115, 32,
-/* 0x10c0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 98, 99, 32, 32,
-/* 0x10d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x10e0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 48, 32, 32, 50, 42,
-/* 0x10f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1100 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1110 */  54, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32,
-/* 0x1120 */  48, 48, 48, 48, 48, 48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1130 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1140 */  48, 48, 48, 49,102, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1150 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1160 */  10, 32, 32, 55, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,
-/* 0x1170 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 32, 48, 48, 48,
-/* 0x1180 */  48, 48, 49, 49, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1190 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x11a0 */  50, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x11b0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x11c0 */  79, 78, 76, 89, 10, 32, 32, 56, 32, 67, 97,108,108, 50, 69, 32,
-/* 0x11d0 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x11e0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x11f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 51, 48, 32, 32, 50,
-/* 0x1200 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1210 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1220 */  32, 57, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
-/* 0x1230 */  99,111,109,112,114,101,115,115, 95, 56, 32, 48, 48, 48, 48, 48,
-/* 0x1240 */  49, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1250 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 51,
-/* 0x1260 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1270 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1280 */  76, 89, 10, 32, 49, 48, 32, 67, 97,108,108, 50, 68, 32, 32, 32,
-/* 0x1290 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x12a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x12b0 */  48, 32, 32, 48, 48, 48, 48, 48, 52, 51, 52, 32, 32, 50, 42, 42,
-/* 0x12c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x12d0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49,
-/* 0x12e0 */  32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,
-/* 0x12f0 */ 109,112,114,101,115,115, 95, 56, 32, 48, 48, 48, 48, 48, 48, 99,
-/* 0x1300 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1310 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 51, 56, 32,
-/* 0x1320 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1330 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1340 */  10, 32, 49, 50, 32, 67, 97,108,108, 50, 66, 32, 32, 32, 32, 32,
-/* 0x1350 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x1360 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1370 */  32, 48, 48, 48, 48, 48, 52,102, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1380 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1390 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 67,
-/* 0x13a0 */  97,108,108, 76, 90, 77, 65, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x13b0 */  48, 48, 48, 53, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x13c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x13d0 */  53, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x13e0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x13f0 */  79, 78, 76, 89, 10, 32, 49, 52, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1400 */  67, 79, 68, 69, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1410 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1420 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 53, 53, 52, 32, 32, 50,
-/* 0x1430 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1440 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53, 32, 76, 90, 77, 65,
-/* 0x1450 */  95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,
-/* 0x1460 */  51, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1470 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 53, 53, 52,
-/* 0x1480 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1490 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x14a0 */  89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x14b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x14c0 */  32, 69,120,101, 83,116, 97,114,116,  9, 48, 48, 48, 48, 48, 48,
-/* 0x14d0 */  48, 48, 32, 69,120,101, 83,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x14e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85,110,102,
-/* 0x14f0 */ 105,108,116,101,114, 95, 48,120, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x1500 */  48, 48, 48, 32, 85,110,102,105,108,116,101,114, 95, 48,120, 53,
-/* 0x1510 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1520 */ 100, 32, 32, 82,101,108,111, 99,115,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1530 */  48, 48, 32, 82,101,108,111, 99,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1540 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 73,109,112,111,114,
-/* 0x1550 */ 116,115,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 73,109,112,111,
-/* 0x1560 */ 114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1570 */  32, 32,100, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,
-/* 0x1580 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56,  9, 48, 48, 48,
-/* 0x1590 */  48, 48, 48, 48, 48, 32, 46,117, 99,108, 95,110,114,118, 50,101,
-/* 0x15a0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x15b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 46,
-/* 0x15c0 */ 117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,
-/* 0x15d0 */ 114,101,115,115, 95, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x15e0 */  46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,
-/* 0x15f0 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1600 */  32,108, 32, 32, 32, 32,100, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x1610 */ 118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x1620 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 46,117, 99,108, 95,110,
-/* 0x1630 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x1640 */  56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1650 */ 100, 32, 32, 67, 97,108,108, 76, 90, 77, 65,  9, 48, 48, 48, 48,
-/* 0x1660 */  48, 48, 48, 48, 32, 67, 97,108,108, 76, 90, 77, 65, 10, 48, 48,
-/* 0x1670 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1680 */  90, 77, 65, 95, 68, 69, 67, 79, 68, 69,  9, 48, 48, 48, 48, 48,
-/* 0x1690 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69, 10,
-/* 0x16a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x16b0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48,
-/* 0x16c0 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x16d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x16e0 */  32, 68,108,108, 83,116, 97,114,116,  9, 48, 48, 48, 48, 48, 48,
-/* 0x16f0 */  48, 48, 32, 68,108,108, 83,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x1700 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80,114,111,
-/* 0x1710 */  99,101,115,115, 69,110,100,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1720 */  32, 80,114,111, 99,101,115,115, 69,110,100, 10, 48, 48, 48, 48,
-/* 0x1730 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88,
-/* 0x1740 */  49, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 85,
-/* 0x1750 */  80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1760 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 97,108,108, 50, 69,  9,
-/* 0x1770 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 97,108,108, 50, 69, 10,
-/* 0x1780 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1790 */  32, 67, 97,108,108, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17a0 */  32, 67, 97,108,108, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17b0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 97,108,108, 50, 66,  9,
-/* 0x17c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 97,108,108, 50, 66, 10,
-/* 0x17d0 */  48, 48, 48, 48, 48, 48, 50, 99, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x17e0 */  32, 69,120,101, 83,116, 97,114,116,  9, 48, 48, 48, 48, 48, 48,
-/* 0x17f0 */  48, 48, 32, 83, 82, 67, 48, 10, 48, 48, 48, 48, 48, 48, 51, 52,
-/* 0x1800 */  32,103, 32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,
-/* 0x1810 */ 116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 68, 83, 84, 48, 10,
-/* 0x1820 */  48, 48, 48, 48, 48, 48, 51, 99, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1830 */  32, 69,120,101, 83,116, 97,114,116,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1840 */  48, 48, 32, 73, 65, 84, 84, 10, 48, 48, 48, 48, 48, 48, 52, 99,
-/* 0x1850 */  32,103, 32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,
-/* 0x1860 */ 116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 78, 84, 82, 10,
-/* 0x1870 */  48, 48, 48, 48, 48, 48, 52, 52, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1880 */  32, 85,110,102,105,108,116,101,114, 95, 48,120, 53, 48,  9, 48,
-/* 0x1890 */  48, 48, 48, 48, 48, 48, 48, 32, 70, 73, 66, 83, 10, 48, 48, 48,
-/* 0x18a0 */  48, 48, 48, 52, 56, 32,103, 32, 32, 32, 32, 32, 32, 32, 85,110,
-/* 0x18b0 */ 102,105,108,116,101,114, 95, 48,120, 53, 48,  9, 48, 48, 48, 48,
-/* 0x18c0 */  48, 48, 48, 48, 32, 70, 73, 66, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x18d0 */  53, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 82,101,108,111, 99,
-/* 0x18e0 */ 115,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 66, 82, 69, 76, 10,
-/* 0x18f0 */  48, 48, 48, 48, 48, 48, 98, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1900 */  32, 73,109,112,111,114,116,115,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1910 */  48, 32, 66, 73, 77, 80, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32,
-/* 0x1920 */ 103, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115,  9,
-/* 0x1930 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 79, 78, 65, 77, 10, 48, 48,
-/* 0x1940 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x1950 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116,
-/* 0x1960 */  97,114,116, 95,111,102, 95, 99,111,109,112,114,101,115,115,101,
-/* 0x1970 */ 100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1980 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1990 */  48, 32, 99,111,109,112,114,101,115,115,101,100, 95,108,101,110,
-/* 0x19a0 */ 103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x19b0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x19c0 */  48, 48, 48, 32,115,116, 97,114,116, 95,111,102, 95,117,110, 99,
-/* 0x19d0 */ 111,109,112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x19f0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,117,110, 99,111,109,112,
-/* 0x1a00 */ 114,101,115,115,101,100, 95,108,101,110,103,116,104, 10, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x1a20 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,111,114,
-/* 0x1a30 */ 105,103,105,110, 97,108, 95,101,110,116,114,121, 10, 48, 48, 48,
-/* 0x1a40 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x1a50 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,
-/* 0x1a60 */ 116,101,114, 95, 98,117,102,102,101,114, 95,115,116, 97,114,116,
-/* 0x1a70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a80 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a90 */  32,102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,101,
-/* 0x1aa0 */ 110,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1ab0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 32,115,116, 97,114,116, 95,111,102, 95,114,101,108,111,
-/* 0x1ad0 */  99,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1ae0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  48, 48, 32,115,116, 97,114,116, 95,111,102, 95,105,109,112,111,
-/* 0x1b00 */ 114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x1b10 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x1b20 */  48, 48, 48, 32,115,116, 97,114,116, 95,111,102, 95,100,108,108,
-/* 0x1b30 */  95,110, 97,109,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b40 */ 103, 32, 32, 32, 32, 32, 70, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x1b50 */  50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  9,
-/* 0x1b60 */  48, 48, 48, 48, 48, 49, 49, 52, 32,117, 99,108, 95,110,114,118,
-/* 0x1b70 */  50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x1b80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70,
-/* 0x1b90 */  32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,
-/* 0x1ba0 */ 109,112,114,101,115,115, 95, 56,  9, 48, 48, 48, 48, 48, 49, 48,
-/* 0x1bb0 */  48, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,
-/* 0x1bc0 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 32,103, 32, 32, 32, 32, 32, 70, 32, 46,117, 99,108, 95,110,
-/* 0x1be0 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x1bf0 */  56,  9, 48, 48, 48, 48, 48, 48, 99, 52, 32,117, 99,108, 95,110,
-/* 0x1c00 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x1c10 */  56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1c20 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x1c50 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109,
-/* 0x1c60 */  97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c80 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1c90 */ 122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x1cb0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,
-/* 0x1cc0 */ 114,111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1cd0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1ce0 */  82, 32, 91, 68,108,108, 83,116, 97,114,116, 93, 58, 10, 79, 70,
-/* 0x1cf0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x1d00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x1d10 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1d20 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,
-/* 0x1d30 */ 114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x1d40 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,120,101, 83,
-/* 0x1d50 */ 116, 97,114,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x1d60 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d70 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 52,
-/* 0x1d80 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1d90 */  32, 32, 32, 69,120,101, 83,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1db0 */  32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,116, 10,
-/* 0x1dc0 */  48, 48, 48, 48, 48, 48, 50, 99, 32, 82, 95, 65, 82, 77, 95, 65,
-/* 0x1dd0 */  66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116,
-/* 0x1de0 */  95,111,102, 95, 99,111,109,112,114,101,115,115,101,100, 10, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66,
-/* 0x1e00 */  83, 51, 50, 32, 32, 32, 32, 32, 32, 32, 99,111,109,112,114,101,
-/* 0x1e10 */ 115,115,101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 51, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x1e30 */  32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,102, 95,
-/* 0x1e40 */ 117,110, 99,111,109,112,114,101,115,115,101,100, 10, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 51, 56, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51,
-/* 0x1e60 */  50, 32, 32, 32, 32, 32, 32, 32,117,110, 99,111,109,112,114,101,
-/* 0x1e70 */ 115,115,101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x1e80 */  48, 48, 52, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x1e90 */  32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,
-/* 0x1ea0 */ 101,110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1eb0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 85,
-/* 0x1ec0 */ 110,102,105,108,116,101,114, 95, 48,120, 53, 48, 93, 58, 10, 79,
-/* 0x1ed0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x1ee0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1f00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 85,110,102,105,108,
-/* 0x1f10 */ 116,101,114, 95, 48,120, 53, 48, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x1f20 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1f30 */  32, 32, 32, 32, 85,110,102,105,108,116,101,114, 95, 48,120, 53,
-/* 0x1f40 */  48, 10, 48, 48, 48, 48, 48, 48, 52, 48, 32, 82, 95, 65, 82, 77,
-/* 0x1f50 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 85,110,102,
-/* 0x1f60 */ 105,108,116,101,114, 95, 48,120, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x1f70 */  48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32,
-/* 0x1f80 */  32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 98,117,102,
-/* 0x1f90 */ 102,101,114, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  52, 56, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 98,117,102,102,
-/* 0x1fc0 */ 101,114, 95,101,110,100, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1fd0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1fe0 */  82,101,108,111, 99,115, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x1ff0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2000 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2020 */  32, 32, 32, 32, 32, 82,101,108,111, 99,115, 10, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2040 */  32, 32, 32, 32, 32, 32, 32, 82,101,108,111, 99,115, 10, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83,
-/* 0x2060 */  51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,
-/* 0x2070 */ 102, 95,114,101,108,111, 99,115, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2080 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2090 */  32, 91, 73,109,112,111,114,116,115, 93, 58, 10, 79, 70, 70, 83,
-/* 0x20a0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x20c0 */  48, 48, 48, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x20d0 */  32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115, 10,
-/* 0x20e0 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x20f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,
-/* 0x2100 */ 116,115, 10, 48, 48, 48, 48, 48, 48, 50, 99, 32, 82, 95, 65, 82,
-/* 0x2110 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,
-/* 0x2120 */ 112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 51, 52, 32, 82,
-/* 0x2130 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 73,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2150 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2160 */  32, 32, 32, 32, 73,109,112,111,114,116,115, 10, 48, 48, 48, 48,
-/* 0x2170 */  48, 48, 53, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115, 10, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x21a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,
-/* 0x21b0 */ 115, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77,
-/* 0x21c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,
-/* 0x21d0 */ 111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95,
-/* 0x21e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21f0 */  73,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 56, 48,
-/* 0x2200 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2210 */  32, 32, 32, 73,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48,
-/* 0x2220 */  48, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2230 */  32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115, 10, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2250 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115,
-/* 0x2260 */  10, 48, 48, 48, 48, 48, 48, 98, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2270 */  65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,
-/* 0x2280 */ 116, 95,111,102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48,
-/* 0x2290 */  48, 48, 48, 98, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51,
-/* 0x22a0 */  50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,102,
-/* 0x22b0 */  95,100,108,108, 95,110, 97,109,101,115, 10, 10, 82, 69, 76, 79,
-/* 0x22c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x22d0 */  79, 82, 32, 91, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x22e0 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 93, 58, 10, 79, 70,
-/* 0x22f0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2300 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2320 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x2330 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x2340 */  56, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2350 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,
-/* 0x2360 */ 108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,
-/* 0x2370 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95,
-/* 0x2380 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2390 */  46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
-/* 0x23a0 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 48,
-/* 0x23b0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x23c0 */  32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101,
-/* 0x23d0 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x23e0 */  48, 53, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x23f0 */  32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101,
-/* 0x2400 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x2410 */  48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2420 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x2430 */ 118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x2440 */  10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2450 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108,
-/* 0x2460 */  95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x2470 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x2480 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,
-/* 0x2490 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
-/* 0x24a0 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32,
-/* 0x24b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x24c0 */  32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
-/* 0x24d0 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x24e0 */  57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x24f0 */  32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,
-/* 0x2500 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x2510 */  48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2520 */  32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x2530 */  50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x2540 */  48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2550 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,
-/* 0x2560 */ 110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2570 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82,
-/* 0x2580 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117,
-/* 0x2590 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
-/* 0x25a0 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82,
-/* 0x25b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25c0 */  32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,
-/* 0x25d0 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x25e0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x2600 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x2610 */  48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2620 */  32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,
-/* 0x2630 */ 101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48,
-/* 0x2640 */  48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2650 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x2660 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x2670 */  56, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2680 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,
-/* 0x2690 */ 108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,
-/* 0x26a0 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,100, 52, 32, 82, 95,
-/* 0x26b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26c0 */  46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
-/* 0x26d0 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,100, 99,
-/* 0x26e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x26f0 */  32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101,
-/* 0x2700 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x2710 */  48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2720 */  32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101,
-/* 0x2730 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x2740 */  48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2750 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x2760 */ 118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x2770 */  10, 48, 48, 48, 48, 48, 49, 49, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2780 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108,
-/* 0x2790 */  95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x27a0 */ 115, 95, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x27b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 97,108,
-/* 0x27c0 */ 108, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x27d0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27e0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x27f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2800 */  32, 32,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,
-/* 0x2810 */ 109,112,114,101,115,115, 95, 56, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2820 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2830 */  32, 91, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
-/* 0x2840 */ 111,109,112,114,101,115,115, 95, 56, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2850 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2860 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2870 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2880 */  32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x2890 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x28a0 */  48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x28b0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,
-/* 0x28c0 */ 110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x28d0 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82,
-/* 0x28e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117,
-/* 0x28f0 */  99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,
-/* 0x2900 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82,
-/* 0x2910 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2920 */  32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,
-/* 0x2930 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53,
-/* 0x2940 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2950 */  32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,
-/* 0x2960 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x2970 */  48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2980 */  32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,
-/* 0x2990 */ 100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48,
-/* 0x29a0 */  48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x29b0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x29c0 */ 114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x29d0 */  56, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x29e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,
-/* 0x29f0 */ 108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,
-/* 0x2a00 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95,
-/* 0x2a10 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a20 */  46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,
-/* 0x2a30 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 57, 52,
-/* 0x2a40 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2a50 */  32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
-/* 0x2a60 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x2a70 */  48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2a80 */  32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100,
-/* 0x2a90 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x2aa0 */  48, 48, 48, 48, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2ab0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x2ac0 */ 118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x2ad0 */  10, 48, 48, 48, 48, 48, 48, 98, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2ae0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108,
-/* 0x2af0 */  95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x2b00 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65,
-/* 0x2b10 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,
-/* 0x2b20 */ 117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,
-/* 0x2b30 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32,
-/* 0x2b40 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2b50 */  32, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
-/* 0x2b60 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2b70 */ 100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2b80 */  32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,
-/* 0x2b90 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x2ba0 */  48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2bb0 */  32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x2bc0 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x2bd0 */  48, 48, 48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2be0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,
-/* 0x2bf0 */ 110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2c00 */  95, 56, 10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82,
-/* 0x2c10 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117,
-/* 0x2c20 */  99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,
-/* 0x2c30 */ 101,115,115, 95, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2c40 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x2c50 */  97,108,108, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2c60 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c70 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c80 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2c90 */  32, 32, 32, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
-/* 0x2ca0 */  99,111,109,112,114,101,115,115, 95, 56, 10, 10, 82, 69, 76, 79,
-/* 0x2cb0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2cc0 */  79, 82, 32, 91, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,
-/* 0x2cd0 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 93, 58, 10, 79, 70,
-/* 0x2ce0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2cf0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2d00 */  48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2d10 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x2d20 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x2d30 */  56, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2d40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,
-/* 0x2d50 */ 108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,
-/* 0x2d60 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95,
-/* 0x2d70 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d80 */  46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
-/* 0x2d90 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 52,
-/* 0x2da0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2db0 */  32, 32, 32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101,
-/* 0x2dc0 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x2dd0 */  48, 54, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2de0 */  32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50, 98,
-/* 0x2df0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x2e00 */  48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2e10 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x2e20 */ 118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x2e30 */  10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2e40 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108,
-/* 0x2e50 */  95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x2e60 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x2e70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,
-/* 0x2e80 */ 117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,
-/* 0x2e90 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32,
-/* 0x2ea0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2eb0 */  32, 32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,
-/* 0x2ec0 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2ed0 */  56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ee0 */  32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,
-/* 0x2ef0 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x2f00 */  48, 48, 48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2f10 */  32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x2f20 */  50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x2f30 */  48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2f40 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,
-/* 0x2f50 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2f60 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82,
-/* 0x2f70 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117,
-/* 0x2f80 */  99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,
-/* 0x2f90 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82,
-/* 0x2fa0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2fb0 */  32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,
-/* 0x2fc0 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x2fd0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2fe0 */  32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,
-/* 0x2ff0 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 10, 82, 69, 76,
-/* 0x3000 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x3010 */  70, 79, 82, 32, 91, 67, 97,108,108, 50, 66, 93, 58, 10, 79, 70,
-/* 0x3020 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3030 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3040 */  48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3050 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32,117, 99,108, 95,110,114,
-/* 0x3060 */ 118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x3070 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3080 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 97,108,108, 76, 90,
-/* 0x3090 */  77, 65, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x30a0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30b0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 99, 32, 82,
-/* 0x30c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30d0 */  32, 67, 97,108,108, 76, 90, 77, 65, 10, 48, 48, 48, 48, 48, 48,
-/* 0x30e0 */  51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x30f0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69,
-/* 0x3100 */  10, 48, 48, 48, 48, 48, 48, 52, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3110 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 67, 97,108,108,
-/* 0x3120 */  76, 90, 77, 65, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95,
-/* 0x3130 */  65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3140 */ 108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48,
-/* 0x3150 */  48, 52, 56, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32,
-/* 0x3160 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107,
-/* 0x3170 */  95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 52, 99,
-/* 0x3180 */  32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32,
-/* 0x3190 */  32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48,
-/* 0x31a0 */  48, 48, 48, 48, 53, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83,
-/* 0x31b0 */  51, 50, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,
-/* 0x31c0 */ 111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x31d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x31e0 */  32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 93, 58, 10, 79,
-/* 0x31f0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x3200 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x3210 */  48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3220 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3230 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82,
-/* 0x3240 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3250 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3260 */  48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3270 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3280 */  48, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3290 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x32a0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,102, 52,
-/* 0x32b0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x32c0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x32d0 */  48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x32e0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x32f0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65,
-/* 0x3300 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3310 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3320 */  52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3330 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3340 */  48, 48, 48, 48, 48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3350 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3360 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82,
-/* 0x3370 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3380 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3390 */  48, 49,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x33a0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x33b0 */  48, 10, 48, 48, 48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x33c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x33d0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56,
-/* 0x33e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x33f0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3400 */  48, 48, 48, 50, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3410 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3420 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65,
-/* 0x3430 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3440 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3450 */  51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3460 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3470 */  48, 48, 48, 48, 48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3480 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3490 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82,
-/* 0x34a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x34b0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x34c0 */  48, 50, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x34d0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x34e0 */  48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77,
-/* 0x34f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3500 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56,
-/* 0x3510 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3520 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3530 */  48, 48, 48, 50,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3540 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3550 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65,
-/* 0x3560 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3570 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x3580 */  48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3590 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x35a0 */  48, 48, 48, 48, 48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x35b0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x35c0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82,
-/* 0x35d0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35e0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x35f0 */  48, 51, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3600 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3610 */  48, 10, 48, 48, 48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3620 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3630 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99,
-/* 0x3640 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3650 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3660 */  48, 48, 48, 51,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3670 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3680 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65,
-/* 0x3690 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x36a0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x36b0 */  50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x36c0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x36d0 */  48, 48, 48, 48, 48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x36e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x36f0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82,
-/* 0x3700 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3710 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3720 */  48, 52, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3730 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3740 */  48, 10, 48, 48, 48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3750 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3760 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48,
-/* 0x3770 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3780 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3790 */  48, 48, 48, 52,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x37a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x37b0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65,
-/* 0x37c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x37d0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x37e0 */ 102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x37f0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3800 */  48, 48, 48, 48, 48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3810 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3820 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82,
-/* 0x3830 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3840 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3850 */  48, 53, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3860 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3870 */  48, 10, 48, 48, 48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3880 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3890 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48,
-/* 0x38a0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x38b0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x38c0 */  48, 48, 48, 53,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x38d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x38e0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65,
-/* 0x38f0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3900 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x3910 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3920 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3930 */  48, 48, 48, 48, 48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3940 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3950 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82,
-/* 0x3960 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3970 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3980 */  48, 54, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3990 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x39a0 */  48, 10, 48, 48, 48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x39b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x39c0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 54,100, 48,
-/* 0x39d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x39e0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x39f0 */  48, 48, 48, 54,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3a00 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3a10 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65,
-/* 0x3a20 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3a30 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x3a40 */  50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3a50 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3a60 */  48, 48, 48, 48, 48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3a70 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3a80 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82,
-/* 0x3a90 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3aa0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3ab0 */  48, 55, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3ac0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3ad0 */  48, 10, 48, 48, 48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3ae0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3af0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52,
-/* 0x3b00 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3b10 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3b20 */  48, 48, 48, 55,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3b30 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3b40 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65,
-/* 0x3b50 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3b60 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x3b70 */  50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3b80 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3b90 */  48, 48, 48, 48, 48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3ba0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3bb0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82,
-/* 0x3bc0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3bd0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3be0 */  48, 56, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3bf0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3c00 */  48, 10, 48, 48, 48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3c10 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3c20 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 56,101, 56,
-/* 0x3c30 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3c40 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3c50 */  48, 48, 48, 56,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3c60 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3c70 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65,
-/* 0x3c80 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3c90 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 57,
-/* 0x3ca0 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3cb0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3cc0 */  48, 48, 48, 48, 48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3cd0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3ce0 */  68, 69, 67, 49, 48, 10
+/* 0x0e80 */   1,  0,160,227, 48,208,141,226,240,143,189,232, 16,  0,  0,  0,
+/* 0x0e90 */  42,  0,  0,  0,170,  0,  0,  0,160, 19,  0,  0,  0,  0,  0,  0,
+/* 0x0ea0 */  52,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x0eb0 */  60,  0,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x0ec0 */ 144,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,
+/* 0x0ed0 */ 148,  0,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0,
+/* 0x0ee0 */ 224,  0,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,
+/* 0x0ef0 */  64,  1,  0,  0,188,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,
+/* 0x0f00 */ 252,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x0f10 */  28,  2,  0,  0, 20,  1,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,
+/* 0x0f20 */  48,  3,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x0f30 */  52,  3,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,122,  0,  0,  0,
+/* 0x0f40 */  52,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,
+/* 0x0f50 */  56,  4,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,
+/* 0x0f60 */ 252,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,160,  0,  0,  0,
+/* 0x0f70 */   0,  5,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,169,  0,  0,  0,
+/* 0x0f80 */  84,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,  0,  0,  0,
+/* 0x0f90 */  84,  5,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x0fa0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,
+/* 0x0fb0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0,
+/* 0x0fc0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,
+/* 0x0fd0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x0fe0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x0ff0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,
+/* 0x1000 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,  0,  0,  0,
+/* 0x1010 */  13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,169,  0,  0,  0,
+/* 0x1020 */  14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,  0,  0,  0,
+/* 0x1030 */  15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1040 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1050 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,
+/* 0x1060 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,
+/* 0x1070 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,122,  0,  0,  0,
+/* 0x1080 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,
+/* 0x1090 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,  0,  0,  0,
+/* 0x10a0 */   1,  0,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,197,  0,  0,  0,
+/* 0x10b0 */   1,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,202,  0,  0,  0,
+/* 0x10c0 */   1,  0,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0,
+/* 0x10d0 */   1,  0,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,212,  0,  0,  0,
+/* 0x10e0 */   3,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,217,  0,  0,  0,
+/* 0x10f0 */   3,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,222,  0,  0,  0,
+/* 0x1100 */   4,  0,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,227,  0,  0,  0,
+/* 0x1110 */   5,  0,  0,  0,176,  0,  0,  0,  0,  0,  0,  0,232,  0,  0,  0,
+/* 0x1120 */   5,  0,  0,  0,180,  0,  0,  0,  0,  0,  0,  0,237,  0,  0,  0,
+/* 0x1130 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  1,  1,  0,  0,
+/* 0x1140 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 19,  1,  0,  0,
+/* 0x1150 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 41,  1,  0,  0,
+/* 0x1160 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 61,  1,  0,  0,
+/* 0x1170 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 76,  1,  0,  0,
+/* 0x1180 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 96,  1,  0,  0,
+/* 0x1190 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,114,  1,  0,  0,
+/* 0x11a0 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,130,  1,  0,  0,
+/* 0x11b0 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,147,  1,  0,  0,
+/* 0x11c0 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,166,  1,  0,  0,
+/* 0x11d0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  1,  0,  0,
+/* 0x11e0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0,
+/* 0x11f0 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,235,  1,  0,  0,
+/* 0x1200 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,246,  1,  0,  0,
+/* 0x1210 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  8,  2,  0,  0,
+/* 0x1220 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 19,  2,  0,  0,
+/* 0x1230 */  17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1240 */   4,  0,  0,  0, 35,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1250 */   0,  0,  0,  0,  1,  0,  0,  0, 20,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1260 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1270 */  28,  0,  0,  0, 35,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1280 */   0,  0,  0,  0,  1,  0,  0,  0, 44,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1290 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x12a0 */  48,  0,  0,  0, 46,  2,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12b0 */   0,  0,  0,  0,  1,  0,  0,  0, 52,  0,  0,  0, 46,  2,  0,  0,
+/* 0x12c0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x12d0 */  56,  0,  0,  0, 46,  2,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12e0 */   0,  0,  0,  0,  1,  0,  0,  0, 76,  0,  0,  0, 46,  2,  0,  0,
+/* 0x12f0 */  29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1300 */  16,  0,  0,  0, 35,  2,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1310 */   0,  0,  0,  0,  3,  0,  0,  0, 32,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1320 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1330 */  64,  0,  0,  0, 35,  2,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1340 */   0,  0,  0,  0,  3,  0,  0,  0, 68,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1350 */  30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1360 */  72,  0,  0,  0, 46,  2,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1370 */   0,  0,  0,  0,  4,  0,  0,  0, 16,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1380 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1390 */  88,  0,  0,  0, 35,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13a0 */   0,  0,  0,  0,  4,  0,  0,  0, 92,  0,  0,  0, 46,  2,  0,  0,
+/* 0x13b0 */  32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x13c0 */  12,  0,  0,  0, 35,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13d0 */   0,  0,  0,  0,  5,  0,  0,  0, 16,  0,  0,  0, 35,  2,  0,  0,
+/* 0x13e0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x13f0 */  44,  0,  0,  0, 35,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1400 */   0,  0,  0,  0,  5,  0,  0,  0, 52,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1410 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1420 */  64,  0,  0,  0, 35,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1430 */   0,  0,  0,  0,  5,  0,  0,  0, 84,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1440 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1450 */  88,  0,  0,  0, 35,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1460 */   0,  0,  0,  0,  5,  0,  0,  0,104,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1470 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1480 */ 108,  0,  0,  0, 35,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  5,  0,  0,  0,128,  0,  0,  0, 35,  2,  0,  0,
+/* 0x14a0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x14b0 */ 136,  0,  0,  0, 35,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0,  5,  0,  0,  0,156,  0,  0,  0, 35,  2,  0,  0,
+/* 0x14d0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x14e0 */ 176,  0,  0,  0, 46,  2,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0,  5,  0,  0,  0,180,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1500 */  34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1510 */  16,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,  7,  0,  0,  0, 68,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1530 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1540 */  72,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */   0,  0,  0,  0,  7,  0,  0,  0, 80,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1560 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1570 */  92,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */   0,  0,  0,  0,  7,  0,  0,  0,104,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1590 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x15a0 */ 116,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   0,  0,  0,  0,  7,  0,  0,  0,120,  0,  0,  0, 35,  2,  0,  0,
+/* 0x15c0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x15d0 */ 132,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */   0,  0,  0,  0,  7,  0,  0,  0,148,  0,  0,  0, 35,  2,  0,  0,
+/* 0x15f0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1600 */ 156,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  7,  0,  0,  0,160,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1620 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1630 */ 168,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0,  7,  0,  0,  0,172,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1650 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1660 */ 184,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  7,  0,  0,  0,188,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1680 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1690 */ 196,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  7,  0,  0,  0,208,  0,  0,  0, 35,  2,  0,  0,
+/* 0x16b0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x16c0 */ 212,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  7,  0,  0,  0,220,  0,  0,  0, 35,  2,  0,  0,
+/* 0x16e0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x16f0 */ 228,  0,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  7,  0,  0,  0, 12,  1,  0,  0, 35,  2,  0,  0,
+/* 0x1710 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1720 */  16,  1,  0,  0, 35,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1740 */  35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1750 */  16,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  9,  0,  0,  0, 68,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1770 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1780 */  72,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  9,  0,  0,  0, 80,  0,  0,  0, 35,  2,  0,  0,
+/* 0x17a0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x17b0 */  92,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  9,  0,  0,  0,104,  0,  0,  0, 35,  2,  0,  0,
+/* 0x17d0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x17e0 */ 116,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  9,  0,  0,  0,120,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1800 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1810 */ 132,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  9,  0,  0,  0,148,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1830 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1840 */ 156,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  9,  0,  0,  0,164,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1860 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1870 */ 176,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  9,  0,  0,  0,184,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1890 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x18a0 */ 196,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  9,  0,  0,  0,208,  0,  0,  0, 35,  2,  0,  0,
+/* 0x18c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x18d0 */ 212,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  9,  0,  0,  0,248,  0,  0,  0, 35,  2,  0,  0,
+/* 0x18f0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1900 */ 252,  0,  0,  0, 35,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1920 */  36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1930 */  16,  0,  0,  0, 35,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0, 11,  0,  0,  0, 72,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1950 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1960 */  80,  0,  0,  0, 35,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0, 11,  0,  0,  0, 84,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1980 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1990 */ 100,  0,  0,  0, 35,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0, 11,  0,  0,  0,104,  0,  0,  0, 35,  2,  0,  0,
+/* 0x19b0 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x19c0 */ 108,  0,  0,  0, 35,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0, 11,  0,  0,  0,120,  0,  0,  0, 35,  2,  0,  0,
+/* 0x19e0 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x19f0 */ 136,  0,  0,  0, 35,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0, 11,  0,  0,  0,140,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1a10 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1a20 */ 148,  0,  0,  0, 35,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0, 11,  0,  0,  0,156,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1a40 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1a50 */ 160,  0,  0,  0, 35,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0, 11,  0,  0,  0,188,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1a70 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1a80 */ 192,  0,  0,  0, 35,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1aa0 */  37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1ab0 */  28,  0,  0,  0, 35,  2,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0, 13,  0,  0,  0, 56,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1ad0 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1ae0 */  64,  0,  0,  0, 35,  2,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0, 13,  0,  0,  0, 68,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1b00 */  38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1b10 */  72,  0,  0,  0, 46,  2,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0, 13,  0,  0,  0, 76,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1b30 */  40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1b40 */  80,  0,  0,  0, 46,  2,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0, 15,  0,  0,  0,116,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1b60 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1b70 */ 144,  0,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0, 15,  0,  0,  0,184,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1b90 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ba0 */ 204,  0,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0, 15,  0,  0,  0,244,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1bc0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1bd0 */   0,  1,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0, 15,  0,  0,  0,  8,  1,  0,  0, 35,  2,  0,  0,
+/* 0x1bf0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c00 */  68,  1,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0, 15,  0,  0,  0,144,  1,  0,  0, 35,  2,  0,  0,
+/* 0x1c20 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c30 */ 204,  1,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0, 15,  0,  0,  0,216,  1,  0,  0, 35,  2,  0,  0,
+/* 0x1c50 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c60 */   4,  2,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0, 15,  0,  0,  0, 24,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1c80 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c90 */  32,  2,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0, 15,  0,  0,  0, 52,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1cb0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1cc0 */  60,  2,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0, 15,  0,  0,  0, 64,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1ce0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1cf0 */  76,  2,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0, 15,  0,  0,  0, 88,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1d10 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1d20 */ 164,  2,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0, 15,  0,  0,  0,200,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1d40 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1d50 */ 232,  2,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0, 15,  0,  0,  0,  4,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1d70 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1d80 */  12,  3,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0, 15,  0,  0,  0, 60,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1da0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1db0 */ 136,  3,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0, 15,  0,  0,  0,160,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1dd0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1de0 */ 168,  3,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0, 15,  0,  0,  0,204,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1e00 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1e10 */ 224,  3,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0, 15,  0,  0,  0,232,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1e30 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1e40 */  36,  4,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0, 15,  0,  0,  0, 56,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1e60 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1e70 */ 108,  4,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0, 15,  0,  0,  0,132,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1e90 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ea0 */ 140,  4,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0, 15,  0,  0,  0,176,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1ec0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ed0 */ 212,  4,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0, 15,  0,  0,  0,236,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1ef0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f00 */ 244,  4,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0, 15,  0,  0,  0, 24,  5,  0,  0, 35,  2,  0,  0,
+/* 0x1f20 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f30 */  60,  5,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0, 15,  0,  0,  0,152,  5,  0,  0, 35,  2,  0,  0,
+/* 0x1f50 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f60 */ 160,  5,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0, 15,  0,  0,  0,192,  5,  0,  0, 35,  2,  0,  0,
+/* 0x1f80 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f90 */ 228,  5,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0, 15,  0,  0,  0,252,  5,  0,  0, 35,  2,  0,  0,
+/* 0x1fb0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1fc0 */   4,  6,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0, 15,  0,  0,  0, 36,  6,  0,  0, 35,  2,  0,  0,
+/* 0x1fe0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ff0 */  72,  6,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0, 15,  0,  0,  0,128,  6,  0,  0, 35,  2,  0,  0,
+/* 0x2010 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2020 */ 140,  6,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0, 15,  0,  0,  0,208,  6,  0,  0, 35,  2,  0,  0,
+/* 0x2040 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2050 */ 236,  6,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0, 15,  0,  0,  0, 28,  7,  0,  0, 35,  2,  0,  0,
+/* 0x2070 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2080 */  40,  7,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0, 15,  0,  0,  0,108,  7,  0,  0, 35,  2,  0,  0,
+/* 0x20a0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x20b0 */ 124,  7,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0, 15,  0,  0,  0,156,  7,  0,  0, 35,  2,  0,  0,
+/* 0x20d0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x20e0 */ 184,  7,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0, 15,  0,  0,  0,196,  7,  0,  0, 35,  2,  0,  0,
+/* 0x2100 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2110 */ 208,  7,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0, 15,  0,  0,  0,244,  7,  0,  0, 35,  2,  0,  0,
+/* 0x2130 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2140 */  32,  8,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0, 15,  0,  0,  0, 44,  8,  0,  0, 35,  2,  0,  0,
+/* 0x2160 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2170 */ 124,  8,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0, 15,  0,  0,  0,136,  8,  0,  0, 35,  2,  0,  0,
+/* 0x2190 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x21a0 */ 160,  8,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0, 15,  0,  0,  0,232,  8,  0,  0, 35,  2,  0,  0,
+/* 0x21c0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x21d0 */ 244,  8,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0, 15,  0,  0,  0,252,  8,  0,  0, 35,  2,  0,  0,
+/* 0x21f0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2200 */   4,  9,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0, 15,  0,  0,  0, 40,  9,  0,  0, 35,  2,  0,  0,
+/* 0x2220 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,108,108, 83,
+/* 0x2230 */ 116, 97,114,116,  0, 69,120,101, 83,116, 97,114,116,  0, 80,114,
+/* 0x2240 */ 111, 99,101,115,115, 69,110,100,  0, 85,110,102,105,108,116,101,
+/* 0x2250 */ 114, 95, 48,120, 53, 48,  0, 82,101,108,111, 99,115,  0, 73,109,
+/* 0x2260 */ 112,111,114,116,115,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 46,
+/* 0x2270 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
+/* 0x2280 */ 114,101,115,115, 95, 56,  0, 67, 97,108,108, 50, 69,  0, 46,117,
+/* 0x2290 */  99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,
+/* 0x22a0 */ 101,115,115, 95, 56,  0, 67, 97,108,108, 50, 68,  0, 46,117, 99,
+/* 0x22b0 */ 108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,
+/* 0x22c0 */ 115,115, 95, 56,  0, 67, 97,108,108, 50, 66,  0, 67, 97,108,108,
+/* 0x22d0 */  76, 90, 77, 65,  0, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69,
+/* 0x22e0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 83, 82, 67, 48,
+/* 0x22f0 */   0, 68, 83, 84, 48,  0, 73, 65, 84, 84,  0, 69, 78, 84, 82,  0,
+/* 0x2300 */  70, 73, 66, 83,  0, 70, 73, 66, 69,  0, 66, 82, 69, 76,  0, 66,
+/* 0x2310 */  73, 77, 80,  0, 79, 78, 65, 77,  0,115,116, 97,114,116, 95,111,
+/* 0x2320 */ 102, 95, 99,111,109,112,114,101,115,115,101,100,  0, 99,111,109,
+/* 0x2330 */ 112,114,101,115,115,101,100, 95,108,101,110,103,116,104,  0,115,
+/* 0x2340 */ 116, 97,114,116, 95,111,102, 95,117,110, 99,111,109,112,114,101,
+/* 0x2350 */ 115,115,101,100,  0,117,110, 99,111,109,112,114,101,115,115,101,
+/* 0x2360 */ 100, 95,108,101,110,103,116,104,  0,111,114,105,103,105,110, 97,
+/* 0x2370 */ 108, 95,101,110,116,114,121,  0,102,105,108,116,101,114, 95, 98,
+/* 0x2380 */ 117,102,102,101,114, 95,115,116, 97,114,116,  0,102,105,108,116,
+/* 0x2390 */ 101,114, 95, 98,117,102,102,101,114, 95,101,110,100,  0,115,116,
+/* 0x23a0 */  97,114,116, 95,111,102, 95,114,101,108,111, 99,115,  0,115,116,
+/* 0x23b0 */  97,114,116, 95,111,102, 95,105,109,112,111,114,116,115,  0,115,
+/* 0x23c0 */ 116, 97,114,116, 95,111,102, 95,100,108,108, 95,110, 97,109,101,
+/* 0x23d0 */ 115,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,
+/* 0x23e0 */ 109,112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118,
+/* 0x23f0 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,
+/* 0x2400 */ 117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,
+/* 0x2410 */ 114,101,115,115, 95, 56,  0,108,122,109, 97, 95,117, 95,108,101,
+/* 0x2420 */ 110,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,
+/* 0x2430 */ 117,115,116,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,108,
+/* 0x2440 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,  0, 82,
+/* 0x2450 */  95, 65, 82, 77, 95, 80, 67, 50, 52,  0, 82, 95, 65, 82, 77, 95,
+/* 0x2460 */  65, 66, 83, 51, 50,  0,140, 14,  0,  0, 85, 80, 88, 76
 };
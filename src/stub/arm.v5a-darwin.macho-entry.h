@@ -1,5 +1,5 @@
 /* arm.v5a-darwin.macho-entry.h
-   created from arm.v5a-darwin.macho-entry.bin, 14661 (0x3945) bytes
+   created from arm.v5a-darwin.macho-entry.bin, 10399 (0x289f) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_SIZE    14661
-#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_ADLER32 0x685921b4
-#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_CRC32   0x49499808
+#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_SIZE    10399
+#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_ADLER32 0xf5e2233e
+#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_CRC32   0xd32aa4d2
 
-unsigned char stub_arm_v5a_darwin_macho_entry[14661] = {
+unsigned char stub_arm_v5a_darwin_macho_entry[10399] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  68, 20,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -349,608 +349,341 @@ unsigned char stub_arm_v5a_darwin_macho_entry[14661] = {
 /* 0x1360 */   5,192,160,227,128,  0,  0,239,  2,  1,128, 35, 30,255, 47,225,
 /* 0x1370 */  20,  0, 45,229,  6,128,160,225,  4,  0,150,228,  0,128, 72,224,
 /* 0x1380 */  16,128,141,229,  6,160,160,225,  4,  0,150,228,  0,160, 74,224,
-/* 0x1390 */   8,176, 64,226,254,255,255,235,102,105,108,101, 32,102,111,114,
-/* 0x13a0 */ 109, 97,116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,
-/* 0x13b0 */  97,114,109, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x13c0 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x13d0 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x13e0 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x13f0 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x1400 */ 108, 97,103,115, 10, 32, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1410 */  78, 88, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32,
-/* 0x1420 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1430 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50,
-/* 0x1440 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1450 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1460 */  32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x1470 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1480 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1490 */  48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x14a0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x14b0 */  89, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32,
-/* 0x14c0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 52, 52, 32, 32, 48, 48,
-/* 0x14d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x14e0 */  32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48,
-/* 0x14f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1500 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32,
-/* 0x1510 */  78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1520 */  48, 48, 48, 49, 51, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1530 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1540 */  48, 49, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1550 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1560 */  68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32,
-/* 0x1570 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 52,
-/* 0x1580 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1590 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 98, 52, 32, 32,
-/* 0x15a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x15b0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x15c0 */  32, 32, 53, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32,
-/* 0x15d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x15e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x15f0 */  48, 48, 48, 48, 48, 51, 97, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1600 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1610 */  76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1620 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 98, 99, 32, 32, 48,
-/* 0x1630 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1640 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 97, 56, 32, 32, 50, 42, 42,
-/* 0x1650 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1660 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55,
-/* 0x1670 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48,
-/* 0x1680 */  48, 48, 48, 48, 57, 51, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1690 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x16a0 */  48, 48, 52, 54, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x16b0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x16c0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95,
-/* 0x16d0 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 52, 55,
-/* 0x16e0 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x16f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 57, 99, 32,
-/* 0x1700 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1710 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1720 */  10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32,
-/* 0x1730 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1740 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1750 */  32, 48, 48, 48, 48, 49, 50, 49, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1760 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1770 */  78, 76, 89, 10, 32, 49, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x1780 */  89, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1790 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x17a0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 49, 52, 32, 32, 50, 42,
-/* 0x17b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x17c0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 77, 65, 67, 72, 77,
-/* 0x17d0 */  65, 73, 78, 90, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 56,
-/* 0x17e0 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x17f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 49, 52, 32,
-/* 0x1800 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1810 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1820 */  10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48,
-/* 0x1830 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1840 */  78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1850 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1860 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48,
-/* 0x1870 */  48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1880 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1890 */  66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66,
-/* 0x18a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x18b0 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48,
-/* 0x18c0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x18d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x18e0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48,
-/* 0x18f0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x1900 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1910 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48,
-/* 0x1920 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1930 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1940 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x1950 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1960 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1970 */  32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x19a0 */  77, 65, 67, 72, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48,
-/* 0x19b0 */  48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x19c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x19d0 */  86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x19e0 */  78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65,
-/* 0x1a00 */  73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95,
-/* 0x1a10 */  84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1a20 */  32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,  9,
-/* 0x1a30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1a40 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1a50 */  32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88,  9, 48, 48,
-/* 0x1a60 */  48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78,
-/* 0x1a80 */  82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 49, 52, 52, 32,117, 99,
-/* 0x1a90 */ 108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,
-/* 0x1aa0 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1ab0 */  32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 49, 51, 48, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,
-/* 0x1ad0 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86,
-/* 0x1af0 */  50, 66,  9, 48, 48, 48, 48, 48, 48,102, 52, 32,117, 99,108, 95,
-/* 0x1b00 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x1b10 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1b20 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 48, 32, 76,122,109, 97, 68,101, 99,111,
-/* 0x1b40 */ 100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1b50 */  32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48,
-/* 0x1b60 */  48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,101, 99,111,109,
-/* 0x1b70 */ 112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1b80 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77,
-/* 0x1b90 */  65, 67, 72, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1ba0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1bb0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1bd0 */  32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90,
-/* 0x1be0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x1bf0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93,
-/* 0x1c00 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1c10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1c20 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82,
-/* 0x1c30 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1c40 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65,
-/* 0x1c50 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1c60 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95,
-/* 0x1c70 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c80 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82,
-/* 0x1c90 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ca0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32,
-/* 0x1cb0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1cc0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 56,
-/* 0x1cd0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1ce0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x1cf0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1d00 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1d10 */  97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1d20 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 98, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1d40 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1d60 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1d70 */  48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1d80 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1d90 */  48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1da0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1dc0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1de0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1df0 */  10, 48, 48, 48, 48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1e00 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1e10 */  69, 10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77,
-/* 0x1e20 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1e30 */  50, 69, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82,
-/* 0x1e40 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1e50 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65,
-/* 0x1e60 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1e70 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32, 82, 95,
-/* 0x1e80 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e90 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82,
-/* 0x1ea0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1eb0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32,
-/* 0x1ec0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ed0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 51, 99,
-/* 0x1ee0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1ef0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 52,
-/* 0x1f00 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1f10 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1f20 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1f30 */  82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1f40 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f50 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x1f60 */  48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1f80 */  48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1f90 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x1fa0 */  48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1fb0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1fd0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1ff0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x2000 */  10, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2010 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2020 */  68, 10, 48, 48, 48, 48, 48, 48, 97, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2030 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2040 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82,
-/* 0x2050 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2060 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65,
-/* 0x2070 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2080 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95,
-/* 0x2090 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20a0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82,
-/* 0x20b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20c0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 52, 32,
-/* 0x20d0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x20e0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 48,
-/* 0x20f0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2100 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101,
-/* 0x2110 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2120 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */ 102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x2150 */  49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2160 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x2170 */  48, 49, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x2190 */  48, 48, 49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x21a0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x21b0 */  48, 48, 48, 49, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x21c0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 10,
-/* 0x21d0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x21e0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10,
-/* 0x21f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2200 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2210 */  10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2220 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2230 */  66, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2240 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2250 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82,
-/* 0x2260 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2270 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65,
-/* 0x2280 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2290 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82, 95,
-/* 0x22a0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22b0 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82,
-/* 0x22c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22d0 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32,
-/* 0x22e0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x22f0 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 56,
-/* 0x2300 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2310 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x2320 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2330 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2340 */  98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2350 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2360 */  48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2370 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x2380 */  48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2390 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x23a0 */  48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x23b0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x23c0 */  48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x23d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x23e0 */  48, 48, 48, 48, 48,102, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x23f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2400 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2410 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76,
-/* 0x2420 */  70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x2430 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2440 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32,
-/* 0x2450 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2460 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x2470 */  48, 48, 48, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2480 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2490 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82,
-/* 0x24a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x24b0 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x24c0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x24d0 */  32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79,
-/* 0x24e0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x24f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2500 */  48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2510 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2520 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82,
-/* 0x2530 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2540 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2550 */  48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2560 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2570 */  48, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2580 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2590 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52,
-/* 0x25a0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x25b0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x25c0 */  48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x25d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x25e0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65,
-/* 0x25f0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2600 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2610 */  52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2620 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2630 */  48, 48, 48, 48, 48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2640 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2650 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82,
-/* 0x2660 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2670 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2680 */  48, 49,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2690 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x26a0 */  48, 10, 48, 48, 48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x26b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x26c0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56,
-/* 0x26d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x26e0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x26f0 */  48, 48, 48, 50, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2700 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2710 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65,
-/* 0x2720 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2730 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x2740 */  51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2750 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2760 */  48, 48, 48, 48, 48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2770 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2780 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82,
-/* 0x2790 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27a0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x27b0 */  48, 50, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x27c0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x27d0 */  48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77,
-/* 0x27e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x27f0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56,
-/* 0x2800 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2810 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2820 */  48, 48, 48, 50,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2830 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2840 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65,
-/* 0x2850 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2860 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x2870 */  48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2880 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2890 */  48, 48, 48, 48, 48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x28a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x28b0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82,
-/* 0x28c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x28d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x28e0 */  48, 51, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x28f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2900 */  48, 10, 48, 48, 48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2910 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2920 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99,
-/* 0x2930 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2940 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2950 */  48, 48, 48, 51,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2960 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2970 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65,
-/* 0x2980 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2990 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x29a0 */  50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x29b0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x29c0 */  48, 48, 48, 48, 48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x29d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x29e0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82,
-/* 0x29f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a00 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2a10 */  48, 52, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2a20 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2a30 */  48, 10, 48, 48, 48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2a40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2a50 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48,
-/* 0x2a60 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2a70 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2a80 */  48, 48, 48, 52,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2a90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2aa0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65,
-/* 0x2ab0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2ac0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x2ad0 */ 102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ae0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2af0 */  48, 48, 48, 48, 48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2b00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2b10 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82,
-/* 0x2b20 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2b40 */  48, 53, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2b50 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2b60 */  48, 10, 48, 48, 48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2b70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2b80 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48,
-/* 0x2b90 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2ba0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2bb0 */  48, 48, 48, 53,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2bc0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2bd0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65,
-/* 0x2be0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2bf0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x2c00 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2c10 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2c20 */  48, 48, 48, 48, 48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2c30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2c40 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82,
-/* 0x2c50 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c60 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2c70 */  48, 54, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2c80 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2c90 */  48, 10, 48, 48, 48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2ca0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2cb0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48,
-/* 0x2cc0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2cd0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2ce0 */  48, 48, 48, 54,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2cf0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2d00 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65,
-/* 0x2d10 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2d20 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x2d30 */  50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2d40 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2d50 */  48, 48, 48, 48, 48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2d60 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2d70 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82,
-/* 0x2d80 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d90 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2da0 */  48, 55, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2db0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2dc0 */  48, 10, 48, 48, 48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2dd0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2de0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52,
-/* 0x2df0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2e00 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2e10 */  48, 48, 48, 55,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2e20 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2e30 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65,
-/* 0x2e40 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2e50 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x2e60 */  50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2e70 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2e80 */  48, 48, 48, 48, 48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2e90 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2ea0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82,
-/* 0x2eb0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ec0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2ed0 */  48, 56, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2ee0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2ef0 */  48, 10, 48, 48, 48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2f00 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2f10 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56,
-/* 0x2f20 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2f30 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2f40 */  48, 48, 48, 56,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2f50 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2f60 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65,
-/* 0x2f70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2f80 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57,
-/* 0x2f90 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2fa0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2fb0 */  48, 48, 48, 48, 48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2fc0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2fd0 */  68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2fe0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x2ff0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x3000 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3010 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x3020 */  48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3030 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3040 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82,
-/* 0x3050 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3060 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56,
-/* 0x3070 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3080 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3090 */  48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x30a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x30b0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95,
-/* 0x30c0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30d0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x30e0 */  48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x30f0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3100 */  10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3110 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3120 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32,
-/* 0x3130 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3140 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3150 */  48, 48, 49, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3160 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3170 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82,
-/* 0x3180 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3190 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50,
-/* 0x31a0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x31b0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x31c0 */  48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x31d0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x31e0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95,
-/* 0x31f0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3200 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3210 */  49, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3220 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3230 */  10, 48, 48, 48, 48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3240 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3250 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32,
-/* 0x3260 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3270 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3280 */  48, 48, 49, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3290 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x32a0 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82,
-/* 0x32b0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x32c0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57,
-/* 0x32d0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x32e0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x32f0 */  48, 48, 48, 48, 49, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3300 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3310 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95,
-/* 0x3320 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3330 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3340 */  49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3350 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3360 */  10, 48, 48, 48, 48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3370 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3380 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32,
-/* 0x3390 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x33a0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x33b0 */  48, 48, 49,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x33c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x33d0 */  49, 48, 10, 48, 48, 48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82,
-/* 0x33e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x33f0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50,
-/* 0x3400 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3410 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3420 */  48, 48, 48, 48, 50, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3430 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3440 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95,
-/* 0x3450 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3460 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3470 */  50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3480 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3490 */  10, 48, 48, 48, 48, 48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x34a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x34b0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32,
-/* 0x34c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x34d0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x34e0 */  48, 48, 50, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x34f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3500 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82,
-/* 0x3510 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3520 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97,
-/* 0x3530 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3540 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3550 */  48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3560 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3570 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95,
-/* 0x3580 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3590 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x35a0 */  50,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x35b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x35c0 */  10, 48, 48, 48, 48, 48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x35d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x35e0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32,
-/* 0x35f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3600 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3610 */  48, 48, 51, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3620 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3630 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82,
-/* 0x3640 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3650 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53,
-/* 0x3660 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3670 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3680 */  48, 48, 48, 48, 51, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3690 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x36a0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95,
-/* 0x36b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x36c0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x36d0 */  51, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x36e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x36f0 */  10, 48, 48, 48, 48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3700 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3710 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32,
-/* 0x3720 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3730 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3740 */  48, 48, 51, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3750 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3760 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82,
-/* 0x3770 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3780 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99,
-/* 0x3790 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x37a0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x37b0 */  48, 48, 48, 48, 52, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x37c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x37d0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95,
-/* 0x37e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x37f0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3800 */  52, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3810 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3820 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3830 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77, 65, 67, 72, 77, 65,
-/* 0x3840 */  73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x3850 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3860 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32,
-/* 0x3870 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3880 */  32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48,
-/* 0x3890 */  48, 49, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x38a0 */  32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90,
-/* 0x38b0 */  10, 48, 48, 48, 48, 48, 49, 50, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x38c0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72,
-/* 0x38d0 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 51, 99, 32, 82,
-/* 0x38e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x38f0 */  32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x3900 */  49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3910 */  32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10,
-/* 0x3920 */  48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3930 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77,
-/* 0x3940 */  65, 73, 78, 90, 10
+/* 0x1390 */   8,176, 64,226,254,255,255,235, 12,  0,  0,  0, 18,  0,  0,  0,
+/* 0x13a0 */ 194,  0,  0,  0, 32, 20,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x13b0 */  12,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 64,  0,  0,  0,
+/* 0x13c0 */   0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 64,  0,  0,  0,
+/* 0x13d0 */  68,  1,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,132,  1,  0,  0,
+/* 0x13e0 */  48,  1,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,180,  2,  0,  0,
+/* 0x13f0 */ 244,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,168,  3,  0,  0,
+/* 0x1400 */   0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,168,  3,  0,  0,
+/* 0x1410 */ 188,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,100,  4,  0,  0,
+/* 0x1420 */  56,  9,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,156, 13,  0,  0,
+/* 0x1430 */ 120,  4,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0, 20, 18,  0,  0,
+/* 0x1440 */   0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 20, 18,  0,  0,
+/* 0x1450 */   0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 20, 18,  0,  0,
+/* 0x1460 */ 132,  1,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1470 */   0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1480 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  6,  0,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  7,  0,  0,  0,
+/* 0x14b0 */   0,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,  8,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,  9,  0,  0,  0,
+/* 0x14d0 */   0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 11,  0,  0,  0,
+/* 0x14e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1510 */   0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,  0,  0,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1540 */   0,  0,  0,  0,  0,  0,  0,  0,140,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1550 */   0,  0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  0,  0,  0,  0,186,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1570 */   0,  0,  0,  0,  0,  0,  0,  0,197,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1580 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1590 */ 212,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15a0 */   2,  0,  0,  0, 16,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,116,  0,  0,  0,
+/* 0x15c0 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15d0 */   2,  0,  0,  0,120,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,128,  0,  0,  0,
+/* 0x15f0 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1600 */   2,  0,  0,  0,140,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,152,  0,  0,  0,
+/* 0x1620 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1630 */   2,  0,  0,  0,164,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,168,  0,  0,  0,
+/* 0x1650 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1660 */   2,  0,  0,  0,180,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,196,  0,  0,  0,
+/* 0x1680 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1690 */   2,  0,  0,  0,204,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,208,  0,  0,  0,
+/* 0x16b0 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16c0 */   2,  0,  0,  0,216,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,220,  0,  0,  0,
+/* 0x16e0 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16f0 */   2,  0,  0,  0,232,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,236,  0,  0,  0,
+/* 0x1710 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1720 */   2,  0,  0,  0,244,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  1,  0,  0,
+/* 0x1740 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1750 */   2,  0,  0,  0,  4,  1,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 12,  1,  0,  0,
+/* 0x1770 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1780 */   2,  0,  0,  0, 20,  1,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 60,  1,  0,  0,
+/* 0x17a0 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17b0 */   2,  0,  0,  0, 64,  1,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,
+/* 0x17d0 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17e0 */   3,  0,  0,  0,116,  0,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,120,  0,  0,  0,
+/* 0x1800 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1810 */   3,  0,  0,  0,128,  0,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,140,  0,  0,  0,
+/* 0x1830 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1840 */   3,  0,  0,  0,152,  0,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,164,  0,  0,  0,
+/* 0x1860 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1870 */   3,  0,  0,  0,168,  0,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,180,  0,  0,  0,
+/* 0x1890 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18a0 */   3,  0,  0,  0,196,  0,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,
+/* 0x18c0 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18d0 */   3,  0,  0,  0,212,  0,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,224,  0,  0,  0,
+/* 0x18f0 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */   3,  0,  0,  0,232,  0,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,244,  0,  0,  0,
+/* 0x1920 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1930 */   3,  0,  0,  0,  0,  1,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  4,  1,  0,  0,
+/* 0x1950 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */   3,  0,  0,  0, 40,  1,  0,  0,212,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 44,  1,  0,  0,
+/* 0x1980 */ 212,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */   4,  0,  0,  0, 16,  0,  0,  0,212,  0,  0,  0,  2,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,120,  0,  0,  0,
+/* 0x19b0 */ 212,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */   4,  0,  0,  0,128,  0,  0,  0,212,  0,  0,  0,  2,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,132,  0,  0,  0,
+/* 0x19e0 */ 212,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */   4,  0,  0,  0,148,  0,  0,  0,212,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,152,  0,  0,  0,
+/* 0x1a10 */ 212,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   4,  0,  0,  0,156,  0,  0,  0,212,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,168,  0,  0,  0,
+/* 0x1a40 */ 212,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */   4,  0,  0,  0,184,  0,  0,  0,212,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,188,  0,  0,  0,
+/* 0x1a70 */ 212,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   4,  0,  0,  0,196,  0,  0,  0,212,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,204,  0,  0,  0,
+/* 0x1aa0 */ 212,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   4,  0,  0,  0,208,  0,  0,  0,212,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,236,  0,  0,  0,
+/* 0x1ad0 */ 212,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   4,  0,  0,  0,240,  0,  0,  0,212,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1b00 */ 212,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */   6,  0,  0,  0, 76,  0,  0,  0,212,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,128,  0,  0,  0,
+/* 0x1b30 */ 212,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */   7,  0,  0,  0,116,  0,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,144,  0,  0,  0,
+/* 0x1b60 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   7,  0,  0,  0,184,  0,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  0,  0,  0,
+/* 0x1b90 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   7,  0,  0,  0,244,  0,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  0,  1,  0,  0,
+/* 0x1bc0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   7,  0,  0,  0,  8,  1,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 68,  1,  0,  0,
+/* 0x1bf0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */   7,  0,  0,  0,144,  1,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  1,  0,  0,
+/* 0x1c20 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   7,  0,  0,  0,216,  1,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  2,  0,  0,
+/* 0x1c50 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */   7,  0,  0,  0, 24,  2,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 32,  2,  0,  0,
+/* 0x1c80 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */   7,  0,  0,  0, 52,  2,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  2,  0,  0,
+/* 0x1cb0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   7,  0,  0,  0, 64,  2,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 76,  2,  0,  0,
+/* 0x1ce0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   7,  0,  0,  0, 88,  2,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,164,  2,  0,  0,
+/* 0x1d10 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */   7,  0,  0,  0,200,  2,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  2,  0,  0,
+/* 0x1d40 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */   7,  0,  0,  0,  4,  3,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 12,  3,  0,  0,
+/* 0x1d70 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */   7,  0,  0,  0, 60,  3,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,136,  3,  0,  0,
+/* 0x1da0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */   7,  0,  0,  0,160,  3,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,168,  3,  0,  0,
+/* 0x1dd0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */   7,  0,  0,  0,204,  3,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,224,  3,  0,  0,
+/* 0x1e00 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */   7,  0,  0,  0,232,  3,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 36,  4,  0,  0,
+/* 0x1e30 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */   7,  0,  0,  0, 56,  4,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,108,  4,  0,  0,
+/* 0x1e60 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */   7,  0,  0,  0,132,  4,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,140,  4,  0,  0,
+/* 0x1e90 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   7,  0,  0,  0,176,  4,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,212,  4,  0,  0,
+/* 0x1ec0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   7,  0,  0,  0,236,  4,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  4,  0,  0,
+/* 0x1ef0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   7,  0,  0,  0, 24,  5,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  5,  0,  0,
+/* 0x1f20 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */   7,  0,  0,  0,152,  5,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  5,  0,  0,
+/* 0x1f50 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   7,  0,  0,  0,192,  5,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,228,  5,  0,  0,
+/* 0x1f80 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */   7,  0,  0,  0,252,  5,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  6,  0,  0,
+/* 0x1fb0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   7,  0,  0,  0, 36,  6,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 72,  6,  0,  0,
+/* 0x1fe0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   7,  0,  0,  0,128,  6,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,140,  6,  0,  0,
+/* 0x2010 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   7,  0,  0,  0,208,  6,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,236,  6,  0,  0,
+/* 0x2040 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */   7,  0,  0,  0, 28,  7,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 40,  7,  0,  0,
+/* 0x2070 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   7,  0,  0,  0,108,  7,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,124,  7,  0,  0,
+/* 0x20a0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */   7,  0,  0,  0,156,  7,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,184,  7,  0,  0,
+/* 0x20d0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   7,  0,  0,  0,196,  7,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,208,  7,  0,  0,
+/* 0x2100 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */   7,  0,  0,  0,244,  7,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 32,  8,  0,  0,
+/* 0x2130 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   7,  0,  0,  0, 44,  8,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,124,  8,  0,  0,
+/* 0x2160 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   7,  0,  0,  0,136,  8,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  8,  0,  0,
+/* 0x2190 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */   7,  0,  0,  0,232,  8,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  8,  0,  0,
+/* 0x21c0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */   7,  0,  0,  0,252,  8,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  9,  0,  0,
+/* 0x21f0 */ 212,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2200 */   7,  0,  0,  0, 40,  9,  0,  0,212,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,120,  0,  0,  0,
+/* 0x2220 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2230 */   8,  0,  0,  0,128,  0,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,136,  0,  0,  0,
+/* 0x2250 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2260 */   8,  0,  0,  0,168,  0,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,172,  0,  0,  0,
+/* 0x2280 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2290 */   8,  0,  0,  0,228,  0,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  1,  0,  0,
+/* 0x22b0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */   8,  0,  0,  0, 12,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 20,  1,  0,  0,
+/* 0x22e0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22f0 */   8,  0,  0,  0, 24,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 32,  1,  0,  0,
+/* 0x2310 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2320 */   8,  0,  0,  0, 40,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 68,  1,  0,  0,
+/* 0x2340 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2350 */   8,  0,  0,  0, 76,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  1,  0,  0,
+/* 0x2370 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2380 */   8,  0,  0,  0,128,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,136,  1,  0,  0,
+/* 0x23a0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23b0 */   8,  0,  0,  0,140,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,156,  1,  0,  0,
+/* 0x23d0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23e0 */   8,  0,  0,  0,160,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,192,  1,  0,  0,
+/* 0x2400 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2410 */   8,  0,  0,  0,204,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,212,  1,  0,  0,
+/* 0x2430 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2440 */   8,  0,  0,  0,220,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,228,  1,  0,  0,
+/* 0x2460 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2470 */   8,  0,  0,  0,236,  1,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 40,  2,  0,  0,
+/* 0x2490 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24a0 */   8,  0,  0,  0, 44,  2,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 68,  2,  0,  0,
+/* 0x24c0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24d0 */   8,  0,  0,  0, 76,  2,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  2,  0,  0,
+/* 0x24f0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2500 */   8,  0,  0,  0,104,  2,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,132,  2,  0,  0,
+/* 0x2520 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */   8,  0,  0,  0,140,  2,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,164,  2,  0,  0,
+/* 0x2550 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2560 */   8,  0,  0,  0,200,  2,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,208,  2,  0,  0,
+/* 0x2580 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2590 */   8,  0,  0,  0,220,  2,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,244,  2,  0,  0,
+/* 0x25b0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */   8,  0,  0,  0, 12,  3,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 20,  3,  0,  0,
+/* 0x25e0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25f0 */   8,  0,  0,  0, 44,  3,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  3,  0,  0,
+/* 0x2610 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */   8,  0,  0,  0, 88,  3,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,112,  3,  0,  0,
+/* 0x2640 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   8,  0,  0,  0,120,  3,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,156,  3,  0,  0,
+/* 0x2670 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */   8,  0,  0,  0,176,  3,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,184,  3,  0,  0,
+/* 0x26a0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   8,  0,  0,  0,200,  3,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,204,  3,  0,  0,
+/* 0x26d0 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   8,  0,  0,  0,  0,  4,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 24,  4,  0,  0,
+/* 0x2700 */ 212,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   8,  0,  0,  0, 64,  4,  0,  0,212,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 12,  1,  0,  0,
+/* 0x2730 */ 212,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */  11,  0,  0,  0, 24,  1,  0,  0,212,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 36,  1,  0,  0,
+/* 0x2760 */ 212,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */  11,  0,  0,  0, 60,  1,  0,  0,212,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 68,  1,  0,  0,
+/* 0x2790 */ 212,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */  11,  0,  0,  0,128,  1,  0,  0,212,  0,  0,  0,  7,  0,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0,  0,  0,  0,  0, 77, 65, 67, 72, 77, 65, 73, 78,
+/* 0x27c0 */  88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,
+/* 0x27d0 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 78, 82, 86,
+/* 0x27e0 */  95, 84, 65, 73, 76,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
+/* 0x27f0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65,
+/* 0x2800 */  95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51,
+/* 0x2810 */  48,  0, 77, 65, 67, 72, 77, 65, 73, 78, 89,  0, 77, 65, 67, 72,
+/* 0x2820 */  77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0,117, 99,108,
+/* 0x2830 */  95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,
+/* 0x2840 */ 115, 95, 56,  0,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
+/* 0x2850 */  99,111,109,112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,
+/* 0x2860 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x2870 */  56,  0, 76,122,109, 97, 68,101, 99,111,100,101,  0,101,110,100,
+/* 0x2880 */  95,100,101, 99,111,109,112,114,101,115,115,  0, 82, 95, 65, 82,
+/* 0x2890 */  77, 95, 80, 67, 50, 52,  0,152, 19,  0,  0, 85, 80, 88, 76
 };
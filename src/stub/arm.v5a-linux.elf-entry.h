@@ -1,5 +1,5 @@
 /* arm.v5a-linux.elf-entry.h
-   created from arm.v5a-linux.elf-entry.bin, 14600 (0x3908) bytes
+   created from arm.v5a-linux.elf-entry.bin, 10342 (0x2866) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_SIZE    14600
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_ADLER32 0xe766024c
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_CRC32   0xb2412397
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_SIZE    10342
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_ADLER32 0xcaf5266c
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_CRC32   0x654f790e
 
-unsigned char stub_arm_v5a_linux_elf_entry[14600] = {
+unsigned char stub_arm_v5a_linux_elf_entry[10342] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 236, 19,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -344,609 +344,343 @@ unsigned char stub_arm_v5a_linux_elf_entry[14600] = {
 /* 0x1310 */   0, 96, 70,224,  0, 96,141,229,  0,144,160,225, 80,  0, 79,226,
 /* 0x1320 */   0, 16,160,227,  5,112,160,227,  0,  0,  0,239,  0,  0, 80,227,
 /* 0x1330 */  57,  0,  0,186,  4,  0,141,229, 12, 48, 30,229,254,255,255,235,
-/* 0x1340 */   0,  0,  0,  0,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1350 */ 101,108,102, 51, 50, 45,108,105,116,116,108,101, 97,114,109, 10,
-/* 0x1360 */  10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78,
-/* 0x1370 */  97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,
-/* 0x1380 */ 101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x1390 */  32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,
-/* 0x13a0 */ 111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115,
-/* 0x13b0 */  10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32,
-/* 0x13c0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48,
-/* 0x13d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x13e0 */  32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x13f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1400 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78,
-/* 0x1410 */  82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1420 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1430 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1440 */  48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1450 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1460 */  50, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32,
-/* 0x1470 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1480 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1490 */  48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x14a0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x14b0 */  10, 32, 32, 51, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32,
-/* 0x14c0 */  32, 32, 32, 48, 48, 48, 48, 48, 49, 51, 99, 32, 32, 48, 48, 48,
-/* 0x14d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x14e0 */  32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x14f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1500 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78,
-/* 0x1510 */  82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1520 */  48, 48, 49, 50, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1530 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1540 */  49, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1550 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1560 */  79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 82, 86, 50, 66, 32, 32,
-/* 0x1570 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,101, 99, 32,
-/* 0x1580 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1590 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 97, 52, 32, 32, 50,
-/* 0x15a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x15b0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x15c0 */  32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32,
-/* 0x15d0 */  32, 48, 48, 48, 48, 48, 48, 98, 56, 32, 32, 48, 48, 48, 48, 48,
-/* 0x15e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x15f0 */  48, 48, 48, 48, 51, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1600 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1610 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77,
-/* 0x1620 */  65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1630 */  57, 51, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1640 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 52,
-/* 0x1650 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1660 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1670 */  76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x1680 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 52, 55, 56, 32, 32, 48,
-/* 0x1690 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16a0 */  48, 32, 32, 48, 48, 48, 48, 48,100, 56, 48, 32, 32, 50, 42, 42,
-/* 0x16b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x16c0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57,
-/* 0x16d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x16e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1700 */  48, 49, 49,102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1710 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1720 */  32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32,
-/* 0x1730 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1740 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1750 */  48, 48, 48, 48, 49, 49,102, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1760 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1770 */  76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x1780 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 52, 99, 32, 32, 48,
-/* 0x1790 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17a0 */  48, 32, 32, 48, 48, 48, 48, 49, 49,102, 56, 32, 32, 50, 42, 42,
-/* 0x17b0 */  50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x17c0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77,
-/* 0x17d0 */  66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48,
-/* 0x17e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x17f0 */  69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69,
-/* 0x1800 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1810 */  32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1820 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1830 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48,
-/* 0x1840 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x1850 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1860 */  77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1870 */  48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x1880 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1890 */  77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18a0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x18b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x18c0 */  77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18d0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x18e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x18f0 */  77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1900 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x1910 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x1920 */  70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1930 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1950 */  78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77,
-/* 0x1960 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1970 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48,
-/* 0x1980 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x1990 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x19a0 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48,
-/* 0x19b0 */  48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48,
-/* 0x19c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x19d0 */  70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x19e0 */  69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19f0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x1a00 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 70, 76, 71, 10, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x1a20 */  76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a30 */  32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a40 */  32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69,  9, 48,
-/* 0x1a50 */  48, 48, 48, 48, 49, 51, 99, 32,117, 99,108, 95,110,114,118, 50,
-/* 0x1a60 */ 101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32,
-/* 0x1a80 */  78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 49, 50, 56, 32,117,
-/* 0x1a90 */  99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,
-/* 0x1aa0 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103,
-/* 0x1ab0 */  32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 48,101, 99, 32,117, 99,108, 95,110,114,118, 50, 98, 95,
-/* 0x1ad0 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x1af0 */  77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b00 */  48, 32, 76,122,109, 97, 68,101, 99,111,100,101, 10, 48, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76,
-/* 0x1b20 */  70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b30 */ 101,110,100, 95,100,101, 99,111,109,112,114,101,115,115, 10, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b50 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79,
-/* 0x1b60 */  95, 66, 73, 78, 70, 79, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32,
-/* 0x1b70 */ 103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x1b80 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,112,114, 48, 10, 10,
-/* 0x1b90 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x1ba0 */  68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x1bb0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x1bc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x1bd0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 65,
-/* 0x1be0 */  82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32, 77,
-/* 0x1bf0 */  70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65,
-/* 0x1c00 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x1c10 */  76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1c20 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1c30 */  91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x1c40 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c50 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1c70 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1c90 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1cb0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1cd0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1cf0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1d00 */  48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1d10 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1d30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1d40 */  10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1d50 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1d60 */  69, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77,
-/* 0x1d70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1d80 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82,
-/* 0x1d90 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1da0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65,
-/* 0x1db0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1dc0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 56, 32, 82, 95,
-/* 0x1dd0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1de0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82,
-/* 0x1df0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e00 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 52, 32,
-/* 0x1e10 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1e20 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,101, 48,
-/* 0x1e30 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1e40 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,101,
-/* 0x1e50 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1e60 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */ 101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1e80 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48,102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1ec0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 49, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1ee0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1ef0 */  48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1f00 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1f10 */  48, 48, 48, 48, 49, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1f20 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1f30 */  48, 48, 48, 48, 48, 49, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1f40 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1f50 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x1f60 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x1f70 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1f80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1f90 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82,
-/* 0x1fa0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1fb0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65,
-/* 0x1fc0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1fd0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 48, 32, 82, 95,
-/* 0x1fe0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ff0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82,
-/* 0x2000 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2010 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32,
-/* 0x2020 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2030 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 57, 48,
-/* 0x2040 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2050 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 57,
-/* 0x2060 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2070 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2080 */  97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2090 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x20b0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x20c0 */  48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x20d0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x20f0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x2100 */  48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2110 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x2120 */  48, 48, 48, 48, 48,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2130 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x2140 */  48, 48, 48, 48, 48, 48,101, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2150 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x2160 */  10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2170 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2180 */  68, 10, 48, 48, 48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2190 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x21a0 */  50, 68, 10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82,
-/* 0x21b0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x21c0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 65,
-/* 0x21d0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x21e0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 50, 52, 32, 82, 95,
-/* 0x21f0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2200 */  78, 82, 86, 50, 68, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2210 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x2220 */  82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2230 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2240 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x2250 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2260 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x2270 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2280 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2290 */  55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x22a0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x22b0 */  48, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x22c0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x22d0 */  48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x22e0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x22f0 */  48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2300 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2320 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2340 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2350 */  48, 48, 48, 48, 48, 48, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2360 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2370 */  10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2380 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2390 */  66, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77,
-/* 0x23a0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x23b0 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65, 82,
-/* 0x23c0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x23d0 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 99, 56, 32, 82, 95, 65,
-/* 0x23e0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x23f0 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95,
-/* 0x2400 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2410 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,101, 56, 32, 82,
-/* 0x2420 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2430 */  32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2440 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2450 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x2460 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2470 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2480 */  48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2490 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x24a0 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32, 82, 95, 65,
-/* 0x24b0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x24c0 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x24e0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x24f0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2500 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2510 */  67, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x2520 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2530 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32,
-/* 0x2540 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2550 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2560 */  48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2570 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2580 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82,
-/* 0x2590 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x25a0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x25b0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x25c0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x25d0 */  48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x25e0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x25f0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95,
-/* 0x2600 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2610 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2620 */  49, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2630 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2640 */  10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2650 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2660 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 57, 48, 32,
-/* 0x2670 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2680 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2690 */  48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x26a0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x26b0 */  50, 48, 10, 48, 48, 48, 48, 48, 49,100, 56, 32, 82, 95, 65, 82,
-/* 0x26c0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x26d0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 48,
-/* 0x26e0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x26f0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2700 */  48, 48, 48, 48, 50, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2710 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2720 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 50, 48, 32, 82, 95,
-/* 0x2730 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2740 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2750 */  50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2760 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2770 */  10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2780 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2790 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 48, 32,
-/* 0x27a0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x27b0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x27c0 */  48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x27d0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x27e0 */  50, 48, 10, 48, 48, 48, 48, 48, 50, 53, 56, 32, 82, 95, 65, 82,
-/* 0x27f0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2800 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 97,
-/* 0x2810 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2820 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2830 */  48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2840 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2850 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,101, 56, 32, 82, 95,
-/* 0x2860 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2870 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2880 */  51, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2890 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x28a0 */  10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x28b0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x28c0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 51, 99, 32,
-/* 0x28d0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x28e0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x28f0 */  48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2900 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2910 */  50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 48, 32, 82, 95, 65, 82,
-/* 0x2920 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2930 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97,
-/* 0x2940 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2950 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2960 */  48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2970 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2980 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101, 48, 32, 82, 95,
-/* 0x2990 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x29a0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x29b0 */  51,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x29c0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x29d0 */  10, 48, 48, 48, 48, 48, 52, 50, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x29e0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x29f0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 51, 56, 32,
-/* 0x2a00 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2a10 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2a20 */  48, 48, 52, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2a30 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2a40 */  50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 52, 32, 82, 95, 65, 82,
-/* 0x2a50 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2a60 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56,
-/* 0x2a70 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2a80 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2a90 */  48, 48, 48, 48, 52, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2aa0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2ab0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,100, 52, 32, 82, 95,
-/* 0x2ac0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ad0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2ae0 */  52,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2af0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2b00 */  10, 48, 48, 48, 48, 48, 52,102, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2b10 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2b20 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 49, 56, 32,
-/* 0x2b30 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2b40 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2b50 */  48, 48, 53, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2b60 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2b70 */  50, 48, 10, 48, 48, 48, 48, 48, 53, 57, 56, 32, 82, 95, 65, 82,
-/* 0x2b80 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2b90 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 97,
-/* 0x2ba0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2bb0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2bc0 */  48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2bd0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2be0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,101, 52, 32, 82, 95,
-/* 0x2bf0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c00 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2c10 */  53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2c20 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2c30 */  10, 48, 48, 48, 48, 48, 54, 48, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2c40 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2c50 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 50, 52, 32,
-/* 0x2c60 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2c70 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2c80 */  48, 48, 54, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2c90 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2ca0 */  50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 48, 32, 82, 95, 65, 82,
-/* 0x2cb0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2cc0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56,
-/* 0x2cd0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2ce0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2cf0 */  48, 48, 48, 48, 54,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2d00 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2d10 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,101, 99, 32, 82, 95,
-/* 0x2d20 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d30 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2d40 */  55, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2d50 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2d60 */  10, 48, 48, 48, 48, 48, 55, 50, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2d70 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2d80 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 54, 99, 32,
-/* 0x2d90 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2da0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2db0 */  48, 48, 55, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2dc0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2dd0 */  50, 48, 10, 48, 48, 48, 48, 48, 55, 57, 99, 32, 82, 95, 65, 82,
-/* 0x2de0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2df0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 98,
-/* 0x2e00 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2e10 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2e20 */  48, 48, 48, 48, 55, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2e30 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2e40 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,100, 48, 32, 82, 95,
-/* 0x2e50 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2e60 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2e70 */  55,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2e80 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2e90 */  10, 48, 48, 48, 48, 48, 56, 50, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2ea0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2eb0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 99, 32,
-/* 0x2ec0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2ed0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2ee0 */  48, 48, 56, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2f00 */  50, 48, 10, 48, 48, 48, 48, 48, 56, 56, 56, 32, 82, 95, 65, 82,
-/* 0x2f10 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2f20 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 97,
-/* 0x2f30 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2f40 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2f50 */  48, 48, 48, 48, 56,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2f60 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2f70 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102, 52, 32, 82, 95,
-/* 0x2f80 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2f90 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2fa0 */  56,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2fb0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2fc0 */  10, 48, 48, 48, 48, 48, 57, 48, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2fd0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2fe0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 50, 56, 32,
-/* 0x2ff0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3000 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 10, 82, 69,
-/* 0x3010 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x3020 */  32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3030 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3050 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x3060 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3070 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3080 */  56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3090 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x30a0 */  48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x30b0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x30c0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82,
-/* 0x30d0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30e0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x30f0 */  48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3100 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3110 */  48, 10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77,
-/* 0x3120 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3130 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48,
-/* 0x3140 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3150 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3160 */  48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3170 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3180 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32, 82, 95, 65,
-/* 0x3190 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x31a0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x31b0 */  49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x31c0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x31d0 */  48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x31e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x31f0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32, 82,
-/* 0x3200 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3210 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3220 */  48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3230 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3240 */  48, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3250 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3260 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 53, 48,
-/* 0x3270 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3280 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3290 */  48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x32a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x32b0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 56, 32, 82, 95, 65,
-/* 0x32c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x32d0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x32e0 */  56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x32f0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3300 */  48, 48, 48, 48, 48, 49, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3310 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3320 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 97, 48, 32, 82,
-/* 0x3330 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3340 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3350 */  48, 49, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3360 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3370 */  48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3380 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3390 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 52,
-/* 0x33a0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x33b0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x33c0 */  48, 48, 48, 49,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x33d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x33e0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101, 52, 32, 82, 95, 65,
-/* 0x33f0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3400 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3410 */ 101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3420 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3430 */  48, 48, 48, 48, 48, 50, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3440 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3450 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 99, 32, 82,
-/* 0x3460 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3470 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3480 */  48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3490 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x34a0 */  48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77,
-/* 0x34b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x34c0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 53, 48,
-/* 0x34d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x34e0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x34f0 */  48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3500 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3510 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 52, 32, 82, 95, 65,
-/* 0x3520 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3530 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3540 */  56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3550 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3560 */  48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3570 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3580 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82,
-/* 0x3590 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35a0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x35b0 */  48, 50,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x35c0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x35d0 */  48, 10, 48, 48, 48, 48, 48, 50,100, 99, 32, 82, 95, 65, 82, 77,
-/* 0x35e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x35f0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,102, 52,
-/* 0x3600 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3610 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3620 */  48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3630 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3640 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 49, 52, 32, 82, 95, 65,
-/* 0x3650 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3660 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x3670 */  50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3680 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3690 */  48, 48, 48, 48, 48, 51, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x36a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x36b0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 56, 32, 82,
-/* 0x36c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x36d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x36e0 */  48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x36f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3700 */  48, 10, 48, 48, 48, 48, 48, 51, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3710 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3720 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 57, 99,
-/* 0x3730 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3740 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3750 */  48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3760 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3770 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 56, 32, 82, 95, 65,
-/* 0x3780 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3790 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x37a0 */  99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x37b0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x37c0 */  48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x37d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x37e0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 48, 48, 32, 82,
-/* 0x37f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3800 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3810 */  48, 52, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3820 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3830 */  48, 10, 48, 48, 48, 48, 48, 52, 52, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3840 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3850 */  65, 95, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x3860 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x3870 */  91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83,
-/* 0x3880 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3890 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x38a0 */  48, 48, 49, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x38b0 */  32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x38c0 */  10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x38d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x38e0 */  65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 52, 56, 32, 82, 95,
-/* 0x38f0 */  65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3900 */  79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1340 */   0,  0,  0,  0, 12,  0,  0,  0, 21,  0,  0,  0,192,  0,  0,  0,
+/* 0x1350 */  32, 20,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1360 */   0,  0,  0,  0,  9,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1370 */   0,  0,  0,  0, 18,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1380 */   0,  0,  0,  0, 27,  0,  0,  0, 64,  0,  0,  0, 60,  1,  0,  0,
+/* 0x1390 */   0,  0,  0,  0, 33,  0,  0,  0,124,  1,  0,  0, 40,  1,  0,  0,
+/* 0x13a0 */   0,  0,  0,  0, 39,  0,  0,  0,164,  2,  0,  0,236,  0,  0,  0,
+/* 0x13b0 */   0,  0,  0,  0, 45,  0,  0,  0,144,  3,  0,  0,184,  0,  0,  0,
+/* 0x13c0 */   0,  0,  0,  0, 56,  0,  0,  0, 72,  4,  0,  0, 56,  9,  0,  0,
+/* 0x13d0 */   0,  0,  0,  0, 67,  0,  0,  0,128, 13,  0,  0,120,  4,  0,  0,
+/* 0x13e0 */   0,  0,  0,  0, 78,  0,  0,  0,248, 17,  0,  0,  0,  0,  0,  0,
+/* 0x13f0 */   0,  0,  0,  0, 89,  0,  0,  0,248, 17,  0,  0,  0,  0,  0,  0,
+/* 0x1400 */   0,  0,  0,  0, 98,  0,  0,  0,248, 17,  0,  0, 76,  1,  0,  0,
+/* 0x1410 */   2,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1420 */   0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1430 */   0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1440 */   0,  0,  0,  0, 45,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1450 */   0,  0,  0,  0, 56,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1460 */   0,  0,  0,  0, 67,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1470 */   0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1480 */   0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14b0 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14d0 */   0,  0,  0,  0,107,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,
+/* 0x14e0 */   0,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0,119,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0,142,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1510 */   0,  0,  0,  0,165,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,188,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0,199,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1540 */   0,  0,  0,  0,214,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,
+/* 0x1550 */   0,  0,  0,  0,222,  0,  0,  0, 11,  0,  0,  0, 76,  1,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,227,  0,  0,  0,
+/* 0x1570 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */   8,  0,  0,  0,239,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,239,  0,  0,  0,
+/* 0x15a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15b0 */ 108,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  3,  0,  0,  0,112,  0,  0,  0,239,  0,  0,  0,
+/* 0x15d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15e0 */ 120,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  3,  0,  0,  0,132,  0,  0,  0,239,  0,  0,  0,
+/* 0x1600 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1610 */ 144,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0,  3,  0,  0,  0,156,  0,  0,  0,239,  0,  0,  0,
+/* 0x1630 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1640 */ 160,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  3,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0,
+/* 0x1660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1670 */ 188,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  3,  0,  0,  0,196,  0,  0,  0,239,  0,  0,  0,
+/* 0x1690 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16a0 */ 200,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  3,  0,  0,  0,208,  0,  0,  0,239,  0,  0,  0,
+/* 0x16c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16d0 */ 212,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16e0 */   0,  0,  0,  0,  3,  0,  0,  0,224,  0,  0,  0,239,  0,  0,  0,
+/* 0x16f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1700 */ 228,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  3,  0,  0,  0,236,  0,  0,  0,239,  0,  0,  0,
+/* 0x1720 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1730 */ 248,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1740 */   0,  0,  0,  0,  3,  0,  0,  0,252,  0,  0,  0,239,  0,  0,  0,
+/* 0x1750 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1760 */   4,  1,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1770 */   0,  0,  0,  0,  3,  0,  0,  0, 12,  1,  0,  0,239,  0,  0,  0,
+/* 0x1780 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1790 */  52,  1,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17a0 */   0,  0,  0,  0,  3,  0,  0,  0, 56,  1,  0,  0,239,  0,  0,  0,
+/* 0x17b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x17c0 */  16,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17d0 */   0,  0,  0,  0,  4,  0,  0,  0,108,  0,  0,  0,239,  0,  0,  0,
+/* 0x17e0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x17f0 */ 112,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1800 */   0,  0,  0,  0,  4,  0,  0,  0,120,  0,  0,  0,239,  0,  0,  0,
+/* 0x1810 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1820 */ 132,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1830 */   0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,
+/* 0x1840 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1850 */ 156,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1860 */   0,  0,  0,  0,  4,  0,  0,  0,160,  0,  0,  0,239,  0,  0,  0,
+/* 0x1870 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1880 */ 172,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0,  4,  0,  0,  0,188,  0,  0,  0,239,  0,  0,  0,
+/* 0x18a0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18b0 */ 196,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  4,  0,  0,  0,204,  0,  0,  0,239,  0,  0,  0,
+/* 0x18d0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18e0 */ 216,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18f0 */   0,  0,  0,  0,  4,  0,  0,  0,224,  0,  0,  0,239,  0,  0,  0,
+/* 0x1900 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1910 */ 236,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0,  4,  0,  0,  0,248,  0,  0,  0,239,  0,  0,  0,
+/* 0x1930 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1940 */ 252,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1950 */   0,  0,  0,  0,  4,  0,  0,  0, 32,  1,  0,  0,239,  0,  0,  0,
+/* 0x1960 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1970 */  36,  1,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  5,  0,  0,  0, 16,  0,  0,  0,239,  0,  0,  0,
+/* 0x1990 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19a0 */ 112,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  5,  0,  0,  0,120,  0,  0,  0,239,  0,  0,  0,
+/* 0x19c0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19d0 */ 124,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  5,  0,  0,  0,140,  0,  0,  0,239,  0,  0,  0,
+/* 0x19f0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a00 */ 144,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  5,  0,  0,  0,148,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a20 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a30 */ 160,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  5,  0,  0,  0,176,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a50 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a60 */ 180,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  5,  0,  0,  0,188,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a80 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a90 */ 196,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  5,  0,  0,  0,200,  0,  0,  0,239,  0,  0,  0,
+/* 0x1ab0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1ac0 */ 228,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  5,  0,  0,  0,232,  0,  0,  0,239,  0,  0,  0,
+/* 0x1ae0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1af0 */   8,  0,  0,  0,239,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0,  6,  0,  0,  0, 76,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b10 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1b20 */ 128,  0,  0,  0,239,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b40 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b50 */ 144,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b70 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b80 */ 204,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0,  7,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0,
+/* 0x1ba0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1bb0 */   0,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  7,  0,  0,  0,  8,  1,  0,  0,239,  0,  0,  0,
+/* 0x1bd0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1be0 */  68,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  7,  0,  0,  0,144,  1,  0,  0,239,  0,  0,  0,
+/* 0x1c00 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c10 */ 204,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  7,  0,  0,  0,216,  1,  0,  0,239,  0,  0,  0,
+/* 0x1c30 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c40 */   4,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,  7,  0,  0,  0, 24,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c60 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c70 */  32,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,  7,  0,  0,  0, 52,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c90 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ca0 */  60,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  7,  0,  0,  0, 64,  2,  0,  0,239,  0,  0,  0,
+/* 0x1cc0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1cd0 */  76,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  7,  0,  0,  0, 88,  2,  0,  0,239,  0,  0,  0,
+/* 0x1cf0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d00 */ 164,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  7,  0,  0,  0,200,  2,  0,  0,239,  0,  0,  0,
+/* 0x1d20 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d30 */ 232,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d50 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d60 */  12,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  7,  0,  0,  0, 60,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d80 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d90 */ 136,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,  7,  0,  0,  0,160,  3,  0,  0,239,  0,  0,  0,
+/* 0x1db0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1dc0 */ 168,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  7,  0,  0,  0,204,  3,  0,  0,239,  0,  0,  0,
+/* 0x1de0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1df0 */ 224,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  7,  0,  0,  0,232,  3,  0,  0,239,  0,  0,  0,
+/* 0x1e10 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e20 */  36,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  7,  0,  0,  0, 56,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e40 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e50 */ 108,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  7,  0,  0,  0,132,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e70 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e80 */ 140,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  7,  0,  0,  0,176,  4,  0,  0,239,  0,  0,  0,
+/* 0x1ea0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1eb0 */ 212,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  7,  0,  0,  0,236,  4,  0,  0,239,  0,  0,  0,
+/* 0x1ed0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ee0 */ 244,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  7,  0,  0,  0, 24,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f00 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f10 */  60,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  7,  0,  0,  0,152,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f30 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f40 */ 160,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  7,  0,  0,  0,192,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f60 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f70 */ 228,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  7,  0,  0,  0,252,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f90 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fa0 */   4,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  7,  0,  0,  0, 36,  6,  0,  0,239,  0,  0,  0,
+/* 0x1fc0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fd0 */  72,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  7,  0,  0,  0,128,  6,  0,  0,239,  0,  0,  0,
+/* 0x1ff0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2000 */ 140,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  7,  0,  0,  0,208,  6,  0,  0,239,  0,  0,  0,
+/* 0x2020 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2030 */ 236,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  7,  0,  0,  0, 28,  7,  0,  0,239,  0,  0,  0,
+/* 0x2050 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2060 */  40,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  7,  0,  0,  0,108,  7,  0,  0,239,  0,  0,  0,
+/* 0x2080 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2090 */ 124,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  7,  0,  0,  0,156,  7,  0,  0,239,  0,  0,  0,
+/* 0x20b0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20c0 */ 184,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  7,  0,  0,  0,196,  7,  0,  0,239,  0,  0,  0,
+/* 0x20e0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20f0 */ 208,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  7,  0,  0,  0,244,  7,  0,  0,239,  0,  0,  0,
+/* 0x2110 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2120 */  32,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  7,  0,  0,  0, 44,  8,  0,  0,239,  0,  0,  0,
+/* 0x2140 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2150 */ 124,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  7,  0,  0,  0,136,  8,  0,  0,239,  0,  0,  0,
+/* 0x2170 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2180 */ 160,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  7,  0,  0,  0,232,  8,  0,  0,239,  0,  0,  0,
+/* 0x21a0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x21b0 */ 244,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,  7,  0,  0,  0,252,  8,  0,  0,239,  0,  0,  0,
+/* 0x21d0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x21e0 */   4,  9,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  7,  0,  0,  0, 40,  9,  0,  0,239,  0,  0,  0,
+/* 0x2200 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2210 */ 120,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,  8,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,
+/* 0x2230 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2240 */ 136,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,  8,  0,  0,  0,168,  0,  0,  0,239,  0,  0,  0,
+/* 0x2260 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2270 */ 172,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  8,  0,  0,  0,228,  0,  0,  0,239,  0,  0,  0,
+/* 0x2290 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22a0 */   0,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,  8,  0,  0,  0, 12,  1,  0,  0,239,  0,  0,  0,
+/* 0x22c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22d0 */  20,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,  8,  0,  0,  0, 24,  1,  0,  0,239,  0,  0,  0,
+/* 0x22f0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2300 */  32,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,  8,  0,  0,  0, 40,  1,  0,  0,239,  0,  0,  0,
+/* 0x2320 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2330 */  68,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,  8,  0,  0,  0, 76,  1,  0,  0,239,  0,  0,  0,
+/* 0x2350 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2360 */  80,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,  8,  0,  0,  0,128,  1,  0,  0,239,  0,  0,  0,
+/* 0x2380 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2390 */ 136,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,  8,  0,  0,  0,140,  1,  0,  0,239,  0,  0,  0,
+/* 0x23b0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23c0 */ 156,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,  8,  0,  0,  0,160,  1,  0,  0,239,  0,  0,  0,
+/* 0x23e0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23f0 */ 192,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,  8,  0,  0,  0,204,  1,  0,  0,239,  0,  0,  0,
+/* 0x2410 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2420 */ 212,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,  8,  0,  0,  0,220,  1,  0,  0,239,  0,  0,  0,
+/* 0x2440 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2450 */ 228,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  8,  0,  0,  0,236,  1,  0,  0,239,  0,  0,  0,
+/* 0x2470 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2480 */  40,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  2,  0,  0,239,  0,  0,  0,
+/* 0x24a0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24b0 */  68,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,  8,  0,  0,  0, 76,  2,  0,  0,239,  0,  0,  0,
+/* 0x24d0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24e0 */  80,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  8,  0,  0,  0,104,  2,  0,  0,239,  0,  0,  0,
+/* 0x2500 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2510 */ 132,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,  8,  0,  0,  0,140,  2,  0,  0,239,  0,  0,  0,
+/* 0x2530 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2540 */ 164,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,  8,  0,  0,  0,200,  2,  0,  0,239,  0,  0,  0,
+/* 0x2560 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2570 */ 208,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,  8,  0,  0,  0,220,  2,  0,  0,239,  0,  0,  0,
+/* 0x2590 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25a0 */ 244,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,  8,  0,  0,  0, 12,  3,  0,  0,239,  0,  0,  0,
+/* 0x25c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25d0 */  20,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  3,  0,  0,239,  0,  0,  0,
+/* 0x25f0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2600 */  80,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,  8,  0,  0,  0, 88,  3,  0,  0,239,  0,  0,  0,
+/* 0x2620 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2630 */ 112,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,  8,  0,  0,  0,120,  3,  0,  0,239,  0,  0,  0,
+/* 0x2650 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2660 */ 156,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,  8,  0,  0,  0,176,  3,  0,  0,239,  0,  0,  0,
+/* 0x2680 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2690 */ 184,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26a0 */   0,  0,  0,  0,  8,  0,  0,  0,200,  3,  0,  0,239,  0,  0,  0,
+/* 0x26b0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x26c0 */ 204,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26d0 */   0,  0,  0,  0,  8,  0,  0,  0,  0,  4,  0,  0,239,  0,  0,  0,
+/* 0x26e0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x26f0 */  24,  4,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2700 */   0,  0,  0,  0,  8,  0,  0,  0, 64,  4,  0,  0,239,  0,  0,  0,
+/* 0x2710 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2720 */  56,  1,  0,  0,239,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2730 */   0,  0,  0,  0, 11,  0,  0,  0, 68,  1,  0,  0,239,  0,  0,  0,
+/* 0x2740 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2750 */  72,  1,  0,  0,227,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2760 */   0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86,
+/* 0x2770 */  95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 78,
+/* 0x2780 */  82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,
+/* 0x2790 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x27a0 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x27b0 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 69, 76, 70,
+/* 0x27c0 */  77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 77,
+/* 0x27d0 */  70, 76, 71,  0, 95,115,116, 97,114,116,  0,117, 99,108, 95,110,
+/* 0x27e0 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x27f0 */  56,  0,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,
+/* 0x2800 */ 109,112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118,
+/* 0x2810 */  50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,
+/* 0x2820 */  76,122,109, 97, 68,101, 99,111,100,101,  0,101,110,100, 95,100,
+/* 0x2830 */ 101, 99,111,109,112,114,101,115,115,  0, 79, 95, 66, 73, 78, 70,
+/* 0x2840 */  79,  0, 99,112,114, 48,  0, 82, 95, 65, 82, 77, 95, 65, 66, 83,
+/* 0x2850 */  51, 50,  0, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,  0, 68, 19,
+/* 0x2860 */   0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* arm.v5a-linux.kernel.vmlinux.h
-   created from arm.v5a-linux.kernel.vmlinux.bin, 15163 (0x3b3b) bytes
+   created from arm.v5a-linux.kernel.vmlinux.bin, 10388 (0x2894) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5A_LINUX_KERNEL_VMLINUX_SIZE    15163
-#define STUB_ARM_V5A_LINUX_KERNEL_VMLINUX_ADLER32 0xb9213212
-#define STUB_ARM_V5A_LINUX_KERNEL_VMLINUX_CRC32   0xd03fe05b
+#define STUB_ARM_V5A_LINUX_KERNEL_VMLINUX_SIZE    10388
+#define STUB_ARM_V5A_LINUX_KERNEL_VMLINUX_ADLER32 0x777c34e3
+#define STUB_ARM_V5A_LINUX_KERNEL_VMLINUX_CRC32   0xa790de20
 
-unsigned char stub_arm_v5a_linux_kernel_vmlinux[15163] = {
+unsigned char stub_arm_v5a_linux_kernel_vmlinux[10388] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 244, 18,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -326,662 +326,364 @@ unsigned char stub_arm_v5a_linux_kernel_vmlinux[15163] = {
 /* 0x11f0 */ 163, 50, 67, 32,  0,  0,176,224,176, 48,193,225,  2,240,160,225,
 /* 0x1200 */  85, 80, 88, 33,161,216,208,213,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x1210 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,
-/* 0x1220 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1230 */  50, 45,108,105,116,116,108,101, 97,114,109, 10, 10, 83,101, 99,
-/* 0x1240 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x1250 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x1260 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x1270 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x1280 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x1290 */  32, 76, 73, 78, 85, 88, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x12a0 */  48, 48, 48, 48, 48, 52, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x12b0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x12c0 */  48, 48, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x12d0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x12e0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 76, 73, 78, 85, 88,
-/* 0x12f0 */  48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x1300 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1310 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 99, 32,
-/* 0x1320 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1330 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1340 */  10, 32, 32, 50, 32, 76, 73, 78, 85, 88, 48, 50, 48, 32, 32, 32,
-/* 0x1350 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48,
-/* 0x1360 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1370 */  32, 48, 48, 48, 48, 48, 48, 57, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1380 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1390 */  78, 76, 89, 10, 32, 32, 51, 32, 99,116,111,107, 51, 50, 46, 48,
-/* 0x13a0 */  48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32,
-/* 0x13b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x13c0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 50, 42,
-/* 0x13d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x13e0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 99,116,111,107, 51,
-/* 0x13f0 */  50, 46, 53, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1400 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1410 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 97, 48, 32,
-/* 0x1420 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1430 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 99,116,
-/* 0x1440 */ 111,107, 51, 50, 46, 53, 49, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1450 */  48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1460 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1470 */  97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1480 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54,
-/* 0x1490 */  32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32, 48,
-/* 0x14a0 */  48, 48, 48, 48, 48, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x14b0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x14c0 */  48, 48, 48, 97, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x14d0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x14e0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 73, 78, 85, 88,
-/* 0x14f0 */  48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1500 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1510 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101, 99, 32,
-/* 0x1520 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1530 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 78, 82,
-/* 0x1540 */  86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1550 */  48, 48, 99, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1560 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1570 */ 101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1580 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1590 */  78, 76, 89, 10, 32, 32, 57, 32, 78, 82, 86, 50, 68, 32, 32, 32,
-/* 0x15a0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 48, 48, 32, 32,
-/* 0x15b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x15c0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 98, 48, 32, 32, 50, 42,
-/* 0x15d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x15e0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x15f0 */  48, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1600 */  48, 48, 48, 48, 48, 49, 49, 52, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1610 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1620 */  48, 48, 48, 50, 98, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1630 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1640 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 76, 90, 77, 65,
-/* 0x1650 */  95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1660 */  56, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1670 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 99, 52,
-/* 0x1680 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1690 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x16a0 */  89, 10, 32, 49, 50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x16b0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 57, 51, 56, 32, 32, 48, 48,
-/* 0x16c0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16d0 */  32, 32, 48, 48, 48, 48, 48, 52, 53, 48, 32, 32, 50, 42, 42, 48,
-/* 0x16e0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x16f0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32,
-/* 0x1700 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48,
-/* 0x1710 */  48, 48, 48, 52, 55, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1720 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1730 */  48,100, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1740 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1750 */  68, 79, 78, 76, 89, 10, 32, 49, 52, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1760 */  69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1770 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1780 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 48, 48, 32, 32,
-/* 0x1790 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x17a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53, 32, 85, 80, 88,
-/* 0x17b0 */  49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x17c0 */  48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x17d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 48,
-/* 0x17e0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x17f0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66,
-/* 0x1800 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1810 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88,
-/* 0x1820 */  48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 73, 78,
-/* 0x1830 */  85, 88, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1840 */  32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x1850 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50,
-/* 0x1860 */  46, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1870 */  32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9, 48,
-/* 0x1880 */  48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 49,
-/* 0x1890 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x18a0 */ 100, 32, 32, 76, 73, 78, 85, 88, 48, 51, 48,  9, 48, 48, 48, 48,
-/* 0x18b0 */  48, 48, 48, 48, 32, 76, 73, 78, 85, 88, 48, 51, 48, 10, 48, 48,
-/* 0x18c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x18d0 */  82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x18e0 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x18f0 */  32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48,
-/* 0x1900 */  48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1910 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1920 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1930 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1940 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48,
-/* 0x1950 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x1960 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1970 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x19a0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48,
-/* 0x19b0 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x19c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x19d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1a00 */  32, 76, 73, 78, 85, 88, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 32, 76, 73, 78, 85, 88, 48, 49, 48, 10, 48, 48, 48, 48,
-/* 0x1a20 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78,
-/* 0x1a30 */  85, 88, 48, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x1a40 */  73, 78, 85, 88, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46,
-/* 0x1a60 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107,
-/* 0x1a70 */  51, 50, 46, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1a80 */  32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 53, 49,
-/* 0x1a90 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50,
-/* 0x1aa0 */  46, 53, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1ab0 */  32, 32,100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68,  9, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 48, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ae0 */  32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1af0 */  77, 69, 84, 72, 79, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b00 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 48, 32, 67, 79, 77, 80, 82, 69, 83, 83, 69,
-/* 0x1b20 */  68, 95, 76, 69, 78, 71, 84, 72, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b30 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 85, 78, 67, 79, 77, 80, 82,
-/* 0x1b50 */  69, 83, 83, 69, 68, 95, 76, 69, 78, 71, 84, 72, 10, 48, 48, 48,
-/* 0x1b60 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x1b70 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,
-/* 0x1b80 */ 116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x1ba0 */  48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114, 95,105,
-/* 0x1bb0 */ 100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x1bc0 */  32, 70, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 99,
-/* 0x1bd0 */  52, 32,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,
-/* 0x1be0 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68,  9,
-/* 0x1c00 */  48, 48, 48, 48, 48, 49, 48, 48, 32,117, 99,108, 95,110,114,118,
-/* 0x1c10 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70,
-/* 0x1c30 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 49, 49, 52, 32,
-/* 0x1c40 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
-/* 0x1c50 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c60 */ 103, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1c70 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,122,109, 97,
-/* 0x1c80 */  68,101, 99,111,100,101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1c90 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1ca0 */  76, 73, 78, 85, 88, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1cb0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1cc0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x1ce0 */  32, 32, 32, 32, 32, 32, 32, 77, 69, 84, 72, 79, 68, 10, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1d00 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 73, 78, 85, 88, 48, 51,
-/* 0x1d10 */  48, 10, 48, 48, 48, 48, 48, 48, 51, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1d20 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 73, 78,
-/* 0x1d30 */  85, 88, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 51, 56, 32, 82,
-/* 0x1d40 */  95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x1d50 */  32, 67, 79, 77, 80, 82, 69, 83, 83, 69, 68, 95, 76, 69, 78, 71,
-/* 0x1d60 */  84, 72, 10, 48, 48, 48, 48, 48, 48, 51, 99, 32, 82, 95, 65, 82,
-/* 0x1d70 */  77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32, 85, 78,
-/* 0x1d80 */  67, 79, 77, 80, 82, 69, 83, 83, 69, 68, 95, 76, 69, 78, 71, 84,
-/* 0x1d90 */  72, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1da0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 73, 78,
-/* 0x1db0 */  85, 88, 48, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1dc0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x1dd0 */  73, 78, 85, 88, 48, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1de0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1df0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1e00 */  48, 48, 56, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32,
-/* 0x1e10 */  32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111,
-/* 0x1e20 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1e30 */  65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,
-/* 0x1e40 */ 101,114, 95,105,100, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82,
-/* 0x1e50 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e60 */  32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79,
-/* 0x1e70 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x1e80 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48, 93, 58, 10,
-/* 0x1e90 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x1eb0 */  10, 48, 48, 48, 48, 48, 48, 50, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1ec0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x1ed0 */  51, 50, 46, 49, 48, 10, 48, 48, 48, 48, 48, 48, 51, 99, 32, 82,
-/* 0x1ee0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ef0 */  32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x1f00 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x1f10 */  79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83,
-/* 0x1f20 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f30 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1f50 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x1f60 */  48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1f70 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x1f80 */  48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1f90 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x1fa0 */  48, 48, 48, 48, 48, 48, 53, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1fb0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x1fc0 */  10, 48, 48, 48, 48, 48, 48, 54, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1fd0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1fe0 */  66, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1ff0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2000 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82,
-/* 0x2010 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2020 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x2030 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2040 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95,
-/* 0x2050 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2060 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82,
-/* 0x2070 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2080 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32,
-/* 0x2090 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x20a0 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 99,
-/* 0x20b0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x20c0 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x20d0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x20e0 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x20f0 */  98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2100 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2110 */  48, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2120 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76,
-/* 0x2130 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x2140 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70,
-/* 0x2150 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2160 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2170 */  48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2180 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x21a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x21b0 */  48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x21c0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x21d0 */  10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x21e0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x21f0 */  68, 10, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2200 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2210 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82,
-/* 0x2220 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2230 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65,
-/* 0x2240 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2250 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95,
-/* 0x2260 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2270 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82,
-/* 0x2280 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2290 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32,
-/* 0x22a0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x22b0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 57, 99,
-/* 0x22c0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x22d0 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x22e0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x22f0 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2310 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x2320 */  48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2330 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x2340 */  48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2350 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x2360 */  48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2370 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x2380 */  48, 48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2390 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x23a0 */  48, 48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x23b0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x23c0 */  48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x23d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x23e0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x23f0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93,
-/* 0x2400 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2410 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2420 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82,
-/* 0x2430 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2440 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 65,
-/* 0x2450 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2460 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95,
-/* 0x2470 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2480 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82,
-/* 0x2490 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x24a0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 53, 99, 32,
-/* 0x24b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x24c0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 54, 56,
-/* 0x24d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x24e0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x24f0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2500 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2510 */  55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2520 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2530 */  48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2540 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x2550 */  48, 48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2560 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x2570 */  48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2580 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x2590 */  48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x25a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x25b0 */  48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x25c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x25d0 */  48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x25e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x25f0 */  10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2600 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2610 */  69, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2620 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2630 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65, 82,
-/* 0x2640 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2650 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65,
-/* 0x2660 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2670 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 52, 32, 82, 95,
-/* 0x2680 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2690 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82,
-/* 0x26a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26b0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,101, 52, 32,
-/* 0x26c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x26d0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 99,
-/* 0x26e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x26f0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 49,
-/* 0x2700 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2710 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2720 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2730 */  82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10,
-/* 0x2740 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2750 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2760 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2770 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2780 */  95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32,
-/* 0x2790 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x27a0 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x27b0 */  48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x27c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x27d0 */  48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x27e0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65,
-/* 0x27f0 */  95, 68, 69, 67, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x2800 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2810 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2820 */  55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2830 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2840 */  48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2850 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2860 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82,
-/* 0x2870 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2880 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2890 */  48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x28a0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x28b0 */  48, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77,
-/* 0x28c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x28d0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48,
-/* 0x28e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x28f0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2900 */  48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2910 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2920 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65,
-/* 0x2930 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2940 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2950 */  57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2960 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2970 */  48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2980 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2990 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,100, 56, 32, 82,
-/* 0x29a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x29b0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x29c0 */  48, 50, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x29d0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x29e0 */  48, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32, 82, 95, 65, 82, 77,
-/* 0x29f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2a00 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 50, 48,
-/* 0x2a10 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2a20 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2a30 */  48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2a40 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2a50 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82, 95, 65,
-/* 0x2a60 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2a70 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x2a80 */  52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2a90 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2aa0 */  48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2ab0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2ac0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 53, 56, 32, 82,
-/* 0x2ad0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ae0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2af0 */  48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2b00 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2b10 */  48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2b20 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2b30 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,101, 56,
-/* 0x2b40 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2b50 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2b60 */  48, 48, 48, 51, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2b70 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2b80 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65,
-/* 0x2b90 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2ba0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x2bb0 */  51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2bc0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2bd0 */  48, 48, 48, 48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2be0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2bf0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 48, 32, 82,
-/* 0x2c00 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c10 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2c20 */  48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2c30 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2c40 */  48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2c50 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2c60 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101, 48,
-/* 0x2c70 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2c80 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2c90 */  48, 48, 48, 51,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2ca0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2cb0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 50, 52, 32, 82, 95, 65,
-/* 0x2cc0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2cd0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x2ce0 */  51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2cf0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2d00 */  48, 48, 48, 48, 48, 52, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2d10 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2d20 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 52, 32, 82,
-/* 0x2d30 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d40 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2d50 */  48, 52, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2d60 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2d70 */  48, 10, 48, 48, 48, 48, 48, 52, 98, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2d80 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2d90 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,100, 52,
-/* 0x2da0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2db0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2dc0 */  48, 48, 48, 52,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2dd0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2de0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52,102, 52, 32, 82, 95, 65,
-/* 0x2df0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2e00 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,
-/* 0x2e10 */  49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2e20 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2e30 */  48, 48, 48, 48, 48, 53, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2e40 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2e50 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 57, 56, 32, 82,
-/* 0x2e60 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2e70 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2e80 */  48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2e90 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2ea0 */  48, 10, 48, 48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2eb0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2ec0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,101, 52,
-/* 0x2ed0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2ee0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2ef0 */  48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2f00 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2f10 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 48, 52, 32, 82, 95, 65,
-/* 0x2f20 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2f30 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x2f40 */  50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2f50 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2f60 */  48, 48, 48, 48, 48, 54, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2f70 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2f80 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 48, 32, 82,
-/* 0x2f90 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2fa0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2fb0 */  48, 54, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2fc0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2fd0 */  48, 10, 48, 48, 48, 48, 48, 54,100, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2fe0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2ff0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,101, 99,
-/* 0x3000 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3010 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x3020 */  48, 48, 48, 55, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3030 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3040 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 50, 56, 32, 82, 95, 65,
-/* 0x3050 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3060 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x3070 */  54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3080 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x3090 */  48, 48, 48, 48, 48, 55, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x30a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x30b0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 57, 99, 32, 82,
-/* 0x30c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x30e0 */  48, 55, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x30f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x3100 */  48, 10, 48, 48, 48, 48, 48, 55, 99, 52, 32, 82, 95, 65, 82, 77,
-/* 0x3110 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3120 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,100, 48,
-/* 0x3130 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3140 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x3150 */  48, 48, 48, 55,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3160 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3170 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 48, 32, 82, 95, 65,
-/* 0x3180 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3190 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x31a0 */  50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x31b0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x31c0 */  48, 48, 48, 48, 48, 56, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x31d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x31e0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 56, 56, 32, 82,
-/* 0x31f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3200 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3210 */  48, 56, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3220 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x3230 */  48, 10, 48, 48, 48, 48, 48, 56,101, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3240 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3250 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102, 52,
-/* 0x3260 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3270 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x3280 */  48, 48, 48, 56,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3290 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x32a0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 48, 52, 32, 82, 95, 65,
-/* 0x32b0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x32c0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57,
-/* 0x32d0 */  50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x32e0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x32f0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3300 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3310 */  67, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x3320 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3330 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32,
-/* 0x3340 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3350 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3360 */  48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3370 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3380 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 65, 82,
-/* 0x3390 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x33a0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x33b0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x33c0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x33d0 */  48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x33e0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x33f0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95,
-/* 0x3400 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3410 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3420 */  49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3430 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3440 */  10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3450 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3460 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32,
-/* 0x3470 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3480 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3490 */  48, 48, 49, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x34a0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x34b0 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 65, 82,
-/* 0x34c0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x34d0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50,
-/* 0x34e0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x34f0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3500 */  48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3510 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3520 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32, 82, 95,
-/* 0x3530 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3540 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3550 */  49, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3560 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3570 */  10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3580 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3590 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 56, 32,
-/* 0x35a0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x35b0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x35c0 */  48, 48, 49, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x35d0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x35e0 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 57, 99, 32, 82, 95, 65, 82,
-/* 0x35f0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3600 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 97,
-/* 0x3610 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3620 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3630 */  48, 48, 48, 48, 49, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3640 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3650 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95,
-/* 0x3660 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3670 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3680 */  49,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3690 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x36a0 */  10, 48, 48, 48, 48, 48, 49,100, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x36b0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x36c0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101, 52, 32,
-/* 0x36d0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x36e0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x36f0 */  48, 48, 49,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3700 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3710 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 56, 32, 82, 95, 65, 82,
-/* 0x3720 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3730 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50,
-/* 0x3740 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3750 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3760 */  48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3770 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3780 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95,
-/* 0x3790 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x37a0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x37b0 */  50, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x37c0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x37d0 */  10, 48, 48, 48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x37e0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x37f0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 52, 32,
-/* 0x3800 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3810 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3820 */  48, 48, 50, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3830 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3840 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82,
-/* 0x3850 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3860 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 99,
-/* 0x3870 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3880 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3890 */  48, 48, 48, 48, 50,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x38a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x38b0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 99, 32, 82, 95,
-/* 0x38c0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x38d0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x38e0 */  50,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x38f0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3900 */  10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3910 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3920 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 49, 52, 32,
-/* 0x3930 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3940 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3950 */  48, 48, 51, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3960 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3970 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 48, 32, 82, 95, 65, 82,
-/* 0x3980 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3990 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53,
-/* 0x39a0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x39b0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x39c0 */  48, 48, 48, 48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x39d0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x39e0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 56, 32, 82, 95,
-/* 0x39f0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3a00 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3a10 */  51, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3a20 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3a30 */  10, 48, 48, 48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3a40 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3a50 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 56, 32,
-/* 0x3a60 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3a70 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3a80 */  48, 48, 51, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3a90 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3aa0 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82,
-/* 0x3ab0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3ac0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 48,
-/* 0x3ad0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3ae0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3af0 */  48, 48, 48, 48, 52, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3b00 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3b10 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 52, 48, 32, 82, 95,
-/* 0x3b20 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3b30 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10
+/* 0x1220 */  16,  0,  0,  0, 25,  0,  0,  0,198,  0,  0,  0, 48, 21,  0,  0,
+/* 0x1230 */   0,  0,  0,  0, 52,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1240 */   9,  0,  0,  0,124,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1250 */  18,  0,  0,  0,144,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1260 */  27,  0,  0,  0,156,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1270 */  37,  0,  0,  0,160,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1280 */  47,  0,  0,  0,164,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1290 */  57,  0,  0,  0,168,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12a0 */  67,  0,  0,  0,236,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12b0 */  76,  0,  0,  0,236,  0,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12c0 */  82,  0,  0,  0,176,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x12d0 */  88,  0,  0,  0,176,  2,  0,  0, 20,  1,  0,  0,  0,  0,  0,  0,
+/* 0x12e0 */  94,  0,  0,  0,196,  3,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12f0 */ 105,  0,  0,  0, 80,  4,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1300 */ 116,  0,  0,  0,136, 13,  0,  0,120,  4,  0,  0,  0,  0,  0,  0,
+/* 0x1310 */ 127,  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1320 */ 138,  0,  0,  0,  0, 18,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1330 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1340 */  27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1350 */  57,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1360 */  67,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1370 */  76,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1380 */  82,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1390 */  88,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13a0 */  94,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13b0 */ 105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13c0 */ 116,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13d0 */ 127,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13e0 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13f0 */  18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1400 */  37,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1410 */  47,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1420 */ 138,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1430 */ 147,  0,  0,  0, 17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1440 */ 154,  0,  0,  0, 17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1450 */ 172,  0,  0,  0, 17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1460 */ 192,  0,  0,  0, 17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1470 */ 203,  0,  0,  0, 17,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1480 */ 213,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */ 236,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14a0 */   3,  1,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14b0 */  26,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0, 12,  0,  0,  0, 37,  1,  0,  0, 16,  0,  0,  0,
+/* 0x14d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,
+/* 0x14e0 */  49,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0, 52,  0,  0,  0, 49,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1510 */  37,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0, 60,  0,  0,  0, 37,  1,  0,  0, 18,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1540 */  49,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */   1,  0,  0,  0,  8,  0,  0,  0, 37,  1,  0,  0, 19,  0,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1570 */  37,  1,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */   1,  0,  0,  0, 16,  0,  0,  0, 49,  1,  0,  0,  1,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 32,  0,  0,  0,
+/* 0x15a0 */  49,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   6,  0,  0,  0, 60,  0,  0,  0, 49,  1,  0,  0,  2,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 16,  0,  0,  0,
+/* 0x15d0 */  49,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */   8,  0,  0,  0, 72,  0,  0,  0, 49,  1,  0,  0,  4,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  0,  0,  0,
+/* 0x1600 */  49,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   8,  0,  0,  0, 84,  0,  0,  0, 49,  1,  0,  0,  4,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,100,  0,  0,  0,
+/* 0x1630 */  49,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   8,  0,  0,  0,104,  0,  0,  0, 49,  1,  0,  0,  4,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,108,  0,  0,  0,
+/* 0x1660 */  49,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   8,  0,  0,  0,120,  0,  0,  0, 49,  1,  0,  0,  4,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,136,  0,  0,  0,
+/* 0x1690 */  49,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   8,  0,  0,  0,140,  0,  0,  0, 49,  1,  0,  0,  4,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,148,  0,  0,  0,
+/* 0x16c0 */  49,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   8,  0,  0,  0,156,  0,  0,  0, 49,  1,  0,  0,  4,  0,  0,  0,
+/* 0x16e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,160,  0,  0,  0,
+/* 0x16f0 */  49,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   8,  0,  0,  0,188,  0,  0,  0, 49,  1,  0,  0,  4,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,192,  0,  0,  0,
+/* 0x1720 */  49,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1730 */   9,  0,  0,  0, 16,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1740 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1750 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */   9,  0,  0,  0, 72,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1770 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 80,  0,  0,  0,
+/* 0x1780 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */   9,  0,  0,  0, 92,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x17a0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,104,  0,  0,  0,
+/* 0x17b0 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   9,  0,  0,  0,116,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x17d0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,120,  0,  0,  0,
+/* 0x17e0 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */   9,  0,  0,  0,132,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1800 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,148,  0,  0,  0,
+/* 0x1810 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */   9,  0,  0,  0,156,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1830 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,164,  0,  0,  0,
+/* 0x1840 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */   9,  0,  0,  0,176,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1860 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,184,  0,  0,  0,
+/* 0x1870 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   9,  0,  0,  0,196,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,208,  0,  0,  0,
+/* 0x18a0 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */   9,  0,  0,  0,212,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,248,  0,  0,  0,
+/* 0x18d0 */  49,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */   9,  0,  0,  0,252,  0,  0,  0, 49,  1,  0,  0,  5,  0,  0,  0,
+/* 0x18f0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1900 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */  10,  0,  0,  0, 68,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 72,  0,  0,  0,
+/* 0x1930 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */  10,  0,  0,  0, 80,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1950 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 92,  0,  0,  0,
+/* 0x1960 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */  10,  0,  0,  0,104,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,116,  0,  0,  0,
+/* 0x1990 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */  10,  0,  0,  0,120,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,132,  0,  0,  0,
+/* 0x19c0 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */  10,  0,  0,  0,148,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,156,  0,  0,  0,
+/* 0x19f0 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */  10,  0,  0,  0,160,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,168,  0,  0,  0,
+/* 0x1a20 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */  10,  0,  0,  0,172,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,184,  0,  0,  0,
+/* 0x1a50 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */  10,  0,  0,  0,188,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,196,  0,  0,  0,
+/* 0x1a80 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */  10,  0,  0,  0,208,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,212,  0,  0,  0,
+/* 0x1ab0 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */  10,  0,  0,  0,220,  0,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,228,  0,  0,  0,
+/* 0x1ae0 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */  10,  0,  0,  0, 12,  1,  0,  0, 49,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 16,  1,  0,  0,
+/* 0x1b10 */  49,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */  11,  0,  0,  0,  8,  0,  0,  0, 49,  1,  0,  0, 10,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 76,  0,  0,  0,
+/* 0x1b40 */  49,  1,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */  11,  0,  0,  0,128,  0,  0,  0, 49,  1,  0,  0,  7,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,116,  0,  0,  0,
+/* 0x1b70 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */  12,  0,  0,  0,144,  0,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,184,  0,  0,  0,
+/* 0x1ba0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */  12,  0,  0,  0,204,  0,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,244,  0,  0,  0,
+/* 0x1bd0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */  12,  0,  0,  0,  0,  1,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  8,  1,  0,  0,
+/* 0x1c00 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */  12,  0,  0,  0, 68,  1,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,144,  1,  0,  0,
+/* 0x1c30 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */  12,  0,  0,  0,204,  1,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,216,  1,  0,  0,
+/* 0x1c60 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */  12,  0,  0,  0,  4,  2,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 24,  2,  0,  0,
+/* 0x1c90 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */  12,  0,  0,  0, 32,  2,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 52,  2,  0,  0,
+/* 0x1cc0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */  12,  0,  0,  0, 60,  2,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 64,  2,  0,  0,
+/* 0x1cf0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */  12,  0,  0,  0, 76,  2,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 88,  2,  0,  0,
+/* 0x1d20 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */  12,  0,  0,  0,164,  2,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,200,  2,  0,  0,
+/* 0x1d50 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */  12,  0,  0,  0,232,  2,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  4,  3,  0,  0,
+/* 0x1d80 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */  12,  0,  0,  0, 12,  3,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 60,  3,  0,  0,
+/* 0x1db0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */  12,  0,  0,  0,136,  3,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,160,  3,  0,  0,
+/* 0x1de0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */  12,  0,  0,  0,168,  3,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,204,  3,  0,  0,
+/* 0x1e10 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */  12,  0,  0,  0,224,  3,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,232,  3,  0,  0,
+/* 0x1e40 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */  12,  0,  0,  0, 36,  4,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 56,  4,  0,  0,
+/* 0x1e70 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */  12,  0,  0,  0,108,  4,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,132,  4,  0,  0,
+/* 0x1ea0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */  12,  0,  0,  0,140,  4,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,176,  4,  0,  0,
+/* 0x1ed0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */  12,  0,  0,  0,212,  4,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,236,  4,  0,  0,
+/* 0x1f00 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */  12,  0,  0,  0,244,  4,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 24,  5,  0,  0,
+/* 0x1f30 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */  12,  0,  0,  0, 60,  5,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,152,  5,  0,  0,
+/* 0x1f60 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */  12,  0,  0,  0,160,  5,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,192,  5,  0,  0,
+/* 0x1f90 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */  12,  0,  0,  0,228,  5,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,252,  5,  0,  0,
+/* 0x1fc0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */  12,  0,  0,  0,  4,  6,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 36,  6,  0,  0,
+/* 0x1ff0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */  12,  0,  0,  0, 72,  6,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,128,  6,  0,  0,
+/* 0x2020 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */  12,  0,  0,  0,140,  6,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,208,  6,  0,  0,
+/* 0x2050 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */  12,  0,  0,  0,236,  6,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 28,  7,  0,  0,
+/* 0x2080 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */  12,  0,  0,  0, 40,  7,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,108,  7,  0,  0,
+/* 0x20b0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */  12,  0,  0,  0,124,  7,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,156,  7,  0,  0,
+/* 0x20e0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */  12,  0,  0,  0,184,  7,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,196,  7,  0,  0,
+/* 0x2110 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */  12,  0,  0,  0,208,  7,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,244,  7,  0,  0,
+/* 0x2140 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */  12,  0,  0,  0, 32,  8,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 44,  8,  0,  0,
+/* 0x2170 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */  12,  0,  0,  0,124,  8,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,136,  8,  0,  0,
+/* 0x21a0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */  12,  0,  0,  0,160,  8,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,232,  8,  0,  0,
+/* 0x21d0 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */  12,  0,  0,  0,244,  8,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,252,  8,  0,  0,
+/* 0x2200 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */  12,  0,  0,  0,  4,  9,  0,  0, 49,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 40,  9,  0,  0,
+/* 0x2230 */  49,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */  13,  0,  0,  0,120,  0,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,128,  0,  0,  0,
+/* 0x2260 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2270 */  13,  0,  0,  0,136,  0,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,168,  0,  0,  0,
+/* 0x2290 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */  13,  0,  0,  0,172,  0,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,228,  0,  0,  0,
+/* 0x22c0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22d0 */  13,  0,  0,  0,  0,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 12,  1,  0,  0,
+/* 0x22f0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2300 */  13,  0,  0,  0, 20,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 24,  1,  0,  0,
+/* 0x2320 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2330 */  13,  0,  0,  0, 32,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 40,  1,  0,  0,
+/* 0x2350 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2360 */  13,  0,  0,  0, 68,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 76,  1,  0,  0,
+/* 0x2380 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2390 */  13,  0,  0,  0, 80,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,128,  1,  0,  0,
+/* 0x23b0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */  13,  0,  0,  0,136,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,140,  1,  0,  0,
+/* 0x23e0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23f0 */  13,  0,  0,  0,156,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,160,  1,  0,  0,
+/* 0x2410 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2420 */  13,  0,  0,  0,192,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,204,  1,  0,  0,
+/* 0x2440 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2450 */  13,  0,  0,  0,212,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,220,  1,  0,  0,
+/* 0x2470 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2480 */  13,  0,  0,  0,228,  1,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,236,  1,  0,  0,
+/* 0x24a0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24b0 */  13,  0,  0,  0, 40,  2,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 44,  2,  0,  0,
+/* 0x24d0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24e0 */  13,  0,  0,  0, 68,  2,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 76,  2,  0,  0,
+/* 0x2500 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2510 */  13,  0,  0,  0, 80,  2,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,104,  2,  0,  0,
+/* 0x2530 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2540 */  13,  0,  0,  0,132,  2,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,140,  2,  0,  0,
+/* 0x2560 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */  13,  0,  0,  0,164,  2,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,200,  2,  0,  0,
+/* 0x2590 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25a0 */  13,  0,  0,  0,208,  2,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,220,  2,  0,  0,
+/* 0x25c0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25d0 */  13,  0,  0,  0,244,  2,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 12,  3,  0,  0,
+/* 0x25f0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */  13,  0,  0,  0, 20,  3,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 44,  3,  0,  0,
+/* 0x2620 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */  13,  0,  0,  0, 80,  3,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 88,  3,  0,  0,
+/* 0x2650 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */  13,  0,  0,  0,112,  3,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,120,  3,  0,  0,
+/* 0x2680 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2690 */  13,  0,  0,  0,156,  3,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x26a0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,176,  3,  0,  0,
+/* 0x26b0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26c0 */  13,  0,  0,  0,184,  3,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x26d0 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,200,  3,  0,  0,
+/* 0x26e0 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26f0 */  13,  0,  0,  0,204,  3,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2700 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  4,  0,  0,
+/* 0x2710 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2720 */  13,  0,  0,  0, 24,  4,  0,  0, 49,  1,  0,  0,  9,  0,  0,  0,
+/* 0x2730 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 64,  4,  0,  0,
+/* 0x2740 */  49,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2750 */  76, 73, 78, 85, 88, 48, 48, 48,  0, 76, 73, 78, 85, 88, 48, 49,
+/* 0x2760 */  48,  0, 76, 73, 78, 85, 88, 48, 50, 48,  0, 99,116,111,107, 51,
+/* 0x2770 */  50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46, 53, 48,  0, 99,
+/* 0x2780 */ 116,111,107, 51, 50, 46, 53, 49,  0, 99,116,111,107, 51, 50, 46,
+/* 0x2790 */  49, 48,  0, 76, 73, 78, 85, 88, 48, 51, 48,  0, 78, 82, 86, 50,
+/* 0x27a0 */  66,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 69,  0, 76, 90,
+/* 0x27b0 */  77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x27c0 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76,
+/* 0x27d0 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 85, 80, 88, 49, 72, 69,
+/* 0x27e0 */  65, 68,  0, 77, 69, 84, 72, 79, 68,  0, 67, 79, 77, 80, 82, 69,
+/* 0x27f0 */  83, 83, 69, 68, 95, 76, 69, 78, 71, 84, 72,  0, 85, 78, 67, 79,
+/* 0x2800 */  77, 80, 82, 69, 83, 83, 69, 68, 95, 76, 69, 78, 71, 84, 72,  0,
+/* 0x2810 */ 102,105,108,116,101,114, 95, 99,116,111,  0,102,105,108,116,101,
+/* 0x2820 */ 114, 95,105,100,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,
+/* 0x2830 */ 101, 99,111,109,112,114,101,115,115, 95, 56,  0,117, 99,108, 95,
+/* 0x2840 */ 110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115,
+/* 0x2850 */  95, 56,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
+/* 0x2860 */ 111,109,112,114,101,115,115, 95, 56,  0, 76,122,109, 97, 68,101,
+/* 0x2870 */  99,111,100,101,  0, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
+/* 0x2880 */   0, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,  0, 32, 18,  0,  0,
+/* 0x2890 */  85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* arm64-darwin.macho-entry.h
-   created from arm64-darwin.macho-entry.bin, 7897 (0x1ed9) bytes
+   created from arm64-darwin.macho-entry.bin, 5851 (0x16db) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_SIZE    7897
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_ADLER32 0x49d29f40
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_CRC32   0xe5a4355a
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_SIZE    5851
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_ADLER32 0xead19ef9
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_CRC32   0x7dbdd8b9
 
-unsigned char stub_arm64_darwin_macho_entry[7897] = {
+unsigned char stub_arm64_darwin_macho_entry[5851] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,160, 22,  0,  0,  0,  0,  0,  0,
@@ -348,186 +348,58 @@ unsigned char stub_arm64_darwin_macho_entry[7897] = {
 /* 0x1350 */   1,  0,128,210,168,  0,128, 82,  1,  0,  0,212,224, 15, 29,248,
 /* 0x1360 */   1,  0,  0, 16,246,  3,  1,170, 32, 68, 64,184,214, 66, 32,203,
 /* 0x1370 */ 246, 19,  0,249,244,  3,  1,170, 32, 68, 64,184,148, 66, 32,203,
-/* 0x1380 */  21, 32,  0,209,173,255,255,151,102,105,108,101, 32,102,111,114,
-/* 0x1390 */ 109, 97,116, 32,101,108,102, 54, 52, 45,108,105,116,116,108,101,
-/* 0x13a0 */  97, 97,114, 99,104, 54, 52, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x13b0 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x13c0 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x13d0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x13e0 */  32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x13f0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1400 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 77, 65, 67,
-/* 0x1410 */  72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1420 */  48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1430 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1440 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52,
-/* 0x1450 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1460 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1470 */  76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32,
-/* 0x1480 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1490 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x14a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x14b0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42,
-/* 0x14c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x14d0 */  68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32,
-/* 0x14e0 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50, 56,
-/* 0x14f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1500 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1510 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32,
-/* 0x1520 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1530 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x1540 */  50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1550 */  49, 49, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1560 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1570 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55,
-/* 0x1580 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1590 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32,
-/* 0x15a0 */  78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x15b0 */  48, 48, 48, 48,102, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x15c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x15d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x15e0 */  48, 50, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x15f0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1600 */  32, 53, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32,
-/* 0x1610 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1620 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1630 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1640 */  48, 48, 48, 48, 51, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1650 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1660 */  89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x1670 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 98, 56, 32, 32, 48, 48,
-/* 0x1680 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1690 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16a0 */  32, 32, 48, 48, 48, 48, 48, 51, 55, 99, 32, 32, 50, 42, 42, 48,
-/* 0x16b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x16c0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32,
-/* 0x16d0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48,
-/* 0x16e0 */  48, 48, 48, 57, 54, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1700 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1710 */  48, 52, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1720 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1730 */  32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x1740 */  32, 48, 48, 48, 48, 48, 52, 57, 99, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1750 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1760 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1770 */  48, 48, 48, 48,100, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1780 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1790 */  89, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x17a0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x17b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x17c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17d0 */  32, 32, 48, 48, 48, 48, 49, 50, 51, 56, 32, 32, 50, 42, 42, 48,
-/* 0x17e0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x17f0 */  79, 78, 76, 89, 10, 32, 49, 48, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1800 */  78, 89, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1810 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1820 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1830 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 51, 56, 32, 32, 50,
-/* 0x1840 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1850 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 77, 65, 67, 72,
-/* 0x1860 */  77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1870 */  53, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1880 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1890 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 51, 56,
-/* 0x18a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x18b0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x18c0 */  89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x18d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18e0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x18f0 */  67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1900 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1920 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1930 */  78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x1950 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1960 */  32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88,
-/* 0x1970 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1980 */  48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x19a0 */  32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x19c0 */  82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x19e0 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1a00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1a10 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48,
-/* 0x1a20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x1a30 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a40 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1a50 */  50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1a80 */ 100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48,
-/* 0x1a90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x1aa0 */  95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1ac0 */  90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1ae0 */  69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1b00 */  90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1b20 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1b40 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1b60 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x1b80 */  65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65,
-/* 0x1ba0 */  73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67,
-/* 0x1bc0 */  72, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48,
-/* 0x1be0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1bf0 */ 103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69,  9, 48, 48,
-/* 0x1c00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 50, 56, 32,117,
-/* 0x1c10 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
-/* 0x1c20 */ 101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32,
-/* 0x1c40 */  78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 48, 49, 49, 99, 32,117, 99,108, 95,110,114,118, 50,100,
-/* 0x1c60 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c80 */ 103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66,  9, 48, 48,
-/* 0x1c90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,102, 48, 32,117,
-/* 0x1ca0 */  99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,
-/* 0x1cb0 */ 101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1cd0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,122,109, 97,
-/* 0x1cf0 */  68,101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d10 */  77, 65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,
-/* 0x1d30 */ 101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1d40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1d50 */  82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78, 88, 93, 58, 10, 79,
-/* 0x1d60 */  70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d70 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d80 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72,
-/* 0x1da0 */  54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 77, 65, 67, 72, 77,
-/* 0x1db0 */  65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 48, 48,100, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1dd0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1de0 */  91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70,
-/* 0x1df0 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x1e00 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e10 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54,
-/* 0x1e30 */  52, 95, 67, 79, 78, 68, 66, 82, 49, 57, 32, 32, 76, 90, 77, 65,
-/* 0x1e40 */  95, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1e50 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1e60 */  77, 65, 67, 72, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83,
-/* 0x1e70 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x1e80 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1e90 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 49, 50, 56, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95,
-/* 0x1eb0 */  65, 68, 82, 95, 80, 82, 69, 76, 95, 76, 79, 50, 49, 32, 32, 95,
-/* 0x1ec0 */ 115,116, 97,114,116, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 48, 48, 48, 48, 48, 56, 10
+/* 0x1380 */  21, 32,  0,209,173,255,255,151, 12,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1390 */   3,  0,  0,  0, 56,  2,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x13a0 */   8,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 72,  0,  0,  0,
+/* 0x13b0 */   0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 72,  0,  0,  0,
+/* 0x13c0 */  40,  1,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,112,  1,  0,  0,
+/* 0x13d0 */  28,  1,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,140,  2,  0,  0,
+/* 0x13e0 */ 240,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,124,  3,  0,  0,
+/* 0x13f0 */   0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,124,  3,  0,  0,
+/* 0x1400 */ 184,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 52,  4,  0,  0,
+/* 0x1410 */ 104,  9,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,156, 13,  0,  0,
+/* 0x1420 */ 156,  4,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0, 56, 18,  0,  0,
+/* 0x1430 */   0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 56, 18,  0,  0,
+/* 0x1440 */   0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 56, 18,  0,  0,
+/* 0x1450 */  80,  1,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1460 */   0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1470 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1480 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  2,  0,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  3,  0,  0,  0,
+/* 0x14b0 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  4,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  5,  0,  0,  0,
+/* 0x14d0 */   0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  6,  0,  0,  0,
+/* 0x14e0 */   0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  7,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1510 */   0,  0,  0,  0,  0,  0,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0,  0,  0,  0,  0,141,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1540 */   0,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1550 */   0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  0,  0,  0,  0,200,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1570 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1580 */ 215,  0,  0,  0,  1,  0,  0,  0,220,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1590 */   6,  0,  0,  0,  4,  0,  0,  0,232,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15a0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 40,  1,  0,  0,
+/* 0x15b0 */ 251,  0,  0,  0, 12,  0,  0,  0,248,255,255,255,255,255,255,255,
+/* 0x15c0 */  77, 65, 67, 72, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69,
+/* 0x15d0 */  65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78,
+/* 0x15e0 */  82, 86, 50, 66,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 76, 90,
+/* 0x15f0 */  77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1600 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76,
+/* 0x1610 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 77, 65, 67, 72, 77, 65,
+/* 0x1620 */  73, 78, 89,  0, 77, 65, 67, 72, 77, 65, 73, 78, 90,  0, 95,115,
+/* 0x1630 */ 116, 97,114,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,
+/* 0x1640 */ 101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0,117, 99,108,
+/* 0x1650 */  95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,
+/* 0x1660 */ 115, 95, 51, 50,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,
+/* 0x1670 */ 101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0, 76,122,109,
+/* 0x1680 */  97, 68,101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,
+/* 0x1690 */ 109,112,114,101,115,115,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52,
+/* 0x16a0 */  95, 67, 65, 76, 76, 50, 54,  0, 82, 95, 65, 65, 82, 67, 72, 54,
+/* 0x16b0 */  52, 95, 67, 79, 78, 68, 66, 82, 49, 57,  0, 82, 95, 65, 65, 82,
+/* 0x16c0 */  67, 72, 54, 52, 95, 65, 68, 82, 95, 80, 82, 69, 76, 95, 76, 79,
+/* 0x16d0 */  50, 49,  0,136, 19,  0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* arm64-linux.elf-entry.h
-   created from arm64-linux.elf-entry.bin, 8110 (0x1fae) bytes
+   created from arm64-linux.elf-entry.bin, 6009 (0x1779) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_LINUX_ELF_ENTRY_SIZE    8110
-#define STUB_ARM64_LINUX_ELF_ENTRY_ADLER32 0xaf20ceb5
-#define STUB_ARM64_LINUX_ELF_ENTRY_CRC32   0x1c7b1387
+#define STUB_ARM64_LINUX_ELF_ENTRY_SIZE    6009
+#define STUB_ARM64_LINUX_ELF_ENTRY_ADLER32 0x71cabbd0
+#define STUB_ARM64_LINUX_ELF_ENTRY_CRC32   0x0a3d1f7b
 
-unsigned char stub_arm64_linux_elf_entry[8110] = {
+unsigned char stub_arm64_linux_elf_entry[6009] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0, 88, 23,  0,  0,  0,  0,  0,  0,
@@ -354,193 +354,62 @@ unsigned char stub_arm64_linux_elf_entry[8110] = {
 /* 0x13b0 */  63, 24,  0,113, 96,  0,  0, 84,161,255,255, 53, 34,  0,160,210,
 /* 0x13c0 */ 250,  3,  2,203, 96, 12,128, 18,161,252,255, 16,  2,  0,128, 82,
 /* 0x13d0 */   8,  7,128, 82,  1,  0,  0,212,251,  3,  0, 42, 31,  0,  0,113,
-/* 0x13e0 */ 203,252,255, 84,170,255,255,151,  0,  0,  0,  0,102,105,108,101,
-/* 0x13f0 */  32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,108,105,
-/* 0x1400 */ 116,116,108,101, 97, 97,114, 99,104, 54, 52, 10, 10, 83,101, 99,
-/* 0x1410 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x1420 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x1430 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1440 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1450 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x1460 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x1470 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1480 */  48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1490 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x14a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x14b0 */  48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x14c0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x14d0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72,
-/* 0x14e0 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x14f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1500 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1510 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32,
-/* 0x1520 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1530 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82,
-/* 0x1540 */  86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1550 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1560 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1570 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1580 */  52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1590 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51,
-/* 0x15a0 */  32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x15b0 */  48, 48, 48, 48, 49, 50, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x15c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x15d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x15e0 */  48, 48, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x15f0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1600 */  32, 32, 52, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1610 */  32, 32, 48, 48, 48, 48, 48, 49, 49, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1620 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1630 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1640 */  48, 48, 48, 48, 48, 49, 55, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1650 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1660 */  76, 89, 10, 32, 32, 53, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32,
-/* 0x1670 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 48, 32, 32, 48,
-/* 0x1680 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1690 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16a0 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 56, 99, 32, 32, 50, 42, 42,
-/* 0x16b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x16c0 */  68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69,
-/* 0x16d0 */  76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 98, 56,
-/* 0x16e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16f0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1700 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 55, 99, 32, 32,
-/* 0x1710 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1720 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1730 */  32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32,
-/* 0x1740 */  32, 32, 48, 48, 48, 48, 48, 57, 54, 56, 32, 32, 48, 48, 48, 48,
-/* 0x1750 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1760 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1770 */  48, 48, 48, 48, 48, 52, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1780 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1790 */  76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x17a0 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 52, 57, 99, 32, 32, 48,
-/* 0x17b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x17c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17d0 */  48, 32, 32, 48, 48, 48, 48, 48,100, 57, 99, 32, 32, 50, 42, 42,
-/* 0x17e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x17f0 */  68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1800 */  69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1810 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1820 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1830 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 51, 56, 32, 32,
-/* 0x1840 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1850 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 69, 76, 70,
-/* 0x1860 */  77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1870 */  48, 51,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1880 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1890 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 51,
-/* 0x18a0 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x18b0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32,
-/* 0x18c0 */  69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x18d0 */  48, 48, 48, 49, 55, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x18f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1900 */  49, 50, 55, 56, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84,
-/* 0x1910 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1920 */  68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66,
-/* 0x1930 */  76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x1950 */  65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1960 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1970 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70,
-/* 0x1990 */  77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x19d0 */  88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1a00 */  32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1a20 */  82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1a40 */  32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84,
-/* 0x1a60 */  65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1a80 */  50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a90 */  48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1ab0 */ 100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ae0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b00 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1b20 */  90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1b40 */  69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1b60 */  90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1b80 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1ba0 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1bc0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1be0 */  76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1c00 */  89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x1c20 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  48, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 52, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c50 */  69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116,
-/* 0x1c70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69,  9,
-/* 0x1c90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 50, 56,
-/* 0x1ca0 */  32,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
-/* 0x1cb0 */ 112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1cd0 */  70, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 49, 49, 99, 32,117, 99,108, 95,110,114,118,
-/* 0x1cf0 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,
-/* 0x1d00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d10 */  48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66,  9,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,102, 48,
-/* 0x1d30 */  32,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
-/* 0x1d40 */ 112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1d60 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48,
-/* 0x1d70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,122,
-/* 0x1d80 */ 109, 97, 68,101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1da0 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,110,100, 95,
-/* 0x1dc0 */ 100,101, 99,111,109,112,114,101,115,115, 10, 48, 48, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1de0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79, 95, 66, 73, 78,
-/* 0x1e00 */  70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x1e10 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77,
-/* 0x1e20 */  65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x1e30 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x1e40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e60 */  32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65, 66, 83, 51, 50,
-/* 0x1e70 */  32, 32, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72,
-/* 0x1e90 */  54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 69, 76, 70, 77, 65,
-/* 0x1ea0 */  73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 49, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1ec0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1ed0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x1ee0 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x1ef0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f00 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52,
-/* 0x1f20 */  95, 67, 79, 78, 68, 66, 82, 49, 57, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1f30 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1f40 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x1f50 */  76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1f60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1f80 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f90 */  49, 55, 48, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65, 66,
-/* 0x1fa0 */  83, 51, 50, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x13e0 */ 203,252,255, 84,170,255,255,151,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x13f0 */  20,  0,  0,  0,  4,  0,  0,  0,112,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1400 */  64,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1410 */  72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1420 */  72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1430 */  72,  0,  0,  0, 40,  1,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1440 */ 112,  1,  0,  0, 28,  1,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1450 */ 140,  2,  0,  0,240,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1460 */ 124,  3,  0,  0,184,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1470 */  52,  4,  0,  0,104,  9,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1480 */ 156, 13,  0,  0,156,  4,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x1490 */  56, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x14a0 */  56, 18,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x14b0 */ 120, 18,  0,  0,116,  1,  0,  0,  2,  0,  0,  0, 78,  0,  0,  0,
+/* 0x14c0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x14d0 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x14f0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1500 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1510 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1520 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1530 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1540 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1550 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1560 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1570 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0,
+/* 0x1580 */  13,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,112,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,119,  0,  0,  0,
+/* 0x15a0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,143,  0,  0,  0,
+/* 0x15b0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,  0,
+/* 0x15c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,191,  0,  0,  0,
+/* 0x15d0 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,202,  0,  0,  0,
+/* 0x15e0 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,217,  0,  0,  0,
+/* 0x15f0 */  13,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1600 */   0,  0,  0,  0,225,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,241,  0,  0,  0,
+/* 0x1620 */   1,  0,  0,  0, 32,  1,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1630 */   4,  0,  0,  0,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0, 11,  0,  0,  0,112,  1,  0,  0,225,  0,  0,  0,
+/* 0x1650 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77,
+/* 0x1660 */  65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82,
+/* 0x1670 */  86, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86,
+/* 0x1680 */  50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76,
+/* 0x1690 */  70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76,
+/* 0x16a0 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x16b0 */  69, 67, 51, 48,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76,
+/* 0x16c0 */  70, 77, 65, 73, 78, 90,  0, 77, 70, 76, 71,  0, 95,115,116, 97,
+/* 0x16d0 */ 114,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
+/* 0x16e0 */ 111,109,112,114,101,115,115, 95, 51, 50,  0,117, 99,108, 95,110,
+/* 0x16f0 */ 114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x1700 */  51, 50,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,
+/* 0x1710 */ 111,109,112,114,101,115,115, 95, 51, 50,  0, 76,122,109, 97, 68,
+/* 0x1720 */ 101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,109,112,
+/* 0x1730 */ 114,101,115,115,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 65,
+/* 0x1740 */  65, 82, 67, 72, 54, 52, 95, 65, 66, 83, 51, 50,  0, 82, 95, 65,
+/* 0x1750 */  65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54,  0, 82, 95,
+/* 0x1760 */  65, 65, 82, 67, 72, 54, 52, 95, 67, 79, 78, 68, 66, 82, 49, 57,
+/* 0x1770 */   0,236, 19,  0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* arm64-linux.shlib-init.h
-   created from arm64-linux.shlib-init.bin, 8638 (0x21be) bytes
+   created from arm64-linux.shlib-init.bin, 6369 (0x18e1) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_LINUX_SHLIB_INIT_SIZE    8638
-#define STUB_ARM64_LINUX_SHLIB_INIT_ADLER32 0xf4568368
-#define STUB_ARM64_LINUX_SHLIB_INIT_CRC32   0x356b7479
+#define STUB_ARM64_LINUX_SHLIB_INIT_SIZE    6369
+#define STUB_ARM64_LINUX_SHLIB_INIT_ADLER32 0x5cf94772
+#define STUB_ARM64_LINUX_SHLIB_INIT_CRC32   0xf7cbbca1
 
-unsigned char stub_arm64_linux_shlib_init[8638] = {
+unsigned char stub_arm64_linux_shlib_init[6369] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,168, 24,  0,  0,  0,  0,  0,  0,
@@ -376,204 +376,63 @@ unsigned char stub_arm64_linux_shlib_init[8638] = {
 /* 0x1510 */ 255,151,224,135, 67,169,162,  0,128,210, 72, 28,128, 82,  1,  0,
 /* 0x1520 */   0,212, 31,  4, 64,177, 67,  0,  0, 84,  0,  0, 32,212,254, 95,
 /* 0x1530 */  64,249,192,  3, 31,214, 99,192, 95,184, 99, 92,  0, 18, 66,  0,
-/* 0x1540 */   3,139,192,  3, 95,214,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x1550 */ 116, 32,101,108,102, 54, 52, 45,108,105,116,116,108,101, 97, 97,
-/* 0x1560 */ 114, 99,104, 54, 52, 10, 10, 83,101, 99,116,105,111,110,115, 58,
-/* 0x1570 */  10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1580 */  32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65,
-/* 0x1590 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x15a0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x15b0 */  32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32,
-/* 0x15c0 */  32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65,
-/* 0x15d0 */  73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x15e0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x15f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1600 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32,
-/* 0x1610 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1620 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1630 */  10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32,
-/* 0x1640 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1650 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1660 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1670 */  32, 48, 48, 48, 48, 48, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1680 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1690 */  78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x16a0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x16b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16d0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 48, 32, 32, 50, 42,
-/* 0x16e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x16f0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 69,
-/* 0x1700 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50,
-/* 0x1710 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1720 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1730 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 48, 32,
-/* 0x1740 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1750 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82,
-/* 0x1760 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1770 */  48, 49, 49, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1780 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1790 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x17a0 */  55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x17b0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53,
-/* 0x17c0 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x17d0 */  48, 48, 48, 48, 48,102, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x17f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1800 */  48, 48, 50, 57, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1810 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1820 */  32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32,
-/* 0x1830 */  32, 32, 48, 48, 48, 48, 48, 48, 98, 56, 32, 32, 48, 48, 48, 48,
-/* 0x1840 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1850 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1860 */  48, 48, 48, 48, 48, 51, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1870 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1880 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90,
-/* 0x1890 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x18a0 */  48, 57, 54, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18b0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,
-/* 0x18d0 */  51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x18e0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56,
-/* 0x18f0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48,
-/* 0x1900 */  48, 48, 48, 48, 52, 57, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1920 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1930 */  48, 48,100, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1940 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1950 */  32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32,
-/* 0x1960 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1970 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1990 */  48, 48, 48, 48, 49, 50, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x19a0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x19b0 */  76, 89, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32,
-/* 0x19c0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51,101, 32, 32, 48,
-/* 0x19d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x19e0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19f0 */  48, 32, 32, 48, 48, 48, 48, 49, 50, 52, 48, 32, 32, 50, 42, 42,
-/* 0x1a00 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1a10 */  68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1a20 */  78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a40 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 55,101, 32, 32,
-/* 0x1a60 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1a70 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69, 76, 70,
-/* 0x1a80 */  77, 65, 74, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1a90 */  48, 50, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 55,
-/* 0x1ac0 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1ad0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32,
-/* 0x1ae0 */  65, 78, 68, 77, 65, 74, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b00 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1b20 */  49, 50, 97, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1b30 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1b40 */  49, 52, 32, 69, 76, 70, 77, 65, 75, 78, 90, 32, 32, 32, 32, 32,
-/* 0x1b50 */  32, 48, 48, 48, 48, 48, 50, 97, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1b60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1b80 */  48, 48, 48, 49, 50, 97, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1b90 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1ba0 */  89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bc0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1bd0 */  67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1be0 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c00 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1c10 */  90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48,
-/* 0x1c30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1c40 */  32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48,
-/* 0x1c50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69,
-/* 0x1c60 */  76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1c80 */  32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72,
-/* 0x1ca0 */  69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1cc0 */  95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1d10 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1d30 */  82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1d60 */  32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48,
-/* 0x1d70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x1d80 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1da0 */  69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1dc0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1de0 */  68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1e00 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1e20 */  68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x1e40 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65,
-/* 0x1e60 */  73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1e90 */  32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 74, 78, 90,  9,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1eb0 */  32, 69, 76, 70, 77, 65, 74, 78, 90, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1ed0 */ 100, 32, 32, 65, 78, 68, 77, 65, 74, 78, 90,  9, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 65, 78, 68,
-/* 0x1ef0 */  77, 65, 74, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1f10 */  76, 70, 77, 65, 75, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 75, 78,
-/* 0x1f30 */  90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x1f50 */  73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x1f80 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 49, 50, 56, 32,117, 99,108, 95,
-/* 0x1fa0 */ 110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x1fb0 */  95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86,
-/* 0x1fd0 */  50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  49, 49, 99, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
-/* 0x1ff0 */  99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x2010 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 48, 48, 48,102, 48, 32,117, 99,108, 95,
-/* 0x2030 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2040 */  95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2060 */  65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76,122,109, 97, 68,101, 99,
-/* 0x2080 */ 111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x20a0 */  77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,101, 99,111,109,
-/* 0x20c0 */ 112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x20d0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x20e0 */  76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x20f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2100 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2110 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2120 */  48, 48, 99, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65,
-/* 0x2130 */  76, 76, 50, 54, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10,
-/* 0x2140 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2150 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2160 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2170 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x21a0 */  95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79, 78, 68, 66, 82, 49,
-/* 0x21b0 */  57, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10
+/* 0x1540 */   3,139,192,  3, 95,214, 15,  0,  0,  0, 21,  0,  0,  0,  2,  0,
+/* 0x1550 */   0,  0,128,  2,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 16,  0,
+/* 0x1560 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 80,  0,  0,  0,  0,  0,
+/* 0x1570 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 80,  0,  0,  0,  0,  0,
+/* 0x1580 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 80,  0,  0,  0, 40,  1,
+/* 0x1590 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,120,  1,  0,  0, 28,  1,
+/* 0x15a0 */   0,  0,  0,  0,  0,  0, 39,  0,  0,  0,148,  2,  0,  0,240,  0,
+/* 0x15b0 */   0,  0,  0,  0,  0,  0, 45,  0,  0,  0,132,  3,  0,  0,184,  0,
+/* 0x15c0 */   0,  0,  0,  0,  0,  0, 56,  0,  0,  0, 60,  4,  0,  0,104,  9,
+/* 0x15d0 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,164, 13,  0,  0,156,  4,
+/* 0x15e0 */   0,  0,  0,  0,  0,  0, 78,  0,  0,  0, 64, 18,  0,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 64, 18,  0,  0, 62,  0,
+/* 0x1600 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0,126, 18,  0,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  0,  0,107,  0,  0,  0,126, 18,  0,  0, 36,  0,
+/* 0x1620 */   0,  0,  0,  0,  0,  0,116,  0,  0,  0,162, 18,  0,  0,  4,  0,
+/* 0x1630 */   0,  0,  0,  0,  0,  0,125,  0,  0,  0,166, 18,  0,  0,160,  2,
+/* 0x1640 */   0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1690 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x16c0 */   0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x16e0 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x16f0 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  0,  0,107,  0,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  0,  0,116,  0,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1720 */   0,  0,  0,  0,  0,  0,125,  0,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  0,  0,134,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1740 */   0,  0,  0,  0,  0,  0,141,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1750 */   0,  0,  0,  0,  0,  0,165,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  0,  0,189,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1770 */   0,  0,  0,  0,  0,  0,213,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x1780 */   0,  0,  0,  0,  0,  0,224,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,239,  0,
+/* 0x17a0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x17b0 */   0,  0,  4,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78,
+/* 0x17d0 */  82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,
+/* 0x17e0 */   0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86,
+/* 0x17f0 */  50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x1800 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1810 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 69,
+/* 0x1820 */  76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,
+/* 0x1830 */   0, 69, 76, 70, 77, 65, 74, 78, 90,  0, 65, 78, 68, 77, 65, 74,
+/* 0x1840 */  78, 90,  0, 69, 76, 70, 77, 65, 75, 78, 90,  0, 95,115,116, 97,
+/* 0x1850 */ 114,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
+/* 0x1860 */ 111,109,112,114,101,115,115, 95, 51, 50,  0,117, 99,108, 95,110,
+/* 0x1870 */ 114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x1880 */  51, 50,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,
+/* 0x1890 */ 111,109,112,114,101,115,115, 95, 51, 50,  0, 76,122,109, 97, 68,
+/* 0x18a0 */ 101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,109,112,
+/* 0x18b0 */ 114,101,115,115,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67,
+/* 0x18c0 */  65, 76, 76, 50, 54,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95,
+/* 0x18d0 */  67, 79, 78, 68, 66, 82, 49, 57,  0, 70, 21,  0,  0, 85, 80, 88,
+/* 0x18e0 */  76
 };
@@ -1,5 +1,5 @@
 /* armeb.v4a-linux.elf-entry.h
-   created from armeb.v4a-linux.elf-entry.bin, 14509 (0x38ad) bytes
+   created from armeb.v4a-linux.elf-entry.bin, 10254 (0x280e) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_SIZE    14509
-#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_ADLER32 0xd677d80a
-#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_CRC32   0xa093c785
+#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_SIZE    10254
+#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_ADLER32 0x4bf1fb8d
+#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_CRC32   0xf6350ce2
 
-unsigned char stub_armeb_v4a_linux_elf_entry[14509] = {
+unsigned char stub_armeb_v4a_linux_elf_entry[10254] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 40,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 19,148,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -338,609 +338,343 @@ unsigned char stub_armeb_v4a_linux_elf_entry[14509] = {
 /* 0x12b0 */ 229, 30,  0, 16,226, 78, 96, 16,229,141,224, 16,224, 70, 96,  0,
 /* 0x12c0 */ 229,141, 96,  0,225,160,144,  0,226, 79,  0, 72,227,160, 16,  0,
 /* 0x12d0 */ 239,144,  0,  5,227, 80,  0,  0,186,  0,  0, 54,229,141,  0,  4,
-/* 0x12e0 */ 229, 30, 48, 12,235,255,255,254,  0,  0,  0,  0,102,105,108,101,
-/* 0x12f0 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45, 98,105,
-/* 0x1300 */ 103, 97,114,109, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10,
-/* 0x1310 */  73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1320 */  32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32,
-/* 0x1330 */  32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1340 */  70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32,
-/* 0x1350 */  70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1360 */  78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x1370 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1380 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32,
-/* 0x1390 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x13a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x13b0 */  32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32,
-/* 0x13c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x13d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x13e0 */  48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x13f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1400 */  76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32,
-/* 0x1410 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1420 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1430 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x1440 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1450 */  68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1460 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50, 99,
-/* 0x1470 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1480 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32,
-/* 0x1490 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x14a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x14b0 */  32, 32, 52, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32,
-/* 0x14c0 */  32, 32, 48, 48, 48, 48, 48, 49, 49, 56, 32, 32, 48, 48, 48, 48,
-/* 0x14d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x14e0 */  48, 48, 48, 48, 48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x14f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1500 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 82,
-/* 0x1510 */  86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1520 */  48, 48,100, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1530 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x1540 */  56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1550 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1560 */  78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1570 */  48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 97, 56, 32, 32,
-/* 0x1580 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1590 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 54, 48, 32, 32, 50, 42,
-/* 0x15a0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x15b0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x15c0 */  55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x15d0 */  48, 48, 48, 48, 48, 57, 51, 56, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x15e0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x15f0 */  48, 48, 48, 52, 48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1600 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1610 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65,
-/* 0x1620 */  95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 52,
-/* 0x1630 */  55, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1640 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 52, 48,
-/* 0x1650 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1660 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1670 */  89, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1680 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1690 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16a0 */  32, 32, 48, 48, 48, 48, 49, 49, 98, 56, 32, 32, 50, 42, 42, 48,
-/* 0x16b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x16c0 */  79, 78, 76, 89, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x16d0 */  89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x16e0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x16f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 49, 98, 56, 32, 32, 50,
-/* 0x1700 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1710 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77,
-/* 0x1720 */  65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1730 */  51, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1740 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 49, 98, 56,
-/* 0x1750 */  32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1760 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1770 */  89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x1780 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1790 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x17a0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x17b0 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48,
-/* 0x17c0 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x17d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x17e0 */  50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x17f0 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1800 */ 100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48,
-/* 0x1810 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1820 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1830 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x1840 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1850 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1860 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48,
-/* 0x1870 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x1880 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1890 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48,
-/* 0x18a0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x18b0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x18c0 */ 100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48,
-/* 0x18d0 */  48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x18e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x18f0 */  76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1900 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1910 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72,
-/* 0x1920 */  69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x1930 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1940 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9,
-/* 0x1950 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x1960 */  76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1970 */ 100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x19a0 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 70,
-/* 0x19b0 */  76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,103, 32, 32, 32,
-/* 0x19c0 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48,
-/* 0x19d0 */  48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82,
-/* 0x19f0 */  86, 50, 69,  9, 48, 48, 48, 48, 48, 49, 50, 99, 32,117, 99,108,
-/* 0x1a00 */  95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x1a10 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x1a20 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48,
-/* 0x1a30 */  49, 49, 56, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
-/* 0x1a40 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50,
-/* 0x1a60 */  66,  9, 48, 48, 48, 48, 48, 48,100, 99, 32,117, 99,108, 95,110,
-/* 0x1a70 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x1a80 */  56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x1a90 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 48, 32, 76,122,109, 97, 68,101, 99,111,100,
-/* 0x1ab0 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x1ac0 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 32,101,110,100, 95,100,101, 99,111,109,112,114,
-/* 0x1ae0 */ 101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x1af0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x1b00 */  48, 48, 48, 32, 79, 95, 66, 73, 78, 70, 79, 10, 48, 48, 48, 48,
-/* 0x1b10 */  48, 49, 51, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x1b20 */  77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,
-/* 0x1b30 */ 112,114, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1b40 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70,
-/* 0x1b50 */  77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x1b60 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b70 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32,
-/* 0x1b90 */  32, 32, 32, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1bb0 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69,
-/* 0x1bc0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x1bd0 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70,
-/* 0x1be0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x1bf0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x1c00 */  48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1c10 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1c30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1c40 */  10, 48, 48, 48, 48, 48, 48, 54, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1c50 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1c60 */  69, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1c70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1c80 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82,
-/* 0x1c90 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1ca0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65,
-/* 0x1cb0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1cc0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95,
-/* 0x1cd0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ce0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82,
-/* 0x1cf0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d00 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32,
-/* 0x1d10 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1d20 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 99,
-/* 0x1d30 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1d40 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x1d50 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1d60 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1d70 */  98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1d80 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1da0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1db0 */  48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1dc0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1de0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1df0 */  48, 48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1e00 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1e20 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1e40 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1e50 */  10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1e60 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1e70 */  69, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1e80 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1e90 */  50, 69, 10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82,
-/* 0x1ea0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1eb0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 50, 52, 32, 82, 95, 65,
-/* 0x1ec0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1ed0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32, 82, 95,
-/* 0x1ee0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ef0 */  78, 82, 86, 50, 69, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1f00 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x1f10 */  82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x1f20 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f30 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x1f40 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1f50 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 53,
-/* 0x1f60 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1f70 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1f80 */  54, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1f90 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1fd0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2010 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2030 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x2040 */  48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2050 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x2060 */  10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2070 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2080 */  68, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2090 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x20a0 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82,
-/* 0x20b0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x20c0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 56, 32, 82, 95, 65,
-/* 0x20d0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x20e0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95,
-/* 0x20f0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2100 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82,
-/* 0x2110 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2120 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 56, 32,
-/* 0x2130 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 99,
-/* 0x2150 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2160 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 49,
-/* 0x2170 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2180 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2190 */  49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x21a0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 10, 82, 69, 76, 79,
-/* 0x21b0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x21c0 */  79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83,
-/* 0x21d0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21e0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x21f0 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2200 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x2210 */  48, 48, 48, 48, 54, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2220 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x2230 */  48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2240 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2250 */  48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2260 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2270 */  10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2280 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2290 */  66, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77,
-/* 0x22a0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x22b0 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82,
-/* 0x22c0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x22d0 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65,
-/* 0x22e0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x22f0 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95,
-/* 0x2300 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2310 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 52, 32, 82,
-/* 0x2320 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2330 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32,
-/* 0x2340 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2350 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 52,
-/* 0x2360 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2370 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x2380 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2390 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x23a0 */ 100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x23b0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x23c0 */  48,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x23d0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76,
-/* 0x23e0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x23f0 */  70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93,
-/* 0x2400 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2410 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2420 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82,
-/* 0x2430 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2440 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2450 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2460 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48,
-/* 0x2470 */  48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2480 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x2490 */  76, 70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x24a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x24b0 */  77, 65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x24c0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x24d0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x24e0 */  48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x24f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2500 */  48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2510 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2520 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56,
-/* 0x2530 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2540 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2550 */  48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2560 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2570 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65,
-/* 0x2580 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2590 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x25a0 */  48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x25b0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x25c0 */  48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x25d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x25e0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82,
-/* 0x25f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2600 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2610 */  48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2620 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2630 */  48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2640 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2650 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,100, 56,
-/* 0x2660 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2670 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2680 */  48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2690 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x26a0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32, 82, 95, 65,
-/* 0x26b0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x26c0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x26d0 */  50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x26e0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x26f0 */  48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2700 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2710 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82,
-/* 0x2720 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2730 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2740 */  48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2750 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2760 */  48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2770 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2780 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 53, 56,
-/* 0x2790 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x27a0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x27b0 */  48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x27c0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x27d0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65,
-/* 0x27e0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x27f0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x2800 */ 101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2810 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2820 */  48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2830 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2840 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82,
-/* 0x2850 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2860 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2870 */  48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2880 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2890 */  48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77,
-/* 0x28a0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x28b0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 48,
-/* 0x28c0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x28d0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x28e0 */  48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x28f0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2900 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65,
-/* 0x2910 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2920 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x2930 */ 101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2940 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2950 */  48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2960 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2970 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 50, 52, 32, 82,
-/* 0x2980 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2990 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x29a0 */  48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x29b0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x29c0 */  48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82, 95, 65, 82, 77,
-/* 0x29d0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x29e0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 52,
-/* 0x29f0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2a00 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2a10 */  48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2a20 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2a30 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48, 32, 82, 95, 65,
-/* 0x2a40 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2a50 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x2a60 */ 100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2a70 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2a80 */  48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2a90 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2aa0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,102, 52, 32, 82,
-/* 0x2ab0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ac0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2ad0 */  48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2ae0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2af0 */  48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2b00 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2b10 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 57, 56,
-/* 0x2b20 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2b30 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2b40 */  48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2b50 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2b60 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65,
-/* 0x2b70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2b80 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,
-/* 0x2b90 */ 101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ba0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2bb0 */  48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2bc0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2bd0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 48, 52, 32, 82,
-/* 0x2be0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2bf0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2c00 */  48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2c10 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2c20 */  48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2c30 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2c40 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 48,
-/* 0x2c50 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2c60 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2c70 */  48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2c80 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2c90 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48, 32, 82, 95, 65,
-/* 0x2ca0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2cb0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x2cc0 */ 101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2cd0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2ce0 */  48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2cf0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2d00 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 50, 56, 32, 82,
-/* 0x2d10 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d20 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2d30 */  48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2d40 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2d50 */  48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2d60 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2d70 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 57, 99,
-/* 0x2d80 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2d90 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2da0 */  48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2db0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2dc0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52, 32, 82, 95, 65,
-/* 0x2dd0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2de0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x2df0 */ 100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2e00 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2e10 */  48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2e20 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2e30 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 48, 32, 82,
-/* 0x2e40 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2e50 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2e60 */  48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2e70 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2e80 */  48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2e90 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2ea0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 56, 56,
-/* 0x2eb0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2ec0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2ed0 */  48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2ee0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2ef0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56, 32, 82, 95, 65,
-/* 0x2f00 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2f10 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x2f20 */ 102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2f30 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2f40 */  48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2f50 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2f60 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 48, 52, 32, 82,
-/* 0x2f70 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2f80 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2f90 */  48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2fa0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2fb0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2fc0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95,
-/* 0x2fd0 */  68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2fe0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ff0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x3000 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3010 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3020 */  48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3030 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3040 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95,
-/* 0x3050 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3060 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3070 */  48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3080 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3090 */  10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x30a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x30b0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,101, 52, 32,
-/* 0x30c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x30d0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x30e0 */  48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x30f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3100 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82,
-/* 0x3110 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3120 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49,
-/* 0x3130 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3140 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3150 */  48, 48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3160 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3170 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95,
-/* 0x3180 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3190 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x31a0 */  49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x31b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x31c0 */  10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x31d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x31e0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32,
-/* 0x31f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3200 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3210 */  48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3220 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3230 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82,
-/* 0x3240 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3250 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56,
-/* 0x3260 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3270 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3280 */  48, 48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3290 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x32a0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57, 99, 32, 82, 95,
-/* 0x32b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x32c0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x32d0 */  49, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x32e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x32f0 */  10, 48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3300 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3310 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32,
-/* 0x3320 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3330 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3340 */  48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3350 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3360 */  49, 48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32, 82, 95, 65, 82,
-/* 0x3370 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3380 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101,
-/* 0x3390 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x33a0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x33b0 */  48, 48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x33c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x33d0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 56, 32, 82, 95,
-/* 0x33e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x33f0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3400 */  50, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3410 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3420 */  10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3430 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3440 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32,
-/* 0x3450 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3460 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3470 */  48, 48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3480 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3490 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82,
-/* 0x34a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x34b0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56,
-/* 0x34c0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x34d0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x34e0 */  48, 48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x34f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3500 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95,
-/* 0x3510 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3520 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3530 */  50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3540 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3550 */  10, 48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3560 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3570 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 99, 32,
-/* 0x3580 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3590 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x35a0 */  48, 48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x35b0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x35c0 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82,
-/* 0x35d0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x35e0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 49,
-/* 0x35f0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3600 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3610 */  48, 48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3620 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3630 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 48, 32, 82, 95,
-/* 0x3640 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3650 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3660 */  51, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3670 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3680 */  10, 48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3690 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x36a0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 56, 32,
-/* 0x36b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x36c0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x36d0 */  48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x36e0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x36f0 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82,
-/* 0x3700 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3710 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98,
-/* 0x3720 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3730 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3740 */  48, 48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3750 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3760 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95,
-/* 0x3770 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3780 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3790 */  52, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x37a0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x37b0 */  10, 48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x37c0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x37d0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 52, 48, 32,
-/* 0x37e0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x37f0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x3800 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x3810 */  32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58,
-/* 0x3820 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3830 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3840 */  69, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3850 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x3860 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 50, 99, 32, 82,
-/* 0x3870 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3880 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3890 */  51, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32,
-/* 0x38a0 */  32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x12e0 */ 229, 30, 48, 12,235,255,255,254,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x12f0 */  21,  0,  0,  0,192,  0,  0,  0, 32, 20,  0,  0,  0,  0,  0,  0,
+/* 0x1300 */  52,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1310 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1320 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1330 */  64,  0,  0,  0, 44,  1,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1340 */ 108,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1350 */ 132,  2,  0,  0,220,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1360 */  96,  3,  0,  0,168,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1370 */   8,  4,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1380 */  64, 13,  0,  0,120,  4,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x1390 */ 184, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x13a0 */ 184, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x13b0 */ 184, 17,  0,  0, 52,  1,  0,  0,  2,  0,  0,  0, 27,  0,  0,  0,
+/* 0x13c0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x13d0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x13e0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x13f0 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1400 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1410 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x1420 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x1430 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1440 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1450 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1460 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1470 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0,
+/* 0x1480 */  13,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,112,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,119,  0,  0,  0,
+/* 0x14a0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,142,  0,  0,  0,
+/* 0x14b0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,
+/* 0x14c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,188,  0,  0,  0,
+/* 0x14d0 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0,
+/* 0x14e0 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,  0,  0,  0,
+/* 0x14f0 */  13,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,222,  0,  0,  0,
+/* 0x1500 */  11,  0,  0,  0, 52,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1510 */   0,  0,  0,  0,227,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0,
+/* 0x1530 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1540 */  16,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */   0,  0,  0,  0,  3,  0,  0,  0, 92,  0,  0,  0,239,  0,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1570 */  96,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */   0,  0,  0,  0,  3,  0,  0,  0,104,  0,  0,  0,239,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15a0 */ 116,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   0,  0,  0,  0,  3,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15d0 */ 140,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */   0,  0,  0,  0,  3,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1600 */ 156,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  3,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1630 */ 180,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0,  3,  0,  0,  0,184,  0,  0,  0,239,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1660 */ 192,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  3,  0,  0,  0,196,  0,  0,  0,239,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1690 */ 208,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  3,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16c0 */ 220,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  3,  0,  0,  0,232,  0,  0,  0,239,  0,  0,  0,
+/* 0x16e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16f0 */ 236,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  3,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1720 */ 252,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  3,  0,  0,  0, 36,  1,  0,  0,239,  0,  0,  0,
+/* 0x1740 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1750 */  40,  1,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  4,  0,  0,  0, 16,  0,  0,  0,239,  0,  0,  0,
+/* 0x1770 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1780 */  92,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  4,  0,  0,  0, 96,  0,  0,  0,239,  0,  0,  0,
+/* 0x17a0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x17b0 */ 104,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  4,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0,
+/* 0x17d0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x17e0 */ 128,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  4,  0,  0,  0,140,  0,  0,  0,239,  0,  0,  0,
+/* 0x1800 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1810 */ 144,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  4,  0,  0,  0,156,  0,  0,  0,239,  0,  0,  0,
+/* 0x1830 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1840 */ 172,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  4,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0,
+/* 0x1860 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1870 */ 188,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  4,  0,  0,  0,200,  0,  0,  0,239,  0,  0,  0,
+/* 0x1890 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18a0 */ 208,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  4,  0,  0,  0,220,  0,  0,  0,239,  0,  0,  0,
+/* 0x18c0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18d0 */ 232,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  4,  0,  0,  0,236,  0,  0,  0,239,  0,  0,  0,
+/* 0x18f0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1900 */  16,  1,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0,  4,  0,  0,  0, 20,  1,  0,  0,239,  0,  0,  0,
+/* 0x1920 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1930 */  16,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0,  5,  0,  0,  0, 96,  0,  0,  0,239,  0,  0,  0,
+/* 0x1950 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1960 */ 104,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  5,  0,  0,  0,108,  0,  0,  0,239,  0,  0,  0,
+/* 0x1980 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1990 */ 124,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  5,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,
+/* 0x19b0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19c0 */ 132,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  5,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,
+/* 0x19e0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19f0 */ 160,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  5,  0,  0,  0,164,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a10 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a20 */ 172,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0,  5,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a40 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a50 */ 184,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0,  5,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a70 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a80 */ 216,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0,  6,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0,
+/* 0x1aa0 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1ab0 */  76,  0,  0,  0,239,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  6,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,
+/* 0x1ad0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ae0 */ 116,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0,  7,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b00 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b10 */ 184,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0,  7,  0,  0,  0,204,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b30 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b40 */ 244,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0,  7,  0,  0,  0,  0,  1,  0,  0,239,  0,  0,  0,
+/* 0x1b60 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b70 */   8,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0,  7,  0,  0,  0, 68,  1,  0,  0,239,  0,  0,  0,
+/* 0x1b90 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ba0 */ 144,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  7,  0,  0,  0,204,  1,  0,  0,239,  0,  0,  0,
+/* 0x1bc0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1bd0 */ 216,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  2,  0,  0,239,  0,  0,  0,
+/* 0x1bf0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c00 */  24,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0,  7,  0,  0,  0, 32,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c20 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c30 */  52,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0,  7,  0,  0,  0, 60,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c50 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c60 */  64,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0,  7,  0,  0,  0, 76,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c80 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c90 */  88,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  7,  0,  0,  0,164,  2,  0,  0,239,  0,  0,  0,
+/* 0x1cb0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1cc0 */ 200,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  7,  0,  0,  0,232,  2,  0,  0,239,  0,  0,  0,
+/* 0x1ce0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1cf0 */   4,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  7,  0,  0,  0, 12,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d10 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d20 */  60,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,  7,  0,  0,  0,136,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d40 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d50 */ 160,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  7,  0,  0,  0,168,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d70 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d80 */ 204,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,  7,  0,  0,  0,224,  3,  0,  0,239,  0,  0,  0,
+/* 0x1da0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1db0 */ 232,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  7,  0,  0,  0, 36,  4,  0,  0,239,  0,  0,  0,
+/* 0x1dd0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1de0 */  56,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,  7,  0,  0,  0,108,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e00 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e10 */ 132,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  7,  0,  0,  0,140,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e30 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e40 */ 176,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,  7,  0,  0,  0,212,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e60 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e70 */ 236,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,  7,  0,  0,  0,244,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e90 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ea0 */  24,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  7,  0,  0,  0, 60,  5,  0,  0,239,  0,  0,  0,
+/* 0x1ec0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ed0 */ 152,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  7,  0,  0,  0,160,  5,  0,  0,239,  0,  0,  0,
+/* 0x1ef0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f00 */ 192,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  7,  0,  0,  0,228,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f20 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f30 */ 252,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  6,  0,  0,239,  0,  0,  0,
+/* 0x1f50 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f60 */  36,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  7,  0,  0,  0, 72,  6,  0,  0,239,  0,  0,  0,
+/* 0x1f80 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f90 */ 128,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  7,  0,  0,  0,140,  6,  0,  0,239,  0,  0,  0,
+/* 0x1fb0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fc0 */ 208,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  7,  0,  0,  0,236,  6,  0,  0,239,  0,  0,  0,
+/* 0x1fe0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ff0 */  28,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  7,  0,  0,  0, 40,  7,  0,  0,239,  0,  0,  0,
+/* 0x2010 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2020 */ 108,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,  7,  0,  0,  0,124,  7,  0,  0,239,  0,  0,  0,
+/* 0x2040 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2050 */ 156,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  7,  0,  0,  0,184,  7,  0,  0,239,  0,  0,  0,
+/* 0x2070 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2080 */ 196,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  7,  0,  0,  0,208,  7,  0,  0,239,  0,  0,  0,
+/* 0x20a0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20b0 */ 244,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  7,  0,  0,  0, 32,  8,  0,  0,239,  0,  0,  0,
+/* 0x20d0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20e0 */  44,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  7,  0,  0,  0,124,  8,  0,  0,239,  0,  0,  0,
+/* 0x2100 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2110 */ 136,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,  7,  0,  0,  0,160,  8,  0,  0,239,  0,  0,  0,
+/* 0x2130 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2140 */ 232,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  7,  0,  0,  0,244,  8,  0,  0,239,  0,  0,  0,
+/* 0x2160 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2170 */ 252,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  9,  0,  0,239,  0,  0,  0,
+/* 0x2190 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x21a0 */  40,  9,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,  8,  0,  0,  0,120,  0,  0,  0,239,  0,  0,  0,
+/* 0x21c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x21d0 */ 128,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  8,  0,  0,  0,136,  0,  0,  0,239,  0,  0,  0,
+/* 0x21f0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2200 */ 168,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,  8,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0,
+/* 0x2220 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2230 */ 228,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,  8,  0,  0,  0,  0,  1,  0,  0,239,  0,  0,  0,
+/* 0x2250 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2260 */  12,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,  8,  0,  0,  0, 20,  1,  0,  0,239,  0,  0,  0,
+/* 0x2280 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2290 */  24,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,  8,  0,  0,  0, 32,  1,  0,  0,239,  0,  0,  0,
+/* 0x22b0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22c0 */  40,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,  8,  0,  0,  0, 68,  1,  0,  0,239,  0,  0,  0,
+/* 0x22e0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22f0 */  76,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,  8,  0,  0,  0, 80,  1,  0,  0,239,  0,  0,  0,
+/* 0x2310 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2320 */ 128,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,  8,  0,  0,  0,136,  1,  0,  0,239,  0,  0,  0,
+/* 0x2340 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2350 */ 140,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,  8,  0,  0,  0,156,  1,  0,  0,239,  0,  0,  0,
+/* 0x2370 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2380 */ 160,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0,  8,  0,  0,  0,192,  1,  0,  0,239,  0,  0,  0,
+/* 0x23a0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23b0 */ 204,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,  8,  0,  0,  0,212,  1,  0,  0,239,  0,  0,  0,
+/* 0x23d0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23e0 */ 220,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,  8,  0,  0,  0,228,  1,  0,  0,239,  0,  0,  0,
+/* 0x2400 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2410 */ 236,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,  8,  0,  0,  0, 40,  2,  0,  0,239,  0,  0,  0,
+/* 0x2430 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2440 */  44,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,  8,  0,  0,  0, 68,  2,  0,  0,239,  0,  0,  0,
+/* 0x2460 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2470 */  76,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,  8,  0,  0,  0, 80,  2,  0,  0,239,  0,  0,  0,
+/* 0x2490 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24a0 */ 104,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,  8,  0,  0,  0,132,  2,  0,  0,239,  0,  0,  0,
+/* 0x24c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24d0 */ 140,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,  8,  0,  0,  0,164,  2,  0,  0,239,  0,  0,  0,
+/* 0x24f0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2500 */ 200,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0,  8,  0,  0,  0,208,  2,  0,  0,239,  0,  0,  0,
+/* 0x2520 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2530 */ 220,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0,  8,  0,  0,  0,244,  2,  0,  0,239,  0,  0,  0,
+/* 0x2550 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2560 */  12,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,  8,  0,  0,  0, 20,  3,  0,  0,239,  0,  0,  0,
+/* 0x2580 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2590 */  44,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,  8,  0,  0,  0, 80,  3,  0,  0,239,  0,  0,  0,
+/* 0x25b0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25c0 */  88,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,  8,  0,  0,  0,112,  3,  0,  0,239,  0,  0,  0,
+/* 0x25e0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25f0 */ 120,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,  8,  0,  0,  0,156,  3,  0,  0,239,  0,  0,  0,
+/* 0x2610 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2620 */ 176,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  8,  0,  0,  0,184,  3,  0,  0,239,  0,  0,  0,
+/* 0x2640 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2650 */ 200,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  8,  0,  0,  0,204,  3,  0,  0,239,  0,  0,  0,
+/* 0x2670 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2680 */   0,  4,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  8,  0,  0,  0, 24,  4,  0,  0,239,  0,  0,  0,
+/* 0x26a0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x26b0 */  64,  4,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0, 11,  0,  0,  0, 32,  1,  0,  0,239,  0,  0,  0,
+/* 0x26d0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x26e0 */  44,  1,  0,  0,239,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0, 11,  0,  0,  0, 48,  1,  0,  0,227,  0,  0,  0,
+/* 0x2700 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77,
+/* 0x2710 */  65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82,
+/* 0x2720 */  86, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86,
+/* 0x2730 */  50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76,
+/* 0x2740 */  70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76,
+/* 0x2750 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x2760 */  69, 67, 51, 48,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76,
+/* 0x2770 */  70, 77, 65, 73, 78, 90,  0, 77, 70, 76, 71,  0, 95,115,116, 97,
+/* 0x2780 */ 114,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
+/* 0x2790 */ 111,109,112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,
+/* 0x27a0 */ 118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
+/* 0x27b0 */   0,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
+/* 0x27c0 */ 112,114,101,115,115, 95, 56,  0, 76,122,109, 97, 68,101, 99,111,
+/* 0x27d0 */ 100,101,  0,101,110,100, 95,100,101, 99,111,109,112,114,101,115,
+/* 0x27e0 */ 115,  0, 79, 95, 66, 73, 78, 70, 79,  0, 99,112,114, 48,  0, 82,
+/* 0x27f0 */  95, 65, 82, 77, 95, 65, 66, 83, 51, 50,  0, 82, 95, 65, 82, 77,
+/* 0x2800 */  95, 80, 67, 50, 52,  0,236, 18,  0,  0, 85, 80, 88, 76
 };
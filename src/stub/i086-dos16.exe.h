@@ -1,5 +1,5 @@
 /* i086-dos16.exe.h
-   created from i086-dos16.exe.bin, 30372 (0x76a4) bytes
+   created from i086-dos16.exe.bin, 17086 (0x42be) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I086_DOS16_EXE_SIZE    30372
-#define STUB_I086_DOS16_EXE_ADLER32 0x1dcf0534
-#define STUB_I086_DOS16_EXE_CRC32   0x1debace7
+#define STUB_I086_DOS16_EXE_SIZE    17086
+#define STUB_I086_DOS16_EXE_ADLER32 0x937bbba1
+#define STUB_I086_DOS16_EXE_CRC32   0xbab7ec1e
 
-unsigned char stub_i086_dos16_exe[30372] = {
+unsigned char stub_i086_dos16_exe[17086] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  12, 44,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -672,1267 +672,436 @@ unsigned char stub_i086_dos16_exe[30372] = {
 /* 0x2790 */  17,129,199,254,  0,114,  8,226, 22,  7,  6, 31,157,114, 16,  7,
 /* 0x27a0 */  31, 93, 95, 94, 91, 88,142,208,137,220, 90, 89, 91, 88,203,141,
 /* 0x27b0 */ 134,  0,  0,142,208,188,  0,  0,234,  0,  0,  0,  0,129,197,  0,
-/* 0x27c0 */   0, 85,184,  0,  0, 80,203,102,105,108,101, 32,102,111,114,109,
-/* 0x27d0 */  97,116, 32,101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,
-/* 0x27e0 */ 101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,
-/* 0x27f0 */ 101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32,
-/* 0x2800 */  32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2810 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,
-/* 0x2820 */ 102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32,
-/* 0x2830 */  32, 48, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89, 32, 32,
-/* 0x2840 */  32, 48, 48, 48, 48, 48, 48, 50,100, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2850 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2860 */  48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2870 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2880 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 76, 90, 77,
-/* 0x2890 */  65, 68, 69, 86, 73, 67, 69, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x28a0 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x28b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54,
-/* 0x28c0 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x28d0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x28e0 */  76, 89, 10, 32, 32, 50, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84,
-/* 0x28f0 */  82, 89, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x2900 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2910 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 54, 54, 32, 32, 50, 42, 42,
-/* 0x2920 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2930 */  68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 76, 90, 77, 65, 69, 78,
-/* 0x2940 */  84, 82, 89, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 49,
-/* 0x2950 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2960 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54, 57, 32, 32,
-/* 0x2970 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2980 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2990 */  32, 32, 52, 32, 78, 82, 86, 50, 66, 49, 54, 48, 32, 32, 32, 32,
-/* 0x29a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48,
-/* 0x29b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x29c0 */  48, 48, 48, 48, 48, 48, 55, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x29d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x29e0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 82,
-/* 0x29f0 */  86, 68, 68, 79, 78, 69, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2a00 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2a10 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2a20 */  56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2a30 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2a40 */  78, 76, 89, 10, 32, 32, 54, 32, 78, 82, 86, 68, 82, 69, 84, 85,
-/* 0x2a50 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x2a60 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2a70 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 54, 32, 32, 50, 42,
-/* 0x2a80 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2a90 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x2aa0 */  55, 32, 78, 82, 86, 68, 69, 67, 79, 49, 32, 32, 32, 32, 32, 32,
-/* 0x2ab0 */  48, 48, 48, 48, 48, 48, 49,101, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2ac0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2ad0 */  48, 48, 48, 48, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2ae0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2af0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 78, 82, 86, 76,
-/* 0x2b00 */  69, 68, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2b10 */  48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2b20 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 97, 54,
-/* 0x2b30 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2b40 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78,
-/* 0x2b50 */  82, 86, 71, 84, 68, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2b60 */  48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2b70 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2b80 */  48, 97, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2b90 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x2ba0 */  48, 32, 78, 82, 86, 68, 69, 67, 79, 50, 32, 32, 32, 32, 32, 32,
-/* 0x2bb0 */  48, 48, 48, 48, 48, 48, 49, 55, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2bc0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2bd0 */  48, 48, 48, 48, 97,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2be0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2bf0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 67, 65, 76, 76,
-/* 0x2c00 */  84, 82, 49, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2c10 */  48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2c20 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 99, 53,
-/* 0x2c30 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2c40 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2c50 */  89, 10, 32, 49, 50, 32, 67, 84, 49, 54, 73, 50, 56, 54, 32, 32,
-/* 0x2c60 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x2c70 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c80 */  32, 32, 48, 48, 48, 48, 48, 48,100, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2c90 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2ca0 */  79, 78, 76, 89, 10, 32, 49, 51, 32, 67, 84, 49, 54, 83, 85, 66,
-/* 0x2cb0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x2cc0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2cd0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100, 51, 32, 32, 50,
-/* 0x2ce0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2cf0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 52, 32, 67, 84, 49, 54,
-/* 0x2d00 */  73, 48, 56, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2d10 */  48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2d20 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100, 53,
-/* 0x2d30 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2d40 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53, 32, 67,
-/* 0x2d50 */  65, 76, 76, 84, 82, 73, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2d60 */  48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d70 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d80 */  48,100,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2d90 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2da0 */  79, 78, 76, 89, 10, 32, 49, 54, 32, 67, 84, 49, 54, 69, 56, 48,
-/* 0x2db0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x2dc0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2dd0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101, 48, 32, 32, 50,
-/* 0x2de0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2df0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 55, 32, 67, 84, 49, 54,
-/* 0x2e00 */  69, 57, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2e10 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2e20 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101, 50,
-/* 0x2e30 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2e40 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 56, 32, 67,
-/* 0x2e50 */  65, 76, 76, 84, 82, 73, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2e60 */  48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2e70 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e80 */  48,101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2e90 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2ea0 */  79, 78, 76, 89, 10, 32, 49, 57, 32, 67, 84, 49, 54, 74, 69, 78,
-/* 0x2eb0 */  68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x2ec0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2ed0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101, 97, 32, 32, 50,
-/* 0x2ee0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2ef0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2f00 */  50, 48, 32, 67, 84, 49, 54, 74, 85, 76, 50, 32, 32, 32, 32, 32,
-/* 0x2f10 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f20 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f30 */  48, 48, 48, 48, 48,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2f40 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2f50 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 49, 32, 67, 84, 49,
-/* 0x2f60 */  54, 73, 50, 56, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f70 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f80 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101,
-/* 0x2f90 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2fa0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 50, 32,
-/* 0x2fb0 */  67, 84, 49, 54, 83, 85, 66, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2fc0 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fd0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2fe0 */  48, 48,102, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2ff0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3000 */  50, 51, 32, 67, 84, 49, 54, 73, 48, 56, 55, 32, 32, 32, 32, 32,
-/* 0x3010 */  32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3020 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3030 */  48, 48, 48, 48, 48,102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3040 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3050 */  89, 10, 32, 50, 52, 32, 67, 65, 76, 76, 84, 82, 73, 54, 32, 32,
-/* 0x3060 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x3070 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3080 */  32, 32, 48, 48, 48, 48, 48, 48,102, 98, 32, 32, 50, 42, 42, 48,
-/* 0x3090 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x30a0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 53, 32,
-/* 0x30b0 */  69, 88, 69, 69, 78, 84, 82, 89, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x30c0 */  48, 48, 48, 48, 49, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x30e0 */  48, 48,102,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x30f0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3100 */  68, 79, 78, 76, 89, 10, 32, 50, 54, 32, 76, 79, 78, 71, 83, 85,
-/* 0x3110 */  66, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x3120 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3130 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 49, 97, 32, 32,
-/* 0x3140 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3150 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3160 */  32, 50, 55, 32, 83, 72, 79, 82, 84, 83, 85, 66, 32, 32, 32, 32,
-/* 0x3170 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x3180 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3190 */  48, 48, 48, 48, 48, 49, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x31a0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x31b0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 56, 32, 74, 78,
-/* 0x31c0 */  67, 68, 79, 67, 79, 80, 89, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x31d0 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x31e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x31f0 */  50, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3200 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3210 */  78, 76, 89, 10, 32, 50, 57, 32, 69, 88, 69, 82, 69, 76, 80, 85,
-/* 0x3220 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32,
-/* 0x3230 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3240 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 97, 32, 32, 50, 42,
-/* 0x3250 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3260 */  65, 68, 79, 78, 76, 89, 10, 32, 51, 48, 32, 69, 88, 69, 77, 65,
-/* 0x3270 */  73, 78, 52, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3280 */  57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3290 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 98, 32,
-/* 0x32a0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x32b0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x32c0 */  10, 32, 51, 49, 32, 69, 88, 69, 77, 65, 73, 78, 52, 66, 32, 32,
-/* 0x32d0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48,
-/* 0x32e0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x32f0 */  32, 48, 48, 48, 48, 48, 49, 51, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3300 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x3310 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 50, 32, 69,
-/* 0x3320 */  88, 69, 77, 65, 73, 78, 52, 67, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x3330 */  48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3340 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3350 */  49, 51, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3360 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x3370 */  51, 32, 67, 79, 77, 80, 82, 69, 83, 83, 69, 68, 95, 76, 90, 77,
-/* 0x3380 */  65, 95, 83, 84, 65, 82, 84, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3390 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x33a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 57, 32, 32,
-/* 0x33b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x33c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32, 85, 80, 88,
-/* 0x33d0 */  49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x33e0 */  48, 49, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x33f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51,
-/* 0x3400 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3410 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 53, 32,
-/* 0x3420 */  69, 88, 69, 67, 85, 84, 80, 79, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3430 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3440 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3450 */  48, 49, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3460 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3470 */  51, 54, 32, 78, 82, 86, 50, 66, 49, 54, 83, 32, 32, 32, 32, 32,
-/* 0x3480 */  32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3490 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x34a0 */  48, 48, 48, 48, 49, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x34b0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x34c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 55, 32, 78, 50, 66,
-/* 0x34d0 */  54, 52, 75, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x34e0 */  48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x34f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 54,
-/* 0x3500 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3510 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 56, 32,
-/* 0x3520 */  78, 82, 86, 50, 66, 69, 88, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3530 */  48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3540 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3550 */  48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3560 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3570 */  68, 79, 78, 76, 89, 10, 32, 51, 57, 32, 78, 50, 66, 88, 56, 54,
-/* 0x3580 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x3590 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x35a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 55, 32, 32,
-/* 0x35b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x35c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 48, 32, 78, 50, 66,
-/* 0x35d0 */  50, 56, 54, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x35e0 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x35f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55,
-/* 0x3600 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3610 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49, 32,
-/* 0x3620 */  78, 82, 86, 50, 66, 69, 88, 50, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3630 */  48, 48, 48, 48, 51, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3640 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3650 */  48, 49, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3660 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3670 */  68, 79, 78, 76, 89, 10, 32, 52, 50, 32, 78, 50, 66, 88, 56, 54,
-/* 0x3680 */  48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x3690 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x36a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 98, 51, 32, 32,
-/* 0x36b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x36c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 51, 32, 78, 50, 66,
-/* 0x36d0 */  50, 56, 54, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x36e0 */  48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x36f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 99,
-/* 0x3700 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3710 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 52, 32,
-/* 0x3720 */  78, 82, 86, 50, 66, 69, 88, 51, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3730 */  48, 48, 48, 48, 49, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3740 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3750 */  48, 49, 99, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3760 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3770 */  68, 79, 78, 76, 89, 10, 32, 52, 53, 32, 78, 50, 66, 54, 52, 75,
-/* 0x3780 */  48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98,
-/* 0x3790 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x37a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,100, 99, 32, 32,
-/* 0x37b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x37c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 78, 82, 86,
-/* 0x37d0 */  50, 66, 69, 88, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x37e0 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x37f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,101,
-/* 0x3800 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3810 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 55, 32,
-/* 0x3820 */  78, 82, 86, 50, 68, 49, 54, 83, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3830 */  48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3840 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3850 */  48, 49,101, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3860 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3870 */  68, 79, 78, 76, 89, 10, 32, 52, 56, 32, 78, 50, 68, 54, 52, 75,
-/* 0x3880 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98,
-/* 0x3890 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x38a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102, 56, 32, 32,
-/* 0x38b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x38c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 57, 32, 78, 82, 86,
-/* 0x38d0 */  50, 68, 69, 88, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x38e0 */  48, 49, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x38f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 48,
-/* 0x3900 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3910 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3920 */  76, 89, 10, 32, 53, 48, 32, 78, 50, 68, 88, 56, 54, 48, 49, 32,
-/* 0x3930 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x3940 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3950 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 54, 32, 32, 50, 42, 42,
-/* 0x3960 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3970 */  68, 79, 78, 76, 89, 10, 32, 53, 49, 32, 78, 50, 68, 50, 56, 54,
-/* 0x3980 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x3990 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x39a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 99, 32, 32,
-/* 0x39b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x39c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 50, 32, 78, 82, 86,
-/* 0x39d0 */  50, 68, 69, 88, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x39e0 */  48, 51, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x39f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49,
-/* 0x3a00 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3a10 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3a20 */  76, 89, 10, 32, 53, 51, 32, 78, 50, 68, 88, 56, 54, 48, 50, 32,
-/* 0x3a30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48,
-/* 0x3a40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a50 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 56, 32, 32, 50, 42, 42,
-/* 0x3a60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3a70 */  68, 79, 78, 76, 89, 10, 32, 53, 52, 32, 78, 50, 68, 50, 56, 54,
-/* 0x3a80 */  48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x3a90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3aa0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 54, 54, 32, 32,
-/* 0x3ab0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3ac0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 53, 32, 78, 82, 86,
-/* 0x3ad0 */  50, 68, 69, 88, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3ae0 */  48, 49, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3af0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 54,
-/* 0x3b00 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3b10 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3b20 */  76, 89, 10, 32, 53, 54, 32, 78, 50, 68, 54, 52, 75, 48, 50, 32,
-/* 0x3b30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48,
-/* 0x3b40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b50 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 56, 49, 32, 32, 50, 42, 42,
-/* 0x3b60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3b70 */  68, 79, 78, 76, 89, 10, 32, 53, 55, 32, 78, 82, 86, 50, 68, 69,
-/* 0x3b80 */  88, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x3b90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ba0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 56, 99, 32, 32,
-/* 0x3bb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3bc0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 56, 32, 78, 82, 86,
-/* 0x3bd0 */  50, 69, 49, 54, 83, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3be0 */  48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3bf0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 57,
-/* 0x3c00 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3c10 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3c20 */  76, 89, 10, 32, 53, 57, 32, 78, 50, 69, 54, 52, 75, 48, 49, 32,
-/* 0x3c30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48,
-/* 0x3c40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c50 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 57,100, 32, 32, 50, 42, 42,
-/* 0x3c60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3c70 */  68, 79, 78, 76, 89, 10, 32, 54, 48, 32, 78, 82, 86, 50, 69, 69,
-/* 0x3c80 */  88, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 51,
-/* 0x3c90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ca0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 97, 56, 32, 32,
-/* 0x3cb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3cc0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3cd0 */  32, 54, 49, 32, 78, 50, 69, 88, 56, 54, 48, 49, 32, 32, 32, 32,
-/* 0x3ce0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x3cf0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3d00 */  48, 48, 48, 48, 48, 50, 98, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3d10 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3d20 */  76, 89, 10, 32, 54, 50, 32, 78, 50, 69, 50, 56, 54, 48, 49, 32,
-/* 0x3d30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x3d40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d50 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 99, 49, 32, 32, 50, 42, 42,
-/* 0x3d60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3d70 */  68, 79, 78, 76, 89, 10, 32, 54, 51, 32, 78, 82, 86, 50, 69, 69,
-/* 0x3d80 */  88, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51,101,
-/* 0x3d90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3da0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 99, 52, 32, 32,
-/* 0x3db0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3dc0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3dd0 */  32, 54, 52, 32, 78, 50, 69, 88, 56, 54, 48, 50, 32, 32, 32, 32,
-/* 0x3de0 */  32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48,
-/* 0x3df0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3e00 */  48, 48, 48, 48, 48, 51, 48, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3e10 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3e20 */  76, 89, 10, 32, 54, 53, 32, 78, 50, 69, 50, 56, 54, 48, 50, 32,
-/* 0x3e30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x3e40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e50 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 48, 32, 32, 50, 42, 42,
-/* 0x3e60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3e70 */  68, 79, 78, 76, 89, 10, 32, 54, 54, 32, 78, 82, 86, 50, 69, 69,
-/* 0x3e80 */  88, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 53,
-/* 0x3e90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ea0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 54, 32, 32,
-/* 0x3eb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3ec0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3ed0 */  32, 54, 55, 32, 78, 50, 69, 54, 52, 75, 48, 50, 32, 32, 32, 32,
-/* 0x3ee0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48,
-/* 0x3ef0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3f00 */  48, 48, 48, 48, 48, 51, 50, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3f10 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3f20 */  76, 89, 10, 32, 54, 56, 32, 78, 82, 86, 50, 69, 69, 88, 57, 32,
-/* 0x3f30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x3f40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 51, 54, 32, 32, 50, 42, 42,
-/* 0x3f60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3f70 */  68, 79, 78, 76, 89, 10, 32, 54, 57, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3f80 */  69, 67, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51, 50,
-/* 0x3f90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3fa0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 51, 97, 32, 32,
-/* 0x3fb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3fc0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3fd0 */  32, 55, 48, 32,105,103,110,111,114,101, 95,114,101,108,111, 99,
-/* 0x3fe0 */  95,111,118,101,114,102,108,111,119, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3ff0 */  48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4000 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 54, 99,
-/* 0x4010 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4020 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4030 */  89, 10, 32, 55, 49, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x4040 */  32, 32, 32, 32, 48, 48, 48, 48, 49, 49, 57, 98, 32, 32, 48, 48,
-/* 0x4050 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4060 */  32, 32, 48, 48, 48, 48, 48, 51, 55, 52, 32, 32, 50, 42, 42, 48,
-/* 0x4070 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x4080 */  79, 78, 76, 89, 10, 32, 55, 50, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x4090 */  67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 49, 50, 50,102, 32,
-/* 0x40a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x40b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 53, 48,102, 32, 32, 50,
-/* 0x40c0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x40d0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 51, 32, 76, 90, 77, 65,
-/* 0x40e0 */  95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x40f0 */  48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4100 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 50, 55, 51,101,
-/* 0x4110 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4120 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 52, 32, 76,
-/* 0x4130 */  90, 77, 65, 95, 68, 69, 67, 51, 49, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4140 */  48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4150 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 50,
-/* 0x4160 */  55, 51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4170 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x4180 */  79, 78, 76, 89, 10, 32, 55, 53, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x4190 */  67, 51, 50, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x41a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x41b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 50, 55, 52, 98, 32, 32, 50,
-/* 0x41c0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x41d0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x41e0 */  55, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 51, 32, 32, 32,
-/* 0x41f0 */  32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4200 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4210 */  48, 48, 48, 50, 55, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4220 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x4230 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 55, 32, 69, 88, 69,
-/* 0x4240 */  77, 65, 73, 78, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4250 */  48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4260 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 50, 55, 53,
-/* 0x4270 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4280 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 56, 32,
-/* 0x4290 */  69, 88, 69, 65, 68, 74, 85, 83, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x42a0 */  48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x42c0 */  50, 55, 53, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x42d0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x42e0 */  55, 57, 32, 69, 88, 69, 78, 79, 65, 68, 74, 32, 32, 32, 32, 32,
-/* 0x42f0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4300 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4310 */  48, 48, 48, 50, 55, 53,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4320 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4330 */  89, 10, 32, 56, 48, 32, 69, 88, 69, 82, 69, 76, 79, 49, 32, 32,
-/* 0x4340 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,101, 32, 32, 48, 48,
-/* 0x4350 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4360 */  32, 32, 48, 48, 48, 48, 50, 55, 54, 49, 32, 32, 50, 42, 42, 48,
-/* 0x4370 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x4380 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 49, 32,
-/* 0x4390 */  69, 88, 69, 82, 69, 76, 57, 65, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x43a0 */  48, 48, 48, 48, 49, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x43c0 */  50, 55, 55,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x43d0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x43e0 */  68, 79, 78, 76, 89, 10, 32, 56, 50, 32, 69, 88, 69, 82, 69, 76,
-/* 0x43f0 */  79, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x4400 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4410 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 50, 55, 57, 49, 32, 32,
-/* 0x4420 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4430 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 51, 32, 69, 88, 69,
-/* 0x4440 */  82, 69, 66, 73, 71, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4450 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4460 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 50, 55, 57,
-/* 0x4470 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4480 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4490 */  76, 89, 10, 32, 56, 52, 32, 69, 88, 69, 82, 69, 76, 79, 51, 32,
-/* 0x44a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x44b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44c0 */  48, 32, 32, 48, 48, 48, 48, 50, 55, 57, 55, 32, 32, 50, 42, 42,
-/* 0x44d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x44e0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 53,
-/* 0x44f0 */  32, 69, 88, 69, 77, 65, 73, 78, 56, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4500 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4510 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4520 */  48, 50, 55, 57, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4530 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4540 */  32, 56, 54, 32, 68, 69, 86, 73, 67, 69, 69, 78, 68, 32, 32, 32,
-/* 0x4550 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 51, 32, 32, 48, 48, 48, 48,
-/* 0x4560 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4570 */  48, 48, 48, 48, 50, 55, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4580 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4590 */  76, 89, 10, 32, 56, 55, 32, 69, 88, 69, 83, 84, 65, 67, 75, 32,
-/* 0x45a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x45b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x45c0 */  48, 32, 32, 48, 48, 48, 48, 50, 55, 97,102, 32, 32, 50, 42, 42,
-/* 0x45d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x45e0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 56,
-/* 0x45f0 */  32, 69, 88, 69, 83, 84, 65, 83, 80, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4600 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4610 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4620 */  48, 50, 55, 98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4630 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x4640 */  65, 68, 79, 78, 76, 89, 10, 32, 56, 57, 32, 69, 88, 69, 74, 85,
-/* 0x4650 */  77, 80, 70, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4660 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4670 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 50, 55, 98, 56, 32,
-/* 0x4680 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4690 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x46a0 */  10, 32, 57, 48, 32, 69, 88, 69, 82, 67, 83, 80, 79, 32, 32, 32,
-/* 0x46b0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x46c0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x46d0 */  32, 48, 48, 48, 48, 50, 55, 98,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x46e0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x46f0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 49, 32, 69,
-/* 0x4700 */  88, 69, 82, 69, 84, 73, 80, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4710 */  48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4720 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 50,
-/* 0x4730 */  55, 99, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4740 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x4750 */  79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76,
-/* 0x4760 */  69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4770 */  32,100, 32, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89,  9,
-/* 0x4780 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 68, 69, 86, 73, 67, 69, 69,
-/* 0x4790 */  78, 84, 82, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x47a0 */  32, 32, 32,100, 32, 32, 67, 79, 77, 80, 82, 69, 83, 83, 69, 68,
-/* 0x47b0 */  95, 76, 90, 77, 65, 95, 83, 84, 65, 82, 84,  9, 48, 48, 48, 48,
-/* 0x47c0 */  48, 48, 48, 48, 32, 67, 79, 77, 80, 82, 69, 83, 83, 69, 68, 95,
-/* 0x47d0 */  76, 90, 77, 65, 95, 83, 84, 65, 82, 84, 10, 48, 48, 48, 48, 48,
-/* 0x47e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x47f0 */  66, 49, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x4800 */  86, 50, 66, 49, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4810 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 68, 69, 67, 79, 50,
-/* 0x4820 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 68, 69, 67,
-/* 0x4830 */  79, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4840 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 54,  9, 48, 48, 48,
-/* 0x4850 */  48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 54, 10, 48,
-/* 0x4860 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4870 */  67, 65, 76, 76, 84, 82, 73, 53,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4880 */  48, 32, 67, 65, 76, 76, 84, 82, 73, 53, 10, 48, 48, 48, 48, 48,
-/* 0x4890 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x48a0 */  84, 82, 73, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65,
-/* 0x48b0 */  76, 76, 84, 82, 73, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x48c0 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 69, 78, 84, 82, 89,
-/* 0x48d0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 88, 69, 69, 78, 84,
-/* 0x48e0 */  82, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x48f0 */  32,100, 32, 32, 78, 82, 86, 50, 66, 49, 54, 83,  9, 48, 48, 48,
-/* 0x4900 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 49, 54, 83, 10, 48,
-/* 0x4910 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4920 */  78, 82, 86, 50, 66, 69, 88, 50,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4930 */  48, 32, 78, 82, 86, 50, 66, 69, 88, 50, 10, 48, 48, 48, 48, 48,
-/* 0x4940 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x4950 */  66, 69, 88, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x4960 */  86, 50, 66, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4970 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 69, 88, 57,
-/* 0x4980 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 69,
-/* 0x4990 */  88, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x49a0 */  32,100, 32, 32, 78, 82, 86, 50, 68, 49, 54, 83,  9, 48, 48, 48,
-/* 0x49b0 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 49, 54, 83, 10, 48,
-/* 0x49c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x49d0 */  78, 82, 86, 50, 68, 69, 88, 50,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x49e0 */  48, 32, 78, 82, 86, 50, 68, 69, 88, 50, 10, 48, 48, 48, 48, 48,
-/* 0x49f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x4a00 */  68, 69, 88, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x4a10 */  86, 50, 68, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a20 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 69, 88, 57,
-/* 0x4a30 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 69,
-/* 0x4a40 */  88, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4a50 */  32,100, 32, 32, 78, 82, 86, 50, 69, 49, 54, 83,  9, 48, 48, 48,
-/* 0x4a60 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 49, 54, 83, 10, 48,
-/* 0x4a70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4a80 */  78, 82, 86, 50, 69, 69, 88, 50,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a90 */  48, 32, 78, 82, 86, 50, 69, 69, 88, 50, 10, 48, 48, 48, 48, 48,
-/* 0x4aa0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x4ab0 */  69, 69, 88, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x4ac0 */  86, 50, 69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ad0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 69, 88, 57,
-/* 0x4ae0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 69,
-/* 0x4af0 */  88, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4b00 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  9, 48,
-/* 0x4b10 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x4b20 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4b30 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 50,  9, 48,
-/* 0x4b40 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x4b50 */  51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4b60 */  32,100, 32, 32, 69, 88, 69, 82, 69, 76, 79, 49,  9, 48, 48, 48,
-/* 0x4b70 */  48, 48, 48, 48, 48, 32, 69, 88, 69, 82, 69, 76, 79, 49, 10, 48,
-/* 0x4b80 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4b90 */  69, 88, 69, 82, 69, 76, 79, 50,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ba0 */  48, 32, 69, 88, 69, 82, 69, 76, 79, 50, 10, 48, 48, 48, 48, 48,
-/* 0x4bb0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x4bc0 */  68, 69, 86, 73, 67, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4bd0 */  76, 90, 77, 65, 68, 69, 86, 73, 67, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4be0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 68, 69, 86, 73,
-/* 0x4bf0 */  67, 69, 69, 78, 84, 82, 89, 50,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c00 */  48, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89, 50, 10, 48,
-/* 0x4c10 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4c20 */  76, 90, 77, 65, 69, 78, 84, 82, 89,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4c30 */  48, 48, 32, 76, 90, 77, 65, 69, 78, 84, 82, 89, 10, 48, 48, 48,
-/* 0x4c40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x4c50 */  86, 68, 68, 79, 78, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4c60 */  78, 82, 86, 68, 68, 79, 78, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 68, 82, 69,
-/* 0x4c80 */  84, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 68,
-/* 0x4c90 */  82, 69, 84, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4ca0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 68, 69, 67, 79, 49,  9, 48,
-/* 0x4cb0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 68, 69, 67, 79, 49,
-/* 0x4cc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4cd0 */  32, 32, 78, 82, 86, 76, 69, 68, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4ce0 */  48, 48, 48, 32, 78, 82, 86, 76, 69, 68, 48, 48, 10, 48, 48, 48,
-/* 0x4cf0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x4d00 */  86, 71, 84, 68, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4d10 */  78, 82, 86, 71, 84, 68, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d20 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 49, 54, 73, 50,
-/* 0x4d30 */  56, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 49, 54,
-/* 0x4d40 */  73, 50, 56, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4d50 */  32, 32, 32,100, 32, 32, 67, 84, 49, 54, 83, 85, 66, 48,  9, 48,
-/* 0x4d60 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 49, 54, 83, 85, 66, 48,
-/* 0x4d70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4d80 */  32, 32, 67, 84, 49, 54, 73, 48, 56, 54,  9, 48, 48, 48, 48, 48,
-/* 0x4d90 */  48, 48, 48, 32, 67, 84, 49, 54, 73, 48, 56, 54, 10, 48, 48, 48,
-/* 0x4da0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x4db0 */  76, 76, 84, 82, 73, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4dc0 */  67, 65, 76, 76, 84, 82, 73, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4dd0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 49, 54, 69, 56,
-/* 0x4de0 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 49, 54,
-/* 0x4df0 */  69, 56, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4e00 */  32, 32, 32,100, 32, 32, 67, 84, 49, 54, 69, 57, 48, 48,  9, 48,
-/* 0x4e10 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 49, 54, 69, 57, 48, 48,
-/* 0x4e20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4e30 */  32, 32, 67, 84, 49, 54, 74, 69, 78, 68,  9, 48, 48, 48, 48, 48,
-/* 0x4e40 */  48, 48, 48, 32, 67, 84, 49, 54, 74, 69, 78, 68, 10, 48, 48, 48,
-/* 0x4e50 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x4e60 */  49, 54, 74, 85, 76, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4e70 */  67, 84, 49, 54, 74, 85, 76, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 49, 54, 73, 50,
-/* 0x4e90 */  56, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 49, 54,
-/* 0x4ea0 */  73, 50, 56, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4eb0 */  32, 32, 32,100, 32, 32, 67, 84, 49, 54, 83, 85, 66, 49,  9, 48,
-/* 0x4ec0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 49, 54, 83, 85, 66, 49,
-/* 0x4ed0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4ee0 */  32, 32, 67, 84, 49, 54, 73, 48, 56, 55,  9, 48, 48, 48, 48, 48,
-/* 0x4ef0 */  48, 48, 48, 32, 67, 84, 49, 54, 73, 48, 56, 55, 10, 48, 48, 48,
-/* 0x4f00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 79,
-/* 0x4f10 */  78, 71, 83, 85, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x4f20 */  79, 78, 71, 83, 85, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4f30 */ 108, 32, 32, 32, 32,100, 32, 32, 83, 72, 79, 82, 84, 83, 85, 66,
-/* 0x4f40 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 83, 72, 79, 82, 84, 83,
-/* 0x4f50 */  85, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4f60 */  32,100, 32, 32, 74, 78, 67, 68, 79, 67, 79, 80, 89,  9, 48, 48,
-/* 0x4f70 */  48, 48, 48, 48, 48, 48, 32, 74, 78, 67, 68, 79, 67, 79, 80, 89,
-/* 0x4f80 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4f90 */  32, 32, 69, 88, 69, 82, 69, 76, 80, 85,  9, 48, 48, 48, 48, 48,
-/* 0x4fa0 */  48, 48, 48, 32, 69, 88, 69, 82, 69, 76, 80, 85, 10, 48, 48, 48,
-/* 0x4fb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88,
-/* 0x4fc0 */  69, 77, 65, 73, 78, 52,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4fd0 */  69, 88, 69, 77, 65, 73, 78, 52, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4fe0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 77, 65, 73,
-/* 0x4ff0 */  78, 52, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 88, 69,
-/* 0x5000 */  77, 65, 73, 78, 52, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5010 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 77, 65, 73, 78, 52,
-/* 0x5020 */  67,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 88, 69, 77, 65,
-/* 0x5030 */  73, 78, 52, 67, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5040 */  32, 32, 32,100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68,  9, 48,
-/* 0x5050 */  48, 48, 48, 48, 48, 48, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68,
-/* 0x5060 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5070 */  32, 32, 69, 88, 69, 67, 85, 84, 80, 79,  9, 48, 48, 48, 48, 48,
-/* 0x5080 */  48, 48, 48, 32, 69, 88, 69, 67, 85, 84, 80, 79, 10, 48, 48, 48,
-/* 0x5090 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x50a0 */  66, 54, 52, 75, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x50b0 */  78, 50, 66, 54, 52, 75, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 69,
-/* 0x50d0 */  88, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x50e0 */  66, 69, 88, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x50f0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 88, 56, 54, 48, 49,  9, 48,
-/* 0x5100 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 88, 56, 54, 48, 49,
-/* 0x5110 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5120 */  32, 32, 78, 50, 66, 50, 56, 54, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x5130 */  48, 48, 48, 32, 78, 50, 66, 50, 56, 54, 48, 49, 10, 48, 48, 48,
-/* 0x5140 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5150 */  66, 88, 56, 54, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5160 */  78, 50, 66, 88, 56, 54, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5170 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 50, 56, 54,
-/* 0x5180 */  48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 50,
-/* 0x5190 */  56, 54, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x51a0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 54, 52, 75, 48, 50,  9, 48,
-/* 0x51b0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 54, 52, 75, 48, 50,
-/* 0x51c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x51d0 */  32, 32, 78, 50, 68, 54, 52, 75, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x51e0 */  48, 48, 48, 32, 78, 50, 68, 54, 52, 75, 48, 49, 10, 48, 48, 48,
-/* 0x51f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x5200 */  86, 50, 68, 69, 88, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5210 */  78, 82, 86, 50, 68, 69, 88, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5220 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 88, 56, 54,
-/* 0x5230 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 88,
-/* 0x5240 */  56, 54, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5250 */  32, 32, 32,100, 32, 32, 78, 50, 68, 50, 56, 54, 48, 49,  9, 48,
-/* 0x5260 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 50, 56, 54, 48, 49,
-/* 0x5270 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5280 */  32, 32, 78, 50, 68, 88, 56, 54, 48, 50,  9, 48, 48, 48, 48, 48,
-/* 0x5290 */  48, 48, 48, 32, 78, 50, 68, 88, 56, 54, 48, 50, 10, 48, 48, 48,
-/* 0x52a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x52b0 */  68, 50, 56, 54, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x52c0 */  78, 50, 68, 50, 56, 54, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 54, 52, 75,
-/* 0x52e0 */  48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 54,
-/* 0x52f0 */  52, 75, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5300 */  32, 32, 32,100, 32, 32, 78, 50, 69, 54, 52, 75, 48, 49,  9, 48,
-/* 0x5310 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 54, 52, 75, 48, 49,
-/* 0x5320 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5330 */  32, 32, 78, 82, 86, 50, 69, 69, 88, 49,  9, 48, 48, 48, 48, 48,
-/* 0x5340 */  48, 48, 48, 32, 78, 82, 86, 50, 69, 69, 88, 49, 10, 48, 48, 48,
-/* 0x5350 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5360 */  69, 88, 56, 54, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5370 */  78, 50, 69, 88, 56, 54, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5380 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 50, 56, 54,
-/* 0x5390 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 50,
-/* 0x53a0 */  56, 54, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x53b0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 88, 56, 54, 48, 50,  9, 48,
-/* 0x53c0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 88, 56, 54, 48, 50,
-/* 0x53d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x53e0 */  32, 32, 78, 50, 69, 50, 56, 54, 48, 50,  9, 48, 48, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 32, 78, 50, 69, 50, 56, 54, 48, 50, 10, 48, 48, 48,
-/* 0x5400 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5410 */  69, 54, 52, 75, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5420 */  78, 50, 69, 54, 52, 75, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5430 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,105,103,110,111,114,101,
-/* 0x5440 */  95,114,101,108,111, 99, 95,111,118,101,114,102,108,111,119,  9,
-/* 0x5450 */  48, 48, 48, 48, 48, 48, 48, 48, 32,105,103,110,111,114,101, 95,
-/* 0x5460 */ 114,101,108,111, 99, 95,111,118,101,114,102,108,111,119, 10, 48,
-/* 0x5470 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5480 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5490 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x54a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x54b0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x54c0 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x54d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x54e0 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x54f0 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48,
-/* 0x5500 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5510 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 49,  9, 48, 48, 48, 48, 48,
-/* 0x5520 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 49, 10, 48,
-/* 0x5530 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5540 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 51,  9, 48, 48, 48, 48, 48,
-/* 0x5550 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 51, 10, 48,
-/* 0x5560 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5570 */  69, 88, 69, 77, 65, 73, 78, 53,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5580 */  48, 32, 69, 88, 69, 77, 65, 73, 78, 53, 10, 48, 48, 48, 48, 48,
-/* 0x5590 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 65,
-/* 0x55a0 */  68, 74, 85, 83,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 88,
-/* 0x55b0 */  69, 65, 68, 74, 85, 83, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x55c0 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 78, 79, 65, 68, 74,
-/* 0x55d0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 88, 69, 78, 79, 65,
-/* 0x55e0 */  68, 74, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x55f0 */  32,100, 32, 32, 69, 88, 69, 82, 69, 76, 57, 65,  9, 48, 48, 48,
-/* 0x5600 */  48, 48, 48, 48, 48, 32, 69, 88, 69, 82, 69, 76, 57, 65, 10, 48,
-/* 0x5610 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5620 */  69, 88, 69, 82, 69, 66, 73, 71,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5630 */  48, 32, 69, 88, 69, 82, 69, 66, 73, 71, 10, 48, 48, 48, 48, 48,
-/* 0x5640 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 82,
-/* 0x5650 */  69, 76, 79, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 88,
-/* 0x5660 */  69, 82, 69, 76, 79, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5670 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 77, 65, 73, 78, 56,
-/* 0x5680 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 88, 69, 77, 65, 73,
-/* 0x5690 */  78, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x56a0 */  32,100, 32, 32, 68, 69, 86, 73, 67, 69, 69, 78, 68,  9, 48, 48,
-/* 0x56b0 */  48, 48, 48, 48, 48, 48, 32, 68, 69, 86, 73, 67, 69, 69, 78, 68,
-/* 0x56c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x56d0 */  32, 32, 69, 88, 69, 83, 84, 65, 67, 75,  9, 48, 48, 48, 48, 48,
-/* 0x56e0 */  48, 48, 48, 32, 69, 88, 69, 83, 84, 65, 67, 75, 10, 48, 48, 48,
-/* 0x56f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88,
-/* 0x5700 */  69, 83, 84, 65, 83, 80,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5710 */  69, 88, 69, 83, 84, 65, 83, 80, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5720 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 74, 85, 77,
-/* 0x5730 */  80, 70,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 88, 69, 74,
-/* 0x5740 */  85, 77, 80, 70, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5750 */  32, 32, 32,100, 32, 32, 69, 88, 69, 82, 67, 83, 80, 79,  9, 48,
-/* 0x5760 */  48, 48, 48, 48, 48, 48, 48, 32, 69, 88, 69, 82, 67, 83, 80, 79,
-/* 0x5770 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5780 */  32, 32, 69, 88, 69, 82, 69, 84, 73, 80,  9, 48, 48, 48, 48, 48,
-/* 0x5790 */  48, 48, 48, 32, 69, 88, 69, 82, 69, 84, 73, 80, 10, 48, 48, 48,
-/* 0x57a0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x57b0 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 97,116,116,
-/* 0x57c0 */ 114,105, 98,117,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x57d0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x57e0 */  48, 48, 48, 48, 48, 48, 32,105,110,116,101,114,114,117,112,116,
-/* 0x57f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5800 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5810 */  32,111,114,105,103, 95,115,116,114, 97,116,101,103,121, 10, 48,
-/* 0x5820 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5830 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,
-/* 0x5840 */ 120,101, 95,115,116, 97, 99,107, 95,115,115, 10, 48, 48, 48, 48,
-/* 0x5850 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x5860 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,120,101, 95,
-/* 0x5870 */ 115,116, 97, 99,107, 95,115,112, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5880 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x5890 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99, 97,108,108,116,114,105,
-/* 0x58a0 */  99,107, 95, 99, 97,108,108,115, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x58b0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x58c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,119,111,114,100,115, 95,116,
-/* 0x58d0 */ 111, 95, 99,111,112,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x58e0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x58f0 */  48, 48, 48, 48, 48, 48, 32, 99,111,112,121, 95,111,102,102,115,
-/* 0x5900 */ 101,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x5910 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5920 */  48, 48, 32,115,111,117,114, 99,101, 95,115,101,103,109,101,110,
-/* 0x5930 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x5940 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5950 */  48, 32,100,101,115,116,105,110, 97,116,105,111,110, 95,115,101,
-/* 0x5960 */ 103,109,101,110,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5970 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x5980 */  48, 48, 48, 48, 48, 32,100,101, 99,111,109,112,114,101,115,115,
-/* 0x5990 */ 111,114, 95,101,110,116,114,121, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59a0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x59b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 98,120, 95,109, 97,103,105,
-/* 0x59c0 */  99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x59d0 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59e0 */  48, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,
-/* 0x59f0 */ 117,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x5a00 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x5a10 */  48, 48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 95,104,
-/* 0x5a20 */ 105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x5a30 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5a40 */  48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48,
-/* 0x5a50 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x5a60 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109,
-/* 0x5a70 */  97, 95, 99, 95,108,101,110, 95,104,105, 10, 48, 48, 48, 48, 48,
-/* 0x5a80 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x5a90 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,
-/* 0x5aa0 */  99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5ab0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x5ac0 */  48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,114,111,112,101,
-/* 0x5ad0 */ 114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5ae0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x5af0 */  48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,114,111,112,101,
-/* 0x5b00 */ 114,116,105,101,115, 95,104,105, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5b10 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x5b20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,108,101, 97,114, 95,100,
-/* 0x5b30 */ 105,114,116,121, 95,115,116, 97, 99,107, 95,108,111,119, 10, 48,
-/* 0x5b40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b50 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5b60 */ 122,109, 97, 95,117, 95,108,101,110, 95,115,101,103,109,101,110,
-/* 0x5b70 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x5b80 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5b90 */  48, 32,114,101,108,111, 99, 95,115,105,122,101, 10, 48, 48, 48,
-/* 0x5ba0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x5bb0 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,111,114,105,
-/* 0x5bc0 */ 103,105,110, 97,108, 95,115,115, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5bd0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x5be0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,111,114,105,103,105,110, 97,
-/* 0x5bf0 */ 108, 95,115,112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x5c00 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x5c10 */  48, 48, 48, 48, 32,111,114,105,103,105,110, 97,108, 95,105,112,
-/* 0x5c20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c30 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5c40 */  32,111,114,105,103,105,110, 97,108, 95, 99,115, 10, 10, 82, 69,
-/* 0x5c50 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5c60 */  32, 70, 79, 82, 32, 91, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82,
-/* 0x5c70 */  89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5c80 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5c90 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x5ca0 */  51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5cb0 */  97,116,116,114,105, 98,117,116,101, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5cc0 */  48, 54, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x5cd0 */  32, 32, 32, 32, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89,
-/* 0x5ce0 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5cf0 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,105,110,116,101,
-/* 0x5d00 */ 114,114,117,112,116, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82,
-/* 0x5d10 */  95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d20 */  32,111,114,105,103, 95,115,116,114, 97,116,101,103,121, 10, 48,
-/* 0x5d30 */  48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 49, 54,
-/* 0x5d40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 68, 69, 86, 73, 67, 69,
-/* 0x5d50 */  69, 78, 84, 82, 89, 10, 48, 48, 48, 48, 48, 48, 49, 57, 32, 82,
-/* 0x5d60 */  95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d70 */  32,101,120,101, 95,115,116, 97, 99,107, 95,115,115, 10, 48, 48,
-/* 0x5d80 */  48, 48, 48, 48, 49, 99, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32,
-/* 0x5d90 */  32, 32, 32, 32, 32, 32, 32, 32, 32,101,120,101, 95,115,116, 97,
-/* 0x5da0 */  99,107, 95,115,112, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5db0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x5dc0 */  90, 77, 65, 68, 69, 86, 73, 67, 69, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5dd0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5de0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5df0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32,
-/* 0x5e00 */  32, 32, 32, 32, 32, 32, 32, 32,101,120,101, 95,115,116, 97, 99,
-/* 0x5e10 */ 107, 95,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5e20 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x5e30 */  77, 65, 69, 78, 84, 82, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5e40 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e50 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5e60 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32,
-/* 0x5e70 */  32, 32, 32, 32, 32, 32, 67, 79, 77, 80, 82, 69, 83, 83, 69, 68,
-/* 0x5e80 */  95, 76, 90, 77, 65, 95, 83, 84, 65, 82, 84, 10, 10, 82, 69, 76,
-/* 0x5e90 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5ea0 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 49, 54, 48, 93, 58, 10,
-/* 0x5eb0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5ec0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5ed0 */  10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5ee0 */  80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 68,
-/* 0x5ef0 */  69, 67, 79, 50, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x5f00 */  51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f10 */  78, 82, 86, 68, 69, 67, 79, 50, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5f20 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5f30 */  32, 91, 78, 82, 86, 68, 68, 79, 78, 69, 93, 58, 10, 79, 70, 70,
-/* 0x5f40 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5f50 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5f60 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 68, 69, 67, 79,
-/* 0x5f80 */  50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5f90 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 68, 82,
-/* 0x5fa0 */  69, 84, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5fb0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fc0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x5fd0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fe0 */  32, 32, 78, 82, 86, 68, 69, 67, 79, 50, 10, 10, 82, 69, 76, 79,
-/* 0x5ff0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6000 */  79, 82, 32, 91, 78, 82, 86, 68, 69, 67, 79, 49, 93, 58, 10, 79,
-/* 0x6010 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6020 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6030 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6040 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x6050 */  49, 54, 48, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51,
-/* 0x6060 */  56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6070 */  82, 86, 68, 69, 67, 79, 50, 10, 48, 48, 48, 48, 48, 48, 49, 56,
-/* 0x6080 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x6090 */  32, 32, 32, 78, 82, 86, 68, 69, 67, 79, 50, 10, 10, 82, 69, 76,
-/* 0x60a0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x60b0 */  70, 79, 82, 32, 91, 78, 82, 86, 68, 69, 67, 79, 50, 93, 58, 10,
-/* 0x60c0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x60d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x60e0 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x60f0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x6100 */  66, 49, 54, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6110 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x6120 */  76, 76, 84, 82, 49, 54, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6130 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6140 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6150 */  48, 50, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x6160 */  32, 32, 32, 32, 32, 99, 97,108,108,116,114,105, 99,107, 95, 99,
-/* 0x6170 */  97,108,108,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6180 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x6190 */  76, 76, 84, 82, 73, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x61a0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x61b0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x61c0 */  48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x61d0 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 54, 10, 10, 82,
-/* 0x61e0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x61f0 */  83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 73, 53, 93,
-/* 0x6200 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6210 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6220 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56,
-/* 0x6230 */  54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97,
-/* 0x6240 */ 108,108,116,114,105, 99,107, 95, 99, 97,108,108,115, 10, 10, 82,
-/* 0x6250 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6260 */  83, 32, 70, 79, 82, 32, 91, 67, 84, 49, 54, 74, 69, 78, 68, 93,
-/* 0x6270 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6280 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6290 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x62a0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x62b0 */  86, 68, 69, 67, 79, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x62c0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x62d0 */  67, 84, 49, 54, 74, 85, 76, 50, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x62e0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62f0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6300 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6310 */  32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 73, 54, 10,
-/* 0x6320 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6330 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 73,
-/* 0x6340 */  54, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6350 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6360 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95,
-/* 0x6370 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6380 */  67, 65, 76, 76, 84, 82, 73, 53, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6390 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x63a0 */  32, 91, 69, 88, 69, 69, 78, 84, 82, 89, 93, 58, 10, 79, 70, 70,
-/* 0x63b0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x63c0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x63d0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32,
-/* 0x63e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,119,111,114,100,115, 95,116,
-/* 0x63f0 */ 111, 95, 99,111,112,121, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x6400 */  82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6410 */  32, 32, 99,111,112,121, 95,111,102,102,115,101,116, 10, 48, 48,
-/* 0x6420 */  48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32,
-/* 0x6430 */  32, 32, 32, 32, 32, 32, 32, 32, 32,115,111,117,114, 99,101, 95,
-/* 0x6440 */ 115,101,103,109,101,110,116, 10, 48, 48, 48, 48, 48, 48, 49, 52,
-/* 0x6450 */  32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6460 */  32, 32, 32,100,101,115,116,105,110, 97,116,105,111,110, 95,115,
-/* 0x6470 */ 101,103,109,101,110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6480 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6490 */  76, 79, 78, 71, 83, 85, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x64a0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64b0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x64c0 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32,
-/* 0x64d0 */  32, 32, 32, 32, 32, 32, 69, 88, 69, 69, 78, 84, 82, 89, 10, 10,
-/* 0x64e0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x64f0 */  68, 83, 32, 70, 79, 82, 32, 91, 83, 72, 79, 82, 84, 83, 85, 66,
-/* 0x6500 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6520 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x6530 */  56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x6540 */  88, 69, 69, 78, 84, 82, 89, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6550 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6560 */  91, 74, 78, 67, 68, 79, 67, 79, 80, 89, 93, 58, 10, 79, 70, 70,
-/* 0x6570 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6590 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x65a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 69, 69, 78, 84, 82,
-/* 0x65b0 */  89, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x65c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88, 69, 77, 65,
-/* 0x65d0 */  73, 78, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x65e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32,
-/* 0x6600 */  82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6610 */  32, 32,100,101, 99,111,109,112,114,101,115,115,111,114, 95,101,
-/* 0x6620 */ 110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6630 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88,
-/* 0x6640 */  69, 77, 65, 73, 78, 52, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6650 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6660 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6670 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32,
-/* 0x6680 */  32, 32, 32, 32, 32, 32, 98,120, 95,109, 97,103,105, 99, 10, 10,
-/* 0x6690 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x66a0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 49, 54, 83,
-/* 0x66b0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x66c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x66d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51,
-/* 0x66e0 */  56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x66f0 */  82, 86, 50, 66, 69, 88, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6700 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6710 */  91, 78, 82, 86, 50, 66, 69, 88, 49, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6720 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6730 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6740 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54,
-/* 0x6750 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 69, 88, 51,
-/* 0x6760 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6770 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x6780 */  66, 69, 88, 57, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95,
-/* 0x6790 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x67a0 */  78, 82, 86, 50, 66, 69, 88, 50, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x67b0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x67c0 */  32, 91, 78, 82, 86, 50, 66, 69, 88, 50, 93, 58, 10, 79, 70, 70,
-/* 0x67d0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x67e0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x67f0 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49,
-/* 0x6800 */  54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 69, 88,
-/* 0x6810 */  51, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54,
-/* 0x6820 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x6830 */  50, 66, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82,
-/* 0x6840 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6850 */  32, 78, 82, 86, 50, 66, 49, 54, 83, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6860 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6870 */  82, 32, 91, 78, 82, 86, 50, 66, 69, 88, 51, 93, 58, 10, 79, 70,
-/* 0x6880 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6890 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x68a0 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x68b0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 69,
-/* 0x68c0 */  88, 50, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56,
-/* 0x68d0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x68e0 */  86, 50, 66, 69, 88, 57, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x68f0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6900 */  78, 82, 86, 50, 68, 49, 54, 83, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6910 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6920 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6930 */  48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32,
-/* 0x6940 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 51, 10,
-/* 0x6950 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6960 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 69, 88,
-/* 0x6970 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6980 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6990 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x69a0 */  51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x69b0 */  78, 82, 86, 50, 68, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x69c0 */  55, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x69d0 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 51, 10, 48, 48, 48,
-/* 0x69e0 */  48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x69f0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 57,
-/* 0x6a00 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6a10 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x6a20 */  68, 69, 88, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6a30 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x6a40 */  86, 50, 68, 69, 88, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6a50 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a60 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6a70 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x6a80 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 51, 10, 48, 48,
-/* 0x6a90 */  48, 48, 48, 48, 49, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49,
-/* 0x6aa0 */  54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88,
-/* 0x6ab0 */  51, 10, 48, 48, 48, 48, 48, 48, 49, 98, 32, 82, 95, 51, 56, 54,
-/* 0x6ac0 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x6ad0 */  50, 68, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 51, 56, 32, 82,
-/* 0x6ae0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6af0 */  32, 78, 82, 86, 50, 68, 49, 54, 83, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6b00 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6b10 */  82, 32, 91, 78, 82, 86, 50, 68, 69, 88, 51, 93, 58, 10, 79, 70,
-/* 0x6b20 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6b30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6b40 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6b50 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69,
-/* 0x6b60 */  88, 50, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56,
-/* 0x6b70 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x6b80 */  86, 50, 68, 69, 88, 57, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6b90 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6ba0 */  78, 82, 86, 50, 69, 49, 54, 83, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6bb0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6bc0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6bd0 */  48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32,
-/* 0x6be0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88, 51, 10,
-/* 0x6bf0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6c00 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 69, 88,
-/* 0x6c10 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6c20 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6c30 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x6c40 */  51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c50 */  78, 82, 86, 50, 69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6c60 */  55, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x6c70 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88, 51, 10, 48, 48, 48,
-/* 0x6c80 */  48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6c90 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88, 57,
-/* 0x6ca0 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6cb0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x6cc0 */  69, 69, 88, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6cd0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x6ce0 */  86, 50, 69, 69, 88, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6cf0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d00 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6d10 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x6d20 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88, 51, 10, 48, 48,
-/* 0x6d30 */  48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49,
-/* 0x6d40 */  54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88,
-/* 0x6d50 */  51, 10, 48, 48, 48, 48, 48, 48, 49, 98, 32, 82, 95, 51, 56, 54,
-/* 0x6d60 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x6d70 */  50, 69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 50, 48, 32, 82,
-/* 0x6d80 */  95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d90 */  32, 78, 82, 86, 50, 69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6da0 */  51,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6db0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 49, 54, 83, 10, 10, 82,
-/* 0x6dc0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6dd0 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 69, 88, 51, 93,
-/* 0x6de0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6df0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6e00 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56,
-/* 0x6e10 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x6e20 */  86, 50, 69, 69, 88, 50, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x6e30 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e40 */  32, 32, 78, 82, 86, 50, 69, 69, 88, 57, 10, 10, 82, 69, 76, 79,
-/* 0x6e50 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6e60 */  79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58,
-/* 0x6e70 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6e80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6e90 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x6ea0 */  95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x6eb0 */  97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48,
-/* 0x6ec0 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 49, 54,
-/* 0x6ed0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117,
-/* 0x6ee0 */  95,108,101,110, 95,104,105, 10, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x6ef0 */  32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f00 */  32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x6f10 */  48, 48, 48, 48, 49, 97, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32,
-/* 0x6f20 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,
-/* 0x6f30 */ 108,101,110, 95,104,105, 10, 48, 48, 48, 48, 48, 48, 49,101, 32,
-/* 0x6f40 */  82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f50 */  32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48,
-/* 0x6f60 */  48, 48, 48, 50, 99, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32,
-/* 0x6f70 */  32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,
-/* 0x6f80 */ 112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 51, 49,
-/* 0x6f90 */  32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6fa0 */  32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
-/* 0x6fb0 */ 101,115, 95,104,105, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6fc0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,105,
-/* 0x6fd0 */ 103,110,111,114,101, 95,114,101,108,111, 99, 95,111,118,101,114,
-/* 0x6fe0 */ 102,108,111,119, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6ff0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7000 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7010 */  32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7020 */  32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x7030 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32,
-/* 0x7040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x7050 */  67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x7060 */  56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x7070 */ 122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7080 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7090 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10,
-/* 0x70a0 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 56,
-/* 0x70b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x70c0 */ 112,114,111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48,
-/* 0x70d0 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32,
-/* 0x70e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,
-/* 0x70f0 */  10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7100 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97,
-/* 0x7110 */  95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32,
-/* 0x7120 */  82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7130 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 50, 10, 10, 82, 69,
-/* 0x7140 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7150 */  32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 51, 49,
-/* 0x7160 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7180 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x7190 */  56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x71a0 */ 108,101, 97,114, 95,100,105,114,116,121, 95,115,116, 97, 99,107,
-/* 0x71b0 */  95,108,111,119, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x71c0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x71d0 */  77, 65, 95, 68, 69, 67, 51, 50, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x71e0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x71f0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7200 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32,
-/* 0x7210 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,
-/* 0x7220 */ 110, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7230 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95,
-/* 0x7240 */  68, 69, 67, 51, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7250 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7260 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7270 */  51, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x7280 */  32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 95,115,
-/* 0x7290 */ 101,103,109,101,110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x72a0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x72b0 */  69, 88, 69, 82, 69, 76, 79, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x72c0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72d0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x72e0 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32,
-/* 0x72f0 */  32, 32, 32, 32, 32, 32, 32,114,101,108,111, 99, 95,115,105,122,
-/* 0x7300 */ 101, 10, 48, 48, 48, 48, 48, 48, 49, 97, 32, 82, 95, 51, 56, 54,
-/* 0x7310 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 69,
-/* 0x7320 */  82, 69, 76, 79, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7330 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x7340 */  88, 69, 82, 69, 76, 57, 65, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7350 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7360 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7370 */  48, 49, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7380 */  32, 32, 32, 32, 32, 32, 69, 88, 69, 82, 69, 76, 79, 49, 10, 10,
-/* 0x7390 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x73a0 */  68, 83, 32, 70, 79, 82, 32, 91, 69, 88, 69, 82, 69, 66, 73, 71,
-/* 0x73b0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x73c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x73d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x73e0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x73f0 */  88, 69, 82, 69, 76, 79, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x7400 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x7410 */  91, 69, 88, 69, 82, 69, 76, 79, 51, 93, 58, 10, 79, 70, 70, 83,
-/* 0x7420 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7430 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x7440 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x7450 */  32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 69, 82, 69, 76, 79, 49,
-/* 0x7460 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x7470 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88, 69, 83, 84, 65,
-/* 0x7480 */  67, 75, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7490 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74a0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x74b0 */  95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74c0 */  32,111,114,105,103,105,110, 97,108, 95,115,115, 10, 10, 82, 69,
-/* 0x74d0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x74e0 */  32, 70, 79, 82, 32, 91, 69, 88, 69, 83, 84, 65, 83, 80, 93, 58,
-/* 0x74f0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7500 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7510 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x7520 */  95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,
-/* 0x7530 */ 103,105,110, 97,108, 95,115,112, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7540 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7550 */  32, 91, 69, 88, 69, 74, 85, 77, 80, 70, 93, 58, 10, 79, 70, 70,
-/* 0x7560 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7570 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7580 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32,
-/* 0x7590 */  32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,
-/* 0x75a0 */ 108, 95,105,112, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x75b0 */  51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x75c0 */ 111,114,105,103,105,110, 97,108, 95, 99,115, 10, 10, 82, 69, 76,
-/* 0x75d0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x75e0 */  70, 79, 82, 32, 91, 69, 88, 69, 82, 67, 83, 80, 79, 93, 58, 10,
-/* 0x75f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7600 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7610 */  10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7620 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,
-/* 0x7630 */ 105,110, 97,108, 95, 99,115, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x7640 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x7650 */  91, 69, 88, 69, 82, 69, 84, 73, 80, 93, 58, 10, 79, 70, 70, 83,
-/* 0x7660 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7670 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x7680 */  48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32,
-/* 0x7690 */  32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108,
-/* 0x76a0 */  95,105,112, 10
+/* 0x27c0 */   0, 85,184,  0,  0, 80,203, 92,  0,  0,  0,118,  0,  0,  0, 93,
+/* 0x27d0 */   0,  0,  0,232, 21,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 45,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 97,  0,  0,  0,  5,
+/* 0x27f0 */   0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,102,  0,  0,  0,  3,
+/* 0x2800 */   0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,105,  0,  0,  0, 17,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,122,  0,  0,  0, 10,
+/* 0x2820 */   0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0,132,  0,  0,  0,  2,
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,134,  0,  0,  0,  2,
+/* 0x2840 */   0,  0,  0,  0,  0,  0,  0, 73,  0,  0,  0,136,  0,  0,  0, 30,
+/* 0x2850 */   0,  0,  0,  0,  0,  0,  0, 82,  0,  0,  0,166,  0,  0,  0,  1,
+/* 0x2860 */   0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,167,  0,  0,  0,  7,
+/* 0x2870 */   0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0,174,  0,  0,  0, 23,
+/* 0x2880 */   0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,197,  0,  0,  0, 11,
+/* 0x2890 */   0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0,208,  0,  0,  0,  3,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0,  0,127,  0,  0,  0,211,  0,  0,  0,  2,
+/* 0x28b0 */   0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0,213,  0,  0,  0,  8,
+/* 0x28c0 */   0,  0,  0,  0,  0,  0,  0,145,  0,  0,  0,221,  0,  0,  0,  3,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0,  0,154,  0,  0,  0,224,  0,  0,  0,  2,
+/* 0x28e0 */   0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0,226,  0,  0,  0,  2,
+/* 0x28f0 */   0,  0,  0,  0,  0,  0,  0,172,  0,  0,  0,228,  0,  0,  0,  6,
+/* 0x2900 */   0,  0,  0,  0,  0,  0,  0,181,  0,  0,  0,234,  0,  0,  0,  2,
+/* 0x2910 */   0,  0,  0,  0,  0,  0,  0,190,  0,  0,  0,236,  0,  0,  0,  2,
+/* 0x2920 */   0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0,238,  0,  0,  0,  3,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,208,  0,  0,  0,241,  0,  0,  0,  2,
+/* 0x2940 */   0,  0,  0,  0,  0,  0,  0,217,  0,  0,  0,243,  0,  0,  0,  8,
+/* 0x2950 */   0,  0,  0,  0,  0,  0,  0,226,  0,  0,  0,251,  0,  0,  0,  3,
+/* 0x2960 */   0,  0,  0,  0,  0,  0,  0,235,  0,  0,  0,254,  0,  0,  0, 28,
+/* 0x2970 */   0,  0,  0,  0,  0,  0,  0,244,  0,  0,  0, 26,  1,  0,  0,  6,
+/* 0x2980 */   0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 32,  1,  0,  0,  5,
+/* 0x2990 */   0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 37,  1,  0,  0,  5,
+/* 0x29a0 */   0,  0,  0,  0,  0,  0,  0, 15,  1,  0,  0, 42,  1,  0,  0,  1,
+/* 0x29b0 */   0,  0,  0,  0,  0,  0,  0, 24,  1,  0,  0, 43,  1,  0,  0,  9,
+/* 0x29c0 */   0,  0,  0,  0,  0,  0,  0, 33,  1,  0,  0, 52,  1,  0,  0,  3,
+/* 0x29d0 */   0,  0,  0,  0,  0,  0,  0, 43,  1,  0,  0, 55,  1,  0,  0,  2,
+/* 0x29e0 */   0,  0,  0,  0,  0,  0,  0, 53,  1,  0,  0, 57,  1,  0,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0,  0,  0,  0, 75,  1,  0,  0, 57,  1,  0,  0, 27,
+/* 0x2a00 */   0,  0,  0,  0,  0,  0,  0, 84,  1,  0,  0, 84,  1,  0,  0,  0,
+/* 0x2a10 */   0,  0,  0,  0,  0,  0,  0, 93,  1,  0,  0, 84,  1,  0,  0, 13,
+/* 0x2a20 */   0,  0,  0,  0,  0,  0,  0,102,  1,  0,  0, 97,  1,  0,  0, 11,
+/* 0x2a30 */   0,  0,  0,  0,  0,  0,  0,111,  1,  0,  0,108,  1,  0,  0, 11,
+/* 0x2a40 */   0,  0,  0,  0,  0,  0,  0,120,  1,  0,  0,119,  1,  0,  0,  8,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0,  0,129,  1,  0,  0,127,  1,  0,  0,  3,
+/* 0x2a60 */   0,  0,  0,  0,  0,  0,  0,138,  1,  0,  0,130,  1,  0,  0, 49,
+/* 0x2a70 */   0,  0,  0,  0,  0,  0,  0,147,  1,  0,  0,179,  1,  0,  0, 14,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0,  0,156,  1,  0,  0,193,  1,  0,  0,  6,
+/* 0x2a90 */   0,  0,  0,  0,  0,  0,  0,165,  1,  0,  0,199,  1,  0,  0, 21,
+/* 0x2aa0 */   0,  0,  0,  0,  0,  0,  0,174,  1,  0,  0,220,  1,  0,  0, 11,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0,  0,183,  1,  0,  0,231,  1,  0,  0,  4,
+/* 0x2ac0 */   0,  0,  0,  0,  0,  0,  0,192,  1,  0,  0,235,  1,  0,  0, 13,
+/* 0x2ad0 */   0,  0,  0,  0,  0,  0,  0,201,  1,  0,  0,248,  1,  0,  0, 11,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0,  0,210,  1,  0,  0,  3,  2,  0,  0, 19,
+/* 0x2af0 */   0,  0,  0,  0,  0,  0,  0,219,  1,  0,  0, 22,  2,  0,  0,  6,
+/* 0x2b00 */   0,  0,  0,  0,  0,  0,  0,228,  1,  0,  0, 28,  2,  0,  0,  3,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0,  0,237,  1,  0,  0, 31,  2,  0,  0, 57,
+/* 0x2b20 */   0,  0,  0,  0,  0,  0,  0,246,  1,  0,  0, 88,  2,  0,  0, 14,
+/* 0x2b30 */   0,  0,  0,  0,  0,  0,  0,255,  1,  0,  0,102,  2,  0,  0,  6,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0,  0,  8,  2,  0,  0,108,  2,  0,  0, 21,
+/* 0x2b50 */   0,  0,  0,  0,  0,  0,  0, 17,  2,  0,  0,129,  2,  0,  0, 11,
+/* 0x2b60 */   0,  0,  0,  0,  0,  0,  0, 26,  2,  0,  0,140,  2,  0,  0,  4,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0,  0, 35,  2,  0,  0,144,  2,  0,  0, 13,
+/* 0x2b80 */   0,  0,  0,  0,  0,  0,  0, 44,  2,  0,  0,157,  2,  0,  0, 11,
+/* 0x2b90 */   0,  0,  0,  0,  0,  0,  0, 53,  2,  0,  0,168,  2,  0,  0, 19,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0,  0, 62,  2,  0,  0,187,  2,  0,  0,  6,
+/* 0x2bb0 */   0,  0,  0,  0,  0,  0,  0, 71,  2,  0,  0,193,  2,  0,  0,  3,
+/* 0x2bc0 */   0,  0,  0,  0,  0,  0,  0, 80,  2,  0,  0,196,  2,  0,  0, 62,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0,  0, 89,  2,  0,  0,  2,  3,  0,  0, 14,
+/* 0x2be0 */   0,  0,  0,  0,  0,  0,  0, 98,  2,  0,  0, 16,  3,  0,  0,  6,
+/* 0x2bf0 */   0,  0,  0,  0,  0,  0,  0,107,  2,  0,  0, 22,  3,  0,  0, 21,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0,  0,116,  2,  0,  0, 43,  3,  0,  0, 11,
+/* 0x2c10 */   0,  0,  0,  0,  0,  0,  0,125,  2,  0,  0, 54,  3,  0,  0,  4,
+/* 0x2c20 */   0,  0,  0,  0,  0,  0,  0,134,  2,  0,  0, 58,  3,  0,  0, 50,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0,108,  3,  0,  0,  8,
+/* 0x2c40 */   0,  0,  0,  0,  0,  0,  0,167,  2,  0,  0,116,  3,  0,  0,155,
+/* 0x2c50 */  17,  0,  0,  0,  0,  0,  0,178,  2,  0,  0, 15, 21,  0,  0, 47,
+/* 0x2c60 */  18,  0,  0,  0,  0,  0,  0,189,  2,  0,  0, 62, 39,  0,  0,  1,
+/* 0x2c70 */   0,  0,  0,  0,  0,  0,  0,200,  2,  0,  0, 63, 39,  0,  0, 12,
+/* 0x2c80 */   0,  0,  0,  0,  0,  0,  0,211,  2,  0,  0, 75, 39,  0,  0,  5,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0,  0,222,  2,  0,  0, 80, 39,  0,  0,  7,
+/* 0x2ca0 */   0,  0,  0,  0,  0,  0,  0,233,  2,  0,  0, 87, 39,  0,  0,  1,
+/* 0x2cb0 */   0,  0,  0,  0,  0,  0,  0,242,  2,  0,  0, 88, 39,  0,  0,  7,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,251,  2,  0,  0, 95, 39,  0,  0,  2,
+/* 0x2cd0 */   0,  0,  0,  0,  0,  0,  0,  4,  3,  0,  0, 97, 39,  0,  0, 30,
+/* 0x2ce0 */   0,  0,  0,  0,  0,  0,  0, 13,  3,  0,  0,127, 39,  0,  0, 18,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0,  0, 22,  3,  0,  0,145, 39,  0,  0,  4,
+/* 0x2d00 */   0,  0,  0,  0,  0,  0,  0, 31,  3,  0,  0,149, 39,  0,  0,  2,
+/* 0x2d10 */   0,  0,  0,  0,  0,  0,  0, 40,  3,  0,  0,151, 39,  0,  0,  2,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0,  0, 49,  3,  0,  0,153, 39,  0,  0,  3,
+/* 0x2d30 */   0,  0,  0,  0,  0,  0,  0, 58,  3,  0,  0,156, 39,  0,  0, 19,
+/* 0x2d40 */   0,  0,  0,  0,  0,  0,  0, 68,  3,  0,  0,175, 39,  0,  0,  6,
+/* 0x2d50 */   0,  0,  0,  0,  0,  0,  0, 77,  3,  0,  0,181, 39,  0,  0,  3,
+/* 0x2d60 */   0,  0,  0,  0,  0,  0,  0, 86,  3,  0,  0,184, 39,  0,  0,  5,
+/* 0x2d70 */   0,  0,  0,  0,  0,  0,  0, 95,  3,  0,  0,189, 39,  0,  0,  4,
+/* 0x2d80 */   0,  0,  0,  0,  0,  0,  0,104,  3,  0,  0,193, 39,  0,  0,  6,
+/* 0x2d90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2da0 */   0,  0,  0,  0,  0,  0,  0, 53,  1,  0,  0, 33,  0,  0,  0,  0,
+/* 0x2db0 */   0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  4,  0,  0,  0,  0,
+/* 0x2dc0 */   0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 10,  0,  0,  0,  0,
+/* 0x2dd0 */   0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0, 11,  0,  0,  0,  0,
+/* 0x2de0 */   0,  0,  0,  0,  0,  0,  0,172,  0,  0,  0, 18,  0,  0,  0,  0,
+/* 0x2df0 */   0,  0,  0,  0,  0,  0,  0,226,  0,  0,  0, 24,  0,  0,  0,  0,
+/* 0x2e00 */   0,  0,  0,  0,  0,  0,  0,235,  0,  0,  0, 25,  0,  0,  0,  0,
+/* 0x2e10 */   0,  0,  0,  0,  0,  0,  0, 93,  1,  0,  0, 36,  0,  0,  0,  0,
+/* 0x2e20 */   0,  0,  0,  0,  0,  0,  0,138,  1,  0,  0, 41,  0,  0,  0,  0,
+/* 0x2e30 */   0,  0,  0,  0,  0,  0,  0,165,  1,  0,  0, 44,  0,  0,  0,  0,
+/* 0x2e40 */   0,  0,  0,  0,  0,  0,  0,183,  1,  0,  0, 46,  0,  0,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0,  0,  0,  0,192,  1,  0,  0, 47,  0,  0,  0,  0,
+/* 0x2e60 */   0,  0,  0,  0,  0,  0,  0,237,  1,  0,  0, 52,  0,  0,  0,  0,
+/* 0x2e70 */   0,  0,  0,  0,  0,  0,  0,  8,  2,  0,  0, 55,  0,  0,  0,  0,
+/* 0x2e80 */   0,  0,  0,  0,  0,  0,  0, 26,  2,  0,  0, 57,  0,  0,  0,  0,
+/* 0x2e90 */   0,  0,  0,  0,  0,  0,  0, 35,  2,  0,  0, 58,  0,  0,  0,  0,
+/* 0x2ea0 */   0,  0,  0,  0,  0,  0,  0, 80,  2,  0,  0, 63,  0,  0,  0,  0,
+/* 0x2eb0 */   0,  0,  0,  0,  0,  0,  0,107,  2,  0,  0, 66,  0,  0,  0,  0,
+/* 0x2ec0 */   0,  0,  0,  0,  0,  0,  0,125,  2,  0,  0, 68,  0,  0,  0,  0,
+/* 0x2ed0 */   0,  0,  0,  0,  0,  0,  0,134,  2,  0,  0, 69,  0,  0,  0,  0,
+/* 0x2ee0 */   0,  0,  0,  0,  0,  0,  0,211,  2,  0,  0, 75,  0,  0,  0,  0,
+/* 0x2ef0 */   0,  0,  0,  0,  0,  0,  0,  4,  3,  0,  0, 80,  0,  0,  0,  0,
+/* 0x2f00 */   0,  0,  0,  0,  0,  0,  0, 22,  3,  0,  0, 82,  0,  0,  0,  0,
+/* 0x2f10 */   0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  1,  0,  0,  0,  0,
+/* 0x2f20 */   0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,  2,  0,  0,  0,  0,
+/* 0x2f30 */   0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  3,  0,  0,  0,  0,
+/* 0x2f40 */   0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0,  5,  0,  0,  0,  0,
+/* 0x2f50 */   0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  6,  0,  0,  0,  0,
+/* 0x2f60 */   0,  0,  0,  0,  0,  0,  0, 73,  0,  0,  0,  7,  0,  0,  0,  0,
+/* 0x2f70 */   0,  0,  0,  0,  0,  0,  0, 82,  0,  0,  0,  8,  0,  0,  0,  0,
+/* 0x2f80 */   0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  9,  0,  0,  0,  0,
+/* 0x2f90 */   0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0, 12,  0,  0,  0,  0,
+/* 0x2fa0 */   0,  0,  0,  0,  0,  0,  0,127,  0,  0,  0, 13,  0,  0,  0,  0,
+/* 0x2fb0 */   0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0, 14,  0,  0,  0,  0,
+/* 0x2fc0 */   0,  0,  0,  0,  0,  0,  0,145,  0,  0,  0, 15,  0,  0,  0,  0,
+/* 0x2fd0 */   0,  0,  0,  0,  0,  0,  0,154,  0,  0,  0, 16,  0,  0,  0,  0,
+/* 0x2fe0 */   0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0, 17,  0,  0,  0,  0,
+/* 0x2ff0 */   0,  0,  0,  0,  0,  0,  0,181,  0,  0,  0, 19,  0,  0,  0,  0,
+/* 0x3000 */   0,  0,  0,  0,  0,  0,  0,190,  0,  0,  0, 20,  0,  0,  0,  0,
+/* 0x3010 */   0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0, 21,  0,  0,  0,  0,
+/* 0x3020 */   0,  0,  0,  0,  0,  0,  0,208,  0,  0,  0, 22,  0,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0,  0,  0,  0,217,  0,  0,  0, 23,  0,  0,  0,  0,
+/* 0x3040 */   0,  0,  0,  0,  0,  0,  0,244,  0,  0,  0, 26,  0,  0,  0,  0,
+/* 0x3050 */   0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,
+/* 0x3060 */   0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 28,  0,  0,  0,  0,
+/* 0x3070 */   0,  0,  0,  0,  0,  0,  0, 15,  1,  0,  0, 29,  0,  0,  0,  0,
+/* 0x3080 */   0,  0,  0,  0,  0,  0,  0, 24,  1,  0,  0, 30,  0,  0,  0,  0,
+/* 0x3090 */   0,  0,  0,  0,  0,  0,  0, 33,  1,  0,  0, 31,  0,  0,  0,  0,
+/* 0x30a0 */   0,  0,  0,  0,  0,  0,  0, 43,  1,  0,  0, 32,  0,  0,  0,  0,
+/* 0x30b0 */   0,  0,  0,  0,  0,  0,  0, 75,  1,  0,  0, 34,  0,  0,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0,  0,  0,  0, 84,  1,  0,  0, 35,  0,  0,  0,  0,
+/* 0x30d0 */   0,  0,  0,  0,  0,  0,  0,102,  1,  0,  0, 37,  0,  0,  0,  0,
+/* 0x30e0 */   0,  0,  0,  0,  0,  0,  0,111,  1,  0,  0, 38,  0,  0,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0,  0,  0,  0,120,  1,  0,  0, 39,  0,  0,  0,  0,
+/* 0x3100 */   0,  0,  0,  0,  0,  0,  0,129,  1,  0,  0, 40,  0,  0,  0,  0,
+/* 0x3110 */   0,  0,  0,  0,  0,  0,  0,147,  1,  0,  0, 42,  0,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0,  0,  0,  0,156,  1,  0,  0, 43,  0,  0,  0,  0,
+/* 0x3130 */   0,  0,  0,  0,  0,  0,  0,174,  1,  0,  0, 45,  0,  0,  0,  0,
+/* 0x3140 */   0,  0,  0,  0,  0,  0,  0,201,  1,  0,  0, 48,  0,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0,  0,  0,  0,210,  1,  0,  0, 49,  0,  0,  0,  0,
+/* 0x3160 */   0,  0,  0,  0,  0,  0,  0,219,  1,  0,  0, 50,  0,  0,  0,  0,
+/* 0x3170 */   0,  0,  0,  0,  0,  0,  0,228,  1,  0,  0, 51,  0,  0,  0,  0,
+/* 0x3180 */   0,  0,  0,  0,  0,  0,  0,246,  1,  0,  0, 53,  0,  0,  0,  0,
+/* 0x3190 */   0,  0,  0,  0,  0,  0,  0,255,  1,  0,  0, 54,  0,  0,  0,  0,
+/* 0x31a0 */   0,  0,  0,  0,  0,  0,  0, 17,  2,  0,  0, 56,  0,  0,  0,  0,
+/* 0x31b0 */   0,  0,  0,  0,  0,  0,  0, 44,  2,  0,  0, 59,  0,  0,  0,  0,
+/* 0x31c0 */   0,  0,  0,  0,  0,  0,  0, 53,  2,  0,  0, 60,  0,  0,  0,  0,
+/* 0x31d0 */   0,  0,  0,  0,  0,  0,  0, 62,  2,  0,  0, 61,  0,  0,  0,  0,
+/* 0x31e0 */   0,  0,  0,  0,  0,  0,  0, 71,  2,  0,  0, 62,  0,  0,  0,  0,
+/* 0x31f0 */   0,  0,  0,  0,  0,  0,  0, 89,  2,  0,  0, 64,  0,  0,  0,  0,
+/* 0x3200 */   0,  0,  0,  0,  0,  0,  0, 98,  2,  0,  0, 65,  0,  0,  0,  0,
+/* 0x3210 */   0,  0,  0,  0,  0,  0,  0,116,  2,  0,  0, 67,  0,  0,  0,  0,
+/* 0x3220 */   0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0, 70,  0,  0,  0,  0,
+/* 0x3230 */   0,  0,  0,  0,  0,  0,  0,167,  2,  0,  0, 71,  0,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0,  0,  0,  0,178,  2,  0,  0, 72,  0,  0,  0,  0,
+/* 0x3250 */   0,  0,  0,  0,  0,  0,  0,189,  2,  0,  0, 73,  0,  0,  0,  0,
+/* 0x3260 */   0,  0,  0,  0,  0,  0,  0,200,  2,  0,  0, 74,  0,  0,  0,  0,
+/* 0x3270 */   0,  0,  0,  0,  0,  0,  0,222,  2,  0,  0, 76,  0,  0,  0,  0,
+/* 0x3280 */   0,  0,  0,  0,  0,  0,  0,233,  2,  0,  0, 77,  0,  0,  0,  0,
+/* 0x3290 */   0,  0,  0,  0,  0,  0,  0,242,  2,  0,  0, 78,  0,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0,  0,  0,  0,251,  2,  0,  0, 79,  0,  0,  0,  0,
+/* 0x32b0 */   0,  0,  0,  0,  0,  0,  0, 13,  3,  0,  0, 81,  0,  0,  0,  0,
+/* 0x32c0 */   0,  0,  0,  0,  0,  0,  0, 31,  3,  0,  0, 83,  0,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0,  0,  0,  0, 40,  3,  0,  0, 84,  0,  0,  0,  0,
+/* 0x32e0 */   0,  0,  0,  0,  0,  0,  0, 49,  3,  0,  0, 85,  0,  0,  0,  0,
+/* 0x32f0 */   0,  0,  0,  0,  0,  0,  0, 58,  3,  0,  0, 86,  0,  0,  0,  0,
+/* 0x3300 */   0,  0,  0,  0,  0,  0,  0, 68,  3,  0,  0, 87,  0,  0,  0,  0,
+/* 0x3310 */   0,  0,  0,  0,  0,  0,  0, 77,  3,  0,  0, 88,  0,  0,  0,  0,
+/* 0x3320 */   0,  0,  0,  0,  0,  0,  0, 86,  3,  0,  0, 89,  0,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0,  0,  0,  0, 95,  3,  0,  0, 90,  0,  0,  0,  0,
+/* 0x3340 */   0,  0,  0,  0,  0,  0,  0,104,  3,  0,  0, 91,  0,  0,  0,  0,
+/* 0x3350 */   0,  0,  0,  0,  0,  0,  0,113,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x3360 */ 222,173,222,  0,  0,  0,  0,123,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x3370 */ 222,173,222,  0,  0,  0,  0,133,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x3380 */ 222,173,222,  0,  0,  0,  0,147,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x3390 */ 222,173,222,  0,  0,  0,  0,160,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x33a0 */ 222,173,222,  0,  0,  0,  0,173,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x33b0 */ 222,173,222,  0,  0,  0,  0,189,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x33c0 */ 222,173,222,  0,  0,  0,  0,203,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x33d0 */ 222,173,222,  0,  0,  0,  0,215,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x33e0 */ 222,173,222,  0,  0,  0,  0,230,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x33f0 */ 222,173,222,  0,  0,  0,  0,250,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x3400 */ 222,173,222,  0,  0,  0,  0, 13,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3410 */ 222,173,222,  0,  0,  0,  0, 22,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3420 */ 222,173,222,  0,  0,  0,  0, 40,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3430 */ 222,173,222,  0,  0,  0,  0, 54,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3440 */ 222,173,222,  0,  0,  0,  0, 65,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3450 */ 222,173,222,  0,  0,  0,  0, 79,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3460 */ 222,173,222,  0,  0,  0,  0, 90,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3470 */ 222,173,222,  0,  0,  0,  0,106,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3480 */ 222,173,222,  0,  0,  0,  0,125,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3490 */ 222,173,222,  0,  0,  0,  0,147,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x34a0 */ 222,173,222,  0,  0,  0,  0,166,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x34b0 */ 222,173,222,  0,  0,  0,  0,177,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x34c0 */ 222,173,222,  0,  0,  0,  0,189,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x34d0 */ 222,173,222,  0,  0,  0,  0,201,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x34e0 */ 222,173,222,  0,  0,  0,  0,213,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x34f0 */ 222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,225,
+/* 0x3500 */   4,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3510 */   0,  0,  0,  6,  0,  0,  0,225,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3520 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,225,
+/* 0x3530 */   4,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3540 */   0,  0,  0, 10,  0,  0,  0,225,  4,  0,  0, 94,  0,  0,  0,  0,
+/* 0x3550 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,225,
+/* 0x3560 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3570 */   0,  0,  0, 25,  0,  0,  0,225,  4,  0,  0, 95,  0,  0,  0,  0,
+/* 0x3580 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,225,
+/* 0x3590 */   4,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+/* 0x35a0 */   0,  0,  0,  1,  0,  0,  0,225,  4,  0,  0, 95,  0,  0,  0,  0,
+/* 0x35b0 */   0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  8,  0,  0,  0,225,
+/* 0x35c0 */   4,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
+/* 0x35d0 */   0,  0,  0,  2,  0,  0,  0,234,  4,  0,  0,  3,  0,  0,  0,  0,
+/* 0x35e0 */   0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  8,  0,  0,  0,234,
+/* 0x35f0 */   4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,
+/* 0x3600 */   0,  0,  0,  1,  0,  0,  0,245,  4,  0,  0,  3,  0,  0,  0,  0,
+/* 0x3610 */   0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  1,  0,  0,  0,245,
+/* 0x3620 */   4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,
+/* 0x3630 */   0,  0,  0,  1,  0,  0,  0,245,  4,  0,  0,  2,  0,  0,  0,  0,
+/* 0x3640 */   0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 16,  0,  0,  0,234,
+/* 0x3650 */   4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,
+/* 0x3660 */   0,  0,  0, 24,  0,  0,  0,234,  4,  0,  0,  3,  0,  0,  0,  0,
+/* 0x3670 */   0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  8,  0,  0,  0,245,
+/* 0x3680 */   4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,
+/* 0x3690 */   0,  0,  0,  2,  0,  0,  0,225,  4,  0,  0, 97,  0,  0,  0,  0,
+/* 0x36a0 */   0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0,245,
+/* 0x36b0 */   4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,
+/* 0x36c0 */   0,  0,  0,  2,  0,  0,  0,225,  4,  0,  0, 97,  0,  0,  0,  0,
+/* 0x36d0 */   0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  1,  0,  0,  0,245,
+/* 0x36e0 */   4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,
+/* 0x36f0 */   0,  0,  0,  1,  0,  0,  0,245,  4,  0,  0,  6,  0,  0,  0,  0,
+/* 0x3700 */   0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  2,  0,  0,  0,245,
+/* 0x3710 */   4,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,
+/* 0x3720 */   0,  0,  0,  1,  0,  0,  0,225,  4,  0,  0, 98,  0,  0,  0,  0,
+/* 0x3730 */   0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  4,  0,  0,  0,225,
+/* 0x3740 */   4,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,
+/* 0x3750 */   0,  0,  0, 15,  0,  0,  0,225,  4,  0,  0,100,  0,  0,  0,  0,
+/* 0x3760 */   0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0, 20,  0,  0,  0,225,
+/* 0x3770 */   4,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,
+/* 0x3780 */   0,  0,  0,  3,  0,  0,  0,225,  4,  0,  0,  7,  0,  0,  0,  0,
+/* 0x3790 */   0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,255,
+/* 0x37a0 */   4,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,
+/* 0x37b0 */   0,  0,  0,  1,  0,  0,  0,245,  4,  0,  0,  7,  0,  0,  0,  0,
+/* 0x37c0 */   0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  7,  0,  0,  0,225,
+/* 0x37d0 */   4,  0,  0,102,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,
+/* 0x37e0 */   0,  0,  0,  1,  0,  0,  0,225,  4,  0,  0,103,  0,  0,  0,  0,
+/* 0x37f0 */   0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  6,  0,  0,  0,234,
+/* 0x3800 */   4,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,
+/* 0x3810 */   0,  0,  0,  1,  0,  0,  0,234,  4,  0,  0, 10,  0,  0,  0,  0,
+/* 0x3820 */   0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,  4,  0,  0,  0,245,
+/* 0x3830 */   4,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,
+/* 0x3840 */   0,  0,  0, 10,  0,  0,  0,245,  4,  0,  0,  9,  0,  0,  0,  0,
+/* 0x3850 */   0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0, 10,  0,  0,  0,234,
+/* 0x3860 */   4,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,
+/* 0x3870 */   0,  0,  0, 18,  0,  0,  0,234,  4,  0,  0, 10,  0,  0,  0,  0,
+/* 0x3880 */   0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0, 48,  0,  0,  0,245,
+/* 0x3890 */   4,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,
+/* 0x38a0 */   0,  0,  0,  5,  0,  0,  0,245,  4,  0,  0,  9,  0,  0,  0,  0,
+/* 0x38b0 */   0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0, 18,  0,  0,  0,245,
+/* 0x38c0 */   4,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,
+/* 0x38d0 */   0,  0,  0,  6,  0,  0,  0,234,  4,  0,  0, 14,  0,  0,  0,  0,
+/* 0x38e0 */   0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  1,  0,  0,  0,234,
+/* 0x38f0 */   4,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,
+/* 0x3900 */   0,  0,  0,  7,  0,  0,  0,234,  4,  0,  0, 14,  0,  0,  0,  0,
+/* 0x3910 */   0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0, 14,  0,  0,  0,245,
+/* 0x3920 */   4,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,
+/* 0x3930 */   0,  0,  0, 18,  0,  0,  0,245,  4,  0,  0, 13,  0,  0,  0,  0,
+/* 0x3940 */   0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 14,  0,  0,  0,234,
+/* 0x3950 */   4,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,
+/* 0x3960 */   0,  0,  0, 19,  0,  0,  0,234,  4,  0,  0, 14,  0,  0,  0,  0,
+/* 0x3970 */   0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 27,  0,  0,  0,234,
+/* 0x3980 */   4,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,
+/* 0x3990 */   0,  0,  0, 56,  0,  0,  0,245,  4,  0,  0, 12,  0,  0,  0,  0,
+/* 0x39a0 */   0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0,  5,  0,  0,  0,245,
+/* 0x39b0 */   4,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,
+/* 0x39c0 */   0,  0,  0, 18,  0,  0,  0,245,  4,  0,  0, 15,  0,  0,  0,  0,
+/* 0x39d0 */   0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  6,  0,  0,  0,234,
+/* 0x39e0 */   4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,
+/* 0x39f0 */   0,  0,  0,  1,  0,  0,  0,234,  4,  0,  0, 18,  0,  0,  0,  0,
+/* 0x3a00 */   0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  7,  0,  0,  0,234,
+/* 0x3a10 */   4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,
+/* 0x3a20 */   0,  0,  0, 14,  0,  0,  0,245,  4,  0,  0, 19,  0,  0,  0,  0,
+/* 0x3a30 */   0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 18,  0,  0,  0,245,
+/* 0x3a40 */   4,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x3a50 */   0,  0,  0, 14,  0,  0,  0,234,  4,  0,  0, 18,  0,  0,  0,  0,
+/* 0x3a60 */   0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 21,  0,  0,  0,234,
+/* 0x3a70 */   4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x3a80 */   0,  0,  0, 27,  0,  0,  0,234,  4,  0,  0, 18,  0,  0,  0,  0,
+/* 0x3a90 */   0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 32,  0,  0,  0,234,
+/* 0x3aa0 */   4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x3ab0 */   0,  0,  0, 61,  0,  0,  0,245,  4,  0,  0, 16,  0,  0,  0,  0,
+/* 0x3ac0 */   0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  5,  0,  0,  0,245,
+/* 0x3ad0 */   4,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,
+/* 0x3ae0 */   0,  0,  0, 18,  0,  0,  0,245,  4,  0,  0, 19,  0,  0,  0,  0,
+/* 0x3af0 */   0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  4,  0,  0,  0,225,
+/* 0x3b00 */   4,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,
+/* 0x3b10 */   0,  0,  0, 12,  0,  0,  0,225,  4,  0,  0,105,  0,  0,  0,  0,
+/* 0x3b20 */   0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 16,  0,  0,  0,225,
+/* 0x3b30 */   4,  0,  0,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,
+/* 0x3b40 */   0,  0,  0, 26,  0,  0,  0,225,  4,  0,  0,107,  0,  0,  0,  0,
+/* 0x3b50 */   0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 30,  0,  0,  0,225,
+/* 0x3b60 */   4,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,
+/* 0x3b70 */   0,  0,  0, 44,  0,  0,  0,225,  4,  0,  0,109,  0,  0,  0,  0,
+/* 0x3b80 */   0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 49,  0,  0,  0,255,
+/* 0x3b90 */   4,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x3ba0 */   0,  0,  0,  0,  0,  0,  0,255,  4,  0,  0,106,  0,  0,  0,  0,
+/* 0x3bb0 */   0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  1,  0,  0,  0,255,
+/* 0x3bc0 */   4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x3bd0 */   0,  0,  0,  2,  0,  0,  0,255,  4,  0,  0,108,  0,  0,  0,  0,
+/* 0x3be0 */   0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  3,  0,  0,  0,255,
+/* 0x3bf0 */   4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x3c00 */   0,  0,  0,  4,  0,  0,  0,255,  4,  0,  0,109,  0,  0,  0,  0,
+/* 0x3c10 */   0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  5,  0,  0,  0,255,
+/* 0x3c20 */   4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x3c30 */   0,  0,  0,  6,  0,  0,  0,255,  4,  0,  0,106,  0,  0,  0,  0,
+/* 0x3c40 */   0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  7,  0,  0,  0,255,
+/* 0x3c50 */   4,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,
+/* 0x3c60 */   0,  0,  0,  3,  0,  0,  0,225,  4,  0,  0,111,  0,  0,  0,  0,
+/* 0x3c70 */   0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,  3,  0,  0,  0,225,
+/* 0x3c80 */   4,  0,  0,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,
+/* 0x3c90 */   0,  0,  0,  3,  0,  0,  0,225,  4,  0,  0,112,  0,  0,  0,  0,
+/* 0x3ca0 */   0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  2,  0,  0,  0,225,
+/* 0x3cb0 */   4,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,
+/* 0x3cc0 */   0,  0,  0, 26,  0,  0,  0,245,  4,  0,  0, 23,  0,  0,  0,  0,
+/* 0x3cd0 */   0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0, 17,  0,  0,  0,245,
+/* 0x3ce0 */   4,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,
+/* 0x3cf0 */   0,  0,  0,  1,  0,  0,  0,245,  4,  0,  0, 22,  0,  0,  0,  0,
+/* 0x3d00 */   0,  0,  0,  0,  0,  0,  0, 84,  0,  0,  0,  1,  0,  0,  0,245,
+/* 0x3d10 */   4,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,
+/* 0x3d20 */   0,  0,  0,  2,  0,  0,  0,225,  4,  0,  0,114,  0,  0,  0,  0,
+/* 0x3d30 */   0,  0,  0,  0,  0,  0,  0, 88,  0,  0,  0,  1,  0,  0,  0,225,
+/* 0x3d40 */   4,  0,  0,115,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,
+/* 0x3d50 */   0,  0,  0,  1,  0,  0,  0,225,  4,  0,  0,116,  0,  0,  0,  0,
+/* 0x3d60 */   0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  3,  0,  0,  0,225,
+/* 0x3d70 */   4,  0,  0,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,
+/* 0x3d80 */   0,  0,  0,  2,  0,  0,  0,225,  4,  0,  0,117,  0,  0,  0,  0,
+/* 0x3d90 */   0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  2,  0,  0,  0,225,
+/* 0x3da0 */   4,  0,  0,116,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,
+/* 0x3db0 */  69, 86, 73, 67, 69, 69, 78, 84, 82, 89,  0, 76, 90, 77, 65, 68,
+/* 0x3dc0 */  69, 86, 73, 67, 69,  0, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82,
+/* 0x3dd0 */  89, 50,  0, 76, 90, 77, 65, 69, 78, 84, 82, 89,  0, 78, 82, 86,
+/* 0x3de0 */  50, 66, 49, 54, 48,  0, 78, 82, 86, 68, 68, 79, 78, 69,  0, 78,
+/* 0x3df0 */  82, 86, 68, 82, 69, 84, 85,  0, 78, 82, 86, 68, 69, 67, 79, 49,
+/* 0x3e00 */   0, 78, 82, 86, 76, 69, 68, 48, 48,  0, 78, 82, 86, 71, 84, 68,
+/* 0x3e10 */  48, 48,  0, 78, 82, 86, 68, 69, 67, 79, 50,  0, 67, 65, 76, 76,
+/* 0x3e20 */  84, 82, 49, 54,  0, 67, 84, 49, 54, 73, 50, 56, 54,  0, 67, 84,
+/* 0x3e30 */  49, 54, 83, 85, 66, 48,  0, 67, 84, 49, 54, 73, 48, 56, 54,  0,
+/* 0x3e40 */  67, 65, 76, 76, 84, 82, 73, 50,  0, 67, 84, 49, 54, 69, 56, 48,
+/* 0x3e50 */  48,  0, 67, 84, 49, 54, 69, 57, 48, 48,  0, 67, 65, 76, 76, 84,
+/* 0x3e60 */  82, 73, 53,  0, 67, 84, 49, 54, 74, 69, 78, 68,  0, 67, 84, 49,
+/* 0x3e70 */  54, 74, 85, 76, 50,  0, 67, 84, 49, 54, 73, 50, 56, 55,  0, 67,
+/* 0x3e80 */  84, 49, 54, 83, 85, 66, 49,  0, 67, 84, 49, 54, 73, 48, 56, 55,
+/* 0x3e90 */   0, 67, 65, 76, 76, 84, 82, 73, 54,  0, 69, 88, 69, 69, 78, 84,
+/* 0x3ea0 */  82, 89,  0, 76, 79, 78, 71, 83, 85, 66,  0, 83, 72, 79, 82, 84,
+/* 0x3eb0 */  83, 85, 66,  0, 74, 78, 67, 68, 79, 67, 79, 80, 89,  0, 69, 88,
+/* 0x3ec0 */  69, 82, 69, 76, 80, 85,  0, 69, 88, 69, 77, 65, 73, 78, 52,  0,
+/* 0x3ed0 */  69, 88, 69, 77, 65, 73, 78, 52, 66,  0, 69, 88, 69, 77, 65, 73,
+/* 0x3ee0 */  78, 52, 67,  0, 67, 79, 77, 80, 82, 69, 83, 83, 69, 68, 95, 76,
+/* 0x3ef0 */  90, 77, 65, 95, 83, 84, 65, 82, 84,  0, 85, 80, 88, 49, 72, 69,
+/* 0x3f00 */  65, 68,  0, 69, 88, 69, 67, 85, 84, 80, 79,  0, 78, 82, 86, 50,
+/* 0x3f10 */  66, 49, 54, 83,  0, 78, 50, 66, 54, 52, 75, 48, 49,  0, 78, 82,
+/* 0x3f20 */  86, 50, 66, 69, 88, 49,  0, 78, 50, 66, 88, 56, 54, 48, 49,  0,
+/* 0x3f30 */  78, 50, 66, 50, 56, 54, 48, 49,  0, 78, 82, 86, 50, 66, 69, 88,
+/* 0x3f40 */  50,  0, 78, 50, 66, 88, 56, 54, 48, 50,  0, 78, 50, 66, 50, 56,
+/* 0x3f50 */  54, 48, 50,  0, 78, 82, 86, 50, 66, 69, 88, 51,  0, 78, 50, 66,
+/* 0x3f60 */  54, 52, 75, 48, 50,  0, 78, 82, 86, 50, 66, 69, 88, 57,  0, 78,
+/* 0x3f70 */  82, 86, 50, 68, 49, 54, 83,  0, 78, 50, 68, 54, 52, 75, 48, 49,
+/* 0x3f80 */   0, 78, 82, 86, 50, 68, 69, 88, 49,  0, 78, 50, 68, 88, 56, 54,
+/* 0x3f90 */  48, 49,  0, 78, 50, 68, 50, 56, 54, 48, 49,  0, 78, 82, 86, 50,
+/* 0x3fa0 */  68, 69, 88, 50,  0, 78, 50, 68, 88, 56, 54, 48, 50,  0, 78, 50,
+/* 0x3fb0 */  68, 50, 56, 54, 48, 50,  0, 78, 82, 86, 50, 68, 69, 88, 51,  0,
+/* 0x3fc0 */  78, 50, 68, 54, 52, 75, 48, 50,  0, 78, 82, 86, 50, 68, 69, 88,
+/* 0x3fd0 */  57,  0, 78, 82, 86, 50, 69, 49, 54, 83,  0, 78, 50, 69, 54, 52,
+/* 0x3fe0 */  75, 48, 49,  0, 78, 82, 86, 50, 69, 69, 88, 49,  0, 78, 50, 69,
+/* 0x3ff0 */  88, 56, 54, 48, 49,  0, 78, 50, 69, 50, 56, 54, 48, 49,  0, 78,
+/* 0x4000 */  82, 86, 50, 69, 69, 88, 50,  0, 78, 50, 69, 88, 56, 54, 48, 50,
+/* 0x4010 */   0, 78, 50, 69, 50, 56, 54, 48, 50,  0, 78, 82, 86, 50, 69, 69,
+/* 0x4020 */  88, 51,  0, 78, 50, 69, 54, 52, 75, 48, 50,  0, 78, 82, 86, 50,
+/* 0x4030 */  69, 69, 88, 57,  0, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  0,
+/* 0x4040 */ 105,103,110,111,114,101, 95,114,101,108,111, 99, 95,111,118,101,
+/* 0x4050 */ 114,102,108,111,119,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
+/* 0x4060 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65,
+/* 0x4070 */  95, 68, 69, 67, 51, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51,
+/* 0x4080 */  49,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 50,  0, 76, 90, 77,
+/* 0x4090 */  65, 95, 68, 69, 67, 51, 51,  0, 69, 88, 69, 77, 65, 73, 78, 53,
+/* 0x40a0 */   0, 69, 88, 69, 65, 68, 74, 85, 83,  0, 69, 88, 69, 78, 79, 65,
+/* 0x40b0 */  68, 74,  0, 69, 88, 69, 82, 69, 76, 79, 49,  0, 69, 88, 69, 82,
+/* 0x40c0 */  69, 76, 57, 65,  0, 69, 88, 69, 82, 69, 76, 79, 50,  0, 69, 88,
+/* 0x40d0 */  69, 82, 69, 66, 73, 71,  0, 69, 88, 69, 82, 69, 76, 79, 51,  0,
+/* 0x40e0 */  69, 88, 69, 77, 65, 73, 78, 56,  0, 68, 69, 86, 73, 67, 69, 69,
+/* 0x40f0 */  78, 68,  0, 69, 88, 69, 83, 84, 65, 67, 75,  0, 69, 88, 69, 83,
+/* 0x4100 */  84, 65, 83, 80,  0, 69, 88, 69, 74, 85, 77, 80, 70,  0, 69, 88,
+/* 0x4110 */  69, 82, 67, 83, 80, 79,  0, 69, 88, 69, 82, 69, 84, 73, 80,  0,
+/* 0x4120 */  97,116,116,114,105, 98,117,116,101,  0,105,110,116,101,114,114,
+/* 0x4130 */ 117,112,116,  0,111,114,105,103, 95,115,116,114, 97,116,101,103,
+/* 0x4140 */ 121,  0,101,120,101, 95,115,116, 97, 99,107, 95,115,115,  0,101,
+/* 0x4150 */ 120,101, 95,115,116, 97, 99,107, 95,115,112,  0, 99, 97,108,108,
+/* 0x4160 */ 116,114,105, 99,107, 95, 99, 97,108,108,115,  0,119,111,114,100,
+/* 0x4170 */ 115, 95,116,111, 95, 99,111,112,121,  0, 99,111,112,121, 95,111,
+/* 0x4180 */ 102,102,115,101,116,  0,115,111,117,114, 99,101, 95,115,101,103,
+/* 0x4190 */ 109,101,110,116,  0,100,101,115,116,105,110, 97,116,105,111,110,
+/* 0x41a0 */  95,115,101,103,109,101,110,116,  0,100,101, 99,111,109,112,114,
+/* 0x41b0 */ 101,115,115,111,114, 95,101,110,116,114,121,  0, 98,120, 95,109,
+/* 0x41c0 */  97,103,105, 99,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95,
+/* 0x41d0 */  97,100,106,117,115,116,  0,108,122,109, 97, 95,117, 95,108,101,
+/* 0x41e0 */ 110, 95,104,105,  0,108,122,109, 97, 95,117, 95,108,101,110,  0,
+/* 0x41f0 */ 108,122,109, 97, 95, 99, 95,108,101,110, 95,104,105,  0,108,122,
+/* 0x4200 */ 109, 97, 95, 99, 95,108,101,110,  0,108,122,109, 97, 95,112,114,
+/* 0x4210 */ 111,112,101,114,116,105,101,115,  0,108,122,109, 97, 95,112,114,
+/* 0x4220 */ 111,112,101,114,116,105,101,115, 95,104,105,  0, 99,108,101, 97,
+/* 0x4230 */ 114, 95,100,105,114,116,121, 95,115,116, 97, 99,107, 95,108,111,
+/* 0x4240 */ 119,  0,108,122,109, 97, 95,117, 95,108,101,110, 95,115,101,103,
+/* 0x4250 */ 109,101,110,116,  0,114,101,108,111, 99, 95,115,105,122,101,  0,
+/* 0x4260 */ 111,114,105,103,105,110, 97,108, 95,115,115,  0,111,114,105,103,
+/* 0x4270 */ 105,110, 97,108, 95,115,112,  0,111,114,105,103,105,110, 97,108,
+/* 0x4280 */  95,105,112,  0,111,114,105,103,105,110, 97,108, 95, 99,115,  0,
+/* 0x4290 */  82, 95, 51, 56, 54, 95, 49, 54,  0, 82, 95, 51, 56, 54, 95, 80,
+/* 0x42a0 */  67, 49, 54,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95,
+/* 0x42b0 */  51, 56, 54, 95, 56,  0,199, 39,  0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* i386-darwin.macho-entry.h
-   created from i386-darwin.macho-entry.bin, 9602 (0x2582) bytes
+   created from i386-darwin.macho-entry.bin, 7686 (0x1e06) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_DARWIN_MACHO_ENTRY_SIZE    9602
-#define STUB_I386_DARWIN_MACHO_ENTRY_ADLER32 0x867b2295
-#define STUB_I386_DARWIN_MACHO_ENTRY_CRC32   0x46196242
+#define STUB_I386_DARWIN_MACHO_ENTRY_SIZE    7686
+#define STUB_I386_DARWIN_MACHO_ENTRY_ADLER32 0x531a0922
+#define STUB_I386_DARWIN_MACHO_ENTRY_CRC32   0x05c363cc
 
-unsigned char stub_i386_darwin_macho_entry[9602] = {
+unsigned char stub_i386_darwin_macho_entry[7686] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 148, 26,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -450,191 +450,71 @@ unsigned char stub_i386_darwin_macho_entry[9602] = {
 /* 0x19b0 */ 194,  4,  0,170,173,232, 16,  0,  0,  0, 48, 49, 50, 51, 52, 53,
 /* 0x19c0 */  54, 55, 56, 57, 97, 98, 99,100,101,102, 91,106,  8, 89,193,192,
 /* 0x19d0 */   4,137,194,131,224, 15,215,170,146, 73,117,242,195,232, 52,255,
-/* 0x19e0 */ 255,255,102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,
-/* 0x19f0 */ 102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,105,111,
-/* 0x1a00 */ 110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32,
-/* 0x1a10 */  32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32,
-/* 0x1a20 */  86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32,
-/* 0x1a30 */  32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,
-/* 0x1a40 */ 103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 77, 65,
-/* 0x1a50 */  67, 72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1a80 */  51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1a90 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1aa0 */  78, 76, 89, 10, 32, 32, 49, 32, 77, 65, 67, 72, 95, 85, 78, 67,
-/* 0x1ab0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1ac0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 57, 32, 32, 50, 42,
-/* 0x1ae0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1af0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 95, 72,
-/* 0x1b00 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 98,
-/* 0x1b10 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1b20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 57, 32,
-/* 0x1b30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1b40 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82,
-/* 0x1b50 */  86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1b60 */  48, 48,100, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */ 102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b90 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1ba0 */  78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 68, 32, 32, 32,
-/* 0x1bb0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 99, 55, 32, 32,
-/* 0x1bc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 99, 57, 32, 32, 50, 42,
-/* 0x1be0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1bf0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1c00 */  53, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c10 */  48, 48, 48, 48, 48, 48, 98, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1c30 */  48, 48, 48, 50, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1c40 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1c50 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65,
-/* 0x1c60 */  95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c70 */  50,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1c80 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52, 50,
-/* 0x1c90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1ca0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1cb0 */  89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x1cc0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  32, 32, 48, 48, 48, 48, 48, 51, 55, 48, 32, 32, 50, 42, 42, 48,
-/* 0x1cf0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1d00 */  79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1d10 */  67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 56, 54, 32,
-/* 0x1d20 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 98, 56, 32, 32, 50,
-/* 0x1d40 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1d50 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 76, 90, 77, 65,
-/* 0x1d60 */  95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,
-/* 0x1d70 */  56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101, 51,101,
-/* 0x1d90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1da0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 76,
-/* 0x1db0 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 49, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1dd0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x1de0 */  56, 99, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1df0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1e00 */  49, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1e30 */  48, 48, 49, 56,100,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1e40 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1e50 */  10, 32, 49, 50, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 32,
-/* 0x1e60 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 52, 32, 32, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e80 */  32, 48, 48, 48, 48, 49, 56,100,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1e90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1ea0 */  78, 76, 89, 10, 32, 49, 51, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x1eb0 */  90, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 48, 32, 32,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 56,102, 50, 32, 32, 50, 42,
-/* 0x1ee0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1ef0 */  65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x1f00 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1f10 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48,
-/* 0x1f20 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x1f30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1f40 */  32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48,
-/* 0x1f50 */  48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 10, 48,
-/* 0x1f60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1f70 */  77, 65, 67, 72, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1f80 */  48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65,
-/* 0x1fa0 */  67, 72, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72,
-/* 0x1fd0 */  95, 85, 78, 67,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 65,
-/* 0x1fe0 */  67, 72, 95, 85, 78, 67, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ff0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x2020 */  86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x2030 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2040 */  32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2060 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2070 */  69, 67, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2080 */  77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x20a0 */  76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x20b0 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x20d0 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x20e0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2100 */  69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2110 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2120 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2130 */  69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2140 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2150 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65,
-/* 0x2160 */  73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95,
-/* 0x2170 */  84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88,  9,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21b0 */  32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x21c0 */ 108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,
-/* 0x21d0 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x21e0 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21f0 */  48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48,
-/* 0x2200 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x2210 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109,
-/* 0x2220 */  97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x2240 */  48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,114,111,
-/* 0x2250 */ 112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 49, 52,
-/* 0x2260 */  32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x2270 */  78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,110,100, 95,
-/* 0x2280 */ 100,101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76, 79,
-/* 0x2290 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x22a0 */  79, 82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78, 88, 93, 58, 10,
-/* 0x22b0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x22c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x22d0 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x22e0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72,
-/* 0x22f0 */  77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2300 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x2310 */  82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2320 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2330 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 99, 57,
-/* 0x2340 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x2350 */  32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 54, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x2370 */  32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,
-/* 0x2380 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2390 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x23a0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x23b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x23c0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 51, 56,
-/* 0x23d0 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x23e0 */  86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32,
-/* 0x23f0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x2400 */  32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 10, 10, 82, 69, 76,
-/* 0x2410 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x2420 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70,
-/* 0x2430 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2440 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2450 */  48, 48, 48, 48, 97, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x2460 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x2470 */  68, 10, 48, 48, 48, 48, 48, 48, 53, 54, 32, 82, 95, 51, 56, 54,
-/* 0x2480 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67,
-/* 0x2490 */  72, 77, 65, 73, 78, 89, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x24a0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x24b0 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x24c0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x24d0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x24e0 */  48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x24f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116,
-/* 0x2500 */  97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48,
-/* 0x2510 */  48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x2520 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110,
-/* 0x2530 */  10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x2540 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97,
-/* 0x2550 */  95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32,
-/* 0x2560 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2570 */  32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,
-/* 0x2580 */ 115, 10
+/* 0x19e0 */ 255,255, 14,  0,  0,  0, 20,  0,  0,  0, 11,  0,  0,  0, 56,  3,
+/* 0x19f0 */   0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0, 10,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0, 19,  0,  0,  0, 57,  0,  0,  0,188,  0,  0,  0,  0,  0,
+/* 0x1a20 */   0,  0, 28,  0,  0,  0,245,  0,  0,  0,212,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0,  0, 34,  0,  0,  0,201,  1,  0,  0,199,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0,  0, 40,  0,  0,  0,144,  2,  0,  0,178,  0,  0,  0,  0,  0,
+/* 0x1a50 */   0,  0, 46,  0,  0,  0, 66,  3,  0,  0, 46,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0,  0, 57,  0,  0,  0,112,  3,  0,  0, 72,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0,  0, 68,  0,  0,  0,184,  3,  0,  0,134, 10,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0, 79,  0,  0,  0, 62, 14,  0,  0,134, 10,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0, 90,  0,  0,  0,196, 24,  0,  0, 26,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,  0,101,  0,  0,  0,222, 24,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   0,  0,110,  0,  0,  0,222, 24,  0,  0, 20,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,120,  0,  0,  0,242, 24,  0,  0,240,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0, 19,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   0,  0,110,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   0,  0,120,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */   0,  0, 10,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,  0, 28,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0, 34,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */   0,  0, 40,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   0,  0, 46,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */   0,  0, 57,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,  0, 68,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0,  0, 79,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0,  0, 90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   0,  0,101,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0,  0,130,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0,  0,137,  0,  0,  0, 15,  0,  0,  0,173,222,173,222,  0,  0,
+/* 0x1bd0 */   0,  0,155,  0,  0,  0, 15,  0,  0,  0,173,222,173,222,  0,  0,
+/* 0x1be0 */   0,  0,166,  0,  0,  0, 15,  0,  0,  0,173,222,173,222,  0,  0,
+/* 0x1bf0 */   0,  0,177,  0,  0,  0, 15,  0,  0,  0,173,222,173,222,  0,  0,
+/* 0x1c00 */   0,  0,193,  0,  0,  0, 12,  0,  0,  0, 20,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,  0,  1,  0,  0,  0,208,  0,  0,  0,  2,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,201,  0,
+/* 0x1c30 */   0,  0,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,  0,  3,  0,  0,  0,104,  0,  0,  0,208,  0,  0,  0,  1,  0,
+/* 0x1c50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,188,  0,
+/* 0x1c60 */   0,  0,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,  0,  4,  0,  0,  0,104,  0,  0,  0,208,  0,  0,  0,  1,  0,
+/* 0x1c80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,169,  0,
+/* 0x1c90 */   0,  0,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  5,  0,  0,  0, 86,  0,  0,  0,208,  0,  0,  0,  1,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  5,  0,
+/* 0x1cc0 */   0,  0,219,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  6,  0,  0,  0, 20,  0,  0,  0,219,  0,  0,  0, 16,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 30,  0,
+/* 0x1cf0 */   0,  0,219,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0,  6,  0,  0,  0, 42,  0,  0,  0,219,  0,  0,  0, 18,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77, 65, 67, 72, 77, 65,
+/* 0x1d20 */  73, 78, 88,  0, 77, 65, 67, 72, 95, 85, 78, 67,  0, 78, 82, 86,
+/* 0x1d30 */  95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50,
+/* 0x1d40 */  68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x1d50 */  48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x1d60 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1d70 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78,
+/* 0x1d80 */  82, 86, 95, 84, 65, 73, 76,  0, 77, 65, 67, 72, 77, 65, 73, 78,
+/* 0x1d90 */  89,  0, 77, 65, 67, 72, 77, 65, 73, 78, 90,  0, 95,115,116, 97,
+/* 0x1da0 */ 114,116,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,
+/* 0x1db0 */ 106,117,115,116,  0,108,122,109, 97, 95,117, 95,108,101,110,  0,
+/* 0x1dc0 */ 108,122,109, 97, 95, 99, 95,108,101,110,  0,108,122,109, 97, 95,
+/* 0x1dd0 */ 112,114,111,112,101,114,116,105,101,115,  0,101,110,100, 95,100,
+/* 0x1de0 */ 101, 99,111,109,112,114,101,115,115,  0, 82, 95, 51, 56, 54, 95,
+/* 0x1df0 */  80, 67, 51, 50,  0, 82, 95, 51, 56, 54, 95, 51, 50,  0,226, 25,
+/* 0x1e00 */   0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* i386-dos32.djgpp2.h
-   created from i386-dos32.djgpp2.bin, 26043 (0x65bb) bytes
+   created from i386-dos32.djgpp2.bin, 12712 (0x31a8) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_DOS32_DJGPP2_SIZE    26043
-#define STUB_I386_DOS32_DJGPP2_ADLER32 0x5bf4cde3
-#define STUB_I386_DOS32_DJGPP2_CRC32   0x82c240d0
+#define STUB_I386_DOS32_DJGPP2_SIZE    12712
+#define STUB_I386_DOS32_DJGPP2_ADLER32 0xfc518791
+#define STUB_I386_DOS32_DJGPP2_CRC32   0xa99b1664
 
-unsigned char stub_i386_dos32_djgpp2[26043] = {
+unsigned char stub_i386_dos32_djgpp2[12712] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  20, 30,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -448,1220 +448,387 @@ unsigned char stub_i386_dos32_djgpp2[26043] = {
 /* 0x1990 */ 114,  4,138,  7, 71,235, 13,131,233,  1,115,  6,233,252,255,255,
 /* 0x19a0 */ 255, 85, 80, 88, 33,161,216,208,213,  0,  0,  0,  0,  0,  0,  0,
 /* 0x19b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x19c0 */  45,102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102,
-/* 0x19d0 */  51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x19e0 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x19f0 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1a00 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1a10 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1a20 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 68, 74, 50,
-/* 0x1a30 */  77, 65, 73, 78, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1a40 */  48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1a50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x1a60 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1a70 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1a80 */  76, 89, 10, 32, 32, 49, 32, 68, 74, 67, 65, 76, 76, 84, 49, 32,
-/* 0x1a90 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x1ac0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1ad0 */  68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 68, 74, 50, 77, 65, 73,
-/* 0x1ae0 */  78, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x1af0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1b00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 49, 32, 32,
-/* 0x1b10 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1b20 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 76, 90, 77,
-/* 0x1b30 */  65, 95, 73, 78, 73, 84, 95, 83, 84, 65, 67, 75, 32, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1b60 */  48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1b70 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1b80 */  79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 50, 66, 83, 77, 65, 49,
-/* 0x1b90 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x1ba0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 52, 32, 32, 50,
-/* 0x1bc0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1bd0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1be0 */  32, 53, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32,
-/* 0x1bf0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c00 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 53, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1c20 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1c30 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 78, 50, 66,
-/* 0x1c40 */  70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53,
-/* 0x1c70 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c80 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32,
-/* 0x1c90 */  78, 50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 53,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1cd0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1ce0 */  32, 56, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32,
-/* 0x1cf0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d10 */  48, 48, 48, 48, 48, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1d20 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1d30 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 50, 66,
-/* 0x1d40 */  70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1d70 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1d80 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1d90 */  76, 89, 10, 32, 49, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32,
-/* 0x1da0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 56, 32, 32, 50, 42, 42,
-/* 0x1dd0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1de0 */  68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 78, 50, 66, 83, 77, 65,
-/* 0x1df0 */  51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100,
-/* 0x1e00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 53, 32, 32,
-/* 0x1e20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1e30 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1e40 */  32, 49, 50, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32,
-/* 0x1e50 */  32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 57, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e80 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1e90 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 78, 50,
-/* 0x1ea0 */  66, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 48, 51,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  97, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ee0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1ef0 */  78, 76, 89, 10, 32, 49, 52, 32, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x1f00 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32,
-/* 0x1f10 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100,102, 32, 32, 50, 42,
-/* 0x1f30 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1f40 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1f50 */  53, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1f60 */  48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1f80 */  48, 48, 48, 48,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1f90 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1fa0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 54, 32, 78, 50, 66, 83,
-/* 0x1fb0 */  77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,102, 98,
-/* 0x1fe0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1ff0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 55, 32, 78,
-/* 0x2000 */  50, 66, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2020 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2030 */  48,102,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2040 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x2050 */  56, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2060 */  48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2080 */  48, 48, 48, 49, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2090 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x20a0 */  10, 32, 49, 57, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 32, 32,
-/* 0x20b0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48,
-/* 0x20c0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x20d0 */  32, 48, 48, 48, 48, 48, 49, 48, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x20e0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x20f0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 48, 32, 78,
-/* 0x2100 */  50, 66, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2120 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2130 */  49, 49, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2140 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2150 */  79, 78, 76, 89, 10, 32, 50, 49, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x2160 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32,
-/* 0x2170 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2180 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50,101, 32, 32, 50,
-/* 0x2190 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x21a0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x21b0 */  50, 50, 32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32,
-/* 0x21c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x21e0 */  48, 48, 48, 48, 49, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x21f0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2200 */  89, 10, 32, 50, 51, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 32,
-/* 0x2210 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x2220 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  32, 32, 48, 48, 48, 48, 48, 49, 52, 52, 32, 32, 50, 42, 42, 48,
-/* 0x2240 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2250 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 52, 32,
-/* 0x2260 */  78, 50, 68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2270 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2290 */  48, 49, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x22a0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x22b0 */  68, 79, 78, 76, 89, 10, 32, 50, 53, 32, 78, 50, 68, 70, 65, 83,
-/* 0x22c0 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x22d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 57, 32, 32,
-/* 0x22f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2300 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 54, 32, 78, 50, 68,
-/* 0x2310 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2320 */  48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52,
-/* 0x2340 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2350 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55, 32,
-/* 0x2360 */  78, 50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2370 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2380 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2390 */  48, 49, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x23a0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x23b0 */  68, 79, 78, 76, 89, 10, 32, 50, 56, 32, 78, 50, 68, 70, 65, 83,
-/* 0x23c0 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57,
-/* 0x23d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x23e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 53,102, 32, 32,
-/* 0x23f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2400 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2410 */  32, 50, 57, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x2420 */  32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48,
-/* 0x2430 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2440 */  48, 48, 48, 48, 48, 49, 54, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2450 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2460 */  76, 89, 10, 32, 51, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32,
-/* 0x2470 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48,
-/* 0x2480 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2490 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 53, 32, 32, 50, 42, 42,
-/* 0x24a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x24b0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 49,
-/* 0x24c0 */  32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x24d0 */  48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24e0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x24f0 */  48, 48, 49, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2500 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2510 */  65, 68, 79, 78, 76, 89, 10, 32, 51, 50, 32, 78, 50, 68, 68, 69,
-/* 0x2520 */  67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53,
-/* 0x2530 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2540 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 57, 49, 32,
-/* 0x2550 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2560 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2570 */  10, 32, 51, 51, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 32, 32,
-/* 0x2580 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48,
-/* 0x2590 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x25a0 */  32, 48, 48, 48, 48, 48, 49,101, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x25b0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x25c0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32, 78,
-/* 0x25d0 */  50, 68, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x25e0 */  48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x25f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2600 */  49,102, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2610 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2620 */  79, 78, 76, 89, 10, 32, 51, 53, 32, 78, 50, 68, 83, 77, 65, 53,
-/* 0x2630 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x2640 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2650 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102,102, 32, 32, 50,
-/* 0x2660 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2670 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 54, 32, 78, 50, 68, 70,
-/* 0x2680 */  65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2690 */  48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x26a0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 48, 49,
-/* 0x26b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x26c0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 55, 32, 78,
-/* 0x26d0 */  50, 68, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x26e0 */  48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x26f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2700 */  50, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2710 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x2720 */  56, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2730 */  48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2740 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2750 */  48, 48, 48, 50, 48,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2760 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2770 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 57, 32, 78, 50, 68, 70,
-/* 0x2780 */  65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2790 */  49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x27a0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 57,
-/* 0x27b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x27c0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x27d0 */  89, 10, 32, 52, 48, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 32,
-/* 0x27e0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48,
-/* 0x27f0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2800 */  32, 32, 48, 48, 48, 48, 48, 50, 51, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2810 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2820 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49, 32,
-/* 0x2830 */  78, 50, 68, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2840 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2850 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2860 */  48, 50, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2870 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2880 */  52, 50, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32,
-/* 0x2890 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x28a0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x28b0 */  48, 48, 48, 48, 50, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x28c0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x28d0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 51, 32, 78, 50, 69,
-/* 0x28e0 */  70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x28f0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2900 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 52,
-/* 0x2910 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2920 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2930 */  76, 89, 10, 32, 52, 52, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32,
-/* 0x2940 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x2950 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2960 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 52,100, 32, 32, 50, 42, 42,
-/* 0x2970 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2980 */  68, 79, 78, 76, 89, 10, 32, 52, 53, 32, 78, 50, 69, 68, 69, 67,
-/* 0x2990 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98,
-/* 0x29a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x29b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 51, 32, 32,
-/* 0x29c0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x29d0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 78, 50, 69,
-/* 0x29e0 */  83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x29f0 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2a00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53,
-/* 0x2a10 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2a20 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2a30 */  76, 89, 10, 32, 52, 55, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32,
-/* 0x2a40 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48,
-/* 0x2a50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a60 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 54, 51, 32, 32, 50, 42, 42,
-/* 0x2a70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2a80 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 56,
-/* 0x2a90 */  32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2aa0 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ab0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2ac0 */  48, 48, 50, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2ad0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2ae0 */  32, 52, 57, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 32, 32, 32,
-/* 0x2af0 */  32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48,
-/* 0x2b00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2b10 */  48, 48, 48, 48, 48, 50, 55, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2b20 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2b30 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 48, 32, 78, 50,
-/* 0x2b40 */  69, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2b50 */  48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2b60 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2b70 */  56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b80 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2b90 */  78, 76, 89, 10, 32, 53, 49, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x2ba0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53,102, 32, 32,
-/* 0x2bb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2bc0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 57, 53, 32, 32, 50, 42,
-/* 0x2bd0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2be0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53,
-/* 0x2bf0 */  50, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2c00 */  48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2c10 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2c20 */  48, 48, 48, 50,102, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2c30 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2c40 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 51, 32, 78, 50, 69, 70,
-/* 0x2c50 */  65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2c60 */  48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2c70 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48, 49,
-/* 0x2c80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2c90 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2ca0 */  89, 10, 32, 53, 52, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32,
-/* 0x2cb0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x2cc0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cd0 */  32, 32, 48, 48, 48, 48, 48, 51, 49, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2ce0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2cf0 */  79, 78, 76, 89, 10, 32, 53, 53, 32, 78, 50, 69, 70, 65, 83, 53,
-/* 0x2d00 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x2d10 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d20 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 50, 32, 32, 50,
-/* 0x2d30 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2d40 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 54, 32, 78, 50, 69, 68,
-/* 0x2d50 */  69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2d60 */  48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2d70 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 53,
-/* 0x2d80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2d90 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 55, 32, 78,
-/* 0x2da0 */  50, 69, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2db0 */  48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2dc0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2dd0 */  51, 49,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2de0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2df0 */  79, 78, 76, 89, 10, 32, 53, 56, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x2e00 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32,
-/* 0x2e10 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e20 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 50, 97, 32, 32, 50,
-/* 0x2e30 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2e40 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2e50 */  53, 57, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32,
-/* 0x2e60 */  32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e70 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2e80 */  48, 48, 48, 48, 51, 52, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2e90 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2ea0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 48, 32, 78, 50, 69,
-/* 0x2eb0 */  68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2ec0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2ed0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 53,
-/* 0x2ee0 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2ef0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 49, 32,
-/* 0x2f00 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 48,
-/* 0x2f10 */  48, 48, 48, 48, 50,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f20 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2f30 */  48, 51, 53, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2f40 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2f50 */  68, 79, 78, 76, 89, 10, 32, 54, 50, 32, 76, 90, 77, 65, 95, 69,
-/* 0x2f60 */  76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56,
-/* 0x2f70 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2f80 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 56, 55, 32, 32,
-/* 0x2f90 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2fa0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 51, 32, 76, 90, 77,
-/* 0x2fb0 */  65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2fc0 */  97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2fd0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 99,
-/* 0x2fe0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2ff0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 52, 32,
-/* 0x3000 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48,
-/* 0x3010 */  48, 48, 48, 97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3020 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3030 */  48,101, 53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3040 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3050 */  54, 53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x3060 */  32, 48, 48, 48, 48, 48, 48, 49, 97, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3070 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3080 */  48, 48, 48, 49, 56,100, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3090 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x30a0 */  89, 10, 32, 54, 54, 32, 76, 90, 77, 65, 95, 68, 79, 78, 69, 95,
-/* 0x30b0 */  83, 84, 65, 67, 75, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x30c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x30d0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 56,102, 53, 32, 32, 50, 42,
-/* 0x30e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x30f0 */  65, 68, 79, 78, 76, 89, 10, 32, 54, 55, 32, 68, 74, 50, 66, 83,
-/* 0x3100 */  83, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3110 */  55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3120 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,102, 97, 32,
-/* 0x3130 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3140 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3150 */  10, 32, 54, 56, 32, 68, 74, 67, 65, 76, 76, 84, 50, 32, 32, 32,
-/* 0x3160 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48,
-/* 0x3170 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3180 */  32, 48, 48, 48, 48, 49, 57, 48, 49, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3190 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x31a0 */  78, 76, 89, 10, 32, 54, 57, 32, 67, 65, 76, 76, 84, 82, 48, 48,
-/* 0x31b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32,
-/* 0x31c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x31d0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48, 50, 32, 32, 50, 42,
-/* 0x31e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x31f0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55,
-/* 0x3200 */  48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32,
-/* 0x3210 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3220 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3230 */  48, 48, 49, 57, 49, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3240 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3250 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 49, 32, 67, 65, 76, 76,
-/* 0x3260 */  84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3270 */  48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3280 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 49, 53,
-/* 0x3290 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x32a0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 50, 32, 67,
-/* 0x32b0 */  84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x32c0 */  48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x32d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x32e0 */  57, 49, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x32f0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55,
-/* 0x3300 */  51, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32, 32,
-/* 0x3310 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3320 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3330 */  48, 48, 49, 57, 49,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3340 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3350 */  10, 32, 55, 52, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32,
-/* 0x3360 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x3370 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3380 */  32, 48, 48, 48, 48, 49, 57, 50, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3390 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x33a0 */  78, 76, 89, 10, 32, 55, 53, 32, 67, 65, 76, 76, 84, 82, 48, 50,
-/* 0x33b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32,
-/* 0x33c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x33d0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50, 53, 32, 32, 50, 42,
-/* 0x33e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x33f0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55,
-/* 0x3400 */  54, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3410 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3420 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3430 */  48, 48, 49, 57, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3440 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3450 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 55, 32, 67, 65, 76, 76,
-/* 0x3460 */  84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3470 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3480 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51, 56,
-/* 0x3490 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x34a0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 56, 32, 67,
-/* 0x34b0 */  65, 76, 76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x34c0 */  48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x34d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x34e0 */  57, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x34f0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55,
-/* 0x3500 */  57, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x3510 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3520 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3530 */  48, 48, 49, 57, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3540 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3550 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 48, 32, 67, 84, 67, 76,
-/* 0x3560 */  69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3570 */  48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3580 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 52, 48,
-/* 0x3590 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x35a0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x35b0 */  89, 10, 32, 56, 49, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32,
-/* 0x35c0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x35d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35e0 */  32, 32, 48, 48, 48, 48, 49, 57, 52, 53, 32, 32, 50, 42, 42, 48,
-/* 0x35f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x3600 */  79, 78, 76, 89, 10, 32, 56, 50, 32, 67, 84, 66, 83, 72, 82, 49,
-/* 0x3610 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x3620 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3630 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 52, 55, 32, 32, 50,
-/* 0x3640 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x3650 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 51, 32, 67, 84, 66, 82,
-/* 0x3660 */  79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3670 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3680 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 52, 98,
-/* 0x3690 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x36a0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 52, 32, 67,
-/* 0x36b0 */  84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x36c0 */  48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x36d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x36e0 */  57, 52,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x36f0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56,
-/* 0x3700 */  53, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 32, 32, 32, 32, 32,
-/* 0x3710 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3720 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3730 */  48, 48, 49, 57, 53, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3740 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3750 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 54, 32, 99,116,111,107,
-/* 0x3760 */  51, 50, 46, 48, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3770 */  48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3780 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 55,
-/* 0x3790 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x37a0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x37b0 */  89, 10, 32, 56, 55, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32,
-/* 0x37c0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48,
-/* 0x37d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37e0 */  32, 32, 48, 48, 48, 48, 49, 57, 54, 49, 32, 32, 50, 42, 42, 48,
-/* 0x37f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3800 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 56, 32,
-/* 0x3810 */  99,116,111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3820 */  48, 48, 48, 48, 49,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3830 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3840 */  49, 57, 54,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3850 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3860 */  68, 79, 78, 76, 89, 10, 32, 56, 57, 32, 99,116,111,107, 51, 50,
-/* 0x3870 */  46, 51, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97,
-/* 0x3880 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3890 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 56,100, 32, 32,
-/* 0x38a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x38b0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x38c0 */  32, 57, 48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 32, 32,
-/* 0x38d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x38e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x38f0 */  48, 48, 48, 48, 49, 57, 57, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3900 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3910 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 49, 32, 68, 74,
-/* 0x3920 */  82, 69, 84, 85, 82, 78, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3930 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3940 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3950 */  57, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3960 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3970 */  78, 76, 89, 10, 32, 57, 50, 32, 85, 80, 88, 49, 72, 69, 65, 68,
-/* 0x3980 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 48, 32, 32,
-/* 0x3990 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x39a0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 97, 49, 32, 32, 50, 42,
-/* 0x39b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x39c0 */  65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x39d0 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x39e0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48,  9, 48,
-/* 0x39f0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x3a00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3a10 */  32, 32, 78, 50, 66, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x3a20 */  48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 48, 48, 48,
-/* 0x3a30 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3a40 */  66, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3a50 */  78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a60 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x3a70 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68,
-/* 0x3a80 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3a90 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,  9, 48,
-/* 0x3aa0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x3ab0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3ac0 */  32, 32, 78, 50, 66, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x3ad0 */  48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48,
-/* 0x3ae0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3af0 */  66, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3b00 */  78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b10 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x3b20 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68,
-/* 0x3b30 */  69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3b40 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48,  9, 48,
-/* 0x3b50 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 49, 48,
-/* 0x3b60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3b70 */  32, 32, 78, 50, 68, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x3b80 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48,
-/* 0x3b90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3ba0 */  68, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3bb0 */  78, 50, 68, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bc0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x3bd0 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68,
-/* 0x3be0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3bf0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,  9, 48,
-/* 0x3c00 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x3c10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3c20 */  32, 32, 78, 50, 68, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x3c30 */  48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48,
-/* 0x3c40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3c50 */  68, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3c60 */  78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x3c80 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68,
-/* 0x3c90 */  69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3ca0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48,  9, 48,
-/* 0x3cb0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x3cc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3cd0 */  32, 32, 78, 50, 69, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x3ce0 */  48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 48, 48, 48,
-/* 0x3cf0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3d00 */  69, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3d10 */  78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d20 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x3d30 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68,
-/* 0x3d40 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3d50 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,  9, 48,
-/* 0x3d60 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x3d70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3d80 */  32, 32, 78, 50, 69, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x3d90 */  48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48,
-/* 0x3da0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3db0 */  69, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3dc0 */  78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3dd0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x3de0 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68,
-/* 0x3df0 */  69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3e00 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48,  9, 48,
-/* 0x3e10 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48,
-/* 0x3e20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3e30 */  32, 32, 67, 65, 76, 76, 84, 82, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x3e40 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48,
-/* 0x3e50 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x3e60 */  76, 76, 84, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3e70 */  67, 65, 76, 76, 84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3e90 */  49, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x3ea0 */  84, 82, 49, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3eb0 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,  9,
-/* 0x3ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46,
-/* 0x3ed0 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3ee0 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9, 48, 48,
-/* 0x3ef0 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x3f00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3f10 */  32, 32, 99,116,111,107, 51, 50, 46, 50, 48,  9, 48, 48, 48, 48,
-/* 0x3f20 */  48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48,
-/* 0x3f30 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3f40 */  99,116,111,107, 51, 50, 46, 52, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48,
-/* 0x3f60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 68, 74,
-/* 0x3f70 */  50, 77, 65, 73, 78, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3f80 */  68, 74, 50, 77, 65, 73, 78, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 68, 74, 67, 65, 76, 76,
-/* 0x3fa0 */  84, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 68, 74, 67, 65,
-/* 0x3fb0 */  76, 76, 84, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3fc0 */  32, 32, 32,100, 32, 32, 68, 74, 50, 77, 65, 73, 78, 50,  9, 48,
-/* 0x3fd0 */  48, 48, 48, 48, 48, 48, 48, 32, 68, 74, 50, 77, 65, 73, 78, 50,
-/* 0x3fe0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3ff0 */  32, 32, 76, 90, 77, 65, 95, 73, 78, 73, 84, 95, 83, 84, 65, 67,
-/* 0x4000 */  75,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x4010 */  73, 78, 73, 84, 95, 83, 84, 65, 67, 75, 10, 48, 48, 48, 48, 48,
-/* 0x4020 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x4030 */  65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4040 */  66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4050 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48,
-/* 0x4060 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4070 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4080 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48,  9, 48, 48, 48,
-/* 0x4090 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48,
-/* 0x40a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x40b0 */  78, 50, 66, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40c0 */  48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x40d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x40e0 */  65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x40f0 */  66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4100 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x4110 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4120 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4130 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48,  9, 48, 48, 48,
-/* 0x4140 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10, 48,
-/* 0x4150 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4160 */  78, 50, 66, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4170 */  48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4180 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x4190 */  65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x41a0 */  66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x41b0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48,
-/* 0x41c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x41d0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x41e0 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48,  9, 48, 48, 48,
-/* 0x41f0 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48,
-/* 0x4200 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4210 */  78, 50, 68, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4220 */  48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4230 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x4240 */  77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4250 */  68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4260 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48,
-/* 0x4270 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4280 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4290 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48,  9, 48, 48, 48,
-/* 0x42a0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48,
-/* 0x42b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x42c0 */  78, 50, 68, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42d0 */  48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x42e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x42f0 */  77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4300 */  68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4310 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48,
-/* 0x4320 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4330 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4340 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48,  9, 48, 48, 48,
-/* 0x4350 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48,
-/* 0x4360 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4370 */  78, 50, 68, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4380 */  48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4390 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x43a0 */  77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x43b0 */  68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x43c0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48,
-/* 0x43d0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x43e0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x43f0 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48,  9, 48, 48, 48,
-/* 0x4400 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10, 48,
-/* 0x4410 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4420 */  78, 50, 69, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4430 */  48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4440 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x4450 */  65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4460 */  69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4470 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48,
-/* 0x4480 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x4490 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x44a0 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48,  9, 48, 48, 48,
-/* 0x44b0 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48,
-/* 0x44c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x44d0 */  78, 50, 69, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44e0 */  48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x44f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x4500 */  65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4510 */  69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4520 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48,
-/* 0x4530 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x4540 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4550 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48,  9, 48, 48, 48,
-/* 0x4560 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48,
-/* 0x4570 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4580 */  78, 50, 69, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4590 */  48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x45a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x45b0 */  65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x45c0 */  69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x45d0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x45e0 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x45f0 */  95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4600 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x4610 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x4620 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4630 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x4640 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x4650 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4660 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x4670 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x4680 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4690 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x46a0 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x46b0 */  95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x46c0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 79, 78,
-/* 0x46d0 */  69, 95, 83, 84, 65, 67, 75,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x46e0 */  32, 76, 90, 77, 65, 95, 68, 79, 78, 69, 95, 83, 84, 65, 67, 75,
-/* 0x46f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4700 */  32, 32, 68, 74, 50, 66, 83, 83, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4710 */  48, 48, 48, 32, 68, 74, 50, 66, 83, 83, 48, 48, 10, 48, 48, 48,
-/* 0x4720 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 68, 74,
-/* 0x4730 */  67, 65, 76, 76, 84, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4740 */  68, 74, 67, 65, 76, 76, 84, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4750 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86,
-/* 0x4760 */  69, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 67, 76,
-/* 0x4770 */  69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4780 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49,  9, 48,
-/* 0x4790 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 49,
-/* 0x47a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x47b0 */  32, 32, 67, 84, 66, 83, 72, 82, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x47c0 */  48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48,
-/* 0x47d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x47e0 */  66, 82, 79, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x47f0 */  67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4800 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65,
-/* 0x4810 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83,
-/* 0x4820 */  87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4830 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50,  9, 48,
-/* 0x4840 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 50,
-/* 0x4850 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4860 */  32, 32, 67, 65, 76, 76, 84, 82, 69, 56,  9, 48, 48, 48, 48, 48,
-/* 0x4870 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10, 48, 48, 48,
-/* 0x4880 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x4890 */  76, 76, 84, 82, 69, 57,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x48a0 */  67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86,
-/* 0x48c0 */  69, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 67, 76,
-/* 0x48d0 */  69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x48e0 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 50,  9, 48,
-/* 0x48f0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50,
-/* 0x4900 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4910 */  32, 32, 67, 84, 66, 83, 72, 82, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x4920 */  48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49, 10, 48, 48, 48,
-/* 0x4930 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x4940 */  66, 82, 79, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4950 */  67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4960 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65,
-/* 0x4970 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83,
-/* 0x4980 */  87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4990 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51, 48,  9,
-/* 0x49a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46,
-/* 0x49b0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x49c0 */  32,100, 32, 32, 68, 74, 82, 69, 84, 85, 82, 78,  9, 48, 48, 48,
-/* 0x49d0 */  48, 48, 48, 48, 48, 32, 68, 74, 82, 69, 84, 85, 82, 78, 10, 48,
-/* 0x49e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x49f0 */  85, 80, 88, 49, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a00 */  48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48,
-/* 0x4a10 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x4a20 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116, 97,114,116,
-/* 0x4a30 */  95,111,102, 95, 99,111,109,112,114,101,115,115,101,100, 10, 48,
-/* 0x4a40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a50 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,
-/* 0x4a60 */ 116, 97,114,116, 95,111,102, 95,117,110, 99,111,109,112,114,101,
-/* 0x4a70 */ 115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x4a80 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x4a90 */  48, 48, 48, 48, 32,115,116, 97, 99,107, 95,102,111,114, 95,108,
-/* 0x4aa0 */ 122,109, 97, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x4ab0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x4ac0 */  48, 48, 48, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,
-/* 0x4ad0 */ 100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4ae0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x4af0 */  48, 48, 48, 48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110,
-/* 0x4b00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b10 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b20 */  32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x4b30 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x4b40 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97,
-/* 0x4b50 */  95,112,114,111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48,
-/* 0x4b60 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x4b70 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,101,110,103,
-/* 0x4b80 */ 116,104, 95,111,102, 95, 98,115,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4b90 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x4ba0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114,
-/* 0x4bb0 */  95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4bc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x4bd0 */  48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114, 95, 99,
-/* 0x4be0 */ 116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4bf0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4c00 */  48, 48, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,
-/* 0x4c10 */ 121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4c20 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 68, 74, 50, 77, 65,
-/* 0x4c30 */  73, 78, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4c40 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c50 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x4c60 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c70 */  32, 32,115,116, 97,114,116, 95,111,102, 95, 99,111,109,112,114,
-/* 0x4c80 */ 101,115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82,
-/* 0x4c90 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ca0 */  32,115,116, 97,114,116, 95,111,102, 95,117,110, 99,111,109,112,
-/* 0x4cb0 */ 114,101,115,115,101,100, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4cc0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4cd0 */  76, 90, 77, 65, 95, 73, 78, 73, 84, 95, 83, 84, 65, 67, 75, 93,
-/* 0x4ce0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4cf0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4d00 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56,
-/* 0x4d10 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,115,116,
-/* 0x4d20 */  97, 99,107, 95,102,111,114, 95,108,122,109, 97, 10, 10, 82, 69,
-/* 0x4d30 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4d40 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58,
-/* 0x4d50 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4d60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4d70 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x4d80 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x4d90 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4da0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x4db0 */  50, 66, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4dc0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4dd0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4de0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4df0 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x4e00 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4e10 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48,
-/* 0x4e20 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4e30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4e40 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x4e50 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4e60 */  50, 66, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4e70 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4e80 */  91, 78, 50, 66, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4e90 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ea0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4eb0 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4ec0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49,
-/* 0x4ed0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4ee0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65,
-/* 0x4ef0 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4f00 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f10 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82,
-/* 0x4f20 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f30 */  32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4f40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4f50 */  82, 32, 91, 78, 50, 66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70,
-/* 0x4f60 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4f80 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4f90 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x4fa0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56,
-/* 0x4fb0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4fc0 */  66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4fd0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4fe0 */  78, 50, 66, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4ff0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5000 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5010 */  48, 48, 49, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5020 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10,
-/* 0x5030 */  48, 48, 48, 48, 48, 48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5040 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x5050 */  67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5060 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x5070 */  83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5080 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5090 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50a0 */  99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x50b0 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x50c0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x50d0 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58,
-/* 0x50e0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x50f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5100 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x5110 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5120 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x5130 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5140 */  32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5150 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5160 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70,
-/* 0x5170 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5180 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5190 */  48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x51a0 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x51b0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x51c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x51d0 */  65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x51e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x51f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97,
-/* 0x5200 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5210 */  32, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48,
-/* 0x5220 */  48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x5230 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10,
-/* 0x5240 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5250 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54,
-/* 0x5260 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5270 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5280 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95,
-/* 0x5290 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x52a0 */  78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x52b0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x52c0 */  32, 91, 78, 50, 68, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x52d0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x52e0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x52f0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5300 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x5310 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5320 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65,
-/* 0x5330 */  83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5340 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5350 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x5360 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5370 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5380 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5390 */  79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79,
-/* 0x53a0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x53b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x53c0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x53d0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77,
-/* 0x53e0 */  65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x53f0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x5400 */  70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5410 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5420 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5430 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5440 */  32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69,
-/* 0x5450 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5460 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58,
-/* 0x5470 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5480 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5490 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x54a0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x54b0 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x54c0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x54d0 */  50, 68, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x54e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x54f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5500 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5510 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48,
-/* 0x5520 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5530 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5540 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5550 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68,
-/* 0x5560 */  69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5570 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5580 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102,
-/* 0x5590 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x55a0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x55b0 */  48, 48, 50, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x55c0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10,
-/* 0x55d0 */  48, 48, 48, 48, 48, 48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x55e0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x55f0 */  67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5600 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x5610 */  83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5620 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5630 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5640 */  99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5650 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x5660 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5670 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58,
-/* 0x5680 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5690 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x56a0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x56b0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x56c0 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x56d0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x56e0 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x56f0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5700 */  82, 32, 91, 78, 50, 68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70,
-/* 0x5710 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5720 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5730 */  48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5740 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5750 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5760 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x5770 */  65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5780 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5790 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97,
-/* 0x57a0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x57b0 */  32, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48,
-/* 0x57c0 */  48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x57d0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10,
-/* 0x57e0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x57f0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54,
-/* 0x5800 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5810 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5820 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95,
-/* 0x5830 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5840 */  78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5850 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5860 */  32, 91, 78, 50, 69, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5870 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5880 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5890 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x58a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x58b0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x58c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65,
-/* 0x58d0 */  83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x58e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x58f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x5900 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5910 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5920 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5930 */  79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79,
-/* 0x5940 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5960 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5970 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77,
-/* 0x5980 */  65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5990 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x59a0 */  70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x59b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59d0 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x59e0 */  32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69,
-/* 0x59f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5a00 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58,
-/* 0x5a10 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5a20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5a30 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x5a40 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x5a50 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5a60 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5a70 */  50, 69, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5a80 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a90 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5aa0 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5ab0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48,
-/* 0x5ac0 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5ad0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x5ae0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5af0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68,
-/* 0x5b00 */  69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5b10 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b20 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102,
-/* 0x5b30 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5b40 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5b50 */  48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5b60 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10,
-/* 0x5b70 */  48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5b80 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x5b90 */  67, 54, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5ba0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x5bb0 */  83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5bc0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bd0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5be0 */  99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5bf0 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x5c00 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5c10 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58,
-/* 0x5c20 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5c30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5c40 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x5c50 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x5c60 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x5c70 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c80 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5c90 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5ca0 */  82, 32, 91, 78, 50, 69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70,
-/* 0x5cb0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5cc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5cd0 */  48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5ce0 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x5cf0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5d00 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x5d10 */  65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5d20 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d30 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97,
-/* 0x5d40 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5d50 */  32, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48,
-/* 0x5d60 */  48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x5d70 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10,
-/* 0x5d80 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5d90 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54,
-/* 0x5da0 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5db0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5dc0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95,
-/* 0x5dd0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5de0 */  78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5df0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5e00 */  32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79,
-/* 0x5e10 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5e20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5e30 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x5e40 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x5e50 */ 115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48,
-/* 0x5e60 */  48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x5e70 */  32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,
-/* 0x5e80 */ 101,110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56,
-/* 0x5e90 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x5ea0 */ 109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x5eb0 */  97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x5ec0 */  32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,
-/* 0x5ed0 */ 105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5ee0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 68, 74, 50,
-/* 0x5ef0 */  66, 83, 83, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5f00 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f10 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5f20 */  49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x5f30 */  32, 32, 32, 32,108,101,110,103,116,104, 95,111,102, 95, 98,115,
-/* 0x5f40 */ 115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5f50 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84,
-/* 0x5f60 */  82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5f70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x5f90 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fa0 */  32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10,
-/* 0x5fb0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5fc0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69,
-/* 0x5fd0 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5fe0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5ff0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95,
-/* 0x6000 */  51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6010 */ 102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48,
-/* 0x6020 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6030 */  32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10,
-/* 0x6040 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6050 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 50,
-/* 0x6060 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6070 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6080 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51,
-/* 0x6090 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x60a0 */  65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x60b0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x60c0 */  91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x60d0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x60e0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x60f0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x6100 */  32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,
-/* 0x6110 */ 101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6120 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x6130 */  65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6140 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6150 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6160 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6170 */  32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 10,
-/* 0x6180 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6190 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 50,
-/* 0x61a0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x61b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x61c0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x61d0 */  56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x61e0 */ 105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48,
-/* 0x61f0 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6200 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 10, 82,
-/* 0x6210 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6220 */  83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 51, 93,
-/* 0x6230 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6240 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6250 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56,
-/* 0x6260 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65,
-/* 0x6270 */  76, 76, 84, 82, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6280 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6290 */  99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x62a0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x62c0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x62d0 */  32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,
-/* 0x62e0 */ 101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82,
-/* 0x62f0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6300 */  32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6310 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6320 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48, 93, 58, 10,
-/* 0x6330 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6340 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6350 */  10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6360 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x6370 */  51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6380 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x6390 */ 116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x63a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x63c0 */  48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x63d0 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x63e0 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x63f0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x6400 */  51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x6410 */  95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6420 */  32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48,
-/* 0x6430 */  48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6440 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x6450 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6460 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50,
-/* 0x6470 */  46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6480 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6490 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x64a0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64b0 */  32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48,
-/* 0x64c0 */  48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x64d0 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x64e0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x64f0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50,
-/* 0x6500 */  46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6510 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6520 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x6530 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6540 */  32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76,
-/* 0x6550 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6560 */  70, 79, 82, 32, 91, 68, 74, 82, 69, 84, 85, 82, 78, 93, 58, 10,
-/* 0x6570 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6590 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x65a0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,
-/* 0x65b0 */ 105,110, 97,108, 95,101,110,116,114,121, 10
+/* 0x19c0 */  45, 93,  0,  0,  0,104,  0,  0,  0, 78,  0,  0,  0,176, 19,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0, 52,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  9,  0,  0,  0, 64,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */   0, 18,  0,  0,  0, 65,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0, 27,  0,  0,  0, 68,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0, 43,  0,  0,  0, 84,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   0, 52,  0,  0,  0, 87,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0, 61,  0,  0,  0, 89,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0, 70,  0,  0,  0, 95,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */   0, 79,  0,  0,  0,106,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0, 88,  0,  0,  0,111,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0, 97,  0,  0,  0,120,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,106,  0,  0,  0,133,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,115,  0,  0,  0,146,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,124,  0,  0,  0,161,  0,  0,  0, 62,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   0,133,  0,  0,  0,223,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,142,  0,  0,  0,236,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,151,  0,  0,  0,251,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   0,160,  0,  0,  0,253,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   0,169,  0,  0,  0,  0,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */   0,178,  0,  0,  0,  9,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */   0,187,  0,  0,  0, 21,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,196,  0,  0,  0, 46,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */   0,205,  0,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */   0,214,  0,  0,  0, 68,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   0,223,  0,  0,  0, 71,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */   0,232,  0,  0,  0, 73,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,241,  0,  0,  0, 79,  1,  0,  0, 11,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0,250,  0,  0,  0, 90,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0,  3,  1,  0,  0, 95,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   0, 12,  1,  0,  0,104,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0, 21,  1,  0,  0,117,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0, 30,  1,  0,  0,130,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   0, 39,  1,  0,  0,145,  1,  0,  0, 82,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   0, 48,  1,  0,  0,227,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0, 57,  1,  0,  0,240,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */   0, 66,  1,  0,  0,255,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0, 75,  1,  0,  0,  1,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */   0, 84,  1,  0,  0,  4,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   0, 93,  1,  0,  0, 13,  2,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,102,  1,  0,  0, 25,  2,  0,  0, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */   0,111,  1,  0,  0, 50,  2,  0,  0, 22,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */   0,120,  1,  0,  0, 72,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,129,  1,  0,  0, 72,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,138,  1,  0,  0, 75,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */   0,147,  1,  0,  0, 77,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,156,  1,  0,  0, 83,  2,  0,  0, 11,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */   0,165,  1,  0,  0, 94,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   0,174,  1,  0,  0, 99,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,183,  1,  0,  0,108,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,192,  1,  0,  0,121,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   0,201,  1,  0,  0,134,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,210,  1,  0,  0,149,  2,  0,  0, 95,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,219,  1,  0,  0,244,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */   0,228,  1,  0,  0,  1,  3,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,237,  1,  0,  0, 16,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0,246,  1,  0,  0, 18,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */   0,255,  1,  0,  0, 21,  3,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0,  8,  2,  0,  0, 30,  3,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0, 17,  2,  0,  0, 42,  3,  0,  0, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */   0, 26,  2,  0,  0, 67,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0, 35,  2,  0,  0, 89,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0, 44,  2,  0,  0, 89,  3,  0,  0, 46,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */   0, 55,  2,  0,  0,135,  3,  0,  0, 72,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0, 66,  2,  0,  0,207,  3,  0,  0,134, 10,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0, 77,  2,  0,  0, 85, 14,  0,  0,134, 10,  0,  0,  0,  0,  0,
+/* 0x1de0 */   0, 88,  2,  0,  0,219, 24,  0,  0, 26,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0, 99,  2,  0,  0,245, 24,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,115,  2,  0,  0,250, 24,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */   0,124,  2,  0,  0,  1, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,133,  2,  0,  0,  2, 25,  0,  0, 14,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,142,  2,  0,  0, 16, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */   0,151,  2,  0,  0, 21, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,160,  2,  0,  0, 26, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,169,  2,  0,  0, 30, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,178,  2,  0,  0, 32, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,187,  2,  0,  0, 37, 25,  0,  0, 14,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,196,  2,  0,  0, 51, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,205,  2,  0,  0, 56, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,214,  2,  0,  0, 58, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,223,  2,  0,  0, 60, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,232,  2,  0,  0, 64, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,241,  2,  0,  0, 69, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,250,  2,  0,  0, 71, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0,  3,  3,  0,  0, 75, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0, 12,  3,  0,  0, 77, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0, 21,  3,  0,  0, 82, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0, 30,  3,  0,  0, 87, 25,  0,  0, 10,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0, 40,  3,  0,  0, 97, 25,  0,  0, 14,  0,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0, 50,  3,  0,  0,111, 25,  0,  0, 30,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0, 60,  3,  0,  0,141, 25,  0,  0, 10,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0, 70,  3,  0,  0,151, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0, 80,  3,  0,  0,156, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0, 89,  3,  0,  0,161, 25,  0,  0, 32,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0, 43,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0, 61,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0, 70,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0, 97,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,124,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   0,169,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   0,196,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,205,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,214,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   0,232,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */   0,241,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */   0, 12,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */   0, 39,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2070 */   0, 84,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,111,  1,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,120,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,129,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,147,  1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0,156,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0,183,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0,210,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0,255,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */   0, 26,  2,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */   0, 35,  2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   0,133,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */   0,196,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   0,223,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */   0, 21,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */   0, 30,  3,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   0, 40,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */   0, 50,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2190 */   0, 70,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */   0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */   0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */   0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */   0, 52,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0, 79,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2200 */   0, 88,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,106,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,115,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2230 */   0,133,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */   0,142,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,151,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2260 */   0,160,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2270 */   0,178,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2280 */   0,187,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2290 */   0,223,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */   0,250,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0,  3,  1,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0, 21,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22d0 */   0, 30,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0, 48,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22f0 */   0, 57,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2300 */   0, 66,  1,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */   0, 75,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2320 */   0, 93,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2330 */   0,102,  1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,138,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2350 */   0,165,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2360 */   0,174,  1,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,192,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2380 */   0,201,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2390 */   0,219,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,228,  1,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23b0 */   0,237,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */   0,246,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,  8,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23e0 */   0, 17,  2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23f0 */   0, 44,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */   0, 55,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2410 */   0, 66,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2420 */   0, 77,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */   0, 88,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2440 */   0, 99,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2450 */   0,115,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */   0,124,  2,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2470 */   0,142,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2480 */   0,151,  2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */   0,160,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24a0 */   0,169,  2,  0,  0, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24b0 */   0,178,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0,187,  2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24d0 */   0,205,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24e0 */   0,214,  2,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,232,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2500 */   0,241,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2510 */   0,250,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2520 */   0,  3,  3,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */   0, 12,  3,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2540 */   0, 60,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2550 */   0, 80,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2560 */   0, 89,  3,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */   0, 98,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x2580 */   0,118,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x2590 */   0,140,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x25a0 */   0,155,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x25b0 */   0,173,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x25c0 */   0,184,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x25d0 */   0,195,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x25e0 */   0,211,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x25f0 */   0,225,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x2600 */   0,239,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x2610 */   0,250,  3,  0,  0, 94,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x2620 */   0,  0,  0,  0,  0,  3,  0,  0,  0,  9,  4,  0,  0, 93,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,
+/* 0x2640 */   0,  9,  4,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   0,  3,  0,  0,  0, 12,  0,  0,  0,  9,  4,  0,  0, 95,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,
+/* 0x2670 */   0, 18,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */   0,  5,  0,  0,  0,  1,  0,  0,  0, 18,  4,  0,  0,  2,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  1,  0,  0,
+/* 0x26a0 */   0, 18,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   0,  9,  0,  0,  0,  3,  0,  0,  0, 18,  4,  0,  0,  1,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 12,  0,  0,
+/* 0x26d0 */   0, 18,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   0, 12,  0,  0,  0,  3,  0,  0,  0, 18,  4,  0,  0,  3,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 14,  0,  0,
+/* 0x2700 */   0, 18,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   0, 13,  0,  0,  0, 17,  0,  0,  0, 18,  4,  0,  0,  7,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 47,  0,  0,
+/* 0x2730 */   0, 18,  4,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   0, 14,  0,  0,  0, 12,  0,  0,  0, 18,  4,  0,  0,  4,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  3,  0,  0,
+/* 0x2760 */   0, 18,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   0, 15,  0,  0,  0, 14,  0,  0,  0, 18,  4,  0,  0,  4,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  8,  0,  0,
+/* 0x2790 */   0, 28,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */   0, 20,  0,  0,  0, 10,  0,  0,  0, 18,  4,  0,  0,  6,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0, 21,  0,  0,
+/* 0x27c0 */   0, 28,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */   0, 21,  0,  0,  0, 18,  0,  0,  0, 28,  4,  0,  0,  2,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,  1,  0,  0,
+/* 0x27f0 */   0, 18,  4,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */   0, 24,  0,  0,  0,  1,  0,  0,  0, 18,  4,  0,  0, 10,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  1,  0,  0,
+/* 0x2820 */   0, 18,  4,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */   0, 28,  0,  0,  0,  3,  0,  0,  0, 18,  4,  0,  0,  9,  0,  0,
+/* 0x2840 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 12,  0,  0,
+/* 0x2850 */   0, 18,  4,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */   0, 31,  0,  0,  0,  5,  0,  0,  0, 18,  4,  0,  0, 12,  0,  0,
+/* 0x2870 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 14,  0,  0,
+/* 0x2880 */   0, 18,  4,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */   0, 32,  0,  0,  0, 15,  0,  0,  0, 18,  4,  0,  0, 11,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 33,  0,  0,
+/* 0x28b0 */   0, 18,  4,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */   0, 32,  0,  0,  0, 67,  0,  0,  0, 18,  4,  0,  0, 13,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 12,  0,  0,
+/* 0x28e0 */   0, 18,  4,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */   0, 34,  0,  0,  0,  3,  0,  0,  0, 18,  4,  0,  0, 12,  0,  0,
+/* 0x2900 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0, 14,  0,  0,
+/* 0x2910 */   0, 18,  4,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */   0, 38,  0,  0,  0,  8,  0,  0,  0, 28,  4,  0,  0, 10,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 10,  0,  0,
+/* 0x2940 */   0, 18,  4,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */   0, 39,  0,  0,  0, 21,  0,  0,  0, 28,  4,  0,  0, 10,  0,  0,
+/* 0x2960 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0, 18,  0,  0,
+/* 0x2970 */   0, 28,  4,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */   0, 42,  0,  0,  0,  1,  0,  0,  0, 18,  4,  0,  0, 18,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0,  1,  0,  0,
+/* 0x29a0 */   0, 18,  4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29b0 */   0, 46,  0,  0,  0,  1,  0,  0,  0, 18,  4,  0,  0, 16,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  3,  0,  0,
+/* 0x29d0 */   0, 18,  4,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29e0 */   0, 49,  0,  0,  0, 12,  0,  0,  0, 18,  4,  0,  0, 20,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,  5,  0,  0,
+/* 0x2a00 */   0, 18,  4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a10 */   0, 50,  0,  0,  0, 14,  0,  0,  0, 18,  4,  0,  0, 20,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0, 15,  0,  0,
+/* 0x2a30 */   0, 18,  4,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a40 */   0, 51,  0,  0,  0, 30,  0,  0,  0, 18,  4,  0,  0, 21,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0, 48,  0,  0,
+/* 0x2a60 */   0, 18,  4,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */   0, 52,  0,  0,  0, 12,  0,  0,  0, 18,  4,  0,  0, 20,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,  3,  0,  0,
+/* 0x2a90 */   0, 18,  4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0, 53,  0,  0,  0, 14,  0,  0,  0, 18,  4,  0,  0, 20,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  8,  0,  0,
+/* 0x2ac0 */   0, 28,  4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0, 58,  0,  0,  0, 10,  0,  0,  0, 18,  4,  0,  0, 22,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0, 21,  0,  0,
+/* 0x2af0 */   0, 28,  4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0, 59,  0,  0,  0, 18,  0,  0,  0, 28,  4,  0,  0, 18,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0,  5,  0,  0,
+/* 0x2b20 */   0,  9,  4,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */   0, 61,  0,  0,  0, 20,  0,  0,  0,  9,  4,  0,  0, 97,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0, 30,  0,  0,
+/* 0x2b50 */   0,  9,  4,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */   0, 61,  0,  0,  0, 42,  0,  0,  0,  9,  4,  0,  0, 99,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  1,  0,  0,
+/* 0x2b80 */   0,  9,  4,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */   0, 69,  0,  0,  0,  1,  0,  0,  0,  9,  4,  0,  0,101,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  2,  0,  0,
+/* 0x2bb0 */   0, 39,  4,  0,  0,102,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */   0, 70,  0,  0,  0,  4,  0,  0,  0, 18,  4,  0,  0, 24,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0, 13,  0,  0,
+/* 0x2be0 */   0, 18,  4,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */   0, 76,  0,  0,  0,  1,  0,  0,  0,  9,  4,  0,  0,101,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,  3,  0,  0,
+/* 0x2c10 */   0, 18,  4,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */   0, 80,  0,  0,  0,  2,  0,  0,  0, 39,  4,  0,  0,102,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  4,  0,  0,
+/* 0x2c40 */   0, 18,  4,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */   0, 85,  0,  0,  0,  4,  0,  0,  0, 18,  4,  0,  0, 25,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,  1,  0,  0,
+/* 0x2c70 */   0,  9,  4,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */   0, 86,  0,  0,  0,  6,  0,  0,  0, 18,  4,  0,  0, 30,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  0,  0,  0, 13,  0,  0,
+/* 0x2ca0 */   0, 18,  4,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cb0 */   0, 88,  0,  0,  0,  5,  0,  0,  0, 18,  4,  0,  0, 31,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,  0,  0, 10,  0,  0,
+/* 0x2cd0 */   0, 18,  4,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ce0 */   0, 88,  0,  0,  0, 14,  0,  0,  0, 39,  4,  0,  0,102,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,  0,  0, 16,  0,  0,
+/* 0x2d00 */   0, 18,  4,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d10 */   0, 89,  0,  0,  0,  4,  0,  0,  0, 18,  4,  0,  0, 31,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  9,  0,  0,
+/* 0x2d30 */   0, 18,  4,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d40 */   0, 90,  0,  0,  0,  4,  0,  0,  0, 18,  4,  0,  0, 28,  0,  0,
+/* 0x2d50 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  1,  0,  0,
+/* 0x2d60 */   0, 28,  4,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d70 */   0, 68, 74, 50, 77, 65, 73, 78, 49,  0, 68, 74, 67, 65, 76, 76,
+/* 0x2d80 */  84, 49,  0, 68, 74, 50, 77, 65, 73, 78, 50,  0, 76, 90, 77, 65,
+/* 0x2d90 */  95, 73, 78, 73, 84, 95, 83, 84, 65, 67, 75,  0, 78, 50, 66, 83,
+/* 0x2da0 */  77, 65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50,
+/* 0x2db0 */  66, 70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0,
+/* 0x2dc0 */  78, 50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50,
+/* 0x2dd0 */  48,  0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77,
+/* 0x2de0 */  65, 51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66,
+/* 0x2df0 */  68, 69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78,
+/* 0x2e00 */  50, 66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,
+/* 0x2e10 */   0, 78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67,
+/* 0x2e20 */  53, 48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70,
+/* 0x2e30 */  65, 83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50,
+/* 0x2e40 */  66, 68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0,
+/* 0x2e50 */  78, 50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49,
+/* 0x2e60 */  49,  0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77,
+/* 0x2e70 */  65, 50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68,
+/* 0x2e80 */  68, 69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78,
+/* 0x2e90 */  50, 68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,
+/* 0x2ea0 */   0, 78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x2eb0 */  52, 48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70,
+/* 0x2ec0 */  65, 83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50,
+/* 0x2ed0 */  68, 83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0,
+/* 0x2ee0 */  78, 50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54,
+/* 0x2ef0 */  48,  0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65,
+/* 0x2f00 */  83, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69,
+/* 0x2f10 */  68, 69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78,
+/* 0x2f20 */  50, 69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,
+/* 0x2f30 */   0, 78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x2f40 */  51, 48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83,
+/* 0x2f50 */  77, 65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x2f60 */  69, 83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0,
+/* 0x2f70 */  78, 50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54,
+/* 0x2f80 */  48,  0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65,
+/* 0x2f90 */  83, 54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77,
+/* 0x2fa0 */  65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70,
+/* 0x2fb0 */  48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x2fc0 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2fd0 */  67, 51, 48,  0, 76, 90, 77, 65, 95, 68, 79, 78, 69, 95, 83, 84,
+/* 0x2fe0 */  65, 67, 75,  0, 68, 74, 50, 66, 83, 83, 48, 48,  0, 68, 74, 67,
+/* 0x2ff0 */  65, 76, 76, 84, 50,  0, 67, 65, 76, 76, 84, 82, 48, 48,  0, 67,
+/* 0x3000 */  84, 67, 76, 69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82, 48, 49,
+/* 0x3010 */   0, 67, 84, 66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82, 79, 82,
+/* 0x3020 */  48, 49,  0, 67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65, 76, 76,
+/* 0x3030 */  84, 82, 48, 50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0, 67, 65,
+/* 0x3040 */  76, 76, 84, 82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69, 57,  0,
+/* 0x3050 */  67, 65, 76, 76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69, 86, 69,
+/* 0x3060 */  50,  0, 67, 65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66, 83, 72,
+/* 0x3070 */  82, 49, 49,  0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67, 84, 66,
+/* 0x3080 */  83, 87, 65, 49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,  0, 99,
+/* 0x3090 */ 116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46,
+/* 0x30a0 */  49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,
+/* 0x30b0 */ 107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,
+/* 0x30c0 */   0, 68, 74, 82, 69, 84, 85, 82, 78,  0, 85, 80, 88, 49, 72, 69,
+/* 0x30d0 */  65, 68,  0,115,116, 97,114,116, 95,111,102, 95, 99,111,109,112,
+/* 0x30e0 */ 114,101,115,115,101,100,  0,115,116, 97,114,116, 95,111,102, 95,
+/* 0x30f0 */ 117,110, 99,111,109,112,114,101,115,115,101,100,  0,115,116, 97,
+/* 0x3100 */  99,107, 95,102,111,114, 95,108,122,109, 97,  0,108,122,109, 97,
+/* 0x3110 */  95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,
+/* 0x3120 */ 109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,
+/* 0x3130 */ 108,101,110,  0,108,122,109, 97, 95,112,114,111,112,101,114,116,
+/* 0x3140 */ 105,101,115,  0,108,101,110,103,116,104, 95,111,102, 95, 98,115,
+/* 0x3150 */ 115,  0,102,105,108,116,101,114, 95,108,101,110,103,116,104,  0,
+/* 0x3160 */ 102,105,108,116,101,114, 95, 99,116,111,  0,111,114,105,103,105,
+/* 0x3170 */ 110, 97,108, 95,101,110,116,114,121,  0, 82, 95, 51, 56, 54, 95,
+/* 0x3180 */  51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51,
+/* 0x3190 */  56, 54, 95, 80, 67, 51, 50,  0, 82, 95, 51, 56, 54, 95, 56,  0,
+/* 0x31a0 */ 193, 25,  0,  0, 85, 80, 88, 76
 };
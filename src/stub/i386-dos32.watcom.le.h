@@ -1,5 +1,5 @@
 /* i386-dos32.watcom.le.h
-   created from i386-dos32.watcom.le.bin, 27475 (0x6b53) bytes
+   created from i386-dos32.watcom.le.bin, 13241 (0x33b9) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_DOS32_WATCOM_LE_SIZE    27475
-#define STUB_I386_DOS32_WATCOM_LE_ADLER32 0x1057182d
-#define STUB_I386_DOS32_WATCOM_LE_CRC32   0xa21f3531
+#define STUB_I386_DOS32_WATCOM_LE_SIZE    13241
+#define STUB_I386_DOS32_WATCOM_LE_ADLER32 0x4e33f4e9
+#define STUB_I386_DOS32_WATCOM_LE_CRC32   0x0d7c6eea
 
-unsigned char stub_i386_dos32_watcom_le[27475] = {
+unsigned char stub_i386_dos32_watcom_le[13241] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 180, 30,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -454,1304 +454,414 @@ unsigned char stub_i386_dos32_watcom_le[27475] = {
 /* 0x19f0 */  16,134,196,  1,232,137,  7,235,226, 36, 15,193,224, 16,102,139,
 /* 0x1a00 */   6,131,198,  2,  9,192,117, 12,139,  6,131,198,  4,235, 12,255,
 /* 0x1a10 */ 214, 95, 89, 41,249,193,233,  2,243,171,  7,141,165,  0,  0,  0,
-/* 0x1a20 */   0,233,252,255,255,255,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x1a30 */ 116, 32,101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101,
-/* 0x1a40 */  99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101,
-/* 0x1a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32,
-/* 0x1a60 */  32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77,
-/* 0x1a70 */  65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102,
-/* 0x1a80 */  32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32,
-/* 0x1a90 */  48, 32, 87, 67, 76, 69, 77, 65, 73, 78, 32, 32, 32, 32, 32, 32,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 48, 50, 57, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1ad0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1ae0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 87, 67, 76, 69,
-/* 0x1af0 */  77, 65, 73, 78, 48, 50, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1b00 */  48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53,100,
-/* 0x1b20 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1b30 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 87,
-/* 0x1b40 */  67, 76, 69, 77, 65, 73, 78, 48, 51, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1b50 */  48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b60 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1b70 */  48, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1b80 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1b90 */  79, 78, 76, 89, 10, 32, 32, 51, 32, 85, 80, 88, 49, 72, 69, 65,
-/* 0x1ba0 */  68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 48, 32,
-/* 0x1bb0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54, 54, 32, 32, 50,
-/* 0x1bd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1be0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 87, 67, 76, 69,
-/* 0x1bf0 */  67, 85, 84, 80, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c00 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 54,
-/* 0x1c20 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1c30 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 78,
-/* 0x1c40 */  50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1c50 */  48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c60 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c70 */  48, 56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1c80 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1c90 */  79, 78, 76, 89, 10, 32, 32, 54, 32, 78, 50, 66, 70, 65, 83, 49,
-/* 0x1ca0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x1cb0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 57, 32, 32, 50,
-/* 0x1cd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1ce0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1cf0 */  32, 55, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32,
-/* 0x1d00 */  32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d10 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1d30 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1d40 */  89, 10, 32, 32, 56, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 32,
-/* 0x1d50 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48,
-/* 0x1d60 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d70 */  32, 32, 48, 48, 48, 48, 48, 48, 57, 49, 32, 32, 50, 42, 42, 48,
-/* 0x1d80 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1d90 */  79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 50, 66, 83, 77, 65, 50,
-/* 0x1da0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x1db0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 50,
-/* 0x1dd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1de0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1df0 */  49, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32,
-/* 0x1e00 */  32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 97, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1e30 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1e40 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 78, 50, 66,
-/* 0x1e50 */  68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 97,
-/* 0x1e80 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1e90 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32,
-/* 0x1ea0 */  78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 98, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1ee0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1ef0 */  68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 78, 50, 66, 70, 65, 83,
-/* 0x1f00 */  51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102,
-/* 0x1f10 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 99, 52, 32, 32,
-/* 0x1f30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1f40 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1f50 */  32, 49, 52, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32, 32, 32,
-/* 0x1f60 */  32, 32, 48, 48, 48, 48, 48, 48, 51,101, 32, 32, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f80 */  48, 48, 48, 48, 48, 48,100, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1fa0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53, 32, 78, 50,
-/* 0x1fb0 */  66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1fe0 */  49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ff0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2000 */  78, 76, 89, 10, 32, 49, 54, 32, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x2010 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 49,101, 32, 32, 50, 42,
-/* 0x2040 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2050 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x2060 */  55, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2080 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2090 */  48, 48, 48, 49, 50,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x20a0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x20b0 */  10, 32, 49, 56, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 32, 32,
-/* 0x20c0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48,
-/* 0x20d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x20e0 */  32, 48, 48, 48, 48, 48, 49, 50,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x20f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2100 */  78, 76, 89, 10, 32, 49, 57, 32, 78, 50, 66, 68, 69, 67, 53, 48,
-/* 0x2110 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32,
-/* 0x2120 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 50, 32, 32, 50, 42,
-/* 0x2140 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2150 */  65, 68, 79, 78, 76, 89, 10, 32, 50, 48, 32, 78, 50, 66, 83, 77,
-/* 0x2160 */  65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2180 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 98, 32,
-/* 0x2190 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x21a0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x21b0 */  10, 32, 50, 49, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 32, 32,
-/* 0x21c0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x21e0 */  32, 48, 48, 48, 48, 48, 49, 52, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x21f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2200 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 50, 32, 78,
-/* 0x2210 */  50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2220 */  48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2230 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2240 */  49, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2250 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2260 */  79, 78, 76, 89, 10, 32, 50, 51, 32, 78, 50, 66, 68, 69, 67, 54,
-/* 0x2270 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2280 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2290 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 54, 32, 32, 50,
-/* 0x22a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x22b0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 52, 32, 78, 50, 68, 83,
-/* 0x22c0 */  77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x22d0 */  48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 54,
-/* 0x22f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2300 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2310 */  89, 10, 32, 50, 53, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 32,
-/* 0x2320 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2340 */  32, 32, 48, 48, 48, 48, 48, 49, 55, 57, 32, 32, 50, 42, 42, 48,
-/* 0x2350 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2360 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 54, 32,
-/* 0x2370 */  78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2380 */  48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x23a0 */  48, 49, 55, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x23b0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x23c0 */  50, 55, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32,
-/* 0x23d0 */  32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48,
-/* 0x23e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x23f0 */  48, 48, 48, 48, 49, 56, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2400 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2410 */  89, 10, 32, 50, 56, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 32,
-/* 0x2420 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2440 */  32, 32, 48, 48, 48, 48, 48, 49, 56, 99, 32, 32, 50, 42, 42, 48,
-/* 0x2450 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2460 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 57, 32,
-/* 0x2470 */  78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2480 */  48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2490 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x24a0 */  48, 49, 57, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x24b0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x24c0 */  68, 79, 78, 76, 89, 10, 32, 51, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x24d0 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100,
-/* 0x24e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x24f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 57, 97, 32, 32,
-/* 0x2500 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2510 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 49, 32, 78, 50, 68,
-/* 0x2520 */  83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2530 */  48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2540 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 97,
-/* 0x2550 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2560 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2570 */  76, 89, 10, 32, 51, 50, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32,
-/* 0x2580 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48,
-/* 0x2590 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25a0 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 98, 52, 32, 32, 50, 42, 42,
-/* 0x25b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x25c0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 51,
-/* 0x25d0 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x25e0 */  48, 48, 48, 48, 48, 53, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2600 */  48, 48, 49, 99, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2610 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2620 */  65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32, 78, 50, 68, 83, 77,
-/* 0x2630 */  65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2640 */ 100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2650 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 53, 32,
-/* 0x2660 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2670 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2680 */  10, 32, 51, 53, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 32, 32,
-/* 0x2690 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48,
-/* 0x26a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x26b0 */  32, 48, 48, 48, 48, 48, 50, 50, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x26c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x26d0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 54, 32, 78,
-/* 0x26e0 */  50, 68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x26f0 */  48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2700 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2710 */  50, 51, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2720 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x2730 */  55, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2740 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2750 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2760 */  48, 48, 48, 50, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2770 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2780 */  10, 32, 51, 56, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32, 32, 32,
-/* 0x2790 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48,
-/* 0x27a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x27b0 */  32, 48, 48, 48, 48, 48, 50, 51, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x27c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x27d0 */  78, 76, 89, 10, 32, 51, 57, 32, 78, 50, 68, 83, 77, 65, 54, 48,
-/* 0x27e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32,
-/* 0x27f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2800 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 51,102, 32, 32, 50, 42,
-/* 0x2810 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2820 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52,
-/* 0x2830 */  48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2840 */  48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2850 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2860 */  48, 48, 48, 50, 52, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2870 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2880 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49, 32, 78, 50, 68, 70,
-/* 0x2890 */  65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x28a0 */  49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x28b0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 54, 52,
-/* 0x28c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x28d0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x28e0 */  89, 10, 32, 52, 50, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 32,
-/* 0x28f0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2900 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2910 */  32, 32, 48, 48, 48, 48, 48, 50, 55, 97, 32, 32, 50, 42, 42, 48,
-/* 0x2920 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2930 */  79, 78, 76, 89, 10, 32, 52, 51, 32, 78, 50, 69, 83, 77, 65, 49,
-/* 0x2940 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x2950 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2960 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 55, 97, 32, 32, 50,
-/* 0x2970 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2980 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2990 */  52, 52, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32,
-/* 0x29a0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x29b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x29c0 */  48, 48, 48, 48, 50, 55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x29d0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x29e0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 53, 32, 78, 50, 69,
-/* 0x29f0 */  70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2a00 */  48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2a10 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 55,
-/* 0x2a20 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2a30 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32,
-/* 0x2a40 */  78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2a50 */  48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2a70 */  48, 50, 56, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2a80 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2a90 */  52, 55, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32,
-/* 0x2aa0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2ab0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2ac0 */  48, 48, 48, 48, 50, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2ad0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2ae0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 56, 32, 78, 50, 69,
-/* 0x2af0 */  70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2b00 */  48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2b10 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 57,
-/* 0x2b20 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2b30 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2b40 */  76, 89, 10, 32, 52, 57, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32,
-/* 0x2b50 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48,
-/* 0x2b60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b70 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 57,101, 32, 32, 50, 42, 42,
-/* 0x2b80 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2b90 */  68, 79, 78, 76, 89, 10, 32, 53, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2ba0 */  51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100,
-/* 0x2bb0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2bc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 97, 98, 32, 32,
-/* 0x2bd0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2be0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2bf0 */  32, 53, 49, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 32, 32, 32,
-/* 0x2c00 */  32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48,
-/* 0x2c10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2c20 */  48, 48, 48, 48, 48, 50, 98, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2c30 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2c40 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 50, 32, 78, 50,
-/* 0x2c50 */  69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2c60 */  48, 48, 53,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2c70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2c80 */  99, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c90 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2ca0 */  78, 76, 89, 10, 32, 53, 51, 32, 78, 50, 69, 83, 77, 65, 52, 48,
-/* 0x2cb0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32,
-/* 0x2cc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2cd0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 50, 54, 32, 32, 50, 42,
-/* 0x2ce0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2cf0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53,
-/* 0x2d00 */  52, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2d10 */  48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2d20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2d30 */  48, 48, 48, 51, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2d40 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2d50 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 53, 32, 78, 50, 69, 83,
-/* 0x2d60 */  77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2d70 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2d80 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52, 50,
-/* 0x2d90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2da0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 54, 32, 78,
-/* 0x2db0 */  50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2dc0 */  48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2dd0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2de0 */  51, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2df0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53,
-/* 0x2e00 */  55, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2e10 */  48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2e20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2e30 */  48, 48, 48, 51, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2e40 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2e50 */  10, 32, 53, 56, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32, 32,
-/* 0x2e60 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48,
-/* 0x2e70 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2e80 */  32, 48, 48, 48, 48, 48, 51, 53, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2e90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2ea0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 57, 32, 78,
-/* 0x2eb0 */  50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2ec0 */  48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2ed0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2ee0 */  51, 53, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2ef0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2f00 */  79, 78, 76, 89, 10, 32, 54, 48, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x2f10 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32,
-/* 0x2f20 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f30 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 55, 53, 32, 32, 50,
-/* 0x2f40 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2f50 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2f60 */  54, 49, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32,
-/* 0x2f70 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f80 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f90 */  48, 48, 48, 48, 51, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2fa0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2fb0 */  89, 10, 32, 54, 50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,
-/* 0x2fc0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50,101, 32, 32, 48, 48,
-/* 0x2fd0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fe0 */  32, 32, 48, 48, 48, 48, 48, 51, 56, 98, 32, 32, 50, 42, 42, 48,
-/* 0x2ff0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3000 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 51, 32,
-/* 0x3010 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48,
-/* 0x3020 */  48, 48, 48, 48, 52, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3030 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3040 */  48, 51, 98, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3050 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3060 */  54, 52, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x3070 */  32, 48, 48, 48, 48, 48, 97, 56, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3080 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3090 */  48, 48, 48, 48, 52, 48, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x30a0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x30b0 */  89, 10, 32, 54, 53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x30c0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 56, 54, 32, 32, 48, 48,
-/* 0x30d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30e0 */  32, 32, 48, 48, 48, 48, 48,101, 56, 55, 32, 32, 50, 42, 42, 48,
-/* 0x30f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x3100 */  79, 78, 76, 89, 10, 32, 54, 54, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3110 */  67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 97, 32,
-/* 0x3120 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3130 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48,100, 32, 32, 50,
-/* 0x3140 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x3150 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 55, 32, 87, 67, 76, 69,
-/* 0x3160 */  77, 65, 73, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3170 */  48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3180 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50, 55,
-/* 0x3190 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x31a0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x31b0 */  89, 10, 32, 54, 56, 32, 87, 67, 67, 84, 84, 80, 79, 83, 32, 32,
-/* 0x31c0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48,
-/* 0x31d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31e0 */  32, 32, 48, 48, 48, 48, 49, 57, 51, 48, 32, 32, 50, 42, 42, 48,
-/* 0x31f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3200 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 57, 32,
-/* 0x3210 */  87, 67, 67, 84, 84, 78, 85, 76, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3220 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3230 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3240 */  49, 57, 51, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3250 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3260 */  55, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 32, 32, 32, 32,
-/* 0x3270 */  32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3280 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3290 */  48, 48, 48, 49, 57, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x32a0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x32b0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 49, 32, 67, 84, 67,
-/* 0x32c0 */  76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x32d0 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x32e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 52,
-/* 0x32f0 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3300 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3310 */  76, 89, 10, 32, 55, 50, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32,
-/* 0x3320 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x3330 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3340 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 52, 98, 32, 32, 50, 42, 42,
-/* 0x3350 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3360 */  68, 79, 78, 76, 89, 10, 32, 55, 51, 32, 67, 84, 66, 83, 72, 82,
-/* 0x3370 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x3380 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3390 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 48, 32, 32,
-/* 0x33a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x33b0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 52, 32, 67, 84, 66,
-/* 0x33c0 */  82, 79, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x33d0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x33e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53,
-/* 0x33f0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3400 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 53, 32,
-/* 0x3410 */  67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3420 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3430 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3440 */  49, 57, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3450 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3460 */  55, 54, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32, 32,
-/* 0x3470 */  32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3480 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3490 */  48, 48, 48, 49, 57, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x34a0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x34b0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 55, 32, 67, 65, 76,
-/* 0x34c0 */  76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x34d0 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x34e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54,
-/* 0x34f0 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3500 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3510 */  76, 89, 10, 32, 55, 56, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32,
-/* 0x3520 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x3530 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3540 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 48, 32, 32, 50, 42, 42,
-/* 0x3550 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3560 */  68, 79, 78, 76, 89, 10, 32, 55, 57, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3570 */  69, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3580 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3590 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 50, 32, 32,
-/* 0x35a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x35b0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 48, 32, 67, 65, 76,
-/* 0x35c0 */  76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x35d0 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x35e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55,
-/* 0x35f0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3600 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3610 */  76, 89, 10, 32, 56, 49, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32,
-/* 0x3620 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x3630 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3640 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 56, 32, 32, 50, 42, 42,
-/* 0x3650 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3660 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 50,
-/* 0x3670 */  32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3680 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3690 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x36a0 */  48, 49, 57, 55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x36b0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x36c0 */  32, 56, 51, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32, 32,
-/* 0x36d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48,
-/* 0x36e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x36f0 */  48, 48, 48, 48, 49, 57, 55,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3700 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3710 */  76, 89, 10, 32, 56, 52, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32,
-/* 0x3720 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x3730 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3740 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 51, 32, 32, 50, 42, 42,
-/* 0x3750 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3760 */  68, 79, 78, 76, 89, 10, 32, 56, 53, 32, 67, 84, 66, 83, 87, 65,
-/* 0x3770 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3780 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3790 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 53, 32, 32,
-/* 0x37a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x37b0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 54, 32, 67, 65, 76,
-/* 0x37c0 */  76, 84, 82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x37d0 */  48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x37e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 56,
-/* 0x37f0 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3800 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3810 */  76, 89, 10, 32, 56, 55, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x3820 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48,
-/* 0x3830 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3840 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 57, 49, 32, 32, 50, 42, 42,
-/* 0x3850 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3860 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 56,
-/* 0x3870 */  32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32, 48,
-/* 0x3880 */  48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3890 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x38a0 */  48, 49, 57, 57, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x38b0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x38c0 */  65, 68, 79, 78, 76, 89, 10, 32, 56, 57, 32, 99,116,111,107, 51,
-/* 0x38d0 */  50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50,
-/* 0x38e0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x38f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 97, 57, 32,
-/* 0x3900 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3910 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3920 */  10, 32, 57, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 32,
-/* 0x3930 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48, 48,
-/* 0x3940 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3950 */  32, 48, 48, 48, 48, 49, 57, 99, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3960 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x3970 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 49, 32, 99,
-/* 0x3980 */ 116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x3990 */  48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x39a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x39b0 */  57,100, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x39c0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x39d0 */  79, 78, 76, 89, 10, 32, 57, 50, 32, 87, 67, 82, 69, 76, 79, 67,
-/* 0x39e0 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x39f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3a00 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 56, 32, 32, 50,
-/* 0x3a10 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x3a20 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 51, 32, 82, 69, 76, 79,
-/* 0x3a30 */  67, 51, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3a40 */  50, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3a50 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 98,
-/* 0x3a60 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3a70 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3a80 */  89, 10, 32, 57, 52, 32, 82, 69, 76, 51, 50, 66, 73, 71, 32, 32,
-/* 0x3a90 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48,
-/* 0x3aa0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ab0 */  32, 32, 48, 48, 48, 48, 49, 97, 48, 52, 32, 32, 50, 42, 42, 48,
-/* 0x3ac0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3ad0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 53, 32,
-/* 0x3ae0 */  82, 69, 76, 79, 67, 51, 50, 74, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3af0 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3b10 */  49, 97, 48,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3b20 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3b30 */  68, 79, 78, 76, 89, 10, 32, 57, 54, 32, 82, 69, 76, 51, 50, 69,
-/* 0x3b40 */  78, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b50 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3b60 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48,102, 32, 32,
-/* 0x3b70 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3b80 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 55, 32, 87, 67, 82,
-/* 0x3b90 */  69, 76, 83, 69, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3ba0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3bb0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48,
-/* 0x3bc0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3bd0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 56, 32,
-/* 0x3be0 */  87, 67, 76, 69, 77, 65, 73, 52, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3bf0 */  48, 48, 48, 48, 49, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3c10 */  49, 97, 49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3c20 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3c30 */  68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66,
-/* 0x3c40 */  76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3c50 */  32, 32,100, 32, 32, 87, 67, 76, 69, 67, 85, 84, 80,  9, 48, 48,
-/* 0x3c60 */  48, 48, 48, 48, 48, 48, 32, 87, 67, 76, 69, 67, 85, 84, 80, 10,
-/* 0x3c70 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3c80 */  32, 78, 50, 66, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3c90 */  48, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3ca0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3cb0 */  70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x3cc0 */  50, 66, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3cd0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x3ce0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69,
-/* 0x3cf0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3d00 */  32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x3d10 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x3d20 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3d30 */  32, 78, 50, 66, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3d40 */  48, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x3d50 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3d60 */  68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x3d70 */  50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d80 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x3d90 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65,
-/* 0x3da0 */  83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3db0 */  32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48,  9, 48, 48,
-/* 0x3dc0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10,
-/* 0x3dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3de0 */  32, 78, 50, 68, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3df0 */  48, 48, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3e00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3e10 */  70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x3e20 */  50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e30 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x3e40 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69,
-/* 0x3e50 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3e60 */  32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x3e70 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10,
-/* 0x3e80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3e90 */  32, 78, 50, 68, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3ea0 */  48, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x3eb0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3ec0 */  68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x3ed0 */  50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ee0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x3ef0 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65,
-/* 0x3f00 */  83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3f10 */  32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,  9, 48, 48,
-/* 0x3f20 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10,
-/* 0x3f30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3f40 */  32, 78, 50, 69, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3f60 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x3f70 */  70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x3f80 */  50, 69, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f90 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x3fa0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69,
-/* 0x3fb0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3fc0 */  32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x3fd0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10,
-/* 0x3fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3ff0 */  32, 78, 50, 69, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4000 */  48, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x4010 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x4020 */  68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x4030 */  50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4040 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x4050 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65,
-/* 0x4060 */  83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4070 */  32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,  9, 48, 48,
-/* 0x4080 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10,
-/* 0x4090 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x40a0 */  32, 67, 65, 76, 76, 84, 82, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x40b0 */  48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48, 48,
-/* 0x40c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76,
-/* 0x40d0 */  76, 84, 82, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67,
-/* 0x40e0 */  65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40f0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x4100 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84,
-/* 0x4110 */  82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4120 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,  9, 48, 48,
-/* 0x4130 */  48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10,
-/* 0x4140 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4150 */  32, 99,116,111,107, 51, 50, 46, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4160 */  48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 48, 48,
-/* 0x4170 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x4180 */ 116,111,107, 51, 50, 46, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4190 */  48, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48, 48, 48, 48,
-/* 0x41a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,
-/* 0x41b0 */ 107, 51, 50, 46, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x41c0 */  99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x41d0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51,
-/* 0x41e0 */  50, 46, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,
-/* 0x41f0 */ 111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4200 */  32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 79, 67, 51, 50,
-/* 0x4210 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69, 76, 79, 67,
-/* 0x4220 */  51, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4230 */  32, 32,100, 32, 32, 82, 69, 76, 79, 67, 51, 50, 74,  9, 48, 48,
-/* 0x4240 */  48, 48, 48, 48, 48, 48, 32, 82, 69, 76, 79, 67, 51, 50, 74, 10,
-/* 0x4250 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4260 */  32, 87, 67, 76, 69, 77, 65, 73, 78,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4270 */  48, 48, 32, 87, 67, 76, 69, 77, 65, 73, 78, 10, 48, 48, 48, 48,
-/* 0x4280 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 87, 67, 76,
-/* 0x4290 */  69, 77, 65, 73, 78, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42a0 */  32, 87, 67, 76, 69, 77, 65, 73, 78, 48, 50, 10, 48, 48, 48, 48,
-/* 0x42b0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 87, 67, 76,
-/* 0x42c0 */  69, 77, 65, 73, 78, 48, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42d0 */  32, 87, 67, 76, 69, 77, 65, 73, 78, 48, 51, 10, 48, 48, 48, 48,
-/* 0x42e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88,
-/* 0x42f0 */  49, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 85,
-/* 0x4300 */  80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4310 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49,
-/* 0x4320 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65,
-/* 0x4330 */  83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4340 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48,  9, 48, 48,
-/* 0x4350 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10,
-/* 0x4360 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4370 */  32, 78, 50, 66, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4380 */  48, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48,
-/* 0x4390 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x43a0 */  83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x43b0 */  50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51,
-/* 0x43d0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65,
-/* 0x43e0 */  83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x43f0 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48,  9, 48, 48,
-/* 0x4400 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10,
-/* 0x4410 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4420 */  32, 78, 50, 66, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4430 */  48, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48,
-/* 0x4440 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x4450 */  83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x4460 */  50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4470 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 53,
-/* 0x4480 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65,
-/* 0x4490 */  83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x44a0 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48,  9, 48, 48,
-/* 0x44b0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10,
-/* 0x44c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x44d0 */  32, 78, 50, 66, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x44e0 */  48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48,
-/* 0x44f0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x4500 */  70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x4510 */  50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4520 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 50,
-/* 0x4530 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77,
-/* 0x4540 */  65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4550 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48,  9, 48, 48,
-/* 0x4560 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 10,
-/* 0x4570 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4580 */  32, 78, 50, 68, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4590 */  48, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48,
-/* 0x45a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x45b0 */  70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x45c0 */  50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x45d0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 52,
-/* 0x45e0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77,
-/* 0x45f0 */  65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4600 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48,  9, 48, 48,
-/* 0x4610 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10,
-/* 0x4620 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4630 */  32, 78, 50, 68, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4640 */  48, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48,
-/* 0x4650 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x4660 */  70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x4670 */  50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4680 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54,
-/* 0x4690 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77,
-/* 0x46a0 */  65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x46b0 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48,  9, 48, 48,
-/* 0x46c0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10,
-/* 0x46d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x46e0 */  32, 78, 50, 69, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x46f0 */  48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48,
-/* 0x4700 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x4710 */  83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x4720 */  50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4730 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 50,
-/* 0x4740 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65,
-/* 0x4750 */  83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4760 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48,  9, 48, 48,
-/* 0x4770 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10,
-/* 0x4780 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4790 */  32, 78, 50, 69, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x47a0 */  48, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48,
-/* 0x47b0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x47c0 */  83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x47d0 */  50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x47e0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 52,
-/* 0x47f0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65,
-/* 0x4800 */  83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4810 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48,  9, 48, 48,
-/* 0x4820 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 53, 48, 10,
-/* 0x4830 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4840 */  32, 78, 50, 69, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4850 */  48, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48,
-/* 0x4860 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x4870 */  83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x4880 */  50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4890 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x48a0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65,
-/* 0x48b0 */  83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x48c0 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  9,
-/* 0x48d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x48e0 */  67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x48f0 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9,
-/* 0x4900 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x4910 */  70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4920 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9,
-/* 0x4930 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x4940 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4950 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9,
-/* 0x4960 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x4970 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4980 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9,
-/* 0x4990 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x49a0 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x49b0 */  32, 32,100, 32, 32, 87, 67, 76, 69, 77, 65, 73, 50,  9, 48, 48,
-/* 0x49c0 */  48, 48, 48, 48, 48, 48, 32, 87, 67, 76, 69, 77, 65, 73, 50, 10,
-/* 0x49d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x49e0 */  32, 87, 67, 67, 84, 84, 80, 79, 83,  9, 48, 48, 48, 48, 48, 48,
-/* 0x49f0 */  48, 48, 32, 87, 67, 67, 84, 84, 80, 79, 83, 10, 48, 48, 48, 48,
-/* 0x4a00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 87, 67, 67,
-/* 0x4a10 */  84, 84, 78, 85, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 87,
-/* 0x4a20 */  67, 67, 84, 84, 78, 85, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a30 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x4a40 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 67, 76, 69,
-/* 0x4a50 */  86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4a60 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49,  9, 48, 48,
-/* 0x4a70 */  48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 49, 10,
-/* 0x4a80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4a90 */  32, 67, 84, 66, 83, 72, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4aa0 */  48, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48,
-/* 0x4ab0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66,
-/* 0x4ac0 */  82, 79, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67,
-/* 0x4ad0 */  84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ae0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 48,
-/* 0x4af0 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 87,
-/* 0x4b00 */  65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4b10 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50,  9, 48, 48,
-/* 0x4b20 */  48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10,
-/* 0x4b30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4b40 */  32, 67, 65, 76, 76, 84, 82, 69, 56,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4b50 */  48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10, 48, 48, 48, 48,
-/* 0x4b60 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76,
-/* 0x4b70 */  76, 84, 82, 69, 57,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67,
-/* 0x4b80 */  65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b90 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x4ba0 */  50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 67, 76, 69,
-/* 0x4bb0 */  86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4bc0 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 50,  9, 48, 48,
-/* 0x4bd0 */  48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10,
-/* 0x4be0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4bf0 */  32, 67, 84, 66, 83, 72, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4c00 */  48, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49, 10, 48, 48, 48, 48,
-/* 0x4c10 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66,
-/* 0x4c20 */  82, 79, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67,
-/* 0x4c30 */  84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c40 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 49,
-/* 0x4c50 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 87,
-/* 0x4c60 */  65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4c70 */  32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51, 48,  9, 48,
-/* 0x4c80 */  48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 51,
-/* 0x4c90 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4ca0 */ 100, 32, 32, 87, 67, 82, 69, 76, 79, 67, 49,  9, 48, 48, 48, 48,
-/* 0x4cb0 */  48, 48, 48, 48, 32, 87, 67, 82, 69, 76, 79, 67, 49, 10, 48, 48,
-/* 0x4cc0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 82,
-/* 0x4cd0 */  69, 76, 51, 50, 66, 73, 71,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ce0 */  32, 82, 69, 76, 51, 50, 66, 73, 71, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4cf0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 51, 50,
-/* 0x4d00 */  69, 78, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69, 76,
-/* 0x4d10 */  51, 50, 69, 78, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4d20 */  32, 32, 32, 32,100, 32, 32, 87, 67, 82, 69, 76, 83, 69, 76,  9,
-/* 0x4d30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 87, 67, 82, 69, 76, 83, 69,
-/* 0x4d40 */  76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4d50 */ 100, 32, 32, 87, 67, 76, 69, 77, 65, 73, 52,  9, 48, 48, 48, 48,
-/* 0x4d60 */  48, 48, 48, 48, 32, 87, 67, 76, 69, 77, 65, 73, 52, 10, 48, 48,
-/* 0x4d70 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x4d80 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,111,
-/* 0x4d90 */ 112,121, 95,115,111,117,114, 99,101, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4da0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x4db0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,111,112,121, 95,100,
-/* 0x4dc0 */ 101,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x4dd0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x4de0 */  48, 48, 48, 32,119,111,114,100,115, 95,116,111, 95, 99,111,112,
-/* 0x4df0 */ 121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x4e00 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e10 */  48, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,
-/* 0x4e20 */ 117,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x4e30 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x4e40 */  48, 48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48,
-/* 0x4e50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e60 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4e70 */ 122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4e80 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x4e90 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,
-/* 0x4ea0 */ 114,111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4eb0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x4ec0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116, 97,114,116, 95,
-/* 0x4ed0 */ 111,102, 95,114,101,108,111, 99,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ee0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x4ef0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114,
-/* 0x4f00 */  95, 98,117,102,102,101,114, 95,115,116, 97,114,116, 10, 48, 48,
-/* 0x4f10 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x4f20 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,
-/* 0x4f30 */ 108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x4f40 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x4f50 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,
-/* 0x4f60 */ 101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4f70 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x4f80 */  48, 48, 48, 48, 48, 48, 32,111,114,105,103,105,110, 97,108, 95,
-/* 0x4f90 */ 115,116, 97, 99,107, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4fa0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x4fb0 */  48, 48, 48, 48, 48, 32,111,114,105,103,105,110, 97,108, 95,101,
-/* 0x4fc0 */ 110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4fd0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 87, 67,
-/* 0x4fe0 */  76, 69, 77, 65, 73, 78, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4ff0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5000 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5010 */  49, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x5020 */  32, 32, 32, 32, 32, 99,111,112,121, 95,115,111,117,114, 99,101,
-/* 0x5030 */  10, 48, 48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5040 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,111,112,121,
-/* 0x5050 */  95,100,101,115,116, 10, 48, 48, 48, 48, 48, 48, 49,100, 32, 82,
-/* 0x5060 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5070 */  32,119,111,114,100,115, 95,116,111, 95, 99,111,112,121, 10, 10,
-/* 0x5080 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5090 */  68, 83, 32, 70, 79, 82, 32, 91, 87, 67, 76, 69, 77, 65, 73, 78,
-/* 0x50a0 */  48, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x50b0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50c0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x50d0 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50e0 */  32, 87, 67, 76, 69, 67, 85, 84, 80, 10, 10, 82, 69, 76, 79, 67,
-/* 0x50f0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5100 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70,
-/* 0x5110 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5120 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5130 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5140 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x5150 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5160 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x5170 */  65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5180 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5190 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x51a0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x51b0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x51c0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x51d0 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10,
-/* 0x51e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x51f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5200 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5210 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83,
-/* 0x5220 */  77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5230 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5240 */  66, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5250 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5260 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5270 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5280 */  32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82,
-/* 0x5290 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x52a0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93,
-/* 0x52b0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x52c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x52d0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56,
-/* 0x52e0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x52f0 */  66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5300 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5310 */  78, 50, 66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5320 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5330 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5340 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5350 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x5360 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5370 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x5380 */  67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5390 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x53a0 */  68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x53b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x53c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x53d0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x53e0 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5400 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48,
-/* 0x5410 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5420 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65,
-/* 0x5430 */  52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5440 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5450 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82,
-/* 0x5460 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5470 */  32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5480 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5490 */  82, 32, 91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70,
-/* 0x54a0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x54b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x54c0 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x54d0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x54e0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56,
-/* 0x54f0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5500 */  66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5510 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5520 */  78, 50, 66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5530 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5540 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5550 */  48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x5560 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10,
-/* 0x5570 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5580 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54,
-/* 0x5590 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x55a0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x55b0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95,
-/* 0x55c0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x55d0 */  78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x55e0 */  53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x55f0 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x5600 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5610 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58,
-/* 0x5620 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5630 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5640 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54,
-/* 0x5650 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5660 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5670 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5680 */  50, 68, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5690 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x56a0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x56b0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x56c0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10,
-/* 0x56d0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x56e0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48,
-/* 0x56f0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5700 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5710 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x5720 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5730 */  50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5740 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5750 */  91, 78, 50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5760 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5770 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5780 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5790 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48,
-/* 0x57a0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x57b0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x57c0 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x57d0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57e0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x57f0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5800 */  32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5810 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5820 */  82, 32, 91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70,
-/* 0x5830 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5840 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5850 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5860 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5870 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5880 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x5890 */  65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x58a0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x58b0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x58c0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x58d0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x58e0 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x58f0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10,
-/* 0x5900 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5910 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51,
-/* 0x5920 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5930 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5940 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95,
-/* 0x5950 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5960 */  78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x5970 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5980 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48,
-/* 0x5990 */  48, 48, 48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x59a0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48,
-/* 0x59b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x59c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65,
-/* 0x59d0 */  52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x59e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82,
-/* 0x5a00 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a10 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5a20 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5a30 */  82, 32, 91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70,
-/* 0x5a40 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5a60 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5a70 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5a80 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56,
-/* 0x5a90 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5aa0 */  68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5ab0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5ac0 */  78, 50, 68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5ad0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ae0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5af0 */  48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x5b00 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10,
-/* 0x5b10 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5b20 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54,
-/* 0x5b30 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5b40 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5b50 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95,
-/* 0x5b60 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b70 */  78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5b80 */  53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x5b90 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x5ba0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5bb0 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58,
-/* 0x5bc0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5bd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5be0 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54,
-/* 0x5bf0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x5c00 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5c10 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5c20 */  50, 69, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5c30 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c40 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5c50 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5c60 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5c70 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5c80 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48,
-/* 0x5c90 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5ca0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5cb0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x5cc0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5cd0 */  50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5ce0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5cf0 */  91, 78, 50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5d00 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d10 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5d20 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5d30 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x5d40 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5d50 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x5d60 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5d70 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d80 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x5d90 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5da0 */  32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5db0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5dc0 */  82, 32, 91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70,
-/* 0x5dd0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5de0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5df0 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5e00 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x5e10 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5e20 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x5e30 */  65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5e40 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e50 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x5e60 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5e70 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x5e80 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5e90 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x5ea0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5eb0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51,
-/* 0x5ec0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5ed0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5ee0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95,
-/* 0x5ef0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f00 */  78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5f10 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5f20 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48,
-/* 0x5f30 */  48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5f40 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,
-/* 0x5f50 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5f60 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65,
-/* 0x5f70 */  52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5f80 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f90 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82,
-/* 0x5fa0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fb0 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5fc0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5fd0 */  82, 32, 91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70,
-/* 0x5fe0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6000 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6010 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x6020 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56,
-/* 0x6030 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x6040 */  69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6050 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6060 */  78, 50, 69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6070 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6080 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6090 */  48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x60a0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10,
-/* 0x60b0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x60c0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54,
-/* 0x60d0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x60e0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x60f0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95,
-/* 0x6100 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6110 */  78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x6120 */  53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x6130 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x6140 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6150 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58,
-/* 0x6160 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6180 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54,
-/* 0x6190 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x61a0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x61b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x61c0 */  90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x61d0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x61e0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x61f0 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x6200 */  32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116, 97,
-/* 0x6210 */  99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6220 */  49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x6230 */  32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10,
-/* 0x6240 */  48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x6250 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x6260 */  99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32, 82,
-/* 0x6270 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6280 */  32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,
-/* 0x6290 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x62a0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 87, 67, 76, 69, 77, 65,
-/* 0x62b0 */  73, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x62c0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62d0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x62e0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62f0 */  32,115,116, 97,114,116, 95,111,102, 95,114,101,108,111, 99,115,
-/* 0x6300 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6310 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 87, 67, 67, 84, 84, 80,
-/* 0x6320 */  79, 83, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6330 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6340 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x6350 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6360 */  32,102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,
-/* 0x6370 */ 116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6380 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x6390 */  76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x63a0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63b0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x63c0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x63d0 */  32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,
-/* 0x63e0 */ 116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x63f0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76,
-/* 0x6400 */  69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6410 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6420 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x6430 */  32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6440 */  32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48,
-/* 0x6450 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6460 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x6470 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6480 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84,
-/* 0x6490 */  82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x64a0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64b0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x64c0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64d0 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79,
-/* 0x64e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x64f0 */  79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79,
-/* 0x6500 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6520 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x6530 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x6540 */ 114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6550 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6560 */  32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70,
-/* 0x6570 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6590 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x65a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x65b0 */  51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x65c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69,
-/* 0x65d0 */  86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x65e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x6600 */  82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6610 */  32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48,
-/* 0x6620 */  48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6630 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x6640 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6650 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x6660 */  49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6670 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6680 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82,
-/* 0x6690 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x66a0 */  32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x66b0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x66c0 */  82, 32, 91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79,
-/* 0x66d0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x66e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x66f0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x6700 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x6710 */ 114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6720 */  54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6730 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82,
-/* 0x6740 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6750 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x6760 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6770 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6780 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51,
-/* 0x6790 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x67a0 */ 116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x67b0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x67c0 */  32, 91, 99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70,
-/* 0x67d0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x67e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x67f0 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6800 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x6810 */  46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x6820 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x6830 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6840 */ 101, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6850 */  32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48,
-/* 0x6860 */  48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6870 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x6880 */  46, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6890 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,
-/* 0x68a0 */ 107, 51, 50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x68b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x68d0 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x68e0 */  32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48,
-/* 0x68f0 */  48, 48, 48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6900 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x6910 */  46, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6920 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,
-/* 0x6930 */ 107, 51, 50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6940 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6950 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6960 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6970 */  32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 10,
-/* 0x6980 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6990 */  68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 51, 50, 48,
-/* 0x69a0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x69b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x69c0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51,
-/* 0x69d0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 82,
-/* 0x69e0 */  69, 76, 79, 67, 51, 50, 74, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x69f0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6a00 */  91, 82, 69, 76, 51, 50, 66, 73, 71, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6a10 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a20 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6a30 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6a40 */  32, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67, 51, 50, 48,
-/* 0x6a50 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6a60 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 51,
-/* 0x6a70 */  50, 74, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6a80 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a90 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x6aa0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ab0 */  32, 82, 69, 76, 79, 67, 51, 50, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6ac0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6ad0 */  82, 32, 91, 87, 67, 76, 69, 77, 65, 73, 52, 93, 58, 10, 79, 70,
-/* 0x6ae0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6af0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6b00 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x6b10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110,
-/* 0x6b20 */  97,108, 95,115,116, 97, 99,107, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x6b30 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x6b40 */  32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,
-/* 0x6b50 */ 114,121, 10
+/* 0x1a20 */   0,233,252,255,255,255, 99,  0,  0,  0,112,  0,  0,  0, 84,  0,
+/* 0x1a30 */   0,  0, 32, 21,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 41,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 93,  0,  0,  0,  3,  0,
+/* 0x1a50 */   0,  0,  0,  0,  0,  0, 20,  0,  0,  0, 96,  0,  0,  0,  6,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0, 31,  0,  0,  0,102,  0,  0,  0, 32,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0,134,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  0,  0, 49,  0,  0,  0,134,  0,  0,  0,  3,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,137,  0,  0,  0,  2,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,139,  0,  0,  0,  6,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  0,  0, 76,  0,  0,  0,145,  0,  0,  0, 11,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0,  0, 85,  0,  0,  0,156,  0,  0,  0,  5,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0, 94,  0,  0,  0,161,  0,  0,  0,  9,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  0,  0,103,  0,  0,  0,170,  0,  0,  0, 13,  0,
+/* 0x1af0 */   0,  0,  0,  0,  0,  0,112,  0,  0,  0,183,  0,  0,  0, 13,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,121,  0,  0,  0,196,  0,  0,  0, 15,  0,
+/* 0x1b10 */   0,  0,  0,  0,  0,  0,130,  0,  0,  0,211,  0,  0,  0, 62,  0,
+/* 0x1b20 */   0,  0,  0,  0,  0,  0,139,  0,  0,  0, 17,  1,  0,  0, 13,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0,148,  0,  0,  0, 30,  1,  0,  0, 15,  0,
+/* 0x1b40 */   0,  0,  0,  0,  0,  0,157,  0,  0,  0, 45,  1,  0,  0,  2,  0,
+/* 0x1b50 */   0,  0,  0,  0,  0,  0,166,  0,  0,  0, 47,  1,  0,  0,  3,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0,  0,175,  0,  0,  0, 50,  1,  0,  0,  9,  0,
+/* 0x1b70 */   0,  0,  0,  0,  0,  0,184,  0,  0,  0, 59,  1,  0,  0, 12,  0,
+/* 0x1b80 */   0,  0,  0,  0,  0,  0,193,  0,  0,  0, 71,  1,  0,  0, 25,  0,
+/* 0x1b90 */   0,  0,  0,  0,  0,  0,202,  0,  0,  0, 96,  1,  0,  0, 22,  0,
+/* 0x1ba0 */   0,  0,  0,  0,  0,  0,211,  0,  0,  0,118,  1,  0,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  0,  0,220,  0,  0,  0,118,  1,  0,  0,  3,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0,229,  0,  0,  0,121,  1,  0,  0,  2,  0,
+/* 0x1bd0 */   0,  0,  0,  0,  0,  0,238,  0,  0,  0,123,  1,  0,  0,  6,  0,
+/* 0x1be0 */   0,  0,  0,  0,  0,  0,247,  0,  0,  0,129,  1,  0,  0, 11,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  0,  0,  0,  1,  0,  0,140,  1,  0,  0,  5,  0,
+/* 0x1c00 */   0,  0,  0,  0,  0,  0,  9,  1,  0,  0,145,  1,  0,  0,  9,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,  0, 18,  1,  0,  0,154,  1,  0,  0, 13,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,  0, 27,  1,  0,  0,167,  1,  0,  0, 13,  0,
+/* 0x1c30 */   0,  0,  0,  0,  0,  0, 36,  1,  0,  0,180,  1,  0,  0, 15,  0,
+/* 0x1c40 */   0,  0,  0,  0,  0,  0, 45,  1,  0,  0,195,  1,  0,  0, 82,  0,
+/* 0x1c50 */   0,  0,  0,  0,  0,  0, 54,  1,  0,  0, 21,  2,  0,  0, 13,  0,
+/* 0x1c60 */   0,  0,  0,  0,  0,  0, 63,  1,  0,  0, 34,  2,  0,  0, 15,  0,
+/* 0x1c70 */   0,  0,  0,  0,  0,  0, 72,  1,  0,  0, 49,  2,  0,  0,  2,  0,
+/* 0x1c80 */   0,  0,  0,  0,  0,  0, 81,  1,  0,  0, 51,  2,  0,  0,  3,  0,
+/* 0x1c90 */   0,  0,  0,  0,  0,  0, 90,  1,  0,  0, 54,  2,  0,  0,  9,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  0,  0, 99,  1,  0,  0, 63,  2,  0,  0, 12,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  0,  0,108,  1,  0,  0, 75,  2,  0,  0, 25,  0,
+/* 0x1cc0 */   0,  0,  0,  0,  0,  0,117,  1,  0,  0,100,  2,  0,  0, 22,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0,126,  1,  0,  0,122,  2,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,135,  1,  0,  0,122,  2,  0,  0,  3,  0,
+/* 0x1cf0 */   0,  0,  0,  0,  0,  0,144,  1,  0,  0,125,  2,  0,  0,  2,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0,  0,153,  1,  0,  0,127,  2,  0,  0,  6,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0,  0,162,  1,  0,  0,133,  2,  0,  0, 11,  0,
+/* 0x1d20 */   0,  0,  0,  0,  0,  0,171,  1,  0,  0,144,  2,  0,  0,  5,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0,  0,180,  1,  0,  0,149,  2,  0,  0,  9,  0,
+/* 0x1d40 */   0,  0,  0,  0,  0,  0,189,  1,  0,  0,158,  2,  0,  0, 13,  0,
+/* 0x1d50 */   0,  0,  0,  0,  0,  0,198,  1,  0,  0,171,  2,  0,  0, 13,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,  0,207,  1,  0,  0,184,  2,  0,  0, 15,  0,
+/* 0x1d70 */   0,  0,  0,  0,  0,  0,216,  1,  0,  0,199,  2,  0,  0, 95,  0,
+/* 0x1d80 */   0,  0,  0,  0,  0,  0,225,  1,  0,  0, 38,  3,  0,  0, 13,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,  0,234,  1,  0,  0, 51,  3,  0,  0, 15,  0,
+/* 0x1da0 */   0,  0,  0,  0,  0,  0,243,  1,  0,  0, 66,  3,  0,  0,  2,  0,
+/* 0x1db0 */   0,  0,  0,  0,  0,  0,252,  1,  0,  0, 68,  3,  0,  0,  3,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  0,  0,  5,  2,  0,  0, 71,  3,  0,  0,  9,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,  0, 14,  2,  0,  0, 80,  3,  0,  0, 12,  0,
+/* 0x1de0 */   0,  0,  0,  0,  0,  0, 23,  2,  0,  0, 92,  3,  0,  0, 25,  0,
+/* 0x1df0 */   0,  0,  0,  0,  0,  0, 32,  2,  0,  0,117,  3,  0,  0, 22,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,  0, 41,  2,  0,  0,139,  3,  0,  0,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0,  0,  0, 50,  2,  0,  0,139,  3,  0,  0, 46,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0, 61,  2,  0,  0,185,  3,  0,  0, 72,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,  0, 72,  2,  0,  0,  1,  4,  0,  0,134, 10,
+/* 0x1e40 */   0,  0,  0,  0,  0,  0, 83,  2,  0,  0,135, 14,  0,  0,134, 10,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0, 94,  2,  0,  0, 13, 25,  0,  0, 26,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,105,  2,  0,  0, 39, 25,  0,  0,  9,  0,
+/* 0x1e70 */   0,  0,  0,  0,  0,  0,114,  2,  0,  0, 48, 25,  0,  0,  6,  0,
+/* 0x1e80 */   0,  0,  0,  0,  0,  0,123,  2,  0,  0, 54, 25,  0,  0,  2,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0,  0,132,  2,  0,  0, 56, 25,  0,  0, 14,  0,
+/* 0x1ea0 */   0,  0,  0,  0,  0,  0,141,  2,  0,  0, 70, 25,  0,  0,  5,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  0,  0,150,  2,  0,  0, 75, 25,  0,  0,  5,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,159,  2,  0,  0, 80, 25,  0,  0,  4,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0,  0,168,  2,  0,  0, 84, 25,  0,  0,  2,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0,  0,177,  2,  0,  0, 86, 25,  0,  0,  5,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0,  0,186,  2,  0,  0, 91, 25,  0,  0, 16,  0,
+/* 0x1f00 */   0,  0,  0,  0,  0,  0,195,  2,  0,  0,107, 25,  0,  0,  5,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,  0,204,  2,  0,  0,112, 25,  0,  0,  2,  0,
+/* 0x1f20 */   0,  0,  0,  0,  0,  0,213,  2,  0,  0,114, 25,  0,  0,  2,  0,
+/* 0x1f30 */   0,  0,  0,  0,  0,  0,222,  2,  0,  0,116, 25,  0,  0,  4,  0,
+/* 0x1f40 */   0,  0,  0,  0,  0,  0,231,  2,  0,  0,120, 25,  0,  0,  5,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,  0,240,  2,  0,  0,125, 25,  0,  0,  2,  0,
+/* 0x1f60 */   0,  0,  0,  0,  0,  0,249,  2,  0,  0,127, 25,  0,  0,  4,  0,
+/* 0x1f70 */   0,  0,  0,  0,  0,  0,  2,  3,  0,  0,131, 25,  0,  0,  2,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,  0, 11,  3,  0,  0,133, 25,  0,  0,  5,  0,
+/* 0x1f90 */   0,  0,  0,  0,  0,  0, 20,  3,  0,  0,138, 25,  0,  0,  7,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  0,  0, 29,  3,  0,  0,145, 25,  0,  0, 10,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0, 39,  3,  0,  0,155, 25,  0,  0, 14,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  0,  0, 49,  3,  0,  0,169, 25,  0,  0, 32,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  0,  0, 59,  3,  0,  0,201, 25,  0,  0, 10,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0, 69,  3,  0,  0,211, 25,  0,  0,  5,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  0,  0, 79,  3,  0,  0,216, 25,  0,  0,  3,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,  0, 88,  3,  0,  0,219, 25,  0,  0, 41,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0, 97,  3,  0,  0,  4, 26,  0,  0,  9,  0,
+/* 0x2020 */   0,  0,  0,  0,  0,  0,106,  3,  0,  0, 13, 26,  0,  0,  2,  0,
+/* 0x2030 */   0,  0,  0,  0,  0,  0,115,  3,  0,  0, 15, 26,  0,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,124,  3,  0,  0, 15, 26,  0,  0,  2,  0,
+/* 0x2050 */   0,  0,  0,  0,  0,  0,133,  3,  0,  0, 17, 26,  0,  0, 21,  0,
+/* 0x2060 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  0,  0,103,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  0,  0,130,  0,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  0,  0,175,  0,  0,  0, 19,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  0,  0,202,  0,  0,  0, 22,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,  0,  0,211,  0,  0,  0, 23,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0,220,  0,  0,  0, 24,  0,  0,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,238,  0,  0,  0, 26,  0,  0,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0,  0,  0,247,  0,  0,  0, 27,  0,  0,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,  0,  0, 18,  1,  0,  0, 30,  0,  0,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  0,  0, 45,  1,  0,  0, 33,  0,  0,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,  0,  0, 90,  1,  0,  0, 38,  0,  0,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  0,  0,117,  1,  0,  0, 41,  0,  0,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  0,  0,126,  1,  0,  0, 42,  0,  0,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,  0,  0,135,  1,  0,  0, 43,  0,  0,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  0,  0,153,  1,  0,  0, 45,  0,  0,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  0,  0,162,  1,  0,  0, 46,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,  0,  0,189,  1,  0,  0, 49,  0,  0,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,  0,  0,216,  1,  0,  0, 52,  0,  0,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,  0,  0,  5,  2,  0,  0, 57,  0,  0,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0,  0,  0, 32,  2,  0,  0, 60,  0,  0,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0, 41,  2,  0,  0, 61,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  0,  0,132,  2,  0,  0, 70,  0,  0,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,  0,  0,195,  2,  0,  0, 77,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,  0,  0,222,  2,  0,  0, 80,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,  0,  0, 20,  3,  0,  0, 86,  0,  0,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,  0,  0, 29,  3,  0,  0, 87,  0,  0,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,  0,  0, 39,  3,  0,  0, 88,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,  0,  0, 49,  3,  0,  0, 89,  0,  0,  0,  0,  0,
+/* 0x2260 */   0,  0,  0,  0,  0,  0, 69,  3,  0,  0, 91,  0,  0,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,  0,  0, 88,  3,  0,  0, 93,  0,  0,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  0,  0,106,  3,  0,  0, 95,  0,  0,  0,  0,  0,
+/* 0x2290 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,  0,  0, 85,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,  0,  0, 94,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,  0,  0,112,  0,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,  0,  0,121,  0,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x2320 */   0,  0,  0,  0,  0,  0,139,  0,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,148,  0,  0,  0, 16,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,  0,  0,157,  0,  0,  0, 17,  0,  0,  0,  0,  0,
+/* 0x2350 */   0,  0,  0,  0,  0,  0,166,  0,  0,  0, 18,  0,  0,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,  0,  0,184,  0,  0,  0, 20,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,  0,  0,193,  0,  0,  0, 21,  0,  0,  0,  0,  0,
+/* 0x2380 */   0,  0,  0,  0,  0,  0,229,  0,  0,  0, 25,  0,  0,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0,  0,  0,  0,  1,  0,  0, 28,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,  0,  0,  9,  1,  0,  0, 29,  0,  0,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0,  0,  0, 27,  1,  0,  0, 31,  0,  0,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,  0,  0, 36,  1,  0,  0, 32,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,  0,  0, 54,  1,  0,  0, 34,  0,  0,  0,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,  0,  0, 63,  1,  0,  0, 35,  0,  0,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,  0,  0, 72,  1,  0,  0, 36,  0,  0,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,  0,  0, 81,  1,  0,  0, 37,  0,  0,  0,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,  0,  0, 99,  1,  0,  0, 39,  0,  0,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,  0,  0,108,  1,  0,  0, 40,  0,  0,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,  0,  0,144,  1,  0,  0, 44,  0,  0,  0,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,  0,  0,171,  1,  0,  0, 47,  0,  0,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,  0,  0,180,  1,  0,  0, 48,  0,  0,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  0,  0,198,  1,  0,  0, 50,  0,  0,  0,  0,  0,
+/* 0x2470 */   0,  0,  0,  0,  0,  0,207,  1,  0,  0, 51,  0,  0,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,  0,225,  1,  0,  0, 53,  0,  0,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,  0,  0,234,  1,  0,  0, 54,  0,  0,  0,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0,  0,  0,243,  1,  0,  0, 55,  0,  0,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,  0,  0,252,  1,  0,  0, 56,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,  0,  0, 14,  2,  0,  0, 58,  0,  0,  0,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0,  0,  0, 23,  2,  0,  0, 59,  0,  0,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0, 50,  2,  0,  0, 62,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  0,  0, 61,  2,  0,  0, 63,  0,  0,  0,  0,  0,
+/* 0x2500 */   0,  0,  0,  0,  0,  0, 72,  2,  0,  0, 64,  0,  0,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0,  0,  0, 83,  2,  0,  0, 65,  0,  0,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,  0,  0, 94,  2,  0,  0, 66,  0,  0,  0,  0,  0,
+/* 0x2530 */   0,  0,  0,  0,  0,  0,105,  2,  0,  0, 67,  0,  0,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0,  0,  0,114,  2,  0,  0, 68,  0,  0,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,  0,  0,123,  2,  0,  0, 69,  0,  0,  0,  0,  0,
+/* 0x2560 */   0,  0,  0,  0,  0,  0,141,  2,  0,  0, 71,  0,  0,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,150,  2,  0,  0, 72,  0,  0,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,  0,  0,159,  2,  0,  0, 73,  0,  0,  0,  0,  0,
+/* 0x2590 */   0,  0,  0,  0,  0,  0,168,  2,  0,  0, 74,  0,  0,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,  0,  0,177,  2,  0,  0, 75,  0,  0,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,  0,  0,186,  2,  0,  0, 76,  0,  0,  0,  0,  0,
+/* 0x25c0 */   0,  0,  0,  0,  0,  0,204,  2,  0,  0, 78,  0,  0,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,  0,  0,213,  2,  0,  0, 79,  0,  0,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,  0,  0,231,  2,  0,  0, 81,  0,  0,  0,  0,  0,
+/* 0x25f0 */   0,  0,  0,  0,  0,  0,240,  2,  0,  0, 82,  0,  0,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,  0,  0,249,  2,  0,  0, 83,  0,  0,  0,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,  0,  0,  2,  3,  0,  0, 84,  0,  0,  0,  0,  0,
+/* 0x2620 */   0,  0,  0,  0,  0,  0, 11,  3,  0,  0, 85,  0,  0,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  0,  0, 59,  3,  0,  0, 90,  0,  0,  0,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,  0,  0, 79,  3,  0,  0, 92,  0,  0,  0,  0,  0,
+/* 0x2650 */   0,  0,  0,  0,  0,  0, 97,  3,  0,  0, 94,  0,  0,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,115,  3,  0,  0, 96,  0,  0,  0,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,  0,  0,124,  3,  0,  0, 97,  0,  0,  0,  0,  0,
+/* 0x2680 */   0,  0,  0,  0,  0,  0,133,  3,  0,  0, 98,  0,  0,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,142,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x26a0 */ 173,222,  0,  0,  0,  0,154,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x26b0 */ 173,222,  0,  0,  0,  0,164,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x26c0 */ 173,222,  0,  0,  0,  0,178,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x26d0 */ 173,222,  0,  0,  0,  0,196,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x26e0 */ 173,222,  0,  0,  0,  0,207,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x26f0 */ 173,222,  0,  0,  0,  0,218,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2700 */ 173,222,  0,  0,  0,  0,234,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2710 */ 173,222,  0,  0,  0,  0,250,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2720 */ 173,222,  0,  0,  0,  0, 14,  4,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2730 */ 173,222,  0,  0,  0,  0, 28,  4,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2740 */ 173,222,  0,  0,  0,  0, 39,  4,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2750 */ 173,222,  0,  0,  0,  0, 54,  4,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2760 */ 173,222,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 69,  4,
+/* 0x2770 */   0,  0, 99,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2780 */   0,  0, 24,  0,  0,  0, 69,  4,  0,  0,100,  0,  0,  0,  0,  0,
+/* 0x2790 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0, 69,  4,
+/* 0x27a0 */   0,  0,101,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+/* 0x27b0 */   0,  0,  2,  0,  0,  0, 78,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27c0 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x27d0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x27e0 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x27f0 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x2800 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,
+/* 0x2810 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x2820 */   0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 12,  0,  0,  0, 89,  4,
+/* 0x2830 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,
+/* 0x2840 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2850 */   0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 14,  0,  0,  0, 89,  4,
+/* 0x2860 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,
+/* 0x2870 */   0,  0, 17,  0,  0,  0, 89,  4,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x2880 */   0,  0,  0,  0,  0,  0, 14,  0,  0,  0, 47,  0,  0,  0, 89,  4,
+/* 0x2890 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x28a0 */   0,  0, 12,  0,  0,  0, 89,  4,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x28b0 */   0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  3,  0,  0,  0, 89,  4,
+/* 0x28c0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,
+/* 0x28d0 */   0,  0, 14,  0,  0,  0, 89,  4,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x28e0 */   0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  8,  0,  0,  0, 78,  4,
+/* 0x28f0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,
+/* 0x2900 */   0,  0, 10,  0,  0,  0, 89,  4,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2910 */   0,  0,  0,  0,  0,  0, 21,  0,  0,  0, 21,  0,  0,  0, 78,  4,
+/* 0x2920 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,
+/* 0x2930 */   0,  0, 18,  0,  0,  0, 78,  4,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x2940 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x2950 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,
+/* 0x2960 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x2970 */   0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x2980 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,
+/* 0x2990 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x29a0 */   0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 12,  0,  0,  0, 89,  4,
+/* 0x29b0 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,
+/* 0x29c0 */   0,  0,  5,  0,  0,  0, 89,  4,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x29d0 */   0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 14,  0,  0,  0, 89,  4,
+/* 0x29e0 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x29f0 */   0,  0, 15,  0,  0,  0, 89,  4,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x2a00 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 33,  0,  0,  0, 89,  4,
+/* 0x2a10 */   0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x2a20 */   0,  0, 67,  0,  0,  0, 89,  4,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x2a30 */   0,  0,  0,  0,  0,  0, 34,  0,  0,  0, 12,  0,  0,  0, 89,  4,
+/* 0x2a40 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,
+/* 0x2a50 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x2a60 */   0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 14,  0,  0,  0, 89,  4,
+/* 0x2a70 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,
+/* 0x2a80 */   0,  0,  8,  0,  0,  0, 78,  4,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x2a90 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0, 10,  0,  0,  0, 89,  4,
+/* 0x2aa0 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,
+/* 0x2ab0 */   0,  0, 21,  0,  0,  0, 78,  4,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x2ac0 */   0,  0,  0,  0,  0,  0, 41,  0,  0,  0, 18,  0,  0,  0, 78,  4,
+/* 0x2ad0 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,
+/* 0x2ae0 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0, 19,  0,  0,  0,  0,  0,
+/* 0x2af0 */   0,  0,  0,  0,  0,  0, 44,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x2b00 */   0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,
+/* 0x2b10 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0, 17,  0,  0,  0,  0,  0,
+/* 0x2b20 */   0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  3,  0,  0,  0, 89,  4,
+/* 0x2b30 */   0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,
+/* 0x2b40 */   0,  0, 12,  0,  0,  0, 89,  4,  0,  0, 21,  0,  0,  0,  0,  0,
+/* 0x2b50 */   0,  0,  0,  0,  0,  0, 51,  0,  0,  0,  5,  0,  0,  0, 89,  4,
+/* 0x2b60 */   0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,
+/* 0x2b70 */   0,  0, 14,  0,  0,  0, 89,  4,  0,  0, 21,  0,  0,  0,  0,  0,
+/* 0x2b80 */   0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 15,  0,  0,  0, 89,  4,
+/* 0x2b90 */   0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,
+/* 0x2ba0 */   0,  0, 30,  0,  0,  0, 89,  4,  0,  0, 22,  0,  0,  0,  0,  0,
+/* 0x2bb0 */   0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 48,  0,  0,  0, 89,  4,
+/* 0x2bc0 */   0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,
+/* 0x2bd0 */   0,  0, 12,  0,  0,  0, 89,  4,  0,  0, 21,  0,  0,  0,  0,  0,
+/* 0x2be0 */   0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  3,  0,  0,  0, 89,  4,
+/* 0x2bf0 */   0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,
+/* 0x2c00 */   0,  0, 14,  0,  0,  0, 89,  4,  0,  0, 21,  0,  0,  0,  0,  0,
+/* 0x2c10 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  8,  0,  0,  0, 78,  4,
+/* 0x2c20 */   0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  0,
+/* 0x2c30 */   0,  0, 10,  0,  0,  0, 89,  4,  0,  0, 23,  0,  0,  0,  0,  0,
+/* 0x2c40 */   0,  0,  0,  0,  0,  0, 59,  0,  0,  0, 21,  0,  0,  0, 78,  4,
+/* 0x2c50 */   0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,
+/* 0x2c60 */   0,  0, 18,  0,  0,  0, 78,  4,  0,  0, 19,  0,  0,  0,  0,  0,
+/* 0x2c70 */   0,  0,  0,  0,  0,  0, 62,  0,  0,  0,  5,  0,  0,  0, 69,  4,
+/* 0x2c80 */   0,  0,102,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62,  0,
+/* 0x2c90 */   0,  0, 20,  0,  0,  0, 69,  4,  0,  0,103,  0,  0,  0,  0,  0,
+/* 0x2ca0 */   0,  0,  0,  0,  0,  0, 62,  0,  0,  0, 30,  0,  0,  0, 69,  4,
+/* 0x2cb0 */   0,  0,104,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62,  0,
+/* 0x2cc0 */   0,  0, 42,  0,  0,  0, 69,  4,  0,  0,105,  0,  0,  0,  0,  0,
+/* 0x2cd0 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  4,  0,  0,  0, 69,  4,
+/* 0x2ce0 */   0,  0,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  0,
+/* 0x2cf0 */   0,  0,  2,  0,  0,  0, 69,  4,  0,  0,107,  0,  0,  0,  0,  0,
+/* 0x2d00 */   0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  1,  0,  0,  0, 69,  4,
+/* 0x2d10 */   0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,
+/* 0x2d20 */   0,  0,  2,  0,  0,  0, 99,  4,  0,  0,109,  0,  0,  0,  0,  0,
+/* 0x2d30 */   0,  0,  0,  0,  0,  0, 71,  0,  0,  0,  4,  0,  0,  0, 89,  4,
+/* 0x2d40 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,
+/* 0x2d50 */   0,  0, 15,  0,  0,  0, 89,  4,  0,  0, 25,  0,  0,  0,  0,  0,
+/* 0x2d60 */   0,  0,  0,  0,  0,  0, 77,  0,  0,  0,  1,  0,  0,  0, 69,  4,
+/* 0x2d70 */   0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x2d80 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0, 28,  0,  0,  0,  0,  0,
+/* 0x2d90 */   0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  2,  0,  0,  0, 99,  4,
+/* 0x2da0 */   0,  0,109,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,
+/* 0x2db0 */   0,  0,  4,  0,  0,  0, 89,  4,  0,  0, 27,  0,  0,  0,  0,  0,
+/* 0x2dc0 */   0,  0,  0,  0,  0,  0, 86,  0,  0,  0,  6,  0,  0,  0, 89,  4,
+/* 0x2dd0 */   0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  0,
+/* 0x2de0 */   0,  0,  1,  0,  0,  0, 69,  4,  0,  0,108,  0,  0,  0,  0,  0,
+/* 0x2df0 */   0,  0,  0,  0,  0,  0, 87,  0,  0,  0,  6,  0,  0,  0, 89,  4,
+/* 0x2e00 */   0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,
+/* 0x2e10 */   0,  0, 13,  0,  0,  0, 89,  4,  0,  0, 31,  0,  0,  0,  0,  0,
+/* 0x2e20 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  5,  0,  0,  0, 89,  4,
+/* 0x2e30 */   0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x2e40 */   0,  0, 10,  0,  0,  0, 89,  4,  0,  0, 32,  0,  0,  0,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 14,  0,  0,  0, 99,  4,
+/* 0x2e60 */   0,  0,109,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x2e70 */   0,  0, 16,  0,  0,  0, 89,  4,  0,  0, 32,  0,  0,  0,  0,  0,
+/* 0x2e80 */   0,  0,  0,  0,  0,  0, 90,  0,  0,  0,  4,  0,  0,  0, 89,  4,
+/* 0x2e90 */   0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,
+/* 0x2ea0 */   0,  0,  9,  0,  0,  0, 89,  4,  0,  0, 30,  0,  0,  0,  0,  0,
+/* 0x2eb0 */   0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  4,  0,  0,  0, 89,  4,
+/* 0x2ec0 */   0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  0,
+/* 0x2ed0 */   0,  0,  8,  0,  0,  0, 89,  4,  0,  0, 34,  0,  0,  0,  0,  0,
+/* 0x2ee0 */   0,  0,  0,  0,  0,  0, 94,  0,  0,  0,  3,  0,  0,  0, 89,  4,
+/* 0x2ef0 */   0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  0,
+/* 0x2f00 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0, 33,  0,  0,  0,  0,  0,
+/* 0x2f10 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 12,  0,  0,  0, 69,  4,
+/* 0x2f20 */   0,  0,110,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,
+/* 0x2f30 */   0,  0, 17,  0,  0,  0, 78,  4,  0,  0,111,  0,  0,  0,  0,  0,
+/* 0x2f40 */   0,  0,  0,  0,  0,  0, 87, 67, 76, 69, 77, 65, 73, 78,  0, 87,
+/* 0x2f50 */  67, 76, 69, 77, 65, 73, 78, 48, 50,  0, 87, 67, 76, 69, 77, 65,
+/* 0x2f60 */  73, 78, 48, 51,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 87, 67,
+/* 0x2f70 */  76, 69, 67, 85, 84, 80,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0,
+/* 0x2f80 */  78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49,
+/* 0x2f90 */  49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77,
+/* 0x2fa0 */  65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66,
+/* 0x2fb0 */  68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78,
+/* 0x2fc0 */  50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,
+/* 0x2fd0 */   0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x2fe0 */  52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70,
+/* 0x2ff0 */  65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50,
+/* 0x3000 */  66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0,
+/* 0x3010 */  78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54,
+/* 0x3020 */  48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65,
+/* 0x3030 */  83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68,
+/* 0x3040 */  68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78,
+/* 0x3050 */  50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,
+/* 0x3060 */   0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x3070 */  51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83,
+/* 0x3080 */  77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x3090 */  68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0,
+/* 0x30a0 */  78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54,
+/* 0x30b0 */  48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65,
+/* 0x30c0 */  83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69,
+/* 0x30d0 */  83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78,
+/* 0x30e0 */  50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,
+/* 0x30f0 */   0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x3100 */  50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83,
+/* 0x3110 */  77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50,
+/* 0x3120 */  69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0,
+/* 0x3130 */  78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53,
+/* 0x3140 */  48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69,
+/* 0x3150 */  67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69,
+/* 0x3160 */  70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78,
+/* 0x3170 */  50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x3180 */  48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x3190 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x31a0 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 87,
+/* 0x31b0 */  67, 76, 69, 77, 65, 73, 50,  0, 87, 67, 67, 84, 84, 80, 79, 83,
+/* 0x31c0 */   0, 87, 67, 67, 84, 84, 78, 85, 76,  0, 67, 65, 76, 76, 84, 82,
+/* 0x31d0 */  48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65, 76, 76,
+/* 0x31e0 */  84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0, 67, 84,
+/* 0x31f0 */  66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48, 49,  0,
+/* 0x3200 */  67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84, 82, 49,
+/* 0x3210 */  48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76, 76, 84,
+/* 0x3220 */  82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67, 84, 67,
+/* 0x3230 */  76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,  0, 67,
+/* 0x3240 */  84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82, 49, 49,
+/* 0x3250 */   0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76, 84, 82,
+/* 0x3260 */  49, 51,  0, 99,116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,
+/* 0x3270 */ 107, 51, 50, 46, 49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,
+/* 0x3280 */   0, 99,116,111,107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51,
+/* 0x3290 */  50, 46, 52, 48,  0, 87, 67, 82, 69, 76, 79, 67, 49,  0, 82, 69,
+/* 0x32a0 */  76, 79, 67, 51, 50, 48,  0, 82, 69, 76, 51, 50, 66, 73, 71,  0,
+/* 0x32b0 */  82, 69, 76, 79, 67, 51, 50, 74,  0, 82, 69, 76, 51, 50, 69, 78,
+/* 0x32c0 */  68,  0, 87, 67, 82, 69, 76, 83, 69, 76,  0, 87, 67, 76, 69, 77,
+/* 0x32d0 */  65, 73, 52,  0, 99,111,112,121, 95,115,111,117,114, 99,101,  0,
+/* 0x32e0 */  99,111,112,121, 95,100,101,115,116,  0,119,111,114,100,115, 95,
+/* 0x32f0 */ 116,111, 95, 99,111,112,121,  0,108,122,109, 97, 95,115,116, 97,
+/* 0x3300 */  99,107, 95, 97,100,106,117,115,116,  0,108,122,109, 97, 95,117,
+/* 0x3310 */  95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,
+/* 0x3320 */ 108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,  0,
+/* 0x3330 */ 115,116, 97,114,116, 95,111,102, 95,114,101,108,111, 99,115,  0,
+/* 0x3340 */ 102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,116,
+/* 0x3350 */  97,114,116,  0,102,105,108,116,101,114, 95,108,101,110,103,116,
+/* 0x3360 */ 104,  0,102,105,108,116,101,114, 95, 99,116,111,  0,111,114,105,
+/* 0x3370 */ 103,105,110, 97,108, 95,115,116, 97, 99,107,  0,111,114,105,103,
+/* 0x3380 */ 105,110, 97,108, 95,101,110,116,114,121,  0, 82, 95, 51, 56, 54,
+/* 0x3390 */  95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82,
+/* 0x33a0 */  95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 56,
+/* 0x33b0 */   0, 38, 26,  0,  0, 85, 80, 88, 76
 };
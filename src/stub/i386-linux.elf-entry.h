@@ -1,5 +1,5 @@
 /* i386-linux.elf-entry.h
-   created from i386-linux.elf-entry.bin, 37843 (0x93d3) bytes
+   created from i386-linux.elf-entry.bin, 16533 (0x4095) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_ELF_ENTRY_SIZE    37843
-#define STUB_I386_LINUX_ELF_ENTRY_ADLER32 0x1ba2dc7d
-#define STUB_I386_LINUX_ELF_ENTRY_CRC32   0x0ccb5175
+#define STUB_I386_LINUX_ELF_ENTRY_SIZE    16533
+#define STUB_I386_LINUX_ELF_ENTRY_ADLER32 0x3b37b442
+#define STUB_I386_LINUX_ELF_ENTRY_CRC32   0xcc7ce366
 
-unsigned char stub_i386_linux_elf_entry[37843] = {
+unsigned char stub_i386_linux_elf_entry[16533] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 208, 34,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -477,1929 +477,597 @@ unsigned char stub_i386_linux_elf_entry[37843] = {
 /* 0x1b60 */  24, 91, 89,106,  5, 90,106,125, 88,205,128, 90, 88, 80, 41,253,
 /* 0x1b70 */   1,197,  3, 70,240,139,141,246,255,255,255,255,226,141, 92, 36,
 /* 0x1b80 */   4,106, 90, 88,205,128, 61,  0,240,255,255,124,  1,244,194, 24,
-/* 0x1b90 */   0, 93,232, 71,255,255,255,  0,  0,  0,  0,102,105,108,101, 32,
-/* 0x1ba0 */ 102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,105, 51, 56,
-/* 0x1bb0 */  54, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x1bc0 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x1bd0 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x1be0 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x1bf0 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x1c00 */ 103,115, 10, 32, 32, 48, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32,
-/* 0x1c10 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42,
-/* 0x1c40 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1c50 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49,
-/* 0x1c60 */  32, 76, 69, 88, 69, 67, 48, 48, 57, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1ca0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1cb0 */  32, 32, 50, 32, 76, 69, 88, 69, 67, 48, 49, 48, 32, 32, 32, 32,
-/* 0x1cc0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1cf0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1d00 */  76, 89, 10, 32, 32, 51, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32,
-/* 0x1d10 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 54, 32, 32, 50, 42, 42,
-/* 0x1d40 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1d50 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52,
-/* 0x1d60 */  32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d70 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 52, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1da0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1db0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 50, 66, 70, 65,
-/* 0x1dc0 */  83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dd0 */  54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 98, 32,
-/* 0x1df0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1e00 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 78, 50,
-/* 0x1e10 */  66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1e50 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55,
-/* 0x1e60 */  32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e80 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 53, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1ea0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1eb0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 78, 50, 66, 70, 65,
-/* 0x1ec0 */  83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54, 49, 32,
-/* 0x1ef0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1f00 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1f10 */  10, 32, 32, 57, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32,
-/* 0x1f20 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48,
-/* 0x1f30 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f40 */  32, 48, 48, 48, 48, 48, 48, 54, 97, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1f50 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1f60 */  78, 76, 89, 10, 32, 49, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32,
-/* 0x1f80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 55, 32, 32, 50, 42,
-/* 0x1fa0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1fb0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1fc0 */  49, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1ff0 */  48, 48, 48, 48, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2000 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2010 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 78, 50, 66, 68,
-/* 0x2020 */  69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  51,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2040 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 51,
-/* 0x2050 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2060 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2070 */  89, 10, 32, 49, 51, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 32,
-/* 0x2080 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20a0 */  32, 32, 48, 48, 48, 48, 48, 48,100, 49, 32, 32, 50, 42, 42, 48,
-/* 0x20b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x20c0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 52, 32,
-/* 0x20d0 */  78, 50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2100 */  48, 48,100,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2110 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2120 */  68, 79, 78, 76, 89, 10, 32, 49, 53, 32, 78, 50, 66, 83, 77, 65,
-/* 0x2130 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2140 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101,100, 32, 32,
-/* 0x2160 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2170 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 54, 32, 78, 50, 66,
-/* 0x2180 */  70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2190 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101,
-/* 0x21b0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x21c0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 55, 32,
-/* 0x21d0 */  78, 50, 66, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2200 */  48, 48,102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2210 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2220 */  49, 56, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32,
-/* 0x2230 */  32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2250 */  48, 48, 48, 48, 48,102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2260 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2270 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 57, 32, 78, 50, 66,
-/* 0x2280 */  70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2290 */  48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x22a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 48,
-/* 0x22b0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x22c0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x22d0 */  76, 89, 10, 32, 50, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32,
-/* 0x22e0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48,
-/* 0x22f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 48, 32, 32, 50, 42, 42,
-/* 0x2310 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2320 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 49,
-/* 0x2330 */  32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2350 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2360 */  48, 48, 49, 51, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2370 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2380 */  32, 50, 50, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32,
-/* 0x2390 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48,
-/* 0x23a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x23b0 */  48, 48, 48, 48, 48, 49, 51, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x23c0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x23d0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 51, 32, 78, 50,
-/* 0x23e0 */  68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x23f0 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2400 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2410 */  51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2420 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2430 */  78, 76, 89, 10, 32, 50, 52, 32, 78, 50, 68, 70, 65, 83, 49, 49,
-/* 0x2440 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32,
-/* 0x2450 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 98, 32, 32, 50, 42,
-/* 0x2470 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2480 */  65, 68, 79, 78, 76, 89, 10, 32, 50, 53, 32, 78, 50, 68, 68, 69,
-/* 0x2490 */  67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24a0 */  98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 49, 32,
-/* 0x24c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x24d0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 54, 32, 78, 50,
-/* 0x24e0 */  68, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x24f0 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2500 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2510 */  52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2520 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2530 */  78, 76, 89, 10, 32, 50, 55, 32, 78, 50, 68, 70, 65, 83, 50, 48,
-/* 0x2540 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32,
-/* 0x2550 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2560 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 53, 49, 32, 32, 50, 42,
-/* 0x2570 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2580 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50,
-/* 0x2590 */  56, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x25a0 */  48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x25b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x25c0 */  48, 48, 48, 49, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x25d0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x25e0 */  10, 32, 50, 57, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48,
-/* 0x2600 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2610 */  32, 48, 48, 48, 48, 48, 49, 54, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2620 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2630 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 48, 32, 78,
-/* 0x2640 */  50, 68, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2650 */  48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2660 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2670 */  49, 55, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2680 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2690 */  79, 78, 76, 89, 10, 32, 51, 49, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x26a0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 50, 32,
-/* 0x26b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x26c0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 56, 51, 32, 32, 50,
-/* 0x26d0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x26e0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x26f0 */  51, 50, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32,
-/* 0x2700 */  32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2710 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2720 */  48, 48, 48, 48, 49,100, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2730 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2740 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 51, 32, 78, 50, 68,
-/* 0x2750 */  70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2760 */  48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2770 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,101,
-/* 0x2780 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2790 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x27a0 */  76, 89, 10, 32, 51, 52, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32,
-/* 0x27b0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x27c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27d0 */  48, 32, 32, 48, 48, 48, 48, 48, 49,102, 49, 32, 32, 50, 42, 42,
-/* 0x27e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x27f0 */  68, 79, 78, 76, 89, 10, 32, 51, 53, 32, 78, 50, 68, 70, 65, 83,
-/* 0x2800 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x2810 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2820 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102, 51, 32, 32,
-/* 0x2830 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2840 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 54, 32, 78, 50, 68,
-/* 0x2850 */  68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2860 */  48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2870 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102,
-/* 0x2880 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2890 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 55, 32,
-/* 0x28a0 */  78, 50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x28b0 */  48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x28d0 */  48, 49,102,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x28e0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x28f0 */  68, 79, 78, 76, 89, 10, 32, 51, 56, 32, 78, 50, 68, 70, 65, 83,
-/* 0x2900 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57,
-/* 0x2910 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2920 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 48, 98, 32, 32,
-/* 0x2930 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2940 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2950 */  32, 51, 57, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32,
-/* 0x2960 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48,
-/* 0x2970 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2980 */  48, 48, 48, 48, 48, 50, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2990 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x29a0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 48, 32, 78, 50,
-/* 0x29b0 */  68, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x29c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x29d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x29e0 */  51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x29f0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49,
-/* 0x2a00 */  32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2a10 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a20 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2a30 */  48, 48, 50, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2a40 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2a50 */  65, 68, 79, 78, 76, 89, 10, 32, 52, 50, 32, 78, 50, 69, 70, 65,
-/* 0x2a60 */  83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a70 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2a80 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 51,100, 32,
-/* 0x2a90 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2aa0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2ab0 */  10, 32, 52, 51, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32,
-/* 0x2ac0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48,
-/* 0x2ad0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2ae0 */  32, 48, 48, 48, 48, 48, 50, 51,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2af0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2b00 */  78, 76, 89, 10, 32, 52, 52, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x2b10 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32,
-/* 0x2b20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2b30 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 52, 53, 32, 32, 50, 42,
-/* 0x2b40 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2b50 */  65, 68, 79, 78, 76, 89, 10, 32, 52, 53, 32, 78, 50, 69, 83, 77,
-/* 0x2b60 */  65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b70 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2b80 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 48, 32,
-/* 0x2b90 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2ba0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2bb0 */  10, 32, 52, 54, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32, 32,
-/* 0x2bc0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48,
-/* 0x2bd0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2be0 */  32, 48, 48, 48, 48, 48, 50, 53, 53, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2bf0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2c00 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 55, 32, 78,
-/* 0x2c10 */  50, 69, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2c20 */  48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2c30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2c40 */  50, 53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2c50 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52,
-/* 0x2c60 */  56, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2c70 */  48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2c80 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2c90 */  48, 48, 48, 50, 54, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2ca0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2cb0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 57, 32, 78, 50, 69, 70,
-/* 0x2cc0 */  65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2cd0 */  48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2ce0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 55, 56,
-/* 0x2cf0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2d00 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2d10 */  89, 10, 32, 53, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 32,
-/* 0x2d20 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53,102, 32, 32, 48, 48,
-/* 0x2d30 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d40 */  32, 32, 48, 48, 48, 48, 48, 50, 56, 55, 32, 32, 50, 42, 42, 48,
-/* 0x2d50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2d60 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 49, 32,
-/* 0x2d70 */  78, 50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2d80 */  48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2da0 */  48, 50,101, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2db0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2dc0 */  68, 79, 78, 76, 89, 10, 32, 53, 50, 32, 78, 50, 69, 70, 65, 83,
-/* 0x2dd0 */  52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102,
-/* 0x2de0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2df0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,102, 51, 32, 32,
-/* 0x2e00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2e10 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2e20 */  32, 53, 51, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32,
-/* 0x2e30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x2e40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2e50 */  48, 48, 48, 48, 48, 51, 48, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2e60 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2e70 */  76, 89, 10, 32, 53, 52, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32,
-/* 0x2e80 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x2e90 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ea0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 48, 52, 32, 32, 50, 42, 42,
-/* 0x2eb0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2ec0 */  68, 79, 78, 76, 89, 10, 32, 53, 53, 32, 78, 50, 69, 68, 69, 67,
-/* 0x2ed0 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57,
-/* 0x2ee0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2ef0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48, 55, 32, 32,
-/* 0x2f00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2f10 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 54, 32, 78, 50, 69,
-/* 0x2f20 */  83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f30 */  48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49,
-/* 0x2f50 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2f60 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2f70 */  76, 89, 10, 32, 53, 55, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32,
-/* 0x2f80 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48,
-/* 0x2f90 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fa0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 99, 32, 32, 50, 42, 42,
-/* 0x2fb0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2fc0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 56,
-/* 0x2fd0 */  32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2fe0 */  48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ff0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3000 */  48, 48, 51, 51, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3010 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3020 */  65, 68, 79, 78, 76, 89, 10, 32, 53, 57, 32, 78, 50, 69, 68, 69,
-/* 0x3030 */  67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3040 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3050 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52, 98, 32,
-/* 0x3060 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3070 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 48, 32, 76, 90,
-/* 0x3080 */  77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3090 */  48, 48, 50,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x30a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x30b0 */  52, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x30c0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x30d0 */  78, 76, 89, 10, 32, 54, 49, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x30e0 */  48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32,
-/* 0x30f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3100 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 55, 57, 32, 32, 50, 42,
-/* 0x3110 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3120 */  65, 68, 79, 78, 76, 89, 10, 32, 54, 50, 32, 76, 90, 77, 65, 95,
-/* 0x3130 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 56,
-/* 0x3140 */  54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3150 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 99, 49, 32,
-/* 0x3160 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3170 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 51, 32, 76, 90,
-/* 0x3180 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3190 */  48, 97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x31a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101,
-/* 0x31b0 */  52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x31c0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 52,
-/* 0x31d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x31e0 */  48, 48, 48, 48, 48, 49, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3200 */  48, 49, 56, 99,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3210 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3220 */  32, 54, 53, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 32, 32, 32,
-/* 0x3230 */  32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48,
-/* 0x3240 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3250 */  48, 48, 48, 48, 49, 56,101, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3260 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3270 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 54, 32, 67, 84,
-/* 0x3280 */  67, 76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3290 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x32a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,
-/* 0x32b0 */ 102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x32c0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x32d0 */  78, 76, 89, 10, 32, 54, 55, 32, 67, 65, 76, 76, 84, 82, 48, 49,
-/* 0x32e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x32f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3300 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 56,102, 97, 32, 32, 50, 42,
-/* 0x3310 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3320 */  65, 68, 79, 78, 76, 89, 10, 32, 54, 56, 32, 67, 84, 66, 83, 72,
-/* 0x3330 */  82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3340 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3350 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,102,102, 32,
-/* 0x3360 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3370 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 57, 32, 67, 84,
-/* 0x3380 */  66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3390 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x33a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x33b0 */  48, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x33c0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 48,
-/* 0x33d0 */  32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x33e0 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3400 */  48, 49, 57, 48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3410 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3420 */  32, 55, 49, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32,
-/* 0x3430 */  32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48,
-/* 0x3440 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3450 */  48, 48, 48, 48, 49, 57, 48, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3460 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3470 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 50, 32, 67, 65,
-/* 0x3480 */  76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3490 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x34a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x34b0 */  49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x34c0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x34d0 */  78, 76, 89, 10, 32, 55, 51, 32, 67, 65, 76, 76, 84, 82, 69, 56,
-/* 0x34e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x34f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3500 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 49,100, 32, 32, 50, 42,
-/* 0x3510 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3520 */  65, 68, 79, 78, 76, 89, 10, 32, 55, 52, 32, 67, 65, 76, 76, 84,
-/* 0x3530 */  82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3540 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3550 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 49,102, 32,
-/* 0x3560 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3570 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 53, 32, 67, 65,
-/* 0x3580 */  76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3590 */  48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x35a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x35b0 */  50, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x35c0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x35d0 */  78, 76, 89, 10, 32, 55, 54, 32, 67, 84, 67, 76, 69, 86, 69, 50,
-/* 0x35e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x35f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3600 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50, 53, 32, 32, 50, 42,
-/* 0x3610 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3620 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55,
-/* 0x3630 */  55, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32, 32,
-/* 0x3640 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3650 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3660 */  48, 48, 49, 57, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3670 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3680 */  10, 32, 55, 56, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32,
-/* 0x3690 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x36a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x36b0 */  32, 48, 48, 48, 48, 49, 57, 50, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x36c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x36d0 */  78, 76, 89, 10, 32, 55, 57, 32, 67, 84, 66, 82, 79, 82, 49, 49,
-/* 0x36e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x36f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3700 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51, 48, 32, 32, 50, 42,
-/* 0x3710 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3720 */  65, 68, 79, 78, 76, 89, 10, 32, 56, 48, 32, 67, 84, 66, 83, 87,
-/* 0x3730 */  65, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3740 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3750 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51, 50, 32,
-/* 0x3760 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3770 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 49, 32, 67, 65,
-/* 0x3780 */  76, 76, 84, 82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3790 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x37a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x37b0 */  51, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x37c0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x37d0 */  78, 76, 89, 10, 32, 56, 50, 32, 76, 69, 88, 69, 67, 48, 49, 53,
-/* 0x37e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,100, 32, 32,
-/* 0x37f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51, 99, 32, 32, 50, 42,
-/* 0x3810 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3820 */  65, 68, 79, 78, 76, 89, 10, 32, 56, 51, 32, 76, 88, 85, 78, 70,
-/* 0x3830 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3840 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3850 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 57, 32,
-/* 0x3860 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3870 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3880 */  10, 32, 56, 52, 32, 76, 88, 85, 78, 70, 48, 48, 50, 32, 32, 32,
-/* 0x3890 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x38a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x38b0 */  32, 48, 48, 48, 48, 49, 57, 53, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x38c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x38d0 */  78, 76, 89, 10, 32, 56, 53, 32, 77, 82, 85, 66, 89, 84, 69, 48,
-/* 0x38e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x38f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3900 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54, 48, 32, 32, 50, 42,
-/* 0x3910 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3920 */  65, 68, 79, 78, 76, 89, 10, 32, 56, 54, 32, 76, 88, 77, 82, 85,
-/* 0x3930 */  48, 48, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3940 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3950 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54, 50, 32,
-/* 0x3960 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3970 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3980 */  10, 32, 56, 55, 32, 76, 88, 77, 82, 85, 48, 48, 54, 32, 32, 32,
-/* 0x3990 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48,
-/* 0x39a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x39b0 */  32, 48, 48, 48, 48, 49, 57, 54, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x39c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x39d0 */  78, 76, 89, 10, 32, 56, 56, 32, 76, 88, 77, 82, 85, 48, 48, 55,
-/* 0x39e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32,
-/* 0x39f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3a00 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54,101, 32, 32, 50, 42,
-/* 0x3a10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3a20 */  65, 68, 79, 78, 76, 89, 10, 32, 56, 57, 32, 76, 88, 85, 78, 70,
-/* 0x3a30 */  48, 48, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a40 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3a50 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 53, 32,
-/* 0x3a60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3a70 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 48, 32, 76, 88,
-/* 0x3a80 */  85, 78, 70, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3a90 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3aa0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3ab0 */  55, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3ac0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3ad0 */  78, 76, 89, 10, 32, 57, 49, 32, 76, 88, 74, 67, 67, 48, 49, 48,
-/* 0x3ae0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32,
-/* 0x3af0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3b00 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55,101, 32, 32, 50, 42,
-/* 0x3b10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3b20 */  65, 68, 79, 78, 76, 89, 10, 32, 57, 50, 32, 76, 88, 77, 82, 85,
-/* 0x3b30 */  48, 52, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b40 */  51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3b50 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 49, 32,
-/* 0x3b60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3b70 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 51, 32, 76, 88,
-/* 0x3b80 */  77, 82, 85, 48, 52, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3b90 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3ba0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3bb0 */  56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3bc0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 52,
-/* 0x3bd0 */  32, 76, 88, 74, 67, 67, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3be0 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bf0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3c00 */  48, 49, 57, 56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3c10 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3c20 */  65, 68, 79, 78, 76, 89, 10, 32, 57, 53, 32, 76, 88, 74, 67, 67,
-/* 0x3c30 */  48, 50, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c40 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3c50 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 56, 32,
-/* 0x3c60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3c70 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3c80 */  10, 32, 57, 54, 32, 76, 88, 74, 67, 67, 48, 50, 51, 32, 32, 32,
-/* 0x3c90 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48,
-/* 0x3ca0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3cb0 */  32, 48, 48, 48, 48, 49, 57, 56,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3cc0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3cd0 */  78, 76, 89, 10, 32, 57, 55, 32, 76, 88, 85, 78, 70, 48, 51, 55,
-/* 0x3ce0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x3cf0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3d00 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 57, 52, 32, 32, 50, 42,
-/* 0x3d10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3d20 */  65, 68, 79, 78, 76, 89, 10, 32, 57, 56, 32, 76, 88, 85, 78, 70,
-/* 0x3d30 */  51, 56, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d40 */  49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3d50 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 57, 54, 32,
-/* 0x3d60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3d70 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 57, 32, 76, 88,
-/* 0x3d80 */  85, 78, 70, 51, 56, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3d90 */  48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3da0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3db0 */  57, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3dc0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 48,
-/* 0x3dd0 */  32, 76, 88, 85, 78, 70, 51, 56, 56, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3de0 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3df0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3e00 */  48, 49, 57, 97, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3e10 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3e20 */  65, 68, 79, 78, 76, 89, 10, 49, 48, 49, 32, 76, 88, 85, 78, 70,
-/* 0x3e30 */  52, 56, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e40 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3e50 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 97, 51, 32,
-/* 0x3e60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3e70 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 50, 32, 76, 88,
-/* 0x3e80 */  85, 78, 70, 52, 56, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3e90 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3ea0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3eb0 */  97, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3ec0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3ed0 */  78, 76, 89, 10, 49, 48, 51, 32, 76, 88, 77, 82, 85, 48, 54, 53,
-/* 0x3ee0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x3ef0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3f00 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 97, 57, 32, 32, 50, 42,
-/* 0x3f10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3f20 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48,
-/* 0x3f30 */  52, 32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 32, 32, 32, 32, 32,
-/* 0x3f40 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3f60 */  48, 48, 49, 57, 97,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3f70 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3f80 */  10, 49, 48, 53, 32, 77, 82, 85, 65, 82, 66, 51, 48, 32, 32, 32,
-/* 0x3f90 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48,
-/* 0x3fa0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3fb0 */  32, 48, 48, 48, 48, 49, 57, 98, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3fc0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3fd0 */  78, 76, 89, 10, 49, 48, 54, 32, 77, 82, 85, 66, 73, 84, 83, 51,
-/* 0x3fe0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x3ff0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4000 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 98, 49, 32, 32, 50, 42,
-/* 0x4010 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4020 */  65, 68, 79, 78, 76, 89, 10, 49, 48, 55, 32, 77, 82, 85, 65, 82,
-/* 0x4030 */  66, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4040 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4050 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 98, 51, 32,
-/* 0x4060 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4070 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 56, 32, 76, 88,
-/* 0x4080 */  77, 82, 85, 48, 55, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4090 */  48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x40a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x40b0 */  98, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x40c0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x40d0 */  78, 76, 89, 10, 49, 48, 57, 32, 77, 82, 85, 66, 89, 84, 69, 52,
-/* 0x40e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32,
-/* 0x40f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4100 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 98,102, 32, 32, 50, 42,
-/* 0x4110 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4120 */  65, 68, 79, 78, 76, 89, 10, 49, 49, 48, 32, 77, 82, 85, 66, 73,
-/* 0x4130 */  84, 83, 52, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4140 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4150 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 99, 50, 32,
-/* 0x4160 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4170 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 49, 32, 77, 82,
-/* 0x4180 */  85, 65, 82, 66, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4190 */  48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x41a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x41b0 */  99, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x41c0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 50,
-/* 0x41d0 */  32, 76, 88, 77, 82, 85, 48, 56, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x41e0 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x41f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4200 */  48, 49, 57, 99, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4210 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4220 */  49, 49, 51, 32, 77, 82, 85, 66, 89, 84, 69, 53, 32, 32, 32, 32,
-/* 0x4230 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x4240 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4250 */  48, 48, 48, 48, 49, 57, 99,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4260 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4270 */  76, 89, 10, 49, 49, 52, 32, 77, 82, 85, 65, 82, 66, 54, 48, 32,
-/* 0x4280 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48,
-/* 0x4290 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42a0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 99,102, 32, 32, 50, 42, 42,
-/* 0x42b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x42c0 */  68, 79, 78, 76, 89, 10, 49, 49, 53, 32, 77, 82, 85, 66, 73, 84,
-/* 0x42d0 */  83, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x42e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x42f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 48, 32, 32,
-/* 0x4300 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4310 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 54, 32, 77, 82, 85,
-/* 0x4320 */  65, 82, 66, 55, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4330 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4340 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100,
-/* 0x4350 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4360 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 55, 32,
-/* 0x4370 */  76, 88, 77, 82, 85, 48, 57, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4380 */  48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4390 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x43a0 */  49, 57,100, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x43b0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x43c0 */  68, 79, 78, 76, 89, 10, 49, 49, 56, 32, 77, 82, 85, 66, 89, 84,
-/* 0x43d0 */  69, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x43e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x43f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,101, 49, 32, 32,
-/* 0x4400 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4410 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 57, 32, 77, 82, 85,
-/* 0x4420 */  65, 82, 66, 56, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4430 */  48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4440 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,101,
-/* 0x4450 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4460 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 48, 32,
-/* 0x4470 */  77, 82, 85, 66, 73, 84, 83, 54, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4480 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4490 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x44a0 */  49, 57,101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x44b0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x44c0 */  50, 49, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 32, 32, 32, 32,
-/* 0x44d0 */  32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x44e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x44f0 */  48, 48, 48, 49, 57,101, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4500 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4510 */  89, 10, 49, 50, 50, 32, 76, 88, 77, 82, 85, 49, 48, 48, 32, 32,
-/* 0x4520 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48,
-/* 0x4530 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4540 */  32, 32, 48, 48, 48, 48, 49, 57,101, 97, 32, 32, 50, 42, 42, 48,
-/* 0x4550 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x4560 */  79, 78, 76, 89, 10, 49, 50, 51, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x4570 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x4580 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4590 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,102, 97, 32, 32, 50,
-/* 0x45a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x45b0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 52, 32, 76, 88, 77, 82,
-/* 0x45c0 */  85, 49, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x45d0 */  48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x45e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,102,102,
-/* 0x45f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4600 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 53, 32, 76,
-/* 0x4610 */  88, 77, 82, 85, 49, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4620 */  48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4630 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x4640 */  97, 48, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4650 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50,
-/* 0x4660 */  54, 32, 76, 88, 85, 78, 70, 48, 52, 49, 32, 32, 32, 32, 32, 32,
-/* 0x4670 */  48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4680 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4690 */  48, 48, 49, 97, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x46a0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x46b0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 55, 32, 76, 88, 85, 78,
-/* 0x46c0 */  70, 48, 52, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x46d0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x46e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48, 98,
-/* 0x46f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4700 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 56, 32, 76,
-/* 0x4710 */  69, 88, 69, 67, 48, 49, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4720 */  48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4730 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x4740 */  97, 48, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4750 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x4760 */  79, 78, 76, 89, 10, 49, 50, 57, 32, 76, 88, 77, 82, 85, 48, 49,
-/* 0x4770 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x4780 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4790 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 48, 32, 32, 50,
-/* 0x47a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x47b0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 48, 32, 76, 88, 74, 77,
-/* 0x47c0 */  80, 65, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x47d0 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x47e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 49,
-/* 0x47f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4800 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 49, 32, 76,
-/* 0x4810 */  88, 67, 65, 76, 76, 66, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4820 */  48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4830 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x4840 */  97, 49, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4850 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51,
-/* 0x4860 */  50, 32, 76, 88, 85, 78, 70, 48, 50, 49, 32, 32, 32, 32, 32, 32,
-/* 0x4870 */  48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4880 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4890 */  48, 48, 49, 97, 49, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x48a0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x48b0 */  10, 49, 51, 51, 32, 76, 88, 77, 82, 85, 48, 50, 50, 32, 32, 32,
-/* 0x48c0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48,
-/* 0x48d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x48e0 */  32, 48, 48, 48, 48, 49, 97, 49, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x48f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4900 */  78, 76, 89, 10, 49, 51, 52, 32, 76, 88, 74, 77, 80, 65, 48, 49,
-/* 0x4910 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x4920 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4930 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49,101, 32, 32, 50, 42,
-/* 0x4940 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4950 */  65, 68, 79, 78, 76, 89, 10, 49, 51, 53, 32, 76, 88, 67, 65, 76,
-/* 0x4960 */  76, 66, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4970 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4980 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 50, 48, 32,
-/* 0x4990 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x49a0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 54, 32, 77, 82,
-/* 0x49b0 */  85, 66, 73, 84, 83, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x49c0 */  48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x49d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x49e0 */  50, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x49f0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 55,
-/* 0x4a00 */  32, 76, 88, 77, 82, 85, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4a10 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a20 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4a30 */  48, 49, 97, 50, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4a40 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4a50 */  49, 51, 56, 32, 77, 82, 85, 66, 89, 84, 69, 49, 32, 32, 32, 32,
-/* 0x4a60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x4a70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4a80 */  48, 48, 48, 48, 49, 97, 50, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4a90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4aa0 */  76, 89, 10, 49, 51, 57, 32, 77, 82, 85, 65, 82, 66, 49, 48, 32,
-/* 0x4ab0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48,
-/* 0x4ac0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ad0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 50, 55, 32, 32, 50, 42, 42,
-/* 0x4ae0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x4af0 */  68, 79, 78, 76, 89, 10, 49, 52, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4b00 */  52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x4b10 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4b20 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 50, 56, 32, 32,
-/* 0x4b30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4b40 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4b50 */  49, 52, 49, 32, 76, 88, 85, 78, 70, 48, 51, 48, 32, 32, 32, 32,
-/* 0x4b60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x4b70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4b80 */  48, 48, 48, 48, 49, 97, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4b90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4ba0 */  76, 89, 10, 49, 52, 50, 32, 76, 88, 74, 67, 67, 48, 48, 48, 32,
-/* 0x4bb0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48,
-/* 0x4bc0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4bd0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 51, 48, 32, 32, 50, 42, 42,
-/* 0x4be0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x4bf0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 51,
-/* 0x4c00 */  32, 76, 88, 67, 74, 48, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4c10 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c20 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4c30 */  48, 49, 97, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4c40 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4c50 */  49, 52, 52, 32, 76, 88, 67, 74, 49, 77, 82, 85, 32, 32, 32, 32,
-/* 0x4c60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48,
-/* 0x4c70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4c80 */  48, 48, 48, 48, 49, 97, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4c90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4ca0 */  76, 89, 10, 49, 52, 53, 32, 76, 88, 67, 65, 76, 74, 77, 80, 32,
-/* 0x4cb0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x4cc0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4cd0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 51,100, 32, 32, 50, 42, 42,
-/* 0x4ce0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x4cf0 */  68, 79, 78, 76, 89, 10, 49, 52, 54, 32, 76, 88, 67, 65, 76, 76,
-/* 0x4d00 */  48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x4d10 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4d20 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 52, 48, 32, 32,
-/* 0x4d30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4d40 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4d50 */  49, 52, 55, 32, 76, 88, 67, 65, 76, 76, 48, 49, 32, 32, 32, 32,
-/* 0x4d60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48,
-/* 0x4d70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4d80 */  48, 48, 48, 48, 49, 97, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4d90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4da0 */  76, 89, 10, 49, 52, 56, 32, 76, 88, 67, 74, 50, 77, 82, 85, 32,
-/* 0x4db0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x4dc0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4dd0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 52, 53, 32, 32, 50, 42, 42,
-/* 0x4de0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x4df0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 57,
-/* 0x4e00 */  32, 76, 88, 67, 74, 52, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4e10 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e20 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4e30 */  48, 49, 97, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4e40 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x4e50 */  65, 68, 79, 78, 76, 89, 10, 49, 53, 48, 32, 76, 88, 67, 74, 54,
-/* 0x4e60 */  77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e70 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4e80 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 52, 57, 32,
-/* 0x4e90 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4ea0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4eb0 */  10, 49, 53, 49, 32, 76, 88, 67, 74, 55, 77, 82, 85, 32, 32, 32,
-/* 0x4ec0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x4ed0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ee0 */  32, 48, 48, 48, 48, 49, 97, 52, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4ef0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x4f00 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 50, 32, 76,
-/* 0x4f10 */  88, 67, 74, 56, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4f20 */  48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4f30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x4f40 */  97, 52,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4f50 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x4f60 */  79, 78, 76, 89, 10, 49, 53, 51, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x4f70 */  52, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x4f80 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4f90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 53, 48, 32, 32, 50,
-/* 0x4fa0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x4fb0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4fc0 */  53, 52, 32, 76, 88, 77, 82, 85, 48, 53, 53, 32, 32, 32, 32, 32,
-/* 0x4fd0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4fe0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4ff0 */  48, 48, 48, 49, 97, 53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x5000 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5010 */  89, 10, 49, 53, 53, 32, 77, 82, 85, 66, 89, 84, 69, 50, 32, 32,
-/* 0x5020 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x5030 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5040 */  32, 32, 48, 48, 48, 48, 49, 97, 53, 55, 32, 32, 50, 42, 42, 48,
-/* 0x5050 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x5060 */  79, 78, 76, 89, 10, 49, 53, 54, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x5070 */  50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x5080 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5090 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 53, 99, 32, 32, 50,
-/* 0x50a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x50b0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 55, 32, 77, 82, 85, 65,
-/* 0x50c0 */  82, 66, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x50d0 */  48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x50e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 54, 49,
-/* 0x50f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x5100 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 56, 32, 76,
-/* 0x5110 */  88, 77, 82, 85, 48, 53, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x5120 */  48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5130 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x5140 */  97, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x5150 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53,
-/* 0x5160 */  57, 32, 76, 88, 77, 82, 85, 48, 53, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5170 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5180 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5190 */  48, 48, 49, 97, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x51a0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x51b0 */  10, 49, 54, 48, 32, 76, 88, 85, 78, 70, 48, 51, 53, 32, 32, 32,
-/* 0x51c0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48,
-/* 0x51d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x51e0 */  32, 48, 48, 48, 48, 49, 97, 54,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x51f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x5200 */  78, 76, 89, 10, 49, 54, 49, 32, 99,116,111,107, 51, 50, 46, 48,
-/* 0x5210 */  48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32,
-/* 0x5220 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5230 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 55, 51, 32, 32, 50, 42,
-/* 0x5240 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x5250 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54,
-/* 0x5260 */  50, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32,
-/* 0x5270 */  48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5280 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5290 */  48, 48, 49, 97, 55, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x52a0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x52b0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 51, 32, 99,116,111,107,
-/* 0x52c0 */  51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x52d0 */  50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x52e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 56, 56,
-/* 0x52f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x5300 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5310 */  89, 10, 49, 54, 52, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32,
-/* 0x5320 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48,
-/* 0x5330 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5340 */  32, 32, 48, 48, 48, 48, 49, 97, 97, 56, 32, 32, 50, 42, 42, 48,
-/* 0x5350 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x5360 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 53, 32,
-/* 0x5370 */  99,116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 48,
-/* 0x5380 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5390 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x53a0 */  49, 97, 98, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x53b0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x53c0 */  68, 79, 78, 76, 89, 10, 49, 54, 54, 32, 76, 69, 88, 69, 67, 48,
-/* 0x53d0 */  49, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x53e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 98, 55, 32, 32,
-/* 0x5400 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x5410 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 55, 32, 76, 69, 88,
-/* 0x5420 */  69, 67, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5430 */  48,101, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5440 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 98,
-/* 0x5450 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x5460 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x5470 */  76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x5480 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5490 */  32, 32, 78, 50, 66, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x54a0 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48,
-/* 0x54b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x54c0 */  66, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x54d0 */  78, 50, 66, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x54e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x54f0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68,
-/* 0x5500 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5510 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,  9, 48,
-/* 0x5520 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48,
-/* 0x5530 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5540 */  32, 32, 78, 50, 66, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5550 */  48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x5560 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5570 */  66, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5580 */  78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5590 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x55a0 */  54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70,
-/* 0x55b0 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x55c0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48,  9, 48,
-/* 0x55d0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48,
-/* 0x55e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x55f0 */  32, 32, 78, 50, 68, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5600 */  48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48,
-/* 0x5610 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5620 */  68, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5630 */  78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5640 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5650 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68,
-/* 0x5660 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5670 */  32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48,  9, 48,
-/* 0x5680 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 50, 48,
-/* 0x5690 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x56a0 */  32, 32, 78, 50, 68, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x56b0 */  48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x56c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x56d0 */  68, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x56e0 */  78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x56f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x5700 */  54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x5710 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5720 */  32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,  9, 48,
-/* 0x5730 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48,
-/* 0x5740 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5750 */  32, 32, 78, 50, 69, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5760 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48,
-/* 0x5770 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5780 */  69, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5790 */  78, 50, 69, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x57a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x57b0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68,
-/* 0x57c0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x57d0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48,  9, 48,
-/* 0x57e0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x57f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5800 */  32, 32, 78, 50, 69, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5810 */  48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x5820 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5830 */  69, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5840 */  78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5850 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x5860 */  54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70,
-/* 0x5870 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5880 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,  9, 48,
-/* 0x5890 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48,
-/* 0x58a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x58b0 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x58c0 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48,
-/* 0x58d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x58e0 */  76, 76, 84, 82, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x58f0 */  67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5900 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5910 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x5920 */  84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5930 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,  9, 48,
-/* 0x5940 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x5950 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5960 */  32, 32, 76, 88, 85, 78, 70, 48, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5970 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 49, 48, 10, 48, 48, 48,
-/* 0x5980 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5990 */  74, 67, 67, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x59a0 */  76, 88, 74, 67, 67, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x59c0 */  51, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x59d0 */  70, 48, 51, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x59e0 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48,  9, 48,
-/* 0x59f0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 55, 48,
-/* 0x5a00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5a10 */  32, 32, 76, 88, 77, 82, 85, 49, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5a20 */  48, 48, 48, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10, 48, 48, 48,
-/* 0x5a30 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5a40 */  85, 78, 70, 48, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5a50 */  76, 88, 85, 78, 70, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5a60 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x5a70 */  52, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x5a80 */  70, 48, 52, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5a90 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 51, 48,  9, 48,
-/* 0x5aa0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48,
-/* 0x5ab0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5ac0 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5ad0 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 48, 48, 48,
-/* 0x5ae0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5af0 */  67, 74, 56, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5b00 */  76, 88, 67, 74, 56, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5b10 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x5b20 */  51, 52,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x5b30 */  70, 48, 51, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5b40 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,  9,
-/* 0x5b50 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46,
-/* 0x5b60 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5b70 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9, 48, 48,
-/* 0x5b80 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x5b90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5ba0 */  32, 32, 99,116,111,107, 51, 50, 46, 50, 48,  9, 48, 48, 48, 48,
-/* 0x5bb0 */  48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48,
-/* 0x5bc0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5bd0 */  99,116,111,107, 51, 50, 46, 52, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5be0 */  48, 48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48,
-/* 0x5bf0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69,
-/* 0x5c00 */  88, 69, 67, 48, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5c10 */  76, 69, 88, 69, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5c20 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x5c30 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69,
-/* 0x5c40 */  67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5c50 */  32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 57,  9, 48,
-/* 0x5c60 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 48, 57,
-/* 0x5c70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5c80 */  32, 32, 76, 69, 88, 69, 67, 48, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5c90 */  48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 49, 48, 10, 48, 48, 48,
-/* 0x5ca0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5cb0 */  66, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5cc0 */  78, 50, 66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5cd0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x5ce0 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x5cf0 */  77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5d00 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48,  9, 48,
-/* 0x5d10 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48,
-/* 0x5d20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5d30 */  32, 32, 78, 50, 66, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5d40 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48,
-/* 0x5d50 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5d60 */  66, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5d70 */  78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5d80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x5d90 */  52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x5da0 */  77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5db0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48,  9, 48,
-/* 0x5dc0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x5dd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5de0 */  32, 32, 78, 50, 66, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5df0 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48,
-/* 0x5e00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5e10 */  66, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5e20 */  78, 50, 66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5e30 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x5e40 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x5e50 */  77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5e60 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48,  9, 48,
-/* 0x5e70 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48,
-/* 0x5e80 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5e90 */  32, 32, 78, 50, 68, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5ea0 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48,
-/* 0x5eb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5ec0 */  68, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5ed0 */  78, 50, 68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5ee0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x5ef0 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x5f00 */  65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5f10 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48,  9, 48,
-/* 0x5f20 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48,
-/* 0x5f30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5f40 */  32, 32, 78, 50, 68, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5f50 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48,
-/* 0x5f60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5f70 */  68, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5f80 */  78, 50, 68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5f90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x5fa0 */  52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x5fb0 */  65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5fc0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48,  9, 48,
-/* 0x5fd0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48,
-/* 0x5fe0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5ff0 */  32, 32, 78, 50, 68, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6000 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48,
-/* 0x6010 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6020 */  68, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6030 */  78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6040 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x6050 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x6060 */  65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6070 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48,  9, 48,
-/* 0x6080 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48,
-/* 0x6090 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x60a0 */  32, 32, 78, 50, 69, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x60b0 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48,
-/* 0x60c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x60d0 */  69, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x60e0 */  78, 50, 69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x60f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x6100 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x6110 */  77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6120 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48,  9, 48,
-/* 0x6130 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x6140 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6150 */  32, 32, 78, 50, 69, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6160 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48,
-/* 0x6170 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6180 */  69, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6190 */  78, 50, 69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x61a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x61b0 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x61c0 */  77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x61d0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48,  9, 48,
-/* 0x61e0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48,
-/* 0x61f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6200 */  32, 32, 78, 50, 69, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6210 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48,
-/* 0x6220 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6230 */  69, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6240 */  78, 50, 69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6250 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x6260 */  69, 67, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x6270 */  77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6280 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x6290 */  76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x62a0 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x62b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x62c0 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x62d0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x62e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x62f0 */  69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x6300 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6310 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x6320 */  69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x6330 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6340 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86,
-/* 0x6350 */  69, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 67, 76,
-/* 0x6360 */  69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6370 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49,  9, 48,
-/* 0x6380 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 49,
-/* 0x6390 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x63a0 */  32, 32, 67, 84, 66, 83, 72, 82, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x63b0 */  48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48,
-/* 0x63c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x63d0 */  66, 82, 79, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x63e0 */  67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x63f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65,
-/* 0x6400 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83,
-/* 0x6410 */  87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6420 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50,  9, 48,
-/* 0x6430 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 50,
-/* 0x6440 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6450 */  32, 32, 67, 65, 76, 76, 84, 82, 69, 56,  9, 48, 48, 48, 48, 48,
-/* 0x6460 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10, 48, 48, 48,
-/* 0x6470 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x6480 */  76, 76, 84, 82, 69, 57,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6490 */  67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x64a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86,
-/* 0x64b0 */  69, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 67, 76,
-/* 0x64c0 */  69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x64d0 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 50,  9, 48,
-/* 0x64e0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50,
-/* 0x64f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6500 */  32, 32, 67, 84, 66, 83, 72, 82, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x6510 */  48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49, 10, 48, 48, 48,
-/* 0x6520 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x6530 */  66, 82, 79, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6540 */  67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6550 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65,
-/* 0x6560 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83,
-/* 0x6570 */  87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6580 */  32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 53,  9, 48,
-/* 0x6590 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 49, 53,
-/* 0x65a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x65b0 */  32, 32, 76, 88, 85, 78, 70, 48, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x65c0 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 48, 48, 10, 48, 48, 48,
-/* 0x65d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x65e0 */  85, 78, 70, 48, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x65f0 */  76, 88, 85, 78, 70, 48, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6600 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84,
-/* 0x6610 */  69, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66,
-/* 0x6620 */  89, 84, 69, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6630 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 53,  9, 48,
-/* 0x6640 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 48, 53,
-/* 0x6650 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6660 */  32, 32, 76, 88, 77, 82, 85, 48, 48, 54,  9, 48, 48, 48, 48, 48,
-/* 0x6670 */  48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 48, 54, 10, 48, 48, 48,
-/* 0x6680 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6690 */  77, 82, 85, 48, 48, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x66a0 */  76, 88, 77, 82, 85, 48, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x66b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x66c0 */  48, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x66d0 */  70, 48, 48, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x66e0 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 53,  9, 48,
-/* 0x66f0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 52, 53,
-/* 0x6700 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6710 */  32, 32, 76, 88, 77, 82, 85, 48, 52, 54,  9, 48, 48, 48, 48, 48,
-/* 0x6720 */  48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 52, 54, 10, 48, 48, 48,
-/* 0x6730 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6740 */  74, 67, 67, 48, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6750 */  76, 88, 74, 67, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6760 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48,
-/* 0x6770 */  50, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67,
-/* 0x6780 */  67, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6790 */  32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 51,  9, 48,
-/* 0x67a0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67, 48, 50, 51,
-/* 0x67b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x67c0 */  32, 32, 76, 88, 85, 78, 70, 51, 56, 54,  9, 48, 48, 48, 48, 48,
-/* 0x67d0 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 51, 56, 54, 10, 48, 48, 48,
-/* 0x67e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x67f0 */  85, 78, 70, 51, 56, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6800 */  76, 88, 85, 78, 70, 51, 56, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6810 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51,
-/* 0x6820 */  56, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x6830 */  70, 51, 56, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6840 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 54,  9, 48,
-/* 0x6850 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 52, 56, 54,
-/* 0x6860 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6870 */  32, 32, 76, 88, 85, 78, 70, 52, 56, 55,  9, 48, 48, 48, 48, 48,
-/* 0x6880 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 52, 56, 55, 10, 48, 48, 48,
-/* 0x6890 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x68a0 */  77, 82, 85, 48, 54, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x68b0 */  76, 88, 77, 82, 85, 48, 54, 53, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x68c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84,
-/* 0x68d0 */  69, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66,
-/* 0x68e0 */  89, 84, 69, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x68f0 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 51, 48,  9, 48,
-/* 0x6900 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 51, 48,
-/* 0x6910 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6920 */  32, 32, 77, 82, 85, 66, 73, 84, 83, 51,  9, 48, 48, 48, 48, 48,
-/* 0x6930 */  48, 48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 51, 10, 48, 48, 48,
-/* 0x6940 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x6950 */  85, 65, 82, 66, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6960 */  77, 82, 85, 65, 82, 66, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6970 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84,
-/* 0x6980 */  69, 52,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66,
-/* 0x6990 */  89, 84, 69, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x69a0 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 52,  9, 48,
-/* 0x69b0 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 52,
-/* 0x69c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x69d0 */  32, 32, 77, 82, 85, 65, 82, 66, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x69e0 */  48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 53, 48, 10, 48, 48, 48,
-/* 0x69f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6a00 */  77, 82, 85, 48, 56, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6a10 */  76, 88, 77, 82, 85, 48, 56, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6a20 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84,
-/* 0x6a30 */  69, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66,
-/* 0x6a40 */  89, 84, 69, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6a50 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 54, 48,  9, 48,
-/* 0x6a60 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 54, 48,
-/* 0x6a70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6a80 */  32, 32, 77, 82, 85, 66, 73, 84, 83, 53,  9, 48, 48, 48, 48, 48,
-/* 0x6a90 */  48, 48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 53, 10, 48, 48, 48,
-/* 0x6aa0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x6ab0 */  85, 65, 82, 66, 55, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6ac0 */  77, 82, 85, 65, 82, 66, 55, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ad0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x6ae0 */  57, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82,
-/* 0x6af0 */  85, 48, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6b00 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 54,  9, 48,
-/* 0x6b10 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 54,
-/* 0x6b20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6b30 */  32, 32, 77, 82, 85, 65, 82, 66, 56, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6b40 */  48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 56, 48, 10, 48, 48, 48,
-/* 0x6b50 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x6b60 */  85, 66, 73, 84, 83, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6b70 */  77, 82, 85, 66, 73, 84, 83, 54, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6b80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66,
-/* 0x6b90 */  57, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65,
-/* 0x6ba0 */  82, 66, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6bb0 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49, 49, 48,  9, 48,
-/* 0x6bc0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 49, 49, 48,
-/* 0x6bd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6be0 */  32, 32, 76, 88, 77, 82, 85, 49, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x6bf0 */  48, 48, 48, 32, 76, 88, 77, 82, 85, 49, 49, 49, 10, 48, 48, 48,
-/* 0x6c00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6c10 */  85, 78, 70, 48, 52, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6c20 */  76, 88, 85, 78, 70, 48, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6c30 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x6c40 */  49, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69,
-/* 0x6c50 */  67, 48, 49, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6c60 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 49, 48,  9, 48,
-/* 0x6c70 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 49, 48,
-/* 0x6c80 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6c90 */  32, 32, 76, 88, 74, 77, 80, 65, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6ca0 */  48, 48, 48, 32, 76, 88, 74, 77, 80, 65, 48, 48, 10, 48, 48, 48,
-/* 0x6cb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6cc0 */  67, 65, 76, 76, 66, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6cd0 */  76, 88, 67, 65, 76, 76, 66, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ce0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6cf0 */  50, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x6d00 */  70, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6d10 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 50, 50,  9, 48,
-/* 0x6d20 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 50, 50,
-/* 0x6d30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6d40 */  32, 32, 76, 88, 74, 77, 80, 65, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x6d50 */  48, 48, 48, 32, 76, 88, 74, 77, 80, 65, 48, 49, 10, 48, 48, 48,
-/* 0x6d60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6d70 */  67, 65, 76, 76, 66, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6d80 */  76, 88, 67, 65, 76, 76, 66, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6d90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84,
-/* 0x6da0 */  83, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66,
-/* 0x6db0 */  73, 84, 83, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6dc0 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 49,  9, 48,
-/* 0x6dd0 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 49,
-/* 0x6de0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6df0 */  32, 32, 77, 82, 85, 65, 82, 66, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6e00 */  48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 49, 48, 10, 48, 48, 48,
-/* 0x6e10 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6e20 */  77, 82, 85, 48, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6e30 */  76, 88, 77, 82, 85, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6e40 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48,
-/* 0x6e50 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67,
-/* 0x6e60 */  67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6e70 */  32, 32, 32,100, 32, 32, 76, 88, 67, 74, 48, 77, 82, 85,  9, 48,
-/* 0x6e80 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 48, 77, 82, 85,
-/* 0x6e90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6ea0 */  32, 32, 76, 88, 67, 74, 49, 77, 82, 85,  9, 48, 48, 48, 48, 48,
-/* 0x6eb0 */  48, 48, 48, 32, 76, 88, 67, 74, 49, 77, 82, 85, 10, 48, 48, 48,
-/* 0x6ec0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6ed0 */  67, 65, 76, 74, 77, 80,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6ee0 */  76, 88, 67, 65, 76, 74, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ef0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76,
-/* 0x6f00 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65,
-/* 0x6f10 */  76, 76, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6f20 */  32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48, 49,  9, 48,
-/* 0x6f30 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76, 76, 48, 49,
-/* 0x6f40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6f50 */  32, 32, 76, 88, 67, 74, 50, 77, 82, 85,  9, 48, 48, 48, 48, 48,
-/* 0x6f60 */  48, 48, 48, 32, 76, 88, 67, 74, 50, 77, 82, 85, 10, 48, 48, 48,
-/* 0x6f70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6f80 */  67, 74, 52, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6f90 */  76, 88, 67, 74, 52, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6fa0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 54, 77,
-/* 0x6fb0 */  82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74,
-/* 0x6fc0 */  54, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6fd0 */  32, 32, 32,100, 32, 32, 76, 88, 67, 74, 55, 77, 82, 85,  9, 48,
-/* 0x6fe0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 55, 77, 82, 85,
-/* 0x6ff0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7000 */  32, 32, 76, 88, 77, 82, 85, 48, 53, 53,  9, 48, 48, 48, 48, 48,
-/* 0x7010 */  48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 53, 53, 10, 48, 48, 48,
-/* 0x7020 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x7030 */  85, 66, 89, 84, 69, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7040 */  77, 82, 85, 66, 89, 84, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7050 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84,
-/* 0x7060 */  83, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66,
-/* 0x7070 */  73, 84, 83, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7080 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 50, 48,  9, 48,
-/* 0x7090 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 50, 48,
-/* 0x70a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x70b0 */  32, 32, 76, 88, 77, 82, 85, 48, 53, 55,  9, 48, 48, 48, 48, 48,
-/* 0x70c0 */  48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 53, 55, 10, 48, 48, 48,
-/* 0x70d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x70e0 */  77, 82, 85, 48, 53, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x70f0 */  76, 88, 77, 82, 85, 48, 53, 56, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7100 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x7110 */  51, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x7120 */  70, 48, 51, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7130 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51, 48,  9,
-/* 0x7140 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46,
-/* 0x7150 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x7160 */  32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 55,  9, 48, 48, 48,
-/* 0x7170 */  48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 49, 55, 10, 48,
-/* 0x7180 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7190 */  76, 69, 88, 69, 67, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x71a0 */  48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x71b0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x71c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,115,116,
-/* 0x71d0 */  97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48,
-/* 0x71e0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x71f0 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,
-/* 0x7200 */ 117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x7210 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x7220 */  48, 48, 48, 48, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110,
-/* 0x7230 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7240 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7250 */  32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,
-/* 0x7260 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7270 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7280 */  32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10, 48,
-/* 0x7290 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72a0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,
-/* 0x72b0 */ 105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48,
-/* 0x72c0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x72d0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 77, 82, 85, 10, 48,
-/* 0x72e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72f0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79,
-/* 0x7300 */  95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7310 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7320 */  76, 69, 88, 69, 67, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7330 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7340 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7350 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x7360 */  32, 32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10,
-/* 0x7370 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7380 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 49,
-/* 0x7390 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x73a0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x73b0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x73c0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x73d0 */  78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x73e0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x73f0 */  32, 91, 78, 50, 66, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x7400 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7410 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7420 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7430 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x7440 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7450 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77,
-/* 0x7460 */  65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7470 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7480 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x7490 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74a0 */  32, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x74b0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x74c0 */  79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 50, 48, 93, 58, 10, 79,
-/* 0x74d0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x74e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x74f0 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7500 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65,
-/* 0x7510 */  83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x7520 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x7530 */  83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7540 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7550 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7560 */  99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7570 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69,
-/* 0x7580 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7590 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 51, 48, 93, 58,
-/* 0x75a0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x75b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x75c0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x75d0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x75e0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x75f0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7600 */  32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7610 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7620 */  82, 32, 91, 78, 50, 66, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70,
-/* 0x7630 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7650 */  48, 48, 48, 48, 48, 49, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7660 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x7670 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 50,102, 32, 82, 95, 51, 56,
-/* 0x7680 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x7690 */  66, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x76a0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x76b0 */  78, 50, 66, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x76c0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76d0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x76e0 */  48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x76f0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10,
-/* 0x7700 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7710 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 52,
-/* 0x7720 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7730 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7740 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x7750 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7760 */  78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7770 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7780 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x7790 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x77a0 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 54, 48, 93, 58,
-/* 0x77b0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x77c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x77d0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54,
-/* 0x77e0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x77f0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7800 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x7810 */  50, 66, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7820 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7830 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7840 */  48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7850 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48,
-/* 0x7860 */  48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7870 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x7880 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7890 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x78a0 */  65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x78b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x78c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50,
-/* 0x78d0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x78e0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x78f0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7900 */  70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 49, 48, 93, 58, 10,
-/* 0x7910 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7920 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7930 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7940 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x7950 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7960 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x7970 */  68, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x7980 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7990 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x79a0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x79b0 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x79c0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x79d0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 50, 48, 93,
-/* 0x79e0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x79f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x7a00 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x7a10 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x7a20 */  68, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7a30 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7a40 */  78, 50, 68, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7a50 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7a60 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7a70 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7a80 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10,
-/* 0x7a90 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7aa0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 51,
-/* 0x7ab0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7ac0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7ad0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x7ae0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7af0 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7b00 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7b10 */  32, 91, 78, 50, 68, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x7b20 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7b30 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7b40 */  48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7b50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x7b60 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x7b70 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x7b80 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7b90 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x7ba0 */  50, 68, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7bb0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7bc0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7bd0 */  48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7be0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48,
-/* 0x7bf0 */  48, 48, 48, 48, 48, 50, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7c00 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x7c10 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 52, 51, 32, 82, 95, 51, 56,
-/* 0x7c20 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x7c30 */  68, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7c40 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7c50 */  78, 50, 68, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7c60 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7c70 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7c80 */  48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7c90 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10,
-/* 0x7ca0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7cb0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 52,
-/* 0x7cc0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7cd0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7ce0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x7cf0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7d00 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7d10 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7d20 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x7d30 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7d40 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 54, 48, 93, 58,
-/* 0x7d50 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7d60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7d70 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54,
-/* 0x7d80 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x7d90 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7da0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x7db0 */  50, 68, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7dc0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7dd0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7de0 */  48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7df0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48,
-/* 0x7e00 */  48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7e10 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x7e20 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7e30 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x7e40 */  65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x7e50 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7e60 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50,
-/* 0x7e70 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x7e80 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x7e90 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7ea0 */  70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 49, 48, 93, 58, 10,
-/* 0x7eb0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7ec0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7ed0 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7ee0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x7ef0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7f00 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x7f10 */  69, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x7f20 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7f30 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7f40 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x7f50 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x7f60 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7f70 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 50, 48, 93,
-/* 0x7f80 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x7f90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x7fa0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x7fb0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x7fc0 */  69, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7fd0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7fe0 */  78, 50, 69, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7ff0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8000 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x8010 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x8020 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10,
-/* 0x8030 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x8040 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 51,
-/* 0x8050 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8060 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8070 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x8080 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8090 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x80a0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x80b0 */  32, 91, 78, 50, 69, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x80c0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x80d0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x80e0 */  48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x80f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x8100 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x8110 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x8120 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8130 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x8140 */  50, 69, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8150 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8160 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x8170 */  48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x8180 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48,
-/* 0x8190 */  48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x81a0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x81b0 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 51, 56,
-/* 0x81c0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x81d0 */  69, 68, 69, 67, 54, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x81e0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x81f0 */  78, 50, 69, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x8200 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8210 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x8220 */  48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x8230 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x8240 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x8250 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 52,
-/* 0x8260 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8270 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8280 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x8290 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x82a0 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x82b0 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x82c0 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x82d0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x82e0 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 54, 48, 93, 58,
-/* 0x82f0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8300 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8310 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54,
-/* 0x8320 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x8330 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8340 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x8350 */  50, 69, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8360 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8370 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x8380 */  48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x8390 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48,
-/* 0x83a0 */  48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x83b0 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x83c0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x83d0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x83e0 */  65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x83f0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8400 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50,
-/* 0x8410 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x8420 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x8430 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x8440 */  70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93,
-/* 0x8450 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x8460 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x8470 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56,
-/* 0x8480 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x8490 */ 109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10,
-/* 0x84a0 */  48, 48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x84b0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x84c0 */ 117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82,
-/* 0x84d0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x84e0 */  32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x84f0 */  48, 48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x8500 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,
-/* 0x8510 */ 101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x8520 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x8530 */  67, 65, 76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x8540 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8550 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x8560 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x8570 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x8580 */ 110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x8590 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84,
-/* 0x85a0 */  67, 76, 69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x85b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x85c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x85d0 */  48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32,
-/* 0x85e0 */  32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10,
-/* 0x85f0 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x8600 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84,
-/* 0x8610 */  82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8620 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76,
-/* 0x8630 */  76, 84, 82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x8640 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8650 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8660 */ 100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x8670 */  32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69,
-/* 0x8680 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8690 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58,
-/* 0x86a0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x86b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x86c0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x86d0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,
-/* 0x86e0 */ 116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79,
-/* 0x86f0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8700 */  79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79,
-/* 0x8710 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x8720 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8730 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x8740 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84,
-/* 0x8750 */  82, 49, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8760 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67,
-/* 0x8770 */  76, 69, 86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x8780 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8790 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x87a0 */  50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x87b0 */  32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48,
-/* 0x87c0 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x87d0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x87e0 */  49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x87f0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x8800 */  84, 82, 49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x8810 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8820 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x8830 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x8840 */  32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 10, 82, 69, 76,
-/* 0x8850 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x8860 */  70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 48, 48, 93, 58, 10,
-/* 0x8870 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x8880 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x8890 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x88a0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x88b0 */  70, 48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x88c0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x88d0 */  77, 82, 85, 48, 48, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x88e0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x88f0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8900 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x8910 */  32, 32, 32, 32, 32, 78, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8920 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8930 */  82, 32, 91, 76, 88, 85, 78, 70, 48, 49, 48, 93, 58, 10, 79, 70,
-/* 0x8940 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8950 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8960 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8970 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x8980 */  52, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8990 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67,
-/* 0x89a0 */  67, 48, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x89b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x89c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x89d0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x89e0 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76,
-/* 0x89f0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x8a00 */  70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 50, 49, 93, 58, 10,
-/* 0x8a10 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x8a20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x8a30 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x8a40 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x8a50 */  70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x8a60 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x8a70 */  85, 78, 70, 51, 56, 56, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x8a80 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8a90 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8aa0 */  48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x8ab0 */  32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82,
-/* 0x8ac0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x8ad0 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 52, 56, 55, 93,
-/* 0x8ae0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x8af0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x8b00 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x8b10 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x8b20 */  85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x8b30 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x8b40 */  76, 88, 77, 82, 85, 48, 54, 53, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x8b50 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8b60 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x8b70 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x8b80 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48, 10,
-/* 0x8b90 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x8ba0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 55,
-/* 0x8bb0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8bc0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8bd0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x8be0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8bf0 */  76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8c00 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8c10 */  32, 91, 76, 88, 77, 82, 85, 48, 57, 48, 93, 58, 10, 79, 70, 70,
-/* 0x8c20 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x8c30 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x8c40 */  48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x8c50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 49, 48,
-/* 0x8c60 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x8c70 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70,
-/* 0x8c80 */  48, 52, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x8c90 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ca0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32,
-/* 0x8cb0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8cc0 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79,
-/* 0x8cd0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8ce0 */  79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 49, 54, 93, 58, 10, 79,
-/* 0x8cf0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x8d00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8d10 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x8d20 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70,
-/* 0x8d30 */  48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8d40 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77,
-/* 0x8d50 */  82, 85, 48, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x8d60 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8d70 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8d80 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x8d90 */  32, 32, 32, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 10, 82, 69,
-/* 0x8da0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8db0 */  32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 48, 48, 93, 58,
-/* 0x8dc0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8dd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8de0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56, 54,
-/* 0x8df0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 74,
-/* 0x8e00 */  67, 67, 48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8e10 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x8e20 */  88, 67, 65, 76, 76, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8e30 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8e40 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x8e50 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x8e60 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10,
-/* 0x8e70 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x8e80 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 50, 77, 82, 85,
-/* 0x8e90 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x8ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8eb0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x8ec0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x8ed0 */  88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8ee0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8ef0 */  91, 76, 88, 67, 74, 52, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8f00 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8f10 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8f20 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x8f30 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52,
-/* 0x8f40 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x8f50 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 54, 77,
-/* 0x8f60 */  82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x8f70 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8f80 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x8f90 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8fa0 */  32, 76, 88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8fb0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8fc0 */  82, 32, 91, 76, 88, 67, 74, 55, 77, 82, 85, 93, 58, 10, 79, 70,
-/* 0x8fd0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8fe0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8ff0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x9000 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 67, 74, 56, 77,
-/* 0x9010 */  82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x9020 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74,
-/* 0x9030 */  56, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x9040 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9050 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x9060 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x9070 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69, 76,
-/* 0x9080 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x9090 */  70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 51, 52, 93, 58, 10,
-/* 0x90a0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x90b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x90c0 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x90d0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x90e0 */  70, 48, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x90f0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,
-/* 0x9100 */ 111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x9110 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9120 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x9130 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x9140 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10,
-/* 0x9150 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x9160 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46,
-/* 0x9170 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x9180 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9190 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82,
-/* 0x91a0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x91b0 */  32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79,
-/* 0x91c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x91d0 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10,
-/* 0x91e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x91f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x9200 */  10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9210 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x9220 */  51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82,
-/* 0x9230 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9240 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x9250 */  48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x9260 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10,
-/* 0x9270 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x9280 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46,
-/* 0x9290 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x92a0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x92b0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x92c0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x92d0 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x92e0 */  48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x92f0 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10,
-/* 0x9300 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x9310 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46,
-/* 0x9320 */  52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x9330 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9340 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x9350 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9360 */  32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79,
-/* 0x9370 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x9380 */  79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 50, 48, 93, 58, 10, 79,
-/* 0x9390 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x93a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x93b0 */  48, 48, 48, 48, 48, 48,100,101, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x93c0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78,
-/* 0x93d0 */  70, 79, 10
+/* 0x1b90 */   0, 93,232, 71,255,255,255,  0,  0,  0,  0,168,  0,  0,  0,177,
+/* 0x1ba0 */   0,  0,  0, 94,  0,  0,  0,112, 30,  0,  0,  0,  0,  0,  0, 52,
+/* 0x1bb0 */   0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 58,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 58,
+/* 0x1bd0 */   0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 70,
+/* 0x1be0 */   0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0, 73,
+/* 0x1bf0 */   0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0, 75,
+/* 0x1c00 */   0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0, 81,
+/* 0x1c10 */   0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 92,
+/* 0x1c20 */   0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0, 97,
+/* 0x1c30 */   0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,106,
+/* 0x1c40 */   0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,119,
+/* 0x1c50 */   0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,132,
+/* 0x1c60 */   0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,147,
+/* 0x1c70 */   0,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,209,
+/* 0x1c80 */   0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,222,
+/* 0x1c90 */   0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,237,
+/* 0x1ca0 */   0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,239,
+/* 0x1cb0 */   0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,242,
+/* 0x1cc0 */   0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,251,
+/* 0x1cd0 */   0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0,  7,
+/* 0x1ce0 */   1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 32,
+/* 0x1cf0 */   1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 54,
+/* 0x1d00 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0, 54,
+/* 0x1d10 */   1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0, 57,
+/* 0x1d20 */   1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0, 59,
+/* 0x1d30 */   1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 65,
+/* 0x1d40 */   1,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 76,
+/* 0x1d50 */   1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0, 81,
+/* 0x1d60 */   1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 90,
+/* 0x1d70 */   1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0,103,
+/* 0x1d80 */   1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,116,
+/* 0x1d90 */   1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0,131,
+/* 0x1da0 */   1,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0,213,
+/* 0x1db0 */   1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0,226,
+/* 0x1dc0 */   1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0,241,
+/* 0x1dd0 */   1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,243,
+/* 0x1de0 */   1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0,246,
+/* 0x1df0 */   1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0,255,
+/* 0x1e00 */   1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0, 11,
+/* 0x1e10 */   2,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 36,
+/* 0x1e20 */   2,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 58,
+/* 0x1e30 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 58,
+/* 0x1e40 */   2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 61,
+/* 0x1e50 */   2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0, 63,
+/* 0x1e60 */   2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 69,
+/* 0x1e70 */   2,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 80,
+/* 0x1e80 */   2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 85,
+/* 0x1e90 */   2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 94,
+/* 0x1ea0 */   2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0,107,
+/* 0x1eb0 */   2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0,120,
+/* 0x1ec0 */   2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0,135,
+/* 0x1ed0 */   2,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,230,
+/* 0x1ee0 */   2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0,243,
+/* 0x1ef0 */   2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0,  2,
+/* 0x1f00 */   3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0,  4,
+/* 0x1f10 */   3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0,  7,
+/* 0x1f20 */   3,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 16,
+/* 0x1f30 */   3,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 28,
+/* 0x1f40 */   3,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 53,
+/* 0x1f50 */   3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 75,
+/* 0x1f60 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 75,
+/* 0x1f70 */   3,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0, 39,  2,  0,  0,121,
+/* 0x1f80 */   3,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 50,  2,  0,  0,193,
+/* 0x1f90 */   3,  0,  0,134, 10,  0,  0,  0,  0,  0,  0, 61,  2,  0,  0, 71,
+/* 0x1fa0 */  14,  0,  0,134, 10,  0,  0,  0,  0,  0,  0, 72,  2,  0,  0,205,
+/* 0x1fb0 */  24,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0, 83,  2,  0,  0,231,
+/* 0x1fc0 */  24,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0, 92,  2,  0,  0,245,
+/* 0x1fd0 */  24,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,  0,250,
+/* 0x1fe0 */  24,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,110,  2,  0,  0,255,
+/* 0x1ff0 */  24,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,119,  2,  0,  0,  3,
+/* 0x2000 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,128,  2,  0,  0,  5,
+/* 0x2010 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,137,  2,  0,  0, 10,
+/* 0x2020 */  25,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,146,  2,  0,  0, 24,
+/* 0x2030 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,155,  2,  0,  0, 29,
+/* 0x2040 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,164,  2,  0,  0, 31,
+/* 0x2050 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,173,  2,  0,  0, 33,
+/* 0x2060 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,182,  2,  0,  0, 37,
+/* 0x2070 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,191,  2,  0,  0, 42,
+/* 0x2080 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,200,  2,  0,  0, 44,
+/* 0x2090 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,209,  2,  0,  0, 48,
+/* 0x20a0 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,218,  2,  0,  0, 50,
+/* 0x20b0 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,227,  2,  0,  0, 55,
+/* 0x20c0 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,236,  2,  0,  0, 60,
+/* 0x20d0 */  25,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,245,  2,  0,  0, 89,
+/* 0x20e0 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,254,  2,  0,  0, 91,
+/* 0x20f0 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  7,  3,  0,  0, 96,
+/* 0x2100 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 16,  3,  0,  0, 98,
+/* 0x2110 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 25,  3,  0,  0,103,
+/* 0x2120 */  25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 34,  3,  0,  0,110,
+/* 0x2130 */  25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 43,  3,  0,  0,117,
+/* 0x2140 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 52,  3,  0,  0,121,
+/* 0x2150 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 61,  3,  0,  0,126,
+/* 0x2160 */  25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 70,  3,  0,  0,129,
+/* 0x2170 */  25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 79,  3,  0,  0,132,
+/* 0x2180 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 88,  3,  0,  0,134,
+/* 0x2190 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 97,  3,  0,  0,136,
+/* 0x21a0 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,106,  3,  0,  0,141,
+/* 0x21b0 */  25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,115,  3,  0,  0,148,
+/* 0x21c0 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,124,  3,  0,  0,150,
+/* 0x21d0 */  25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,133,  3,  0,  0,151,
+/* 0x21e0 */  25,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,142,  3,  0,  0,160,
+/* 0x21f0 */  25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,151,  3,  0,  0,163,
+/* 0x2200 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,160,  3,  0,  0,167,
+/* 0x2210 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,169,  3,  0,  0,169,
+/* 0x2220 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,178,  3,  0,  0,174,
+/* 0x2230 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,187,  3,  0,  0,176,
+/* 0x2240 */  25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,196,  3,  0,  0,177,
+/* 0x2250 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,205,  3,  0,  0,179,
+/* 0x2260 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,214,  3,  0,  0,183,
+/* 0x2270 */  25,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,223,  3,  0,  0,191,
+/* 0x2280 */  25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,232,  3,  0,  0,194,
+/* 0x2290 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,241,  3,  0,  0,196,
+/* 0x22a0 */  25,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,250,  3,  0,  0,202,
+/* 0x22b0 */  25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  3,  4,  0,  0,205,
+/* 0x22c0 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 12,  4,  0,  0,207,
+/* 0x22d0 */  25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 21,  4,  0,  0,208,
+/* 0x22e0 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 30,  4,  0,  0,210,
+/* 0x22f0 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 39,  4,  0,  0,214,
+/* 0x2300 */  25,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 48,  4,  0,  0,225,
+/* 0x2310 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 57,  4,  0,  0,227,
+/* 0x2320 */  25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 66,  4,  0,  0,228,
+/* 0x2330 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 75,  4,  0,  0,230,
+/* 0x2340 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 84,  4,  0,  0,234,
+/* 0x2350 */  25,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 93,  4,  0,  0,250,
+/* 0x2360 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,102,  4,  0,  0,255,
+/* 0x2370 */  25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,111,  4,  0,  0,  2,
+/* 0x2380 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,120,  4,  0,  0,  4,
+/* 0x2390 */  26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,129,  4,  0,  0, 11,
+/* 0x23a0 */  26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,138,  4,  0,  0, 11,
+/* 0x23b0 */  26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,147,  4,  0,  0, 16,
+/* 0x23c0 */  26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,156,  4,  0,  0, 17,
+/* 0x23d0 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,165,  4,  0,  0, 19,
+/* 0x23e0 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,174,  4,  0,  0, 21,
+/* 0x23f0 */  26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,183,  4,  0,  0, 27,
+/* 0x2400 */  26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,192,  4,  0,  0, 30,
+/* 0x2410 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,201,  4,  0,  0, 32,
+/* 0x2420 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,210,  4,  0,  0, 34,
+/* 0x2430 */  26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,219,  4,  0,  0, 35,
+/* 0x2440 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,228,  4,  0,  0, 37,
+/* 0x2450 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,237,  4,  0,  0, 39,
+/* 0x2460 */  26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,246,  4,  0,  0, 40,
+/* 0x2470 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,255,  4,  0,  0, 42,
+/* 0x2480 */  26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  8,  5,  0,  0, 48,
+/* 0x2490 */  26,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 17,  5,  0,  0, 56,
+/* 0x24a0 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 26,  5,  0,  0, 58,
+/* 0x24b0 */  26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 35,  5,  0,  0, 61,
+/* 0x24c0 */  26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 44,  5,  0,  0, 64,
+/* 0x24d0 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 53,  5,  0,  0, 66,
+/* 0x24e0 */  26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 62,  5,  0,  0, 69,
+/* 0x24f0 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 71,  5,  0,  0, 71,
+/* 0x2500 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 80,  5,  0,  0, 73,
+/* 0x2510 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 89,  5,  0,  0, 75,
+/* 0x2520 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 98,  5,  0,  0, 77,
+/* 0x2530 */  26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,107,  5,  0,  0, 80,
+/* 0x2540 */  26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,116,  5,  0,  0, 85,
+/* 0x2550 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,125,  5,  0,  0, 87,
+/* 0x2560 */  26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,134,  5,  0,  0, 92,
+/* 0x2570 */  26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,143,  5,  0,  0, 97,
+/* 0x2580 */  26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,152,  5,  0,  0,102,
+/* 0x2590 */  26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,161,  5,  0,  0,108,
+/* 0x25a0 */  26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,170,  5,  0,  0,109,
+/* 0x25b0 */  26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,179,  5,  0,  0,115,
+/* 0x25c0 */  26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,189,  5,  0,  0,122,
+/* 0x25d0 */  26,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,199,  5,  0,  0,136,
+/* 0x25e0 */  26,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,209,  5,  0,  0,168,
+/* 0x25f0 */  26,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,219,  5,  0,  0,178,
+/* 0x2600 */  26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,229,  5,  0,  0,183,
+/* 0x2610 */  26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,238,  5,  0,  0,185,
+/* 0x2620 */  26,  0,  0,226,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  5,
+/* 0x2640 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  6,
+/* 0x2650 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 12,
+/* 0x2670 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0, 17,
+/* 0x2680 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 20,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,
+/* 0x26a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0, 22,
+/* 0x26b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0, 24,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 25,
+/* 0x26d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,
+/* 0x26e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0, 31,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0, 36,
+/* 0x2700 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 39,
+/* 0x2710 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,
+/* 0x2720 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 41,
+/* 0x2730 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0, 43,
+/* 0x2740 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 44,
+/* 0x2750 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,
+/* 0x2760 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0, 50,
+/* 0x2770 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0, 55,
+/* 0x2780 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 58,
+/* 0x2790 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 59,
+/* 0x27a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,  2,  0,  0, 65,
+/* 0x27b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,  2,  0,  0, 72,
+/* 0x27c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,173,  2,  0,  0, 75,
+/* 0x27d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,227,  2,  0,  0, 81,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  3,  0,  0, 90,
+/* 0x27f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  3,  0,  0, 91,
+/* 0x2800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,  3,  0,  0, 97,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,  3,  0,  0,108,
+/* 0x2820 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 84,  4,  0,  0,122,
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  4,  0,  0,123,
+/* 0x2840 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,129,  4,  0,  0,127,
+/* 0x2850 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,219,  4,  0,  0,137,
+/* 0x2860 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,  4,  0,  0,141,
+/* 0x2870 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  5,  0,  0,152,
+/* 0x2880 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,107,  5,  0,  0,153,
+/* 0x2890 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,179,  5,  0,  0,161,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  5,  0,  0,162,
+/* 0x28b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,199,  5,  0,  0,163,
+/* 0x28c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,219,  5,  0,  0,165,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,238,  5,  0,  0,167,
+/* 0x28e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,
+/* 0x2900 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,
+/* 0x2910 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,
+/* 0x2920 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  7,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  8,
+/* 0x2940 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,
+/* 0x2950 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,
+/* 0x2960 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0, 13,
+/* 0x2970 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0, 14,
+/* 0x2980 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0, 15,
+/* 0x2990 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,
+/* 0x29a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0, 18,
+/* 0x29b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 19,
+/* 0x29c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0, 23,
+/* 0x29d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 26,
+/* 0x29e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0, 27,
+/* 0x29f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 29,
+/* 0x2a00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0, 30,
+/* 0x2a10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0, 32,
+/* 0x2a20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0, 33,
+/* 0x2a30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 34,
+/* 0x2a40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0, 35,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 37,
+/* 0x2a60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0, 38,
+/* 0x2a70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 42,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 45,
+/* 0x2a90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 46,
+/* 0x2aa0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0, 48,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0, 49,
+/* 0x2ac0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0, 51,
+/* 0x2ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 52,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0, 53,
+/* 0x2af0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0, 54,
+/* 0x2b00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 56,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 57,
+/* 0x2b20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 60,
+/* 0x2b30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  2,  0,  0, 61,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  2,  0,  0, 62,
+/* 0x2b50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  2,  0,  0, 63,
+/* 0x2b60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  2,  0,  0, 64,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 92,  2,  0,  0, 66,
+/* 0x2b80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,  0, 67,
+/* 0x2b90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,110,  2,  0,  0, 68,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,119,  2,  0,  0, 69,
+/* 0x2bb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  2,  0,  0, 70,
+/* 0x2bc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,137,  2,  0,  0, 71,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,155,  2,  0,  0, 73,
+/* 0x2be0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,164,  2,  0,  0, 74,
+/* 0x2bf0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,182,  2,  0,  0, 76,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,191,  2,  0,  0, 77,
+/* 0x2c10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,200,  2,  0,  0, 78,
+/* 0x2c20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,209,  2,  0,  0, 79,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,218,  2,  0,  0, 80,
+/* 0x2c40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,236,  2,  0,  0, 82,
+/* 0x2c50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,245,  2,  0,  0, 83,
+/* 0x2c60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,254,  2,  0,  0, 84,
+/* 0x2c70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  3,  0,  0, 85,
+/* 0x2c80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  3,  0,  0, 86,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  3,  0,  0, 87,
+/* 0x2ca0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  3,  0,  0, 88,
+/* 0x2cb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  3,  0,  0, 89,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,  3,  0,  0, 92,
+/* 0x2cd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 79,  3,  0,  0, 93,
+/* 0x2ce0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  3,  0,  0, 94,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 97,  3,  0,  0, 95,
+/* 0x2d00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,106,  3,  0,  0, 96,
+/* 0x2d10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,124,  3,  0,  0, 98,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,133,  3,  0,  0, 99,
+/* 0x2d30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,142,  3,  0,  0,100,
+/* 0x2d40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,151,  3,  0,  0,101,
+/* 0x2d50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,  3,  0,  0,102,
+/* 0x2d60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,169,  3,  0,  0,103,
+/* 0x2d70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,178,  3,  0,  0,104,
+/* 0x2d80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,187,  3,  0,  0,105,
+/* 0x2d90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,196,  3,  0,  0,106,
+/* 0x2da0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,205,  3,  0,  0,107,
+/* 0x2db0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,223,  3,  0,  0,109,
+/* 0x2dc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,232,  3,  0,  0,110,
+/* 0x2dd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,241,  3,  0,  0,111,
+/* 0x2de0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,250,  3,  0,  0,112,
+/* 0x2df0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  4,  0,  0,113,
+/* 0x2e00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  4,  0,  0,114,
+/* 0x2e10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  4,  0,  0,115,
+/* 0x2e20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  4,  0,  0,116,
+/* 0x2e30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  4,  0,  0,117,
+/* 0x2e40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  4,  0,  0,118,
+/* 0x2e50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  4,  0,  0,119,
+/* 0x2e60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  4,  0,  0,120,
+/* 0x2e70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  4,  0,  0,121,
+/* 0x2e80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,  4,  0,  0,124,
+/* 0x2e90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,111,  4,  0,  0,125,
+/* 0x2ea0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,120,  4,  0,  0,126,
+/* 0x2eb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,138,  4,  0,  0,128,
+/* 0x2ec0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,147,  4,  0,  0,129,
+/* 0x2ed0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,156,  4,  0,  0,130,
+/* 0x2ee0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,  4,  0,  0,131,
+/* 0x2ef0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,174,  4,  0,  0,132,
+/* 0x2f00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,183,  4,  0,  0,133,
+/* 0x2f10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,  4,  0,  0,134,
+/* 0x2f20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,201,  4,  0,  0,135,
+/* 0x2f30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,210,  4,  0,  0,136,
+/* 0x2f40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,228,  4,  0,  0,138,
+/* 0x2f50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,237,  4,  0,  0,139,
+/* 0x2f60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,246,  4,  0,  0,140,
+/* 0x2f70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  5,  0,  0,142,
+/* 0x2f80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  5,  0,  0,143,
+/* 0x2f90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  5,  0,  0,144,
+/* 0x2fa0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  5,  0,  0,145,
+/* 0x2fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  5,  0,  0,146,
+/* 0x2fc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  5,  0,  0,147,
+/* 0x2fd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62,  5,  0,  0,148,
+/* 0x2fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  5,  0,  0,149,
+/* 0x2ff0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  5,  0,  0,150,
+/* 0x3000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  5,  0,  0,151,
+/* 0x3010 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,116,  5,  0,  0,154,
+/* 0x3020 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,125,  5,  0,  0,155,
+/* 0x3030 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,134,  5,  0,  0,156,
+/* 0x3040 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,143,  5,  0,  0,157,
+/* 0x3050 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,152,  5,  0,  0,158,
+/* 0x3060 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,161,  5,  0,  0,159,
+/* 0x3070 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,170,  5,  0,  0,160,
+/* 0x3080 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,209,  5,  0,  0,164,
+/* 0x3090 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,229,  5,  0,  0,166,
+/* 0x30a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,247,  5,  0,  0,  0,
+/* 0x30b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,254,  5,  0,  0,169,
+/* 0x30c0 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0, 16,  6,  0,  0,169,
+/* 0x30d0 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0, 27,  6,  0,  0,169,
+/* 0x30e0 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0, 38,  6,  0,  0,169,
+/* 0x30f0 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0, 54,  6,  0,  0,169,
+/* 0x3100 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0, 68,  6,  0,  0,169,
+/* 0x3110 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0, 79,  6,  0,  0,169,
+/* 0x3120 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0, 84,  6,  0,  0,169,
+/* 0x3130 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+/* 0x3140 */   0,  0,  0, 92,  6,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,  2,
+/* 0x3160 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  1,
+/* 0x3170 */   0,  0,  0,103,  6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */   0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,  0,
+/* 0x3190 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  3,
+/* 0x31a0 */   0,  0,  0,103,  6,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31b0 */   0,  0,  0, 10,  0,  0,  0, 12,  0,  0,  0,103,  6,  0,  0,  3,
+/* 0x31c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  3,
+/* 0x31d0 */   0,  0,  0,103,  6,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31e0 */   0,  0,  0, 11,  0,  0,  0, 14,  0,  0,  0,103,  6,  0,  0,  3,
+/* 0x31f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 17,
+/* 0x3200 */   0,  0,  0,103,  6,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3210 */   0,  0,  0, 12,  0,  0,  0, 47,  0,  0,  0,103,  6,  0,  0,  5,
+/* 0x3220 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 12,
+/* 0x3230 */   0,  0,  0,103,  6,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */   0,  0,  0, 14,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0,  4,
+/* 0x3250 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0, 14,
+/* 0x3260 */   0,  0,  0,103,  6,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */   0,  0,  0, 18,  0,  0,  0,  8,  0,  0,  0, 92,  6,  0,  0,  2,
+/* 0x3280 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 10,
+/* 0x3290 */   0,  0,  0,103,  6,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0, 19,  0,  0,  0, 21,  0,  0,  0, 92,  6,  0,  0,  2,
+/* 0x32b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0, 18,
+/* 0x32c0 */   0,  0,  0, 92,  6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0, 22,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 10,
+/* 0x32e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,  1,
+/* 0x32f0 */   0,  0,  0,103,  6,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3300 */   0,  0,  0, 26,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,  8,
+/* 0x3310 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,
+/* 0x3320 */   0,  0,  0,103,  6,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3330 */   0,  0,  0, 29,  0,  0,  0, 12,  0,  0,  0,103,  6,  0,  0, 12,
+/* 0x3340 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  5,
+/* 0x3350 */   0,  0,  0,103,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */   0,  0,  0, 30,  0,  0,  0, 14,  0,  0,  0,103,  6,  0,  0, 12,
+/* 0x3370 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 15,
+/* 0x3380 */   0,  0,  0,103,  6,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */   0,  0,  0, 31,  0,  0,  0, 33,  0,  0,  0,103,  6,  0,  0, 15,
+/* 0x33a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 67,
+/* 0x33b0 */   0,  0,  0,103,  6,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0, 32,  0,  0,  0, 12,  0,  0,  0,103,  6,  0,  0, 12,
+/* 0x33d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  3,
+/* 0x33e0 */   0,  0,  0,103,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33f0 */   0,  0,  0, 33,  0,  0,  0, 14,  0,  0,  0,103,  6,  0,  0, 12,
+/* 0x3400 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  8,
+/* 0x3410 */   0,  0,  0, 92,  6,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3420 */   0,  0,  0, 38,  0,  0,  0, 10,  0,  0,  0,103,  6,  0,  0, 14,
+/* 0x3430 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0, 21,
+/* 0x3440 */   0,  0,  0, 92,  6,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3450 */   0,  0,  0, 39,  0,  0,  0, 18,  0,  0,  0, 92,  6,  0,  0, 10,
+/* 0x3460 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  1,
+/* 0x3470 */   0,  0,  0,103,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3480 */   0,  0,  0, 42,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 18,
+/* 0x3490 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  1,
+/* 0x34a0 */   0,  0,  0,103,  6,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34b0 */   0,  0,  0, 46,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0, 17,
+/* 0x34c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0, 12,
+/* 0x34d0 */   0,  0,  0,103,  6,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34e0 */   0,  0,  0, 49,  0,  0,  0,  5,  0,  0,  0,103,  6,  0,  0, 20,
+/* 0x34f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0, 14,
+/* 0x3500 */   0,  0,  0,103,  6,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3510 */   0,  0,  0, 50,  0,  0,  0, 15,  0,  0,  0,103,  6,  0,  0, 19,
+/* 0x3520 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 30,
+/* 0x3530 */   0,  0,  0,103,  6,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3540 */   0,  0,  0, 50,  0,  0,  0, 48,  0,  0,  0,103,  6,  0,  0, 23,
+/* 0x3550 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0, 12,
+/* 0x3560 */   0,  0,  0,103,  6,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3570 */   0,  0,  0, 52,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0, 20,
+/* 0x3580 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 14,
+/* 0x3590 */   0,  0,  0,103,  6,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35a0 */   0,  0,  0, 56,  0,  0,  0,  8,  0,  0,  0, 92,  6,  0,  0, 18,
+/* 0x35b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 10,
+/* 0x35c0 */   0,  0,  0,103,  6,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35d0 */   0,  0,  0, 57,  0,  0,  0, 21,  0,  0,  0, 92,  6,  0,  0, 18,
+/* 0x35e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0, 18,
+/* 0x35f0 */   0,  0,  0, 92,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3600 */   0,  0,  0, 60,  0,  0,  0,  5,  0,  0,  0,113,  6,  0,  0,169,
+/* 0x3610 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 20,
+/* 0x3620 */   0,  0,  0,113,  6,  0,  0,170,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3630 */   0,  0,  0, 60,  0,  0,  0, 30,  0,  0,  0,113,  6,  0,  0,171,
+/* 0x3640 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 42,
+/* 0x3650 */   0,  0,  0,113,  6,  0,  0,172,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3660 */   0,  0,  0, 65,  0,  0,  0,  1,  0,  0,  0,113,  6,  0,  0,173,
+/* 0x3670 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  2,
+/* 0x3680 */   0,  0,  0,122,  6,  0,  0,174,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3690 */   0,  0,  0, 66,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0, 24,
+/* 0x36a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0, 13,
+/* 0x36b0 */   0,  0,  0,103,  6,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36c0 */   0,  0,  0, 72,  0,  0,  0,  1,  0,  0,  0,113,  6,  0,  0,173,
+/* 0x36d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,  3,
+/* 0x36e0 */   0,  0,  0,103,  6,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36f0 */   0,  0,  0, 76,  0,  0,  0,  2,  0,  0,  0,122,  6,  0,  0,174,
+/* 0x3700 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  4,
+/* 0x3710 */   0,  0,  0,103,  6,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3720 */   0,  0,  0, 81,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0, 25,
+/* 0x3730 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,  0,  0,  0,  1,
+/* 0x3740 */   0,  0,  0,103,  6,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3750 */   0,  0,  0, 86,  0,  0,  0,  1,  0,  0,  0,113,  6,  0,  0,175,
+/* 0x3760 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,  1,
+/* 0x3770 */   0,  0,  0, 92,  6,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3780 */   0,  0,  0, 94,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 38,
+/* 0x3790 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  0,  0,  0,  4,
+/* 0x37a0 */   0,  0,  0,103,  6,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37b0 */   0,  0,  0,100,  0,  0,  0,  2,  0,  0,  0,103,  6,  0,  0, 33,
+/* 0x37c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,  0,  0,  0,  1,
+/* 0x37d0 */   0,  0,  0,103,  6,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37e0 */   0,  0,  0,103,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0, 31,
+/* 0x37f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,  4,
+/* 0x3800 */   0,  0,  0,103,  6,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3810 */   0,  0,  0,117,  0,  0,  0,  6,  0,  0,  0,103,  6,  0,  0, 32,
+/* 0x3820 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,  6,
+/* 0x3830 */   0,  0,  0,103,  6,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3840 */   0,  0,  0,128,  0,  0,  0,  1,  0,  0,  0, 92,  6,  0,  0, 34,
+/* 0x3850 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,  0,  0,  0,  1,
+/* 0x3860 */   0,  0,  0,103,  6,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3870 */   0,  0,  0,142,  0,  0,  0,  7,  0,  0,  0,103,  6,  0,  0, 29,
+/* 0x3880 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,  0,  1,
+/* 0x3890 */   0,  0,  0,103,  6,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38a0 */   0,  0,  0,148,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 30,
+/* 0x38b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,  0,  0,  0,  1,
+/* 0x38c0 */   0,  0,  0,103,  6,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38d0 */   0,  0,  0,150,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 37,
+/* 0x38e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,151,  0,  0,  0,  1,
+/* 0x38f0 */   0,  0,  0,103,  6,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3900 */   0,  0,  0,152,  0,  0,  0,  2,  0,  0,  0,103,  6,  0,  0, 30,
+/* 0x3910 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,  4,
+/* 0x3920 */   0,  0,  0,103,  6,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3930 */   0,  0,  0,161,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0, 41,
+/* 0x3940 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0, 13,
+/* 0x3950 */   0,  0,  0,103,  6,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3960 */   0,  0,  0,163,  0,  0,  0,  5,  0,  0,  0,103,  6,  0,  0, 42,
+/* 0x3970 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0, 10,
+/* 0x3980 */   0,  0,  0,103,  6,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3990 */   0,  0,  0,163,  0,  0,  0, 16,  0,  0,  0,103,  6,  0,  0, 42,
+/* 0x39a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,164,  0,  0,  0,  4,
+/* 0x39b0 */   0,  0,  0,103,  6,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39c0 */   0,  0,  0,164,  0,  0,  0,  9,  0,  0,  0,103,  6,  0,  0, 40,
+/* 0x39d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,  4,
+/* 0x39e0 */   0,  0,  0,103,  6,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39f0 */   0,  0,  0,167,  0,  0,  0,222,  0,  0,  0,113,  6,  0,  0,176,
+/* 0x3a00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76, 69, 88, 69, 67,
+/* 0x3a10 */  48, 48, 48,  0, 76, 69, 88, 69, 67, 48, 48, 57,  0, 76, 69, 88,
+/* 0x3a20 */  69, 67, 48, 49, 48,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0, 78,
+/* 0x3a30 */  50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 49,
+/* 0x3a40 */   0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77, 65,
+/* 0x3a50 */  50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66, 68,
+/* 0x3a60 */  69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78, 50,
+/* 0x3a70 */  66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,  0,
+/* 0x3a80 */  78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83, 52,
+/* 0x3a90 */  48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70, 65,
+/* 0x3aa0 */  83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50, 66,
+/* 0x3ab0 */  83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0, 78,
+/* 0x3ac0 */  50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54, 48,
+/* 0x3ad0 */   0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x3ae0 */  49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68, 68,
+/* 0x3af0 */  69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78, 50,
+/* 0x3b00 */  68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,  0,
+/* 0x3b10 */  78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83, 51,
+/* 0x3b20 */  48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83, 77,
+/* 0x3b30 */  65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50, 68,
+/* 0x3b40 */  83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0, 78,
+/* 0x3b50 */  50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54, 48,
+/* 0x3b60 */   0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x3b70 */  54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69, 83,
+/* 0x3b80 */  77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78, 50,
+/* 0x3b90 */  69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,  0,
+/* 0x3ba0 */  78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83, 50,
+/* 0x3bb0 */  48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83, 77,
+/* 0x3bc0 */  65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50, 69,
+/* 0x3bd0 */  68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0, 78,
+/* 0x3be0 */  50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53, 48,
+/* 0x3bf0 */   0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69, 67,
+/* 0x3c00 */  53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69, 70,
+/* 0x3c10 */  65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78, 50,
+/* 0x3c20 */  69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 48,
+/* 0x3c30 */  48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77,
+/* 0x3c40 */  65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x3c50 */  50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 67, 65,
+/* 0x3c60 */  76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0,
+/* 0x3c70 */  67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48,
+/* 0x3c80 */  49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87,
+/* 0x3c90 */  65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76,
+/* 0x3ca0 */  76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67,
+/* 0x3cb0 */  65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,
+/* 0x3cc0 */   0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82,
+/* 0x3cd0 */  49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82,
+/* 0x3ce0 */  79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65,
+/* 0x3cf0 */  76, 76, 84, 82, 49, 51,  0, 76, 69, 88, 69, 67, 48, 49, 53,  0,
+/* 0x3d00 */  76, 88, 85, 78, 70, 48, 48, 48,  0, 76, 88, 85, 78, 70, 48, 48,
+/* 0x3d10 */  50,  0, 77, 82, 85, 66, 89, 84, 69, 48,  0, 76, 88, 77, 82, 85,
+/* 0x3d20 */  48, 48, 53,  0, 76, 88, 77, 82, 85, 48, 48, 54,  0, 76, 88, 77,
+/* 0x3d30 */  82, 85, 48, 48, 55,  0, 76, 88, 85, 78, 70, 48, 48, 56,  0, 76,
+/* 0x3d40 */  88, 85, 78, 70, 48, 49, 48,  0, 76, 88, 74, 67, 67, 48, 49, 48,
+/* 0x3d50 */   0, 76, 88, 77, 82, 85, 48, 52, 53,  0, 76, 88, 77, 82, 85, 48,
+/* 0x3d60 */  52, 54,  0, 76, 88, 74, 67, 67, 48, 50, 48,  0, 76, 88, 74, 67,
+/* 0x3d70 */  67, 48, 50, 49,  0, 76, 88, 74, 67, 67, 48, 50, 51,  0, 76, 88,
+/* 0x3d80 */  85, 78, 70, 48, 51, 55,  0, 76, 88, 85, 78, 70, 51, 56, 54,  0,
+/* 0x3d90 */  76, 88, 85, 78, 70, 51, 56, 55,  0, 76, 88, 85, 78, 70, 51, 56,
+/* 0x3da0 */  56,  0, 76, 88, 85, 78, 70, 52, 56, 54,  0, 76, 88, 85, 78, 70,
+/* 0x3db0 */  52, 56, 55,  0, 76, 88, 77, 82, 85, 48, 54, 53,  0, 77, 82, 85,
+/* 0x3dc0 */  66, 89, 84, 69, 51,  0, 77, 82, 85, 65, 82, 66, 51, 48,  0, 77,
+/* 0x3dd0 */  82, 85, 66, 73, 84, 83, 51,  0, 77, 82, 85, 65, 82, 66, 52, 48,
+/* 0x3de0 */   0, 76, 88, 77, 82, 85, 48, 55, 48,  0, 77, 82, 85, 66, 89, 84,
+/* 0x3df0 */  69, 52,  0, 77, 82, 85, 66, 73, 84, 83, 52,  0, 77, 82, 85, 65,
+/* 0x3e00 */  82, 66, 53, 48,  0, 76, 88, 77, 82, 85, 48, 56, 48,  0, 77, 82,
+/* 0x3e10 */  85, 66, 89, 84, 69, 53,  0, 77, 82, 85, 65, 82, 66, 54, 48,  0,
+/* 0x3e20 */  77, 82, 85, 66, 73, 84, 83, 53,  0, 77, 82, 85, 65, 82, 66, 55,
+/* 0x3e30 */  48,  0, 76, 88, 77, 82, 85, 48, 57, 48,  0, 77, 82, 85, 66, 89,
+/* 0x3e40 */  84, 69, 54,  0, 77, 82, 85, 65, 82, 66, 56, 48,  0, 77, 82, 85,
+/* 0x3e50 */  66, 73, 84, 83, 54,  0, 77, 82, 85, 65, 82, 66, 57, 48,  0, 76,
+/* 0x3e60 */  88, 77, 82, 85, 49, 48, 48,  0, 76, 88, 85, 78, 70, 48, 52, 48,
+/* 0x3e70 */   0, 76, 88, 77, 82, 85, 49, 49, 48,  0, 76, 88, 77, 82, 85, 49,
+/* 0x3e80 */  49, 49,  0, 76, 88, 85, 78, 70, 48, 52, 49,  0, 76, 88, 85, 78,
+/* 0x3e90 */  70, 48, 52, 50,  0, 76, 69, 88, 69, 67, 48, 49, 54,  0, 76, 88,
+/* 0x3ea0 */  77, 82, 85, 48, 49, 48,  0, 76, 88, 74, 77, 80, 65, 48, 48,  0,
+/* 0x3eb0 */  76, 88, 67, 65, 76, 76, 66, 48,  0, 76, 88, 85, 78, 70, 48, 50,
+/* 0x3ec0 */  49,  0, 76, 88, 77, 82, 85, 48, 50, 50,  0, 76, 88, 74, 77, 80,
+/* 0x3ed0 */  65, 48, 49,  0, 76, 88, 67, 65, 76, 76, 66, 49,  0, 77, 82, 85,
+/* 0x3ee0 */  66, 73, 84, 83, 49,  0, 76, 88, 77, 82, 85, 48, 51, 48,  0, 77,
+/* 0x3ef0 */  82, 85, 66, 89, 84, 69, 49,  0, 77, 82, 85, 65, 82, 66, 49, 48,
+/* 0x3f00 */   0, 76, 88, 77, 82, 85, 48, 52, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x3f10 */  51, 48,  0, 76, 88, 74, 67, 67, 48, 48, 48,  0, 76, 88, 67, 74,
+/* 0x3f20 */  48, 77, 82, 85,  0, 76, 88, 67, 74, 49, 77, 82, 85,  0, 76, 88,
+/* 0x3f30 */  67, 65, 76, 74, 77, 80,  0, 76, 88, 67, 65, 76, 76, 48, 48,  0,
+/* 0x3f40 */  76, 88, 67, 65, 76, 76, 48, 49,  0, 76, 88, 67, 74, 50, 77, 82,
+/* 0x3f50 */  85,  0, 76, 88, 67, 74, 52, 77, 82, 85,  0, 76, 88, 67, 74, 54,
+/* 0x3f60 */  77, 82, 85,  0, 76, 88, 67, 74, 55, 77, 82, 85,  0, 76, 88, 67,
+/* 0x3f70 */  74, 56, 77, 82, 85,  0, 76, 88, 85, 78, 70, 48, 51, 52,  0, 76,
+/* 0x3f80 */  88, 77, 82, 85, 48, 53, 53,  0, 77, 82, 85, 66, 89, 84, 69, 50,
+/* 0x3f90 */   0, 77, 82, 85, 66, 73, 84, 83, 50,  0, 77, 82, 85, 65, 82, 66,
+/* 0x3fa0 */  50, 48,  0, 76, 88, 77, 82, 85, 48, 53, 55,  0, 76, 88, 77, 82,
+/* 0x3fb0 */  85, 48, 53, 56,  0, 76, 88, 85, 78, 70, 48, 51, 53,  0, 99,116,
+/* 0x3fc0 */ 111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46, 49,
+/* 0x3fd0 */  48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,107,
+/* 0x3fe0 */  51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,  0,
+/* 0x3ff0 */  76, 69, 88, 69, 67, 48, 49, 55,  0, 76, 69, 88, 69, 67, 48, 50,
+/* 0x4000 */  48,  0, 95,115,116, 97,114,116,  0,108,122,109, 97, 95,115,116,
+/* 0x4010 */  97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,109, 97, 95,
+/* 0x4020 */ 117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,
+/* 0x4030 */   0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,
+/* 0x4040 */   0,102,105,108,116,101,114, 95,108,101,110,103,116,104,  0,102,
+/* 0x4050 */ 105,108,116,101,114, 95, 99,116,111,  0, 78, 77, 82, 85,  0, 79,
+/* 0x4060 */  95, 66, 73, 78, 70, 79,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51,
+/* 0x4070 */  50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51, 56,
+/* 0x4080 */  54, 95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 56,  0,155, 27,  0,
+/* 0x4090 */   0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* i386-linux.elf.interp-entry.h
-   created from i386-linux.elf.interp-entry.bin, 45328 (0xb110) bytes
+   created from i386-linux.elf.interp-entry.bin, 18957 (0x4a0d) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_ELF_INTERP_ENTRY_SIZE    45328
-#define STUB_I386_LINUX_ELF_INTERP_ENTRY_ADLER32 0x30672e81
-#define STUB_I386_LINUX_ELF_INTERP_ENTRY_CRC32   0x13a91507
+#define STUB_I386_LINUX_ELF_INTERP_ENTRY_SIZE    18957
+#define STUB_I386_LINUX_ELF_INTERP_ENTRY_ADLER32 0x2fb2fb03
+#define STUB_I386_LINUX_ELF_INTERP_ENTRY_CRC32   0x8c32856c
 
-unsigned char stub_i386_linux_elf_interp_entry[45328] = {
+unsigned char stub_i386_linux_elf_interp_entry[18957] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 224, 36,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -483,2390 +483,742 @@ unsigned char stub_i386_linux_elf_interp_entry[45328] = {
 /* 0x1bc0 */  10, 60,143,119,  6,128,127,254, 15,116,  5, 44,232, 60,  1,119,
 /* 0x1bd0 */ 255,131,249,  4,114,  4,139,  7, 40,208,117,255,134,196,193,192,
 /* 0x1be0 */  16,134,196, 41,248,  1,240,131,233,  4,171,131,233,  1,114,  4,
-/* 0x1bf0 */ 138,  7, 71,235, 13,131,233,  1,115,  3, 97,195,102,105,108,101,
-/* 0x1c00 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,105, 51,
-/* 0x1c10 */  56, 54, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,
-/* 0x1c20 */ 120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c30 */  83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32,
-/* 0x1c40 */  32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,
-/* 0x1c50 */ 108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108,
-/* 0x1c60 */  97,103,115, 10, 32, 32, 48, 32, 76, 88, 80, 84, 73, 48, 48, 48,
-/* 0x1c70 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 55, 32, 32,
-/* 0x1c80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42,
-/* 0x1ca0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1cb0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1cc0 */  49, 32, 76, 88, 80, 84, 73, 48, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1d00 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1d10 */  10, 32, 32, 50, 32, 76, 88, 80, 84, 73, 48, 52, 49, 32, 32, 32,
-/* 0x1d20 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d30 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1d40 */  32, 48, 48, 48, 48, 48, 48, 56, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1d50 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1d60 */  78, 76, 89, 10, 32, 32, 51, 32, 76, 88, 80, 84, 73, 48, 52, 50,
-/* 0x1d70 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 98, 32, 32, 50, 42,
-/* 0x1da0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1db0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 76, 88, 80, 84, 73,
-/* 0x1dc0 */  48, 52, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dd0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 98, 32,
-/* 0x1df0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1e00 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76, 88,
-/* 0x1e10 */  80, 84, 73, 48, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1e50 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54,
-/* 0x1e60 */  32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e80 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 57, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1ea0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1eb0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 78, 50, 66, 70, 65,
-/* 0x1ec0 */  83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 97, 32,
-/* 0x1ef0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1f00 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1f10 */  10, 32, 32, 56, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 32, 32,
-/* 0x1f20 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48,
-/* 0x1f30 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f40 */  32, 48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1f50 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1f60 */  78, 76, 89, 10, 32, 32, 57, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32,
-/* 0x1f80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 97, 50, 32, 32, 50, 42,
-/* 0x1fa0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1fb0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 78, 50, 66, 83, 77,
-/* 0x1fc0 */  65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 97,100, 32,
-/* 0x1ff0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2000 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2010 */  10, 32, 49, 49, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32,
-/* 0x2020 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2040 */  32, 48, 48, 48, 48, 48, 48, 98, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2050 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2060 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 78,
-/* 0x2070 */  50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2080 */  48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2090 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 98, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x20b0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x20c0 */  51, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x20d0 */  48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2100 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2110 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 52, 32, 78, 50, 66, 70,
-/* 0x2120 */  65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2140 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100, 53,
-/* 0x2150 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2160 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2170 */  89, 10, 32, 49, 53, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32,
-/* 0x2180 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51,101, 32, 32, 48, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21a0 */  32, 32, 48, 48, 48, 48, 48, 48,101, 52, 32, 32, 50, 42, 42, 48,
-/* 0x21b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x21c0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 54, 32,
-/* 0x21d0 */  78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2200 */  48, 49, 50, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2210 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2220 */  68, 79, 78, 76, 89, 10, 32, 49, 55, 32, 78, 50, 66, 70, 65, 83,
-/* 0x2230 */  52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102,
-/* 0x2240 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2250 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50,102, 32, 32,
-/* 0x2260 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2270 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2280 */  32, 49, 56, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32,
-/* 0x2290 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x22a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x22b0 */  48, 48, 48, 48, 48, 49, 51,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x22c0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x22d0 */  76, 89, 10, 32, 49, 57, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32,
-/* 0x22e0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x22f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 48, 32, 32, 50, 42, 42,
-/* 0x2310 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2320 */  68, 79, 78, 76, 89, 10, 32, 50, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x2330 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57,
-/* 0x2340 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2350 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 51, 32, 32,
-/* 0x2360 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2370 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 49, 32, 78, 50, 66,
-/* 0x2380 */  83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x23a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52,
-/* 0x23b0 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x23c0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x23d0 */  76, 89, 10, 32, 50, 50, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32,
-/* 0x23e0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48,
-/* 0x23f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2400 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 53, 56, 32, 32, 50, 42, 42,
-/* 0x2410 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2420 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 51,
-/* 0x2430 */  32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2440 */  48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2450 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2460 */  48, 48, 49, 55, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2470 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2480 */  65, 68, 79, 78, 76, 89, 10, 32, 50, 52, 32, 78, 50, 66, 68, 69,
-/* 0x2490 */  67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24a0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 56, 55, 32,
-/* 0x24c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x24d0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 53, 32, 78, 50,
-/* 0x24e0 */  68, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x24f0 */  48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2500 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2510 */  56, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2520 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2530 */  78, 76, 89, 10, 32, 50, 54, 32, 78, 50, 68, 70, 65, 83, 49, 48,
-/* 0x2540 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x2550 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2560 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 56, 97, 32, 32, 50, 42,
-/* 0x2570 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2580 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50,
-/* 0x2590 */  55, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x25a0 */  48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x25b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x25c0 */  48, 48, 48, 49, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x25d0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x25e0 */  10, 32, 50, 56, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48,
-/* 0x2600 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2610 */  32, 48, 48, 48, 48, 48, 49, 57, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2620 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2630 */  78, 76, 89, 10, 32, 50, 57, 32, 78, 50, 68, 83, 77, 65, 50, 48,
-/* 0x2640 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x2650 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2660 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 57,100, 32, 32, 50, 42,
-/* 0x2670 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2680 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x2690 */  48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x26a0 */  48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x26b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x26c0 */  48, 48, 48, 49, 97, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x26d0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x26e0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 49, 32, 78, 50, 68, 68,
-/* 0x26f0 */  69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2700 */  48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2710 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 97, 98,
-/* 0x2720 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2730 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 50, 32, 78,
-/* 0x2740 */  50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2750 */  48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2760 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2770 */  49, 98, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2780 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2790 */  79, 78, 76, 89, 10, 32, 51, 51, 32, 78, 50, 68, 70, 65, 83, 51,
-/* 0x27a0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x27b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x27c0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 99, 53, 32, 32, 50,
-/* 0x27d0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x27e0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x27f0 */  51, 52, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32,
-/* 0x2800 */  32, 48, 48, 48, 48, 48, 48, 53, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2810 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2820 */  48, 48, 48, 48, 49,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2830 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2840 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 53, 32, 78, 50, 68,
-/* 0x2850 */  83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2860 */  48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2870 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 50,
-/* 0x2880 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2890 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x28a0 */  76, 89, 10, 32, 51, 54, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32,
-/* 0x28b0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48,
-/* 0x28c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28d0 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 51, 51, 32, 32, 50, 42, 42,
-/* 0x28e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x28f0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 55,
-/* 0x2900 */  32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2910 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2920 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2930 */  48, 48, 50, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2940 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2950 */  32, 51, 56, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32, 32, 32,
-/* 0x2960 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48,
-/* 0x2970 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2980 */  48, 48, 48, 48, 48, 50, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2990 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x29a0 */  76, 89, 10, 32, 51, 57, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32,
-/* 0x29b0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48,
-/* 0x29c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29d0 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 52, 55, 32, 32, 50, 42, 42,
-/* 0x29e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x29f0 */  68, 79, 78, 76, 89, 10, 32, 52, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x2a00 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x2a10 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2a20 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 48, 32, 32,
-/* 0x2a30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2a40 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2a50 */  32, 52, 49, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32, 32,
-/* 0x2a60 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48,
-/* 0x2a70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2a80 */  48, 48, 48, 48, 48, 50, 53, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2a90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2aa0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 50, 32, 78, 50,
-/* 0x2ab0 */  68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2ac0 */  48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2ae0 */  55, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2af0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2b00 */  78, 76, 89, 10, 32, 52, 51, 32, 78, 50, 68, 68, 69, 67, 54, 48,
-/* 0x2b10 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2b20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2b30 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 56, 98, 32, 32, 50, 42,
-/* 0x2b40 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2b50 */  65, 68, 79, 78, 76, 89, 10, 32, 52, 52, 32, 78, 50, 69, 83, 77,
-/* 0x2b60 */  65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b70 */  51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2b80 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 56, 98, 32,
-/* 0x2b90 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2ba0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2bb0 */  10, 32, 52, 53, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32,
-/* 0x2bc0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x2bd0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2be0 */  32, 48, 48, 48, 48, 48, 50, 56,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2bf0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2c00 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 78,
-/* 0x2c10 */  50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2c20 */  48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2c30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2c40 */  50, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2c50 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52,
-/* 0x2c60 */  55, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2c70 */  48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2c80 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2c90 */  48, 48, 48, 50, 57, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2ca0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2cb0 */  10, 32, 52, 56, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32, 32,
-/* 0x2cc0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x2cd0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2ce0 */  32, 48, 48, 48, 48, 48, 50, 97, 49, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2cf0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2d00 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 57, 32, 78,
-/* 0x2d10 */  50, 69, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2d20 */  48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d40 */  50, 97, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2d50 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2d60 */  79, 78, 76, 89, 10, 32, 53, 48, 32, 78, 50, 69, 68, 69, 67, 50,
-/* 0x2d70 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32,
-/* 0x2d80 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 97,102, 32, 32, 50,
-/* 0x2da0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2db0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 49, 32, 78, 50, 69, 83,
-/* 0x2dc0 */  77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2dd0 */  48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2de0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 98, 99,
-/* 0x2df0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2e00 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2e10 */  89, 10, 32, 53, 50, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 32,
-/* 0x2e20 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48,
-/* 0x2e30 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e40 */  32, 32, 48, 48, 48, 48, 48, 50, 99, 57, 32, 32, 50, 42, 42, 48,
-/* 0x2e50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2e60 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 51, 32,
-/* 0x2e70 */  78, 50, 69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2e80 */  48, 48, 48, 48, 53,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2ea0 */  48, 50,100, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2eb0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2ec0 */  68, 79, 78, 76, 89, 10, 32, 53, 52, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2ed0 */  52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100,
-/* 0x2ee0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2ef0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 51, 55, 32, 32,
-/* 0x2f00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2f10 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2f20 */  32, 53, 53, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32, 32,
-/* 0x2f30 */  32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48,
-/* 0x2f40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2f50 */  48, 48, 48, 48, 48, 51, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2f60 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2f70 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 54, 32, 78, 50,
-/* 0x2f80 */  69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2f90 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2fa0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x2fb0 */  53, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2fc0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 55,
-/* 0x2fd0 */  32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2fe0 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ff0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3000 */  48, 48, 51, 53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3010 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3020 */  32, 53, 56, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32,
-/* 0x3030 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48,
-/* 0x3040 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3050 */  48, 48, 48, 48, 48, 51, 53, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3060 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3070 */  76, 89, 10, 32, 53, 57, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32,
-/* 0x3080 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48,
-/* 0x3090 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30a0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 54, 49, 32, 32, 50, 42, 42,
-/* 0x30b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x30c0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 48,
-/* 0x30d0 */  32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x30e0 */  48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3100 */  48, 48, 51, 54,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3110 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3120 */  65, 68, 79, 78, 76, 89, 10, 32, 54, 49, 32, 78, 50, 69, 70, 65,
-/* 0x3130 */  83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x3140 */  54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3150 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 56, 54, 32,
-/* 0x3160 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3170 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3180 */  10, 32, 54, 50, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 32, 32,
-/* 0x3190 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x31a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x31b0 */  32, 48, 48, 48, 48, 48, 51, 57, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x31c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x31d0 */  78, 76, 89, 10, 32, 54, 51, 32, 67, 76, 49, 83, 77, 65, 49, 66,
-/* 0x31e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x31f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3200 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 57, 99, 32, 32, 50, 42,
-/* 0x3210 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3220 */  65, 68, 79, 78, 76, 89, 10, 32, 54, 52, 32, 67, 76, 49, 70, 65,
-/* 0x3230 */  83, 49, 66, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3240 */  54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3250 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 57,101, 32,
-/* 0x3260 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3270 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 53, 32, 67, 76,
-/* 0x3280 */  49, 71, 69, 84, 49, 66, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3290 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x32a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x32b0 */  97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x32c0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 54,
-/* 0x32d0 */  32, 67, 76, 49, 69, 78, 84, 69, 82, 32, 32, 32, 32, 32, 32, 48,
-/* 0x32e0 */  48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3300 */  48, 48, 51, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3310 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3320 */  65, 68, 79, 78, 76, 89, 10, 32, 54, 55, 32, 67, 76, 49, 83, 77,
-/* 0x3330 */  65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3340 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3350 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 97, 97, 32,
-/* 0x3360 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3370 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3380 */  10, 32, 54, 56, 32, 67, 76, 49, 82, 76, 79, 65, 68, 32, 32, 32,
-/* 0x3390 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48,
-/* 0x33a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x33b0 */  32, 48, 48, 48, 48, 48, 51, 97,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x33c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x33d0 */  78, 76, 89, 10, 32, 54, 57, 32, 67, 76, 49, 87, 73, 68, 48, 49,
-/* 0x33e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x33f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3400 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 98, 55, 32, 32, 50, 42,
-/* 0x3410 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3420 */  65, 68, 79, 78, 76, 89, 10, 32, 55, 48, 32, 67, 76, 49, 87, 73,
-/* 0x3430 */  68, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3440 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3450 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 98, 57, 32,
-/* 0x3460 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3470 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 49, 32, 67, 76,
-/* 0x3480 */  49, 87, 73, 68, 48, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3490 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x34a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x34b0 */  98, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x34c0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x34d0 */  78, 76, 89, 10, 32, 55, 50, 32, 67, 76, 49, 87, 73, 68, 48, 52,
-/* 0x34e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x34f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3500 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 98,100, 32, 32, 50, 42,
-/* 0x3510 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3520 */  65, 68, 79, 78, 76, 89, 10, 32, 55, 51, 32, 67, 76, 49, 87, 73,
-/* 0x3530 */  68, 48, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3540 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3550 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 98,102, 32,
-/* 0x3560 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3570 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3580 */  10, 32, 55, 52, 32, 67, 76, 49, 87, 73, 68, 48, 54, 32, 32, 32,
-/* 0x3590 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x35a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x35b0 */  32, 48, 48, 48, 48, 48, 51, 99, 49, 32, 32, 50, 42, 42, 48, 32,
-/* 0x35c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x35d0 */  78, 76, 89, 10, 32, 55, 53, 32, 67, 76, 49, 87, 73, 68, 48, 55,
-/* 0x35e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32,
-/* 0x35f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3600 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 99, 51, 32, 32, 50, 42,
-/* 0x3610 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3620 */  65, 68, 79, 78, 76, 89, 10, 32, 55, 54, 32, 67, 76, 49, 87, 73,
-/* 0x3630 */  68, 48, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x3640 */  97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3650 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 99, 54, 32,
-/* 0x3660 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3670 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3680 */  10, 32, 55, 55, 32, 67, 76, 49, 87, 73, 68, 48, 57, 32, 32, 32,
-/* 0x3690 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x36a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x36b0 */  32, 48, 48, 48, 48, 48, 51,101, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x36c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x36d0 */  78, 76, 89, 10, 32, 55, 56, 32, 67, 76, 49, 87, 73, 68, 49, 48,
-/* 0x36e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 49, 32, 32,
-/* 0x36f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3700 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51,101, 50, 32, 32, 50, 42,
-/* 0x3710 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3720 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55,
-/* 0x3730 */  57, 32, 67, 76, 49, 83, 84, 65, 82, 84, 32, 32, 32, 32, 32, 32,
-/* 0x3740 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3750 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3760 */  48, 48, 48, 51,102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3770 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3780 */  10, 32, 56, 48, 32, 67, 76, 49, 84, 79, 80, 48, 48, 32, 32, 32,
-/* 0x3790 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48,
-/* 0x37a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x37b0 */  32, 48, 48, 48, 48, 48, 51,102, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x37c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x37d0 */  78, 76, 89, 10, 32, 56, 49, 32, 67, 76, 49, 84, 79, 80, 48, 49,
-/* 0x37e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x37f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51,102, 98, 32, 32, 50, 42,
-/* 0x3810 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3820 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56,
-/* 0x3830 */  50, 32, 67, 76, 49, 84, 79, 80, 48, 50, 32, 32, 32, 32, 32, 32,
-/* 0x3840 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3850 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3860 */  48, 48, 48, 51,102,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3870 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3880 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 51, 32, 67, 76, 49, 84,
-/* 0x3890 */  79, 80, 48, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x38a0 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x38b0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,102,102,
-/* 0x38c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x38d0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x38e0 */  89, 10, 32, 56, 52, 32, 67, 76, 49, 84, 79, 80, 48, 52, 32, 32,
-/* 0x38f0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x3900 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3910 */  32, 32, 48, 48, 48, 48, 48, 52, 48, 49, 32, 32, 50, 42, 42, 48,
-/* 0x3920 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3930 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 53, 32,
-/* 0x3940 */  67, 76, 49, 84, 79, 80, 48, 53, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3950 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3960 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3970 */  48, 52, 48, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3980 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3990 */  68, 79, 78, 76, 89, 10, 32, 56, 54, 32, 67, 76, 49, 84, 79, 80,
-/* 0x39a0 */  48, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x39b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x39c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 48, 57, 32, 32,
-/* 0x39d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x39e0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x39f0 */  32, 56, 55, 32, 67, 76, 49, 84, 79, 80, 48, 55, 32, 32, 32, 32,
-/* 0x3a00 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 55, 32, 32, 48, 48, 48, 48,
-/* 0x3a10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3a20 */  48, 48, 48, 48, 48, 52, 49, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3a30 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3a40 */  76, 89, 10, 32, 56, 56, 32, 67, 76, 49, 79, 70, 70, 48, 49, 32,
-/* 0x3a50 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x3a60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a70 */  48, 32, 32, 48, 48, 48, 48, 48, 52, 50, 55, 32, 32, 50, 42, 42,
-/* 0x3a80 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3a90 */  68, 79, 78, 76, 89, 10, 32, 56, 57, 32, 67, 76, 49, 79, 70, 70,
-/* 0x3aa0 */  48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 50,
-/* 0x3ab0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ac0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 50, 57, 32, 32,
-/* 0x3ad0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3ae0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3af0 */  32, 57, 48, 32, 67, 76, 49, 79, 70, 70, 48, 51, 32, 32, 32, 32,
-/* 0x3b00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x3b10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3b20 */  48, 48, 48, 48, 48, 52, 51, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3b30 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3b40 */  76, 89, 10, 32, 57, 49, 32, 67, 76, 49, 79, 70, 70, 48, 52, 32,
-/* 0x3b50 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x3b60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b70 */  48, 32, 32, 48, 48, 48, 48, 48, 52, 51,100, 32, 32, 50, 42, 42,
-/* 0x3b80 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3b90 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 50,
-/* 0x3ba0 */  32, 67, 76, 49, 76, 69, 78, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3bb0 */  48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bc0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3bd0 */  48, 48, 52, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3be0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3bf0 */  32, 57, 51, 32, 67, 76, 49, 76, 69, 78, 48, 49, 32, 32, 32, 32,
-/* 0x3c00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x3c10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3c20 */  48, 48, 48, 48, 48, 52, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3c30 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3c40 */  76, 89, 10, 32, 57, 52, 32, 67, 76, 49, 76, 69, 78, 48, 50, 32,
-/* 0x3c50 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x3c60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c70 */  48, 32, 32, 48, 48, 48, 48, 48, 52, 52, 52, 32, 32, 50, 42, 42,
-/* 0x3c80 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3c90 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 53,
-/* 0x3ca0 */  32, 67, 76, 49, 67, 79, 80, 89, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3cb0 */  48, 48, 48, 48, 48, 51, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3cc0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3cd0 */  48, 48, 52, 52, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3ce0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3cf0 */  65, 68, 79, 78, 76, 89, 10, 32, 57, 54, 32, 67, 76, 49, 69, 78,
-/* 0x3d00 */  68, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d10 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3d20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 55, 99, 32,
-/* 0x3d30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3d40 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 55, 32, 76, 90,
-/* 0x3d50 */  77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3d60 */  48, 48, 50,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3d70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,
-/* 0x3d80 */  55, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3d90 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3da0 */  78, 76, 89, 10, 32, 57, 56, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x3db0 */  48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32,
-/* 0x3dc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3dd0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 97, 97, 32, 32, 50, 42,
-/* 0x3de0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3df0 */  65, 68, 79, 78, 76, 89, 10, 32, 57, 57, 32, 76, 90, 77, 65, 95,
-/* 0x3e00 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 56,
-/* 0x3e10 */  54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3e20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,102, 50, 32,
-/* 0x3e30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3e40 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 48, 32, 76, 90,
-/* 0x3e50 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3e60 */  48, 97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3e70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,102,
-/* 0x3e80 */  55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3e90 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 49,
-/* 0x3ea0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x3eb0 */  48, 48, 48, 48, 48, 49, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ec0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3ed0 */  48, 49, 57,102,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3ee0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3ef0 */  49, 48, 50, 32, 76, 88, 80, 84, 73, 48, 57, 48, 32, 32, 32, 32,
-/* 0x3f00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x3f10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3f20 */  48, 48, 48, 48, 49, 97, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3f30 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3f40 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 51, 32, 76, 88,
-/* 0x3f50 */  80, 84, 73, 48, 57, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3f60 */  48, 48, 49,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3f70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x3f80 */  49,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3f90 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 52,
-/* 0x3fa0 */  32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3fb0 */  48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fc0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3fd0 */  48, 49, 97, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3fe0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3ff0 */  65, 68, 79, 78, 76, 89, 10, 49, 48, 53, 32, 67, 84, 67, 76, 69,
-/* 0x4000 */  86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4010 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4020 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 52, 56, 32,
-/* 0x4030 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4040 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4050 */  10, 49, 48, 54, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 32, 32,
-/* 0x4060 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x4070 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4080 */  32, 48, 48, 48, 48, 49, 97, 52,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4090 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x40a0 */  78, 76, 89, 10, 49, 48, 55, 32, 67, 84, 66, 83, 72, 82, 48, 49,
-/* 0x40b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32,
-/* 0x40c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x40d0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 53, 50, 32, 32, 50, 42,
-/* 0x40e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x40f0 */  65, 68, 79, 78, 76, 89, 10, 49, 48, 56, 32, 67, 84, 66, 82, 79,
-/* 0x4100 */  82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4110 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4120 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 53, 54, 32,
-/* 0x4130 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4140 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 57, 32, 67, 84,
-/* 0x4150 */  66, 83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4160 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4170 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x4180 */  53, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4190 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 48,
-/* 0x41a0 */  32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x41b0 */  48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x41c0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x41d0 */  48, 49, 97, 53,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x41e0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x41f0 */  65, 68, 79, 78, 76, 89, 10, 49, 49, 49, 32, 67, 65, 76, 76, 84,
-/* 0x4200 */  82, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4210 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4220 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 54, 98, 32,
-/* 0x4230 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4240 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4250 */  10, 49, 49, 50, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32,
-/* 0x4260 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x4270 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4280 */  32, 48, 48, 48, 48, 49, 97, 55, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4290 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x42a0 */  78, 76, 89, 10, 49, 49, 51, 32, 67, 65, 76, 76, 84, 82, 69, 57,
-/* 0x42b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x42c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x42d0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 55, 50, 32, 32, 50, 42,
-/* 0x42e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x42f0 */  65, 68, 79, 78, 76, 89, 10, 49, 49, 52, 32, 67, 65, 76, 76, 84,
-/* 0x4300 */  82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4310 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4320 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 55, 52, 32,
-/* 0x4330 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4340 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4350 */  10, 49, 49, 53, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32,
-/* 0x4360 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x4370 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4380 */  32, 48, 48, 48, 48, 49, 97, 55, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4390 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x43a0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 54, 32, 67,
-/* 0x43b0 */  65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x43c0 */  48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x43d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x43e0 */  97, 55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x43f0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49,
-/* 0x4400 */  55, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x4410 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4420 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4430 */  48, 48, 49, 97, 55,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4440 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4450 */  10, 49, 49, 56, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32,
-/* 0x4460 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x4470 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4480 */  32, 48, 48, 48, 48, 49, 97, 56, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4490 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x44a0 */  78, 76, 89, 10, 49, 49, 57, 32, 67, 84, 66, 83, 87, 65, 49, 49,
-/* 0x44b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x44c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x44d0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 56, 53, 32, 32, 50, 42,
-/* 0x44e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x44f0 */  65, 68, 79, 78, 76, 89, 10, 49, 50, 48, 32, 67, 65, 76, 76, 84,
-/* 0x4500 */  82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4510 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4520 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 56, 97, 32,
-/* 0x4530 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4540 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4550 */  10, 49, 50, 49, 32, 76, 88, 85, 78, 70, 48, 48, 48, 32, 32, 32,
-/* 0x4560 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x4570 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4580 */  32, 48, 48, 48, 48, 49, 97, 56,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4590 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x45a0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 50, 32, 76,
-/* 0x45b0 */  88, 85, 78, 70, 48, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x45c0 */  48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x45d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x45e0 */  97, 57, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x45f0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50,
-/* 0x4600 */  51, 32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 32, 32, 32, 32, 32,
-/* 0x4610 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4620 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4630 */  48, 48, 49, 97, 57, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4640 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4650 */  10, 49, 50, 52, 32, 76, 88, 77, 82, 85, 48, 48, 53, 32, 32, 32,
-/* 0x4660 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x4670 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4680 */  32, 48, 48, 48, 48, 49, 97, 57, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4690 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x46a0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 53, 32, 76,
-/* 0x46b0 */  88, 77, 82, 85, 48, 48, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x46c0 */  48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x46d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x46e0 */  97, 57,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x46f0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50,
-/* 0x4700 */  54, 32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 32, 32, 32, 32, 32,
-/* 0x4710 */  48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4720 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4730 */  48, 48, 49, 97, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4740 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4750 */  10, 49, 50, 55, 32, 76, 88, 85, 78, 70, 48, 48, 56, 32, 32, 32,
-/* 0x4760 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x4770 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4780 */  32, 48, 48, 48, 48, 49, 97, 97, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4790 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x47a0 */  78, 76, 89, 10, 49, 50, 56, 32, 76, 88, 85, 78, 70, 48, 49, 48,
-/* 0x47b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x47c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x47d0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 97,102, 32, 32, 50, 42,
-/* 0x47e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x47f0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50,
-/* 0x4800 */  57, 32, 76, 88, 74, 67, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x4810 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4820 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4830 */  48, 48, 49, 97, 98, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4840 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4850 */  10, 49, 51, 48, 32, 76, 88, 77, 82, 85, 48, 52, 53, 32, 32, 32,
-/* 0x4860 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48,
-/* 0x4870 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4880 */  32, 48, 48, 48, 48, 49, 97, 98, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4890 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x48a0 */  78, 76, 89, 10, 49, 51, 49, 32, 76, 88, 77, 82, 85, 48, 52, 54,
-/* 0x48b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x48c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x48d0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 98, 97, 32, 32, 50, 42,
-/* 0x48e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x48f0 */  65, 68, 79, 78, 76, 89, 10, 49, 51, 50, 32, 76, 88, 74, 67, 67,
-/* 0x4900 */  48, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4910 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4920 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 98, 99, 32,
-/* 0x4930 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4940 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4950 */  10, 49, 51, 51, 32, 76, 88, 74, 67, 67, 48, 50, 49, 32, 32, 32,
-/* 0x4960 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x4970 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4980 */  32, 48, 48, 48, 48, 49, 97, 98,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4990 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x49a0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 52, 32, 76,
-/* 0x49b0 */  88, 74, 67, 67, 48, 50, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x49c0 */  48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x49d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x49e0 */  97, 99, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x49f0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51,
-/* 0x4a00 */  53, 32, 76, 88, 85, 78, 70, 48, 51, 55, 32, 32, 32, 32, 32, 32,
-/* 0x4a10 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4a20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4a30 */  48, 48, 49, 97, 99, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4a40 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4a50 */  10, 49, 51, 54, 32, 76, 88, 85, 78, 70, 51, 56, 54, 32, 32, 32,
-/* 0x4a60 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48,
-/* 0x4a70 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a80 */  32, 48, 48, 48, 48, 49, 97, 99, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4a90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4aa0 */  78, 76, 89, 10, 49, 51, 55, 32, 76, 88, 85, 78, 70, 51, 56, 55,
-/* 0x4ab0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32,
-/* 0x4ac0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4ad0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 99,100, 32, 32, 50, 42,
-/* 0x4ae0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4af0 */  65, 68, 79, 78, 76, 89, 10, 49, 51, 56, 32, 76, 88, 85, 78, 70,
-/* 0x4b00 */  51, 56, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b10 */  51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4b20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,100, 54, 32,
-/* 0x4b30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4b40 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4b50 */  10, 49, 51, 57, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32, 32, 32,
-/* 0x4b60 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x4b70 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4b80 */  32, 48, 48, 48, 48, 49, 97,100, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4b90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4ba0 */  78, 76, 89, 10, 49, 52, 48, 32, 76, 88, 85, 78, 70, 52, 56, 55,
-/* 0x4bb0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x4bc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4bd0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97,100,100, 32, 32, 50, 42,
-/* 0x4be0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4bf0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52,
-/* 0x4c00 */  49, 32, 76, 88, 77, 82, 85, 48, 54, 53, 32, 32, 32, 32, 32, 32,
-/* 0x4c10 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4c20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4c30 */  48, 48, 49, 97,100,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4c40 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x4c50 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 50, 32, 77, 82, 85, 66,
-/* 0x4c60 */  89, 84, 69, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4c70 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4c80 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,101, 52,
-/* 0x4c90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4ca0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 51, 32, 77,
-/* 0x4cb0 */  82, 85, 65, 82, 66, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4cc0 */  48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4cd0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x4ce0 */  97,101, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4cf0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52,
-/* 0x4d00 */  52, 32, 77, 82, 85, 66, 73, 84, 83, 51, 32, 32, 32, 32, 32, 32,
-/* 0x4d10 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4d20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4d30 */  48, 48, 49, 97,101, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4d40 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4d50 */  10, 49, 52, 53, 32, 77, 82, 85, 65, 82, 66, 52, 48, 32, 32, 32,
-/* 0x4d60 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x4d70 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4d80 */  32, 48, 48, 48, 48, 49, 97,101, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4d90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4da0 */  78, 76, 89, 10, 49, 52, 54, 32, 76, 88, 77, 82, 85, 48, 55, 48,
-/* 0x4db0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32,
-/* 0x4dc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4dd0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97,101,100, 32, 32, 50, 42,
-/* 0x4de0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4df0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52,
-/* 0x4e00 */  55, 32, 77, 82, 85, 66, 89, 84, 69, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4e10 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4e20 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4e30 */  48, 48, 49, 97,102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4e40 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4e50 */  10, 49, 52, 56, 32, 77, 82, 85, 66, 73, 84, 83, 52, 32, 32, 32,
-/* 0x4e60 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x4e70 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4e80 */  32, 48, 48, 48, 48, 49, 97,102, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4e90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4ea0 */  78, 76, 89, 10, 49, 52, 57, 32, 77, 82, 85, 65, 82, 66, 53, 48,
-/* 0x4eb0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32,
-/* 0x4ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4ed0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97,102, 97, 32, 32, 50, 42,
-/* 0x4ee0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4ef0 */  65, 68, 79, 78, 76, 89, 10, 49, 53, 48, 32, 76, 88, 77, 82, 85,
-/* 0x4f00 */  48, 56, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f10 */  51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4f20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 48, 48, 32,
-/* 0x4f30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4f40 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 49, 32, 77, 82,
-/* 0x4f50 */  85, 66, 89, 84, 69, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4f60 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4f70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98,
-/* 0x4f80 */  48, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4f90 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 50,
-/* 0x4fa0 */  32, 77, 82, 85, 65, 82, 66, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4fb0 */  48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4fc0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4fd0 */  48, 49, 98, 48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4fe0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4ff0 */  49, 53, 51, 32, 77, 82, 85, 66, 73, 84, 83, 53, 32, 32, 32, 32,
-/* 0x5000 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x5010 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5020 */  48, 48, 48, 48, 49, 98, 48, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x5030 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x5040 */  76, 89, 10, 49, 53, 52, 32, 77, 82, 85, 65, 82, 66, 55, 48, 32,
-/* 0x5050 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x5060 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5070 */  48, 32, 32, 48, 48, 48, 48, 49, 98, 48, 56, 32, 32, 50, 42, 42,
-/* 0x5080 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x5090 */  68, 79, 78, 76, 89, 10, 49, 53, 53, 32, 76, 88, 77, 82, 85, 48,
-/* 0x50a0 */  57, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98,
-/* 0x50b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x50c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 48, 99, 32, 32,
-/* 0x50d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x50e0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x50f0 */  49, 53, 54, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32, 32, 32, 32,
-/* 0x5100 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x5110 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5120 */  48, 48, 48, 48, 49, 98, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x5130 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x5140 */  76, 89, 10, 49, 53, 55, 32, 77, 82, 85, 65, 82, 66, 56, 48, 32,
-/* 0x5150 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48,
-/* 0x5160 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5170 */  48, 32, 32, 48, 48, 48, 48, 49, 98, 49, 57, 32, 32, 50, 42, 42,
-/* 0x5180 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x5190 */  68, 79, 78, 76, 89, 10, 49, 53, 56, 32, 77, 82, 85, 66, 73, 84,
-/* 0x51a0 */  83, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x51b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x51c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 49, 97, 32, 32,
-/* 0x51d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x51e0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 57, 32, 77, 82, 85,
-/* 0x51f0 */  65, 82, 66, 57, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5200 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5210 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 49,
-/* 0x5220 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x5230 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 48, 32,
-/* 0x5240 */  76, 88, 77, 82, 85, 49, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x5250 */  48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5260 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x5270 */  49, 98, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x5280 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x5290 */  54, 49, 32, 76, 88, 85, 78, 70, 48, 52, 48, 32, 32, 32, 32, 32,
-/* 0x52a0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x52b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x52c0 */  48, 48, 48, 49, 98, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x52d0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x52e0 */  89, 10, 49, 54, 50, 32, 76, 88, 77, 82, 85, 49, 49, 48, 32, 32,
-/* 0x52f0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x5300 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5310 */  32, 32, 48, 48, 48, 48, 49, 98, 51, 53, 32, 32, 50, 42, 42, 48,
-/* 0x5320 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x5330 */  79, 78, 76, 89, 10, 49, 54, 51, 32, 76, 88, 77, 82, 85, 49, 49,
-/* 0x5340 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x5350 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5360 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 51, 56, 32, 32, 50,
-/* 0x5370 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x5380 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 52, 32, 76, 88, 85, 78,
-/* 0x5390 */  70, 48, 52, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x53a0 */  48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x53b0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 51, 97,
-/* 0x53c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x53d0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x53e0 */  89, 10, 49, 54, 53, 32, 76, 88, 85, 78, 70, 48, 52, 50, 32, 32,
-/* 0x53f0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5400 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5410 */  32, 32, 48, 48, 48, 48, 49, 98, 52, 49, 32, 32, 50, 42, 42, 48,
-/* 0x5420 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x5430 */  79, 78, 76, 89, 10, 49, 54, 54, 32, 76, 69, 88, 69, 67, 48, 49,
-/* 0x5440 */  54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x5450 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5460 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 52, 49, 32, 32, 50,
-/* 0x5470 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x5480 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x5490 */  54, 55, 32, 76, 88, 77, 82, 85, 48, 49, 48, 32, 32, 32, 32, 32,
-/* 0x54a0 */  32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48,
-/* 0x54b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x54c0 */  48, 48, 48, 49, 98, 52, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x54d0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x54e0 */  89, 10, 49, 54, 56, 32, 76, 88, 74, 77, 80, 65, 48, 48, 32, 32,
-/* 0x54f0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x5500 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5510 */  32, 32, 48, 48, 48, 48, 49, 98, 52, 55, 32, 32, 50, 42, 42, 48,
-/* 0x5520 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x5530 */  79, 78, 76, 89, 10, 49, 54, 57, 32, 76, 88, 67, 65, 76, 76, 66,
-/* 0x5540 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x5550 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5560 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 52, 57, 32, 32, 50,
-/* 0x5570 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x5580 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 55, 48, 32, 76, 88, 85, 78,
-/* 0x5590 */  70, 48, 50, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x55a0 */  48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x55b0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 52, 98,
-/* 0x55c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x55d0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 55, 49, 32, 76,
-/* 0x55e0 */  88, 77, 82, 85, 48, 50, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x55f0 */  48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5600 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x5610 */  98, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x5620 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 55,
-/* 0x5630 */  50, 32, 76, 88, 74, 77, 80, 65, 48, 49, 32, 32, 32, 32, 32, 32,
-/* 0x5640 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5650 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5660 */  48, 48, 49, 98, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x5670 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x5680 */  10, 49, 55, 51, 32, 76, 88, 67, 65, 76, 76, 66, 49, 32, 32, 32,
-/* 0x5690 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x56a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x56b0 */  32, 48, 48, 48, 48, 49, 98, 53, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x56c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x56d0 */  78, 76, 89, 10, 49, 55, 52, 32, 77, 82, 85, 66, 73, 84, 83, 49,
-/* 0x56e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32,
-/* 0x56f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5700 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 53, 56, 32, 32, 50, 42,
-/* 0x5710 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x5720 */  65, 68, 79, 78, 76, 89, 10, 49, 55, 53, 32, 76, 88, 77, 82, 85,
-/* 0x5730 */  48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5740 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x5750 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 53, 57, 32,
-/* 0x5760 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x5770 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 55, 54, 32, 77, 82,
-/* 0x5780 */  85, 66, 89, 84, 69, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x5790 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x57a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98,
-/* 0x57b0 */  53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x57c0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 55, 55,
-/* 0x57d0 */  32, 77, 82, 85, 65, 82, 66, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x57e0 */  48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x57f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x5800 */  48, 49, 98, 53,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x5810 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x5820 */  49, 55, 56, 32, 76, 88, 77, 82, 85, 48, 52, 48, 32, 32, 32, 32,
-/* 0x5830 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x5840 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5850 */  48, 48, 48, 48, 49, 98, 53,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x5860 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x5870 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 55, 57, 32, 76, 88,
-/* 0x5880 */  85, 78, 70, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x5890 */  48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x58a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98,
-/* 0x58b0 */  54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x58c0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 56, 48,
-/* 0x58d0 */  32, 76, 88, 74, 67, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x58e0 */  48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x58f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x5900 */  48, 49, 98, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x5910 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x5920 */  65, 68, 79, 78, 76, 89, 10, 49, 56, 49, 32, 76, 88, 67, 74, 48,
-/* 0x5930 */  77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5940 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x5950 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 54,101, 32,
-/* 0x5960 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x5970 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 56, 50, 32, 76, 88,
-/* 0x5980 */  67, 74, 49, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x5990 */  48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x59a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98,
-/* 0x59b0 */  55, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x59c0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 56, 51,
-/* 0x59d0 */  32, 76, 88, 67, 65, 76, 74, 77, 80, 32, 32, 32, 32, 32, 32, 48,
-/* 0x59e0 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x5a00 */  48, 49, 98, 55, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x5a10 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x5a20 */  49, 56, 52, 32, 76, 88, 67, 65, 76, 76, 48, 48, 32, 32, 32, 32,
-/* 0x5a30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x5a40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5a50 */  48, 48, 48, 48, 49, 98, 55, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x5a60 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x5a70 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 56, 53, 32, 76, 88,
-/* 0x5a80 */  67, 65, 76, 76, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x5a90 */  48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5aa0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98,
-/* 0x5ab0 */  55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x5ac0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 56, 54,
-/* 0x5ad0 */  32, 76, 88, 67, 74, 50, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48,
-/* 0x5ae0 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5af0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x5b00 */  48, 49, 98, 55, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x5b10 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x5b20 */  65, 68, 79, 78, 76, 89, 10, 49, 56, 55, 32, 76, 88, 67, 74, 52,
-/* 0x5b30 */  77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5b40 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x5b50 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 55,100, 32,
-/* 0x5b60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x5b70 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x5b80 */  10, 49, 56, 56, 32, 76, 88, 67, 74, 54, 77, 82, 85, 32, 32, 32,
-/* 0x5b90 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x5ba0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5bb0 */  32, 48, 48, 48, 48, 49, 98, 55,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x5bc0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x5bd0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 56, 57, 32, 76,
-/* 0x5be0 */  88, 67, 74, 55, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x5bf0 */  48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5c00 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x5c10 */  98, 56, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x5c20 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x5c30 */  79, 78, 76, 89, 10, 49, 57, 48, 32, 76, 88, 67, 74, 56, 77, 82,
-/* 0x5c40 */  85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x5c50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5c60 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 56, 51, 32, 32, 50,
-/* 0x5c70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x5c80 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x5c90 */  57, 49, 32, 76, 88, 85, 78, 70, 48, 51, 52, 32, 32, 32, 32, 32,
-/* 0x5ca0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5cb0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5cc0 */  48, 48, 48, 49, 98, 56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x5cd0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x5ce0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 57, 50, 32, 76, 88, 77,
-/* 0x5cf0 */  82, 85, 48, 53, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5d00 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5d10 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 56,
-/* 0x5d20 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x5d30 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 57, 51, 32,
-/* 0x5d40 */  77, 82, 85, 66, 89, 84, 69, 50, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x5d50 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5d60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x5d70 */  49, 98, 56,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x5d80 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x5d90 */  57, 52, 32, 77, 82, 85, 66, 73, 84, 83, 50, 32, 32, 32, 32, 32,
-/* 0x5da0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5db0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5dc0 */  48, 48, 48, 49, 98, 57, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x5dd0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5de0 */  89, 10, 49, 57, 53, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32, 32,
-/* 0x5df0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x5e00 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5e10 */  32, 32, 48, 48, 48, 48, 49, 98, 57, 55, 32, 32, 50, 42, 42, 48,
-/* 0x5e20 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x5e30 */  79, 78, 76, 89, 10, 49, 57, 54, 32, 76, 88, 77, 82, 85, 48, 53,
-/* 0x5e40 */  55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32,
-/* 0x5e50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5e60 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 57, 99, 32, 32, 50,
-/* 0x5e70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x5e80 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 57, 55, 32, 76, 88, 77, 82,
-/* 0x5e90 */  85, 48, 53, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5ea0 */  48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5eb0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 97, 50,
-/* 0x5ec0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x5ed0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 57, 56, 32, 76,
-/* 0x5ee0 */  88, 85, 78, 70, 48, 51, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x5ef0 */  48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5f00 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x5f10 */  98, 97, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x5f20 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 57,
-/* 0x5f30 */  57, 32, 76, 88, 80, 84, 73, 49, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x5f40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5f50 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5f60 */  48, 48, 49, 98, 97, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x5f70 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x5f80 */  10, 50, 48, 48, 32, 76, 88, 80, 84, 73, 49, 52, 49, 32, 32, 32,
-/* 0x5f90 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x5fa0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5fb0 */  32, 48, 48, 48, 48, 49, 98, 97, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x5fc0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x5fd0 */  78, 76, 89, 10, 50, 48, 49, 32, 76, 88, 80, 84, 73, 49, 53, 48,
-/* 0x5fe0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32,
-/* 0x5ff0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x6000 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 97, 57, 32, 32, 50, 42,
-/* 0x6010 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x6020 */  65, 68, 79, 78, 76, 89, 10, 50, 48, 50, 32, 99,116,111,107, 51,
-/* 0x6030 */  50, 46, 48, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6040 */  55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x6050 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 98, 54, 32,
-/* 0x6060 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x6070 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x6080 */  10, 50, 48, 51, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32,
-/* 0x6090 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48,
-/* 0x60a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x60b0 */  32, 48, 48, 48, 48, 49, 98, 98,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x60c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x60d0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 50, 48, 52, 32, 99,
-/* 0x60e0 */ 116,111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x60f0 */  48, 48, 48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6100 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x6110 */  98, 99, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x6120 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x6130 */  79, 78, 76, 89, 10, 50, 48, 53, 32, 99,116,111,107, 51, 50, 46,
-/* 0x6140 */  51, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x6150 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x6160 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98,101, 98, 32, 32, 50,
-/* 0x6170 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x6180 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 50,
-/* 0x6190 */  48, 54, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32,
-/* 0x61a0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x61b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x61c0 */  48, 48, 48, 49, 98,102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x61d0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x61e0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 50, 48, 55, 32, 76, 88, 80,
-/* 0x61f0 */  84, 73, 49, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x6200 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x6210 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98,102,
-/* 0x6220 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x6230 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 50, 48, 56, 32,
-/* 0x6240 */  76, 88, 80, 84, 73, 50, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x6250 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6260 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x6270 */  49, 98,102, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x6280 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83,
-/* 0x6290 */  89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48,
-/* 0x62a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x62b0 */  80, 84, 73, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x62c0 */  76, 88, 80, 84, 73, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x62d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 48,
-/* 0x62e0 */  52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 80, 84,
-/* 0x62f0 */  73, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6300 */  32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 48, 52, 49,  9, 48,
-/* 0x6310 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 80, 84, 73, 48, 52, 49,
-/* 0x6320 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6330 */  32, 32, 76, 88, 80, 84, 73, 48, 52, 50,  9, 48, 48, 48, 48, 48,
-/* 0x6340 */  48, 48, 48, 32, 76, 88, 80, 84, 73, 48, 52, 50, 10, 48, 48, 48,
-/* 0x6350 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6360 */  80, 84, 73, 48, 52, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6370 */  76, 88, 80, 84, 73, 48, 52, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6380 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x6390 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x63a0 */  77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x63b0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49,  9, 48,
-/* 0x63c0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 49, 49,
-/* 0x63d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x63e0 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x63f0 */  48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x6400 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6410 */  66, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6420 */  78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6430 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x6440 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68,
-/* 0x6450 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6460 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48,  9, 48,
-/* 0x6470 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 53, 48,
-/* 0x6480 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6490 */  32, 32, 78, 50, 66, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48,
-/* 0x64a0 */  48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48,
-/* 0x64b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x64c0 */  66, 68, 69, 67, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x64d0 */  78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x64e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65,
-/* 0x64f0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83,
-/* 0x6500 */  77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6510 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49,  9, 48,
-/* 0x6520 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49,
-/* 0x6530 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6540 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6550 */  48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x6560 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6570 */  68, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6580 */  78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6590 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x65a0 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68,
-/* 0x65b0 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x65c0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48,  9, 48,
-/* 0x65d0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48,
-/* 0x65e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x65f0 */  32, 32, 78, 50, 68, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48,
-/* 0x6600 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48,
-/* 0x6610 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6620 */  68, 68, 69, 67, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6630 */  78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6640 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x6650 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x6660 */  77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6670 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49,  9, 48,
-/* 0x6680 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 49,
-/* 0x6690 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x66a0 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x66b0 */  48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x66c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x66d0 */  69, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x66e0 */  78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x66f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x6700 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68,
-/* 0x6710 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6720 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48,  9, 48,
-/* 0x6730 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 53, 48,
-/* 0x6740 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6750 */  32, 32, 78, 50, 69, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48,
-/* 0x6760 */  48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48,
-/* 0x6770 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6780 */  69, 68, 69, 67, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6790 */  78, 50, 69, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x67a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 82, 76, 79,
-/* 0x67b0 */  65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 82,
-/* 0x67c0 */  76, 79, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x67d0 */  32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 49,  9, 48,
-/* 0x67e0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87, 73, 68, 48, 49,
-/* 0x67f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6800 */  32, 32, 67, 76, 49, 87, 73, 68, 48, 54,  9, 48, 48, 48, 48, 48,
-/* 0x6810 */  48, 48, 48, 32, 67, 76, 49, 87, 73, 68, 48, 54, 10, 48, 48, 48,
-/* 0x6820 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x6830 */  49, 87, 73, 68, 48, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6840 */  67, 76, 49, 87, 73, 68, 48, 56, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6850 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68,
-/* 0x6860 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87,
-/* 0x6870 */  73, 68, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6880 */  32, 32, 32,100, 32, 32, 67, 76, 49, 83, 84, 65, 82, 84,  9, 48,
-/* 0x6890 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 83, 84, 65, 82, 84,
-/* 0x68a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x68b0 */  32, 32, 67, 76, 49, 84, 79, 80, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x68c0 */  48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 48, 10, 48, 48, 48,
-/* 0x68d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x68e0 */  49, 84, 79, 80, 48, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x68f0 */  67, 76, 49, 84, 79, 80, 48, 54, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6900 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80,
-/* 0x6910 */  48, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 84,
-/* 0x6920 */  79, 80, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6930 */  32, 32, 32,100, 32, 32, 67, 76, 49, 76, 69, 78, 48, 48,  9, 48,
-/* 0x6940 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 76, 69, 78, 48, 48,
-/* 0x6950 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6960 */  32, 32, 67, 76, 49, 67, 79, 80, 89, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6970 */  48, 48, 48, 32, 67, 76, 49, 67, 79, 80, 89, 48, 10, 48, 48, 48,
-/* 0x6980 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6990 */  80, 84, 73, 48, 57, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x69a0 */  76, 88, 80, 84, 73, 48, 57, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x69b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x69c0 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x69d0 */  84, 82, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x69e0 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48,  9, 48,
-/* 0x69f0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 48,
-/* 0x6a00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6a10 */  32, 32, 67, 65, 76, 76, 84, 82, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x6a20 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 48, 48, 48,
-/* 0x6a30 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x6a40 */  76, 76, 84, 82, 49, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6a50 */  67, 65, 76, 76, 84, 82, 49, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6a60 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6a70 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x6a80 */  70, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6a90 */  32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 49, 48,  9, 48,
-/* 0x6aa0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67, 48, 49, 48,
-/* 0x6ab0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6ac0 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 55,  9, 48, 48, 48, 48, 48,
-/* 0x6ad0 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 48, 48, 48,
-/* 0x6ae0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6af0 */  77, 82, 85, 48, 55, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6b00 */  76, 88, 77, 82, 85, 48, 55, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6b10 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49,
-/* 0x6b20 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82,
-/* 0x6b30 */  85, 49, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6b40 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48,  9, 48,
-/* 0x6b50 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 52, 48,
-/* 0x6b60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6b70 */  32, 32, 76, 88, 85, 78, 70, 48, 52, 50,  9, 48, 48, 48, 48, 48,
-/* 0x6b80 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 52, 50, 10, 48, 48, 48,
-/* 0x6b90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6ba0 */  77, 82, 85, 48, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6bb0 */  76, 88, 77, 82, 85, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6bc0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6bd0 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x6be0 */  70, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6bf0 */  32, 32, 32,100, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85,  9, 48,
-/* 0x6c00 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 56, 77, 82, 85,
-/* 0x6c10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6c20 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 52,  9, 48, 48, 48, 48, 48,
-/* 0x6c30 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 48, 48, 48,
-/* 0x6c40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6c50 */  80, 84, 73, 49, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6c60 */  76, 88, 80, 84, 73, 49, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6c70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 49,
-/* 0x6c80 */  52, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 80, 84,
-/* 0x6c90 */  73, 49, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6ca0 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,  9,
-/* 0x6cb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46,
-/* 0x6cc0 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6cd0 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9, 48, 48,
-/* 0x6ce0 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x6cf0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6d00 */  32, 32, 99,116,111,107, 51, 50, 46, 50, 48,  9, 48, 48, 48, 48,
-/* 0x6d10 */  48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48,
-/* 0x6d20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6d30 */  99,116,111,107, 51, 50, 46, 52, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6d40 */  48, 48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48,
-/* 0x6d50 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6d60 */  80, 84, 73, 50, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6d70 */  76, 88, 80, 84, 73, 50, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6d80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 48,
-/* 0x6d90 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 80, 84,
-/* 0x6da0 */  73, 48, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6db0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 48,  9, 48,
-/* 0x6dc0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 49, 48,
-/* 0x6dd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6de0 */  32, 32, 78, 50, 66, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6df0 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10, 48, 48, 48,
-/* 0x6e00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6e10 */  66, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6e20 */  78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6e30 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x6e40 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x6e50 */  77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6e60 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51, 48,  9, 48,
-/* 0x6e70 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 51, 48,
-/* 0x6e80 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6e90 */  32, 32, 78, 50, 66, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6ea0 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10, 48, 48, 48,
-/* 0x6eb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6ec0 */  66, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6ed0 */  78, 50, 66, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ee0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x6ef0 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x6f00 */  77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6f10 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 53, 48,  9, 48,
-/* 0x6f20 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 53, 48,
-/* 0x6f30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6f40 */  32, 32, 78, 50, 66, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x6f50 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10, 48, 48, 48,
-/* 0x6f60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x6f70 */  66, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6f80 */  78, 50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6f90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x6fa0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x6fb0 */  65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6fc0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 50, 48,  9, 48,
-/* 0x6fd0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 50, 48,
-/* 0x6fe0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x6ff0 */  32, 32, 78, 50, 68, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x7000 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 10, 48, 48, 48,
-/* 0x7010 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x7020 */  68, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7030 */  78, 50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7040 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x7050 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x7060 */  65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7070 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 52, 48,  9, 48,
-/* 0x7080 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 52, 48,
-/* 0x7090 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x70a0 */  32, 32, 78, 50, 68, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48,
-/* 0x70b0 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10, 48, 48, 48,
-/* 0x70c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x70d0 */  68, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x70e0 */  78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x70f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x7100 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x7110 */  65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7120 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54, 48,  9, 48,
-/* 0x7130 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 54, 48,
-/* 0x7140 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7150 */  32, 32, 78, 50, 68, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x7160 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10, 48, 48, 48,
-/* 0x7170 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x7180 */  69, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7190 */  78, 50, 69, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x71a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x71b0 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x71c0 */  77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x71d0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 50, 48,  9, 48,
-/* 0x71e0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x71f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7200 */  32, 32, 78, 50, 69, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x7210 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10, 48, 48, 48,
-/* 0x7220 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x7230 */  69, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7240 */  78, 50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7250 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x7260 */  52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x7270 */  77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7280 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 52, 48,  9, 48,
-/* 0x7290 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 52, 48,
-/* 0x72a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x72b0 */  32, 32, 78, 50, 69, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x72c0 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 53, 48, 10, 48, 48, 48,
-/* 0x72d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x72e0 */  69, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x72f0 */  78, 50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7300 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x7310 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x7320 */  77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7330 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 48,  9, 48,
-/* 0x7340 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 54, 48,
-/* 0x7350 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7360 */  32, 32, 67, 76, 49, 83, 77, 65, 49, 66,  9, 48, 48, 48, 48, 48,
-/* 0x7370 */  48, 48, 48, 32, 67, 76, 49, 83, 77, 65, 49, 66, 10, 48, 48, 48,
-/* 0x7380 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x7390 */  49, 70, 65, 83, 49, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x73a0 */  67, 76, 49, 70, 65, 83, 49, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x73b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 71, 69, 84,
-/* 0x73c0 */  49, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 71,
-/* 0x73d0 */  69, 84, 49, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x73e0 */  32, 32, 32,100, 32, 32, 67, 76, 49, 69, 78, 84, 69, 82,  9, 48,
-/* 0x73f0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 69, 78, 84, 69, 82,
-/* 0x7400 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7410 */  32, 32, 67, 76, 49, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x7420 */  48, 48, 48, 32, 67, 76, 49, 83, 77, 65, 49, 48, 10, 48, 48, 48,
-/* 0x7430 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x7440 */  49, 87, 73, 68, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7450 */  67, 76, 49, 87, 73, 68, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7460 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68,
-/* 0x7470 */  48, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87,
-/* 0x7480 */  73, 68, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7490 */  32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 52,  9, 48,
-/* 0x74a0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87, 73, 68, 48, 52,
-/* 0x74b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x74c0 */  32, 32, 67, 76, 49, 87, 73, 68, 48, 53,  9, 48, 48, 48, 48, 48,
-/* 0x74d0 */  48, 48, 48, 32, 67, 76, 49, 87, 73, 68, 48, 53, 10, 48, 48, 48,
-/* 0x74e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x74f0 */  49, 87, 73, 68, 48, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7500 */  67, 76, 49, 87, 73, 68, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7510 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68,
-/* 0x7520 */  48, 57,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87,
-/* 0x7530 */  73, 68, 48, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7540 */  32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 49,  9, 48,
-/* 0x7550 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 49,
-/* 0x7560 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7570 */  32, 32, 67, 76, 49, 84, 79, 80, 48, 50,  9, 48, 48, 48, 48, 48,
-/* 0x7580 */  48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 50, 10, 48, 48, 48,
-/* 0x7590 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x75a0 */  49, 84, 79, 80, 48, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x75b0 */  67, 76, 49, 84, 79, 80, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x75c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80,
-/* 0x75d0 */  48, 52,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 84,
-/* 0x75e0 */  79, 80, 48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x75f0 */  32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 53,  9, 48,
-/* 0x7600 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 53,
-/* 0x7610 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7620 */  32, 32, 67, 76, 49, 79, 70, 70, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x7630 */  48, 48, 48, 32, 67, 76, 49, 79, 70, 70, 48, 49, 10, 48, 48, 48,
-/* 0x7640 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x7650 */  49, 79, 70, 70, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7660 */  67, 76, 49, 79, 70, 70, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7670 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 79, 70, 70,
-/* 0x7680 */  48, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 79,
-/* 0x7690 */  70, 70, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x76a0 */  32, 32, 32,100, 32, 32, 67, 76, 49, 79, 70, 70, 48, 52,  9, 48,
-/* 0x76b0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 79, 70, 70, 48, 52,
-/* 0x76c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x76d0 */  32, 32, 67, 76, 49, 76, 69, 78, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x76e0 */  48, 48, 48, 32, 67, 76, 49, 76, 69, 78, 48, 49, 10, 48, 48, 48,
-/* 0x76f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x7700 */  49, 76, 69, 78, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7710 */  67, 76, 49, 76, 69, 78, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7720 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 69, 78, 68,
-/* 0x7730 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 69, 78, 68,
-/* 0x7740 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7750 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  9, 48, 48, 48,
-/* 0x7760 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,
-/* 0x7770 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7780 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48,
-/* 0x7790 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x77a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x77b0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48,
-/* 0x77c0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x77d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x77e0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48,
-/* 0x77f0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x7800 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7810 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x7820 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x7830 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7840 */  32, 32, 76, 88, 80, 84, 73, 48, 57, 48,  9, 48, 48, 48, 48, 48,
-/* 0x7850 */  48, 48, 48, 32, 76, 88, 80, 84, 73, 48, 57, 48, 10, 48, 48, 48,
-/* 0x7860 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x7870 */  67, 76, 69, 86, 69, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7880 */  67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7890 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x78a0 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x78b0 */  84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x78c0 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49,  9, 48,
-/* 0x78d0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49,
-/* 0x78e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x78f0 */  32, 32, 67, 84, 66, 82, 79, 82, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x7900 */  48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48,
-/* 0x7910 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x7920 */  66, 83, 87, 65, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7930 */  67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7940 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x7950 */  48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x7960 */  84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7970 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 56,  9, 48,
-/* 0x7980 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56,
-/* 0x7990 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x79a0 */  32, 32, 67, 65, 76, 76, 84, 82, 69, 57,  9, 48, 48, 48, 48, 48,
-/* 0x79b0 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48,
-/* 0x79c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x79d0 */  67, 76, 69, 86, 69, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x79e0 */  67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x79f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x7a00 */  49, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x7a10 */  84, 82, 49, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7a20 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 49, 49,  9, 48,
-/* 0x7a30 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49,
-/* 0x7a40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7a50 */  32, 32, 67, 84, 66, 82, 79, 82, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x7a60 */  48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48,
-/* 0x7a70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x7a80 */  66, 83, 87, 65, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7a90 */  67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7aa0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x7ab0 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x7ac0 */  70, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7ad0 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48, 50,  9, 48,
-/* 0x7ae0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 48, 50,
-/* 0x7af0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7b00 */  32, 32, 77, 82, 85, 66, 89, 84, 69, 48,  9, 48, 48, 48, 48, 48,
-/* 0x7b10 */  48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 48, 10, 48, 48, 48,
-/* 0x7b20 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x7b30 */  77, 82, 85, 48, 48, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7b40 */  76, 88, 77, 82, 85, 48, 48, 53, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7b50 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x7b60 */  48, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82,
-/* 0x7b70 */  85, 48, 48, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7b80 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 55,  9, 48,
-/* 0x7b90 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 48, 55,
-/* 0x7ba0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7bb0 */  32, 32, 76, 88, 85, 78, 70, 48, 48, 56,  9, 48, 48, 48, 48, 48,
-/* 0x7bc0 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 48, 56, 10, 48, 48, 48,
-/* 0x7bd0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x7be0 */  77, 82, 85, 48, 52, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7bf0 */  76, 88, 77, 82, 85, 48, 52, 53, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7c00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x7c10 */  52, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82,
-/* 0x7c20 */  85, 48, 52, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7c30 */  32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 48,  9, 48,
-/* 0x7c40 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67, 48, 50, 48,
-/* 0x7c50 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7c60 */  32, 32, 76, 88, 74, 67, 67, 48, 50, 49,  9, 48, 48, 48, 48, 48,
-/* 0x7c70 */  48, 48, 48, 32, 76, 88, 74, 67, 67, 48, 50, 49, 10, 48, 48, 48,
-/* 0x7c80 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x7c90 */  74, 67, 67, 48, 50, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7ca0 */  76, 88, 74, 67, 67, 48, 50, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7cb0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51,
-/* 0x7cc0 */  56, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x7cd0 */  70, 51, 56, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7ce0 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 55,  9, 48,
-/* 0x7cf0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 51, 56, 55,
-/* 0x7d00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7d10 */  32, 32, 76, 88, 85, 78, 70, 51, 56, 56,  9, 48, 48, 48, 48, 48,
-/* 0x7d20 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 51, 56, 56, 10, 48, 48, 48,
-/* 0x7d30 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x7d40 */  85, 78, 70, 52, 56, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7d50 */  76, 88, 85, 78, 70, 52, 56, 54, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7d60 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 52,
-/* 0x7d70 */  56, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78,
-/* 0x7d80 */  70, 52, 56, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7d90 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 54, 53,  9, 48,
-/* 0x7da0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 54, 53,
-/* 0x7db0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7dc0 */  32, 32, 77, 82, 85, 66, 89, 84, 69, 51,  9, 48, 48, 48, 48, 48,
-/* 0x7dd0 */  48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 51, 10, 48, 48, 48,
-/* 0x7de0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x7df0 */  85, 65, 82, 66, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7e00 */  77, 82, 85, 65, 82, 66, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7e10 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84,
-/* 0x7e20 */  83, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66,
-/* 0x7e30 */  73, 84, 83, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7e40 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 52, 48,  9, 48,
-/* 0x7e50 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 52, 48,
-/* 0x7e60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7e70 */  32, 32, 77, 82, 85, 66, 89, 84, 69, 52,  9, 48, 48, 48, 48, 48,
-/* 0x7e80 */  48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 52, 10, 48, 48, 48,
-/* 0x7e90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x7ea0 */  85, 66, 73, 84, 83, 52,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7eb0 */  77, 82, 85, 66, 73, 84, 83, 52, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7ec0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66,
-/* 0x7ed0 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65,
-/* 0x7ee0 */  82, 66, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7ef0 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 56, 48,  9, 48,
-/* 0x7f00 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 56, 48,
-/* 0x7f10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7f20 */  32, 32, 77, 82, 85, 66, 89, 84, 69, 53,  9, 48, 48, 48, 48, 48,
-/* 0x7f30 */  48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 53, 10, 48, 48, 48,
-/* 0x7f40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x7f50 */  85, 65, 82, 66, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7f60 */  77, 82, 85, 65, 82, 66, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7f70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84,
-/* 0x7f80 */  83, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66,
-/* 0x7f90 */  73, 84, 83, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7fa0 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 55, 48,  9, 48,
-/* 0x7fb0 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 55, 48,
-/* 0x7fc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7fd0 */  32, 32, 76, 88, 77, 82, 85, 48, 57, 48,  9, 48, 48, 48, 48, 48,
-/* 0x7fe0 */  48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 57, 48, 10, 48, 48, 48,
-/* 0x7ff0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x8000 */  85, 66, 89, 84, 69, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x8010 */  77, 82, 85, 66, 89, 84, 69, 54, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8020 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66,
-/* 0x8030 */  56, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65,
-/* 0x8040 */  82, 66, 56, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x8050 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 54,  9, 48,
-/* 0x8060 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 54,
-/* 0x8070 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x8080 */  32, 32, 77, 82, 85, 65, 82, 66, 57, 48,  9, 48, 48, 48, 48, 48,
-/* 0x8090 */  48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 57, 48, 10, 48, 48, 48,
-/* 0x80a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x80b0 */  77, 82, 85, 49, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x80c0 */  76, 88, 77, 82, 85, 49, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x80d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49,
-/* 0x80e0 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82,
-/* 0x80f0 */  85, 49, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x8100 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 49,  9, 48,
-/* 0x8110 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 52, 49,
-/* 0x8120 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x8130 */  32, 32, 76, 69, 88, 69, 67, 48, 49, 54,  9, 48, 48, 48, 48, 48,
-/* 0x8140 */  48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 49, 54, 10, 48, 48, 48,
-/* 0x8150 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x8160 */  77, 82, 85, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x8170 */  76, 88, 77, 82, 85, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8180 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 77, 80, 65,
-/* 0x8190 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 77,
-/* 0x81a0 */  80, 65, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x81b0 */  32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 66, 48,  9, 48,
-/* 0x81c0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76, 76, 66, 48,
-/* 0x81d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x81e0 */  32, 32, 76, 88, 85, 78, 70, 48, 50, 49,  9, 48, 48, 48, 48, 48,
-/* 0x81f0 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 50, 49, 10, 48, 48, 48,
-/* 0x8200 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x8210 */  77, 82, 85, 48, 50, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x8220 */  76, 88, 77, 82, 85, 48, 50, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8230 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 77, 80, 65,
-/* 0x8240 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 77,
-/* 0x8250 */  80, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x8260 */  32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 66, 49,  9, 48,
-/* 0x8270 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76, 76, 66, 49,
-/* 0x8280 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x8290 */  32, 32, 77, 82, 85, 66, 73, 84, 83, 49,  9, 48, 48, 48, 48, 48,
-/* 0x82a0 */  48, 48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 49, 10, 48, 48, 48,
-/* 0x82b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x82c0 */  85, 66, 89, 84, 69, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x82d0 */  77, 82, 85, 66, 89, 84, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x82e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66,
-/* 0x82f0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65,
-/* 0x8300 */  82, 66, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x8310 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 48,  9, 48,
-/* 0x8320 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 52, 48,
-/* 0x8330 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x8340 */  32, 32, 76, 88, 74, 67, 67, 48, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x8350 */  48, 48, 48, 32, 76, 88, 74, 67, 67, 48, 48, 48, 10, 48, 48, 48,
-/* 0x8360 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x8370 */  67, 74, 48, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x8380 */  76, 88, 67, 74, 48, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8390 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 49, 77,
-/* 0x83a0 */  82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74,
-/* 0x83b0 */  49, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x83c0 */  32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 74, 77, 80,  9, 48,
-/* 0x83d0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76, 74, 77, 80,
-/* 0x83e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x83f0 */  32, 32, 76, 88, 67, 65, 76, 76, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x8400 */  48, 48, 48, 32, 76, 88, 67, 65, 76, 76, 48, 48, 10, 48, 48, 48,
-/* 0x8410 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x8420 */  67, 65, 76, 76, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x8430 */  76, 88, 67, 65, 76, 76, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8440 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 50, 77,
-/* 0x8450 */  82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74,
-/* 0x8460 */  50, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x8470 */  32, 32, 32,100, 32, 32, 76, 88, 67, 74, 52, 77, 82, 85,  9, 48,
-/* 0x8480 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 52, 77, 82, 85,
-/* 0x8490 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x84a0 */  32, 32, 76, 88, 67, 74, 54, 77, 82, 85,  9, 48, 48, 48, 48, 48,
-/* 0x84b0 */  48, 48, 48, 32, 76, 88, 67, 74, 54, 77, 82, 85, 10, 48, 48, 48,
-/* 0x84c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x84d0 */  67, 74, 55, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x84e0 */  76, 88, 67, 74, 55, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x84f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x8500 */  53, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82,
-/* 0x8510 */  85, 48, 53, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x8520 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 50,  9, 48,
-/* 0x8530 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 50,
-/* 0x8540 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x8550 */  32, 32, 77, 82, 85, 66, 73, 84, 83, 50,  9, 48, 48, 48, 48, 48,
-/* 0x8560 */  48, 48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 50, 10, 48, 48, 48,
-/* 0x8570 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x8580 */  85, 65, 82, 66, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x8590 */  77, 82, 85, 65, 82, 66, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x85a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x85b0 */  53, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82,
-/* 0x85c0 */  85, 48, 53, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x85d0 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 56,  9, 48,
-/* 0x85e0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 53, 56,
-/* 0x85f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x8600 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 53,  9, 48, 48, 48, 48, 48,
-/* 0x8610 */  48, 48, 48, 32, 76, 88, 85, 78, 70, 48, 51, 53, 10, 48, 48, 48,
-/* 0x8620 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x8630 */  80, 84, 73, 49, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x8640 */  76, 88, 80, 84, 73, 49, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8650 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50,
-/* 0x8660 */  46, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,
-/* 0x8670 */ 107, 51, 50, 46, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x8680 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 49, 54, 48,
-/* 0x8690 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 80, 84, 73, 49,
-/* 0x86a0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x86b0 */  32, 32, 32, 32, 76, 88, 80, 84, 73, 48, 48, 48,  9, 48, 48, 48,
-/* 0x86c0 */  48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x86d0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x86e0 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109,
-/* 0x86f0 */  97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48,
-/* 0x8700 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8710 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x8720 */ 122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8730 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x8740 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95, 99,
-/* 0x8750 */  95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x8760 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x8770 */  48, 48, 48, 48, 32,108,122,109, 97, 95,112,114,111,112,101,114,
-/* 0x8780 */ 116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x8790 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x87a0 */  48, 48, 48, 48, 32,102,105,108,116,101,114, 95,108,101,110,103,
-/* 0x87b0 */ 116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x87c0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x87d0 */  48, 48, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48,
-/* 0x87e0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x87f0 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 77,
-/* 0x8800 */  82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8810 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 80, 84,
-/* 0x8820 */  73, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x8830 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8840 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97,
-/* 0x8850 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8860 */  32, 32, 32, 76, 88, 80, 84, 73, 49, 52, 48, 10, 48, 48, 48, 48,
-/* 0x8870 */  48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x8880 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73, 49, 52, 49, 10,
-/* 0x8890 */  48, 48, 48, 48, 48, 48, 49,100, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x88a0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73,
-/* 0x88b0 */  48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 50, 53, 32, 82, 95, 51,
-/* 0x88c0 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x88d0 */  88, 80, 84, 73, 50, 48, 48, 10, 48, 48, 48, 48, 48, 48, 50,101,
-/* 0x88e0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x88f0 */  32, 32, 32, 76, 88, 80, 84, 73, 48, 52, 48, 10, 48, 48, 48, 48,
-/* 0x8900 */  48, 48, 51, 57, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x8910 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73, 48, 52, 49, 10,
-/* 0x8920 */  48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x8930 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73,
-/* 0x8940 */  48, 52, 50, 10, 48, 48, 48, 48, 48, 48, 52,102, 32, 82, 95, 51,
-/* 0x8950 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x8960 */  88, 80, 84, 73, 48, 52, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8970 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8980 */  91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8990 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x89a0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x89b0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x89c0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x89d0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x89e0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83,
-/* 0x89f0 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x8a00 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8a10 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x8a20 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8a30 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8a40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8a50 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70,
-/* 0x8a60 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8a70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8a80 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8a90 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x8aa0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8ab0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x8ac0 */  65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x8ad0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ae0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x8af0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x8b00 */  32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76,
-/* 0x8b10 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x8b20 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10,
-/* 0x8b30 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x8b40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x8b50 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95,
-/* 0x8b60 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x8b70 */  69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x8b80 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x8b90 */  66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x8ba0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8bb0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8bc0 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x8bd0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x8be0 */  48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x8bf0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50,
-/* 0x8c00 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x8c10 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69,
-/* 0x8c20 */  67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x8c30 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8c40 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32,
-/* 0x8c50 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8c60 */  32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x8c70 */  48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x8c80 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10,
-/* 0x8c90 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x8ca0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x8cb0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x8cc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8cd0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x8ce0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x8cf0 */  50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8d00 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8d10 */  91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8d20 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8d30 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8d40 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x8d50 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x8d60 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x8d70 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x8d80 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x8d90 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x8da0 */  66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x8db0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8dc0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8dd0 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x8de0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x8df0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x8e00 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93,
-/* 0x8e10 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x8e20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x8e30 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x8e40 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x8e50 */  66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x8e60 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x8e70 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x8e80 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8e90 */  79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x8ea0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x8eb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8ec0 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x8ed0 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x8ee0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8ef0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x8f00 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x8f10 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8f20 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8f30 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x8f40 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x8f50 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8f60 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58,
-/* 0x8f70 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8f80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8f90 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x8fa0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x8fb0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8fc0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x8fd0 */  50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8fe0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ff0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x9000 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x9010 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10,
-/* 0x9020 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x9030 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48,
-/* 0x9040 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x9050 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x9060 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x9070 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x9080 */  50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x9090 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x90a0 */  91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x90b0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x90c0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x90d0 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x90e0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x90f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x9100 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x9110 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x9120 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9130 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x9140 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9150 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x9160 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x9170 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x9180 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x9190 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93,
-/* 0x91a0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x91b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x91c0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x91d0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x91e0 */  68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32,
-/* 0x91f0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9200 */  32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x9210 */  48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x9220 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10,
-/* 0x9230 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x9240 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48,
-/* 0x9250 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x9260 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x9270 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x9280 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x9290 */  50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x92a0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x92b0 */  91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x92c0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x92d0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x92e0 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x92f0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x9300 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9310 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x9320 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x9330 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x9340 */  68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x9350 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9360 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x9370 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x9380 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x9390 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x93a0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93,
-/* 0x93b0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x93c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x93d0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x93e0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x93f0 */  68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x9400 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x9410 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x9420 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x9430 */  79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x9440 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x9450 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x9460 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x9470 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x9480 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x9490 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x94a0 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x94b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x94c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x94d0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x94e0 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x94f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x9500 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58,
-/* 0x9510 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x9520 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x9530 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x9540 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x9550 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x9560 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x9570 */  50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x9580 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9590 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x95a0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x95b0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10,
-/* 0x95c0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x95d0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x95e0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x95f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x9600 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x9610 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x9620 */  50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x9630 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x9640 */  91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x9650 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9660 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x9670 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x9680 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x9690 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x96a0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x96b0 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x96c0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x96d0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x96e0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x96f0 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x9700 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x9710 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x9720 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x9730 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93,
-/* 0x9740 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x9750 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x9760 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x9770 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x9780 */  69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32,
-/* 0x9790 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x97a0 */  32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x97b0 */  48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x97c0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10,
-/* 0x97d0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x97e0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48,
-/* 0x97f0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x9800 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x9810 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x9820 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x9830 */  50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x9840 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x9850 */  91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x9860 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9870 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x9880 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x9890 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x98a0 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x98b0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x98c0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x98d0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x98e0 */  69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x98f0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9900 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x9910 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x9920 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x9930 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x9940 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93,
-/* 0x9950 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x9960 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x9970 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x9980 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x9990 */  69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x99a0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x99b0 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x99c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x99d0 */  79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x99e0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x99f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x9a00 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x9a10 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x9a20 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x9a30 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49,
-/* 0x9a40 */  69, 78, 84, 69, 82, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x9a50 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9a60 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x9a70 */  50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x9a80 */  32, 32, 32, 32, 67, 76, 49, 83, 84, 65, 82, 84, 10, 10, 82, 69,
-/* 0x9a90 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x9aa0 */  32, 70, 79, 82, 32, 91, 67, 76, 49, 83, 77, 65, 49, 48, 93, 58,
-/* 0x9ab0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x9ac0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x9ad0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x9ae0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49,
-/* 0x9af0 */  82, 76, 79, 65, 68, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x9b00 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x9b10 */  76, 49, 87, 73, 68, 48, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x9b20 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9b30 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x9b40 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x9b50 */  32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 49, 48, 10, 10,
-/* 0x9b60 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x9b70 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 87, 73, 68, 48, 53,
-/* 0x9b80 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x9b90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x9ba0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x9bb0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x9bc0 */  76, 49, 87, 73, 68, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x9bd0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x9be0 */  91, 67, 76, 49, 87, 73, 68, 48, 56, 93, 58, 10, 79, 70, 70, 83,
-/* 0x9bf0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9c00 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x9c10 */  48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x9c20 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 48, 54,
-/* 0x9c30 */  10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9c40 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87,
-/* 0x9c50 */  73, 68, 49, 48, 10, 48, 48, 48, 48, 48, 48, 49, 54, 32, 82, 95,
-/* 0x9c60 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9c70 */  67, 76, 49, 67, 79, 80, 89, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x9c80 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x9c90 */  32, 91, 67, 76, 49, 87, 73, 68, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x9ca0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x9cb0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x9cc0 */  48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x9cd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48,
-/* 0x9ce0 */  55, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54,
-/* 0x9cf0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49,
-/* 0x9d00 */  87, 73, 68, 48, 56, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82,
-/* 0x9d10 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9d20 */  32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82, 69, 76, 79, 67,
-/* 0x9d30 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x9d40 */  82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 49, 93, 58, 10, 79, 70,
-/* 0x9d50 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x9d60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x9d70 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x9d80 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80,
-/* 0x9d90 */  48, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x9da0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 84,
-/* 0x9db0 */  79, 80, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x9dc0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9dd0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x9de0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x9df0 */  32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82, 69, 76,
-/* 0x9e00 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x9e10 */  70, 79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 51, 93, 58, 10,
-/* 0x9e20 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x9e30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x9e40 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9e50 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84,
-/* 0x9e60 */  79, 80, 48, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x9e70 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76,
-/* 0x9e80 */  49, 84, 79, 80, 48, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x9e90 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9ea0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x9eb0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x9ec0 */  32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82,
-/* 0x9ed0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x9ee0 */  83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 53, 93,
-/* 0x9ef0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x9f00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x9f10 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x9f20 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76,
-/* 0x9f30 */  49, 84, 79, 80, 48, 54, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x9f40 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x9f50 */  67, 76, 49, 84, 79, 80, 48, 54, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x9f60 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9f70 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x9f80 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x9f90 */  32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 48, 49, 10,
-/* 0x9fa0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x9fb0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 79, 70, 70, 48,
-/* 0x9fc0 */  50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x9fd0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x9fe0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x9ff0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa000 */  67, 76, 49, 84, 79, 80, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0xa010 */ 102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0xa020 */  32, 32, 32, 32, 67, 76, 49, 67, 79, 80, 89, 48, 10, 10, 82, 69,
-/* 0xa030 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0xa040 */  32, 70, 79, 82, 32, 91, 67, 76, 49, 79, 70, 70, 48, 52, 93, 58,
-/* 0xa050 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0xa060 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0xa070 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0xa080 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49,
-/* 0xa090 */  67, 79, 80, 89, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0xa0a0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0xa0b0 */  76, 49, 76, 69, 78, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0xa0c0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa0d0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0xa0e0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0xa0f0 */  32, 32, 32, 32, 32, 32, 67, 76, 49, 76, 69, 78, 48, 48, 10, 10,
-/* 0xa100 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0xa110 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 67, 79, 80, 89, 48,
-/* 0xa120 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0xa130 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0xa140 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95, 51,
-/* 0xa150 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0xa160 */  76, 49, 84, 79, 80, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0xa170 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0xa180 */  91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70,
-/* 0xa190 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0xa1a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0xa1b0 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0xa1c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,
-/* 0xa1d0 */ 116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48,
-/* 0xa1e0 */  48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0xa1f0 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,
-/* 0xa200 */ 110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54,
-/* 0xa210 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0xa220 */  97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97,
-/* 0xa230 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa240 */  32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
-/* 0xa250 */ 101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0xa260 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 80, 84,
-/* 0xa270 */  73, 48, 57, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0xa280 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa290 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0xa2a0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0xa2b0 */  32, 32, 32, 76, 88, 80, 84, 73, 48, 57, 49, 10, 10, 82, 69, 76,
-/* 0xa2c0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0xa2d0 */  70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93, 58, 10,
-/* 0xa2e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0xa2f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0xa300 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0xa310 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,
-/* 0xa320 */ 101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67,
-/* 0xa330 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0xa340 */  82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10, 79, 70,
-/* 0xa350 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0xa360 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0xa370 */  48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32,
-/* 0xa380 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0xa390 */  95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0xa3a0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa3b0 */  67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0xa3c0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0xa3d0 */  32, 91, 67, 65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79, 70, 70,
-/* 0xa3e0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0xa3f0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0xa400 */  48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0xa410 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0xa420 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0xa430 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84,
-/* 0xa440 */  82, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0xa450 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa460 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0xa470 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa480 */  32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10,
-/* 0xa490 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0xa4a0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49,
-/* 0xa4b0 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0xa4c0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0xa4d0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0xa4e0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa4f0 */  67, 65, 76, 76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0xa500 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0xa510 */  32, 91, 67, 84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79, 70, 70,
-/* 0xa520 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0xa530 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0xa540 */  48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32,
-/* 0xa550 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0xa560 */  99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0xa570 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0xa580 */  65, 76, 76, 84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0xa590 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0xa5a0 */  91, 67, 65, 76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70, 70, 83,
-/* 0xa5b0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa5c0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0xa5d0 */  48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0xa5e0 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48,
-/* 0xa5f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0xa600 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48,
-/* 0xa610 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0xa620 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa630 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0xa640 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa650 */  32, 76, 88, 85, 78, 70, 48, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0xa660 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0xa670 */  82, 32, 91, 76, 88, 77, 82, 85, 48, 48, 53, 93, 58, 10, 79, 70,
-/* 0xa680 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0xa690 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0xa6a0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0xa6b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 77, 82, 85, 10, 10,
-/* 0xa6c0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0xa6d0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 49, 48,
-/* 0xa6e0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0xa6f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0xa700 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0xa710 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0xa720 */  88, 85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0xa730 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0xa740 */  91, 76, 88, 74, 67, 67, 48, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0xa750 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa760 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0xa770 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0xa780 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52,
-/* 0xa790 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0xa7a0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48,
-/* 0xa7b0 */  50, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0xa7c0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa7d0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0xa7e0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa7f0 */  32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67,
-/* 0xa800 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0xa810 */  82, 32, 91, 76, 88, 85, 78, 70, 51, 56, 56, 93, 58, 10, 79, 70,
-/* 0xa820 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0xa830 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0xa840 */  48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0xa850 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0xa860 */  52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0xa870 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78,
-/* 0xa880 */  70, 52, 56, 55, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0xa890 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa8a0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0xa8b0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0xa8c0 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76,
-/* 0xa8d0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0xa8e0 */  70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 54, 53, 93, 58, 10,
-/* 0xa8f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0xa900 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0xa910 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0xa920 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82,
-/* 0xa930 */  85, 48, 55, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0xa940 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0xa950 */  77, 82, 85, 48, 55, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0xa960 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xa970 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0xa980 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0xa990 */  32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82,
-/* 0xa9a0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0xa9b0 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 57, 48, 93,
-/* 0xa9c0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0xa9d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0xa9e0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56,
-/* 0xa9f0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0xaa00 */  77, 82, 85, 49, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0xaa10 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0xaa20 */  76, 88, 85, 78, 70, 48, 52, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0xaa30 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xaa40 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0xaa50 */  48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0xaa60 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10,
-/* 0xaa70 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0xaa80 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 49,
-/* 0xaa90 */  54, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0xaaa0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0xaab0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0xaac0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xaad0 */  76, 88, 85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0xaae0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0xaaf0 */  32, 91, 76, 88, 77, 82, 85, 48, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0xab00 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0xab10 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0xab20 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0xab30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48, 51,
-/* 0xab40 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0xab50 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67,
-/* 0xab60 */  48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0xab70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xab80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32,
-/* 0xab90 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0xaba0 */  32, 32, 76, 88, 74, 67, 67, 48, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0xabb0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0xabc0 */  79, 82, 32, 91, 76, 88, 67, 65, 76, 76, 48, 48, 93, 58, 10, 79,
-/* 0xabd0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0xabe0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0xabf0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0xac00 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70,
-/* 0xac10 */  48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0xac20 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67,
-/* 0xac30 */  74, 50, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0xac40 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xac50 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0xac60 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0xac70 */  32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69,
-/* 0xac80 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0xac90 */  32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 52, 77, 82, 85, 93, 58,
-/* 0xaca0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0xacb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0xacc0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0xacd0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85,
-/* 0xace0 */  78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0xacf0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0xad00 */  88, 67, 74, 54, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0xad10 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xad20 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0xad30 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0xad40 */  32, 32, 32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 10, 10,
-/* 0xad50 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0xad60 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 55, 77, 82, 85,
-/* 0xad70 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0xad80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0xad90 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0xada0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0xadb0 */  88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0xadc0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0xadd0 */  91, 76, 88, 67, 74, 56, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83,
-/* 0xade0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0xadf0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0xae00 */  48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0xae10 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55,
-/* 0xae20 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0xae30 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48,
-/* 0xae40 */  51, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0xae50 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xae60 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0xae70 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xae80 */  32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0xae90 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0xaea0 */  82, 32, 91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79,
-/* 0xaeb0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0xaec0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0xaed0 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0xaee0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0xaef0 */  50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0xaf00 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,
-/* 0xaf10 */ 111,107, 51, 50, 46, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0xaf20 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xaf30 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0xaf40 */  48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0xaf50 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10,
-/* 0xaf60 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0xaf70 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46,
-/* 0xaf80 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0xaf90 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xafa0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0xafb0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xafc0 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0xafd0 */  48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0xafe0 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10,
-/* 0xaff0 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0xb000 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0xb010 */  50, 46, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0xb020 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,
-/* 0xb030 */ 111,107, 51, 50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0xb040 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xb050 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0xb060 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0xb070 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10,
-/* 0xb080 */  48, 48, 48, 48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0xb090 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0xb0a0 */  50, 46, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0xb0b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,
-/* 0xb0c0 */ 111,107, 51, 50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0xb0d0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0xb0e0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0xb0f0 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0xb100 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10
+/* 0x1bf0 */ 138,  7, 71,235, 13,131,233,  1,115,  3, 97,195,209,  0,  0,  0,
+/* 0x1c00 */ 217,  0,  0,  0,122,  0,  0,  0, 32, 38,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */  52,  0,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1c20 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1c30 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1c40 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1c50 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1c60 */ 139,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x1c70 */ 151,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x1c80 */ 154,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,
+/* 0x1c90 */ 156,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,
+/* 0x1ca0 */ 162,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x1cb0 */ 173,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,
+/* 0x1cc0 */ 178,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
+/* 0x1cd0 */ 187,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,
+/* 0x1ce0 */ 200,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,
+/* 0x1cf0 */ 213,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,
+/* 0x1d00 */ 228,  0,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,
+/* 0x1d10 */  34,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,
+/* 0x1d20 */  47,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,
+/* 0x1d30 */  62,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0,
+/* 0x1d40 */  64,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,
+/* 0x1d50 */  67,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0,
+/* 0x1d60 */  76,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0,
+/* 0x1d70 */  88,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0,
+/* 0x1d80 */ 113,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0,
+/* 0x1d90 */ 135,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0,
+/* 0x1da0 */ 135,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0,
+/* 0x1db0 */ 138,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0,
+/* 0x1dc0 */ 140,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0,
+/* 0x1dd0 */ 146,  1,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0,
+/* 0x1de0 */ 157,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,
+/* 0x1df0 */ 162,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0,
+/* 0x1e00 */ 171,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0,
+/* 0x1e10 */ 184,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0,
+/* 0x1e20 */ 197,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0,
+/* 0x1e30 */ 212,  1,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,
+/* 0x1e40 */  38,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0,
+/* 0x1e50 */  51,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0,
+/* 0x1e60 */  66,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0,
+/* 0x1e70 */  68,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0,
+/* 0x1e80 */  71,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0,
+/* 0x1e90 */  80,  2,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0,
+/* 0x1ea0 */  92,  2,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0,
+/* 0x1eb0 */ 117,  2,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0,
+/* 0x1ec0 */ 139,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0,
+/* 0x1ed0 */ 139,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0,
+/* 0x1ee0 */ 142,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0,
+/* 0x1ef0 */ 144,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0,
+/* 0x1f00 */ 150,  2,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0,
+/* 0x1f10 */ 161,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0,
+/* 0x1f20 */ 166,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0,
+/* 0x1f30 */ 175,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,
+/* 0x1f40 */ 188,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0,
+/* 0x1f50 */ 201,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0,
+/* 0x1f60 */ 216,  2,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0,
+/* 0x1f70 */  55,  3,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0,
+/* 0x1f80 */  68,  3,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0,
+/* 0x1f90 */  83,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0,
+/* 0x1fa0 */  85,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0,
+/* 0x1fb0 */  88,  3,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0,
+/* 0x1fc0 */  97,  3,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0,
+/* 0x1fd0 */ 109,  3,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0,
+/* 0x1fe0 */ 134,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1ff0 */ 156,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  2,  0,  0,
+/* 0x2000 */ 156,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 64,  2,  0,  0,
+/* 0x2010 */ 158,  3,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 73,  2,  0,  0,
+/* 0x2020 */ 164,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0,
+/* 0x2030 */ 164,  3,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0,
+/* 0x2040 */ 170,  3,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,100,  2,  0,  0,
+/* 0x2050 */ 175,  3,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,109,  2,  0,  0,
+/* 0x2060 */ 183,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,118,  2,  0,  0,
+/* 0x2070 */ 185,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,127,  2,  0,  0,
+/* 0x2080 */ 187,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,136,  2,  0,  0,
+/* 0x2090 */ 189,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0,
+/* 0x20a0 */ 191,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,154,  2,  0,  0,
+/* 0x20b0 */ 193,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,163,  2,  0,  0,
+/* 0x20c0 */ 195,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,172,  2,  0,  0,
+/* 0x20d0 */ 198,  3,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,181,  2,  0,  0,
+/* 0x20e0 */ 224,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,190,  2,  0,  0,
+/* 0x20f0 */ 226,  3,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,199,  2,  0,  0,
+/* 0x2100 */ 243,  3,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,208,  2,  0,  0,
+/* 0x2110 */ 248,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,217,  2,  0,  0,
+/* 0x2120 */ 251,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,226,  2,  0,  0,
+/* 0x2130 */ 253,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,235,  2,  0,  0,
+/* 0x2140 */ 255,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,244,  2,  0,  0,
+/* 0x2150 */   1,  4,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,253,  2,  0,  0,
+/* 0x2160 */   6,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  6,  3,  0,  0,
+/* 0x2170 */   9,  4,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 15,  3,  0,  0,
+/* 0x2180 */  16,  4,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0, 24,  3,  0,  0,
+/* 0x2190 */  39,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 33,  3,  0,  0,
+/* 0x21a0 */  41,  4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0, 42,  3,  0,  0,
+/* 0x21b0 */  59,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 51,  3,  0,  0,
+/* 0x21c0 */  61,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 60,  3,  0,  0,
+/* 0x21d0 */  65,  4,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 69,  3,  0,  0,
+/* 0x21e0 */  66,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 78,  3,  0,  0,
+/* 0x21f0 */  68,  4,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 87,  3,  0,  0,
+/* 0x2200 */  73,  4,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0, 96,  3,  0,  0,
+/* 0x2210 */ 124,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,103,  3,  0,  0,
+/* 0x2220 */ 124,  4,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,114,  3,  0,  0,
+/* 0x2230 */ 170,  4,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,125,  3,  0,  0,
+/* 0x2240 */ 242,  4,  0,  0,134, 10,  0,  0,  0,  0,  0,  0,136,  3,  0,  0,
+/* 0x2250 */ 120, 15,  0,  0,134, 10,  0,  0,  0,  0,  0,  0,147,  3,  0,  0,
+/* 0x2260 */ 254, 25,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,158,  3,  0,  0,
+/* 0x2270 */  24, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,167,  3,  0,  0,
+/* 0x2280 */  29, 26,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,176,  3,  0,  0,
+/* 0x2290 */  58, 26,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,185,  3,  0,  0,
+/* 0x22a0 */  72, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,194,  3,  0,  0,
+/* 0x22b0 */  77, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,203,  3,  0,  0,
+/* 0x22c0 */  82, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,212,  3,  0,  0,
+/* 0x22d0 */  86, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,221,  3,  0,  0,
+/* 0x22e0 */  88, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,230,  3,  0,  0,
+/* 0x22f0 */  93, 26,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,239,  3,  0,  0,
+/* 0x2300 */ 107, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,248,  3,  0,  0,
+/* 0x2310 */ 112, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  4,  0,  0,
+/* 0x2320 */ 114, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 10,  4,  0,  0,
+/* 0x2330 */ 116, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 19,  4,  0,  0,
+/* 0x2340 */ 120, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 28,  4,  0,  0,
+/* 0x2350 */ 125, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 37,  4,  0,  0,
+/* 0x2360 */ 127, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 46,  4,  0,  0,
+/* 0x2370 */ 131, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 55,  4,  0,  0,
+/* 0x2380 */ 133, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 64,  4,  0,  0,
+/* 0x2390 */ 138, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 73,  4,  0,  0,
+/* 0x23a0 */ 143, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 82,  4,  0,  0,
+/* 0x23b0 */ 145, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 91,  4,  0,  0,
+/* 0x23c0 */ 150, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,100,  4,  0,  0,
+/* 0x23d0 */ 152, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,109,  4,  0,  0,
+/* 0x23e0 */ 157, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,118,  4,  0,  0,
+/* 0x23f0 */ 164, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,127,  4,  0,  0,
+/* 0x2400 */ 171, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,136,  4,  0,  0,
+/* 0x2410 */ 175, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,145,  4,  0,  0,
+/* 0x2420 */ 180, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,154,  4,  0,  0,
+/* 0x2430 */ 183, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,163,  4,  0,  0,
+/* 0x2440 */ 186, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,172,  4,  0,  0,
+/* 0x2450 */ 188, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,181,  4,  0,  0,
+/* 0x2460 */ 190, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,190,  4,  0,  0,
+/* 0x2470 */ 195, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,199,  4,  0,  0,
+/* 0x2480 */ 202, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,208,  4,  0,  0,
+/* 0x2490 */ 204, 26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,217,  4,  0,  0,
+/* 0x24a0 */ 205, 26,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,226,  4,  0,  0,
+/* 0x24b0 */ 214, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,235,  4,  0,  0,
+/* 0x24c0 */ 217, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,244,  4,  0,  0,
+/* 0x24d0 */ 221, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,253,  4,  0,  0,
+/* 0x24e0 */ 223, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  6,  5,  0,  0,
+/* 0x24f0 */ 228, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 15,  5,  0,  0,
+/* 0x2500 */ 230, 26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 24,  5,  0,  0,
+/* 0x2510 */ 231, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 33,  5,  0,  0,
+/* 0x2520 */ 233, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 42,  5,  0,  0,
+/* 0x2530 */ 237, 26,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 51,  5,  0,  0,
+/* 0x2540 */ 245, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 60,  5,  0,  0,
+/* 0x2550 */ 248, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 69,  5,  0,  0,
+/* 0x2560 */ 250, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 78,  5,  0,  0,
+/* 0x2570 */   0, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 87,  5,  0,  0,
+/* 0x2580 */   3, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 96,  5,  0,  0,
+/* 0x2590 */   5, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,105,  5,  0,  0,
+/* 0x25a0 */   6, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,114,  5,  0,  0,
+/* 0x25b0 */   8, 27,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,123,  5,  0,  0,
+/* 0x25c0 */  12, 27,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,132,  5,  0,  0,
+/* 0x25d0 */  23, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,141,  5,  0,  0,
+/* 0x25e0 */  25, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,150,  5,  0,  0,
+/* 0x25f0 */  26, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,159,  5,  0,  0,
+/* 0x2600 */  28, 27,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,168,  5,  0,  0,
+/* 0x2610 */  32, 27,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,177,  5,  0,  0,
+/* 0x2620 */  48, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,186,  5,  0,  0,
+/* 0x2630 */  53, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,195,  5,  0,  0,
+/* 0x2640 */  56, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,204,  5,  0,  0,
+/* 0x2650 */  58, 27,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,213,  5,  0,  0,
+/* 0x2660 */  65, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,222,  5,  0,  0,
+/* 0x2670 */  65, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,231,  5,  0,  0,
+/* 0x2680 */  70, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,240,  5,  0,  0,
+/* 0x2690 */  71, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,249,  5,  0,  0,
+/* 0x26a0 */  73, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  2,  6,  0,  0,
+/* 0x26b0 */  75, 27,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 11,  6,  0,  0,
+/* 0x26c0 */  81, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 20,  6,  0,  0,
+/* 0x26d0 */  84, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 29,  6,  0,  0,
+/* 0x26e0 */  86, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 38,  6,  0,  0,
+/* 0x26f0 */  88, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 47,  6,  0,  0,
+/* 0x2700 */  89, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 56,  6,  0,  0,
+/* 0x2710 */  91, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 65,  6,  0,  0,
+/* 0x2720 */  93, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 74,  6,  0,  0,
+/* 0x2730 */  94, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 83,  6,  0,  0,
+/* 0x2740 */  96, 27,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 92,  6,  0,  0,
+/* 0x2750 */ 102, 27,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,101,  6,  0,  0,
+/* 0x2760 */ 110, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,110,  6,  0,  0,
+/* 0x2770 */ 112, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,119,  6,  0,  0,
+/* 0x2780 */ 115, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,128,  6,  0,  0,
+/* 0x2790 */ 118, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,137,  6,  0,  0,
+/* 0x27a0 */ 120, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,146,  6,  0,  0,
+/* 0x27b0 */ 123, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,155,  6,  0,  0,
+/* 0x27c0 */ 125, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,164,  6,  0,  0,
+/* 0x27d0 */ 127, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,173,  6,  0,  0,
+/* 0x27e0 */ 129, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,182,  6,  0,  0,
+/* 0x27f0 */ 131, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,191,  6,  0,  0,
+/* 0x2800 */ 134, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,200,  6,  0,  0,
+/* 0x2810 */ 139, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,209,  6,  0,  0,
+/* 0x2820 */ 141, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,218,  6,  0,  0,
+/* 0x2830 */ 146, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,227,  6,  0,  0,
+/* 0x2840 */ 151, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,236,  6,  0,  0,
+/* 0x2850 */ 156, 27,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,245,  6,  0,  0,
+/* 0x2860 */ 162, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,254,  6,  0,  0,
+/* 0x2870 */ 163, 27,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  7,  7,  0,  0,
+/* 0x2880 */ 169, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  7,  0,  0,
+/* 0x2890 */ 169, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  7,  0,  0,
+/* 0x28a0 */ 169, 27,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 34,  7,  0,  0,
+/* 0x28b0 */ 182, 27,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 44,  7,  0,  0,
+/* 0x28c0 */ 189, 27,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0, 54,  7,  0,  0,
+/* 0x28d0 */ 203, 27,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 64,  7,  0,  0,
+/* 0x28e0 */ 235, 27,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 74,  7,  0,  0,
+/* 0x28f0 */ 245, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 84,  7,  0,  0,
+/* 0x2900 */ 250, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 93,  7,  0,  0,
+/* 0x2910 */ 252, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2930 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2940 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x2950 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x2960 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x2970 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,
+/* 0x2980 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,
+/* 0x2990 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
+/* 0x29a0 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,
+/* 0x29b0 */  15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,
+/* 0x29c0 */  20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0,
+/* 0x29d0 */  23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0,
+/* 0x29e0 */  24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0,
+/* 0x29f0 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0,
+/* 0x2a00 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0,
+/* 0x2a10 */  28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0,
+/* 0x2a20 */  31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0,
+/* 0x2a30 */  34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0,
+/* 0x2a40 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0,
+/* 0x2a50 */  42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0,
+/* 0x2a60 */  43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0,
+/* 0x2a70 */  44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0,
+/* 0x2a80 */  46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0,
+/* 0x2a90 */  47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0,
+/* 0x2aa0 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0,
+/* 0x2ab0 */  53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0,
+/* 0x2ac0 */  58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0,
+/* 0x2ad0 */  61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  2,  0,  0,
+/* 0x2ae0 */  62,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  2,  0,  0,
+/* 0x2af0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,  2,  0,  0,
+/* 0x2b00 */  69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,154,  2,  0,  0,
+/* 0x2b10 */  74,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,172,  2,  0,  0,
+/* 0x2b20 */  76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,190,  2,  0,  0,
+/* 0x2b30 */  78,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,199,  2,  0,  0,
+/* 0x2b40 */  79,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,208,  2,  0,  0,
+/* 0x2b50 */  80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  3,  0,  0,
+/* 0x2b60 */  86,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  3,  0,  0,
+/* 0x2b70 */  87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  3,  0,  0,
+/* 0x2b80 */  92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  3,  0,  0,
+/* 0x2b90 */  95,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  3,  0,  0,
+/* 0x2ba0 */ 103,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,  3,  0,  0,
+/* 0x2bb0 */ 104,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,239,  3,  0,  0,
+/* 0x2bc0 */ 111,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  4,  0,  0,
+/* 0x2bd0 */ 114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  4,  0,  0,
+/* 0x2be0 */ 120,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,  4,  0,  0,
+/* 0x2bf0 */ 128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,145,  4,  0,  0,
+/* 0x2c00 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,199,  4,  0,  0,
+/* 0x2c10 */ 135,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  5,  0,  0,
+/* 0x2c20 */ 146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,168,  5,  0,  0,
+/* 0x2c30 */ 160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,177,  5,  0,  0,
+/* 0x2c40 */ 161,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,  5,  0,  0,
+/* 0x2c50 */ 165,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  6,  0,  0,
+/* 0x2c60 */ 175,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,  6,  0,  0,
+/* 0x2c70 */ 179,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,182,  6,  0,  0,
+/* 0x2c80 */ 190,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,191,  6,  0,  0,
+/* 0x2c90 */ 191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  0,  0,
+/* 0x2ca0 */ 199,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  7,  0,  0,
+/* 0x2cb0 */ 200,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  7,  0,  0,
+/* 0x2cc0 */ 202,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  7,  0,  0,
+/* 0x2cd0 */ 203,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  7,  0,  0,
+/* 0x2ce0 */ 204,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,  7,  0,  0,
+/* 0x2cf0 */ 206,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  7,  0,  0,
+/* 0x2d00 */ 208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x2d10 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x2d20 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x2d30 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,
+/* 0x2d40 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,
+/* 0x2d50 */  13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,
+/* 0x2d60 */  14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,
+/* 0x2d70 */  16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,
+/* 0x2d80 */  17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,
+/* 0x2d90 */  18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0,
+/* 0x2da0 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0,
+/* 0x2db0 */  21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0,
+/* 0x2dc0 */  22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0,
+/* 0x2dd0 */  26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0,
+/* 0x2de0 */  29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,
+/* 0x2df0 */  30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0,
+/* 0x2e00 */  32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0,
+/* 0x2e10 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,
+/* 0x2e20 */  35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0,
+/* 0x2e30 */  36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0,
+/* 0x2e40 */  37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0,
+/* 0x2e50 */  38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0,
+/* 0x2e60 */  40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0,
+/* 0x2e70 */  41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0,
+/* 0x2e80 */  45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0,
+/* 0x2e90 */  48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0,
+/* 0x2ea0 */  49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,
+/* 0x2eb0 */  51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0,
+/* 0x2ec0 */  52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0,
+/* 0x2ed0 */  54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0,
+/* 0x2ee0 */  55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0,
+/* 0x2ef0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0,
+/* 0x2f00 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0,
+/* 0x2f10 */  59,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0,
+/* 0x2f20 */  60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  2,  0,  0,
+/* 0x2f30 */  63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  2,  0,  0,
+/* 0x2f40 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73,  2,  0,  0,
+/* 0x2f50 */  65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0,
+/* 0x2f60 */  66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0,
+/* 0x2f70 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,118,  2,  0,  0,
+/* 0x2f80 */  70,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,127,  2,  0,  0,
+/* 0x2f90 */  71,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,  2,  0,  0,
+/* 0x2fa0 */  72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0,
+/* 0x2fb0 */  73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,163,  2,  0,  0,
+/* 0x2fc0 */  75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,  2,  0,  0,
+/* 0x2fd0 */  77,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,217,  2,  0,  0,
+/* 0x2fe0 */  81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,226,  2,  0,  0,
+/* 0x2ff0 */  82,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,235,  2,  0,  0,
+/* 0x3000 */  83,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,244,  2,  0,  0,
+/* 0x3010 */  84,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,253,  2,  0,  0,
+/* 0x3020 */  85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  3,  0,  0,
+/* 0x3030 */  88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  3,  0,  0,
+/* 0x3040 */  89,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  3,  0,  0,
+/* 0x3050 */  90,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  3,  0,  0,
+/* 0x3060 */  91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  3,  0,  0,
+/* 0x3070 */  93,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  3,  0,  0,
+/* 0x3080 */  94,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,  3,  0,  0,
+/* 0x3090 */  96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,103,  3,  0,  0,
+/* 0x30a0 */  97,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,114,  3,  0,  0,
+/* 0x30b0 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,125,  3,  0,  0,
+/* 0x30c0 */  99,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,  3,  0,  0,
+/* 0x30d0 */ 100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,147,  3,  0,  0,
+/* 0x30e0 */ 101,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,158,  3,  0,  0,
+/* 0x30f0 */ 102,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,185,  3,  0,  0,
+/* 0x3100 */ 105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,194,  3,  0,  0,
+/* 0x3110 */ 106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,203,  3,  0,  0,
+/* 0x3120 */ 107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,212,  3,  0,  0,
+/* 0x3130 */ 108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,  3,  0,  0,
+/* 0x3140 */ 109,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,230,  3,  0,  0,
+/* 0x3150 */ 110,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,  3,  0,  0,
+/* 0x3160 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  4,  0,  0,
+/* 0x3170 */ 113,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  4,  0,  0,
+/* 0x3180 */ 115,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  4,  0,  0,
+/* 0x3190 */ 116,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  4,  0,  0,
+/* 0x31a0 */ 117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  4,  0,  0,
+/* 0x31b0 */ 118,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  4,  0,  0,
+/* 0x31c0 */ 119,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73,  4,  0,  0,
+/* 0x31d0 */ 121,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  4,  0,  0,
+/* 0x31e0 */ 122,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  4,  0,  0,
+/* 0x31f0 */ 123,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  4,  0,  0,
+/* 0x3200 */ 124,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,  4,  0,  0,
+/* 0x3210 */ 125,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,118,  4,  0,  0,
+/* 0x3220 */ 126,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,127,  4,  0,  0,
+/* 0x3230 */ 127,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,154,  4,  0,  0,
+/* 0x3240 */ 130,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,163,  4,  0,  0,
+/* 0x3250 */ 131,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,172,  4,  0,  0,
+/* 0x3260 */ 132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,  4,  0,  0,
+/* 0x3270 */ 133,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,190,  4,  0,  0,
+/* 0x3280 */ 134,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,208,  4,  0,  0,
+/* 0x3290 */ 136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,217,  4,  0,  0,
+/* 0x32a0 */ 137,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,226,  4,  0,  0,
+/* 0x32b0 */ 138,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,235,  4,  0,  0,
+/* 0x32c0 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,244,  4,  0,  0,
+/* 0x32d0 */ 140,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,253,  4,  0,  0,
+/* 0x32e0 */ 141,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  5,  0,  0,
+/* 0x32f0 */ 142,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  5,  0,  0,
+/* 0x3300 */ 143,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  5,  0,  0,
+/* 0x3310 */ 144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  5,  0,  0,
+/* 0x3320 */ 145,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  5,  0,  0,
+/* 0x3330 */ 147,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  5,  0,  0,
+/* 0x3340 */ 148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  5,  0,  0,
+/* 0x3350 */ 149,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  5,  0,  0,
+/* 0x3360 */ 150,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  5,  0,  0,
+/* 0x3370 */ 151,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,  5,  0,  0,
+/* 0x3380 */ 152,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,105,  5,  0,  0,
+/* 0x3390 */ 153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,114,  5,  0,  0,
+/* 0x33a0 */ 154,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,123,  5,  0,  0,
+/* 0x33b0 */ 155,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,132,  5,  0,  0,
+/* 0x33c0 */ 156,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,141,  5,  0,  0,
+/* 0x33d0 */ 157,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,150,  5,  0,  0,
+/* 0x33e0 */ 158,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,159,  5,  0,  0,
+/* 0x33f0 */ 159,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,186,  5,  0,  0,
+/* 0x3400 */ 162,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,195,  5,  0,  0,
+/* 0x3410 */ 163,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,204,  5,  0,  0,
+/* 0x3420 */ 164,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,222,  5,  0,  0,
+/* 0x3430 */ 166,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,231,  5,  0,  0,
+/* 0x3440 */ 167,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,240,  5,  0,  0,
+/* 0x3450 */ 168,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,249,  5,  0,  0,
+/* 0x3460 */ 169,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  6,  0,  0,
+/* 0x3470 */ 170,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  6,  0,  0,
+/* 0x3480 */ 171,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  6,  0,  0,
+/* 0x3490 */ 172,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  6,  0,  0,
+/* 0x34a0 */ 173,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  6,  0,  0,
+/* 0x34b0 */ 174,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  6,  0,  0,
+/* 0x34c0 */ 176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  6,  0,  0,
+/* 0x34d0 */ 177,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,  6,  0,  0,
+/* 0x34e0 */ 178,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 92,  6,  0,  0,
+/* 0x34f0 */ 180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,101,  6,  0,  0,
+/* 0x3500 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,110,  6,  0,  0,
+/* 0x3510 */ 182,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,119,  6,  0,  0,
+/* 0x3520 */ 183,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  6,  0,  0,
+/* 0x3530 */ 184,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,137,  6,  0,  0,
+/* 0x3540 */ 185,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,  6,  0,  0,
+/* 0x3550 */ 186,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,155,  6,  0,  0,
+/* 0x3560 */ 187,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,164,  6,  0,  0,
+/* 0x3570 */ 188,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,173,  6,  0,  0,
+/* 0x3580 */ 189,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,200,  6,  0,  0,
+/* 0x3590 */ 192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,209,  6,  0,  0,
+/* 0x35a0 */ 193,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,218,  6,  0,  0,
+/* 0x35b0 */ 194,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,227,  6,  0,  0,
+/* 0x35c0 */ 195,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,236,  6,  0,  0,
+/* 0x35d0 */ 196,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,245,  6,  0,  0,
+/* 0x35e0 */ 197,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,254,  6,  0,  0,
+/* 0x35f0 */ 198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  7,  0,  0,
+/* 0x3600 */ 201,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  7,  0,  0,
+/* 0x3610 */ 205,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 84,  7,  0,  0,
+/* 0x3620 */ 207,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,  7,  0,  0,
+/* 0x3630 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,  7,  0,  0,
+/* 0x3640 */ 210,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,127,  7,  0,  0,
+/* 0x3650 */ 210,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,138,  7,  0,  0,
+/* 0x3660 */ 210,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,149,  7,  0,  0,
+/* 0x3670 */ 210,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,165,  7,  0,  0,
+/* 0x3680 */ 210,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,179,  7,  0,  0,
+/* 0x3690 */ 210,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,190,  7,  0,  0,
+/* 0x36a0 */ 210,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36b0 */  10,  0,  0,  0,195,  7,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36c0 */   0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,195,  7,  0,  0,
+/* 0x36d0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36e0 */  29,  0,  0,  0,195,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36f0 */   0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,204,  7,  0,  0,
+/* 0x3700 */  62,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3710 */  46,  0,  0,  0,195,  7,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3720 */   0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,195,  7,  0,  0,
+/* 0x3730 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3740 */  68,  0,  0,  0,195,  7,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3750 */   0,  0,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,195,  7,  0,  0,
+/* 0x3760 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x3770 */   1,  0,  0,  0,215,  7,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3780 */   0,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3790 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x37a0 */   1,  0,  0,  0,215,  7,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37b0 */   0,  0,  0,  0, 11,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,
+/* 0x37c0 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x37d0 */  12,  0,  0,  0,215,  7,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37e0 */   0,  0,  0,  0, 14,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,
+/* 0x37f0 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
+/* 0x3800 */  14,  0,  0,  0,215,  7,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3810 */   0,  0,  0,  0, 15,  0,  0,  0, 17,  0,  0,  0,215,  7,  0,  0,
+/* 0x3820 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x3830 */  47,  0,  0,  0,215,  7,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3840 */   0,  0,  0,  0, 16,  0,  0,  0, 12,  0,  0,  0,215,  7,  0,  0,
+/* 0x3850 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
+/* 0x3860 */   3,  0,  0,  0,215,  7,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3870 */   0,  0,  0,  0, 17,  0,  0,  0, 14,  0,  0,  0,215,  7,  0,  0,
+/* 0x3880 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,
+/* 0x3890 */   8,  0,  0,  0,204,  7,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38a0 */   0,  0,  0,  0, 22,  0,  0,  0, 10,  0,  0,  0,215,  7,  0,  0,
+/* 0x38b0 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,
+/* 0x38c0 */  21,  0,  0,  0,204,  7,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38d0 */   0,  0,  0,  0, 23,  0,  0,  0, 18,  0,  0,  0,204,  7,  0,  0,
+/* 0x38e0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,
+/* 0x38f0 */   1,  0,  0,  0,215,  7,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3900 */   0,  0,  0,  0, 26,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3910 */  15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,
+/* 0x3920 */   1,  0,  0,  0,215,  7,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3930 */   0,  0,  0,  0, 30,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,
+/* 0x3940 */  14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x3950 */  12,  0,  0,  0,215,  7,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3960 */   0,  0,  0,  0, 33,  0,  0,  0,  5,  0,  0,  0,215,  7,  0,  0,
+/* 0x3970 */  17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x3980 */  14,  0,  0,  0,215,  7,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3990 */   0,  0,  0,  0, 34,  0,  0,  0, 15,  0,  0,  0,215,  7,  0,  0,
+/* 0x39a0 */  16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0,
+/* 0x39b0 */  33,  0,  0,  0,215,  7,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39c0 */   0,  0,  0,  0, 34,  0,  0,  0, 67,  0,  0,  0,215,  7,  0,  0,
+/* 0x39d0 */  18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,
+/* 0x39e0 */  12,  0,  0,  0,215,  7,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39f0 */   0,  0,  0,  0, 36,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,
+/* 0x3a00 */  17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x3a10 */  14,  0,  0,  0,215,  7,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a20 */   0,  0,  0,  0, 40,  0,  0,  0,  8,  0,  0,  0,204,  7,  0,  0,
+/* 0x3a30 */  15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
+/* 0x3a40 */  10,  0,  0,  0,215,  7,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a50 */   0,  0,  0,  0, 41,  0,  0,  0, 21,  0,  0,  0,204,  7,  0,  0,
+/* 0x3a60 */  15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,
+/* 0x3a70 */  18,  0,  0,  0,204,  7,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a80 */   0,  0,  0,  0, 44,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3a90 */  23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x3aa0 */   1,  0,  0,  0,215,  7,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ab0 */   0,  0,  0,  0, 48,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3ac0 */  21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+/* 0x3ad0 */   3,  0,  0,  0,215,  7,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ae0 */   0,  0,  0,  0, 51,  0,  0,  0, 12,  0,  0,  0,215,  7,  0,  0,
+/* 0x3af0 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x3b00 */   5,  0,  0,  0,215,  7,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b10 */   0,  0,  0,  0, 52,  0,  0,  0, 14,  0,  0,  0,215,  7,  0,  0,
+/* 0x3b20 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,
+/* 0x3b30 */  15,  0,  0,  0,215,  7,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b40 */   0,  0,  0,  0, 53,  0,  0,  0, 30,  0,  0,  0,215,  7,  0,  0,
+/* 0x3b50 */  26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,
+/* 0x3b60 */  48,  0,  0,  0,215,  7,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b70 */   0,  0,  0,  0, 54,  0,  0,  0, 12,  0,  0,  0,215,  7,  0,  0,
+/* 0x3b80 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0,
+/* 0x3b90 */   3,  0,  0,  0,215,  7,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ba0 */   0,  0,  0,  0, 55,  0,  0,  0, 14,  0,  0,  0,215,  7,  0,  0,
+/* 0x3bb0 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  0,  0,  0,
+/* 0x3bc0 */   8,  0,  0,  0,204,  7,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3bd0 */   0,  0,  0,  0, 60,  0,  0,  0, 10,  0,  0,  0,215,  7,  0,  0,
+/* 0x3be0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x3bf0 */  21,  0,  0,  0,204,  7,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c00 */   0,  0,  0,  0, 61,  0,  0,  0, 18,  0,  0,  0,204,  7,  0,  0,
+/* 0x3c10 */  23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,
+/* 0x3c20 */   2,  0,  0,  0,204,  7,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c30 */   0,  0,  0,  0, 67,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,
+/* 0x3c40 */  29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,
+/* 0x3c50 */   1,  0,  0,  0,215,  7,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c60 */   0,  0,  0,  0, 73,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3c70 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,
+/* 0x3c80 */   6,  0,  0,  0,215,  7,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c90 */   0,  0,  0,  0, 76,  0,  0,  0, 16,  0,  0,  0,215,  7,  0,  0,
+/* 0x3ca0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,
+/* 0x3cb0 */  22,  0,  0,  0,204,  7,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3cc0 */   0,  0,  0,  0, 78,  0,  0,  0,  6,  0,  0,  0,215,  7,  0,  0,
+/* 0x3cd0 */  37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x3ce0 */  10,  0,  0,  0,215,  7,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3cf0 */   0,  0,  0,  0, 78,  0,  0,  0, 16,  0,  0,  0,215,  7,  0,  0,
+/* 0x3d00 */  37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,
+/* 0x3d10 */   1,  0,  0,  0,215,  7,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d20 */   0,  0,  0,  0, 82,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3d30 */  37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,  0,  0,  0,
+/* 0x3d40 */   1,  0,  0,  0,215,  7,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d50 */   0,  0,  0,  0, 84,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3d60 */  37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,  0,  0,  0,
+/* 0x3d70 */   1,  0,  0,  0,215,  7,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d80 */   0,  0,  0,  0, 86,  0,  0,  0,  3,  0,  0,  0,204,  7,  0,  0,
+/* 0x3d90 */  30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x3da0 */   1,  0,  0,  0,215,  7,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3db0 */   0,  0,  0,  0, 89,  0,  0,  0, 15,  0,  0,  0,215,  7,  0,  0,
+/* 0x3dc0 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,
+/* 0x3dd0 */   3,  0,  0,  0,215,  7,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3de0 */   0,  0,  0,  0, 94,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3df0 */  38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  0,  0,  0,
+/* 0x3e00 */  33,  0,  0,  0,204,  7,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e10 */   0,  0,  0,  0, 97,  0,  0,  0,  5,  0,  0,  0,195,  7,  0,  0,
+/* 0x3e20 */ 210,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,
+/* 0x3e30 */  20,  0,  0,  0,195,  7,  0,  0,211,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e40 */   0,  0,  0,  0, 97,  0,  0,  0, 30,  0,  0,  0,195,  7,  0,  0,
+/* 0x3e50 */ 212,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,
+/* 0x3e60 */  42,  0,  0,  0,195,  7,  0,  0,213,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e70 */   0,  0,  0,  0,102,  0,  0,  0,  1,  0,  0,  0,204,  7,  0,  0,
+/* 0x3e80 */  40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,  0,  0,  0,
+/* 0x3e90 */   1,  0,  0,  0,195,  7,  0,  0,214,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ea0 */   0,  0,  0,  0,105,  0,  0,  0,  2,  0,  0,  0,225,  7,  0,  0,
+/* 0x3eb0 */ 215,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,
+/* 0x3ec0 */   4,  0,  0,  0,215,  7,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ed0 */   0,  0,  0,  0,110,  0,  0,  0, 13,  0,  0,  0,215,  7,  0,  0,
+/* 0x3ee0 */  41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,111,  0,  0,  0,
+/* 0x3ef0 */   1,  0,  0,  0,195,  7,  0,  0,214,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f00 */   0,  0,  0,  0,114,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,
+/* 0x3f10 */  44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,  0,  0,  0,
+/* 0x3f20 */   2,  0,  0,  0,225,  7,  0,  0,215,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f30 */   0,  0,  0,  0,115,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0,
+/* 0x3f40 */  43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,120,  0,  0,  0,
+/* 0x3f50 */   4,  0,  0,  0,215,  7,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f60 */   0,  0,  0,  0,121,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x3f70 */  45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,  0,
+/* 0x3f80 */   1,  0,  0,  0,195,  7,  0,  0,216,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f90 */   0,  0,  0,  0,128,  0,  0,  0,  1,  0,  0,  0,204,  7,  0,  0,
+/* 0x3fa0 */  51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,132,  0,  0,  0,
+/* 0x3fb0 */   1,  0,  0,  0,215,  7,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3fc0 */   0,  0,  0,  0,133,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0,
+/* 0x3fd0 */  55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,138,  0,  0,  0,
+/* 0x3fe0 */   2,  0,  0,  0,215,  7,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ff0 */   0,  0,  0,  0,140,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x4000 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,141,  0,  0,  0,
+/* 0x4010 */   4,  0,  0,  0,215,  7,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4020 */   0,  0,  0,  0,146,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0,
+/* 0x4030 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,155,  0,  0,  0,
+/* 0x4040 */   6,  0,  0,  0,215,  7,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4050 */   0,  0,  0,  0,164,  0,  0,  0,  6,  0,  0,  0,215,  7,  0,  0,
+/* 0x4060 */  55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,166,  0,  0,  0,
+/* 0x4070 */   1,  0,  0,  0,204,  7,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4080 */   0,  0,  0,  0,178,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x4090 */  52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,
+/* 0x40a0 */   7,  0,  0,  0,215,  7,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x40b0 */   0,  0,  0,  0,184,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x40c0 */  47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,186,  0,  0,  0,
+/* 0x40d0 */   1,  0,  0,  0,215,  7,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,
+/* 0x40e0 */   0,  0,  0,  0,187,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x40f0 */  55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,188,  0,  0,  0,
+/* 0x4100 */   1,  0,  0,  0,215,  7,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4110 */   0,  0,  0,  0,189,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,
+/* 0x4120 */  54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,190,  0,  0,  0,
+/* 0x4130 */   2,  0,  0,  0,215,  7,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4140 */   0,  0,  0,  0,191,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0,
+/* 0x4150 */  53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,202,  0,  0,  0,
+/* 0x4160 */   3,  0,  0,  0,215,  7,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4170 */   0,  0,  0,  0,203,  0,  0,  0, 13,  0,  0,  0,215,  7,  0,  0,
+/* 0x4180 */  60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,204,  0,  0,  0,
+/* 0x4190 */   5,  0,  0,  0,215,  7,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,
+/* 0x41a0 */   0,  0,  0,  0,204,  0,  0,  0, 10,  0,  0,  0,215,  7,  0,  0,
+/* 0x41b0 */  61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,204,  0,  0,  0,
+/* 0x41c0 */  16,  0,  0,  0,215,  7,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,
+/* 0x41d0 */   0,  0,  0,  0,205,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0,
+/* 0x41e0 */  61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,205,  0,  0,  0,
+/* 0x41f0 */   9,  0,  0,  0,215,  7,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4200 */   0,  0,  0,  0,206,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0,
+/* 0x4210 */  58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76, 88, 80, 84,
+/* 0x4220 */  73, 48, 48, 48,  0, 76, 88, 80, 84, 73, 48, 52, 48,  0, 76, 88,
+/* 0x4230 */  80, 84, 73, 48, 52, 49,  0, 76, 88, 80, 84, 73, 48, 52, 50,  0,
+/* 0x4240 */  76, 88, 80, 84, 73, 48, 52, 51,  0, 76, 88, 80, 84, 73, 48, 53,
+/* 0x4250 */  48,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0, 78, 50, 66, 70, 65,
+/* 0x4260 */  83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 49,  0, 78, 50, 66,
+/* 0x4270 */  68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77, 65, 50, 48,  0, 78,
+/* 0x4280 */  50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66, 68, 69, 67, 50, 48,
+/* 0x4290 */   0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x42a0 */  51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,  0, 78, 50, 66, 83,
+/* 0x42b0 */  77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x42c0 */  66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70, 65, 83, 53, 48,  0,
+/* 0x42d0 */  78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50, 66, 83, 77, 65, 54,
+/* 0x42e0 */  48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0, 78, 50, 66, 70, 65,
+/* 0x42f0 */  83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54, 48,  0, 78, 50, 68,
+/* 0x4300 */  83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 48,  0, 78,
+/* 0x4310 */  50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68, 68, 69, 67, 49, 48,
+/* 0x4320 */   0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x4330 */  50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,  0, 78, 50, 68, 83,
+/* 0x4340 */  77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83, 51, 48,  0, 78, 50,
+/* 0x4350 */  68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83, 77, 65, 52, 48,  0,
+/* 0x4360 */  78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50, 68, 83, 77, 65, 53,
+/* 0x4370 */  48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0, 78, 50, 68, 68, 69,
+/* 0x4380 */  67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54, 48,  0, 78, 50, 68,
+/* 0x4390 */  70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 49,  0, 78,
+/* 0x43a0 */  50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69, 83, 77, 65, 49, 48,
+/* 0x43b0 */   0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x43c0 */  49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,  0, 78, 50, 69, 83,
+/* 0x43d0 */  77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83, 50, 48,  0, 78, 50,
+/* 0x43e0 */  69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83, 77, 65, 51, 48,  0,
+/* 0x43f0 */  78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50, 69, 68, 69, 67, 51,
+/* 0x4400 */  48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0, 78, 50, 69, 70, 65,
+/* 0x4410 */  83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53, 48,  0, 78, 50, 69,
+/* 0x4420 */  70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69, 67, 53, 48,  0, 78,
+/* 0x4430 */  50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 48,
+/* 0x4440 */   0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78, 50, 69, 68, 69, 67,
+/* 0x4450 */  54, 48,  0, 67, 76, 49, 83, 77, 65, 49, 66,  0, 67, 76, 49, 70,
+/* 0x4460 */  65, 83, 49, 66,  0, 67, 76, 49, 71, 69, 84, 49, 66,  0, 67, 76,
+/* 0x4470 */  49, 69, 78, 84, 69, 82,  0, 67, 76, 49, 83, 77, 65, 49, 48,  0,
+/* 0x4480 */  67, 76, 49, 82, 76, 79, 65, 68,  0, 67, 76, 49, 87, 73, 68, 48,
+/* 0x4490 */  49,  0, 67, 76, 49, 87, 73, 68, 48, 50,  0, 67, 76, 49, 87, 73,
+/* 0x44a0 */  68, 48, 51,  0, 67, 76, 49, 87, 73, 68, 48, 52,  0, 67, 76, 49,
+/* 0x44b0 */  87, 73, 68, 48, 53,  0, 67, 76, 49, 87, 73, 68, 48, 54,  0, 67,
+/* 0x44c0 */  76, 49, 87, 73, 68, 48, 55,  0, 67, 76, 49, 87, 73, 68, 48, 56,
+/* 0x44d0 */   0, 67, 76, 49, 87, 73, 68, 48, 57,  0, 67, 76, 49, 87, 73, 68,
+/* 0x44e0 */  49, 48,  0, 67, 76, 49, 83, 84, 65, 82, 84,  0, 67, 76, 49, 84,
+/* 0x44f0 */  79, 80, 48, 48,  0, 67, 76, 49, 84, 79, 80, 48, 49,  0, 67, 76,
+/* 0x4500 */  49, 84, 79, 80, 48, 50,  0, 67, 76, 49, 84, 79, 80, 48, 51,  0,
+/* 0x4510 */  67, 76, 49, 84, 79, 80, 48, 52,  0, 67, 76, 49, 84, 79, 80, 48,
+/* 0x4520 */  53,  0, 67, 76, 49, 84, 79, 80, 48, 54,  0, 67, 76, 49, 84, 79,
+/* 0x4530 */  80, 48, 55,  0, 67, 76, 49, 79, 70, 70, 48, 49,  0, 67, 76, 49,
+/* 0x4540 */  79, 70, 70, 48, 50,  0, 67, 76, 49, 79, 70, 70, 48, 51,  0, 67,
+/* 0x4550 */  76, 49, 79, 70, 70, 48, 52,  0, 67, 76, 49, 76, 69, 78, 48, 48,
+/* 0x4560 */   0, 67, 76, 49, 76, 69, 78, 48, 49,  0, 67, 76, 49, 76, 69, 78,
+/* 0x4570 */  48, 50,  0, 67, 76, 49, 67, 79, 80, 89, 48,  0, 67, 76, 49, 69,
+/* 0x4580 */  78, 68,  0, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  0, 76, 90,
+/* 0x4590 */  77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x45a0 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76,
+/* 0x45b0 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 88, 80, 84, 73, 48,
+/* 0x45c0 */  57, 48,  0, 76, 88, 80, 84, 73, 48, 57, 49,  0, 67, 65, 76, 76,
+/* 0x45d0 */  84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65,
+/* 0x45e0 */  76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0,
+/* 0x45f0 */  67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48,
+/* 0x4600 */  49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84,
+/* 0x4610 */  82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76,
+/* 0x4620 */  76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67,
+/* 0x4630 */  84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,
+/* 0x4640 */   0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82,
+/* 0x4650 */  49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76,
+/* 0x4660 */  84, 82, 49, 51,  0, 76, 88, 85, 78, 70, 48, 48, 48,  0, 76, 88,
+/* 0x4670 */  85, 78, 70, 48, 48, 50,  0, 77, 82, 85, 66, 89, 84, 69, 48,  0,
+/* 0x4680 */  76, 88, 77, 82, 85, 48, 48, 53,  0, 76, 88, 77, 82, 85, 48, 48,
+/* 0x4690 */  54,  0, 76, 88, 77, 82, 85, 48, 48, 55,  0, 76, 88, 85, 78, 70,
+/* 0x46a0 */  48, 48, 56,  0, 76, 88, 85, 78, 70, 48, 49, 48,  0, 76, 88, 74,
+/* 0x46b0 */  67, 67, 48, 49, 48,  0, 76, 88, 77, 82, 85, 48, 52, 53,  0, 76,
+/* 0x46c0 */  88, 77, 82, 85, 48, 52, 54,  0, 76, 88, 74, 67, 67, 48, 50, 48,
+/* 0x46d0 */   0, 76, 88, 74, 67, 67, 48, 50, 49,  0, 76, 88, 74, 67, 67, 48,
+/* 0x46e0 */  50, 51,  0, 76, 88, 85, 78, 70, 48, 51, 55,  0, 76, 88, 85, 78,
+/* 0x46f0 */  70, 51, 56, 54,  0, 76, 88, 85, 78, 70, 51, 56, 55,  0, 76, 88,
+/* 0x4700 */  85, 78, 70, 51, 56, 56,  0, 76, 88, 85, 78, 70, 52, 56, 54,  0,
+/* 0x4710 */  76, 88, 85, 78, 70, 52, 56, 55,  0, 76, 88, 77, 82, 85, 48, 54,
+/* 0x4720 */  53,  0, 77, 82, 85, 66, 89, 84, 69, 51,  0, 77, 82, 85, 65, 82,
+/* 0x4730 */  66, 51, 48,  0, 77, 82, 85, 66, 73, 84, 83, 51,  0, 77, 82, 85,
+/* 0x4740 */  65, 82, 66, 52, 48,  0, 76, 88, 77, 82, 85, 48, 55, 48,  0, 77,
+/* 0x4750 */  82, 85, 66, 89, 84, 69, 52,  0, 77, 82, 85, 66, 73, 84, 83, 52,
+/* 0x4760 */   0, 77, 82, 85, 65, 82, 66, 53, 48,  0, 76, 88, 77, 82, 85, 48,
+/* 0x4770 */  56, 48,  0, 77, 82, 85, 66, 89, 84, 69, 53,  0, 77, 82, 85, 65,
+/* 0x4780 */  82, 66, 54, 48,  0, 77, 82, 85, 66, 73, 84, 83, 53,  0, 77, 82,
+/* 0x4790 */  85, 65, 82, 66, 55, 48,  0, 76, 88, 77, 82, 85, 48, 57, 48,  0,
+/* 0x47a0 */  77, 82, 85, 66, 89, 84, 69, 54,  0, 77, 82, 85, 65, 82, 66, 56,
+/* 0x47b0 */  48,  0, 77, 82, 85, 66, 73, 84, 83, 54,  0, 77, 82, 85, 65, 82,
+/* 0x47c0 */  66, 57, 48,  0, 76, 88, 77, 82, 85, 49, 48, 48,  0, 76, 88, 85,
+/* 0x47d0 */  78, 70, 48, 52, 48,  0, 76, 88, 77, 82, 85, 49, 49, 48,  0, 76,
+/* 0x47e0 */  88, 77, 82, 85, 49, 49, 49,  0, 76, 88, 85, 78, 70, 48, 52, 49,
+/* 0x47f0 */   0, 76, 88, 85, 78, 70, 48, 52, 50,  0, 76, 69, 88, 69, 67, 48,
+/* 0x4800 */  49, 54,  0, 76, 88, 77, 82, 85, 48, 49, 48,  0, 76, 88, 74, 77,
+/* 0x4810 */  80, 65, 48, 48,  0, 76, 88, 67, 65, 76, 76, 66, 48,  0, 76, 88,
+/* 0x4820 */  85, 78, 70, 48, 50, 49,  0, 76, 88, 77, 82, 85, 48, 50, 50,  0,
+/* 0x4830 */  76, 88, 74, 77, 80, 65, 48, 49,  0, 76, 88, 67, 65, 76, 76, 66,
+/* 0x4840 */  49,  0, 77, 82, 85, 66, 73, 84, 83, 49,  0, 76, 88, 77, 82, 85,
+/* 0x4850 */  48, 51, 48,  0, 77, 82, 85, 66, 89, 84, 69, 49,  0, 77, 82, 85,
+/* 0x4860 */  65, 82, 66, 49, 48,  0, 76, 88, 77, 82, 85, 48, 52, 48,  0, 76,
+/* 0x4870 */  88, 85, 78, 70, 48, 51, 48,  0, 76, 88, 74, 67, 67, 48, 48, 48,
+/* 0x4880 */   0, 76, 88, 67, 74, 48, 77, 82, 85,  0, 76, 88, 67, 74, 49, 77,
+/* 0x4890 */  82, 85,  0, 76, 88, 67, 65, 76, 74, 77, 80,  0, 76, 88, 67, 65,
+/* 0x48a0 */  76, 76, 48, 48,  0, 76, 88, 67, 65, 76, 76, 48, 49,  0, 76, 88,
+/* 0x48b0 */  67, 74, 50, 77, 82, 85,  0, 76, 88, 67, 74, 52, 77, 82, 85,  0,
+/* 0x48c0 */  76, 88, 67, 74, 54, 77, 82, 85,  0, 76, 88, 67, 74, 55, 77, 82,
+/* 0x48d0 */  85,  0, 76, 88, 67, 74, 56, 77, 82, 85,  0, 76, 88, 85, 78, 70,
+/* 0x48e0 */  48, 51, 52,  0, 76, 88, 77, 82, 85, 48, 53, 53,  0, 77, 82, 85,
+/* 0x48f0 */  66, 89, 84, 69, 50,  0, 77, 82, 85, 66, 73, 84, 83, 50,  0, 77,
+/* 0x4900 */  82, 85, 65, 82, 66, 50, 48,  0, 76, 88, 77, 82, 85, 48, 53, 55,
+/* 0x4910 */   0, 76, 88, 77, 82, 85, 48, 53, 56,  0, 76, 88, 85, 78, 70, 48,
+/* 0x4920 */  51, 53,  0, 76, 88, 80, 84, 73, 49, 52, 48,  0, 76, 88, 80, 84,
+/* 0x4930 */  73, 49, 52, 49,  0, 76, 88, 80, 84, 73, 49, 53, 48,  0, 99,116,
+/* 0x4940 */ 111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46, 49,
+/* 0x4950 */  48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,107,
+/* 0x4960 */  51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,  0,
+/* 0x4970 */  76, 88, 80, 84, 73, 49, 54, 48,  0, 76, 88, 80, 84, 73, 50, 48,
+/* 0x4980 */  48,  0, 95,115,116, 97,114,116,  0,108,122,109, 97, 95,115,116,
+/* 0x4990 */  97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,109, 97, 95,
+/* 0x49a0 */ 117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,
+/* 0x49b0 */   0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,
+/* 0x49c0 */   0,102,105,108,116,101,114, 95,108,101,110,103,116,104,  0,102,
+/* 0x49d0 */ 105,108,116,101,114, 95, 99,116,111,  0, 78, 77, 82, 85,  0, 82,
+/* 0x49e0 */  95, 51, 56, 54, 95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67,
+/* 0x49f0 */  51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51,
+/* 0x4a00 */  56, 54, 95, 56,  0,252, 27,  0,  0, 85, 80, 88, 76
 };
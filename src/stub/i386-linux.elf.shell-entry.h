@@ -1,5 +1,5 @@
 /* i386-linux.elf.shell-entry.h
-   created from i386-linux.elf.shell-entry.bin, 29929 (0x74e9) bytes
+   created from i386-linux.elf.shell-entry.bin, 13910 (0x3656) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_ELF_SHELL_ENTRY_SIZE    29929
-#define STUB_I386_LINUX_ELF_SHELL_ENTRY_ADLER32 0x392e0c59
-#define STUB_I386_LINUX_ELF_SHELL_ENTRY_CRC32   0x3bf1f884
+#define STUB_I386_LINUX_ELF_SHELL_ENTRY_SIZE    13910
+#define STUB_I386_LINUX_ELF_SHELL_ENTRY_ADLER32 0x5ab34a44
+#define STUB_I386_LINUX_ELF_SHELL_ENTRY_CRC32   0xb446603e
 
-unsigned char stub_i386_linux_elf_shell_entry[29929] = {
+unsigned char stub_i386_linux_elf_shell_entry[13910] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 168, 31,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -458,1453 +458,452 @@ unsigned char stub_i386_linux_elf_shell_entry[29929] = {
 /* 0x1a30 */  48,137, 58,137, 68, 36, 28, 97,195, 93,184,  0,  0, 64,  1,141,
 /* 0x1a40 */ 144,140,  0,  0,  0,  3, 64, 72,  5,255, 15,  0,  0, 37,  0,240,
 /* 0x1a50 */ 255,255,106,  0,106,255,106, 50,106,  3,255, 50, 80,137,227,106,
-/* 0x1a60 */  90, 88,205,128,131,196, 24,141, 88,  3,102,105,108,101, 32,102,
-/* 0x1a70 */ 111,114,109, 97,116, 32,101,108,102, 51, 50, 45,105, 51, 56, 54,
-/* 0x1a80 */  10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32,
-/* 0x1a90 */  78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,
-/* 0x1aa0 */ 122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1ab0 */  32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101,
-/* 0x1ac0 */  32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,
-/* 0x1ad0 */ 115, 10, 32, 32, 48, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 32,
-/* 0x1ae0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b00 */  32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1b10 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1b20 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32,
-/* 0x1b30 */  76, 69, 88, 69, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1b60 */  48, 48, 51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1b70 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1b80 */  32, 50, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32,
-/* 0x1b90 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 52, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1bc0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1bd0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 50, 66,
-/* 0x1be0 */  70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1c00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52,
-/* 0x1c10 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c20 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1c30 */  76, 89, 10, 32, 32, 52, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32,
-/* 0x1c40 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x1c50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 98, 32, 32, 50, 42, 42,
-/* 0x1c70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1c80 */  68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 50, 66, 68, 69, 67,
-/* 0x1c90 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98,
-/* 0x1ca0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 49, 32, 32,
-/* 0x1cc0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1cd0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 78, 50, 66,
-/* 0x1ce0 */  83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53,
-/* 0x1d10 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1d20 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1d30 */  76, 89, 10, 32, 32, 55, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32,
-/* 0x1d40 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d60 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 54, 49, 32, 32, 50, 42, 42,
-/* 0x1d70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1d80 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56,
-/* 0x1d90 */  32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1dd0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1de0 */  32, 32, 57, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32,
-/* 0x1df0 */  32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 55, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e20 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1e30 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 78, 50,
-/* 0x1e40 */  66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */  56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1e80 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1e90 */  78, 76, 89, 10, 32, 49, 49, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51,101, 32, 32,
-/* 0x1eb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 51, 32, 32, 50, 42,
-/* 0x1ed0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1ee0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1ef0 */  50, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48,100, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1f30 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1f40 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 78, 50, 66, 70,
-/* 0x1f50 */  65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100,101,
-/* 0x1f80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1f90 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1fa0 */  89, 10, 32, 49, 52, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  32, 32, 48, 48, 48, 48, 48, 48,101,100, 32, 32, 50, 42, 42, 48,
-/* 0x1fe0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1ff0 */  79, 78, 76, 89, 10, 32, 49, 53, 32, 78, 50, 66, 70, 65, 83, 53,
-/* 0x2000 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x2010 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101,102, 32, 32, 50,
-/* 0x2030 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2040 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 54, 32, 78, 50, 66, 68,
-/* 0x2050 */  69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2060 */  48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,102, 50,
-/* 0x2080 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2090 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 55, 32, 78,
-/* 0x20a0 */  50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x20c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x20d0 */  48,102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x20e0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x20f0 */  79, 78, 76, 89, 10, 32, 49, 56, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x2100 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32,
-/* 0x2110 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2120 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 48, 55, 32, 32, 50,
-/* 0x2130 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2140 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2150 */  49, 57, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32,
-/* 0x2160 */  32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2170 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2180 */  48, 48, 48, 48, 49, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2190 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x21a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 48, 32, 78, 50, 66,
-/* 0x21b0 */  68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x21c0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51,
-/* 0x21e0 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x21f0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 49, 32,
-/* 0x2200 */  78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2210 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2220 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2230 */  48, 49, 51, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2240 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2250 */  68, 79, 78, 76, 89, 10, 32, 50, 50, 32, 78, 50, 68, 70, 65, 83,
-/* 0x2260 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2270 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 57, 32, 32,
-/* 0x2290 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x22a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x22b0 */  32, 50, 51, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32,
-/* 0x22c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x22d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x22e0 */  48, 48, 48, 48, 48, 49, 51, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x22f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2300 */  76, 89, 10, 32, 50, 52, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32,
-/* 0x2310 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48,
-/* 0x2320 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2330 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 49, 32, 32, 50, 42, 42,
-/* 0x2340 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2350 */  68, 79, 78, 76, 89, 10, 32, 50, 53, 32, 78, 50, 68, 83, 77, 65,
-/* 0x2360 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x2370 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2380 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 99, 32, 32,
-/* 0x2390 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x23a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x23b0 */  32, 50, 54, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32,
-/* 0x23c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x23e0 */  48, 48, 48, 48, 48, 49, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x23f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2400 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55, 32, 78, 50,
-/* 0x2410 */  68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2420 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2440 */  53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2450 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 56,
-/* 0x2460 */  32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2470 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2480 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2490 */  48, 48, 49, 54, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x24a0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x24b0 */  65, 68, 79, 78, 76, 89, 10, 32, 50, 57, 32, 78, 50, 68, 70, 65,
-/* 0x24c0 */  83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */ 102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x24e0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 52, 32,
-/* 0x24f0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2500 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2510 */  10, 32, 51, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x2520 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 50, 32, 32, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2540 */  32, 48, 48, 48, 48, 48, 49, 56, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2550 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2560 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 49, 32, 78,
-/* 0x2570 */  50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2580 */  48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2590 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x25a0 */  49,100, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x25b0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x25c0 */  79, 78, 76, 89, 10, 32, 51, 50, 32, 78, 50, 68, 70, 65, 83, 52,
-/* 0x25d0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x25e0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x25f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,101, 50, 32, 32, 50,
-/* 0x2600 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2610 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2620 */  51, 51, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2630 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2640 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2650 */  48, 48, 48, 48, 49,102, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2660 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2670 */  89, 10, 32, 51, 52, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32,
-/* 0x2680 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x2690 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26a0 */  32, 32, 48, 48, 48, 48, 48, 49,102, 51, 32, 32, 50, 42, 42, 48,
-/* 0x26b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x26c0 */  79, 78, 76, 89, 10, 32, 51, 53, 32, 78, 50, 68, 68, 69, 67, 53,
-/* 0x26d0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x26e0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x26f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102, 54, 32, 32, 50,
-/* 0x2700 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2710 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 54, 32, 78, 50, 68, 83,
-/* 0x2720 */  77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2730 */  48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2740 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102,102,
-/* 0x2750 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2760 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2770 */  89, 10, 32, 51, 55, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32,
-/* 0x2780 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48,
-/* 0x2790 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27a0 */  32, 32, 48, 48, 48, 48, 48, 50, 48, 98, 32, 32, 50, 42, 42, 48,
-/* 0x27b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x27c0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 56, 32,
-/* 0x27d0 */  78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x27e0 */  48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2800 */  48, 50, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2810 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2820 */  68, 79, 78, 76, 89, 10, 32, 51, 57, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2830 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2840 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2850 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 51, 97, 32, 32,
-/* 0x2860 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2870 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 48, 32, 78, 50, 69,
-/* 0x2880 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2890 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x28a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 51,
-/* 0x28b0 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x28c0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x28d0 */  76, 89, 10, 32, 52, 49, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32,
-/* 0x28e0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x28f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2900 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 51,100, 32, 32, 50, 42, 42,
-/* 0x2910 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2920 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 50,
-/* 0x2930 */  32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2940 */  48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2950 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2960 */  48, 48, 50, 51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2970 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2980 */  32, 52, 51, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x2990 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48,
-/* 0x29a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x29b0 */  48, 48, 48, 48, 48, 50, 52, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x29c0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x29d0 */  76, 89, 10, 32, 52, 52, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32,
-/* 0x29e0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x29f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a00 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 48, 32, 32, 50, 42, 42,
-/* 0x2a10 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2a20 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 53,
-/* 0x2a30 */  32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2a40 */  48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a50 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2a60 */  48, 48, 50, 53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2a70 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2a80 */  65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 78, 50, 69, 68, 69,
-/* 0x2a90 */  67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2aa0 */ 100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2ab0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53,101, 32,
-/* 0x2ac0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2ad0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 55, 32, 78, 50,
-/* 0x2ae0 */  69, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2af0 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2b00 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2b10 */  54, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b20 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2b30 */  78, 76, 89, 10, 32, 52, 56, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x2b40 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32,
-/* 0x2b50 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2b60 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 55, 56, 32, 32, 50, 42,
-/* 0x2b70 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2b80 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52,
-/* 0x2b90 */  57, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2ba0 */  48, 48, 48, 48, 48, 48, 53,102, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2bb0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2bc0 */  48, 48, 48, 50, 56, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2bd0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2be0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 48, 32, 78, 50, 69, 83,
-/* 0x2bf0 */  77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2c00 */  48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2c10 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,101, 54,
-/* 0x2c20 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2c30 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2c40 */  89, 10, 32, 53, 49, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32,
-/* 0x2c50 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48,
-/* 0x2c60 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c70 */  32, 32, 48, 48, 48, 48, 48, 50,102, 51, 32, 32, 50, 42, 42, 48,
-/* 0x2c80 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2c90 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 50, 32,
-/* 0x2ca0 */  78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2cb0 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cc0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2cd0 */  48, 51, 48, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2ce0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2cf0 */  53, 51, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2d00 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d10 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2d20 */  48, 48, 48, 48, 51, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2d30 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2d40 */  89, 10, 32, 53, 52, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32,
-/* 0x2d50 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48,
-/* 0x2d60 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d70 */  32, 32, 48, 48, 48, 48, 48, 51, 48, 55, 32, 32, 50, 42, 42, 48,
-/* 0x2d80 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2d90 */  79, 78, 76, 89, 10, 32, 53, 53, 32, 78, 50, 69, 83, 77, 65, 54,
-/* 0x2da0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32,
-/* 0x2db0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2dc0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 48, 32, 32, 50,
-/* 0x2dd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2de0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2df0 */  53, 54, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32,
-/* 0x2e00 */  32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e10 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2e20 */  48, 48, 48, 48, 51, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2e30 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2e40 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 55, 32, 78, 50, 69,
-/* 0x2e50 */  70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e60 */  48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2e70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 51,
-/* 0x2e80 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2e90 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2ea0 */  76, 89, 10, 32, 53, 56, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32,
-/* 0x2eb0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2ec0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ed0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 52, 98, 32, 32, 50, 42, 42,
-/* 0x2ee0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2ef0 */  68, 79, 78, 76, 89, 10, 32, 53, 57, 32, 67, 76, 49, 83, 77, 65,
-/* 0x2f00 */  49, 66, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2f10 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2f20 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52, 98, 32, 32,
-/* 0x2f30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2f40 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 48, 32, 67, 76, 49,
-/* 0x2f50 */  70, 65, 83, 49, 66, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f60 */  48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52,
-/* 0x2f80 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2f90 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 49, 32,
-/* 0x2fa0 */  67, 76, 49, 71, 69, 84, 49, 66, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2fb0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fc0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2fd0 */  48, 51, 53, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2fe0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2ff0 */  54, 50, 32, 67, 76, 49, 69, 78, 84, 69, 82, 32, 32, 32, 32, 32,
-/* 0x3000 */  32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3010 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3020 */  48, 48, 48, 48, 51, 53, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3030 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3040 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 51, 32, 67, 76, 49,
-/* 0x3050 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3060 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3070 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 53,
-/* 0x3080 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3090 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x30a0 */  76, 89, 10, 32, 54, 52, 32, 67, 76, 49, 82, 76, 79, 65, 68, 32,
-/* 0x30b0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48,
-/* 0x30c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30d0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 53,101, 32, 32, 50, 42, 42,
-/* 0x30e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x30f0 */  68, 79, 78, 76, 89, 10, 32, 54, 53, 32, 67, 76, 49, 87, 73, 68,
-/* 0x3100 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3110 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3120 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 54, 54, 32, 32,
-/* 0x3130 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3140 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 54, 32, 67, 76, 49,
-/* 0x3150 */  87, 73, 68, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3160 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3170 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 54,
-/* 0x3180 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3190 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 55, 32,
-/* 0x31a0 */  67, 76, 49, 87, 73, 68, 48, 51, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x31b0 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x31d0 */  48, 51, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x31e0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x31f0 */  68, 79, 78, 76, 89, 10, 32, 54, 56, 32, 67, 76, 49, 87, 73, 68,
-/* 0x3200 */  48, 52, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3210 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3220 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 54, 99, 32, 32,
-/* 0x3230 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3240 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 57, 32, 67, 76, 49,
-/* 0x3250 */  87, 73, 68, 48, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3260 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3270 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 54,
-/* 0x3280 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3290 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x32a0 */  76, 89, 10, 32, 55, 48, 32, 67, 76, 49, 87, 73, 68, 48, 54, 32,
-/* 0x32b0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x32c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32d0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 55, 48, 32, 32, 50, 42, 42,
-/* 0x32e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x32f0 */  68, 79, 78, 76, 89, 10, 32, 55, 49, 32, 67, 76, 49, 87, 73, 68,
-/* 0x3300 */  48, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x3310 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3320 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 55, 50, 32, 32,
-/* 0x3330 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3340 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 50, 32, 67, 76, 49,
-/* 0x3350 */  87, 73, 68, 48, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3360 */  48, 49, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3370 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 55,
-/* 0x3380 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3390 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x33a0 */  76, 89, 10, 32, 55, 51, 32, 67, 76, 49, 87, 73, 68, 48, 57, 32,
-/* 0x33b0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x33c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33d0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 56,102, 32, 32, 50, 42, 42,
-/* 0x33e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x33f0 */  68, 79, 78, 76, 89, 10, 32, 55, 52, 32, 67, 76, 49, 87, 73, 68,
-/* 0x3400 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 49,
-/* 0x3410 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3420 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 57, 49, 32, 32,
-/* 0x3430 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3440 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3450 */  32, 55, 53, 32, 67, 76, 49, 83, 84, 65, 82, 84, 32, 32, 32, 32,
-/* 0x3460 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x3470 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3480 */  48, 48, 48, 48, 48, 51, 97, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3490 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x34a0 */  76, 89, 10, 32, 55, 54, 32, 67, 76, 49, 84, 79, 80, 48, 48, 32,
-/* 0x34b0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x34c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34d0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 97, 55, 32, 32, 50, 42, 42,
-/* 0x34e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x34f0 */  68, 79, 78, 76, 89, 10, 32, 55, 55, 32, 67, 76, 49, 84, 79, 80,
-/* 0x3500 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3510 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3520 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 97, 97, 32, 32,
-/* 0x3530 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3540 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3550 */  32, 55, 56, 32, 67, 76, 49, 84, 79, 80, 48, 50, 32, 32, 32, 32,
-/* 0x3560 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x3570 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3580 */  48, 48, 48, 48, 48, 51, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3590 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x35a0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 57, 32, 67, 76,
-/* 0x35b0 */  49, 84, 79, 80, 48, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x35c0 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x35d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x35e0 */  97,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x35f0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3600 */  78, 76, 89, 10, 32, 56, 48, 32, 67, 76, 49, 84, 79, 80, 48, 52,
-/* 0x3610 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x3620 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3630 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 98, 48, 32, 32, 50, 42,
-/* 0x3640 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3650 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56,
-/* 0x3660 */  49, 32, 67, 76, 49, 84, 79, 80, 48, 53, 32, 32, 32, 32, 32, 32,
-/* 0x3670 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3680 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3690 */  48, 48, 48, 51, 98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x36a0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x36b0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 50, 32, 67, 76, 49, 84,
-/* 0x36c0 */  79, 80, 48, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x36d0 */  48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x36e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 98, 56,
-/* 0x36f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3700 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3710 */  89, 10, 32, 56, 51, 32, 67, 76, 49, 84, 79, 80, 48, 55, 32, 32,
-/* 0x3720 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 55, 32, 32, 48, 48,
-/* 0x3730 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3740 */  32, 32, 48, 48, 48, 48, 48, 51, 98,102, 32, 32, 50, 42, 42, 48,
-/* 0x3750 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x3760 */  79, 78, 76, 89, 10, 32, 56, 52, 32, 67, 76, 49, 79, 70, 70, 48,
-/* 0x3770 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x3780 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3790 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,100, 54, 32, 32, 50,
-/* 0x37a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x37b0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 53, 32, 67, 76, 49, 79,
-/* 0x37c0 */  70, 70, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x37d0 */  49, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x37e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,100, 56,
-/* 0x37f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3800 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3810 */  89, 10, 32, 56, 54, 32, 67, 76, 49, 79, 70, 70, 48, 51, 32, 32,
-/* 0x3820 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x3830 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3840 */  32, 32, 48, 48, 48, 48, 48, 51,101, 97, 32, 32, 50, 42, 42, 48,
-/* 0x3850 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x3860 */  79, 78, 76, 89, 10, 32, 56, 55, 32, 67, 76, 49, 79, 70, 70, 48,
-/* 0x3870 */  52, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x3880 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3890 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,101, 99, 32, 32, 50,
-/* 0x38a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x38b0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x38c0 */  56, 56, 32, 67, 76, 49, 76, 69, 78, 48, 48, 32, 32, 32, 32, 32,
-/* 0x38d0 */  32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48,
-/* 0x38e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x38f0 */  48, 48, 48, 48, 51,102, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3900 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3910 */  89, 10, 32, 56, 57, 32, 67, 76, 49, 76, 69, 78, 48, 49, 32, 32,
-/* 0x3920 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x3930 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3940 */  32, 32, 48, 48, 48, 48, 48, 51,102, 49, 32, 32, 50, 42, 42, 48,
-/* 0x3950 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x3960 */  79, 78, 76, 89, 10, 32, 57, 48, 32, 67, 76, 49, 76, 69, 78, 48,
-/* 0x3970 */  50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x3980 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3990 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,102, 51, 32, 32, 50,
-/* 0x39a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x39b0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x39c0 */  57, 49, 32, 67, 76, 49, 67, 79, 80, 89, 48, 32, 32, 32, 32, 32,
-/* 0x39d0 */  32, 48, 48, 48, 48, 48, 48, 51, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x39e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x39f0 */  48, 48, 48, 48, 51,102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3a00 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3a10 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 50, 32, 67, 76, 49,
-/* 0x3a20 */  69, 78, 68, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3a30 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3a40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 50,
-/* 0x3a50 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3a60 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 51, 32,
-/* 0x3a70 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 48,
-/* 0x3a80 */  48, 48, 48, 48, 50,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3aa0 */  48, 52, 50, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3ab0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3ac0 */  68, 79, 78, 76, 89, 10, 32, 57, 52, 32, 76, 90, 77, 65, 95, 69,
-/* 0x3ad0 */  76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56,
-/* 0x3ae0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3af0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 53, 57, 32, 32,
-/* 0x3b00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3b10 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 53, 32, 76, 90, 77,
-/* 0x3b20 */  65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3b30 */  97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3b40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 97,
-/* 0x3b50 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3b60 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 54, 32,
-/* 0x3b70 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48,
-/* 0x3b80 */  48, 48, 48, 97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ba0 */  48,102, 50, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3bb0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3bc0 */  57, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x3bd0 */  32, 48, 48, 48, 48, 48, 48, 49, 97, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3be0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3bf0 */  48, 48, 48, 49, 57, 97,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3c00 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3c10 */  89, 10, 32, 57, 56, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 32,
-/* 0x3c20 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48,
-/* 0x3c30 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c40 */  32, 32, 48, 48, 48, 48, 49, 57, 99, 55, 32, 32, 50, 42, 42, 48,
-/* 0x3c50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3c60 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 57, 32,
-/* 0x3c70 */  67, 84, 67, 76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3c80 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ca0 */  49, 57,100, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3cb0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3cc0 */  68, 79, 78, 76, 89, 10, 49, 48, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3cd0 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3ce0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3cf0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 97, 32, 32,
-/* 0x3d00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3d10 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 49, 32, 67, 84, 66,
-/* 0x3d20 */  83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3d30 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3d40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100,
-/* 0x3d50 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3d60 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 50, 32,
-/* 0x3d70 */  67, 84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3d80 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3da0 */  49, 57,101, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3db0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x3dc0 */  48, 51, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32, 32, 32,
-/* 0x3dd0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3de0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3df0 */  48, 48, 48, 49, 57,101, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3e00 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3e10 */  89, 10, 49, 48, 52, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 32,
-/* 0x3e20 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48,
-/* 0x3e30 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e40 */  32, 32, 48, 48, 48, 48, 49, 57,101, 97, 32, 32, 50, 42, 42, 48,
-/* 0x3e50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3e60 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 53, 32,
-/* 0x3e70 */  67, 65, 76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3e80 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ea0 */  49, 57,102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3eb0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3ec0 */  68, 79, 78, 76, 89, 10, 49, 48, 54, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3ed0 */  69, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3ee0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ef0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,102,100, 32, 32,
-/* 0x3f00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3f10 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 55, 32, 67, 65, 76,
-/* 0x3f20 */  76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3f30 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3f40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,102,
-/* 0x3f50 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3f60 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 56, 32,
-/* 0x3f70 */  67, 65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3f80 */  48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3fa0 */  49, 97, 48, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3fb0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3fc0 */  68, 79, 78, 76, 89, 10, 49, 48, 57, 32, 67, 84, 67, 76, 69, 86,
-/* 0x3fd0 */  69, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3fe0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ff0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48, 53, 32, 32,
-/* 0x4000 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4010 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4020 */  49, 49, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32,
-/* 0x4030 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x4040 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4050 */  48, 48, 48, 48, 49, 97, 48, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4060 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4070 */  76, 89, 10, 49, 49, 49, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32,
-/* 0x4080 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x4090 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40a0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 48, 99, 32, 32, 50, 42, 42,
-/* 0x40b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x40c0 */  68, 79, 78, 76, 89, 10, 49, 49, 50, 32, 67, 84, 66, 82, 79, 82,
-/* 0x40d0 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x40e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x40f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 48, 32, 32,
-/* 0x4100 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4110 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 51, 32, 67, 84, 66,
-/* 0x4120 */  83, 87, 65, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4130 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4140 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49,
-/* 0x4150 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4160 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 52, 32,
-/* 0x4170 */  67, 65, 76, 76, 84, 82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4180 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4190 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x41a0 */  49, 97, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x41b0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x41c0 */  68, 79, 78, 76, 89, 10, 49, 49, 53, 32, 76, 69, 88, 69, 67, 48,
-/* 0x41d0 */  49, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 98,
-/* 0x41e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x41f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 99, 32, 32,
-/* 0x4200 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4210 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 54, 32, 76, 69, 88,
-/* 0x4220 */  69, 67, 48, 49, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4230 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4240 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 51,
-/* 0x4250 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4260 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 55, 32,
-/* 0x4270 */  76, 69, 88, 69, 67, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4280 */  48, 48, 48, 48, 51, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4290 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x42a0 */  49, 97, 51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x42b0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83,
-/* 0x42c0 */  89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48,
-/* 0x42d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x42e0 */  66, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x42f0 */  78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4300 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x4310 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70,
-/* 0x4320 */  65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4330 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,  9, 48,
-/* 0x4340 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x4350 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4360 */  32, 32, 78, 50, 66, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4370 */  48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x4380 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4390 */  66, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x43a0 */  78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x43c0 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68,
-/* 0x43d0 */  69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x43e0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49,  9, 48,
-/* 0x43f0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49,
-/* 0x4400 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4410 */  32, 32, 78, 50, 66, 68, 69, 67, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4420 */  48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48,
-/* 0x4430 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4440 */  68, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4450 */  78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4460 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4470 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x4480 */  65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4490 */  32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48,  9, 48,
-/* 0x44a0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 49, 48,
-/* 0x44b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x44c0 */  32, 32, 78, 50, 68, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x44d0 */  48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x44e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x44f0 */  68, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4500 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4510 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x4520 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68,
-/* 0x4530 */  69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4540 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49,  9, 48,
-/* 0x4550 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 54, 49,
-/* 0x4560 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4570 */  32, 32, 78, 50, 68, 68, 69, 67, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4580 */  48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48,
-/* 0x4590 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x45a0 */  69, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x45b0 */  78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x45c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x45d0 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70,
-/* 0x45e0 */  65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x45f0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48,  9, 48,
-/* 0x4600 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x4610 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4620 */  32, 32, 78, 50, 69, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4630 */  48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x4640 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4650 */  69, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4660 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4670 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x4680 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68,
-/* 0x4690 */  69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x46a0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49,  9, 48,
-/* 0x46b0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49,
-/* 0x46c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x46d0 */  32, 32, 78, 50, 69, 68, 69, 67, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x46e0 */  48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 48, 48, 48,
-/* 0x46f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x4700 */  49, 82, 76, 79, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4710 */  67, 76, 49, 82, 76, 79, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4720 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68,
-/* 0x4730 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87,
-/* 0x4740 */  73, 68, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4750 */  32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 54,  9, 48,
-/* 0x4760 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87, 73, 68, 48, 54,
-/* 0x4770 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4780 */  32, 32, 67, 76, 49, 87, 73, 68, 48, 56,  9, 48, 48, 48, 48, 48,
-/* 0x4790 */  48, 48, 48, 32, 67, 76, 49, 87, 73, 68, 48, 56, 10, 48, 48, 48,
-/* 0x47a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x47b0 */  49, 87, 73, 68, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x47c0 */  67, 76, 49, 87, 73, 68, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x47d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 83, 84, 65,
-/* 0x47e0 */  82, 84,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 83,
-/* 0x47f0 */  84, 65, 82, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4800 */  32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 48,  9, 48,
-/* 0x4810 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 48,
-/* 0x4820 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4830 */  32, 32, 67, 76, 49, 84, 79, 80, 48, 54,  9, 48, 48, 48, 48, 48,
-/* 0x4840 */  48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 54, 10, 48, 48, 48,
-/* 0x4850 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x4860 */  49, 84, 79, 80, 48, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4870 */  67, 76, 49, 84, 79, 80, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4880 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 76, 69, 78,
-/* 0x4890 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 76,
-/* 0x48a0 */  69, 78, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x48b0 */  32, 32, 32,100, 32, 32, 67, 76, 49, 67, 79, 80, 89, 48,  9, 48,
-/* 0x48c0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 67, 79, 80, 89, 48,
-/* 0x48d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x48e0 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x48f0 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48,
-/* 0x4900 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x4910 */  76, 76, 84, 82, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4920 */  67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4930 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4940 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x4950 */  84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4960 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,  9, 48,
-/* 0x4970 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x4980 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4990 */  32, 32, 76, 69, 88, 69, 67, 48, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x49a0 */  48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10, 48, 48, 48,
-/* 0x49b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69,
-/* 0x49c0 */  88, 69, 67, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x49d0 */  76, 69, 88, 69, 67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x49e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x49f0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69,
-/* 0x4a00 */  67, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4a10 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 48,  9, 48,
-/* 0x4a20 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 49, 48,
-/* 0x4a30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4a40 */  32, 32, 78, 50, 66, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4a50 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10, 48, 48, 48,
-/* 0x4a60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4a70 */  66, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a80 */  78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4aa0 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x4ab0 */  77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4ac0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51, 48,  9, 48,
-/* 0x4ad0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 51, 48,
-/* 0x4ae0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4af0 */  32, 32, 78, 50, 66, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4b00 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10, 48, 48, 48,
-/* 0x4b10 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4b20 */  66, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4b30 */  78, 50, 66, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b40 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4b50 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x4b60 */  77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4b70 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 53, 48,  9, 48,
-/* 0x4b80 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 53, 48,
-/* 0x4b90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4ba0 */  32, 32, 78, 50, 66, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4bb0 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10, 48, 48, 48,
-/* 0x4bc0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4bd0 */  66, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4be0 */  78, 50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4bf0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4c00 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x4c10 */  65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4c20 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 50, 48,  9, 48,
-/* 0x4c30 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 50, 48,
-/* 0x4c40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4c50 */  32, 32, 78, 50, 68, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4c60 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 10, 48, 48, 48,
-/* 0x4c70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4c80 */  68, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4c90 */  78, 50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ca0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4cb0 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x4cc0 */  65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4cd0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 52, 48,  9, 48,
-/* 0x4ce0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 52, 48,
-/* 0x4cf0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4d00 */  32, 32, 78, 50, 68, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4d10 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10, 48, 48, 48,
-/* 0x4d20 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4d30 */  68, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4d40 */  78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d50 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4d60 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x4d70 */  65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4d80 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54, 48,  9, 48,
-/* 0x4d90 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 54, 48,
-/* 0x4da0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4db0 */  32, 32, 78, 50, 68, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4dc0 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10, 48, 48, 48,
-/* 0x4dd0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4de0 */  69, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4df0 */  78, 50, 69, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x4e10 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x4e20 */  77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4e30 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 50, 48,  9, 48,
-/* 0x4e40 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x4e50 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4e60 */  32, 32, 78, 50, 69, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4e70 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10, 48, 48, 48,
-/* 0x4e80 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4e90 */  69, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ea0 */  78, 50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4eb0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x4ec0 */  52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x4ed0 */  77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4ee0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 52, 48,  9, 48,
-/* 0x4ef0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 52, 48,
-/* 0x4f00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4f10 */  32, 32, 78, 50, 69, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4f20 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 53, 48, 10, 48, 48, 48,
-/* 0x4f30 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4f40 */  69, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4f50 */  78, 50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f60 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x4f70 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x4f80 */  77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4f90 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 48,  9, 48,
-/* 0x4fa0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 54, 48,
-/* 0x4fb0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4fc0 */  32, 32, 67, 76, 49, 83, 77, 65, 49, 66,  9, 48, 48, 48, 48, 48,
-/* 0x4fd0 */  48, 48, 48, 32, 67, 76, 49, 83, 77, 65, 49, 66, 10, 48, 48, 48,
-/* 0x4fe0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x4ff0 */  49, 70, 65, 83, 49, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5000 */  67, 76, 49, 70, 65, 83, 49, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5010 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 71, 69, 84,
-/* 0x5020 */  49, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 71,
-/* 0x5030 */  69, 84, 49, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5040 */  32, 32, 32,100, 32, 32, 67, 76, 49, 69, 78, 84, 69, 82,  9, 48,
-/* 0x5050 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 69, 78, 84, 69, 82,
-/* 0x5060 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5070 */  32, 32, 67, 76, 49, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5080 */  48, 48, 48, 32, 67, 76, 49, 83, 77, 65, 49, 48, 10, 48, 48, 48,
-/* 0x5090 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x50a0 */  49, 87, 73, 68, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x50b0 */  67, 76, 49, 87, 73, 68, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68,
-/* 0x50d0 */  48, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87,
-/* 0x50e0 */  73, 68, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x50f0 */  32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 52,  9, 48,
-/* 0x5100 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87, 73, 68, 48, 52,
-/* 0x5110 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5120 */  32, 32, 67, 76, 49, 87, 73, 68, 48, 53,  9, 48, 48, 48, 48, 48,
-/* 0x5130 */  48, 48, 48, 32, 67, 76, 49, 87, 73, 68, 48, 53, 10, 48, 48, 48,
-/* 0x5140 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x5150 */  49, 87, 73, 68, 48, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5160 */  67, 76, 49, 87, 73, 68, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5170 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68,
-/* 0x5180 */  48, 57,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 87,
-/* 0x5190 */  73, 68, 48, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x51a0 */  32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 49,  9, 48,
-/* 0x51b0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 49,
-/* 0x51c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x51d0 */  32, 32, 67, 76, 49, 84, 79, 80, 48, 50,  9, 48, 48, 48, 48, 48,
-/* 0x51e0 */  48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 50, 10, 48, 48, 48,
-/* 0x51f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x5200 */  49, 84, 79, 80, 48, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5210 */  67, 76, 49, 84, 79, 80, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5220 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80,
-/* 0x5230 */  48, 52,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 84,
-/* 0x5240 */  79, 80, 48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5250 */  32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 53,  9, 48,
-/* 0x5260 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 84, 79, 80, 48, 53,
-/* 0x5270 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5280 */  32, 32, 67, 76, 49, 79, 70, 70, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x5290 */  48, 48, 48, 32, 67, 76, 49, 79, 70, 70, 48, 49, 10, 48, 48, 48,
-/* 0x52a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x52b0 */  49, 79, 70, 70, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x52c0 */  67, 76, 49, 79, 70, 70, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 79, 70, 70,
-/* 0x52e0 */  48, 51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 79,
-/* 0x52f0 */  70, 70, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5300 */  32, 32, 32,100, 32, 32, 67, 76, 49, 79, 70, 70, 48, 52,  9, 48,
-/* 0x5310 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 79, 70, 70, 48, 52,
-/* 0x5320 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5330 */  32, 32, 67, 76, 49, 76, 69, 78, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x5340 */  48, 48, 48, 32, 67, 76, 49, 76, 69, 78, 48, 49, 10, 48, 48, 48,
-/* 0x5350 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x5360 */  49, 76, 69, 78, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5370 */  67, 76, 49, 76, 69, 78, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5380 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 69, 78, 68,
-/* 0x5390 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 49, 69, 78, 68,
-/* 0x53a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x53b0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  9, 48, 48, 48,
-/* 0x53c0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,
-/* 0x53d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x53e0 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x5400 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5410 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48,
-/* 0x5420 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x5430 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5440 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48,
-/* 0x5450 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x5460 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5470 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x5480 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x5490 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x54a0 */  32, 32, 67, 84, 67, 76, 69, 86, 69, 49,  9, 48, 48, 48, 48, 48,
-/* 0x54b0 */  48, 48, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48, 48,
-/* 0x54c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x54d0 */  76, 76, 84, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x54e0 */  67, 65, 76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x54f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82,
-/* 0x5500 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83,
-/* 0x5510 */  72, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5520 */  32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 48, 49,  9, 48,
-/* 0x5530 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49,
-/* 0x5540 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5550 */  32, 32, 67, 84, 66, 83, 87, 65, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x5560 */  48, 48, 48, 32, 67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48, 48,
-/* 0x5570 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x5580 */  76, 76, 84, 82, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5590 */  67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x55a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x55b0 */  69, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x55c0 */  84, 82, 69, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x55d0 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 57,  9, 48,
-/* 0x55e0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57,
-/* 0x55f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5600 */  32, 32, 67, 84, 67, 76, 69, 86, 69, 50,  9, 48, 48, 48, 48, 48,
-/* 0x5610 */  48, 48, 48, 32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48,
-/* 0x5620 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x5630 */  76, 76, 84, 82, 49, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5640 */  67, 65, 76, 76, 84, 82, 49, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5650 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82,
-/* 0x5660 */  49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83,
-/* 0x5670 */  72, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5680 */  32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49,  9, 48,
-/* 0x5690 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49,
-/* 0x56a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x56b0 */  32, 32, 67, 84, 66, 83, 87, 65, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x56c0 */  48, 48, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48, 48,
-/* 0x56d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69,
-/* 0x56e0 */  88, 69, 67, 48, 49, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x56f0 */  76, 69, 88, 69, 67, 48, 49, 53, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5700 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x5710 */  49, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69,
-/* 0x5720 */  67, 48, 49, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x5730 */  32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48,  9, 48,
-/* 0x5740 */  48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48,
-/* 0x5750 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5760 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5770 */ 122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,
-/* 0x5780 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5790 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x57a0 */  32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x57b0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x57c0 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97,
-/* 0x57d0 */  95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x57e0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x57f0 */  48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,114,111,112,
-/* 0x5800 */ 101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x5820 */  48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x5830 */ 110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x5840 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x5850 */  48, 48, 48, 48, 32,102,105,108,116,101,114, 95, 99,116,111, 10,
-/* 0x5860 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5870 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 48,
-/* 0x5880 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5890 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x58a0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x58b0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x58c0 */  76, 69, 88, 69, 67, 48, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x58d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x58e0 */  32, 91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x58f0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5900 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5910 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5920 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x5930 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5940 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65,
-/* 0x5950 */  83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5960 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5970 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x5980 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5990 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x59a0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x59b0 */  79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79,
-/* 0x59c0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x59d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x59e0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x59f0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77,
-/* 0x5a00 */  65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5a10 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x5a20 */  70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5a30 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a40 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5a50 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5a60 */  32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69,
-/* 0x5a70 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5a80 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58,
-/* 0x5a90 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5aa0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5ab0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x5ac0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5ad0 */  68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5ae0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5af0 */  50, 66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5b00 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b10 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5b20 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5b30 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5b40 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5b50 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x5b60 */  50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5b70 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68,
-/* 0x5b80 */  69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5b90 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ba0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49,
-/* 0x5bb0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5bc0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48,
-/* 0x5bd0 */  48, 48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5be0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10,
-/* 0x5bf0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5c00 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52,
-/* 0x5c10 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5c20 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5c30 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x5c40 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c50 */  78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5c60 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5c70 */  32, 91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5c80 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5c90 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5ca0 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5cb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51,
-/* 0x5cc0 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x5cd0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5ce0 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5cf0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5d00 */  50, 66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5d10 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d20 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5d30 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x5d40 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5d50 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5d60 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48,
-/* 0x5d70 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5d80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5d90 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x5da0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5db0 */  50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53,
-/* 0x5dc0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x5dd0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x5de0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5df0 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10,
-/* 0x5e00 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5e10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5e20 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5e30 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x5e40 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5e50 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5e60 */  68, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5e70 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e80 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5e90 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5ea0 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x5eb0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5ec0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93,
-/* 0x5ed0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5ee0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5ef0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x5f00 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5f10 */  68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5f20 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5f30 */  78, 50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5f40 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f50 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5f60 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5f70 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10,
-/* 0x5f80 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5f90 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50,
-/* 0x5fa0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5fb0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5fc0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x5fd0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fe0 */  78, 50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5ff0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6000 */  32, 91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6010 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6020 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6030 */  48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x6050 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6060 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65,
-/* 0x6070 */  83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6080 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6090 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x60a0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x60b0 */  32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x60c0 */  48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x60d0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10,
-/* 0x60e0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x60f0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x6100 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6110 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6120 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51,
-/* 0x6130 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6140 */  50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49,
-/* 0x6150 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6160 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48,
-/* 0x6170 */  48, 48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6180 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10,
-/* 0x6190 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x61a0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52,
-/* 0x61b0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x61c0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x61d0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x61e0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x61f0 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6200 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6210 */  32, 91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6220 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6230 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6240 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6250 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x6260 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x6270 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x6280 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6290 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x62a0 */  50, 68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x62b0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62c0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x62d0 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x62e0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10,
-/* 0x62f0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6300 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48,
-/* 0x6310 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6320 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6330 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x6340 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6350 */  50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53,
-/* 0x6360 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x6370 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x6380 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6390 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10,
-/* 0x63a0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x63b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x63c0 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x63d0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x63e0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x63f0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6400 */  69, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6410 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6420 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6430 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6440 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x6450 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6460 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93,
-/* 0x6470 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6480 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6490 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x64a0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x64b0 */  69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x64c0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x64d0 */  78, 50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x64e0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64f0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6500 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6510 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10,
-/* 0x6520 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6530 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50,
-/* 0x6540 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6550 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6560 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x6570 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6580 */  78, 50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6590 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x65a0 */  32, 91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x65b0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x65c0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x65d0 */  48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x65e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x65f0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6600 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65,
-/* 0x6610 */  83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6620 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6630 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x6640 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6650 */  32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6660 */  48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6670 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10,
-/* 0x6680 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6690 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x66a0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x66b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x66c0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51,
-/* 0x66d0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x66e0 */  50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101,
-/* 0x66f0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6700 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48,
-/* 0x6710 */  48, 48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6720 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10,
-/* 0x6730 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6740 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52,
-/* 0x6750 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6760 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6770 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x6780 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6790 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x67a0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x67b0 */  32, 91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x67c0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x67d0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x67e0 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x67f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x6800 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x6810 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x6820 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6830 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x6840 */  50, 69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6850 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6860 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6870 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x6880 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10,
-/* 0x6890 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x68a0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48,
-/* 0x68b0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x68c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x68d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x68e0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x68f0 */  50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53,
-/* 0x6900 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x6910 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x6920 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6930 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10,
-/* 0x6940 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6950 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6960 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6970 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x6980 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6990 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76,
-/* 0x69a0 */  49, 69, 78, 84, 69, 82, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x69b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x69c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x69d0 */  48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x69e0 */  32, 32, 32, 32, 32, 67, 76, 49, 83, 84, 65, 82, 84, 10, 10, 82,
-/* 0x69f0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6a00 */  83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 83, 77, 65, 49, 48, 93,
-/* 0x6a10 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6a20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6a30 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x6a40 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76,
-/* 0x6a50 */  49, 82, 76, 79, 65, 68, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6a60 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6a70 */  67, 76, 49, 87, 73, 68, 48, 51, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6a80 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a90 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6aa0 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6ab0 */  32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 49, 48, 10,
-/* 0x6ac0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6ad0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 87, 73, 68, 48,
-/* 0x6ae0 */  53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6af0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6b00 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x6b10 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6b20 */  67, 76, 49, 87, 73, 68, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6b30 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6b40 */  32, 91, 67, 76, 49, 87, 73, 68, 48, 56, 93, 58, 10, 79, 70, 70,
-/* 0x6b50 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6b60 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6b70 */  48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6b80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 48,
-/* 0x6b90 */  54, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54,
-/* 0x6ba0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49,
-/* 0x6bb0 */  87, 73, 68, 49, 48, 10, 48, 48, 48, 48, 48, 48, 49, 54, 32, 82,
-/* 0x6bc0 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6bd0 */  32, 67, 76, 49, 67, 79, 80, 89, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6be0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6bf0 */  82, 32, 91, 67, 76, 49, 87, 73, 68, 49, 48, 93, 58, 10, 79, 70,
-/* 0x6c00 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6c10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6c20 */  48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6c30 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80,
-/* 0x6c40 */  48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x6c50 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76,
-/* 0x6c60 */  49, 87, 73, 68, 48, 56, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32,
-/* 0x6c70 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c80 */  32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82, 69, 76, 79,
-/* 0x6c90 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6ca0 */  79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 49, 93, 58, 10, 79,
-/* 0x6cb0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6cc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6cd0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6ce0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79,
-/* 0x6cf0 */  80, 48, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6d00 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49,
-/* 0x6d10 */  84, 79, 80, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6d20 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d30 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6d40 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6d50 */  32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82, 69,
-/* 0x6d60 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6d70 */  32, 70, 79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 51, 93, 58,
-/* 0x6d80 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6d90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6da0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6db0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49,
-/* 0x6dc0 */  84, 79, 80, 48, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6dd0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x6de0 */  76, 49, 84, 79, 80, 48, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6df0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e00 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6e10 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6e20 */  32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10,
-/* 0x6e30 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6e40 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 53,
-/* 0x6e50 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6e60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6e70 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x6e80 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x6e90 */  76, 49, 84, 79, 80, 48, 54, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6ea0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6eb0 */  91, 67, 76, 49, 84, 79, 80, 48, 54, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6ec0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ed0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6ee0 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x6ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 48, 49,
-/* 0x6f00 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6f10 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 79, 70, 70,
-/* 0x6f20 */  48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6f30 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f40 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x6f50 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f60 */  32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6f70 */  48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6f80 */  32, 32, 32, 32, 32, 67, 76, 49, 67, 79, 80, 89, 48, 10, 10, 82,
-/* 0x6f90 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6fa0 */  83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 79, 70, 70, 48, 52, 93,
-/* 0x6fb0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6fd0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x6fe0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76,
-/* 0x6ff0 */  49, 67, 79, 80, 89, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7000 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7010 */  67, 76, 49, 76, 69, 78, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7020 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7030 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7040 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7050 */  32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 76, 69, 78, 48, 48, 10,
-/* 0x7060 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7070 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 67, 79, 80, 89,
-/* 0x7080 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7090 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x70a0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95,
-/* 0x70b0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x70c0 */  67, 76, 49, 84, 79, 80, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x70d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x70e0 */  32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79,
-/* 0x70f0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7100 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7110 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x7120 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x7130 */ 115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48,
-/* 0x7140 */  48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x7150 */  32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,
-/* 0x7160 */ 101,110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56,
-/* 0x7170 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x7180 */ 109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x7190 */  97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x71a0 */  32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,
-/* 0x71b0 */ 105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x71c0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76,
-/* 0x71d0 */  76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x71e0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x71f0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7200 */  49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x7210 */  32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,
-/* 0x7220 */ 104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7230 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69,
-/* 0x7240 */  86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7250 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7260 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x7270 */  82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7280 */  32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48,
-/* 0x7290 */  48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x72a0 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48,
-/* 0x72b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x72c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x72d0 */  48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x72e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82,
-/* 0x7300 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7310 */  32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7320 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7330 */  82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79, 70,
-/* 0x7340 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7350 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7360 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x7370 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0x7380 */  95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x7390 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x73a0 */  91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70, 83,
-/* 0x73b0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x73c0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x73d0 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x73e0 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x73f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x7400 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86,
-/* 0x7410 */  69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7420 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7430 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x7440 */  95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7450 */  32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48,
-/* 0x7460 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7470 */  32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10,
-/* 0x7480 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7490 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49,
-/* 0x74a0 */  51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x74b0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x74c0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x74d0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74e0 */  67, 65, 76, 76, 84, 82, 49, 48, 10
+/* 0x1a60 */  90, 88,205,128,131,196, 24,141, 88,  3,118,  0,  0,  0,125,  0,
+/* 0x1a70 */   0,  0, 85,  0,  0,  0, 56, 23,  0,  0,  0,  0,  0,  0, 52,  0,
+/* 0x1a80 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 57,  0,
+/* 0x1a90 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 70,  0,
+/* 0x1aa0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 73,  0,
+/* 0x1ab0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0, 75,  0,
+/* 0x1ac0 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0, 81,  0,
+/* 0x1ad0 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0, 92,  0,
+/* 0x1ae0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 97,  0,
+/* 0x1af0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,106,  0,
+/* 0x1b00 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,119,  0,
+/* 0x1b10 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,132,  0,
+/* 0x1b20 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,147,  0,
+/* 0x1b30 */   0,  0, 62,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,209,  0,
+/* 0x1b40 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,222,  0,
+/* 0x1b50 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,237,  0,
+/* 0x1b60 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,239,  0,
+/* 0x1b70 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,242,  0,
+/* 0x1b80 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,251,  0,
+/* 0x1b90 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,  7,  1,
+/* 0x1ba0 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 32,  1,
+/* 0x1bb0 */   0,  0, 22,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 54,  1,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 54,  1,
+/* 0x1bd0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0, 57,  1,
+/* 0x1be0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0, 59,  1,
+/* 0x1bf0 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0, 65,  1,
+/* 0x1c00 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 76,  1,
+/* 0x1c10 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 81,  1,
+/* 0x1c20 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0, 90,  1,
+/* 0x1c30 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0,103,  1,
+/* 0x1c40 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0,116,  1,
+/* 0x1c50 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,131,  1,
+/* 0x1c60 */   0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0,213,  1,
+/* 0x1c70 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0,226,  1,
+/* 0x1c80 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0,241,  1,
+/* 0x1c90 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0,243,  1,
+/* 0x1ca0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,246,  1,
+/* 0x1cb0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0,255,  1,
+/* 0x1cc0 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 11,  2,
+/* 0x1cd0 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0, 36,  2,
+/* 0x1ce0 */   0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 58,  2,
+/* 0x1cf0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 58,  2,
+/* 0x1d00 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 61,  2,
+/* 0x1d10 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 63,  2,
+/* 0x1d20 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0, 69,  2,
+/* 0x1d30 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 80,  2,
+/* 0x1d40 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 85,  2,
+/* 0x1d50 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 94,  2,
+/* 0x1d60 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0,107,  2,
+/* 0x1d70 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0,120,  2,
+/* 0x1d80 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0,135,  2,
+/* 0x1d90 */   0,  0, 95,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0,230,  2,
+/* 0x1da0 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,243,  2,
+/* 0x1db0 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0,  2,  3,
+/* 0x1dc0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0,  4,  3,
+/* 0x1dd0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0,  7,  3,
+/* 0x1de0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0, 16,  3,
+/* 0x1df0 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 28,  3,
+/* 0x1e00 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 53,  3,
+/* 0x1e10 */   0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 75,  3,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 75,  3,
+/* 0x1e30 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 77,  3,
+/* 0x1e40 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0, 83,  3,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  2,  0,  0, 83,  3,
+/* 0x1e60 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 55,  2,  0,  0, 89,  3,
+/* 0x1e70 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 64,  2,  0,  0, 94,  3,
+/* 0x1e80 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 73,  2,  0,  0,102,  3,
+/* 0x1e90 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0,104,  3,
+/* 0x1ea0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0,106,  3,
+/* 0x1eb0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,100,  2,  0,  0,108,  3,
+/* 0x1ec0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,109,  2,  0,  0,110,  3,
+/* 0x1ed0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,118,  2,  0,  0,112,  3,
+/* 0x1ee0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,127,  2,  0,  0,114,  3,
+/* 0x1ef0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,136,  2,  0,  0,117,  3,
+/* 0x1f00 */   0,  0, 26,  0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0,143,  3,
+/* 0x1f10 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,154,  2,  0,  0,145,  3,
+/* 0x1f20 */   0,  0, 17,  0,  0,  0,  0,  0,  0,  0,163,  2,  0,  0,162,  3,
+/* 0x1f30 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,172,  2,  0,  0,167,  3,
+/* 0x1f40 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,181,  2,  0,  0,170,  3,
+/* 0x1f50 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,190,  2,  0,  0,172,  3,
+/* 0x1f60 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,199,  2,  0,  0,174,  3,
+/* 0x1f70 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,208,  2,  0,  0,176,  3,
+/* 0x1f80 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,217,  2,  0,  0,181,  3,
+/* 0x1f90 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,226,  2,  0,  0,184,  3,
+/* 0x1fa0 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,235,  2,  0,  0,191,  3,
+/* 0x1fb0 */   0,  0, 23,  0,  0,  0,  0,  0,  0,  0,244,  2,  0,  0,214,  3,
+/* 0x1fc0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,253,  2,  0,  0,216,  3,
+/* 0x1fd0 */   0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  6,  3,  0,  0,234,  3,
+/* 0x1fe0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 15,  3,  0,  0,236,  3,
+/* 0x1ff0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 24,  3,  0,  0,240,  3,
+/* 0x2000 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 33,  3,  0,  0,241,  3,
+/* 0x2010 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 42,  3,  0,  0,243,  3,
+/* 0x2020 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 51,  3,  0,  0,248,  3,
+/* 0x2030 */   0,  0, 51,  0,  0,  0,  0,  0,  0,  0, 60,  3,  0,  0, 43,  4,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  3,  0,  0, 43,  4,
+/* 0x2050 */   0,  0, 46,  0,  0,  0,  0,  0,  0,  0, 78,  3,  0,  0, 89,  4,
+/* 0x2060 */   0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 89,  3,  0,  0,161,  4,
+/* 0x2070 */   0,  0,134, 10,  0,  0,  0,  0,  0,  0,100,  3,  0,  0, 39, 15,
+/* 0x2080 */   0,  0,134, 10,  0,  0,  0,  0,  0,  0,111,  3,  0,  0,173, 25,
+/* 0x2090 */   0,  0, 26,  0,  0,  0,  0,  0,  0,  0,122,  3,  0,  0,199, 25,
+/* 0x20a0 */   0,  0, 14,  0,  0,  0,  0,  0,  0,  0,131,  3,  0,  0,213, 25,
+/* 0x20b0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,140,  3,  0,  0,218, 25,
+/* 0x20c0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,149,  3,  0,  0,223, 25,
+/* 0x20d0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,158,  3,  0,  0,227, 25,
+/* 0x20e0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,167,  3,  0,  0,229, 25,
+/* 0x20f0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,176,  3,  0,  0,234, 25,
+/* 0x2100 */   0,  0, 14,  0,  0,  0,  0,  0,  0,  0,185,  3,  0,  0,248, 25,
+/* 0x2110 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,194,  3,  0,  0,253, 25,
+/* 0x2120 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,203,  3,  0,  0,255, 25,
+/* 0x2130 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,212,  3,  0,  0,  1, 26,
+/* 0x2140 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,221,  3,  0,  0,  5, 26,
+/* 0x2150 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,230,  3,  0,  0, 10, 26,
+/* 0x2160 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,239,  3,  0,  0, 12, 26,
+/* 0x2170 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,248,  3,  0,  0, 16, 26,
+/* 0x2180 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  4,  0,  0, 18, 26,
+/* 0x2190 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 10,  4,  0,  0, 23, 26,
+/* 0x21a0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 19,  4,  0,  0, 28, 26,
+/* 0x21b0 */   0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 28,  4,  0,  0, 55, 26,
+/* 0x21c0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 37,  4,  0,  0, 57, 26,
+/* 0x21d0 */   0,  0, 49,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,  0,
+/* 0x21f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  5,  0,
+/* 0x2200 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  8,  0,
+/* 0x2210 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,  0,
+/* 0x2220 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,  0,
+/* 0x2230 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 19,  0,
+/* 0x2240 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 20,  0,
+/* 0x2250 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,  0,
+/* 0x2260 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0, 23,  0,
+/* 0x2270 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0, 24,  0,
+/* 0x2280 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0, 27,  0,
+/* 0x2290 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0, 30,  0,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0, 35,  0,
+/* 0x22b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0, 38,  0,
+/* 0x22c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 39,  0,
+/* 0x22d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,  0,
+/* 0x22e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 42,  0,
+/* 0x22f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0, 43,  0,
+/* 0x2300 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 46,  0,
+/* 0x2310 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0, 49,  0,
+/* 0x2320 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0, 54,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 57,  0,
+/* 0x2340 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 58,  0,
+/* 0x2350 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  2,  0,  0, 64,  0,
+/* 0x2360 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73,  2,  0,  0, 65,  0,
+/* 0x2370 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,118,  2,  0,  0, 70,  0,
+/* 0x2380 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,  2,  0,  0, 72,  0,
+/* 0x2390 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,154,  2,  0,  0, 74,  0,
+/* 0x23a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,163,  2,  0,  0, 75,  0,
+/* 0x23b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,172,  2,  0,  0, 76,  0,
+/* 0x23c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,226,  2,  0,  0, 82,  0,
+/* 0x23d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,235,  2,  0,  0, 83,  0,
+/* 0x23e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  3,  0,  0, 88,  0,
+/* 0x23f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  3,  0,  0, 91,  0,
+/* 0x2400 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,122,  3,  0,  0, 98,  0,
+/* 0x2410 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,185,  3,  0,  0,105,  0,
+/* 0x2420 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,212,  3,  0,  0,108,  0,
+/* 0x2430 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  4,  0,  0,114,  0,
+/* 0x2440 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  4,  0,  0,117,  0,
+/* 0x2450 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,
+/* 0x2470 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  6,  0,
+/* 0x2490 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  7,  0,
+/* 0x24a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,  0,
+/* 0x24b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,
+/* 0x24c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 12,  0,
+/* 0x24d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0, 13,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0, 14,  0,
+/* 0x24f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0, 15,  0,
+/* 0x2500 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0, 17,  0,
+/* 0x2510 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0, 18,  0,
+/* 0x2520 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0, 22,  0,
+/* 0x2530 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 25,  0,
+/* 0x2540 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 26,  0,
+/* 0x2550 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,  0,
+/* 0x2560 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 29,  0,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0, 31,  0,
+/* 0x2580 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0, 32,  0,
+/* 0x2590 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0, 33,  0,
+/* 0x25a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 34,  0,
+/* 0x25b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0, 36,  0,
+/* 0x25c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 37,  0,
+/* 0x25d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 41,  0,
+/* 0x25e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 44,  0,
+/* 0x25f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 45,  0,
+/* 0x2600 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,  0,
+/* 0x2610 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0, 48,  0,
+/* 0x2620 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0, 50,  0,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0, 51,  0,
+/* 0x2640 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 52,  0,
+/* 0x2650 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0, 53,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0, 55,  0,
+/* 0x2670 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 56,  0,
+/* 0x2680 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 59,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 60,  0,
+/* 0x26a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0, 61,  0,
+/* 0x26b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  2,  0,  0, 62,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  2,  0,  0, 63,  0,
+/* 0x26d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0, 66,  0,
+/* 0x26e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0, 67,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  2,  0,  0, 68,  0,
+/* 0x2700 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,  2,  0,  0, 69,  0,
+/* 0x2710 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,127,  2,  0,  0, 71,  0,
+/* 0x2720 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0, 73,  0,
+/* 0x2730 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,  2,  0,  0, 77,  0,
+/* 0x2740 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,190,  2,  0,  0, 78,  0,
+/* 0x2750 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,199,  2,  0,  0, 79,  0,
+/* 0x2760 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,208,  2,  0,  0, 80,  0,
+/* 0x2770 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,217,  2,  0,  0, 81,  0,
+/* 0x2780 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,244,  2,  0,  0, 84,  0,
+/* 0x2790 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,253,  2,  0,  0, 85,  0,
+/* 0x27a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  3,  0,  0, 86,  0,
+/* 0x27b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  3,  0,  0, 87,  0,
+/* 0x27c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  3,  0,  0, 89,  0,
+/* 0x27d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  3,  0,  0, 90,  0,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  3,  0,  0, 92,  0,
+/* 0x27f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  3,  0,  0, 93,  0,
+/* 0x2800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  3,  0,  0, 94,  0,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  3,  0,  0, 95,  0,
+/* 0x2820 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  3,  0,  0, 96,  0,
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,111,  3,  0,  0, 97,  0,
+/* 0x2840 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,  3,  0,  0, 99,  0,
+/* 0x2850 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,  3,  0,  0,100,  0,
+/* 0x2860 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,  3,  0,  0,101,  0,
+/* 0x2870 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,158,  3,  0,  0,102,  0,
+/* 0x2880 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  3,  0,  0,103,  0,
+/* 0x2890 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,  3,  0,  0,104,  0,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,194,  3,  0,  0,106,  0,
+/* 0x28b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,203,  3,  0,  0,107,  0,
+/* 0x28c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,  3,  0,  0,109,  0,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,230,  3,  0,  0,110,  0,
+/* 0x28e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,239,  3,  0,  0,111,  0,
+/* 0x28f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,  3,  0,  0,112,  0,
+/* 0x2900 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  4,  0,  0,113,  0,
+/* 0x2910 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  4,  0,  0,115,  0,
+/* 0x2920 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  4,  0,  0,116,  0,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  4,  0,  0,  0,  0,
+/* 0x2940 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  4,  0,  0,119,  0,
+/* 0x2950 */   0,  0,173,222,173,222,  0,  0,  0,  0, 71,  4,  0,  0,119,  0,
+/* 0x2960 */   0,  0,173,222,173,222,  0,  0,  0,  0, 82,  4,  0,  0,119,  0,
+/* 0x2970 */   0,  0,173,222,173,222,  0,  0,  0,  0, 93,  4,  0,  0,119,  0,
+/* 0x2980 */   0,  0,173,222,173,222,  0,  0,  0,  0,109,  4,  0,  0,119,  0,
+/* 0x2990 */   0,  0,173,222,173,222,  0,  0,  0,  0,123,  4,  0,  0,119,  0,
+/* 0x29a0 */   0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+/* 0x29b0 */   0,  0,134,  4,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29c0 */   0,  0,  2,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0,  2,  0,
+/* 0x29d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,
+/* 0x29e0 */   0,  0,145,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29f0 */   0,  0,  6,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0,  0,  0,
+/* 0x2a00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  3,  0,
+/* 0x2a10 */   0,  0,145,  4,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a20 */   0,  0,  9,  0,  0,  0, 12,  0,  0,  0,145,  4,  0,  0,  3,  0,
+/* 0x2a30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  3,  0,
+/* 0x2a40 */   0,  0,145,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a50 */   0,  0, 10,  0,  0,  0, 14,  0,  0,  0,145,  4,  0,  0,  3,  0,
+/* 0x2a60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 17,  0,
+/* 0x2a70 */   0,  0,145,  4,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a80 */   0,  0, 11,  0,  0,  0, 47,  0,  0,  0,145,  4,  0,  0,  5,  0,
+/* 0x2a90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 12,  0,
+/* 0x2aa0 */   0,  0,145,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ab0 */   0,  0, 13,  0,  0,  0,  3,  0,  0,  0,145,  4,  0,  0,  4,  0,
+/* 0x2ac0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 14,  0,
+/* 0x2ad0 */   0,  0,145,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ae0 */   0,  0, 17,  0,  0,  0,  8,  0,  0,  0,134,  4,  0,  0,  2,  0,
+/* 0x2af0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 10,  0,
+/* 0x2b00 */   0,  0,145,  4,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b10 */   0,  0, 18,  0,  0,  0, 21,  0,  0,  0,134,  4,  0,  0,  2,  0,
+/* 0x2b20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 18,  0,
+/* 0x2b30 */   0,  0,134,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b40 */   0,  0, 21,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0, 10,  0,
+/* 0x2b50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,  1,  0,
+/* 0x2b60 */   0,  0,145,  4,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b70 */   0,  0, 25,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0,  8,  0,
+/* 0x2b80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  3,  0,
+/* 0x2b90 */   0,  0,145,  4,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ba0 */   0,  0, 28,  0,  0,  0, 12,  0,  0,  0,145,  4,  0,  0, 12,  0,
+/* 0x2bb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,  5,  0,
+/* 0x2bc0 */   0,  0,145,  4,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bd0 */   0,  0, 29,  0,  0,  0, 14,  0,  0,  0,145,  4,  0,  0, 12,  0,
+/* 0x2be0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 15,  0,
+/* 0x2bf0 */   0,  0,145,  4,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c00 */   0,  0, 30,  0,  0,  0, 33,  0,  0,  0,145,  4,  0,  0, 15,  0,
+/* 0x2c10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 67,  0,
+/* 0x2c20 */   0,  0,145,  4,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c30 */   0,  0, 31,  0,  0,  0, 12,  0,  0,  0,145,  4,  0,  0, 12,  0,
+/* 0x2c40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,  3,  0,
+/* 0x2c50 */   0,  0,145,  4,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c60 */   0,  0, 32,  0,  0,  0, 14,  0,  0,  0,145,  4,  0,  0, 12,  0,
+/* 0x2c70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  8,  0,
+/* 0x2c80 */   0,  0,134,  4,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c90 */   0,  0, 37,  0,  0,  0, 10,  0,  0,  0,145,  4,  0,  0, 14,  0,
+/* 0x2ca0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0, 21,  0,
+/* 0x2cb0 */   0,  0,134,  4,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cc0 */   0,  0, 38,  0,  0,  0, 18,  0,  0,  0,134,  4,  0,  0, 10,  0,
+/* 0x2cd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  1,  0,
+/* 0x2ce0 */   0,  0,145,  4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cf0 */   0,  0, 41,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0, 18,  0,
+/* 0x2d00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,  1,  0,
+/* 0x2d10 */   0,  0,145,  4,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d20 */   0,  0, 45,  0,  0,  0,  3,  0,  0,  0,145,  4,  0,  0, 17,  0,
+/* 0x2d30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0, 12,  0,
+/* 0x2d40 */   0,  0,145,  4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d50 */   0,  0, 48,  0,  0,  0,  5,  0,  0,  0,145,  4,  0,  0, 20,  0,
+/* 0x2d60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0, 14,  0,
+/* 0x2d70 */   0,  0,145,  4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d80 */   0,  0, 49,  0,  0,  0, 15,  0,  0,  0,145,  4,  0,  0, 19,  0,
+/* 0x2d90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0, 30,  0,
+/* 0x2da0 */   0,  0,145,  4,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2db0 */   0,  0, 49,  0,  0,  0, 48,  0,  0,  0,145,  4,  0,  0, 23,  0,
+/* 0x2dc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 12,  0,
+/* 0x2dd0 */   0,  0,145,  4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2de0 */   0,  0, 51,  0,  0,  0,  3,  0,  0,  0,145,  4,  0,  0, 20,  0,
+/* 0x2df0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0, 14,  0,
+/* 0x2e00 */   0,  0,145,  4,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e10 */   0,  0, 55,  0,  0,  0,  8,  0,  0,  0,134,  4,  0,  0, 18,  0,
+/* 0x2e20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0, 10,  0,
+/* 0x2e30 */   0,  0,145,  4,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e40 */   0,  0, 56,  0,  0,  0, 21,  0,  0,  0,134,  4,  0,  0, 18,  0,
+/* 0x2e50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 18,  0,
+/* 0x2e60 */   0,  0,134,  4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e70 */   0,  0, 62,  0,  0,  0,  2,  0,  0,  0,134,  4,  0,  0, 29,  0,
+/* 0x2e80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  3,  0,
+/* 0x2e90 */   0,  0,145,  4,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ea0 */   0,  0, 67,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0, 28,  0,
+/* 0x2eb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  1,  0,
+/* 0x2ec0 */   0,  0,145,  4,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ed0 */   0,  0, 72,  0,  0,  0,  6,  0,  0,  0,145,  4,  0,  0, 26,  0,
+/* 0x2ee0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0, 16,  0,
+/* 0x2ef0 */   0,  0,145,  4,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f00 */   0,  0, 72,  0,  0,  0, 22,  0,  0,  0,134,  4,  0,  0, 34,  0,
+/* 0x2f10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,  0,  0,  0,  6,  0,
+/* 0x2f20 */   0,  0,145,  4,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f30 */   0,  0, 74,  0,  0,  0, 10,  0,  0,  0,145,  4,  0,  0, 27,  0,
+/* 0x2f40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,  0,  0,  0, 16,  0,
+/* 0x2f50 */   0,  0,145,  4,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f60 */   0,  0, 77,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0, 32,  0,
+/* 0x2f70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  1,  0,
+/* 0x2f80 */   0,  0,145,  4,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f90 */   0,  0, 79,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0, 32,  0,
+/* 0x2fa0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  1,  0,
+/* 0x2fb0 */   0,  0,145,  4,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fc0 */   0,  0, 81,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0, 31,  0,
+/* 0x2fd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  0,  0,  0,  3,  0,
+/* 0x2fe0 */   0,  0,134,  4,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */   0,  0, 85,  0,  0,  0,  1,  0,  0,  0,145,  4,  0,  0, 32,  0,
+/* 0x3000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,  0,  0,  0, 15,  0,
+/* 0x3010 */   0,  0,145,  4,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3020 */   0,  0, 87,  0,  0,  0,  3,  0,  0,  0,145,  4,  0,  0, 34,  0,
+/* 0x3030 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,  1,  0,
+/* 0x3040 */   0,  0,145,  4,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */   0,  0, 91,  0,  0,  0, 33,  0,  0,  0,134,  4,  0,  0, 30,  0,
+/* 0x3060 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  0,  0,  0,  5,  0,
+/* 0x3070 */   0,  0,155,  4,  0,  0,119,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3080 */   0,  0, 93,  0,  0,  0, 20,  0,  0,  0,155,  4,  0,  0,120,  0,
+/* 0x3090 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  0,  0,  0, 30,  0,
+/* 0x30a0 */   0,  0,155,  4,  0,  0,121,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30b0 */   0,  0, 93,  0,  0,  0, 42,  0,  0,  0,155,  4,  0,  0,122,  0,
+/* 0x30c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,  1,  0,
+/* 0x30d0 */   0,  0,155,  4,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30e0 */   0,  0, 99,  0,  0,  0,  2,  0,  0,  0,164,  4,  0,  0,124,  0,
+/* 0x30f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,  4,  0,
+/* 0x3100 */   0,  0,145,  4,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3110 */   0,  0,104,  0,  0,  0, 13,  0,  0,  0,145,  4,  0,  0, 35,  0,
+/* 0x3120 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,  1,  0,
+/* 0x3130 */   0,  0,155,  4,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3140 */   0,  0,108,  0,  0,  0,  3,  0,  0,  0,145,  4,  0,  0, 38,  0,
+/* 0x3150 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,  2,  0,
+/* 0x3160 */   0,  0,164,  4,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3170 */   0,  0,109,  0,  0,  0,  4,  0,  0,  0,145,  4,  0,  0, 37,  0,
+/* 0x3180 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  4,  0,
+/* 0x3190 */   0,  0,145,  4,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31a0 */   0,  0, 76, 69, 88, 69, 67, 48, 48, 48,  0, 76, 69, 88, 69, 67,
+/* 0x31b0 */  48, 49, 48,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0, 78, 50, 66,
+/* 0x31c0 */  70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 49,  0, 78,
+/* 0x31d0 */  50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77, 65, 50, 48,
+/* 0x31e0 */   0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66, 68, 69, 67,
+/* 0x31f0 */  50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78, 50, 66, 70,
+/* 0x3200 */  65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,  0, 78, 50,
+/* 0x3210 */  66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83, 52, 48,  0,
+/* 0x3220 */  78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70, 65, 83, 53,
+/* 0x3230 */  48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50, 66, 83, 77,
+/* 0x3240 */  65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0, 78, 50, 66,
+/* 0x3250 */  70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54, 48,  0, 78,
+/* 0x3260 */  50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 48,
+/* 0x3270 */   0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68, 68, 69, 67,
+/* 0x3280 */  49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78, 50, 68, 70,
+/* 0x3290 */  65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,  0, 78, 50,
+/* 0x32a0 */  68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83, 51, 48,  0,
+/* 0x32b0 */  78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83, 77, 65, 52,
+/* 0x32c0 */  48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50, 68, 83, 77,
+/* 0x32d0 */  65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0, 78, 50, 68,
+/* 0x32e0 */  68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54, 48,  0, 78,
+/* 0x32f0 */  50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 49,
+/* 0x3300 */   0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69, 83, 77, 65,
+/* 0x3310 */  49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78, 50, 69, 70,
+/* 0x3320 */  65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,  0, 78, 50,
+/* 0x3330 */  69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83, 50, 48,  0,
+/* 0x3340 */  78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83, 77, 65, 51,
+/* 0x3350 */  48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50, 69, 68, 69,
+/* 0x3360 */  67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0, 78, 50, 69,
+/* 0x3370 */  70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53, 48,  0, 78,
+/* 0x3380 */  50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69, 67, 53, 48,
+/* 0x3390 */   0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x33a0 */  54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78, 50, 69, 68,
+/* 0x33b0 */  69, 67, 54, 48,  0, 67, 76, 49, 83, 77, 65, 49, 66,  0, 67, 76,
+/* 0x33c0 */  49, 70, 65, 83, 49, 66,  0, 67, 76, 49, 71, 69, 84, 49, 66,  0,
+/* 0x33d0 */  67, 76, 49, 69, 78, 84, 69, 82,  0, 67, 76, 49, 83, 77, 65, 49,
+/* 0x33e0 */  48,  0, 67, 76, 49, 82, 76, 79, 65, 68,  0, 67, 76, 49, 87, 73,
+/* 0x33f0 */  68, 48, 49,  0, 67, 76, 49, 87, 73, 68, 48, 50,  0, 67, 76, 49,
+/* 0x3400 */  87, 73, 68, 48, 51,  0, 67, 76, 49, 87, 73, 68, 48, 52,  0, 67,
+/* 0x3410 */  76, 49, 87, 73, 68, 48, 53,  0, 67, 76, 49, 87, 73, 68, 48, 54,
+/* 0x3420 */   0, 67, 76, 49, 87, 73, 68, 48, 55,  0, 67, 76, 49, 87, 73, 68,
+/* 0x3430 */  48, 56,  0, 67, 76, 49, 87, 73, 68, 48, 57,  0, 67, 76, 49, 87,
+/* 0x3440 */  73, 68, 49, 48,  0, 67, 76, 49, 83, 84, 65, 82, 84,  0, 67, 76,
+/* 0x3450 */  49, 84, 79, 80, 48, 48,  0, 67, 76, 49, 84, 79, 80, 48, 49,  0,
+/* 0x3460 */  67, 76, 49, 84, 79, 80, 48, 50,  0, 67, 76, 49, 84, 79, 80, 48,
+/* 0x3470 */  51,  0, 67, 76, 49, 84, 79, 80, 48, 52,  0, 67, 76, 49, 84, 79,
+/* 0x3480 */  80, 48, 53,  0, 67, 76, 49, 84, 79, 80, 48, 54,  0, 67, 76, 49,
+/* 0x3490 */  84, 79, 80, 48, 55,  0, 67, 76, 49, 79, 70, 70, 48, 49,  0, 67,
+/* 0x34a0 */  76, 49, 79, 70, 70, 48, 50,  0, 67, 76, 49, 79, 70, 70, 48, 51,
+/* 0x34b0 */   0, 67, 76, 49, 79, 70, 70, 48, 52,  0, 67, 76, 49, 76, 69, 78,
+/* 0x34c0 */  48, 48,  0, 67, 76, 49, 76, 69, 78, 48, 49,  0, 67, 76, 49, 76,
+/* 0x34d0 */  69, 78, 48, 50,  0, 67, 76, 49, 67, 79, 80, 89, 48,  0, 67, 76,
+/* 0x34e0 */  49, 69, 78, 68,  0, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  0,
+/* 0x34f0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95,
+/* 0x3500 */  68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
+/* 0x3510 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 67, 65, 76, 76,
+/* 0x3520 */  84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65,
+/* 0x3530 */  76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0,
+/* 0x3540 */  67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48,
+/* 0x3550 */  49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84,
+/* 0x3560 */  82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76,
+/* 0x3570 */  76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67,
+/* 0x3580 */  84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,
+/* 0x3590 */   0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82,
+/* 0x35a0 */  49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76,
+/* 0x35b0 */  84, 82, 49, 51,  0, 76, 69, 88, 69, 67, 48, 49, 53,  0, 76, 69,
+/* 0x35c0 */  88, 69, 67, 48, 49, 55,  0, 76, 69, 88, 69, 67, 48, 50, 48,  0,
+/* 0x35d0 */  95,115,116, 97,114,116,  0,108,122,109, 97, 95,115,116, 97, 99,
+/* 0x35e0 */ 107, 95, 97,100,106,117,115,116,  0,108,122,109, 97, 95,117, 95,
+/* 0x35f0 */ 108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,108,
+/* 0x3600 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,  0,102,
+/* 0x3610 */ 105,108,116,101,114, 95,108,101,110,103,116,104,  0,102,105,108,
+/* 0x3620 */ 116,101,114, 95, 99,116,111,  0, 82, 95, 51, 56, 54, 95, 80, 67,
+/* 0x3630 */  51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51,
+/* 0x3640 */  56, 54, 95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 56,  0,106, 26,
+/* 0x3650 */   0,  0, 85, 80, 88, 76
 };
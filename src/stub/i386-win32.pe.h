@@ -1,5 +1,5 @@
 /* i386-win32.pe.h
-   created from i386-win32.pe.bin, 32924 (0x809c) bytes
+   created from i386-win32.pe.bin, 15335 (0x3be7) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_WIN32_PE_SIZE    32924
-#define STUB_I386_WIN32_PE_ADLER32 0x0faef762
-#define STUB_I386_WIN32_PE_CRC32   0x5d113647
+#define STUB_I386_WIN32_PE_SIZE    15335
+#define STUB_I386_WIN32_PE_ADLER32 0x002889ce
+#define STUB_I386_WIN32_PE_CRC32   0xbb469371
 
-unsigned char stub_i386_win32_pe[32924] = {
+unsigned char stub_i386_win32_pe[15335] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 144, 32,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -468,1630 +468,531 @@ unsigned char stub_i386_win32_pe[32924] = {
 /* 0x1ad0 */ 235, 26, 86,190,  0,  0,  0,  0,252,173,133,192,116, 13,106,  3,
 /* 0x1ae0 */  89,255,116, 36, 16,226,250,255,208,235,238, 94,194, 12,  0, 85,
 /* 0x1af0 */  80, 88, 33,161,216,208,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x1b00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,102,
-/* 0x1b10 */ 105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51, 50,
-/* 0x1b20 */  45,105, 51, 56, 54, 10, 10, 83,101, 99,116,105,111,110,115, 58,
-/* 0x1b30 */  10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b40 */  32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65,
-/* 0x1b50 */  32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x1b60 */  32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32,
-/* 0x1b70 */  32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 80, 69, 73, 83, 68,
-/* 0x1b80 */  76, 76, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32,
-/* 0x1bb0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1bc0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1bd0 */  10, 32, 32, 49, 32, 80, 69, 77, 65, 73, 78, 48, 49, 32, 32, 32,
-/* 0x1be0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c00 */  32, 48, 48, 48, 48, 48, 48, 51,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1c20 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 80,
-/* 0x1c30 */  69, 73, 67, 79, 78, 83, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 52, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1c70 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1c80 */  79, 78, 76, 89, 10, 32, 32, 51, 32, 80, 69, 73, 67, 79, 78, 83,
-/* 0x1c90 */  50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x1ca0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 50, 32, 32, 50,
-/* 0x1cc0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1cd0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1ce0 */  32, 52, 32, 80, 69, 84, 76, 83, 72, 65, 75, 32, 32, 32, 32, 32,
-/* 0x1cf0 */  32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d10 */  48, 48, 48, 48, 48, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1d20 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1d30 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 80, 69, 77,
-/* 0x1d40 */  65, 73, 78, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1d70 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1d80 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32,
-/* 0x1d90 */  80, 69, 77, 65, 73, 78, 48, 51, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1dd0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1de0 */  32, 55, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32,
-/* 0x1df0 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 54, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1e20 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1e30 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 78, 50, 66,
-/* 0x1e40 */  70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1e70 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1e80 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1e90 */  76, 89, 10, 32, 32, 57, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x1eb0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 54,101, 32, 32, 50, 42, 42,
-/* 0x1ed0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1ee0 */  68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x1ef0 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98,
-/* 0x1f00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 52, 32, 32,
-/* 0x1f20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1f30 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 78, 50, 66,
-/* 0x1f40 */  83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1f50 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1f60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55,
-/* 0x1f70 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1f80 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1f90 */  76, 89, 10, 32, 49, 50, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32,
-/* 0x1fa0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 52, 32, 32, 50, 42, 42,
-/* 0x1fd0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1fe0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51,
-/* 0x1ff0 */  32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2030 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2040 */  32, 49, 52, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32,
-/* 0x2050 */  32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48,
-/* 0x2060 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2080 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2090 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53, 32, 78, 50,
-/* 0x20a0 */  66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x20c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x20d0 */  97, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x20e0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x20f0 */  78, 76, 89, 10, 32, 49, 54, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x2100 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51,101, 32, 32,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2120 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 98, 52, 32, 32, 50, 42,
-/* 0x2130 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2140 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x2150 */  55, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2180 */  48, 48, 48, 48,102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2190 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x21a0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 56, 32, 78, 50, 66, 70,
-/* 0x21b0 */  65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x21c0 */  48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,102,102,
-/* 0x21e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x21f0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2200 */  89, 10, 32, 49, 57, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 32,
-/* 0x2210 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x2220 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  32, 32, 48, 48, 48, 48, 48, 49, 48,101, 32, 32, 50, 42, 42, 48,
-/* 0x2240 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2250 */  79, 78, 76, 89, 10, 32, 50, 48, 32, 78, 50, 66, 70, 65, 83, 53,
-/* 0x2260 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x2270 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 49, 48, 32, 32, 50,
-/* 0x2290 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x22a0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 49, 32, 78, 50, 66, 68,
-/* 0x22b0 */  69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x22c0 */  48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x22d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 49, 51,
-/* 0x22e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x22f0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 50, 32, 78,
-/* 0x2300 */  50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2320 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2330 */  49, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2340 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2350 */  79, 78, 76, 89, 10, 32, 50, 51, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x2360 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32,
-/* 0x2370 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2380 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 97, 32, 32, 50,
-/* 0x2390 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x23a0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x23b0 */  50, 52, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32,
-/* 0x23c0 */  32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x23e0 */  48, 48, 48, 48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x23f0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2400 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 53, 32, 78, 50, 66,
-/* 0x2410 */  68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2420 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 53,
-/* 0x2440 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2450 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 54, 32,
-/* 0x2460 */  78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2470 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2480 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2490 */  48, 49, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x24a0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x24b0 */  68, 79, 78, 76, 89, 10, 32, 50, 55, 32, 78, 50, 68, 70, 65, 83,
-/* 0x24c0 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x24d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x24e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 53, 57, 32, 32,
-/* 0x24f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2500 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2510 */  32, 50, 56, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32,
-/* 0x2520 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2540 */  48, 48, 48, 48, 48, 49, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2550 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2560 */  76, 89, 10, 32, 50, 57, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32,
-/* 0x2570 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48,
-/* 0x2580 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2590 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 54, 49, 32, 32, 50, 42, 42,
-/* 0x25a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x25b0 */  68, 79, 78, 76, 89, 10, 32, 51, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x25c0 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x25d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x25e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 54, 99, 32, 32,
-/* 0x25f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2600 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2610 */  32, 51, 49, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32,
-/* 0x2620 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48,
-/* 0x2630 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2640 */  48, 48, 48, 48, 48, 49, 55, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2650 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2660 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 50, 32, 78, 50,
-/* 0x2670 */  68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2680 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2690 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x26a0 */  55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x26b0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 51,
-/* 0x26c0 */  32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x26d0 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26e0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x26f0 */  48, 48, 49, 56, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2700 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2710 */  65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32, 78, 50, 68, 70, 65,
-/* 0x2720 */  83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2730 */ 102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2740 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 57, 50, 32,
-/* 0x2750 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2760 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2770 */  10, 32, 51, 53, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x2780 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 50, 32, 32, 48, 48, 48,
-/* 0x2790 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x27a0 */  32, 48, 48, 48, 48, 48, 49, 97, 49, 32, 32, 50, 42, 42, 48, 32,
-/* 0x27b0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x27c0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 54, 32, 78,
-/* 0x27d0 */  50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x27e0 */  48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x27f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2800 */  49,102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2810 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2820 */  79, 78, 76, 89, 10, 32, 51, 55, 32, 78, 50, 68, 70, 65, 83, 52,
-/* 0x2830 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x2840 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2850 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 48, 48, 32, 32, 50,
-/* 0x2860 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2870 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2880 */  51, 56, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2890 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x28a0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x28b0 */  48, 48, 48, 48, 50, 48,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x28c0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x28d0 */  89, 10, 32, 51, 57, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32,
-/* 0x28e0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x28f0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2900 */  32, 32, 48, 48, 48, 48, 48, 50, 49, 49, 32, 32, 50, 42, 42, 48,
-/* 0x2910 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2920 */  79, 78, 76, 89, 10, 32, 52, 48, 32, 78, 50, 68, 68, 69, 67, 53,
-/* 0x2930 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x2940 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2950 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 52, 32, 32, 50,
-/* 0x2960 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2970 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49, 32, 78, 50, 68, 83,
-/* 0x2980 */  77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2990 */  48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x29a0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49,100,
-/* 0x29b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x29c0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x29d0 */  89, 10, 32, 52, 50, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32,
-/* 0x29e0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48,
-/* 0x29f0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a00 */  32, 32, 48, 48, 48, 48, 48, 50, 50, 98, 32, 32, 50, 42, 42, 48,
-/* 0x2a10 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2a20 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 51, 32,
-/* 0x2a30 */  78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2a40 */  48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a50 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2a60 */  48, 50, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2a70 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2a80 */  68, 79, 78, 76, 89, 10, 32, 52, 52, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2a90 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2aa0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2ab0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 55, 32, 32,
-/* 0x2ac0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2ad0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 53, 32, 78, 50, 69,
-/* 0x2ae0 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2af0 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2b00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53,
-/* 0x2b10 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2b20 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2b30 */  76, 89, 10, 32, 52, 54, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32,
-/* 0x2b40 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x2b50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b60 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 97, 32, 32, 50, 42, 42,
-/* 0x2b70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2b80 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 55,
-/* 0x2b90 */  32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2ba0 */  48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2bb0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2bc0 */  48, 48, 50, 53, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2bd0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2be0 */  32, 52, 56, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x2bf0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48,
-/* 0x2c00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2c10 */  48, 48, 48, 48, 48, 50, 54, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2c20 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2c30 */  76, 89, 10, 32, 52, 57, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32,
-/* 0x2c40 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x2c50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c60 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 54,100, 32, 32, 50, 42, 42,
-/* 0x2c70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2c80 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 48,
-/* 0x2c90 */  32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2ca0 */  48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cb0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2cc0 */  48, 48, 50, 55, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2cd0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2ce0 */  65, 68, 79, 78, 76, 89, 10, 32, 53, 49, 32, 78, 50, 69, 68, 69,
-/* 0x2cf0 */  67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d00 */ 100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2d10 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 55, 57, 32,
-/* 0x2d20 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2d30 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 50, 32, 78, 50,
-/* 0x2d40 */  69, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2d50 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2d60 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2d70 */  56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2d80 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2d90 */  78, 76, 89, 10, 32, 53, 51, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x2da0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32,
-/* 0x2db0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2dc0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 57, 51, 32, 32, 50, 42,
-/* 0x2dd0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2de0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53,
-/* 0x2df0 */  52, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2e00 */  48, 48, 48, 48, 48, 48, 53,102, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2e10 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2e20 */  48, 48, 48, 50, 97, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2e30 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2e40 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 53, 32, 78, 50, 69, 83,
-/* 0x2e50 */  77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2e60 */  48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2e70 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48, 49,
-/* 0x2e80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2e90 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2ea0 */  89, 10, 32, 53, 54, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32,
-/* 0x2eb0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48,
-/* 0x2ec0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ed0 */  32, 32, 48, 48, 48, 48, 48, 51, 48,101, 32, 32, 50, 42, 42, 48,
-/* 0x2ee0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2ef0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 55, 32,
-/* 0x2f00 */  78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2f10 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f20 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2f30 */  48, 51, 49,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2f40 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2f50 */  53, 56, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2f60 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f70 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f80 */  48, 48, 48, 48, 51, 49,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2f90 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2fa0 */  89, 10, 32, 53, 57, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32,
-/* 0x2fb0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48,
-/* 0x2fc0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fd0 */  32, 32, 48, 48, 48, 48, 48, 51, 50, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2fe0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2ff0 */  79, 78, 76, 89, 10, 32, 54, 48, 32, 78, 50, 69, 83, 77, 65, 54,
-/* 0x3000 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32,
-/* 0x3010 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3020 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 50, 98, 32, 32, 50,
-/* 0x3030 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x3040 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3050 */  54, 49, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32,
-/* 0x3060 */  32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3070 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3080 */  48, 48, 48, 48, 51, 51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3090 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x30a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 50, 32, 78, 50, 69,
-/* 0x30b0 */  70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x30c0 */  48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x30d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52,
-/* 0x30e0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x30f0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3100 */  76, 89, 10, 32, 54, 51, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32,
-/* 0x3110 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3120 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3130 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 54, 53, 32, 32, 50, 42, 42,
-/* 0x3140 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3150 */  68, 79, 78, 76, 89, 10, 32, 54, 52, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3160 */  69, 67, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50,101,
-/* 0x3170 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3180 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 54, 53, 32, 32,
-/* 0x3190 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x31a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x31b0 */  32, 54, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32,
-/* 0x31c0 */  32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 48, 48, 48, 48,
-/* 0x31d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x31e0 */  48, 48, 48, 48, 48, 51, 57, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x31f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3200 */  76, 89, 10, 32, 54, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3210 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 56, 54, 32, 32, 48,
-/* 0x3220 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3230 */  48, 32, 32, 48, 48, 48, 48, 48, 51,100, 98, 32, 32, 50, 42, 42,
-/* 0x3240 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3250 */  68, 79, 78, 76, 89, 10, 32, 54, 55, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3260 */  69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 56, 54,
-/* 0x3270 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3280 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101, 54, 49, 32, 32,
-/* 0x3290 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x32a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 56, 32, 76, 90, 77,
-/* 0x32b0 */  65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x32c0 */  48, 49, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x32d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,101,
-/* 0x32e0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x32f0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 57, 32,
-/* 0x3300 */  80, 69, 77, 65, 73, 78, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3310 */  48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3320 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3330 */  49, 57, 48, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3340 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3350 */  55, 48, 32, 80, 69, 67, 84, 84, 80, 79, 83, 32, 32, 32, 32, 32,
-/* 0x3360 */  32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3370 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3380 */  48, 48, 48, 49, 57, 48, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3390 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x33a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 49, 32, 80, 69, 67,
-/* 0x33b0 */  84, 84, 78, 85, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x33c0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x33d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48,
-/* 0x33e0 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x33f0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 50, 32,
-/* 0x3400 */  67, 65, 76, 76, 84, 82, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3410 */  48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3420 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3430 */  49, 57, 48, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3440 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3450 */  68, 79, 78, 76, 89, 10, 32, 55, 51, 32, 67, 84, 67, 76, 69, 86,
-/* 0x3460 */  69, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3470 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3480 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 49, 56, 32, 32,
-/* 0x3490 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x34a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x34b0 */  32, 55, 52, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32,
-/* 0x34c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x34d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x34e0 */  48, 48, 48, 48, 49, 57, 49,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x34f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3500 */  76, 89, 10, 32, 55, 53, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32,
-/* 0x3510 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x3520 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3530 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 50, 50, 32, 32, 50, 42, 42,
-/* 0x3540 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3550 */  68, 79, 78, 76, 89, 10, 32, 55, 54, 32, 67, 84, 66, 82, 79, 82,
-/* 0x3560 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3570 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3580 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50, 54, 32, 32,
-/* 0x3590 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x35a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 55, 32, 67, 84, 66,
-/* 0x35b0 */  83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x35c0 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x35d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50,
-/* 0x35e0 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x35f0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 56, 32,
-/* 0x3600 */  67, 65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3610 */  48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3620 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3630 */  49, 57, 50,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3640 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3650 */  68, 79, 78, 76, 89, 10, 32, 55, 57, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3660 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3670 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3680 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51,100, 32, 32,
-/* 0x3690 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x36a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x36b0 */  32, 56, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32,
-/* 0x36c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x36d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x36e0 */  48, 48, 48, 48, 49, 57, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x36f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3700 */  76, 89, 10, 32, 56, 49, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32,
-/* 0x3710 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x3720 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3730 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 52, 52, 32, 32, 50, 42, 42,
-/* 0x3740 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3750 */  68, 79, 78, 76, 89, 10, 32, 56, 50, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3760 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x3770 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3780 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 52, 54, 32, 32,
-/* 0x3790 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x37a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x37b0 */  32, 56, 51, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32,
-/* 0x37c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x37d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x37e0 */  48, 48, 48, 48, 49, 57, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x37f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3800 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 52, 32, 67, 65,
-/* 0x3810 */  76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3820 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3830 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3840 */  52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3850 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 53,
-/* 0x3860 */  32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3870 */  48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3880 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3890 */  48, 49, 57, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x38a0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x38b0 */  32, 56, 54, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32,
-/* 0x38c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x38d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x38e0 */  48, 48, 48, 48, 49, 57, 53, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x38f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3900 */  76, 89, 10, 32, 56, 55, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32,
-/* 0x3910 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x3920 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3930 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 55, 32, 32, 50, 42, 42,
-/* 0x3940 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3950 */  68, 79, 78, 76, 89, 10, 32, 56, 56, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3960 */  49, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x3970 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3980 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 99, 32, 32,
-/* 0x3990 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x39a0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x39b0 */  32, 56, 57, 32, 99,116,111,107, 51, 50, 46, 48, 48, 32, 32, 32,
-/* 0x39c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48,
-/* 0x39d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x39e0 */  48, 48, 48, 48, 49, 57, 54, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x39f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3a00 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 48, 32, 99,116,
-/* 0x3a10 */ 111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3a20 */  48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3a30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3a40 */  54,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3a50 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3a60 */  78, 76, 89, 10, 32, 57, 49, 32, 99,116,111,107, 51, 50, 46, 50,
-/* 0x3a70 */  48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 48, 32, 32,
-/* 0x3a80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3a90 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 98, 32, 32, 50, 42,
-/* 0x3aa0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3ab0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57,
-/* 0x3ac0 */  50, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 32, 32, 32, 32,
-/* 0x3ad0 */  48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3ae0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3af0 */  48, 48, 49, 57, 57, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3b00 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3b10 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 51, 32, 99,116,111,107,
-/* 0x3b20 */  51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3b30 */  48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3b40 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 97, 53,
-/* 0x3b50 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3b60 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3b70 */  89, 10, 32, 57, 52, 32, 80, 69, 73, 77, 80, 79, 82, 84, 32, 32,
-/* 0x3b80 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 99, 32, 32, 48, 48,
-/* 0x3b90 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ba0 */  32, 32, 48, 48, 48, 48, 49, 57, 97, 97, 32, 32, 50, 42, 42, 48,
-/* 0x3bb0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3bc0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 53, 32,
-/* 0x3bd0 */  80, 69, 73, 66, 89, 79, 82, 68, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3be0 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bf0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3c00 */  49, 57,100, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3c10 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3c20 */  68, 79, 78, 76, 89, 10, 32, 57, 54, 32, 80, 69, 75, 51, 50, 79,
-/* 0x3c30 */  82, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x3c40 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3c50 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 56, 32, 32,
-/* 0x3c60 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3c70 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3c80 */  32, 57, 55, 32, 80, 69, 73, 77, 79, 82, 68, 49, 32, 32, 32, 32,
-/* 0x3c90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48,
-/* 0x3ca0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3cb0 */  48, 48, 48, 48, 49, 57,101, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3cc0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3cd0 */  76, 89, 10, 32, 57, 56, 32, 80, 69, 73, 77, 80, 79, 82, 50, 32,
-/* 0x3ce0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48,
-/* 0x3cf0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d00 */  48, 32, 32, 48, 48, 48, 48, 49, 57,101,102, 32, 32, 50, 42, 42,
-/* 0x3d10 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3d20 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 57,
-/* 0x3d30 */  32, 80, 69, 73, 69, 82, 68, 76, 76, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3d40 */  48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d50 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3d60 */  48, 49, 97, 48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3d70 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3d80 */  49, 48, 48, 32, 80, 69, 73, 69, 82, 69, 88, 69, 32, 32, 32, 32,
-/* 0x3d90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x3da0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3db0 */  48, 48, 48, 48, 49, 97, 48, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3dc0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3dd0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 49, 32, 80, 69,
-/* 0x3de0 */  73, 77, 68, 79, 78, 69, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3df0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3e00 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x3e10 */  49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3e20 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 50,
-/* 0x3e30 */  32, 80, 69, 82, 69, 76, 79, 67, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3e40 */  48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e50 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3e60 */  48, 49, 97, 49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3e70 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3e80 */  65, 68, 79, 78, 76, 89, 10, 49, 48, 51, 32, 80, 69, 82, 69, 76,
-/* 0x3e90 */  79, 67, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ea0 */  51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3eb0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 55, 32,
-/* 0x3ec0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3ed0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 52, 32, 80, 69,
-/* 0x3ee0 */  82, 69, 76, 79, 67, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3ef0 */  48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3f00 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x3f10 */  49, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3f20 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 53,
-/* 0x3f30 */  32, 82, 69, 76, 79, 67, 51, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3f40 */  48, 48, 48, 48, 48, 50, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3f60 */  48, 49, 97, 49,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3f70 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3f80 */  65, 68, 79, 78, 76, 89, 10, 49, 48, 54, 32, 82, 69, 76, 51, 50,
-/* 0x3f90 */  66, 73, 71, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fa0 */  57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3fb0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 52, 54, 32,
-/* 0x3fc0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3fd0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3fe0 */  10, 49, 48, 55, 32, 82, 69, 76, 79, 67, 51, 50, 74, 32, 32, 32,
-/* 0x3ff0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x4000 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4010 */  32, 48, 48, 48, 48, 49, 97, 52,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4020 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x4030 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 56, 32, 82,
-/* 0x4040 */  69, 76, 51, 50, 69, 78, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4050 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4060 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x4070 */  97, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4080 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48,
-/* 0x4090 */  57, 32, 80, 69, 82, 76, 79, 72, 73, 48, 32, 32, 32, 32, 32, 32,
-/* 0x40a0 */  48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x40b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x40c0 */  48, 48, 49, 97, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x40d0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x40e0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 48, 32, 80, 69, 82, 69,
-/* 0x40f0 */  76, 76, 79, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4100 */  48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4110 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 53, 57,
-/* 0x4120 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4130 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 49, 32, 80,
-/* 0x4140 */  69, 82, 69, 76, 72, 73, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4150 */  48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4160 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x4170 */  97, 54, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4180 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49,
-/* 0x4190 */  50, 32, 80, 69, 68, 69, 80, 72, 65, 75, 32, 32, 32, 32, 32, 32,
-/* 0x41a0 */  48, 48, 48, 48, 48, 48, 50,102, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x41b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x41c0 */  48, 48, 49, 97, 55, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x41d0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x41e0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 51, 32, 80, 69, 84, 76,
-/* 0x41f0 */  83, 67, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4200 */  49, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4210 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 57,102,
-/* 0x4220 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4230 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4240 */  89, 10, 49, 49, 52, 32, 80, 69, 77, 65, 73, 78, 50, 48, 32, 32,
-/* 0x4250 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48,
-/* 0x4260 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4270 */  32, 32, 48, 48, 48, 48, 49, 97, 98, 55, 32, 32, 50, 42, 42, 48,
-/* 0x4280 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x4290 */  79, 78, 76, 89, 10, 49, 49, 53, 32, 67, 76, 69, 65, 82, 83, 84,
-/* 0x42a0 */  65, 67, 75, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32,
-/* 0x42b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x42c0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 98, 56, 32, 32, 50,
-/* 0x42d0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x42e0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 54, 32, 80, 69, 77, 65,
-/* 0x42f0 */  73, 78, 50, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4300 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4310 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 99, 53,
-/* 0x4320 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4330 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 55, 32, 80,
-/* 0x4340 */  69, 82, 69, 84, 85, 82, 78, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4350 */  48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4360 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x4370 */  97, 99, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x4380 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49,
-/* 0x4390 */  56, 32, 80, 69, 68, 79, 74, 85, 77, 80, 32, 32, 32, 32, 32, 32,
-/* 0x43a0 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x43b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x43c0 */  48, 48, 49, 97, 99, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x43d0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x43e0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 57, 32, 80, 69, 84, 76,
-/* 0x43f0 */  83, 67, 50, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4400 */  49,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4410 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,100, 48,
-/* 0x4420 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4430 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4440 */  89, 10, 49, 50, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 32,
-/* 0x4450 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 48, 32, 32, 48, 48,
-/* 0x4460 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4470 */  32, 32, 48, 48, 48, 48, 49, 97,101,102, 32, 32, 50, 42, 42, 48,
-/* 0x4480 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x4490 */  79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76,
-/* 0x44a0 */  69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x44b0 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48,  9, 48, 48, 48,
-/* 0x44c0 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48,
-/* 0x44d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x44e0 */  78, 50, 66, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44f0 */  48, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x4500 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x4510 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4520 */  66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4530 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,
-/* 0x4540 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x4550 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4560 */  32,100, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x4570 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48,
-/* 0x4580 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4590 */  78, 50, 66, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x45a0 */  48, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x45b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x45c0 */  65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x45d0 */  66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x45e0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48,
-/* 0x45f0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x4600 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4610 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48,  9, 48, 48, 48,
-/* 0x4620 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 48,
-/* 0x4630 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4640 */  78, 50, 68, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4650 */  48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x4660 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68,
-/* 0x4670 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4680 */  68, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4690 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48,
-/* 0x46a0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x46b0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x46c0 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x46d0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48,
-/* 0x46e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x46f0 */  78, 50, 68, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4700 */  48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4710 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x4720 */  65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4730 */  68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4740 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,
-/* 0x4750 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x4760 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4770 */  32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48,  9, 48, 48, 48,
-/* 0x4780 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48,
-/* 0x4790 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x47a0 */  78, 50, 69, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x47b0 */  48, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x47c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x47d0 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x47e0 */  69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x47f0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x4800 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x4810 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4820 */  32,100, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x4830 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48,
-/* 0x4840 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4850 */  78, 50, 69, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4860 */  48, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4870 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x4880 */  65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4890 */  69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x48a0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,
-/* 0x48b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x48c0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x48d0 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48,  9, 48, 48, 48,
-/* 0x48e0 */  48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48,
-/* 0x48f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4900 */  67, 65, 76, 76, 84, 82, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4910 */  48, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4920 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x4930 */  84, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65,
-/* 0x4940 */  76, 76, 84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4950 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x4960 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4970 */  49, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4980 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,  9, 48, 48,
-/* 0x4990 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x49a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x49b0 */  32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9, 48, 48, 48, 48,
-/* 0x49c0 */  48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48,
-/* 0x49d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x49e0 */  99,116,111,107, 51, 50, 46, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x49f0 */  48, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48, 48,
-/* 0x4a00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,
-/* 0x4a10 */ 111,107, 51, 50, 46, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a20 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4a30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77,
-/* 0x4a40 */  80, 79, 82, 84,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x4a50 */  73, 77, 80, 79, 82, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a60 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77, 79, 82, 68, 49,
-/* 0x4a70 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 77, 79, 82,
-/* 0x4a80 */  68, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4a90 */  32,100, 32, 32, 80, 69, 73, 77, 80, 79, 82, 50,  9, 48, 48, 48,
-/* 0x4aa0 */  48, 48, 48, 48, 48, 32, 80, 69, 73, 77, 80, 79, 82, 50, 10, 48,
-/* 0x4ab0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4ac0 */  80, 69, 73, 77, 68, 79, 78, 69,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ad0 */  48, 32, 80, 69, 73, 77, 68, 79, 78, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4ae0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 79,
-/* 0x4af0 */  67, 51, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69,
-/* 0x4b00 */  76, 79, 67, 51, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4b10 */ 108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 79, 67, 51, 50, 74,
-/* 0x4b20 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69, 76, 79, 67, 51,
-/* 0x4b30 */  50, 74, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4b40 */  32,100, 32, 32, 80, 69, 77, 65, 73, 78, 50, 49,  9, 48, 48, 48,
-/* 0x4b50 */  48, 48, 48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 50, 49, 10, 48,
-/* 0x4b60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4b70 */  80, 69, 84, 76, 83, 67, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b80 */  32, 80, 69, 84, 76, 83, 67, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 83, 68, 76,
-/* 0x4ba0 */  76, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 83,
-/* 0x4bb0 */  68, 76, 76, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4bc0 */  32, 32, 32,100, 32, 32, 80, 69, 77, 65, 73, 78, 48, 49,  9, 48,
-/* 0x4bd0 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 48, 49,
-/* 0x4be0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4bf0 */  32, 32, 80, 69, 73, 67, 79, 78, 83, 49,  9, 48, 48, 48, 48, 48,
-/* 0x4c00 */  48, 48, 48, 32, 80, 69, 73, 67, 79, 78, 83, 49, 10, 48, 48, 48,
-/* 0x4c10 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x4c20 */  73, 67, 79, 78, 83, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4c30 */  80, 69, 73, 67, 79, 78, 83, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c40 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 84, 76, 83, 72,
-/* 0x4c50 */  65, 75,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 84, 76,
-/* 0x4c60 */  83, 72, 65, 75, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4c70 */  32, 32, 32,100, 32, 32, 80, 69, 77, 65, 73, 78, 48, 50,  9, 48,
-/* 0x4c80 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 48, 50,
-/* 0x4c90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4ca0 */  32, 32, 80, 69, 77, 65, 73, 78, 48, 51,  9, 48, 48, 48, 48, 48,
-/* 0x4cb0 */  48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 48, 51, 10, 48, 48, 48,
-/* 0x4cc0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4cd0 */  66, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ce0 */  78, 50, 66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4cf0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4d00 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x4d10 */  77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4d20 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48,  9, 48,
-/* 0x4d30 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48,
-/* 0x4d40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4d50 */  32, 32, 78, 50, 66, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4d60 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48,
-/* 0x4d70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4d80 */  66, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4d90 */  78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4da0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4db0 */  52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x4dc0 */  77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4dd0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48,  9, 48,
-/* 0x4de0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x4df0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4e00 */  32, 32, 78, 50, 66, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4e10 */  48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48,
-/* 0x4e20 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4e30 */  66, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4e40 */  78, 50, 66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e50 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4e60 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83,
-/* 0x4e70 */  77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4e80 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48,  9, 48,
-/* 0x4e90 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48,
-/* 0x4ea0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4eb0 */  32, 32, 78, 50, 68, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4ec0 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48,
-/* 0x4ed0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4ee0 */  68, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ef0 */  78, 50, 68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4f10 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x4f20 */  65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4f30 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48,  9, 48,
-/* 0x4f40 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48,
-/* 0x4f50 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4f60 */  32, 32, 78, 50, 68, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x4f70 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48,
-/* 0x4f80 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4f90 */  68, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4fa0 */  78, 50, 68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4fb0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4fc0 */  52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x4fd0 */  65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4fe0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48,  9, 48,
-/* 0x4ff0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48,
-/* 0x5000 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5010 */  32, 32, 78, 50, 68, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5020 */  48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48,
-/* 0x5030 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5040 */  68, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5050 */  78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5060 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x5070 */  54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70,
-/* 0x5080 */  65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5090 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48,  9, 48,
-/* 0x50a0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48,
-/* 0x50b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x50c0 */  32, 32, 78, 50, 69, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x50d0 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48,
-/* 0x50e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x50f0 */  69, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5100 */  78, 50, 69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5110 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x5120 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x5130 */  77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5140 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48,  9, 48,
-/* 0x5150 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x5160 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5170 */  32, 32, 78, 50, 69, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5180 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48,
-/* 0x5190 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x51a0 */  69, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x51b0 */  78, 50, 69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x51c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x51d0 */  53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83,
-/* 0x51e0 */  77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x51f0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48,  9, 48,
-/* 0x5200 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48,
-/* 0x5210 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5220 */  32, 32, 78, 50, 69, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5230 */  48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48,
-/* 0x5240 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x5250 */  69, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5260 */  78, 50, 69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5270 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5280 */  69, 67, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x5290 */  77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x52b0 */  76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x52c0 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x52e0 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x52f0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5300 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5310 */  69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x5320 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5330 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5340 */  69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x5350 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5360 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77, 65, 73, 78,
-/* 0x5370 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 77, 65,
-/* 0x5380 */  73, 78, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5390 */  32, 32, 32,100, 32, 32, 80, 69, 67, 84, 84, 80, 79, 83,  9, 48,
-/* 0x53a0 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 67, 84, 84, 80, 79, 83,
-/* 0x53b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x53c0 */  32, 32, 80, 69, 67, 84, 84, 78, 85, 76,  9, 48, 48, 48, 48, 48,
-/* 0x53d0 */  48, 48, 48, 32, 80, 69, 67, 84, 84, 78, 85, 76, 10, 48, 48, 48,
-/* 0x53e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x53f0 */  67, 76, 69, 86, 69, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5400 */  67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5410 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5420 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x5430 */  84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5440 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49,  9, 48,
-/* 0x5450 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49,
-/* 0x5460 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5470 */  32, 32, 67, 84, 66, 82, 79, 82, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x5480 */  48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48,
-/* 0x5490 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x54a0 */  66, 83, 87, 65, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x54b0 */  67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x54c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x54d0 */  48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x54e0 */  84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x54f0 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 56,  9, 48,
-/* 0x5500 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56,
-/* 0x5510 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5520 */  32, 32, 67, 65, 76, 76, 84, 82, 69, 57,  9, 48, 48, 48, 48, 48,
-/* 0x5530 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48,
-/* 0x5540 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x5550 */  67, 76, 69, 86, 69, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5560 */  67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5570 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5580 */  49, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x5590 */  84, 82, 49, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x55a0 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 49, 49,  9, 48,
-/* 0x55b0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49,
-/* 0x55c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x55d0 */  32, 32, 67, 84, 66, 82, 79, 82, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x55e0 */  48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48,
-/* 0x55f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x5600 */  66, 83, 87, 65, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5610 */  67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5620 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50,
-/* 0x5630 */  46, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,
-/* 0x5640 */ 107, 51, 50, 46, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5650 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 66, 89, 79, 82, 68,
-/* 0x5660 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 66, 89, 79,
-/* 0x5670 */  82, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5680 */  32,100, 32, 32, 80, 69, 75, 51, 50, 79, 82, 68,  9, 48, 48, 48,
-/* 0x5690 */  48, 48, 48, 48, 48, 32, 80, 69, 75, 51, 50, 79, 82, 68, 10, 48,
-/* 0x56a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x56b0 */  80, 69, 73, 69, 82, 68, 76, 76,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x56c0 */  48, 32, 80, 69, 73, 69, 82, 68, 76, 76, 10, 48, 48, 48, 48, 48,
-/* 0x56d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 69,
-/* 0x56e0 */  82, 69, 88, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x56f0 */  73, 69, 82, 69, 88, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5700 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69, 76, 79, 67, 49,
-/* 0x5710 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 82, 69, 76, 79,
-/* 0x5720 */  67, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5730 */  32,100, 32, 32, 80, 69, 82, 69, 76, 79, 67, 50,  9, 48, 48, 48,
-/* 0x5740 */  48, 48, 48, 48, 48, 32, 80, 69, 82, 69, 76, 79, 67, 50, 10, 48,
-/* 0x5750 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5760 */  80, 69, 82, 69, 76, 79, 67, 51,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5770 */  48, 32, 80, 69, 82, 69, 76, 79, 67, 51, 10, 48, 48, 48, 48, 48,
-/* 0x5780 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 51,
-/* 0x5790 */  50, 66, 73, 71,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69,
-/* 0x57a0 */  76, 51, 50, 66, 73, 71, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x57b0 */ 108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 51, 50, 69, 78, 68,
-/* 0x57c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69, 76, 51, 50, 69,
-/* 0x57d0 */  78, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x57e0 */  32,100, 32, 32, 80, 69, 82, 76, 79, 72, 73, 48,  9, 48, 48, 48,
-/* 0x57f0 */  48, 48, 48, 48, 48, 32, 80, 69, 82, 76, 79, 72, 73, 48, 10, 48,
-/* 0x5800 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5810 */  80, 69, 82, 69, 76, 76, 79, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5820 */  48, 32, 80, 69, 82, 69, 76, 76, 79, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5830 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69,
-/* 0x5840 */  76, 72, 73, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x5850 */  82, 69, 76, 72, 73, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5860 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 68, 69, 80, 72, 65, 75,
-/* 0x5870 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 68, 69, 80, 72,
-/* 0x5880 */  65, 75, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5890 */  32,100, 32, 32, 80, 69, 84, 76, 83, 67,  9, 48, 48, 48, 48, 48,
-/* 0x58a0 */  48, 48, 48, 32, 80, 69, 84, 76, 83, 67, 10, 48, 48, 48, 48, 48,
-/* 0x58b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77, 65,
-/* 0x58c0 */  73, 78, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x58d0 */  77, 65, 73, 78, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x58e0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 76, 69, 65, 82, 83, 84, 65,
-/* 0x58f0 */  67, 75,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 69, 65,
-/* 0x5900 */  82, 83, 84, 65, 67, 75, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5910 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69, 84, 85, 82, 78,
-/* 0x5920 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 82, 69, 84, 85,
-/* 0x5930 */  82, 78, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5940 */  32,100, 32, 32, 80, 69, 68, 79, 74, 85, 77, 80,  9, 48, 48, 48,
-/* 0x5950 */  48, 48, 48, 48, 48, 32, 80, 69, 68, 79, 74, 85, 77, 80, 10, 48,
-/* 0x5960 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5970 */  85, 80, 88, 49, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5980 */  48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48,
-/* 0x5990 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x59a0 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116, 97,114,116,
-/* 0x59b0 */  95,111,102, 95, 99,111,109,112,114,101,115,115,101,100, 10, 48,
-/* 0x59c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59d0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,
-/* 0x59e0 */ 116, 97,114,116, 95,111,102, 95,117,110, 99,111,109,112,114,101,
-/* 0x59f0 */ 115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x5a00 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x5a10 */  48, 48, 48, 48, 32,105, 99,111,110, 95,111,102,102,115,101,116,
-/* 0x5a20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a30 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5a40 */  32,105, 99,111,110, 95,100,101,108,116, 97, 10, 48, 48, 48, 48,
-/* 0x5a50 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x5a60 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,116,108,115, 95,
-/* 0x5a70 */  97,100,100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5a80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x5a90 */  48, 48, 48, 48, 48, 48, 48, 32,116,108,115, 95,118, 97,108,117,
-/* 0x5aa0 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x5ab0 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5ac0 */  48, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,
-/* 0x5ad0 */ 117,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x5ae0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x5af0 */  48, 48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48,
-/* 0x5b00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b10 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5b20 */ 122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5b30 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x5b40 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,
-/* 0x5b50 */ 114,111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5b60 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x5b70 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114,
-/* 0x5b80 */  95, 98,117,102,102,101,114, 95,115,116, 97,114,116, 10, 48, 48,
-/* 0x5b90 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x5ba0 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,
-/* 0x5bb0 */ 108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x5bc0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x5bd0 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,
-/* 0x5be0 */ 101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5bf0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x5c00 */  48, 48, 48, 48, 48, 48, 32, 99,111,109,112,114,101,115,115,101,
-/* 0x5c10 */ 100, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5c20 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x5c30 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116, 97,114,116, 95,
-/* 0x5c40 */ 111,102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48,
-/* 0x5c50 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x5c60 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,111, 97,100, 76,
-/* 0x5c70 */ 105, 98,114, 97,114,121, 65, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5c80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x5c90 */  48, 48, 48, 48, 48, 48, 48, 32,107,101,114,110,101,108, 51, 50,
-/* 0x5ca0 */  95,111,114,100,105,110, 97,108,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5cb0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x5cc0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 71,101,116, 80,114,111,
-/* 0x5cd0 */  99, 65,100,100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5ce0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x5cf0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 69,120,105,116, 80,114,111,
-/* 0x5d00 */  99,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x5d10 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x5d20 */  48, 48, 48, 48, 32,115,116, 97,114,116, 95,111,102, 95,114,101,
-/* 0x5d30 */ 108,111, 99,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x5d40 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x5d50 */  48, 48, 48, 48, 32,114,101,108,111, 99, 95,100,101,108,116, 10,
-/* 0x5d60 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d70 */  32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5d80 */  86,105,114,116,117, 97,108, 80,114,111,116,101, 99,116, 10, 48,
-/* 0x5d90 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5da0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,118,
-/* 0x5db0 */ 112, 95, 98, 97,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5dc0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x5dd0 */  48, 48, 48, 48, 48, 48, 32,118,112, 95,115,105,122,101, 10, 48,
-/* 0x5de0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5df0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,
-/* 0x5e00 */ 119,114,105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x5e10 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x5e20 */  48, 48, 48, 32,116,108,115, 95,109,111,100,117,108,101, 95, 98,
-/* 0x5e30 */  97,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x5e40 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x5e50 */  48, 48, 48, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,
-/* 0x5e60 */ 114,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x5e70 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5e80 */  48, 48, 32,116,108,115, 95, 99, 97,108,108, 98, 97, 99,107,115,
-/* 0x5e90 */  95,112,116,114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5ea0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69,
-/* 0x5eb0 */  73, 83, 68, 76, 76, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5ec0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ed0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5ee0 */  48, 55, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x5ef0 */  32, 32, 32, 32, 32, 80, 69, 77, 65, 73, 78, 50, 49, 10, 10, 82,
-/* 0x5f00 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5f10 */  83, 32, 70, 79, 82, 32, 91, 80, 69, 77, 65, 73, 78, 48, 49, 93,
-/* 0x5f20 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5f30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5f40 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56,
-/* 0x5f50 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,115,116,
-/* 0x5f60 */  97,114,116, 95,111,102, 95, 99,111,109,112,114,101,115,115,101,
-/* 0x5f70 */ 100, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54,
-/* 0x5f80 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,115,116, 97,
-/* 0x5f90 */ 114,116, 95,111,102, 95,117,110, 99,111,109,112,114,101,115,115,
-/* 0x5fa0 */ 101,100, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5fb0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 67,
-/* 0x5fc0 */  79, 78, 83, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5fd0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fe0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x5ff0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6000 */  32, 32, 32,105, 99,111,110, 95,111,102,102,115,101,116, 10, 10,
-/* 0x6010 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6020 */  68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 67, 79, 78, 83, 50,
-/* 0x6030 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6050 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x6060 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,105,
-/* 0x6070 */  99,111,110, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48, 48,
-/* 0x6080 */  48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32,
-/* 0x6090 */  32, 32, 32, 32, 32, 32,105, 99,111,110, 95,100,101,108,116, 97,
-/* 0x60a0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x60b0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 84, 76, 83, 72,
-/* 0x60c0 */  65, 75, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x60d0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x60e0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x60f0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6100 */  32,116,108,115, 95, 97,100,100,114,101,115,115, 10, 48, 48, 48,
-/* 0x6110 */  48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x6120 */  32, 32, 32, 32, 32, 32, 32, 32,116,108,115, 95,118, 97,108,117,
-/* 0x6130 */ 101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6140 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77,
-/* 0x6150 */  65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6160 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6170 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x6180 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6190 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x61a0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x61b0 */  79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 49, 48, 93, 58, 10, 79,
-/* 0x61c0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x61d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x61e0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x61f0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x6200 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6210 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x6220 */  83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6230 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6240 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6250 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6260 */  32, 32, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 10, 82, 69,
-/* 0x6270 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6280 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 50, 48, 93, 58,
-/* 0x6290 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x62a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x62b0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x62c0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x62d0 */  70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x62e0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x62f0 */  50, 66, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6300 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6310 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6320 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6330 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10,
-/* 0x6340 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6350 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 51, 48,
-/* 0x6360 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6370 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6380 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x6390 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x63a0 */  50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x63b0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x63c0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76,
-/* 0x63d0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x63e0 */  70, 79, 82, 32, 91, 78, 50, 66, 68, 69, 67, 51, 48, 93, 58, 10,
-/* 0x63f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6400 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6410 */  10, 48, 48, 48, 48, 48, 48, 49, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6420 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x6430 */  69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 50,102, 32, 82, 95,
-/* 0x6440 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6450 */  78, 50, 66, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6460 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6470 */  32, 91, 78, 50, 66, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6480 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6490 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x64a0 */  48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x64b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51,
-/* 0x64c0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x64d0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65,
-/* 0x64e0 */  83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x64f0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6500 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x6510 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6520 */  32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6530 */  48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6540 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10,
-/* 0x6550 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6560 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 54, 48,
-/* 0x6570 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6590 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x65a0 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x65b0 */  50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x65c0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x65d0 */  91, 78, 50, 66, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x65e0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65f0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6600 */  48, 48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6610 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49,
-/* 0x6620 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6630 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x6640 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6650 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6660 */  66, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6670 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6680 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6690 */  49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x66a0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x66b0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x66c0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 49, 48, 93,
-/* 0x66d0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x66e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x66f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x6700 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x6710 */  68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6720 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6730 */  78, 50, 68, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6740 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6750 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6760 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6770 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10,
-/* 0x6780 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6790 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 50,
-/* 0x67a0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x67b0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x67c0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x67d0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x67e0 */  78, 50, 68, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x67f0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6800 */  32, 91, 78, 50, 68, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6810 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6820 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6830 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6840 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 49,
-/* 0x6850 */  49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6860 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77,
-/* 0x6870 */  65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6880 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6890 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32,
-/* 0x68a0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68b0 */  32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x68c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x68d0 */  79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 51, 48, 93, 58, 10, 79,
-/* 0x68e0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x68f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6900 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6910 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x6920 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51,
-/* 0x6930 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6940 */  50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6950 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6960 */  91, 78, 50, 68, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6970 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6980 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6990 */  48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x69a0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48,
-/* 0x69b0 */  10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x69c0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x69d0 */  69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 52, 51, 32, 82, 95,
-/* 0x69e0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x69f0 */  78, 50, 68, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6a00 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6a10 */  32, 91, 78, 50, 68, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6a20 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6a30 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6a40 */  48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x6a60 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6a70 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65,
-/* 0x6a80 */  83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6a90 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6aa0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x6ab0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ac0 */  32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6ad0 */  48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6ae0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10,
-/* 0x6af0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6b00 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 54, 48,
-/* 0x6b10 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6b20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6b30 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x6b40 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6b50 */  50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6b60 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6b70 */  91, 78, 50, 68, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6b80 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6b90 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6ba0 */  48, 48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6bb0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49,
-/* 0x6bc0 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6bd0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x6be0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6bf0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6c00 */  68, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6c10 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c20 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6c30 */  49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x6c40 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x6c50 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6c60 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 49, 48, 93,
-/* 0x6c70 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6c80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6c90 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x6ca0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x6cb0 */  69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6cc0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6cd0 */  78, 50, 69, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6ce0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6cf0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6d00 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6d10 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10,
-/* 0x6d20 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6d30 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 50,
-/* 0x6d40 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6d50 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6d60 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x6d70 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d80 */  78, 50, 69, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6d90 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6da0 */  32, 91, 78, 50, 69, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6db0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6dc0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6dd0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6de0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 49,
-/* 0x6df0 */  49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6e00 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77,
-/* 0x6e10 */  65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6e20 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e30 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32,
-/* 0x6e40 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e50 */  32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6e60 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6e70 */  79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 51, 48, 93, 58, 10, 79,
-/* 0x6e80 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6e90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6ea0 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6eb0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x6ec0 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51,
-/* 0x6ed0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6ee0 */  50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6ef0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6f00 */  91, 78, 50, 69, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6f10 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f20 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6f30 */  48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6f40 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x6f50 */  10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6f60 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x6f70 */  69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95,
-/* 0x6f80 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f90 */  78, 50, 69, 68, 69, 67, 54, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6fa0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6fb0 */  32, 91, 78, 50, 69, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6fc0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6fe0 */  48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x7000 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7010 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65,
-/* 0x7020 */  83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7030 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7040 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x7050 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7060 */  32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x7070 */  48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7080 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10,
-/* 0x7090 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x70a0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 54, 48,
-/* 0x70b0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x70c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x70d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x70e0 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x70f0 */  50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x7100 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x7110 */  91, 78, 50, 69, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x7120 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7130 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x7140 */  48, 48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x7150 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49,
-/* 0x7160 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7170 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x7180 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7190 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x71a0 */  69, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x71b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x71c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x71d0 */  49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x71e0 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x71f0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7200 */  83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48,
-/* 0x7210 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7220 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7230 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95,
-/* 0x7240 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7250 */ 108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,
-/* 0x7260 */ 116, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54,
-/* 0x7270 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x7280 */  97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,101,
-/* 0x7290 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72a0 */  32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48,
-/* 0x72b0 */  48, 48, 48, 48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x72c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,
-/* 0x72d0 */ 111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x72e0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x72f0 */  32, 91, 80, 69, 67, 84, 84, 80, 79, 83, 93, 58, 10, 79, 70, 70,
-/* 0x7300 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7310 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7320 */  48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x7330 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x7340 */  98,117,102,102,101,114, 95,115,116, 97,114,116, 10, 10, 82, 69,
-/* 0x7350 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7360 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93, 58,
-/* 0x7370 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7380 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7390 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x73a0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,
-/* 0x73b0 */ 116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79,
-/* 0x73c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x73d0 */  79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10, 79,
-/* 0x73e0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x73f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7400 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56,
-/* 0x7410 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x7420 */ 114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x7430 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7440 */  32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7450 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7460 */  82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79, 70,
-/* 0x7470 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7480 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7490 */  48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x74a0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x74b0 */  48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x74c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x74d0 */  84, 82, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x74e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x7500 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7510 */  32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104,
-/* 0x7520 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x7530 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x7540 */  49, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7550 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7560 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x7570 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7580 */  32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7590 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x75a0 */  82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79, 70,
-/* 0x75b0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x75c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x75d0 */  48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32,
-/* 0x75e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0x75f0 */  95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x7600 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7610 */  67, 65, 76, 76, 84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7620 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7630 */  32, 91, 67, 65, 76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70, 70,
-/* 0x7640 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7650 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7660 */  48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7670 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x7680 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7690 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51,
-/* 0x76a0 */  50, 46, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x76b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x76d0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76e0 */  32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104,
-/* 0x76f0 */  10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7700 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x7710 */  51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7720 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x7730 */ 116,111,107, 51, 50, 46, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7740 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7750 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7760 */  48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7770 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x7780 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x7790 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50,
-/* 0x77a0 */  46, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x77b0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x77c0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x77d0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x77e0 */  32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48,
-/* 0x77f0 */  48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7800 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x7810 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7820 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,
-/* 0x7830 */ 101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32,
-/* 0x7840 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7850 */  32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 10, 82, 69, 76,
-/* 0x7860 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7870 */  70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 51, 48, 93, 58,
-/* 0x7880 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7890 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x78a0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x78b0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,
-/* 0x78c0 */ 107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x78d0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x78e0 */  32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 10, 82, 69, 76,
-/* 0x78f0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7900 */  70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 52, 48, 93, 58,
-/* 0x7910 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7920 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7930 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x7940 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,
-/* 0x7950 */ 107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7960 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7970 */  80, 69, 73, 77, 80, 79, 82, 84, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7980 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7990 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x79a0 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x79b0 */  32, 32, 32, 32, 32, 32, 32, 99,111,109,112,114,101,115,115,101,
-/* 0x79c0 */ 100, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x79d0 */  48, 98, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x79e0 */  32, 32, 32, 32, 32, 80, 69, 73, 77, 68, 79, 78, 69, 10, 48, 48,
-/* 0x79f0 */  48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x7a00 */  32, 32, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,
-/* 0x7a10 */ 102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7a20 */  49,101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x7a30 */  32, 32, 32, 32, 32, 76,111, 97,100, 76,105, 98,114, 97,114,121,
-/* 0x7a40 */  65, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7a50 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 66, 89,
-/* 0x7a60 */  79, 82, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7a70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7a80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x7a90 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7aa0 */  32, 32, 80, 69, 73, 77, 79, 82, 68, 49, 10, 10, 82, 69, 76, 79,
-/* 0x7ab0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7ac0 */  79, 82, 32, 91, 80, 69, 75, 51, 50, 79, 82, 68, 93, 58, 10, 79,
-/* 0x7ad0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7ae0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7af0 */  48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x7b00 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,107,101,114,110,101,
-/* 0x7b10 */ 108, 51, 50, 95,111,114,100,105,110, 97,108,115, 10, 48, 48, 48,
-/* 0x7b20 */  48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x7b30 */  32, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 80, 79, 82, 50,
-/* 0x7b40 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x7b50 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 77, 80, 79,
-/* 0x7b60 */  82, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7b70 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7b80 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82,
-/* 0x7b90 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7ba0 */  32, 71,101,116, 80,114,111, 99, 65,100,100,114,101,115,115, 10,
-/* 0x7bb0 */  48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7bc0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 80,
-/* 0x7bd0 */  79, 82, 84, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x7be0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73,
-/* 0x7bf0 */  69, 82, 69, 88, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7c00 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7c10 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7c20 */  50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x7c30 */  32, 32, 32, 32, 69,120,105,116, 80,114,111, 99,101,115,115, 10,
-/* 0x7c40 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7c50 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 82, 69, 76, 79, 67,
-/* 0x7c60 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7c70 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7c80 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95,
-/* 0x7c90 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7ca0 */ 115,116, 97,114,116, 95,111,102, 95,114,101,108,111, 99,115, 10,
-/* 0x7cb0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7cc0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 51, 50,
-/* 0x7cd0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7ce0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7cf0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x7d00 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7d10 */  82, 69, 76, 79, 67, 51, 50, 74, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7d20 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7d30 */  32, 91, 82, 69, 76, 51, 50, 66, 73, 71, 93, 58, 10, 79, 70, 70,
-/* 0x7d40 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7d50 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7d60 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7d70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67, 51, 50,
-/* 0x7d80 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7d90 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67,
-/* 0x7da0 */  51, 50, 74, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7db0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7dc0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x7dd0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7de0 */  32, 32, 82, 69, 76, 79, 67, 51, 50, 48, 10, 10, 82, 69, 76, 79,
-/* 0x7df0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7e00 */  79, 82, 32, 91, 80, 69, 82, 76, 79, 72, 73, 48, 93, 58, 10, 79,
-/* 0x7e10 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7e20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7e30 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x7e40 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,114,101,108,111, 99,
-/* 0x7e50 */  95,100,101,108,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7e60 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80,
-/* 0x7e70 */  69, 68, 69, 80, 72, 65, 75, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7e80 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7e90 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7ea0 */  48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x7eb0 */  32, 32, 32, 32, 32, 32, 86,105,114,116,117, 97,108, 80,114,111,
-/* 0x7ec0 */ 116,101, 99,116, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x7ed0 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7ee0 */ 118,112, 95, 98, 97,115,101, 10, 48, 48, 48, 48, 48, 48, 48,100,
-/* 0x7ef0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7f00 */  32, 32, 32,118,112, 95,115,105,122,101, 10, 48, 48, 48, 48, 48,
-/* 0x7f10 */  48, 49, 98, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x7f20 */  32, 32, 32, 32, 32, 32,115,119,114,105, 10, 10, 82, 69, 76, 79,
-/* 0x7f30 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7f40 */  79, 82, 32, 91, 80, 69, 84, 76, 83, 67, 93, 58, 10, 79, 70, 70,
-/* 0x7f50 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7f60 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7f70 */  48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x7f80 */  32, 32, 32, 32, 32, 32, 32, 32, 32,116,108,115, 95,109,111,100,
-/* 0x7f90 */ 117,108,101, 95, 98, 97,115,101, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7fa0 */  56, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x7fb0 */  32, 32, 32, 32, 80, 69, 84, 76, 83, 67, 50, 10, 10, 82, 69, 76,
-/* 0x7fc0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7fd0 */  70, 79, 82, 32, 91, 80, 69, 68, 79, 74, 85, 77, 80, 93, 58, 10,
-/* 0x7fe0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x8000 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x8010 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,
-/* 0x8020 */ 105,110, 97,108, 95,101,110,116,114,121, 10, 10, 82, 69, 76, 79,
-/* 0x8030 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8040 */  79, 82, 32, 91, 80, 69, 84, 76, 83, 67, 50, 93, 58, 10, 79, 70,
-/* 0x8050 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8060 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8070 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x8080 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,116,108,115, 95, 99, 97,
-/* 0x8090 */ 108,108, 98, 97, 99,107,115, 95,112,116,114, 10
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,121,
+/* 0x1b10 */   0,  0,  0,149,  0,  0,  0,105,  0,  0,  0,200, 26,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0, 52,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  9,
+/* 0x1b30 */   0,  0,  0, 63,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 18,
+/* 0x1b40 */   0,  0,  0, 75,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 27,
+/* 0x1b50 */   0,  0,  0, 82,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 36,
+/* 0x1b60 */   0,  0,  0, 91,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 45,
+/* 0x1b70 */   0,  0,  0,101,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 54,
+/* 0x1b80 */   0,  0,  0,102,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x1b90 */   0,  0,  0,105,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 72,
+/* 0x1ba0 */   0,  0,  0,108,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 81,
+/* 0x1bb0 */   0,  0,  0,110,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 90,
+/* 0x1bc0 */   0,  0,  0,116,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 99,
+/* 0x1bd0 */   0,  0,  0,127,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,108,
+/* 0x1be0 */   0,  0,  0,132,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,117,
+/* 0x1bf0 */   0,  0,  0,139,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,126,
+/* 0x1c00 */   0,  0,  0,152,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,135,
+/* 0x1c10 */   0,  0,  0,165,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,144,
+/* 0x1c20 */   0,  0,  0,180,  0,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,153,
+/* 0x1c30 */   0,  0,  0,242,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,162,
+/* 0x1c40 */   0,  0,  0,255,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,171,
+/* 0x1c50 */   0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,180,
+/* 0x1c60 */   0,  0,  0, 16,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,189,
+/* 0x1c70 */   0,  0,  0, 19,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,198,
+/* 0x1c80 */   0,  0,  0, 28,  1,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,207,
+/* 0x1c90 */   0,  0,  0, 42,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,216,
+/* 0x1ca0 */   0,  0,  0, 64,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,225,
+/* 0x1cb0 */   0,  0,  0, 86,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,234,
+/* 0x1cc0 */   0,  0,  0, 86,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,243,
+/* 0x1cd0 */   0,  0,  0, 89,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,252,
+/* 0x1ce0 */   0,  0,  0, 91,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  5,
+/* 0x1cf0 */   1,  0,  0, 97,  1,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 14,
+/* 0x1d00 */   1,  0,  0,108,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 23,
+/* 0x1d10 */   1,  0,  0,113,  1,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 32,
+/* 0x1d20 */   1,  0,  0,120,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 41,
+/* 0x1d30 */   1,  0,  0,133,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 50,
+/* 0x1d40 */   1,  0,  0,146,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 59,
+/* 0x1d50 */   1,  0,  0,161,  1,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 68,
+/* 0x1d60 */   1,  0,  0,243,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 77,
+/* 0x1d70 */   1,  0,  0,  0,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 86,
+/* 0x1d80 */   1,  0,  0, 15,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 95,
+/* 0x1d90 */   1,  0,  0, 17,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,104,
+/* 0x1da0 */   1,  0,  0, 20,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,113,
+/* 0x1db0 */   1,  0,  0, 29,  2,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,122,
+/* 0x1dc0 */   1,  0,  0, 43,  2,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,131,
+/* 0x1dd0 */   1,  0,  0, 65,  2,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,140,
+/* 0x1de0 */   1,  0,  0, 87,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,
+/* 0x1df0 */   1,  0,  0, 87,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,158,
+/* 0x1e00 */   1,  0,  0, 90,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,167,
+/* 0x1e10 */   1,  0,  0, 92,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,176,
+/* 0x1e20 */   1,  0,  0, 98,  2,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,185,
+/* 0x1e30 */   1,  0,  0,109,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,194,
+/* 0x1e40 */   1,  0,  0,114,  2,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,203,
+/* 0x1e50 */   1,  0,  0,121,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,212,
+/* 0x1e60 */   1,  0,  0,134,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,221,
+/* 0x1e70 */   1,  0,  0,147,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,230,
+/* 0x1e80 */   1,  0,  0,162,  2,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,239,
+/* 0x1e90 */   1,  0,  0,  1,  3,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,248,
+/* 0x1ea0 */   1,  0,  0, 14,  3,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  1,
+/* 0x1eb0 */   2,  0,  0, 29,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 10,
+/* 0x1ec0 */   2,  0,  0, 31,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 19,
+/* 0x1ed0 */   2,  0,  0, 34,  3,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 28,
+/* 0x1ee0 */   2,  0,  0, 43,  3,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0, 37,
+/* 0x1ef0 */   2,  0,  0, 57,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 46,
+/* 0x1f00 */   2,  0,  0, 79,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 55,
+/* 0x1f10 */   2,  0,  0,101,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,
+/* 0x1f20 */   2,  0,  0,101,  3,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0, 75,
+/* 0x1f30 */   2,  0,  0,147,  3,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 86,
+/* 0x1f40 */   2,  0,  0,219,  3,  0,  0,134, 10,  0,  0,  0,  0,  0,  0, 97,
+/* 0x1f50 */   2,  0,  0, 97, 14,  0,  0,134, 10,  0,  0,  0,  0,  0,  0,108,
+/* 0x1f60 */   2,  0,  0,231, 24,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,119,
+/* 0x1f70 */   2,  0,  0,  1, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,128,
+/* 0x1f80 */   2,  0,  0,  2, 25,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,137,
+/* 0x1f90 */   2,  0,  0,  8, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,146,
+/* 0x1fa0 */   2,  0,  0, 10, 25,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,155,
+/* 0x1fb0 */   2,  0,  0, 24, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,164,
+/* 0x1fc0 */   2,  0,  0, 29, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,173,
+/* 0x1fd0 */   2,  0,  0, 34, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,182,
+/* 0x1fe0 */   2,  0,  0, 38, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,191,
+/* 0x1ff0 */   2,  0,  0, 40, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,200,
+/* 0x2000 */   2,  0,  0, 45, 25,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,209,
+/* 0x2010 */   2,  0,  0, 61, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,218,
+/* 0x2020 */   2,  0,  0, 66, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,227,
+/* 0x2030 */   2,  0,  0, 68, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,236,
+/* 0x2040 */   2,  0,  0, 70, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,245,
+/* 0x2050 */   2,  0,  0, 74, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,254,
+/* 0x2060 */   2,  0,  0, 79, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  7,
+/* 0x2070 */   3,  0,  0, 81, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 16,
+/* 0x2080 */   3,  0,  0, 85, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 25,
+/* 0x2090 */   3,  0,  0, 87, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 34,
+/* 0x20a0 */   3,  0,  0, 92, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 43,
+/* 0x20b0 */   3,  0,  0, 99, 25,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 53,
+/* 0x20c0 */   3,  0,  0,109, 25,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x20d0 */   3,  0,  0,123, 25,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 73,
+/* 0x20e0 */   3,  0,  0,155, 25,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 83,
+/* 0x20f0 */   3,  0,  0,165, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 93,
+/* 0x2100 */   3,  0,  0,170, 25,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,102,
+/* 0x2110 */   3,  0,  0,214, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,111,
+/* 0x2120 */   3,  0,  0,216, 25,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,120,
+/* 0x2130 */   3,  0,  0,232, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,129,
+/* 0x2140 */   3,  0,  0,239, 25,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,138,
+/* 0x2150 */   3,  0,  0,  5, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,147,
+/* 0x2160 */   3,  0,  0, 11, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,156,
+/* 0x2170 */   3,  0,  0, 17, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,
+/* 0x2180 */   3,  0,  0, 17, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,174,
+/* 0x2190 */   3,  0,  0, 23, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,183,
+/* 0x21a0 */   3,  0,  0, 26, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,192,
+/* 0x21b0 */   3,  0,  0, 29, 26,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,201,
+/* 0x21c0 */   3,  0,  0, 70, 26,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,210,
+/* 0x21d0 */   3,  0,  0, 79, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,219,
+/* 0x21e0 */   3,  0,  0, 81, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,228,
+/* 0x21f0 */   3,  0,  0, 81, 26,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,237,
+/* 0x2200 */   3,  0,  0, 89, 26,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,246,
+/* 0x2210 */   3,  0,  0, 99, 26,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,255,
+/* 0x2220 */   3,  0,  0,112, 26,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  8,
+/* 0x2230 */   4,  0,  0,159, 26,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0, 15,
+/* 0x2240 */   4,  0,  0,183, 26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 24,
+/* 0x2250 */   4,  0,  0,184, 26,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 35,
+/* 0x2260 */   4,  0,  0,197, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,
+/* 0x2270 */   4,  0,  0,197, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 53,
+/* 0x2280 */   4,  0,  0,203, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 62,
+/* 0x2290 */   4,  0,  0,208, 26,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x22a0 */   4,  0,  0,239, 26,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x22b0 */   0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,
+/* 0x22c0 */   0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,
+/* 0x22d0 */   0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,117,
+/* 0x22e0 */   0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,144,
+/* 0x22f0 */   0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,
+/* 0x2300 */   0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,216,
+/* 0x2310 */   0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,225,
+/* 0x2320 */   0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,234,
+/* 0x2330 */   0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,252,
+/* 0x2340 */   0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,
+/* 0x2350 */   1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,
+/* 0x2360 */   1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,
+/* 0x2370 */   1,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,
+/* 0x2380 */   1,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,
+/* 0x2390 */   1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,
+/* 0x23a0 */   1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,
+/* 0x23b0 */   1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,
+/* 0x23c0 */   1,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,
+/* 0x23d0 */   1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,203,
+/* 0x23e0 */   1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,230,
+/* 0x23f0 */   1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,
+/* 0x2400 */   2,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,
+/* 0x2410 */   2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,
+/* 0x2420 */   2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,
+/* 0x2430 */   2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,209,
+/* 0x2440 */   2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,236,
+/* 0x2450 */   2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,
+/* 0x2460 */   3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,
+/* 0x2470 */   3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,
+/* 0x2480 */   3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x2490 */   3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,
+/* 0x24a0 */   3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,
+/* 0x24b0 */   3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,120,
+/* 0x24c0 */   3,  0,  0, 97,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,129,
+/* 0x24d0 */   3,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,156,
+/* 0x24e0 */   3,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,
+/* 0x24f0 */   3,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,210,
+/* 0x2500 */   3,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,
+/* 0x2510 */   4,  0,  0,116,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62,
+/* 0x2520 */   4,  0,  0,119,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,
+/* 0x2540 */   0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,
+/* 0x2550 */   0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,
+/* 0x2560 */   0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,
+/* 0x2570 */   0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,
+/* 0x2580 */   0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,
+/* 0x2590 */   0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,
+/* 0x25a0 */   0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,
+/* 0x25b0 */   0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,
+/* 0x25c0 */   0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,126,
+/* 0x25d0 */   0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,
+/* 0x25e0 */   0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,
+/* 0x25f0 */   0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162,
+/* 0x2600 */   0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,171,
+/* 0x2610 */   0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,
+/* 0x2620 */   0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,198,
+/* 0x2630 */   0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,207,
+/* 0x2640 */   0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,243,
+/* 0x2650 */   0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,
+/* 0x2660 */   1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,
+/* 0x2670 */   1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,
+/* 0x2680 */   1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,
+/* 0x2690 */   1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,
+/* 0x26a0 */   1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77,
+/* 0x26b0 */   1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,
+/* 0x26c0 */   1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,
+/* 0x26d0 */   1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,113,
+/* 0x26e0 */   1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,122,
+/* 0x26f0 */   1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,158,
+/* 0x2700 */   1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,185,
+/* 0x2710 */   1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,194,
+/* 0x2720 */   1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,212,
+/* 0x2730 */   1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,
+/* 0x2740 */   1,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,239,
+/* 0x2750 */   1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,
+/* 0x2760 */   1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+/* 0x2770 */   2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,
+/* 0x2780 */   2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,
+/* 0x2790 */   2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,
+/* 0x27a0 */   2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,
+/* 0x27b0 */   2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,
+/* 0x27c0 */   2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,
+/* 0x27d0 */   2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 97,
+/* 0x27e0 */   2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,
+/* 0x27f0 */   2,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,119,
+/* 0x2800 */   2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,
+/* 0x2810 */   2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,137,
+/* 0x2820 */   2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,155,
+/* 0x2830 */   2,  0,  0, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,164,
+/* 0x2840 */   2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,173,
+/* 0x2850 */   2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,182,
+/* 0x2860 */   2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,191,
+/* 0x2870 */   2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,200,
+/* 0x2880 */   2,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,218,
+/* 0x2890 */   2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,227,
+/* 0x28a0 */   2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,245,
+/* 0x28b0 */   2,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,254,
+/* 0x28c0 */   2,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,
+/* 0x28d0 */   3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,
+/* 0x28e0 */   3,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,
+/* 0x28f0 */   3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73,
+/* 0x2900 */   3,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,
+/* 0x2910 */   3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,111,
+/* 0x2920 */   3,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,138,
+/* 0x2930 */   3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,147,
+/* 0x2940 */   3,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,
+/* 0x2950 */   3,  0,  0,102,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,174,
+/* 0x2960 */   3,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,183,
+/* 0x2970 */   3,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,201,
+/* 0x2980 */   3,  0,  0,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,219,
+/* 0x2990 */   3,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,228,
+/* 0x29a0 */   3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,237,
+/* 0x29b0 */   3,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,246,
+/* 0x29c0 */   3,  0,  0,111,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,
+/* 0x29d0 */   3,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,
+/* 0x29e0 */   4,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,
+/* 0x29f0 */   4,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,
+/* 0x2a00 */   4,  0,  0,115,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,
+/* 0x2a10 */   4,  0,  0,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,
+/* 0x2a20 */   4,  0,  0,118,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x2a30 */   4,  0,  0,120,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 79,
+/* 0x2a40 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 99,
+/* 0x2a50 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,121,
+/* 0x2a60 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,133,
+/* 0x2a70 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,144,
+/* 0x2a80 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,156,
+/* 0x2a90 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,166,
+/* 0x2aa0 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,184,
+/* 0x2ab0 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,195,
+/* 0x2ac0 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,206,
+/* 0x2ad0 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,222,
+/* 0x2ae0 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,242,
+/* 0x2af0 */   4,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,
+/* 0x2b00 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 11,
+/* 0x2b10 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 30,
+/* 0x2b20 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 47,
+/* 0x2b30 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 60,
+/* 0x2b40 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 78,
+/* 0x2b50 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 93,
+/* 0x2b60 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,105,
+/* 0x2b70 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,121,
+/* 0x2b80 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,132,
+/* 0x2b90 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,147,
+/* 0x2ba0 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,155,
+/* 0x2bb0 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,163,
+/* 0x2bc0 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,168,
+/* 0x2bd0 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,184,
+/* 0x2be0 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,199,
+/* 0x2bf0 */   5,  0,  0,122,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  7,  0,  0,  0,217,  5,  0,  0, 38,  0,  0,  0,  0,
+/* 0x2c10 */   0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,228,
+/* 0x2c20 */   5,  0,  0,121,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+/* 0x2c30 */   0,  0,  0,  8,  0,  0,  0,228,  5,  0,  0,122,  0,  0,  0,  0,
+/* 0x2c40 */   0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  3,  0,  0,  0,228,
+/* 0x2c50 */   5,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
+/* 0x2c60 */   0,  0,  0,  3,  0,  0,  0,228,  5,  0,  0,123,  0,  0,  0,  0,
+/* 0x2c70 */   0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  7,  0,  0,  0,237,
+/* 0x2c80 */   5,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
+/* 0x2c90 */   0,  0,  0,  2,  0,  0,  0,228,  5,  0,  0,125,  0,  0,  0,  0,
+/* 0x2ca0 */   0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  6,  0,  0,  0,228,
+/* 0x2cb0 */   5,  0,  0,126,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,
+/* 0x2cc0 */   0,  0,  0,  1,  0,  0,  0,246,  5,  0,  0,  2,  0,  0,  0,  0,
+/* 0x2cd0 */   0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  1,  0,  0,  0,246,
+/* 0x2ce0 */   5,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,
+/* 0x2cf0 */   0,  0,  0,  1,  0,  0,  0,246,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d00 */   0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  1,  0,  0,  0,246,
+/* 0x2d10 */   5,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,
+/* 0x2d20 */   0,  0,  0, 12,  0,  0,  0,246,  5,  0,  0,  3,  0,  0,  0,  0,
+/* 0x2d30 */   0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  3,  0,  0,  0,246,
+/* 0x2d40 */   5,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,
+/* 0x2d50 */   0,  0,  0, 14,  0,  0,  0,246,  5,  0,  0,  3,  0,  0,  0,  0,
+/* 0x2d60 */   0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0, 17,  0,  0,  0,246,
+/* 0x2d70 */   5,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,
+/* 0x2d80 */   0,  0,  0, 47,  0,  0,  0,246,  5,  0,  0,  5,  0,  0,  0,  0,
+/* 0x2d90 */   0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0, 12,  0,  0,  0,246,
+/* 0x2da0 */   5,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,
+/* 0x2db0 */   0,  0,  0,  3,  0,  0,  0,246,  5,  0,  0,  4,  0,  0,  0,  0,
+/* 0x2dc0 */   0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 14,  0,  0,  0,246,
+/* 0x2dd0 */   5,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,
+/* 0x2de0 */   0,  0,  0, 10,  0,  0,  0,217,  5,  0,  0,  2,  0,  0,  0,  0,
+/* 0x2df0 */   0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,  7,  0,  0,  0,246,
+/* 0x2e00 */   5,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,
+/* 0x2e10 */   0,  0,  0, 18,  0,  0,  0,217,  5,  0,  0,  2,  0,  0,  0,  0,
+/* 0x2e20 */   0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0, 18,  0,  0,  0,217,
+/* 0x2e30 */   5,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,
+/* 0x2e40 */   0,  0,  0,  1,  0,  0,  0,246,  5,  0,  0, 10,  0,  0,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  1,  0,  0,  0,246,
+/* 0x2e60 */   5,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,
+/* 0x2e70 */   0,  0,  0,  1,  0,  0,  0,246,  5,  0,  0,  8,  0,  0,  0,  0,
+/* 0x2e80 */   0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  1,  0,  0,  0,246,
+/* 0x2e90 */   5,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,
+/* 0x2ea0 */   0,  0,  0, 12,  0,  0,  0,246,  5,  0,  0, 12,  0,  0,  0,  0,
+/* 0x2eb0 */   0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0,  5,  0,  0,  0,246,
+/* 0x2ec0 */   5,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,
+/* 0x2ed0 */   0,  0,  0, 14,  0,  0,  0,246,  5,  0,  0, 12,  0,  0,  0,  0,
+/* 0x2ee0 */   0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 15,  0,  0,  0,246,
+/* 0x2ef0 */   5,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,
+/* 0x2f00 */   0,  0,  0, 33,  0,  0,  0,246,  5,  0,  0, 15,  0,  0,  0,  0,
+/* 0x2f10 */   0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 67,  0,  0,  0,246,
+/* 0x2f20 */   5,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,
+/* 0x2f30 */   0,  0,  0, 12,  0,  0,  0,246,  5,  0,  0, 12,  0,  0,  0,  0,
+/* 0x2f40 */   0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  3,  0,  0,  0,246,
+/* 0x2f50 */   5,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,
+/* 0x2f60 */   0,  0,  0, 14,  0,  0,  0,246,  5,  0,  0, 12,  0,  0,  0,  0,
+/* 0x2f70 */   0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0, 10,  0,  0,  0,217,
+/* 0x2f80 */   5,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,
+/* 0x2f90 */   0,  0,  0,  7,  0,  0,  0,246,  5,  0,  0, 14,  0,  0,  0,  0,
+/* 0x2fa0 */   0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0, 18,  0,  0,  0,217,
+/* 0x2fb0 */   5,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,
+/* 0x2fc0 */   0,  0,  0, 18,  0,  0,  0,217,  5,  0,  0, 10,  0,  0,  0,  0,
+/* 0x2fd0 */   0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  1,  0,  0,  0,246,
+/* 0x2fe0 */   5,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,
+/* 0x2ff0 */   0,  0,  0,  1,  0,  0,  0,246,  5,  0,  0, 18,  0,  0,  0,  0,
+/* 0x3000 */   0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  1,  0,  0,  0,246,
+/* 0x3010 */   5,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,
+/* 0x3020 */   0,  0,  0,  1,  0,  0,  0,246,  5,  0,  0, 17,  0,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 12,  0,  0,  0,246,
+/* 0x3040 */   5,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,
+/* 0x3050 */   0,  0,  0,  5,  0,  0,  0,246,  5,  0,  0, 20,  0,  0,  0,  0,
+/* 0x3060 */   0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0, 14,  0,  0,  0,246,
+/* 0x3070 */   5,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,
+/* 0x3080 */   0,  0,  0, 15,  0,  0,  0,246,  5,  0,  0, 19,  0,  0,  0,  0,
+/* 0x3090 */   0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0, 30,  0,  0,  0,246,
+/* 0x30a0 */   5,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,
+/* 0x30b0 */   0,  0,  0, 48,  0,  0,  0,246,  5,  0,  0, 23,  0,  0,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0, 12,  0,  0,  0,246,
+/* 0x30d0 */   5,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,
+/* 0x30e0 */   0,  0,  0,  3,  0,  0,  0,246,  5,  0,  0, 20,  0,  0,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0, 14,  0,  0,  0,246,
+/* 0x3100 */   5,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,
+/* 0x3110 */   0,  0,  0, 10,  0,  0,  0,217,  5,  0,  0, 18,  0,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0,  7,  0,  0,  0,246,
+/* 0x3130 */   5,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,
+/* 0x3140 */   0,  0,  0, 18,  0,  0,  0,217,  5,  0,  0, 18,  0,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0,  0,  0,  0, 62,  0,  0,  0, 18,  0,  0,  0,217,
+/* 0x3160 */   5,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,
+/* 0x3170 */   0,  0,  0,  5,  0,  0,  0,228,  5,  0,  0,127,  0,  0,  0,  0,
+/* 0x3180 */   0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 20,  0,  0,  0,228,
+/* 0x3190 */   5,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,
+/* 0x31a0 */   0,  0,  0, 30,  0,  0,  0,228,  5,  0,  0,129,  0,  0,  0,  0,
+/* 0x31b0 */   0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 42,  0,  0,  0,228,
+/* 0x31c0 */   5,  0,  0,130,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x31d0 */   0,  0,  0,  2,  0,  0,  0,228,  5,  0,  0,131,  0,  0,  0,  0,
+/* 0x31e0 */   0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  1,  0,  0,  0,228,
+/* 0x31f0 */   5,  0,  0,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73,
+/* 0x3200 */   0,  0,  0,  2,  0,  0,  0,  0,  6,  0,  0,133,  0,  0,  0,  0,
+/* 0x3210 */   0,  0,  0,  0,  0,  0,  0, 73,  0,  0,  0,  4,  0,  0,  0,246,
+/* 0x3220 */   5,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,
+/* 0x3230 */   0,  0,  0, 15,  0,  0,  0,246,  5,  0,  0, 24,  0,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,  1,  0,  0,  0,228,
+/* 0x3250 */   5,  0,  0,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,
+/* 0x3260 */   0,  0,  0,  3,  0,  0,  0,246,  5,  0,  0, 27,  0,  0,  0,  0,
+/* 0x3270 */   0,  0,  0,  0,  0,  0,  0, 83,  0,  0,  0,  2,  0,  0,  0,  0,
+/* 0x3280 */   6,  0,  0,133,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,
+/* 0x3290 */   0,  0,  0,  4,  0,  0,  0,246,  5,  0,  0, 26,  0,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0,  0,  0,  0, 88,  0,  0,  0,  6,  0,  0,  0,246,
+/* 0x32b0 */   5,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,
+/* 0x32c0 */   0,  0,  0,  1,  0,  0,  0,228,  5,  0,  0,132,  0,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  6,  0,  0,  0,246,
+/* 0x32e0 */   5,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,
+/* 0x32f0 */   0,  0,  0, 13,  0,  0,  0,246,  5,  0,  0, 30,  0,  0,  0,  0,
+/* 0x3300 */   0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  5,  0,  0,  0,246,
+/* 0x3310 */   5,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,
+/* 0x3320 */   0,  0,  0, 10,  0,  0,  0,246,  5,  0,  0, 31,  0,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0, 14,  0,  0,  0,  0,
+/* 0x3340 */   6,  0,  0,133,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,
+/* 0x3350 */   0,  0,  0, 16,  0,  0,  0,246,  5,  0,  0, 31,  0,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0,  0,  0,  0, 92,  0,  0,  0,  4,  0,  0,  0,246,
+/* 0x3370 */   5,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 92,
+/* 0x3380 */   0,  0,  0,  9,  0,  0,  0,246,  5,  0,  0, 29,  0,  0,  0,  0,
+/* 0x3390 */   0,  0,  0,  0,  0,  0,  0, 93,  0,  0,  0,  4,  0,  0,  0,246,
+/* 0x33a0 */   5,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 94,
+/* 0x33b0 */   0,  0,  0,  2,  0,  0,  0,228,  5,  0,  0,134,  0,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0,  0,  0,  0, 94,  0,  0,  0, 11,  0,  0,  0,246,
+/* 0x33d0 */   5,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 94,
+/* 0x33e0 */   0,  0,  0, 18,  0,  0,  0,228,  5,  0,  0,135,  0,  0,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0,  0,  0,  0, 94,  0,  0,  0, 30,  0,  0,  0,228,
+/* 0x3400 */   5,  0,  0,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,
+/* 0x3410 */   0,  0,  0,  1,  0,  0,  0,246,  5,  0,  0, 33,  0,  0,  0,  0,
+/* 0x3420 */   0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 10,  0,  0,  0,228,
+/* 0x3430 */   5,  0,  0,137,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,
+/* 0x3440 */   0,  0,  0, 15,  0,  0,  0,246,  5,  0,  0, 34,  0,  0,  0,  0,
+/* 0x3450 */   0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,  7,  0,  0,  0,228,
+/* 0x3460 */   5,  0,  0,138,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,
+/* 0x3470 */   0,  0,  0, 21,  0,  0,  0,246,  5,  0,  0, 32,  0,  0,  0,  0,
+/* 0x3480 */   0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0,  2,  0,  0,  0,228,
+/* 0x3490 */   5,  0,  0,139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,
+/* 0x34a0 */   0,  0,  0,  2,  0,  0,  0,228,  5,  0,  0,140,  0,  0,  0,  0,
+/* 0x34b0 */   0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,  8,  0,  0,  0,246,
+/* 0x34c0 */   5,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,106,
+/* 0x34d0 */   0,  0,  0,  3,  0,  0,  0,246,  5,  0,  0, 36,  0,  0,  0,  0,
+/* 0x34e0 */   0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0,  1,  0,  0,  0,246,
+/* 0x34f0 */   5,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,
+/* 0x3500 */   0,  0,  0,  4,  0,  0,  0,228,  5,  0,  0,141,  0,  0,  0,  0,
+/* 0x3510 */   0,  0,  0,  0,  0,  0,  0,112,  0,  0,  0,  2,  0,  0,  0,228,
+/* 0x3520 */   5,  0,  0,142,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,112,
+/* 0x3530 */   0,  0,  0,  8,  0,  0,  0,228,  5,  0,  0,143,  0,  0,  0,  0,
+/* 0x3540 */   0,  0,  0,  0,  0,  0,  0,112,  0,  0,  0, 13,  0,  0,  0,228,
+/* 0x3550 */   5,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,112,
+/* 0x3560 */   0,  0,  0, 27,  0,  0,  0,228,  5,  0,  0,145,  0,  0,  0,  0,
+/* 0x3570 */   0,  0,  0,  0,  0,  0,  0,113,  0,  0,  0,  2,  0,  0,  0,228,
+/* 0x3580 */   5,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,113,
+/* 0x3590 */   0,  0,  0,  8,  0,  0,  0,228,  5,  0,  0, 39,  0,  0,  0,  0,
+/* 0x35a0 */   0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0,  1,  0,  0,  0,217,
+/* 0x35b0 */   5,  0,  0,147,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,119,
+/* 0x35c0 */   0,  0,  0,  4,  0,  0,  0,228,  5,  0,  0,148,  0,  0,  0,  0,
+/* 0x35d0 */   0,  0,  0,  0,  0,  0,  0, 80, 69, 73, 83, 68, 76, 76, 49,  0,
+/* 0x35e0 */  80, 69, 77, 65, 73, 78, 48, 49,  0, 80, 69, 73, 67, 79, 78, 83,
+/* 0x35f0 */  49,  0, 80, 69, 73, 67, 79, 78, 83, 50,  0, 80, 69, 84, 76, 83,
+/* 0x3600 */  72, 65, 75,  0, 80, 69, 77, 65, 73, 78, 48, 50,  0, 80, 69, 77,
+/* 0x3610 */  65, 73, 78, 48, 51,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0, 78,
+/* 0x3620 */  50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 49,
+/* 0x3630 */   0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77, 65,
+/* 0x3640 */  50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66, 68,
+/* 0x3650 */  69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78, 50,
+/* 0x3660 */  66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,  0,
+/* 0x3670 */  78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83, 52,
+/* 0x3680 */  48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70, 65,
+/* 0x3690 */  83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50, 66,
+/* 0x36a0 */  83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0, 78,
+/* 0x36b0 */  50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54, 48,
+/* 0x36c0 */   0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x36d0 */  49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68, 68,
+/* 0x36e0 */  69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78, 50,
+/* 0x36f0 */  68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,  0,
+/* 0x3700 */  78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83, 51,
+/* 0x3710 */  48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83, 77,
+/* 0x3720 */  65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50, 68,
+/* 0x3730 */  83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0, 78,
+/* 0x3740 */  50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54, 48,
+/* 0x3750 */   0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x3760 */  54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69, 83,
+/* 0x3770 */  77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78, 50,
+/* 0x3780 */  69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,  0,
+/* 0x3790 */  78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83, 50,
+/* 0x37a0 */  48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83, 77,
+/* 0x37b0 */  65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50, 69,
+/* 0x37c0 */  68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0, 78,
+/* 0x37d0 */  50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53, 48,
+/* 0x37e0 */   0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69, 67,
+/* 0x37f0 */  53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69, 70,
+/* 0x3800 */  65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78, 50,
+/* 0x3810 */  69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 48,
+/* 0x3820 */  48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77,
+/* 0x3830 */  65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x3840 */  50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 80, 69,
+/* 0x3850 */  77, 65, 73, 78, 49, 48,  0, 80, 69, 67, 84, 84, 80, 79, 83,  0,
+/* 0x3860 */  80, 69, 67, 84, 84, 78, 85, 76,  0, 67, 65, 76, 76, 84, 82, 48,
+/* 0x3870 */  48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65, 76, 76, 84,
+/* 0x3880 */  82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0, 67, 84, 66,
+/* 0x3890 */  82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48, 49,  0, 67,
+/* 0x38a0 */  65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84, 82, 49, 48,
+/* 0x38b0 */   0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76, 76, 84, 82,
+/* 0x38c0 */  69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67, 84, 67, 76,
+/* 0x38d0 */  69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,  0, 67, 84,
+/* 0x38e0 */  66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82, 49, 49,  0,
+/* 0x38f0 */  67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76, 84, 82, 49,
+/* 0x3900 */  51,  0, 99,116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107,
+/* 0x3910 */  51, 50, 46, 49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0,
+/* 0x3920 */  99,116,111,107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50,
+/* 0x3930 */  46, 52, 48,  0, 80, 69, 73, 77, 80, 79, 82, 84,  0, 80, 69, 73,
+/* 0x3940 */  66, 89, 79, 82, 68,  0, 80, 69, 75, 51, 50, 79, 82, 68,  0, 80,
+/* 0x3950 */  69, 73, 77, 79, 82, 68, 49,  0, 80, 69, 73, 77, 80, 79, 82, 50,
+/* 0x3960 */   0, 80, 69, 73, 69, 82, 68, 76, 76,  0, 80, 69, 73, 69, 82, 69,
+/* 0x3970 */  88, 69,  0, 80, 69, 73, 77, 68, 79, 78, 69,  0, 80, 69, 82, 69,
+/* 0x3980 */  76, 79, 67, 49,  0, 80, 69, 82, 69, 76, 79, 67, 50,  0, 80, 69,
+/* 0x3990 */  82, 69, 76, 79, 67, 51,  0, 82, 69, 76, 79, 67, 51, 50, 48,  0,
+/* 0x39a0 */  82, 69, 76, 51, 50, 66, 73, 71,  0, 82, 69, 76, 79, 67, 51, 50,
+/* 0x39b0 */  74,  0, 82, 69, 76, 51, 50, 69, 78, 68,  0, 80, 69, 82, 76, 79,
+/* 0x39c0 */  72, 73, 48,  0, 80, 69, 82, 69, 76, 76, 79, 48,  0, 80, 69, 82,
+/* 0x39d0 */  69, 76, 72, 73, 48,  0, 80, 69, 68, 69, 80, 72, 65, 75,  0, 80,
+/* 0x39e0 */  69, 84, 76, 83, 67,  0, 80, 69, 77, 65, 73, 78, 50, 48,  0, 67,
+/* 0x39f0 */  76, 69, 65, 82, 83, 84, 65, 67, 75,  0, 80, 69, 77, 65, 73, 78,
+/* 0x3a00 */  50, 49,  0, 80, 69, 82, 69, 84, 85, 82, 78,  0, 80, 69, 68, 79,
+/* 0x3a10 */  74, 85, 77, 80,  0, 80, 69, 84, 76, 83, 67, 50,  0, 85, 80, 88,
+/* 0x3a20 */  49, 72, 69, 65, 68,  0,115,116, 97,114,116, 95,111,102, 95, 99,
+/* 0x3a30 */ 111,109,112,114,101,115,115,101,100,  0,115,116, 97,114,116, 95,
+/* 0x3a40 */ 111,102, 95,117,110, 99,111,109,112,114,101,115,115,101,100,  0,
+/* 0x3a50 */ 105, 99,111,110, 95,111,102,102,115,101,116,  0,105, 99,111,110,
+/* 0x3a60 */  95,100,101,108,116, 97,  0,116,108,115, 95, 97,100,100,114,101,
+/* 0x3a70 */ 115,115,  0,116,108,115, 95,118, 97,108,117,101,  0,108,122,109,
+/* 0x3a80 */  97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,
+/* 0x3a90 */ 122,109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99,
+/* 0x3aa0 */  95,108,101,110,  0,108,122,109, 97, 95,112,114,111,112,101,114,
+/* 0x3ab0 */ 116,105,101,115,  0,102,105,108,116,101,114, 95, 98,117,102,102,
+/* 0x3ac0 */ 101,114, 95,115,116, 97,114,116,  0,102,105,108,116,101,114, 95,
+/* 0x3ad0 */ 108,101,110,103,116,104,  0,102,105,108,116,101,114, 95, 99,116,
+/* 0x3ae0 */ 111,  0, 99,111,109,112,114,101,115,115,101,100, 95,105,109,112,
+/* 0x3af0 */ 111,114,116,115,  0,115,116, 97,114,116, 95,111,102, 95,105,109,
+/* 0x3b00 */ 112,111,114,116,115,  0, 76,111, 97,100, 76,105, 98,114, 97,114,
+/* 0x3b10 */ 121, 65,  0,107,101,114,110,101,108, 51, 50, 95,111,114,100,105,
+/* 0x3b20 */ 110, 97,108,115,  0, 71,101,116, 80,114,111, 99, 65,100,100,114,
+/* 0x3b30 */ 101,115,115,  0, 69,120,105,116, 80,114,111, 99,101,115,115,  0,
+/* 0x3b40 */ 115,116, 97,114,116, 95,111,102, 95,114,101,108,111, 99,115,  0,
+/* 0x3b50 */ 114,101,108,111, 99, 95,100,101,108,116,  0, 86,105,114,116,117,
+/* 0x3b60 */  97,108, 80,114,111,116,101, 99,116,  0,118,112, 95, 98, 97,115,
+/* 0x3b70 */ 101,  0,118,112, 95,115,105,122,101,  0,115,119,114,105,  0,116,
+/* 0x3b80 */ 108,115, 95,109,111,100,117,108,101, 95, 98, 97,115,101,  0,111,
+/* 0x3b90 */ 114,105,103,105,110, 97,108, 95,101,110,116,114,121,  0,116,108,
+/* 0x3ba0 */ 115, 95, 99, 97,108,108, 98, 97, 99,107,115, 95,112,116,114,  0,
+/* 0x3bb0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82, 95, 51, 56, 54,
+/* 0x3bc0 */  95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 49, 54,  0, 82, 95, 51,
+/* 0x3bd0 */  56, 54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 56,  0, 15,
+/* 0x3be0 */  27,  0,  0, 85, 80, 88, 76
 };
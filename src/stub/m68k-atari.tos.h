@@ -1,5 +1,5 @@
 /* m68k-atari.tos.h
-   created from m68k-atari.tos.bin, 19182 (0x4aee) bytes
+   created from m68k-atari.tos.bin, 10690 (0x29c2) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_M68K_ATARI_TOS_SIZE    19182
-#define STUB_M68K_ATARI_TOS_ADLER32 0x118f8afc
-#define STUB_M68K_ATARI_TOS_CRC32   0xda9011b2
+#define STUB_M68K_ATARI_TOS_SIZE    10690
+#define STUB_M68K_ATARI_TOS_ADLER32 0xddfe4942
+#define STUB_M68K_ATARI_TOS_CRC32   0x4b20ebc1
 
-unsigned char stub_m68k_atari_tos[19182] = {
+unsigned char stub_m68k_atari_tos[10690] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0,  4,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 26,152,  1,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -407,832 +407,302 @@ unsigned char stub_m68k_atari_tos[19182] = {
 /* 0x1700 */  67,233,  0,254, 96,242,124,  0, 60, 60,  0,  0, 44, 60,  0,  0,
 /* 0x1710 */   0,  0, 78,215, 65,239,  0,  4, 50, 24, 48, 24,192,216,194,208,
 /* 0x1720 */ 208, 65, 72, 64, 66, 64, 50, 47,  0,  6,194,208,208,129, 78,117,
-/* 0x1730 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1740 */  50, 45,109, 54, 56,107, 10, 10, 83,101, 99,116,105,111,110,115,
-/* 0x1750 */  58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32,
-/* 0x1760 */  32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77,
-/* 0x1770 */  65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1780 */  32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110,
-/* 0x1790 */  32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32,101,110,116,114,
-/* 0x17a0 */ 121, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x17b0 */  51, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x17c0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52,
-/* 0x17d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x17e0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x17f0 */  89, 10, 32, 32, 49, 32,115,101,116, 95,117,112, 50, 49, 95, 97,
-/* 0x1800 */  54, 46,119, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48,
-/* 0x1810 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1820 */  32, 32, 48, 48, 48, 48, 48, 48, 54, 97, 32, 32, 50, 42, 42, 48,
-/* 0x1830 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1840 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32,
-/* 0x1850 */ 115,101,116, 95,117,112, 50, 49, 95,100, 52, 46,119, 32, 48, 48,
-/* 0x1860 */  48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1870 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1880 */  48, 48, 54,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1890 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x18a0 */  68, 79, 78, 76, 89, 10, 32, 32, 51, 32,115,101,116, 95,117,112,
-/* 0x18b0 */  50, 49, 95,100, 52, 46,108, 32, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x18c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x18d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 52, 32, 32,
-/* 0x18e0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x18f0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1900 */  32, 32, 52, 32,108,111,111,112, 49, 95,115,101,116, 95, 99,111,
-/* 0x1910 */ 117,110,116, 46, 98, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x1920 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1930 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 99, 32, 32, 50, 42,
-/* 0x1940 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1950 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1960 */  53, 32,108,111,111,112, 49, 95,115,101,116, 95, 99,111,117,110,
-/* 0x1970 */ 116, 46,119, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1990 */  32, 32, 48, 48, 48, 48, 48, 48, 55,101, 32, 32, 50, 42, 42, 48,
-/* 0x19a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x19b0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32,
-/* 0x19c0 */ 108,111,111,112, 49, 95,115,101,116, 95, 99,111,117,110,116, 46,
-/* 0x19d0 */ 108, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1a00 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1a10 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32,108,111,
-/* 0x1a20 */ 111,112, 49, 95,108, 97, 98,101,108, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1a30 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1a40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1a60 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56,
-/* 0x1a70 */  32,108,111,111,112, 49, 46,102, 97,115,116, 32, 32, 32, 32, 48,
-/* 0x1a80 */  48, 48, 48, 48, 48, 50, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a90 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1aa0 */  48, 48, 48, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1ab0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1ac0 */  32, 32, 57, 32,108,111,111,112, 49, 46,115,109, 97,108,108, 32,
-/* 0x1ad0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 98, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1b00 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1b10 */  76, 89, 10, 32, 49, 48, 32,108,111,111,112, 49, 95,115,117, 98,
-/* 0x1b20 */ 113,108, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 98, 52, 32, 32, 50, 42, 42,
-/* 0x1b50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1b60 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49,
-/* 0x1b70 */  32,108,111,111,112, 49, 95,115,117, 98,113,119, 32, 32, 32, 48,
-/* 0x1b80 */  48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 98, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1bb0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1bc0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32,108,111,111,112, 49,
-/* 0x1bd0 */  95,100, 98,114, 97, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1be0 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 98, 99, 32,
-/* 0x1c00 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1c10 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1c20 */  10, 32, 49, 51, 32,108,111,111,112, 50, 46,102, 97,115,116, 32,
-/* 0x1c30 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c50 */  32, 48, 48, 48, 48, 48, 48, 99, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c60 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1c70 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 52, 32,108,
-/* 0x1c80 */ 111,111,112, 50, 46,115,109, 97,108,108, 32, 32, 32, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ca0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1cc0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1cd0 */  53, 32, 99,111,112,121, 95,116,111, 95,115,116, 97, 99,107, 32,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1d00 */  48, 48, 48, 48, 99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1d10 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1d20 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 54, 32,110,114,118, 50,
-/* 0x1d30 */  98, 46,105,110,105,116, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100,101,
-/* 0x1d60 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1d70 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 55, 32,110,
-/* 0x1d80 */ 114,118, 50,100, 46,105,110,105,116, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1da0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48,101, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1dc0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1dd0 */  56, 32,110,114,118, 50,101, 46,105,110,105,116, 32, 32, 32, 32,
-/* 0x1de0 */  48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1df0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1e00 */  48, 48, 48, 48,102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1e10 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1e20 */  10, 32, 49, 57, 32,106,109,112, 95,100,101, 99,111,109,112,114,
-/* 0x1e30 */ 101,115,115,111,114, 95, 97, 54, 46,119, 32, 48, 48, 48, 48, 48,
-/* 0x1e40 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,102,
-/* 0x1e60 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1e70 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1e80 */  76, 89, 10, 32, 50, 48, 32,106,109,112, 95,100,101, 99,111,109,
-/* 0x1e90 */ 112,114,101,115,115,111,114, 95,100, 52, 46,119, 32, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1eb0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  49, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1ed0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1ee0 */  79, 78, 76, 89, 10, 32, 50, 49, 32,106,109,112, 95,100,101, 99,
-/* 0x1ef0 */ 111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119, 50, 32,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1f20 */  48, 48, 48, 49, 48, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1f30 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1f40 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 50, 32,106,109,112, 95,
-/* 0x1f50 */ 100,101, 99,111,109,112,114,101,115,115,111,114, 95,100, 52, 46,
-/* 0x1f60 */ 108, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f80 */  48, 48, 48, 48, 48, 49, 48,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1fa0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 51, 32, 99,111,
-/* 0x1fb0 */ 100,101, 95,111,110, 95,115,116, 97, 99,107, 32, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1fe0 */  49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ff0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 52,
-/* 0x2000 */  32, 99,108,101, 97,114, 95,100,105,114,116,121, 95, 98,115,115,
-/* 0x2010 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2030 */  48, 48, 48, 48, 49, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2040 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2050 */  89, 10, 32, 50, 53, 32,108,111,111,112, 51, 95,108, 97, 98,101,
-/* 0x2060 */ 108, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2080 */  32, 32, 48, 48, 48, 48, 48, 49, 49, 56, 32, 32, 50, 42, 42, 48,
-/* 0x2090 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x20a0 */  79, 78, 76, 89, 10, 32, 50, 54, 32,108,111,111,112, 51, 46,115,
-/* 0x20b0 */ 109, 97,108,108, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x20c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x20d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 49, 56, 32, 32, 50,
-/* 0x20e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x20f0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55, 32,108,111,111,112,
-/* 0x2100 */  51, 46,102, 97,115,116, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2110 */  48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2120 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 49, 97,
-/* 0x2130 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2140 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 56, 32,108,
-/* 0x2150 */ 111,111,112, 51, 95,115,117, 98,113,108, 32, 32, 32, 48, 48, 48,
-/* 0x2160 */  48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2170 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2180 */  49, 50, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2190 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x21a0 */  79, 78, 76, 89, 10, 32, 50, 57, 32,108,111,111,112, 51, 95,115,
-/* 0x21b0 */ 117, 98,113,119, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x21c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 54, 32, 32, 50,
-/* 0x21e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x21f0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2200 */  51, 48, 32,108,111,111,112, 51, 95,100, 98,114, 97, 32, 32, 32,
-/* 0x2210 */  32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2220 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2230 */  48, 48, 48, 48, 49, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2240 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2250 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 49, 32,102,108,117,
-/* 0x2260 */ 115,104, 95, 99, 97, 99,104,101, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2270 */  48, 55, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50,
-/* 0x2290 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x22a0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 50, 32,
-/* 0x22b0 */ 114,101,115,116,111,114,101, 95,115,116, 97, 99,107, 32, 48, 48,
-/* 0x22c0 */  48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x22e0 */  48, 49, 97, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x22f0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2300 */  68, 79, 78, 76, 89, 10, 32, 51, 51, 32, 99,108,101, 97,114, 95,
-/* 0x2310 */ 100,105,114,116,121, 95,115,116, 97, 99,107, 32, 48, 48, 48, 48,
-/* 0x2320 */  48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2340 */  97, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2350 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2360 */  78, 76, 89, 10, 32, 51, 52, 32,115,116, 97,114,116, 95,112,114,
-/* 0x2370 */ 111,103,114, 97,109, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32,
-/* 0x2380 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 98, 54, 32, 32, 50, 42,
-/* 0x23a0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x23b0 */  65, 68, 79, 78, 76, 89, 10, 32, 51, 53, 32, 85, 80, 88, 49, 72,
-/* 0x23c0 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50,
-/* 0x23d0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x23e0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 99, 50, 32,
-/* 0x23f0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2400 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 54, 32, 67, 85,
-/* 0x2410 */  84, 80, 79, 73, 78, 84, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2420 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2440 */ 101, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2450 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 55,
-/* 0x2460 */  32,110,114,118, 50, 98, 95, 56, 46,102, 97,115,116, 32, 32, 48,
-/* 0x2470 */  48, 48, 48, 48, 48, 55, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2480 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2490 */  48, 48, 49,101, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x24a0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x24b0 */  32, 51, 56, 32,110,114,118, 50,100, 95, 56, 46,102, 97,115,116,
-/* 0x24c0 */  32, 32, 48, 48, 48, 48, 48, 48, 57, 48, 32, 32, 48, 48, 48, 48,
-/* 0x24d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x24e0 */  48, 48, 48, 48, 48, 50, 53,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x24f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2500 */  76, 89, 10, 32, 51, 57, 32,110,114,118, 50,101, 95, 56, 46,102,
-/* 0x2510 */  97,115,116, 32, 32, 48, 48, 48, 48, 48, 48, 57, 56, 32, 32, 48,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2530 */  48, 32, 32, 48, 48, 48, 48, 48, 50,101,101, 32, 32, 50, 42, 42,
-/* 0x2540 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2550 */  68, 79, 78, 76, 89, 10, 32, 52, 48, 32,110,114,118, 50, 98, 95,
-/* 0x2560 */  56, 46,115,109, 97,108,108, 32, 48, 48, 48, 48, 48, 48, 55, 54,
-/* 0x2570 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2580 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 56, 54, 32, 32,
-/* 0x2590 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x25a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49, 32,110,114,118,
-/* 0x25b0 */  50,100, 95, 56, 46,115,109, 97,108,108, 32, 48, 48, 48, 48, 48,
-/* 0x25c0 */  48, 56, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x25d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,102,
-/* 0x25e0 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x25f0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 50, 32,
-/* 0x2600 */ 110,114,118, 50,101, 95, 56, 46,115,109, 97,108,108, 32, 48, 48,
-/* 0x2610 */  48, 48, 48, 48, 57, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2620 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2630 */  48, 52, 56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2640 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2650 */  52, 51, 32,108,122,109, 97, 46,105,110,105,116, 32, 32, 32, 32,
-/* 0x2660 */  32, 48, 48, 48, 48, 48, 48, 50,101, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2670 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2680 */  48, 48, 48, 48, 53, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2690 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x26a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 52, 32,108,122,109,
-/* 0x26b0 */  97, 46,102, 97,115,116, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x26c0 */  56, 99, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x26d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 53, 52,
-/* 0x26e0 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x26f0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2700 */  76, 89, 10, 32, 52, 53, 32,108,122,109, 97, 46,115,109, 97,108,
-/* 0x2710 */ 108, 32, 32, 32, 32, 48, 48, 48, 48, 48, 56, 99, 97, 32, 32, 48,
-/* 0x2720 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2730 */  48, 32, 32, 48, 48, 48, 48, 48,101, 49, 48, 32, 32, 50, 42, 42,
-/* 0x2740 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2750 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 54,
-/* 0x2760 */  32,108,122,109, 97, 46,102,105,110,105,115,104, 32, 32, 32, 48,
-/* 0x2770 */  48, 48, 48, 48, 48, 49, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2780 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2790 */  48, 49, 54,100, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x27a0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x27b0 */  32, 52, 55, 32,114,101,108,111, 99, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27c0 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 97, 32, 32, 48, 48, 48, 48,
-/* 0x27d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x27e0 */  48, 48, 48, 48, 49, 54,101, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x27f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2800 */  76, 89, 10, 32, 52, 56, 32,108,111,111,112, 51, 95,115,101,116,
-/* 0x2810 */  95, 99,111,117,110,116, 46, 98, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2820 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2830 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 48, 54, 32,
-/* 0x2840 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2850 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2860 */  10, 32, 52, 57, 32,108,111,111,112, 51, 95,115,101,116, 95, 99,
-/* 0x2870 */ 111,117,110,116, 46,119, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x2880 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2890 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 48, 56, 32, 32, 50,
-/* 0x28a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x28b0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x28c0 */  53, 48, 32,108,111,111,112, 51, 95,115,101,116, 95, 99,111,117,
-/* 0x28d0 */ 110,116, 46,108, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x28e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28f0 */  48, 32, 32, 48, 48, 48, 48, 49, 55, 48, 99, 32, 32, 50, 42, 42,
-/* 0x2900 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2910 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 49,
-/* 0x2920 */  32,106,109,112, 95,115,116, 97, 99,107, 32, 32, 32, 32, 32, 48,
-/* 0x2930 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2940 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2950 */  48, 49, 55, 49, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2960 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2970 */  32, 53, 50, 32, 95, 95,109,117,108,115,105, 51, 32, 32, 32, 32,
-/* 0x2980 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 99, 32, 32, 48, 48, 48, 48,
-/* 0x2990 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x29a0 */  48, 48, 48, 48, 49, 55, 49, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x29b0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x29c0 */  76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x29d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x29e0 */  32, 32,108,111,111,112, 49, 95,108, 97, 98,101,108,  9, 48, 48,
-/* 0x29f0 */  48, 48, 48, 48, 48, 48, 32,108,111,111,112, 49, 95,108, 97, 98,
-/* 0x2a00 */ 101,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2a10 */  32,100, 32, 32,102,108,117,115,104, 95, 99, 97, 99,104,101,  9,
-/* 0x2a20 */  48, 48, 48, 48, 48, 48, 48, 48, 32,102,108,117,115,104, 95, 99,
-/* 0x2a30 */  97, 99,104,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2a40 */  32, 32, 32,100, 32, 32,108,111,111,112, 51, 95,108, 97, 98,101,
-/* 0x2a50 */ 108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,111,111,112, 51,
-/* 0x2a60 */  95,108, 97, 98,101,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2a70 */ 108, 32, 32, 32, 32,100, 32, 32, 95, 95,109,117,108,115,105, 51,
-/* 0x2a80 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95, 95,109,117,108,115,
-/* 0x2a90 */ 105, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2aa0 */  32,100, 32, 32,101,110,116,114,121,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2ab0 */  48, 48, 32,101,110,116,114,121, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ac0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,115,101,116, 95,117,112,
-/* 0x2ad0 */  50, 49, 95, 97, 54, 46,119,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ae0 */  32,115,101,116, 95,117,112, 50, 49, 95, 97, 54, 46,119, 10, 48,
-/* 0x2af0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2b00 */ 115,101,116, 95,117,112, 50, 49, 95,100, 52, 46,119,  9, 48, 48,
-/* 0x2b10 */  48, 48, 48, 48, 48, 48, 32,115,101,116, 95,117,112, 50, 49, 95,
-/* 0x2b20 */ 100, 52, 46,119, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2b30 */  32, 32, 32,100, 32, 32,115,101,116, 95,117,112, 50, 49, 95,100,
-/* 0x2b40 */  52, 46,108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,101,116,
-/* 0x2b50 */  95,117,112, 50, 49, 95,100, 52, 46,108, 10, 48, 48, 48, 48, 48,
-/* 0x2b60 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112,
-/* 0x2b70 */  49, 95,115,101,116, 95, 99,111,117,110,116, 46, 98,  9, 48, 48,
-/* 0x2b80 */  48, 48, 48, 48, 48, 48, 32,108,111,111,112, 49, 95,115,101,116,
-/* 0x2b90 */  95, 99,111,117,110,116, 46, 98, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ba0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 49, 95,
-/* 0x2bb0 */ 115,101,116, 95, 99,111,117,110,116, 46,119,  9, 48, 48, 48, 48,
-/* 0x2bc0 */  48, 48, 48, 48, 32,108,111,111,112, 49, 95,115,101,116, 95, 99,
-/* 0x2bd0 */ 111,117,110,116, 46,119, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2be0 */ 108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 49, 95,115,101,
-/* 0x2bf0 */ 116, 95, 99,111,117,110,116, 46,108,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2c00 */  48, 48, 32,108,111,111,112, 49, 95,115,101,116, 95, 99,111,117,
-/* 0x2c10 */ 110,116, 46,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2c20 */  32, 32, 32,100, 32, 32,108,111,111,112, 49, 46,102, 97,115,116,
-/* 0x2c30 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,111,111,112, 49, 46,
-/* 0x2c40 */ 102, 97,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2c50 */  32, 32, 32,100, 32, 32,108,111,111,112, 49, 46,115,109, 97,108,
-/* 0x2c60 */ 108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,111,111,112, 49,
-/* 0x2c70 */  46,115,109, 97,108,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2c80 */ 108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 49, 95,115,117,
-/* 0x2c90 */  98,113,108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,111,111,
-/* 0x2ca0 */ 112, 49, 95,115,117, 98,113,108, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cb0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 49, 95,
-/* 0x2cc0 */ 115,117, 98,113,119,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2cd0 */ 111,111,112, 49, 95,115,117, 98,113,119, 10, 48, 48, 48, 48, 48,
-/* 0x2ce0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112,
-/* 0x2cf0 */  49, 95,100, 98,114, 97,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d00 */ 108,111,111,112, 49, 95,100, 98,114, 97, 10, 48, 48, 48, 48, 48,
-/* 0x2d10 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112,
-/* 0x2d20 */  50, 46,102, 97,115,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d30 */ 108,111,111,112, 50, 46,102, 97,115,116, 10, 48, 48, 48, 48, 48,
-/* 0x2d40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112,
-/* 0x2d50 */  50, 46,115,109, 97,108,108,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d60 */  32,108,111,111,112, 50, 46,115,109, 97,108,108, 10, 48, 48, 48,
-/* 0x2d70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,111,
-/* 0x2d80 */ 112,121, 95,116,111, 95,115,116, 97, 99,107,  9, 48, 48, 48, 48,
-/* 0x2d90 */  48, 48, 48, 48, 32, 99,111,112,121, 95,116,111, 95,115,116, 97,
-/* 0x2da0 */  99,107, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2db0 */  32,100, 32, 32,110,114,118, 50, 98, 46,105,110,105,116,  9, 48,
-/* 0x2dc0 */  48, 48, 48, 48, 48, 48, 48, 32,110,114,118, 50, 98, 46,105,110,
-/* 0x2dd0 */ 105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2de0 */  32,100, 32, 32,110,114,118, 50,100, 46,105,110,105,116,  9, 48,
-/* 0x2df0 */  48, 48, 48, 48, 48, 48, 48, 32,110,114,118, 50,100, 46,105,110,
-/* 0x2e00 */ 105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2e10 */  32,100, 32, 32,110,114,118, 50,101, 46,105,110,105,116,  9, 48,
-/* 0x2e20 */  48, 48, 48, 48, 48, 48, 48, 32,110,114,118, 50,101, 46,105,110,
-/* 0x2e30 */ 105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2e40 */  32,100, 32, 32,106,109,112, 95,100,101, 99,111,109,112,114,101,
-/* 0x2e50 */ 115,115,111,114, 95, 97, 54, 46,119,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2e60 */  48, 48, 32,106,109,112, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x2e70 */ 115,111,114, 95, 97, 54, 46,119, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,106,109,112, 95,100,101,
-/* 0x2e90 */  99,111,109,112,114,101,115,115,111,114, 95,100, 52, 46,119,  9,
-/* 0x2ea0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,106,109,112, 95,100,101, 99,
-/* 0x2eb0 */ 111,109,112,114,101,115,115,111,114, 95,100, 52, 46,119, 10, 48,
-/* 0x2ec0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2ed0 */ 106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,114,
-/* 0x2ee0 */  95, 97, 54, 46,119, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2ef0 */ 106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,114,
-/* 0x2f00 */  95, 97, 54, 46,119, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2f10 */ 108, 32, 32, 32, 32,100, 32, 32,106,109,112, 95,100,101, 99,111,
-/* 0x2f20 */ 109,112,114,101,115,115,111,114, 95,100, 52, 46,108,  9, 48, 48,
-/* 0x2f30 */  48, 48, 48, 48, 48, 48, 32,106,109,112, 95,100,101, 99,111,109,
-/* 0x2f40 */ 112,114,101,115,115,111,114, 95,100, 52, 46,108, 10, 48, 48, 48,
-/* 0x2f50 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,111,
-/* 0x2f60 */ 100,101, 95,111,110, 95,115,116, 97, 99,107,  9, 48, 48, 48, 48,
-/* 0x2f70 */  48, 48, 48, 48, 32, 99,111,100,101, 95,111,110, 95,115,116, 97,
-/* 0x2f80 */  99,107, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2f90 */  32,100, 32, 32, 99,108,101, 97,114, 95,100,105,114,116,121, 95,
-/* 0x2fa0 */  98,115,115,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,108,101,
-/* 0x2fb0 */  97,114, 95,100,105,114,116,121, 95, 98,115,115, 10, 48, 48, 48,
-/* 0x2fc0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,
-/* 0x2fd0 */ 111,112, 51, 46,115,109, 97,108,108,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2fe0 */  48, 48, 32,108,111,111,112, 51, 46,115,109, 97,108,108, 10, 48,
-/* 0x2ff0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3000 */ 108,111,111,112, 51, 46,102, 97,115,116,  9, 48, 48, 48, 48, 48,
-/* 0x3010 */  48, 48, 48, 32,108,111,111,112, 51, 46,102, 97,115,116, 10, 48,
-/* 0x3020 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3030 */ 108,111,111,112, 51, 95,115,117, 98,113,108,  9, 48, 48, 48, 48,
-/* 0x3040 */  48, 48, 48, 48, 32,108,111,111,112, 51, 95,115,117, 98,113,108,
-/* 0x3050 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3060 */  32, 32,108,111,111,112, 51, 95,115,117, 98,113,119,  9, 48, 48,
-/* 0x3070 */  48, 48, 48, 48, 48, 48, 32,108,111,111,112, 51, 95,115,117, 98,
-/* 0x3080 */ 113,119, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3090 */  32,100, 32, 32,108,111,111,112, 51, 95,100, 98,114, 97,  9, 48,
-/* 0x30a0 */  48, 48, 48, 48, 48, 48, 48, 32,108,111,111,112, 51, 95,100, 98,
-/* 0x30b0 */ 114, 97, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x30c0 */  32,100, 32, 32,114,101,115,116,111,114,101, 95,115,116, 97, 99,
-/* 0x30d0 */ 107,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,114,101,115,116,111,
-/* 0x30e0 */ 114,101, 95,115,116, 97, 99,107, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,108,101, 97,114, 95,
-/* 0x3100 */ 100,105,114,116,121, 95,115,116, 97, 99,107,  9, 48, 48, 48, 48,
-/* 0x3110 */  48, 48, 48, 48, 32, 99,108,101, 97,114, 95,100,105,114,116,121,
-/* 0x3120 */  95,115,116, 97, 99,107, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3130 */ 108, 32, 32, 32, 32,100, 32, 32,115,116, 97,114,116, 95,112,114,
-/* 0x3140 */ 111,103,114, 97,109,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,
-/* 0x3150 */ 116, 97,114,116, 95,112,114,111,103,114, 97,109, 10, 48, 48, 48,
-/* 0x3160 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80,
-/* 0x3170 */  88, 49, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3180 */  85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3190 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 85, 84, 80, 79, 73,
-/* 0x31a0 */  78, 84,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 85, 84, 80,
-/* 0x31b0 */  79, 73, 78, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x31c0 */  32, 32, 32,100, 32, 32,110,114,118, 50, 98, 95, 56, 46,102, 97,
-/* 0x31d0 */ 115,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,114,118, 50,
-/* 0x31e0 */  98, 95, 56, 46,102, 97,115,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,100, 95,
-/* 0x3200 */  56, 46,102, 97,115,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3210 */ 110,114,118, 50,100, 95, 56, 46,102, 97,115,116, 10, 48, 48, 48,
-/* 0x3220 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,
-/* 0x3230 */ 118, 50,101, 95, 56, 46,102, 97,115,116,  9, 48, 48, 48, 48, 48,
-/* 0x3240 */  48, 48, 48, 32,110,114,118, 50,101, 95, 56, 46,102, 97,115,116,
-/* 0x3250 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3260 */  32, 32,110,114,118, 50, 98, 95, 56, 46,115,109, 97,108,108,  9,
-/* 0x3270 */  48, 48, 48, 48, 48, 48, 48, 48, 32,110,114,118, 50, 98, 95, 56,
-/* 0x3280 */  46,115,109, 97,108,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3290 */ 108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,100, 95, 56, 46,
-/* 0x32a0 */ 115,109, 97,108,108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,
-/* 0x32b0 */ 114,118, 50,100, 95, 56, 46,115,109, 97,108,108, 10, 48, 48, 48,
-/* 0x32c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,
-/* 0x32d0 */ 118, 50,101, 95, 56, 46,115,109, 97,108,108,  9, 48, 48, 48, 48,
-/* 0x32e0 */  48, 48, 48, 48, 32,110,114,118, 50,101, 95, 56, 46,115,109, 97,
-/* 0x32f0 */ 108,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3300 */  32,100, 32, 32,108,122,109, 97, 46,105,110,105,116,  9, 48, 48,
-/* 0x3310 */  48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 46,105,110,105,116,
-/* 0x3320 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3330 */  32, 32,108,122,109, 97, 46,102, 97,115,116,  9, 48, 48, 48, 48,
-/* 0x3340 */  48, 48, 48, 48, 32,108,122,109, 97, 46,102, 97,115,116, 10, 48,
-/* 0x3350 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3360 */ 108,122,109, 97, 46,115,109, 97,108,108,  9, 48, 48, 48, 48, 48,
-/* 0x3370 */  48, 48, 48, 32,108,122,109, 97, 46,115,109, 97,108,108, 10, 48,
-/* 0x3380 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3390 */ 108,122,109, 97, 46,102,105,110,105,115,104,  9, 48, 48, 48, 48,
-/* 0x33a0 */  48, 48, 48, 48, 32,108,122,109, 97, 46,102,105,110,105,115,104,
-/* 0x33b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x33c0 */  32, 32,114,101,108,111, 99,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33d0 */  32,114,101,108,111, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x33e0 */ 108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 51, 95,115,101,
-/* 0x33f0 */ 116, 95, 99,111,117,110,116, 46, 98,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3400 */  48, 48, 32,108,111,111,112, 51, 95,115,101,116, 95, 99,111,117,
-/* 0x3410 */ 110,116, 46, 98, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3420 */  32, 32, 32,100, 32, 32,108,111,111,112, 51, 95,115,101,116, 95,
-/* 0x3430 */  99,111,117,110,116, 46,119,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3440 */  32,108,111,111,112, 51, 95,115,101,116, 95, 99,111,117,110,116,
-/* 0x3450 */  46,119, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3460 */  32,100, 32, 32,108,111,111,112, 51, 95,115,101,116, 95, 99,111,
-/* 0x3470 */ 117,110,116, 46,108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3480 */ 111,111,112, 51, 95,115,101,116, 95, 99,111,117,110,116, 46,108,
-/* 0x3490 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x34a0 */  32, 32,106,109,112, 95,115,116, 97, 99,107,  9, 48, 48, 48, 48,
-/* 0x34b0 */  48, 48, 48, 48, 32,106,109,112, 95,115,116, 97, 99,107, 10, 48,
-/* 0x34c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x34d0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,111,
-/* 0x34e0 */ 114,105,103, 95,112, 95,116,108,101,110, 10, 48, 48, 48, 48, 48,
-/* 0x34f0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x3500 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,111,114,105,103, 95,
-/* 0x3510 */ 112, 95,100,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3520 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x3530 */  48, 48, 48, 48, 48, 48, 32,111,114,105,103, 95,112, 95, 98,108,
-/* 0x3540 */ 101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x3550 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3560 */  48, 48, 32,117,112, 50, 49, 95, 97, 54, 10, 48, 48, 48, 48, 48,
-/* 0x3570 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x3580 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,117,112, 50, 49, 95,
-/* 0x3590 */ 100, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x35a0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x35b0 */  48, 48, 32,108,111,111,112, 49, 95, 99,111,117,110,116, 10, 48,
-/* 0x35c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35d0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x35e0 */ 111,111,112, 50, 95, 99,111,117,110,116, 10, 48, 48, 48, 48, 48,
-/* 0x35f0 */  48, 48, 99, 32,103, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,
-/* 0x3600 */ 116, 95,112,114,111,103,114, 97,109,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3610 */  48, 48, 32, 99,111,100,101, 95,111,110, 95,115,116, 97, 99,107,
-/* 0x3620 */  95,101,110,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x3630 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x3640 */  48, 48, 48, 48, 32, 99,111,112,121, 95,116,111, 95,115,116, 97,
-/* 0x3650 */  99,107, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3660 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x3670 */  48, 48, 48, 48, 48, 48, 32,102,108,117,115,104, 95, 99, 97, 99,
-/* 0x3680 */ 104,101, 95,114,116,115, 95,111,102,102,115,101,116, 10, 48, 48,
-/* 0x3690 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x36a0 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,117,112,
-/* 0x36b0 */  51, 49, 95, 97, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x36c0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x36d0 */  48, 48, 48, 48, 48, 32,117,112, 51, 49, 95,100, 52, 10, 48, 48,
-/* 0x36e0 */  48, 48, 48, 48, 55, 54, 32,103, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x36f0 */ 108,117,115,104, 95, 99, 97, 99,104,101,  9, 48, 48, 48, 48, 48,
-/* 0x3700 */  48, 48, 48, 32,102,108,117,115,104, 95, 99, 97, 99,104,101, 95,
-/* 0x3710 */ 114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x3720 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x3730 */  48, 48, 48, 32, 99,108,101, 97,114, 95,100,105,114,116,121, 95,
-/* 0x3740 */ 115,116, 97, 99,107, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3750 */  48, 54, 32,103, 32, 32, 32, 32, 32, 32, 32, 99,108,101, 97,114,
-/* 0x3760 */  95,100,105,114,116,121, 95,115,116, 97, 99,107,  9, 48, 48, 48,
-/* 0x3770 */  48, 48, 48, 48, 48, 32, 99,108,101, 97,114, 95,100,105,114,116,
-/* 0x3780 */ 121, 95,115,116, 97, 99,107, 95,108,111,111,112, 10, 48, 48, 48,
-/* 0x3790 */  48, 48, 48, 48, 50, 32,103, 32, 32, 32, 32, 32, 32, 32,110,114,
-/* 0x37a0 */ 118, 50, 98, 95, 56, 46,102, 97,115,116,  9, 48, 48, 48, 48, 48,
-/* 0x37b0 */  48, 48, 48, 32,110,114,118, 50, 98, 95, 56, 95,102, 97,115,116,
-/* 0x37c0 */  95,100,101, 99,111,109,112,114, 95,115,116, 97,114,116, 10, 48,
-/* 0x37d0 */  48, 48, 48, 48, 48, 48, 50, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x37e0 */ 110,114,118, 50,100, 95, 56, 46,102, 97,115,116,  9, 48, 48, 48,
-/* 0x37f0 */  48, 48, 48, 48, 48, 32,110,114,118, 50,100, 95, 56, 95,102, 97,
-/* 0x3800 */ 115,116, 95,100,101, 99,111,109,112,114, 95,115,116, 97,114,116,
-/* 0x3810 */  10, 48, 48, 48, 48, 48, 48, 48, 50, 32,103, 32, 32, 32, 32, 32,
-/* 0x3820 */  32, 32,110,114,118, 50,101, 95, 56, 46,102, 97,115,116,  9, 48,
-/* 0x3830 */  48, 48, 48, 48, 48, 48, 48, 32,110,114,118, 50,101, 95, 56, 95,
-/* 0x3840 */ 102, 97,115,116, 95,100,101, 99,111,109,112,114, 95,115,116, 97,
-/* 0x3850 */ 114,116, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,103, 32, 32, 32,
-/* 0x3860 */  32, 32, 32, 32,110,114,118, 50, 98, 95, 56, 46,115,109, 97,108,
-/* 0x3870 */ 108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,114,118, 50, 98,
-/* 0x3880 */  95, 56, 95,115,109, 97,108,108, 95,100,101, 99,111,109,112,114,
-/* 0x3890 */  95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x38a0 */ 103, 32, 32, 32, 32, 32, 32, 32,110,114,118, 50,100, 95, 56, 46,
-/* 0x38b0 */ 115,109, 97,108,108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,
-/* 0x38c0 */ 114,118, 50,100, 95, 56, 95,115,109, 97,108,108, 95,100,101, 99,
-/* 0x38d0 */ 111,109,112,114, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48,
-/* 0x38e0 */  48, 48, 50, 32,103, 32, 32, 32, 32, 32, 32, 32,110,114,118, 50,
-/* 0x38f0 */ 101, 95, 56, 46,115,109, 97,108,108,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3900 */  48, 48, 32,110,114,118, 50,101, 95, 56, 95,115,109, 97,108,108,
-/* 0x3910 */  95,100,101, 99,111,109,112,114, 95,115,116, 97,114,116, 10, 48,
-/* 0x3920 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3930 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3940 */ 122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,
-/* 0x3950 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3960 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3970 */  32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x3980 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x3990 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97,
-/* 0x39a0 */  95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x39b0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x39c0 */  48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,114,111,112,
-/* 0x39d0 */ 101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x39e0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x39f0 */  48, 48, 48, 48, 48, 48, 32,108,111,111,112, 51, 95, 99,111,117,
-/* 0x3a00 */ 110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x3a10 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,101,110,116,114,
-/* 0x3a20 */ 121, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x3a30 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x3a40 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 99, 32, 82, 95,
-/* 0x3a50 */  54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3a60 */ 111,114,105,103, 95,112, 95,116,108,101,110, 10, 48, 48, 48, 48,
-/* 0x3a70 */  48, 48, 50, 54, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32,
-/* 0x3a80 */  32, 32, 32, 32, 32, 32, 32,111,114,105,103, 95,112, 95,100,108,
-/* 0x3a90 */ 101,110, 10, 48, 48, 48, 48, 48, 48, 51, 50, 32, 82, 95, 54, 56,
-/* 0x3aa0 */  75, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,
-/* 0x3ab0 */ 105,103, 95,112, 95, 98,108,101,110, 10, 10, 82, 69, 76, 79, 67,
-/* 0x3ac0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3ad0 */  82, 32, 91,115,101,116, 95,117,112, 50, 49, 95, 97, 54, 46,119,
-/* 0x3ae0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3af0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3b00 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 54,
-/* 0x3b10 */  56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,117,
-/* 0x3b20 */ 112, 50, 49, 95, 97, 54, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3b30 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3b40 */ 115,101,116, 95,117,112, 50, 49, 95,100, 52, 46,119, 93, 58, 10,
-/* 0x3b50 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x3b60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x3b70 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 54, 56, 75, 95,
-/* 0x3b80 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,117,112, 50, 49,
-/* 0x3b90 */  95,100, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3ba0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,115,101,116,
-/* 0x3bb0 */  95,117,112, 50, 49, 95,100, 52, 46,108, 93, 58, 10, 79, 70, 70,
-/* 0x3bc0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x3bd0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x3be0 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32,
-/* 0x3bf0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,117,112, 50, 49, 95,100, 52,
-/* 0x3c00 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3c10 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 49, 95,
-/* 0x3c20 */ 115,101,116, 95, 99,111,117,110,116, 46, 98, 93, 58, 10, 79, 70,
-/* 0x3c30 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3c40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3c50 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 54, 56, 75, 95, 56, 32,
-/* 0x3c60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111,111,112, 49, 95,
-/* 0x3c70 */  99,111,117,110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x3c80 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,
-/* 0x3c90 */ 111,111,112, 49, 95,115,101,116, 95, 99,111,117,110,116, 46,119,
-/* 0x3ca0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3cb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3cc0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 54,
-/* 0x3cd0 */  56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x3ce0 */ 111,111,112, 49, 95, 99,111,117,110,116, 10, 10, 82, 69, 76, 79,
-/* 0x3cf0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x3d00 */  79, 82, 32, 91,108,111,111,112, 49, 95,115,101,116, 95, 99,111,
-/* 0x3d10 */ 117,110,116, 46,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3d20 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3d30 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d40 */  50, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x3d50 */  32, 32, 32, 32,108,111,111,112, 49, 95, 99,111,117,110,116, 10,
-/* 0x3d60 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3d70 */  82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 49, 95,115,
-/* 0x3d80 */ 117, 98,113,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x3d90 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3da0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x3db0 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x3dc0 */  32, 32, 32,108,111,111,112, 49, 95,108, 97, 98,101,108, 43, 48,
-/* 0x3dd0 */ 120,102,102,102,102,102,102,102,102, 10, 10, 82, 69, 76, 79, 67,
-/* 0x3de0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3df0 */  82, 32, 91,108,111,111,112, 49, 95,115,117, 98,113,119, 93, 58,
-/* 0x3e00 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3e10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3e20 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 54, 56, 75,
-/* 0x3e30 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111,111,
-/* 0x3e40 */ 112, 49, 95,108, 97, 98,101,108, 43, 48,120,102,102,102,102,102,
-/* 0x3e50 */ 102,102,102, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3e60 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,
-/* 0x3e70 */ 112, 49, 95,100, 98,114, 97, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x3e80 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e90 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3ea0 */  48, 48, 50, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x3eb0 */  32, 32, 32, 32, 32, 32,108,111,111,112, 49, 95,108, 97, 98,101,
-/* 0x3ec0 */ 108, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x3ed0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 50,
-/* 0x3ee0 */  46,102, 97,115,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3ef0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f00 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f10 */  49, 32, 82, 95, 54, 56, 75, 95, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f20 */  32, 32, 32, 32,108,111,111,112, 50, 95, 99,111,117,110,116, 10,
-/* 0x3f30 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3f40 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,111,112,121, 95,116,111,
-/* 0x3f50 */  95,115,116, 97, 99,107, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x3f60 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f70 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3f80 */  48, 50, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x3f90 */  32, 32, 32, 32, 32, 99,111,100,101, 95,111,110, 95,115,116, 97,
-/* 0x3fa0 */  99,107, 95,101,110,100, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32,
-/* 0x3fb0 */  82, 95, 54, 56, 75, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3fc0 */  32, 32, 99,111,112,121, 95,116,111, 95,115,116, 97, 99,107, 95,
-/* 0x3fd0 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 54,
-/* 0x3fe0 */  56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x3ff0 */ 108,117,115,104, 95, 99, 97, 99,104,101, 95,114,116,115, 95,111,
-/* 0x4000 */ 102,102,115,101,116, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82,
-/* 0x4010 */  95, 54, 56, 75, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4020 */  32,102,108,117,115,104, 95, 99, 97, 99,104,101, 43, 48,120,102,
-/* 0x4030 */ 102,102,102,102,102,102,102, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4040 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4050 */  91,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,
-/* 0x4060 */ 114, 95, 97, 54, 46,119, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4070 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4080 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4090 */  48, 50, 32, 82, 95, 54, 56, 75, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x40a0 */  32, 32, 32, 32, 32,117,112, 51, 49, 95, 97, 54, 10, 10, 82, 69,
-/* 0x40b0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x40c0 */  32, 70, 79, 82, 32, 91,106,109,112, 95,100,101, 99,111,109,112,
-/* 0x40d0 */ 114,101,115,115,111,114, 95,100, 52, 46,119, 93, 58, 10, 79, 70,
-/* 0x40e0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x40f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4100 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 54, 56, 75, 95, 49, 54,
-/* 0x4110 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,117,112, 51, 49, 95,100,
-/* 0x4120 */  52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4130 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,106,109,112, 95,100,
-/* 0x4140 */ 101, 99,111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119,
-/* 0x4150 */  50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4160 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x4170 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95,
-/* 0x4180 */  54, 56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4190 */ 117,112, 51, 49, 95, 97, 54, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x41a0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x41b0 */  91,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,
-/* 0x41c0 */ 114, 95,100, 52, 46,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x41d0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x41e0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x41f0 */  48, 52, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x4200 */  32, 32, 32, 32, 32,117,112, 51, 49, 95,100, 52, 10, 10, 82, 69,
-/* 0x4210 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4220 */  32, 70, 79, 82, 32, 91,108,111,111,112, 51, 95,115,117, 98,113,
-/* 0x4230 */ 108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4240 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x4250 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x4260 */  54, 56, 75, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4270 */ 108,111,111,112, 51, 95,108, 97, 98,101,108, 43, 48,120,102,102,
-/* 0x4280 */ 102,102,102,102,102,102, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4290 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x42a0 */ 108,111,111,112, 51, 95,115,117, 98,113,119, 93, 58, 10, 79, 70,
-/* 0x42b0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x42c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x42d0 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 54, 56, 75, 95, 80, 67,
-/* 0x42e0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111,111,112, 51, 95,
-/* 0x42f0 */ 108, 97, 98,101,108, 43, 48,120,102,102,102,102,102,102,102,102,
-/* 0x4300 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4310 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 51, 95,
-/* 0x4320 */ 100, 98,114, 97, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4330 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4340 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x4350 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x4360 */  32, 32, 32,108,111,111,112, 51, 95,108, 97, 98,101,108, 10, 10,
-/* 0x4370 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4380 */  68, 83, 32, 70, 79, 82, 32, 91,114,101,115,116,111,114,101, 95,
-/* 0x4390 */ 115,116, 97, 99,107, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x43a0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43b0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43c0 */  50, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x43d0 */  32, 32, 32, 32, 99,111,100,101, 95,111,110, 95,115,116, 97, 99,
-/* 0x43e0 */ 107, 95,101,110,100, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x43f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4400 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,108,101, 97,114, 95,
-/* 0x4410 */ 100,105,114,116,121, 95,115,116, 97, 99,107, 93, 58, 10, 79, 70,
-/* 0x4420 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4430 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4440 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 54, 56, 75, 95, 56, 32,
-/* 0x4450 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,108,101, 97,114, 95,
-/* 0x4460 */ 100,105,114,116,121, 95,115,116, 97, 99,107, 95,108,101,110, 10,
-/* 0x4470 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4480 */  82, 68, 83, 32, 70, 79, 82, 32, 91,108,122,109, 97, 46,105,110,
-/* 0x4490 */ 105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x44a0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x44b0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x44c0 */  95, 54, 56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x44d0 */  32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,
-/* 0x44e0 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 54, 56,
-/* 0x44f0 */  75, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x4500 */ 109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x4510 */  97, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x4520 */  32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48,
-/* 0x4530 */  48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 54, 56, 75, 95, 51, 50,
-/* 0x4540 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,
-/* 0x4550 */ 114,111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4560 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4570 */  82, 32, 91,108,122,109, 97, 46,102, 97,115,116, 93, 58, 10, 79,
-/* 0x4580 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4590 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x45a0 */  48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 54, 56, 75, 95, 80,
-/* 0x45b0 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,
-/* 0x45c0 */ 115,105, 51, 10, 48, 48, 48, 48, 48, 49, 99, 97, 32, 82, 95, 54,
-/* 0x45d0 */  56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95,
-/* 0x45e0 */  95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 50, 52, 50,
-/* 0x45f0 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x4600 */  32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48,
-/* 0x4610 */  48, 50,102,101, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32,
-/* 0x4620 */  32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10,
-/* 0x4630 */  48, 48, 48, 48, 48, 51, 56, 50, 32, 82, 95, 54, 56, 75, 95, 80,
-/* 0x4640 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,
-/* 0x4650 */ 115,105, 51, 10, 48, 48, 48, 48, 48, 51,100,101, 32, 82, 95, 54,
-/* 0x4660 */  56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95,
-/* 0x4670 */  95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 52, 56, 50,
-/* 0x4680 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x4690 */  32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48,
-/* 0x46a0 */  48, 52,100, 97, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32,
-/* 0x46b0 */  32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10,
-/* 0x46c0 */  48, 48, 48, 48, 48, 53, 55, 56, 32, 82, 95, 54, 56, 75, 95, 80,
-/* 0x46d0 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,
-/* 0x46e0 */ 115,105, 51, 10, 48, 48, 48, 48, 48, 53,101, 48, 32, 82, 95, 54,
-/* 0x46f0 */  56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95,
-/* 0x4700 */  95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 54, 54, 99,
-/* 0x4710 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x4720 */  32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48,
-/* 0x4730 */  48, 55, 48, 56, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32,
-/* 0x4740 */  32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10,
-/* 0x4750 */  48, 48, 48, 48, 48, 55,102, 56, 32, 82, 95, 54, 56, 75, 95, 80,
-/* 0x4760 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,
-/* 0x4770 */ 115,105, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4780 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,122,109,
-/* 0x4790 */  97, 46,115,109, 97,108,108, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x47a0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47b0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x47c0 */  49, 48, 56, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x47d0 */  32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48,
-/* 0x47e0 */  48, 48, 48, 48, 49, 99, 97, 32, 82, 95, 54, 56, 75, 95, 80, 67,
-/* 0x47f0 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,
-/* 0x4800 */ 105, 51, 10, 48, 48, 48, 48, 48, 50, 52, 50, 32, 82, 95, 54, 56,
-/* 0x4810 */  75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,
-/* 0x4820 */ 109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 50,102,101, 32,
-/* 0x4830 */  82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4840 */  32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48,
-/* 0x4850 */  51, 56, 50, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x4860 */  32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48,
-/* 0x4870 */  48, 48, 48, 48, 51,100,101, 32, 82, 95, 54, 56, 75, 95, 80, 67,
-/* 0x4880 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,
-/* 0x4890 */ 105, 51, 10, 48, 48, 48, 48, 48, 52, 56, 50, 32, 82, 95, 54, 56,
-/* 0x48a0 */  75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,
-/* 0x48b0 */ 109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 52,100, 97, 32,
-/* 0x48c0 */  82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x48d0 */  32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48,
-/* 0x48e0 */  53, 55, 56, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x48f0 */  32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48,
-/* 0x4900 */  48, 48, 48, 48, 53,101, 48, 32, 82, 95, 54, 56, 75, 95, 80, 67,
-/* 0x4910 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,
-/* 0x4920 */ 105, 51, 10, 48, 48, 48, 48, 48, 54, 54, 99, 32, 82, 95, 54, 56,
-/* 0x4930 */  75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,
-/* 0x4940 */ 109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 55, 48, 56, 32,
-/* 0x4950 */  82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4960 */  32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48,
-/* 0x4970 */  55,102, 56, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x4980 */  32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 10,
-/* 0x4990 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x49a0 */  68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 51, 95,115,101,
-/* 0x49b0 */ 116, 95, 99,111,117,110,116, 46, 98, 93, 58, 10, 79, 70, 70, 83,
-/* 0x49c0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49d0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x49e0 */  48, 48, 48, 48, 49, 32, 82, 95, 54, 56, 75, 95, 56, 32, 32, 32,
-/* 0x49f0 */  32, 32, 32, 32, 32, 32, 32, 32,108,111,111,112, 51, 95, 99,111,
-/* 0x4a00 */ 117,110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4a10 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,
-/* 0x4a20 */ 112, 51, 95,115,101,116, 95, 99,111,117,110,116, 46,119, 93, 58,
-/* 0x4a30 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4a40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4a50 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 54, 56, 75,
-/* 0x4a60 */  95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111,111,
-/* 0x4a70 */ 112, 51, 95, 99,111,117,110,116, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4a80 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4a90 */  32, 91,108,111,111,112, 51, 95,115,101,116, 95, 99,111,117,110,
-/* 0x4aa0 */ 116, 46,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4ab0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ac0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x4ad0 */  82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ae0 */  32, 32,108,111,111,112, 51, 95, 99,111,117,110,116, 10
+/* 0x1730 */  53,  0,  0,  0, 79,  0,  0,  0, 59,  0,  0,  0,216, 13,  0,  0,
+/* 0x1740 */   0,  0,  0,  0, 52,  0,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1750 */   6,  0,  0,  0,106,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */  20,  0,  0,  0,110,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1770 */  34,  0,  0,  0,116,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1780 */  48,  0,  0,  0,124,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */  66,  0,  0,  0,126,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17a0 */  84,  0,  0,  0,130,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17b0 */ 102,  0,  0,  0,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */ 114,  0,  0,  0,136,  0,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17d0 */ 125,  0,  0,  0,178,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17e0 */ 137,  0,  0,  0,180,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */ 149,  0,  0,  0,184,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1800 */ 161,  0,  0,  0,188,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1810 */ 172,  0,  0,  0,192,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */ 183,  0,  0,  0,200,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1830 */ 195,  0,  0,  0,200,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1840 */ 209,  0,  0,  0,222,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */ 220,  0,  0,  0,232,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1860 */ 231,  0,  0,  0,242,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1870 */ 242,  0,  0,  0,252,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   8,  1,  0,  0,  0,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1890 */  30,  1,  0,  0,  6,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18a0 */  53,  1,  0,  0, 14,  1,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */  75,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18c0 */  89,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18d0 */ 105,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */ 117,  1,  0,  0, 24,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18f0 */ 129,  1,  0,  0, 26,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */ 140,  1,  0,  0, 34,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */ 152,  1,  0,  0, 38,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1920 */ 164,  1,  0,  0, 42,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1930 */ 175,  1,  0,  0, 46,  1,  0,  0,120,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */ 187,  1,  0,  0,166,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1950 */ 201,  1,  0,  0,170,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */ 219,  1,  0,  0,182,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */ 233,  1,  0,  0,194,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1980 */ 242,  1,  0,  0,226,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */ 251,  1,  0,  0,226,  1,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   8,  2,  0,  0, 94,  2,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */  21,  2,  0,  0,238,  2,  0,  0,152,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */  34,  2,  0,  0,134,  3,  0,  0,118,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */  48,  2,  0,  0,252,  3,  0,  0,138,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */  62,  2,  0,  0,134,  4,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */  76,  2,  0,  0, 24,  5,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */  86,  2,  0,  0, 70,  5,  0,  0,202,  8,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */  96,  2,  0,  0, 16, 14,  0,  0,202,  8,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */ 107,  2,  0,  0,218, 22,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */ 119,  2,  0,  0,236, 22,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */ 125,  2,  0,  0,  6, 23,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */ 143,  2,  0,  0,  8, 23,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */ 161,  2,  0,  0, 12, 23,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */ 179,  2,  0,  0, 18, 23,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */ 189,  2,  0,  0, 20, 23,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */ 102,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */ 175,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */ 105,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */ 189,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   6,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */  20,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */  34,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */  48,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */  66,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */  84,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */ 114,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */ 125,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */ 137,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */ 149,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */ 161,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */ 172,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */ 183,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */ 195,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */ 209,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */ 220,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */ 231,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */ 242,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */   8,  1,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */  30,  1,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */  53,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */  75,  1,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */  89,  1,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */ 117,  1,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */ 129,  1,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */ 140,  1,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */ 152,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */ 164,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */ 187,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */ 201,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */ 219,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */ 233,  1,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */ 242,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */ 251,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   8,  2,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */  21,  2,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */  34,  2,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */  48,  2,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */  62,  2,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */  76,  2,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */  86,  2,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */  96,  2,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */ 107,  2,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */ 119,  2,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */ 125,  2,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */ 143,  2,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */ 161,  2,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */ 179,  2,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */ 198,  2,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1df0 */ 210,  2,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e00 */ 222,  2,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e10 */ 234,  2,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e20 */ 242,  2,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e30 */ 250,  2,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e40 */   6,  3,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e50 */  18,  3,  0,  0, 34,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */  36,  3,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e70 */  54,  3,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e80 */  77,  3,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e90 */  85,  3,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1ea0 */  93,  3,  0,  0, 31,  0,  0,  0,118,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */ 109,  3,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1ec0 */ 131,  3,  0,  0, 33,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */ 154,  3,  0,  0, 37,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */ 181,  3,  0,  0, 38,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */ 208,  3,  0,  0, 39,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */ 235,  3,  0,  0, 40,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   7,  4,  0,  0, 41,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */  35,  4,  0,  0, 42,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */  63,  4,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1f40 */  81,  4,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1f50 */  92,  4,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1f60 */ 103,  4,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1f70 */ 119,  4,  0,  0, 54,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0, 28,  0,  0,  0,131,  4,  0,  0, 53,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,
+/* 0x1fa0 */ 131,  4,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0, 50,  0,  0,  0,131,  4,  0,  0, 55,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1fd0 */ 140,  4,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   2,  0,  0,  0,  4,  0,  0,  0,140,  4,  0,  0, 57,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2000 */ 131,  4,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   4,  0,  0,  0,  1,  0,  0,  0,149,  4,  0,  0, 58,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2030 */ 140,  4,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */   6,  0,  0,  0,  2,  0,  0,  0,131,  4,  0,  0, 58,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2060 */ 157,  4,  0,  0,  0,  0,  0,  0,255,255,255,255,  0,  0,  0,  0,
+/* 0x2070 */  11,  0,  0,  0,  3,  0,  0,  0,157,  4,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */ 255,255,255,255,  0,  0,  0,  0, 12,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2090 */ 167,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */  13,  0,  0,  0,  1,  0,  0,  0,149,  4,  0,  0, 59,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0,
+/* 0x20c0 */ 167,  4,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */  15,  0,  0,  0,  7,  0,  0,  0,149,  4,  0,  0, 61,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 18,  0,  0,  0,
+/* 0x20f0 */ 140,  4,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */  15,  0,  0,  0, 21,  0,  0,  0,157,  4,  0,  0,  1,  0,  0,  0,
+/* 0x2110 */ 255,255,255,255,  0,  0,  0,  0, 19,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2120 */ 140,  4,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */  20,  0,  0,  0,  4,  0,  0,  0,140,  4,  0,  0, 64,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  6,  0,  0,  0,
+/* 0x2150 */ 140,  4,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */  22,  0,  0,  0,  4,  0,  0,  0,131,  4,  0,  0, 64,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2180 */ 157,  4,  0,  0,  2,  0,  0,  0,255,255,255,255,  0,  0,  0,  0,
+/* 0x2190 */  29,  0,  0,  0,  3,  0,  0,  0,157,  4,  0,  0,  2,  0,  0,  0,
+/* 0x21a0 */ 255,255,255,255,  0,  0,  0,  0, 30,  0,  0,  0,  2,  0,  0,  0,
+/* 0x21b0 */ 167,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */  32,  0,  0,  0,  2,  0,  0,  0,167,  4,  0,  0, 60,  0,  0,  0,
+/* 0x21d0 */   4,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  1,  0,  0,  0,
+/* 0x21e0 */ 149,  4,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */  43,  0,  0,  0,  4,  0,  0,  0,140,  4,  0,  0, 74,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2210 */ 131,  4,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */  43,  0,  0,  0, 26,  0,  0,  0,131,  4,  0,  0, 76,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0, 40,  0,  0,  0,
+/* 0x2240 */ 131,  4,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2250 */  44,  0,  0,  0,  8,  1,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2260 */   0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,202,  1,  0,  0,
+/* 0x2270 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2280 */  44,  0,  0,  0, 66,  2,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2290 */   0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,254,  2,  0,  0,
+/* 0x22a0 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22b0 */  44,  0,  0,  0,130,  3,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,222,  3,  0,  0,
+/* 0x22d0 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22e0 */  44,  0,  0,  0,130,  4,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,218,  4,  0,  0,
+/* 0x2300 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */  44,  0,  0,  0,120,  5,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2320 */   0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,224,  5,  0,  0,
+/* 0x2330 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */  44,  0,  0,  0,108,  6,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2350 */   0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,  8,  7,  0,  0,
+/* 0x2360 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */  44,  0,  0,  0,248,  7,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2380 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  8,  1,  0,  0,
+/* 0x2390 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */  45,  0,  0,  0,202,  1,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0, 66,  2,  0,  0,
+/* 0x23c0 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */  45,  0,  0,  0,254,  2,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,130,  3,  0,  0,
+/* 0x23f0 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */  45,  0,  0,  0,222,  3,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,130,  4,  0,  0,
+/* 0x2420 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */  45,  0,  0,  0,218,  4,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,120,  5,  0,  0,
+/* 0x2450 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */  45,  0,  0,  0,224,  5,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2470 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,108,  6,  0,  0,
+/* 0x2480 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */  45,  0,  0,  0,  8,  7,  0,  0,167,  4,  0,  0,  3,  0,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,248,  7,  0,  0,
+/* 0x24b0 */ 167,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */  48,  0,  0,  0,  1,  0,  0,  0,149,  4,  0,  0, 78,  0,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  2,  0,  0,  0,
+/* 0x24e0 */ 140,  4,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24f0 */  50,  0,  0,  0,  2,  0,  0,  0,131,  4,  0,  0, 78,  0,  0,  0,
+/* 0x2500 */   0,  0,  0,  0,  0,  0,  0,  0,101,110,116,114,121,  0,115,101,
+/* 0x2510 */ 116, 95,117,112, 50, 49, 95, 97, 54, 46,119,  0,115,101,116, 95,
+/* 0x2520 */ 117,112, 50, 49, 95,100, 52, 46,119,  0,115,101,116, 95,117,112,
+/* 0x2530 */  50, 49, 95,100, 52, 46,108,  0,108,111,111,112, 49, 95,115,101,
+/* 0x2540 */ 116, 95, 99,111,117,110,116, 46, 98,  0,108,111,111,112, 49, 95,
+/* 0x2550 */ 115,101,116, 95, 99,111,117,110,116, 46,119,  0,108,111,111,112,
+/* 0x2560 */  49, 95,115,101,116, 95, 99,111,117,110,116, 46,108,  0,108,111,
+/* 0x2570 */ 111,112, 49, 95,108, 97, 98,101,108,  0,108,111,111,112, 49, 46,
+/* 0x2580 */ 102, 97,115,116,  0,108,111,111,112, 49, 46,115,109, 97,108,108,
+/* 0x2590 */   0,108,111,111,112, 49, 95,115,117, 98,113,108,  0,108,111,111,
+/* 0x25a0 */ 112, 49, 95,115,117, 98,113,119,  0,108,111,111,112, 49, 95,100,
+/* 0x25b0 */  98,114, 97,  0,108,111,111,112, 50, 46,102, 97,115,116,  0,108,
+/* 0x25c0 */ 111,111,112, 50, 46,115,109, 97,108,108,  0, 99,111,112,121, 95,
+/* 0x25d0 */ 116,111, 95,115,116, 97, 99,107,  0,110,114,118, 50, 98, 46,105,
+/* 0x25e0 */ 110,105,116,  0,110,114,118, 50,100, 46,105,110,105,116,  0,110,
+/* 0x25f0 */ 114,118, 50,101, 46,105,110,105,116,  0,106,109,112, 95,100,101,
+/* 0x2600 */  99,111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119,  0,
+/* 0x2610 */ 106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,114,
+/* 0x2620 */  95,100, 52, 46,119,  0,106,109,112, 95,100,101, 99,111,109,112,
+/* 0x2630 */ 114,101,115,115,111,114, 95, 97, 54, 46,119, 50,  0,106,109,112,
+/* 0x2640 */  95,100,101, 99,111,109,112,114,101,115,115,111,114, 95,100, 52,
+/* 0x2650 */  46,108,  0, 99,111,100,101, 95,111,110, 95,115,116, 97, 99,107,
+/* 0x2660 */   0, 99,108,101, 97,114, 95,100,105,114,116,121, 95, 98,115,115,
+/* 0x2670 */   0,108,111,111,112, 51, 95,108, 97, 98,101,108,  0,108,111,111,
+/* 0x2680 */ 112, 51, 46,115,109, 97,108,108,  0,108,111,111,112, 51, 46,102,
+/* 0x2690 */  97,115,116,  0,108,111,111,112, 51, 95,115,117, 98,113,108,  0,
+/* 0x26a0 */ 108,111,111,112, 51, 95,115,117, 98,113,119,  0,108,111,111,112,
+/* 0x26b0 */  51, 95,100, 98,114, 97,  0,102,108,117,115,104, 95, 99, 97, 99,
+/* 0x26c0 */ 104,101,  0,114,101,115,116,111,114,101, 95,115,116, 97, 99,107,
+/* 0x26d0 */   0, 99,108,101, 97,114, 95,100,105,114,116,121, 95,115,116, 97,
+/* 0x26e0 */  99,107,  0,115,116, 97,114,116, 95,112,114,111,103,114, 97,109,
+/* 0x26f0 */   0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 67, 85, 84, 80, 79, 73,
+/* 0x2700 */  78, 84,  0,110,114,118, 50, 98, 95, 56, 46,102, 97,115,116,  0,
+/* 0x2710 */ 110,114,118, 50,100, 95, 56, 46,102, 97,115,116,  0,110,114,118,
+/* 0x2720 */  50,101, 95, 56, 46,102, 97,115,116,  0,110,114,118, 50, 98, 95,
+/* 0x2730 */  56, 46,115,109, 97,108,108,  0,110,114,118, 50,100, 95, 56, 46,
+/* 0x2740 */ 115,109, 97,108,108,  0,110,114,118, 50,101, 95, 56, 46,115,109,
+/* 0x2750 */  97,108,108,  0,108,122,109, 97, 46,105,110,105,116,  0,108,122,
+/* 0x2760 */ 109, 97, 46,102, 97,115,116,  0,108,122,109, 97, 46,115,109, 97,
+/* 0x2770 */ 108,108,  0,108,122,109, 97, 46,102,105,110,105,115,104,  0,114,
+/* 0x2780 */ 101,108,111, 99,  0,108,111,111,112, 51, 95,115,101,116, 95, 99,
+/* 0x2790 */ 111,117,110,116, 46, 98,  0,108,111,111,112, 51, 95,115,101,116,
+/* 0x27a0 */  95, 99,111,117,110,116, 46,119,  0,108,111,111,112, 51, 95,115,
+/* 0x27b0 */ 101,116, 95, 99,111,117,110,116, 46,108,  0,106,109,112, 95,115,
+/* 0x27c0 */ 116, 97, 99,107,  0, 95, 95,109,117,108,115,105, 51,  0,111,114,
+/* 0x27d0 */ 105,103, 95,112, 95,116,108,101,110,  0,111,114,105,103, 95,112,
+/* 0x27e0 */  95,100,108,101,110,  0,111,114,105,103, 95,112, 95, 98,108,101,
+/* 0x27f0 */ 110,  0,117,112, 50, 49, 95, 97, 54,  0,117,112, 50, 49, 95,100,
+/* 0x2800 */  52,  0,108,111,111,112, 49, 95, 99,111,117,110,116,  0,108,111,
+/* 0x2810 */ 111,112, 50, 95, 99,111,117,110,116,  0, 99,111,100,101, 95,111,
+/* 0x2820 */ 110, 95,115,116, 97, 99,107, 95,101,110,100,  0, 99,111,112,121,
+/* 0x2830 */  95,116,111, 95,115,116, 97, 99,107, 95,108,101,110,  0,102,108,
+/* 0x2840 */ 117,115,104, 95, 99, 97, 99,104,101, 95,114,116,115, 95,111,102,
+/* 0x2850 */ 102,115,101,116,  0,117,112, 51, 49, 95, 97, 54,  0,117,112, 51,
+/* 0x2860 */  49, 95,100, 52,  0,102,108,117,115,104, 95, 99, 97, 99,104,101,
+/* 0x2870 */  95,114,116,115,  0, 99,108,101, 97,114, 95,100,105,114,116,121,
+/* 0x2880 */  95,115,116, 97, 99,107, 95,108,101,110,  0, 99,108,101, 97,114,
+/* 0x2890 */  95,100,105,114,116,121, 95,115,116, 97, 99,107, 95,108,111,111,
+/* 0x28a0 */ 112,  0,110,114,118, 50, 98, 95, 56, 95,102, 97,115,116, 95,100,
+/* 0x28b0 */ 101, 99,111,109,112,114, 95,115,116, 97,114,116,  0,110,114,118,
+/* 0x28c0 */  50,100, 95, 56, 95,102, 97,115,116, 95,100,101, 99,111,109,112,
+/* 0x28d0 */ 114, 95,115,116, 97,114,116,  0,110,114,118, 50,101, 95, 56, 95,
+/* 0x28e0 */ 102, 97,115,116, 95,100,101, 99,111,109,112,114, 95,115,116, 97,
+/* 0x28f0 */ 114,116,  0,110,114,118, 50, 98, 95, 56, 95,115,109, 97,108,108,
+/* 0x2900 */  95,100,101, 99,111,109,112,114, 95,115,116, 97,114,116,  0,110,
+/* 0x2910 */ 114,118, 50,100, 95, 56, 95,115,109, 97,108,108, 95,100,101, 99,
+/* 0x2920 */ 111,109,112,114, 95,115,116, 97,114,116,  0,110,114,118, 50,101,
+/* 0x2930 */  95, 56, 95,115,109, 97,108,108, 95,100,101, 99,111,109,112,114,
+/* 0x2940 */  95,115,116, 97,114,116,  0,108,122,109, 97, 95,115,116, 97, 99,
+/* 0x2950 */ 107, 95, 97,100,106,117,115,116,  0,108,122,109, 97, 95,117, 95,
+/* 0x2960 */ 108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,108,
+/* 0x2970 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,  0,108,
+/* 0x2980 */ 111,111,112, 51, 95, 99,111,117,110,116,  0, 82, 95, 54, 56, 75,
+/* 0x2990 */  95, 51, 50,  0, 82, 95, 54, 56, 75, 95, 49, 54,  0, 82, 95, 54,
+/* 0x29a0 */  56, 75, 95, 56,  0, 82, 95, 54, 56, 75, 95, 80, 67, 56,  0, 82,
+/* 0x29b0 */  95, 54, 56, 75, 95, 80, 67, 49, 54,  0, 48, 23,  0,  0, 85, 80,
+/* 0x29c0 */  88, 76
 };
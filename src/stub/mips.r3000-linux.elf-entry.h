@@ -1,5 +1,5 @@
 /* mips.r3000-linux.elf-entry.h
-   created from mips.r3000-linux.elf-entry.bin, 9758 (0x261e) bytes
+   created from mips.r3000-linux.elf-entry.bin, 8015 (0x1f4f) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_SIZE    9758
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_ADLER32 0x6feb230c
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_CRC32   0x1539d37a
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_SIZE    8015
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_ADLER32 0xcaae41cf
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_CRC32   0xcd6c0586
 
-unsigned char stub_mips_r3000_linux_elf_entry[9758] = {
+unsigned char stub_mips_r3000_linux_elf_entry[8015] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0,  8,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 28,248,  0,  0,  0,  1,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -489,161 +489,52 @@ unsigned char stub_mips_r3000_linux_elf_entry[9758] = {
 /* 0x1c20 */  16,104,  0,  3,140,130,255,252, 20, 96,255,251, 36,  2, 16,  0,
 /* 0x1c30 */   0,  2,224, 34,  4, 17,255,167, 39,244,  0, 20, 47,112,114,111,
 /* 0x1c40 */  99, 47,115,101,108,102, 47,101,120,101,  0,  0,  0,  0,  0,  0,
-/* 0x1c50 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1c60 */  50, 45, 98,105,103,109,105,112,115, 10, 10, 83,101, 99,116,105,
-/* 0x1c70 */ 111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32,
-/* 0x1c80 */  32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32,
-/* 0x1c90 */  32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32,
-/* 0x1ca0 */  32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,
-/* 0x1cb0 */ 108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69,
-/* 0x1cc0 */  76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ce0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d00 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1d10 */  79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 50, 69, 32, 32,
-/* 0x1d20 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 53, 52, 32,
-/* 0x1d30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 99, 32, 32, 50,
-/* 0x1d50 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1d60 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1d70 */  32, 50, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d80 */  32, 48, 48, 48, 48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1da0 */  48, 48, 48, 48, 49, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1db0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1dc0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x1dd0 */  50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1de0 */  49, 50, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,100,
-/* 0x1e00 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1e10 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1e20 */  76, 89, 10, 32, 32, 52, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1e30 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 48,
-/* 0x1e40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 32, 32, 48, 48, 48, 48, 48, 51,102, 99, 32, 32, 50, 42, 42,
-/* 0x1e60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1e70 */  68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1e80 */  69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56,
-/* 0x1e90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 57, 56, 32, 32,
-/* 0x1eb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1ec0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77,
-/* 0x1ed0 */  65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  97,100, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,102, 55,
-/* 0x1f00 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1f10 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32,
-/* 0x1f20 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48,
-/* 0x1f30 */  48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1f50 */  49, 97, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1f60 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1f70 */  32, 56, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x1f80 */  32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1fa0 */  48, 48, 48, 49, 97, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1fb0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1fc0 */  89, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32,
-/* 0x1fd0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  32, 32, 48, 48, 48, 48, 49, 97, 53, 99, 32, 32, 50, 42, 42, 48,
-/* 0x2000 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2010 */  79, 78, 76, 89, 10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32,
-/* 0x2020 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32,
-/* 0x2030 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2040 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 54, 99, 32, 32, 50,
-/* 0x2050 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2060 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77,
-/* 0x2070 */  65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2080 */  50, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 57, 48,
-/* 0x20a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x20b0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x20c0 */  89, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32,
-/* 0x20d0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 57, 52, 32, 32, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20f0 */  32, 32, 48, 48, 48, 48, 49, 97, 98, 99, 32, 32, 50, 42, 42, 50,
-/* 0x2100 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2110 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66,
-/* 0x2120 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84,
-/* 0x2140 */  65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x2150 */  95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2160 */  32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9,
-/* 0x2170 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2180 */  90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2190 */ 100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48,
-/* 0x21b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x21c0 */  82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x21d0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x21e0 */  32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48,
-/* 0x21f0 */  48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2210 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2220 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2230 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x2250 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2260 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2290 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48,
-/* 0x22a0 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x22c0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48,
-/* 0x22d0 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x22e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x22f0 */  32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76,
-/* 0x2320 */  85, 83, 72,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70, 76,
-/* 0x2330 */  85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2340 */  32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48,
-/* 0x2350 */  48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 79,
-/* 0x2370 */  32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2380 */  48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x23a0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79, 95, 66, 73, 78, 70,
-/* 0x23b0 */  79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x23c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65,
-/* 0x23d0 */  73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x23e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2400 */  82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x2410 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79,
-/* 0x2420 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2430 */  79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2440 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2450 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x2470 */  54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2480 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2490 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x24a0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x24b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x24c0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 77, 73,
-/* 0x24d0 */  80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x24e0 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x24f0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2500 */  78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2510 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2520 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 54,
-/* 0x2530 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x2540 */  32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69,
-/* 0x2550 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2560 */  32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 89, 93, 58,
-/* 0x2570 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x2580 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2590 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77, 73, 80,
-/* 0x25a0 */  83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x25b0 */  77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x25c0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x25d0 */  76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x25e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2600 */  49, 57, 48, 32, 82, 95, 77, 73, 80, 83, 95, 51, 50, 32, 32, 32,
-/* 0x2610 */  32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1c50 */  13,  0,  0,  0, 15,  0,  0,  0,  6,  0,  0,  0, 96,  2,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0, 52,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   9,  0,  0,  0, 60,  0,  0,  0, 84,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */  15,  0,  0,  0,144,  1,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */  21,  0,  0,  0,212,  2,  0,  0, 40,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */  27,  0,  0,  0,252,  3,  0,  0,156,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */  38,  0,  0,  0,152,  4,  0,  0,216, 10,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */  49,  0,  0,  0,112, 15,  0,  0,216, 10,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */  60,  0,  0,  0, 72, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */  71,  0,  0,  0, 76, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */  80,  0,  0,  0, 92, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */  89,  0,  0,  0,108, 26,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */  96,  0,  0,  0,144, 26,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */ 105,  0,  0,  0,188, 26,  0,  0,148,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1d30 */  80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */ 105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */  15,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */  21,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */  27,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */  38,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */  49,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */  60,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */  71,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */  96,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */ 114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */ 121,  0,  0,  0, 14,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,124,  0,  0,  0,
+/* 0x1e40 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   2,  0,  0,  0,124,  0,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,100,  0,  0,  0,
+/* 0x1e70 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */  11,  0,  0,  0,  4,  0,  0,  0,129,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,144,  1,  0,  0,
+/* 0x1ea0 */ 141,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */  69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 50, 69,  0, 78,
+/* 0x1ec0 */  82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95,
+/* 0x1ed0 */  69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
+/* 0x1ee0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65,
+/* 0x1ef0 */  95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0,
+/* 0x1f00 */  78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0,
+/* 0x1f10 */  69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x1f20 */  90,  0, 95,115,116, 97,114,116,  0, 79, 95, 66, 73, 78, 70, 79,
+/* 0x1f30 */   0, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54,  0, 82, 95, 77,
+/* 0x1f40 */  73, 80, 83, 95, 51, 50,  0, 80, 28,  0,  0, 85, 80, 88, 76
 };
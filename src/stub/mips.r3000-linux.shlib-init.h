@@ -1,5 +1,5 @@
 /* mips.r3000-linux.shlib-init.h
-   created from mips.r3000-linux.shlib-init.bin, 9963 (0x26eb) bytes
+   created from mips.r3000-linux.shlib-init.bin, 8384 (0x20c0) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_SIZE    9963
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_ADLER32 0xcaf96c4d
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_CRC32   0xe1fd739d
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_SIZE    8384
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_ADLER32 0x1854b3b1
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_CRC32   0x33d83c7f
 
-unsigned char stub_mips_r3000_linux_shlib_init[9963] = {
+unsigned char stub_mips_r3000_linux_shlib_init[8384] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0,  8,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 30,112,  0,  0,  0,  1,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -513,150 +513,51 @@ unsigned char stub_mips_r3000_linux_shlib_init[9963] = {
 /* 0x1da0 */  36,  6,  0,  0, 36,  2, 16, 51,  0,  0,  0, 12,143,185,  0, 20,
 /* 0x1db0 */   3, 32,  0,  8,  0,  0,  0,  0,140,231,255,248,  0,  7, 60,  0,
 /* 0x1dc0 */   0,  7, 60,  2, 36,231,255,255,  3,224,  0,  8,  0,199, 48, 33,
-/* 0x1dd0 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1de0 */  50, 45, 98,105,103,109,105,112,115, 10, 10, 83,101, 99,116,105,
-/* 0x1df0 */ 111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32,
-/* 0x1e00 */  32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32,
-/* 0x1e10 */  32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32,
-/* 0x1e20 */  32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,
-/* 0x1e30 */ 108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69,
-/* 0x1e40 */  76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 53, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e60 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e80 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1e90 */  79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 50, 69, 32, 32,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 53, 52, 32,
-/* 0x1eb0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 99, 32, 32, 50,
-/* 0x1ed0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1ee0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1ef0 */  32, 50, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f00 */  32, 48, 48, 48, 48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1f20 */  48, 48, 48, 48, 49,101, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1f30 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1f40 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x1f50 */  50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1f60 */  49, 50, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 50,
-/* 0x1f80 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1f90 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1fa0 */  76, 89, 10, 32, 32, 52, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1fb0 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  48, 32, 32, 48, 48, 48, 48, 48, 52, 52, 99, 32, 32, 50, 42, 42,
-/* 0x1fe0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1ff0 */  68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2000 */  69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56,
-/* 0x2010 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,101, 56, 32, 32,
-/* 0x2030 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2040 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77,
-/* 0x2050 */  65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2060 */  97,100, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,102, 99,
-/* 0x2080 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2090 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32,
-/* 0x20a0 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x20d0 */  49, 97, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x20e0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x20f0 */  32, 56, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x2100 */  32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2120 */  48, 48, 48, 49, 97, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2130 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2140 */  89, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32,
-/* 0x2150 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  32, 32, 48, 48, 48, 48, 49, 97, 97, 99, 32, 32, 50, 42, 42, 48,
-/* 0x2180 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2190 */  79, 78, 76, 89, 10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32,
-/* 0x21a0 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32,
-/* 0x21b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x21c0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 98, 99, 32, 32, 50,
-/* 0x21d0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x21e0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77,
-/* 0x21f0 */  65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2210 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,101, 48,
-/* 0x2220 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2230 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69,
-/* 0x2240 */  76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2250 */  48, 48, 50,102, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2260 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x2270 */  97,101, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2280 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89,
-/* 0x2290 */  77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48,
-/* 0x22a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x22b0 */  95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x22c0 */  82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22d0 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x22e0 */  90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65,
-/* 0x22f0 */  73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2300 */  32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10,
-/* 0x2320 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2330 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2340 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2350 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x2370 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x2380 */  50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x2390 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x23a0 */ 100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48,
-/* 0x23b0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x23c0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x23d0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x23e0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x23f0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2400 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48,
-/* 0x2410 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x2420 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2430 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48,
-/* 0x2440 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x2450 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2460 */ 100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48,
-/* 0x2470 */  48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48,
-/* 0x2480 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x2490 */  70, 76, 85, 83, 72,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67,
-/* 0x24a0 */  70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x24b0 */  32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9,
-/* 0x24c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x24d0 */  89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x24e0 */  32, 79, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48,
-/* 0x24f0 */  48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x2500 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 79, 32, 69, 76, 70,
-/* 0x2510 */  77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,
-/* 0x2520 */ 110,100, 95,100,101, 99,111,109,112,114,101,115,115, 10, 10, 82,
-/* 0x2530 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x2540 */  83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93,
-/* 0x2550 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2560 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2570 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 51, 99, 32, 82, 95, 77, 73,
-/* 0x2580 */  80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 95,115,
-/* 0x2590 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32, 82, 95,
-/* 0x25a0 */  77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25b0 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x25c0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x25d0 */  32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x25e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2600 */  48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32,
-/* 0x2610 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10,
-/* 0x2620 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2630 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10,
-/* 0x2640 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2650 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2660 */  10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x2670 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x2680 */  84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2690 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x26a0 */  86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x26b0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26c0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 54, 52, 32,
-/* 0x26d0 */  82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x26e0 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10
+/* 0x1dd0 */  13,  0,  0,  0, 15,  0,  0,  0,  5,  0,  0,  0, 72,  2,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0, 52,  0,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   9,  0,  0,  0,140,  0,  0,  0, 84,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */  15,  0,  0,  0,224,  1,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */  21,  0,  0,  0, 36,  3,  0,  0, 40,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */  27,  0,  0,  0, 76,  4,  0,  0,156,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */  38,  0,  0,  0,232,  4,  0,  0,216, 10,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */  49,  0,  0,  0,192, 15,  0,  0,216, 10,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */  60,  0,  0,  0,152, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */  71,  0,  0,  0,156, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */  80,  0,  0,  0,172, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */  89,  0,  0,  0,188, 26,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */  96,  0,  0,  0,224, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */ 105,  0,  0,  0,224, 26,  0,  0,240,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */  80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */ 105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */  15,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */  21,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */  27,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */  38,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */  49,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */  60,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f50 */  71,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */  96,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */ 114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */ 121,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0, 60,  0,  0,  0,136,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,
+/* 0x1fc0 */ 136,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   1,  0,  0,  0,124,  0,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,124,  0,  0,  0,
+/* 0x1ff0 */ 148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   3,  0,  0,  0,100,  0,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,
+/* 0x2020 */   0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86,
+/* 0x2030 */  50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x2040 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2050 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78,
+/* 0x2060 */  82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,
+/* 0x2070 */   0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,
+/* 0x2080 */   0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,
+/* 0x2090 */   0,101,110,100, 95,100,101, 99,111,109,112,114,101,115,115,  0,
+/* 0x20a0 */  82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,  0, 82, 95, 77, 73,
+/* 0x20b0 */  80, 83, 95, 80, 67, 49, 54,  0,208, 29,  0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* mipsel.r3000-linux.elf-entry.h
-   created from mipsel.r3000-linux.elf-entry.bin, 9641 (0x25a9) bytes
+   created from mipsel.r3000-linux.elf-entry.bin, 7895 (0x1ed7) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_SIZE    9641
-#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_ADLER32 0x54520c4c
-#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_CRC32   0x271a8386
+#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_SIZE    7895
+#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_ADLER32 0x1c252aee
+#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_CRC32   0x54faef6d
 
-unsigned char stub_mipsel_r3000_linux_elf_entry[9641] = {
+unsigned char stub_mipsel_r3000_linux_elf_entry[7895] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  8,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 128, 28,  0,  0,  1,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -481,162 +481,53 @@ unsigned char stub_mipsel_r3000_linux_elf_entry[9641] = {
 /* 0x1ba0 */   0,  0,131,140,  8,  0,132, 36,  3,  0,104, 16,252,255,130,140,
 /* 0x1bb0 */ 251,255, 96, 20,  0, 16,  2, 36, 34,224,  2,  0,167,255, 17,  4,
 /* 0x1bc0 */  20,  0,244, 39, 47,112,114,111, 99, 47,115,101,108,102, 47,101,
-/* 0x1bd0 */ 120,101,  0,  0,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1be0 */ 109, 97,116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,
-/* 0x1bf0 */ 109,105,112,115, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10,
-/* 0x1c00 */  73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c10 */  32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32,
-/* 0x1c20 */  32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c30 */  70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32,
-/* 0x1c40 */  70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1c50 */  78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x1c60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1c70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32,
-/* 0x1c80 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1c90 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1ca0 */  32, 32, 49, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1cb0 */  32, 32, 48, 48, 48, 48, 48, 49, 50, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1ce0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1cf0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82,
-/* 0x1d00 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1d10 */  48, 49, 49, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1d30 */  54, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1d40 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1d50 */  78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 66, 32, 32, 32,
-/* 0x1d60 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 48, 48, 32, 32,
-/* 0x1d70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 56, 52, 32, 32, 50, 42,
-/* 0x1d90 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1da0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1db0 */  52, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32,
-/* 0x1dc0 */  48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1de0 */  48, 48, 48, 51, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1df0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1e00 */  10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x1e10 */  32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32, 32, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e30 */  32, 48, 48, 48, 48, 48, 52, 50, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1e40 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1e50 */  78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1e60 */  49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32, 32,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1e80 */  48, 48, 32, 32, 48, 48, 48, 48, 48,101,102, 56, 32, 32, 50, 42,
-/* 0x1e90 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1ea0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95,
-/* 0x1eb0 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 48, 32,
-/* 0x1ee0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1ef0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 78, 82,
-/* 0x1f00 */  86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x1f30 */ 100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1f40 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57,
-/* 0x1f50 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1f60 */  48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f70 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1f80 */  48, 49, 57,101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1f90 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1fa0 */  32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32,
-/* 0x1fb0 */  32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1fd0 */  48, 48, 48, 48, 49, 57,102, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1fe0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1ff0 */  76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32,
-/* 0x2000 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 97, 32, 32, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 56, 32, 32, 50, 42, 42,
-/* 0x2030 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2040 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50,
-/* 0x2050 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2060 */  48, 48, 48, 48, 49, 57, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2080 */  48, 49, 97, 52, 52, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78,
-/* 0x2090 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x20a0 */  65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x20b0 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x20c0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48,
-/* 0x20d0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x20e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x20f0 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48,
-/* 0x2100 */  48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x2120 */  70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2130 */  69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2140 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2170 */  78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x2180 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2190 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x21b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x21c0 */  95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x21d0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x21e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x21f0 */  95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2200 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2210 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x2220 */  95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2230 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x2250 */  95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2260 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95,
-/* 0x2280 */  72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x2290 */  86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x22a0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,  9, 48,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48,
-/* 0x22c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x22d0 */  69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22e0 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48,
-/* 0x22f0 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 79, 32, 69, 76, 70, 77,
-/* 0x2300 */  65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,
-/* 0x2310 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x2320 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 32, 79, 95, 66, 73, 78, 70, 79, 10, 10, 82, 69,
-/* 0x2340 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2350 */  32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58,
-/* 0x2360 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x2370 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2380 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80,
-/* 0x2390 */  83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x23a0 */  77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x23b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x23c0 */  82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x23d0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23e0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 99,
-/* 0x23f0 */  32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x2400 */  32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76,
-/* 0x2410 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x2420 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70,
-/* 0x2430 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2440 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2450 */  48, 48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67,
-/* 0x2460 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x2470 */  76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2480 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66,
-/* 0x2490 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x24a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x24b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 54, 52, 32, 82, 95, 77,
-/* 0x24c0 */  73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x24d0 */  82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x24e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x24f0 */  91, 69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2500 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2510 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2520 */  48, 48, 48, 48, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x2530 */  54, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x2540 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2550 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73,
-/* 0x2560 */  78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x2570 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2580 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 57, 48, 32, 82,
-/* 0x2590 */  95, 77, 73, 80, 83, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25a0 */  32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1bd0 */ 120,101,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1be0 */   6,  0,  0,  0, 96,  2,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x1bf0 */   8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 60,  0,  0,  0,
+/* 0x1c00 */  44,  1,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,104,  1,  0,  0,
+/* 0x1c10 */  28,  1,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,132,  2,  0,  0,
+/* 0x1c20 */   0,  1,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,132,  3,  0,  0,
+/* 0x1c30 */ 156,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0, 32,  4,  0,  0,
+/* 0x1c40 */ 216, 10,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,248, 14,  0,  0,
+/* 0x1c50 */ 216, 10,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,208, 25,  0,  0,
+/* 0x1c60 */   4,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,212, 25,  0,  0,
+/* 0x1c70 */  16,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,228, 25,  0,  0,
+/* 0x1c80 */  16,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,244, 25,  0,  0,
+/* 0x1c90 */  36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 24, 26,  0,  0,
+/* 0x1ca0 */  42,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 68, 26,  0,  0,
+/* 0x1cb0 */ 148,  1,  0,  0,  2,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,  0,  0,  0,121,  0,  0,  0, 14,  0,  0,  0,
+/* 0x1da0 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */ 129,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   1,  0,  0,  0,124,  0,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,124,  0,  0,  0,
+/* 0x1de0 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   3,  0,  0,  0,100,  0,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1e10 */ 129,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */  12,  0,  0,  0,144,  1,  0,  0,141,  0,  0,  0, 14,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,
+/* 0x1e40 */   0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86,
+/* 0x1e50 */  50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x1e60 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1e70 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78,
+/* 0x1e80 */  82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,
+/* 0x1e90 */   0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,
+/* 0x1ea0 */   0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,
+/* 0x1eb0 */   0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 77, 73, 80, 83, 95,
+/* 0x1ec0 */  80, 67, 49, 54,  0, 82, 95, 77, 73, 80, 83, 95, 51, 50,  0,216,
+/* 0x1ed0 */  27,  0,  0, 85, 80, 88, 76
 };
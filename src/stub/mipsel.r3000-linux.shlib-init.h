@@ -1,5 +1,5 @@
 /* mipsel.r3000-linux.shlib-init.h
-   created from mipsel.r3000-linux.shlib-init.bin, 9846 (0x2676) bytes
+   created from mipsel.r3000-linux.shlib-init.bin, 8264 (0x2048) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_SIZE    9846
-#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_ADLER32 0x05c55647
-#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_CRC32   0x14e66e45
+#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_SIZE    8264
+#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_ADLER32 0x0d7b99d3
+#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_CRC32   0x94ad9949
 
-unsigned char stub_mipsel_r3000_linux_shlib_init[9846] = {
+unsigned char stub_mipsel_r3000_linux_shlib_init[8264] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  8,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 248, 29,  0,  0,  1,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -505,151 +505,52 @@ unsigned char stub_mipsel_r3000_linux_shlib_init[9846] = {
 /* 0x1d20 */  33, 40,128,  0, 33, 32,192,  0,  0,  0,  6, 36, 51, 16,  2, 36,
 /* 0x1d30 */  12,  0,  0,  0, 20,  0,185,143,  8,  0, 32,  3,  0,  0,  0,  0,
 /* 0x1d40 */ 248,255,231,140,  0, 60,  7,  0,  2, 60,  7,  0,255,255,231, 36,
-/* 0x1d50 */   8,  0,224,  3, 33, 48,199,  0,102,105,108,101, 32,102,111,114,
-/* 0x1d60 */ 109, 97,116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,
-/* 0x1d70 */ 109,105,112,115, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10,
-/* 0x1d80 */  73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d90 */  32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32,
-/* 0x1da0 */  32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1db0 */  70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32,
-/* 0x1dc0 */  70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1dd0 */  78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 56,
-/* 0x1de0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1df0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32,
-/* 0x1e00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1e10 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1e20 */  32, 32, 49, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e30 */  32, 32, 48, 48, 48, 48, 48, 49, 50, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1e40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e60 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1e70 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82,
-/* 0x1e80 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1e90 */  48, 49, 49, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1eb0 */  98, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ec0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1ed0 */  78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 66, 32, 32, 32,
-/* 0x1ee0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 48, 48, 32, 32,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50,100, 52, 32, 32, 50, 42,
-/* 0x1f10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1f20 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1f30 */  52, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f50 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1f60 */  48, 48, 48, 51,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1f70 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1f80 */  10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x1f90 */  32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32, 32, 48, 48, 48,
-/* 0x1fa0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1fb0 */  32, 48, 48, 48, 48, 48, 52, 55, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1fc0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1fd0 */  78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1fe0 */  49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32, 32,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 48, 32, 32, 48, 48, 48, 48, 48,102, 52, 56, 32, 32, 50, 42,
-/* 0x2010 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2020 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95,
-/* 0x2030 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2040 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 50, 48, 32,
-/* 0x2060 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2070 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 78, 82,
-/* 0x2080 */  86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x20a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x20b0 */  50, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x20c0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57,
-/* 0x20d0 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2100 */  48, 49, 97, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2110 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2120 */  32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32,
-/* 0x2130 */  32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32, 48, 48, 48, 48,
-/* 0x2140 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2150 */  48, 48, 48, 48, 49, 97, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2160 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2170 */  76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21a0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 54, 56, 32, 32, 50, 42, 42,
-/* 0x21b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x21c0 */  68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73,
-/* 0x21d0 */  78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 50,102, 48,
-/* 0x21e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x21f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 54, 56, 32, 32,
-/* 0x2200 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2210 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x2220 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2230 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2240 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65,
-/* 0x2250 */  73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2260 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2290 */  69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22a0 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48,
-/* 0x22b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x22c0 */  69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69,
-/* 0x22d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x22e0 */  32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22f0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2300 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x2320 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x2330 */  77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2340 */  48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x2350 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x2360 */  77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2370 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2380 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x2390 */  77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23a0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x23b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x23c0 */  77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x23e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x23f0 */  86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2400 */  78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2410 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,
-/* 0x2420 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70, 76, 85, 83, 72,
-/* 0x2430 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2440 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48,
-/* 0x2450 */  48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 79, 32, 69, 76,
-/* 0x2470 */  70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2480 */  95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2490 */ 103, 32, 32, 32, 32, 32, 79, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x24a0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,101,
-/* 0x24b0 */  99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x24c0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x24d0 */  32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70,
-/* 0x24e0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x24f0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2500 */  48, 48, 48, 48, 51, 99, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79,
-/* 0x2510 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 95,115,116, 97,114,116, 10,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 52, 99, 32, 82, 95, 77, 73, 80, 83, 95,
-/* 0x2530 */  76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x2540 */  73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x2550 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x2560 */  50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x2570 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2580 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82,
-/* 0x2590 */  95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x25a0 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67,
-/* 0x25b0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x25c0 */  82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x25d0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x25f0 */  48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54,
-/* 0x2600 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10,
-/* 0x2610 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2620 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58,
-/* 0x2630 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x2640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2650 */  69, 10, 48, 48, 48, 48, 48, 48, 54, 52, 32, 82, 95, 77, 73, 80,
-/* 0x2660 */  83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2670 */  95, 84, 65, 73, 76, 10
+/* 0x1d50 */   8,  0,224,  3, 33, 48,199,  0, 13,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1d60 */   5,  0,  0,  0, 72,  2,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x1d70 */  88,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,140,  0,  0,  0,
+/* 0x1d80 */  44,  1,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,184,  1,  0,  0,
+/* 0x1d90 */  28,  1,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,212,  2,  0,  0,
+/* 0x1da0 */   0,  1,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,212,  3,  0,  0,
+/* 0x1db0 */ 156,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,112,  4,  0,  0,
+/* 0x1dc0 */ 216, 10,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0, 72, 15,  0,  0,
+/* 0x1dd0 */ 216, 10,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 32, 26,  0,  0,
+/* 0x1de0 */   4,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0, 36, 26,  0,  0,
+/* 0x1df0 */  16,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0, 52, 26,  0,  0,
+/* 0x1e00 */  16,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 68, 26,  0,  0,
+/* 0x1e10 */  36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,104, 26,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,104, 26,  0,  0,
+/* 0x1e30 */ 240,  2,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,  0,  0,  0,121,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x1f30 */ 136,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0, 76,  0,  0,  0,136,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,124,  0,  0,  0,
+/* 0x1f60 */ 148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   2,  0,  0,  0,124,  0,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,100,  0,  0,  0,
+/* 0x1f90 */ 148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */  69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 50, 69,  0, 78,
+/* 0x1fb0 */  82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95,
+/* 0x1fc0 */  69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
+/* 0x1fd0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65,
+/* 0x1fe0 */  95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0,
+/* 0x1ff0 */  78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0,
+/* 0x2000 */  69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x2010 */  90,  0, 95,115,116, 97,114,116,  0,101,110,100, 95,100,101, 99,
+/* 0x2020 */ 111,109,112,114,101,115,115,  0, 82, 95, 77, 73, 80, 83, 95, 76,
+/* 0x2030 */  79, 49, 54,  0, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54,  0,
+/* 0x2040 */  88, 29,  0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* mipsel.r3000-ps1.h
-   created from mipsel.r3000-ps1.bin, 21417 (0x53a9) bytes
+   created from mipsel.r3000-ps1.bin, 14373 (0x3825) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPSEL_R3000_PS1_SIZE    21417
-#define STUB_MIPSEL_R3000_PS1_ADLER32 0x5c677fa6
-#define STUB_MIPSEL_R3000_PS1_CRC32   0xca99d669
+#define STUB_MIPSEL_R3000_PS1_SIZE    14373
+#define STUB_MIPSEL_R3000_PS1_ADLER32 0xe68eb26e
+#define STUB_MIPSEL_R3000_PS1_CRC32   0x68e76898
 
-unsigned char stub_mipsel_r3000_ps1[21417] = {
+unsigned char stub_mipsel_r3000_ps1[14373] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  8,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 152, 42,  0,  0,  1,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -679,700 +679,260 @@ unsigned char stub_mipsel_r3000_ps1[21417] = {
 /* 0x2800 */  36,  0,179,143, 32,  0,178,143, 28,  0,177,143, 24,  0,176,143,
 /* 0x2810 */   8,  0,224,  3, 56,  0,189, 39, 85, 80, 88, 33,161,216,208,213,
 /* 0x2820 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x2830 */   0,  0,  0,  0,  0,  0,  0, 45,102,105,108,101, 32,102,111,114,
-/* 0x2840 */ 109, 97,116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,
-/* 0x2850 */ 109,105,112,115, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10,
-/* 0x2860 */  73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2870 */  32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32,
-/* 0x2880 */  32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2890 */  70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32,
-/* 0x28a0 */  70,108, 97,103,115, 10, 32, 32, 48, 32, 99,100, 98, 46,115,116,
-/* 0x28b0 */  97,114,116, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 52,
-/* 0x28c0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x28d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32,
-/* 0x28e0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x28f0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2900 */  32, 32, 49, 32, 99,100, 98, 46,101,110,116,114,121, 32, 32, 32,
-/* 0x2910 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 99, 32, 32, 48, 48, 48, 48,
-/* 0x2920 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2930 */  48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2940 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2950 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 99,100,
-/* 0x2960 */  98, 46,115,116, 97,114,116, 46,108,122,109, 97, 32, 48, 48, 48,
-/* 0x2970 */  48, 48, 48, 49, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2980 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2990 */  48, 54, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x29a0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x29b0 */  79, 78, 76, 89, 10, 32, 32, 51, 32, 99,100, 98, 46,101,110,116,
-/* 0x29c0 */ 114,121, 46,108,122,109, 97, 32, 48, 48, 48, 48, 48, 48, 50, 48,
-/* 0x29d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x29e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 99, 32, 32,
-/* 0x29f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2a00 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2a10 */  32, 32, 52, 32, 99,100, 98, 46,108,122,109, 97, 46, 99,112,114,
-/* 0x2a20 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48,
-/* 0x2a30 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2a40 */  48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2a50 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2a60 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 99,100,
-/* 0x2a70 */  98, 46,100,101, 99, 46,112,116,114, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2a80 */  48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2a90 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2aa0 */  97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2ab0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2ac0 */  78, 76, 89, 10, 32, 32, 54, 32, 99,100, 98, 46,100,101, 99, 46,
-/* 0x2ad0 */ 112,116,114, 46,104,105, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x2ae0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2af0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 97, 99, 32, 32, 50,
-/* 0x2b00 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2b10 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2b20 */  32, 55, 32, 99,100, 98, 46,101,120,105,116, 32, 32, 32, 32, 32,
-/* 0x2b30 */  32, 48, 48, 48, 48, 48, 48, 50, 56, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2b40 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2b50 */  48, 48, 48, 48, 48, 98, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2b60 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2b70 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 99,111,110,
-/* 0x2b80 */  46,115,116, 97,114,116, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2b90 */  48, 51, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2ba0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100,
-/* 0x2bb0 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2bc0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2bd0 */  76, 89, 10, 32, 32, 57, 32, 99,111,110, 46,109, 99,112,121, 32,
-/* 0x2be0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 99, 32, 32, 48,
-/* 0x2bf0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c00 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 48, 56, 32, 32, 50, 42, 42,
-/* 0x2c10 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2c20 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48,
-/* 0x2c30 */  32,108,122,109, 97, 46,112,114,101,112, 32, 32, 32, 32, 32, 48,
-/* 0x2c40 */  48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c50 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2c60 */  48, 48, 49, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2c70 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2c80 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 99,111,110, 46,112,
-/* 0x2c90 */  97,100, 99,100, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ca0 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2cb0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 56, 32,
-/* 0x2cc0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2cd0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2ce0 */  10, 32, 49, 50, 32,100,101, 99, 46,112,116,114, 32, 32, 32, 32,
-/* 0x2cf0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48,
-/* 0x2d00 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d10 */  32, 48, 48, 48, 48, 48, 49, 50, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2d20 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2d30 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32,100,
-/* 0x2d40 */ 101, 99, 46,112,116,114, 46,104,105, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2d50 */  48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d60 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d70 */  49, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2d80 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2d90 */  79, 78, 76, 89, 10, 32, 49, 52, 32, 99,111,110, 46,101,110,116,
-/* 0x2da0 */ 114,121, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2db0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2dc0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 48, 32, 32, 50,
-/* 0x2dd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2de0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53, 32, 99,111,110, 46,
-/* 0x2df0 */ 101,120,105,116, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2e00 */  50, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2e10 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 48,
-/* 0x2e20 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2e30 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2e40 */  89, 10, 32, 49, 54, 32, 98,115,115, 46, 99,100, 98, 46,115,116,
-/* 0x2e50 */  97,114,116, 46,108,122,109, 97, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x2e60 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2e70 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 54, 99, 32,
-/* 0x2e80 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2e90 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2ea0 */  10, 32, 49, 55, 32, 98,115,115, 46, 99,100, 98, 46,101,110,116,
-/* 0x2eb0 */ 114,121, 46,108,122,109, 97, 32, 48, 48, 48, 48, 48, 48, 50, 52,
-/* 0x2ec0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2ed0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 56, 56, 32, 32,
-/* 0x2ee0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2ef0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2f00 */  32, 49, 56, 32, 98,115,115, 46, 99,111,110, 46,115,116, 97,114,
-/* 0x2f10 */ 116, 32, 48, 48, 48, 48, 48, 48, 51, 56, 32, 32, 48, 48, 48, 48,
-/* 0x2f20 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2f30 */  48, 48, 48, 48, 48, 49, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2f40 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2f50 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 57, 32, 98,115,
-/* 0x2f60 */ 115, 46,101,120,105,116, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2f70 */  48, 48, 50, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2f80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2f90 */ 101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2fa0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2fb0 */  78, 76, 89, 10, 32, 50, 48, 32,109,101,109,115,101,116, 46,115,
-/* 0x2fc0 */ 104,111,114,116, 32, 32, 48, 48, 48, 48, 48, 48, 49, 52, 32, 32,
-/* 0x2fd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2fe0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 48, 32, 32, 50, 42,
-/* 0x2ff0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3000 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50,
-/* 0x3010 */  49, 32,109,101,109,115,101,116, 46,108,111,110,103, 32, 32, 32,
-/* 0x3020 */  48, 48, 48, 48, 48, 48, 49, 56, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3030 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3040 */  48, 48, 48, 50, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3050 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3060 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 50, 32,110,114,118, 50,
-/* 0x3070 */  98, 46, 56, 98,105,116, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x3080 */ 101, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3090 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 51, 99,
-/* 0x30a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x30b0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x30c0 */  89, 10, 32, 50, 51, 32,110,114,118, 50,100, 46, 56, 98,105,116,
-/* 0x30d0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 50, 50, 56, 32, 32, 48, 48,
-/* 0x30e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30f0 */  32, 32, 48, 48, 48, 48, 48, 52, 50, 56, 32, 32, 50, 42, 42, 48,
-/* 0x3100 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3110 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 52, 32,
-/* 0x3120 */ 110,114,118, 50,101, 46, 56, 98,105,116, 32, 32, 32, 32, 48, 48,
-/* 0x3130 */  48, 48, 48, 50, 53, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3140 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3150 */  48, 54, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3160 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3170 */  68, 79, 78, 76, 89, 10, 32, 50, 53, 32,110,114,118, 50, 98, 46,
-/* 0x3180 */  51, 50, 98,105,116, 32, 32, 32, 48, 48, 48, 48, 48, 49,101, 99,
-/* 0x3190 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x31a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 56, 97, 48, 32, 32,
-/* 0x31b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x31c0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x31d0 */  32, 50, 54, 32,110,114,118, 50,100, 46, 51, 50, 98,105,116, 32,
-/* 0x31e0 */  32, 32, 48, 48, 48, 48, 48, 50, 50, 56, 32, 32, 48, 48, 48, 48,
-/* 0x31f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3200 */  48, 48, 48, 48, 48, 97, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3210 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3220 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55, 32,110,114,
-/* 0x3230 */ 118, 50,101, 46, 51, 50, 98,105,116, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3240 */  48, 50, 53, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3250 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 99,
-/* 0x3260 */  98, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3270 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3280 */  78, 76, 89, 10, 32, 50, 56, 32, 56, 98,105,116, 46,115,117, 98,
-/* 0x3290 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32,
-/* 0x32a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x32b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48,102, 48, 52, 32, 32, 50, 42,
-/* 0x32c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x32d0 */  65, 68, 79, 78, 76, 89, 10, 32, 50, 57, 32, 51, 50, 98,105,116,
-/* 0x32e0 */  46,115,117, 98, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50,
-/* 0x32f0 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3300 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,102, 50, 56, 32,
-/* 0x3310 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3320 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 48, 32,110,114,
-/* 0x3330 */ 118, 50, 98, 46,115,109, 97,108,108, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3340 */  48, 48,100, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3350 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,102,
-/* 0x3360 */  53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3370 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3380 */  78, 76, 89, 10, 32, 51, 49, 32,110,114,118, 50,100, 46,115,109,
-/* 0x3390 */  97,108,108, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 48, 32, 32,
-/* 0x33a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x33b0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 48, 50, 56, 32, 32, 50, 42,
-/* 0x33c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x33d0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x33e0 */  50, 32,110,114,118, 50,101, 46,115,109, 97,108,108, 32, 32, 32,
-/* 0x33f0 */  48, 48, 48, 48, 48, 49, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3400 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3410 */  48, 48, 49, 49, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3420 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3430 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 51, 32,110,114,118, 46,
-/* 0x3440 */ 100,111,110,101, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3450 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3460 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 49, 56,
-/* 0x3470 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3480 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32,100,
-/* 0x3490 */ 101, 99,111,109,112,114,101,115,115,111,114, 46,115,116, 97,114,
-/* 0x34a0 */ 116, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x34b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x34c0 */  48, 48, 48, 48, 49, 50, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x34d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x34e0 */  76, 89, 10, 32, 51, 53, 32,108,122,109, 97, 46,105,110,105,116,
-/* 0x34f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 48, 32, 32, 48,
-/* 0x3500 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3510 */  48, 32, 32, 48, 48, 48, 48, 49, 50, 49, 56, 32, 32, 50, 42, 42,
-/* 0x3520 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3530 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 54,
-/* 0x3540 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48,
-/* 0x3550 */  48, 48, 48, 48, 97,100, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3560 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3570 */  48, 49, 50, 54, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3580 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3590 */  32, 51, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32,
-/* 0x35a0 */  32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32, 32, 48, 48, 48, 48,
-/* 0x35b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x35c0 */  48, 48, 48, 48, 49,100, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x35d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x35e0 */  76, 89, 10, 32, 51, 56, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32,
-/* 0x35f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 48, 32, 32, 48,
-/* 0x3600 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3610 */  48, 32, 32, 48, 48, 48, 48, 50, 56, 49, 56, 32, 32, 50, 42, 42,
-/* 0x3620 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3630 */  68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66,
-/* 0x3640 */  76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3650 */  32, 32,100, 32, 32,110,114,118, 46,100,111,110,101,  9, 48, 48,
-/* 0x3660 */  48, 48, 48, 48, 48, 48, 32,110,114,118, 46,100,111,110,101, 10,
-/* 0x3670 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3680 */  32,100,101, 99,111,109,112,114,101,115,115,111,114, 46,115,116,
-/* 0x3690 */  97,114,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,100,101, 99,
-/* 0x36a0 */ 111,109,112,114,101,115,115,111,114, 46,115,116, 97,114,116, 10,
-/* 0x36b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x36c0 */  32, 99,100, 98, 46,115,116, 97,114,116,  9, 48, 48, 48, 48, 48,
-/* 0x36d0 */  48, 48, 48, 32, 99,100, 98, 46,115,116, 97,114,116, 10, 48, 48,
-/* 0x36e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x36f0 */ 100, 98, 46,101,110,116,114,121,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3700 */  48, 32, 99,100, 98, 46,101,110,116,114,121, 10, 48, 48, 48, 48,
-/* 0x3710 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,100, 98,
-/* 0x3720 */  46,115,116, 97,114,116, 46,108,122,109, 97,  9, 48, 48, 48, 48,
-/* 0x3730 */  48, 48, 48, 48, 32, 99,100, 98, 46,115,116, 97,114,116, 46,108,
-/* 0x3740 */ 122,109, 97, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3750 */  32, 32,100, 32, 32, 99,100, 98, 46,101,110,116,114,121, 46,108,
-/* 0x3760 */ 122,109, 97,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,100, 98,
-/* 0x3770 */  46,101,110,116,114,121, 46,108,122,109, 97, 10, 48, 48, 48, 48,
-/* 0x3780 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,100, 98,
-/* 0x3790 */  46,108,122,109, 97, 46, 99,112,114,  9, 48, 48, 48, 48, 48, 48,
-/* 0x37a0 */  48, 48, 32, 99,100, 98, 46,108,122,109, 97, 46, 99,112,114, 10,
-/* 0x37b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x37c0 */  32, 99,100, 98, 46,100,101, 99, 46,112,116,114,  9, 48, 48, 48,
-/* 0x37d0 */  48, 48, 48, 48, 48, 32, 99,100, 98, 46,100,101, 99, 46,112,116,
-/* 0x37e0 */ 114, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x37f0 */ 100, 32, 32, 99,100, 98, 46,100,101, 99, 46,112,116,114, 46,104,
-/* 0x3800 */ 105,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,100, 98, 46,100,
-/* 0x3810 */ 101, 99, 46,112,116,114, 46,104,105, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3820 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,100, 98, 46,101,
-/* 0x3830 */ 120,105,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,100, 98,
-/* 0x3840 */  46,101,120,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3850 */  32, 32, 32, 32,100, 32, 32, 99,111,110, 46,115,116, 97,114,116,
-/* 0x3860 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,111,110, 46,115,116,
-/* 0x3870 */  97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3880 */  32, 32,100, 32, 32, 99,111,110, 46,109, 99,112,121,  9, 48, 48,
-/* 0x3890 */  48, 48, 48, 48, 48, 48, 32, 99,111,110, 46,109, 99,112,121, 10,
-/* 0x38a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x38b0 */  32,108,122,109, 97, 46,112,114,101,112,  9, 48, 48, 48, 48, 48,
-/* 0x38c0 */  48, 48, 48, 32,108,122,109, 97, 46,112,114,101,112, 10, 48, 48,
-/* 0x38d0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x38e0 */ 111,110, 46,112, 97,100, 99,100,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38f0 */  48, 32, 99,111,110, 46,112, 97,100, 99,100, 10, 48, 48, 48, 48,
-/* 0x3900 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,100,101, 99,
-/* 0x3910 */  46,112,116,114,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,100,101,
-/* 0x3920 */  99, 46,112,116,114, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3930 */  32, 32, 32, 32,100, 32, 32,100,101, 99, 46,112,116,114, 46,104,
-/* 0x3940 */ 105,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,100,101, 99, 46,112,
-/* 0x3950 */ 116,114, 46,104,105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3960 */  32, 32, 32, 32,100, 32, 32, 99,111,110, 46,101,110,116,114,121,
-/* 0x3970 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,111,110, 46,101,110,
-/* 0x3980 */ 116,114,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3990 */  32, 32,100, 32, 32, 99,111,110, 46,101,120,105,116,  9, 48, 48,
-/* 0x39a0 */  48, 48, 48, 48, 48, 48, 32, 99,111,110, 46,101,120,105,116, 10,
-/* 0x39b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x39c0 */  32, 98,115,115, 46, 99,100, 98, 46,115,116, 97,114,116, 46,108,
-/* 0x39d0 */ 122,109, 97,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 98,115,115,
-/* 0x39e0 */  46, 99,100, 98, 46,115,116, 97,114,116, 46,108,122,109, 97, 10,
-/* 0x39f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3a00 */  32, 98,115,115, 46, 99,100, 98, 46,101,110,116,114,121, 46,108,
-/* 0x3a10 */ 122,109, 97,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 98,115,115,
-/* 0x3a20 */  46, 99,100, 98, 46,101,110,116,114,121, 46,108,122,109, 97, 10,
-/* 0x3a30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3a40 */  32, 98,115,115, 46, 99,111,110, 46,115,116, 97,114,116,  9, 48,
-/* 0x3a50 */  48, 48, 48, 48, 48, 48, 48, 32, 98,115,115, 46, 99,111,110, 46,
-/* 0x3a60 */ 115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3a70 */  32, 32, 32, 32,100, 32, 32, 98,115,115, 46,101,120,105,116,  9,
-/* 0x3a80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 98,115,115, 46,101,120,105,
-/* 0x3a90 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3aa0 */ 100, 32, 32,109,101,109,115,101,116, 46,115,104,111,114,116,  9,
-/* 0x3ab0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,109,101,109,115,101,116, 46,
-/* 0x3ac0 */ 115,104,111,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3ad0 */  32, 32, 32, 32,100, 32, 32,109,101,109,115,101,116, 46,108,111,
-/* 0x3ae0 */ 110,103,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,109,101,109,115,
-/* 0x3af0 */ 101,116, 46,108,111,110,103, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b00 */  32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50, 98, 46, 56,
-/* 0x3b10 */  98,105,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,114,118,
-/* 0x3b20 */  50, 98, 46, 56, 98,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b30 */  32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,100, 46, 56,
-/* 0x3b40 */  98,105,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,114,118,
-/* 0x3b50 */  50,100, 46, 56, 98,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b60 */  32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,101, 46, 56,
-/* 0x3b70 */  98,105,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,114,118,
-/* 0x3b80 */  50,101, 46, 56, 98,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b90 */  32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50, 98, 46, 51,
-/* 0x3ba0 */  50, 98,105,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,114,
-/* 0x3bb0 */ 118, 50, 98, 46, 51, 50, 98,105,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3bc0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,100,
-/* 0x3bd0 */  46, 51, 50, 98,105,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3be0 */ 110,114,118, 50,100, 46, 51, 50, 98,105,116, 10, 48, 48, 48, 48,
-/* 0x3bf0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118,
-/* 0x3c00 */  50,101, 46, 51, 50, 98,105,116,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c10 */  48, 32,110,114,118, 50,101, 46, 51, 50, 98,105,116, 10, 48, 48,
-/* 0x3c20 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 56,
-/* 0x3c30 */  98,105,116, 46,115,117, 98,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c40 */  32, 56, 98,105,116, 46,115,117, 98, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3c50 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 51, 50, 98,105,116,
-/* 0x3c60 */  46,115,117, 98,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 51, 50,
-/* 0x3c70 */  98,105,116, 46,115,117, 98, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c80 */  32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50, 98, 46,115,
-/* 0x3c90 */ 109, 97,108,108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,114,
-/* 0x3ca0 */ 118, 50, 98, 46,115,109, 97,108,108, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3cb0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,100,
-/* 0x3cc0 */  46,115,109, 97,108,108,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3cd0 */ 110,114,118, 50,100, 46,115,109, 97,108,108, 10, 48, 48, 48, 48,
-/* 0x3ce0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118,
-/* 0x3cf0 */  50,101, 46,115,109, 97,108,108,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d00 */  48, 32,110,114,118, 50,101, 46,115,109, 97,108,108, 10, 48, 48,
-/* 0x3d10 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,
-/* 0x3d20 */ 122,109, 97, 46,105,110,105,116,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d30 */  48, 32,108,122,109, 97, 46,105,110,105,116, 10, 48, 48, 48, 48,
-/* 0x3d40 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x3d50 */  65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d60 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3d70 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x3d80 */  65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d90 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3da0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88,
-/* 0x3db0 */  49, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 85,
-/* 0x3dc0 */  80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3dd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x3de0 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 83, 86, 82, 10, 48, 48, 48,
-/* 0x3df0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x3e00 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 80, 68,
-/* 0x3e10 */  79, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3e20 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e30 */  48, 32,108,100,114, 95,115,122, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e40 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x3e50 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95, 99,112,
-/* 0x3e60 */ 114, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3e70 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e80 */  48, 32, 68, 69, 67, 79, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3e90 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x3ea0 */  48, 48, 48, 48, 48, 48, 32,101,110,116,114,121, 10, 48, 48, 48,
-/* 0x3eb0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x3ec0 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 68, 67, 82,
-/* 0x3ed0 */  84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3ee0 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ef0 */  48, 32,108,122,109, 97, 95,105,110,105,116, 95,111,102,102, 10,
-/* 0x3f00 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f10 */  32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3f20 */  80, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x3f30 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x3f40 */  48, 48, 48, 32,119,114,107,109,101,109, 10, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x3f60 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 83, 67, 10, 48, 48,
-/* 0x3f70 */  48, 48, 48, 48, 49, 52, 32,103, 32, 32, 32, 32, 32, 79, 32, 56,
-/* 0x3f80 */  98,105,116, 46,115,117, 98,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f90 */  32,103, 98, 56, 95,101, 10, 48, 48, 48, 48, 48, 48, 49, 99, 32,
-/* 0x3fa0 */ 103, 32, 32, 32, 32, 32, 79, 32, 51, 50, 98,105,116, 46,115,117,
-/* 0x3fb0 */  98,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 98, 51, 50, 95,
-/* 0x3fc0 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3fd0 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fe0 */  48, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x4000 */  48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,115,116, 97, 99,
-/* 0x4010 */ 107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4020 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x4030 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95, 99, 95,
-/* 0x4040 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x4050 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x4060 */  48, 48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48,
-/* 0x4070 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4080 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4090 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 10,
-/* 0x40a0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x40b0 */  68, 83, 32, 70, 79, 82, 32, 91, 99,100, 98, 46,115,116, 97,114,
-/* 0x40c0 */ 116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x40d0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x40e0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95,
-/* 0x40f0 */  77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4100 */  80, 83, 86, 82, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x4110 */  77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4120 */  80, 83, 86, 82, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4130 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,100,
-/* 0x4140 */  98, 46,101,110,116,114,121, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4150 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4160 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4170 */  48, 49, 52, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32,
-/* 0x4180 */  32, 32, 32, 32, 32, 32, 67, 80, 68, 79, 10, 48, 48, 48, 48, 48,
-/* 0x4190 */  48, 49, 56, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32,
-/* 0x41a0 */  32, 32, 32, 32, 32, 32, 67, 80, 68, 79, 10, 10, 82, 69, 76, 79,
-/* 0x41b0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x41c0 */  79, 82, 32, 91, 99,100, 98, 46,115,116, 97,114,116, 46,108,122,
-/* 0x41d0 */ 109, 97, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x41e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x41f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82,
-/* 0x4200 */  95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4210 */  32, 80, 83, 86, 82, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x4220 */  95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4230 */  32, 80, 83, 86, 82, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82,
-/* 0x4240 */  95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4250 */  32,108,100,114, 95,115,122, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4260 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4270 */  91, 99,100, 98, 46,101,110,116,114,121, 46,108,122,109, 97, 93,
-/* 0x4280 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4290 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x42a0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 77, 73,
-/* 0x42b0 */  80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x42c0 */ 109, 97, 95, 99,112,114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x42d0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x42e0 */  99,100, 98, 46,108,122,109, 97, 46, 99,112,114, 93, 58, 10, 79,
-/* 0x42f0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4300 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4310 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95,
-/* 0x4320 */  72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 67, 80, 68, 79, 10,
-/* 0x4330 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77, 73, 80, 83, 95,
-/* 0x4340 */  76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 67, 80, 68, 79, 10,
-/* 0x4350 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4360 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,100, 98, 46,100,101, 99,
-/* 0x4370 */  46,112,116,114, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4380 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4390 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43a0 */  32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32,
-/* 0x43b0 */  32, 32, 32, 68, 69, 67, 79, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x43c0 */  32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32,
-/* 0x43d0 */  32, 32, 32, 68, 69, 67, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x43e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x43f0 */  91, 99,100, 98, 46,100,101, 99, 46,112,116,114, 46,104,105, 93,
-/* 0x4400 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4410 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4420 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73,
-/* 0x4430 */  80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 69,
-/* 0x4440 */  67, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4450 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,100, 98, 46,
-/* 0x4460 */ 101,120,105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4470 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4480 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 50, 48,
-/* 0x4490 */  32, 82, 95, 77, 73, 80, 83, 95, 50, 54, 32, 32, 32, 32, 32, 32,
-/* 0x44a0 */  32, 32, 32,101,110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x44b0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x44c0 */  32, 91, 99,111,110, 46,115,116, 97,114,116, 93, 58, 10, 79, 70,
-/* 0x44d0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x44e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x44f0 */  48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76,
-/* 0x4500 */  79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,100,114, 95,115,122,
-/* 0x4510 */  10, 48, 48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4520 */  95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 67, 82, 84,
-/* 0x4530 */  10, 48, 48, 48, 48, 48, 48, 50, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4540 */  95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 67, 82, 84,
-/* 0x4550 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4560 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,111,110, 46,109, 99,
-/* 0x4570 */ 112,121, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4580 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4590 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82,
-/* 0x45a0 */  95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x45b0 */  32,108,100,114, 95,115,122, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x45c0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x45d0 */  91,108,122,109, 97, 46,112,114,101,112, 93, 58, 10, 79, 70, 70,
-/* 0x45e0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x45f0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4600 */  48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79,
-/* 0x4610 */  49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,105,110,
-/* 0x4620 */ 105,116, 95,111,102,102, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4630 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4640 */  99,111,110, 46,112, 97,100, 99,100, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4650 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4660 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4670 */  48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49,
-/* 0x4680 */  54, 32, 32, 32, 32, 32, 32, 32, 80, 65, 68, 10, 10, 82, 69, 76,
-/* 0x4690 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x46a0 */  70, 79, 82, 32, 91,100,101, 99, 46,112,116,114, 93, 58, 10, 79,
-/* 0x46b0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x46c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x46d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95,
-/* 0x46e0 */  72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 69, 67, 79, 10,
-/* 0x46f0 */  48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 77, 73, 80, 83, 95,
-/* 0x4700 */  76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 69, 67, 79, 10,
-/* 0x4710 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4720 */  82, 68, 83, 32, 70, 79, 82, 32, 91,100,101, 99, 46,112,116,114,
-/* 0x4730 */  46,104,105, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4740 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4750 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x4760 */  82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32,
-/* 0x4770 */  32, 32, 68, 69, 67, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4780 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4790 */  99,111,110, 46,101,120,105,116, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x47a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x47c0 */  48, 48, 50, 52, 32, 82, 95, 77, 73, 80, 83, 95, 50, 54, 32, 32,
-/* 0x47d0 */  32, 32, 32, 32, 32, 32, 32,101,110,116,114,121, 10, 10, 82, 69,
-/* 0x47e0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x47f0 */  32, 70, 79, 82, 32, 91, 98,115,115, 46, 99,100, 98, 46,115,116,
-/* 0x4800 */  97,114,116, 46,108,122,109, 97, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4810 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4820 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4830 */  48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54,
-/* 0x4840 */  32, 32, 32, 32, 32, 32, 32, 80, 83, 86, 82, 10, 48, 48, 48, 48,
-/* 0x4850 */  48, 48, 48, 52, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,
-/* 0x4860 */  32, 32, 32, 32, 32, 32, 32, 80, 83, 86, 82, 10, 48, 48, 48, 48,
-/* 0x4870 */  48, 48, 48, 99, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54,
-/* 0x4880 */  32, 32, 32, 32, 32, 32, 32,119,114,107,109,101,109, 10, 48, 48,
-/* 0x4890 */  48, 48, 48, 48, 49, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79,
-/* 0x48a0 */  49, 54, 32, 32, 32, 32, 32, 32, 32,119,114,107,109,101,109, 10,
-/* 0x48b0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x48c0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 98,115,115, 46, 99,100, 98,
-/* 0x48d0 */  46,101,110,116,114,121, 46,108,122,109, 97, 93, 58, 10, 79, 70,
-/* 0x48e0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x48f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4900 */  48, 48, 48, 48, 48, 49, 99, 32, 82, 95, 77, 73, 80, 83, 95, 76,
-/* 0x4910 */  79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99,
-/* 0x4920 */ 112,114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4930 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 98,115,115, 46,
-/* 0x4940 */  99,111,110, 46,115,116, 97,114,116, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4950 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4960 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4970 */  48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49,
-/* 0x4980 */  54, 32, 32, 32, 32, 32, 32, 32,119,114,107,109,101,109, 10, 48,
-/* 0x4990 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77, 73, 80, 83, 95, 76,
-/* 0x49a0 */  79, 49, 54, 32, 32, 32, 32, 32, 32, 32,119,114,107,109,101,109,
-/* 0x49b0 */  10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 77, 73, 80, 83,
-/* 0x49c0 */  95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 67, 82, 84,
-/* 0x49d0 */  10, 48, 48, 48, 48, 48, 48, 51, 52, 32, 82, 95, 77, 73, 80, 83,
-/* 0x49e0 */  95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 67, 82, 84,
-/* 0x49f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4a00 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 98,115,115, 46,101,120,
-/* 0x4a10 */ 105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4a20 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a30 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 50, 52, 32, 82,
-/* 0x4a40 */  95, 77, 73, 80, 83, 95, 50, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a50 */  32,101,110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4a60 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4a70 */ 109,101,109,115,101,116, 46,115,104,111,114,116, 93, 58, 10, 79,
-/* 0x4a80 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4a90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4aa0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95,
-/* 0x4ab0 */  76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 83, 67, 10, 10, 82,
-/* 0x4ac0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4ad0 */  83, 32, 70, 79, 82, 32, 91,109,101,109,115,101,116, 46,108,111,
-/* 0x4ae0 */ 110,103, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4af0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b00 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82,
-/* 0x4b10 */  95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4b20 */  32, 83, 67, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4b30 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,118,
-/* 0x4b40 */  50, 98, 46, 56, 98,105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4b50 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b60 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4b70 */  48, 99, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32,
-/* 0x4b80 */  32, 32, 32, 32, 32, 32,110,114,118, 46,100,111,110,101, 10, 10,
-/* 0x4b90 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4ba0 */  68, 83, 32, 70, 79, 82, 32, 91,110,114,118, 50,100, 46, 56, 98,
-/* 0x4bb0 */ 105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4bc0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4bd0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 49, 99, 32, 82,
-/* 0x4be0 */  95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4bf0 */  32,110,114,118, 46,100,111,110,101, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4c00 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4c10 */  82, 32, 91,110,114,118, 50,101, 46, 56, 98,105,116, 93, 58, 10,
-/* 0x4c20 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4c30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4c40 */  10, 48, 48, 48, 48, 48, 49, 49, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4c50 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,110,114,118, 46,
-/* 0x4c60 */ 100,111,110,101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4c70 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,
-/* 0x4c80 */ 118, 50, 98, 46, 51, 50, 98,105,116, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4c90 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ca0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4cb0 */  48, 48, 48, 99, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x4cc0 */  54, 32, 32, 32, 32, 32, 32, 32,110,114,118, 46,100,111,110,101,
-/* 0x4cd0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4ce0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,118, 50,100, 46,
-/* 0x4cf0 */  51, 50, 98,105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4d00 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d10 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 49,
-/* 0x4d20 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4d30 */  32, 32, 32, 32,110,114,118, 46,100,111,110,101, 10, 10, 82, 69,
-/* 0x4d40 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4d50 */  32, 70, 79, 82, 32, 91,110,114,118, 50,101, 46, 51, 50, 98,105,
-/* 0x4d60 */ 116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4d70 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x4d80 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 49, 99, 32, 82, 95,
-/* 0x4d90 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4da0 */ 110,114,118, 46,100,111,110,101, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4db0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4dc0 */  32, 91,110,114,118, 50, 98, 46,115,109, 97,108,108, 93, 58, 10,
-/* 0x4dd0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4de0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4df0 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4e00 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x4e10 */  10, 48, 48, 48, 48, 48, 48, 50, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4e20 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x4e30 */  10, 48, 48, 48, 48, 48, 48, 51, 52, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4e40 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x4e50 */  10, 48, 48, 48, 48, 48, 48, 54, 52, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4e60 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,110,114,118, 46,
-/* 0x4e70 */ 100,111,110,101, 10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95,
-/* 0x4e80 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e90 */ 103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95,
-/* 0x4ea0 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4eb0 */ 103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95,
-/* 0x4ec0 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ed0 */ 103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95,
-/* 0x4ee0 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ef0 */ 103, 98, 95,101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4f00 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,
-/* 0x4f10 */ 118, 50,100, 46,115,109, 97,108,108, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4f20 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f30 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4f40 */  48, 48, 48, 48, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x4f50 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x4f60 */  48, 48, 48, 50, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x4f70 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x4f80 */  48, 48, 48, 51, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x4f90 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x4fa0 */  48, 48, 48, 52, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x4fb0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x4fc0 */  48, 48, 48, 53, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x4fd0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x4fe0 */  48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x4ff0 */  54, 32, 32, 32, 32, 32, 32, 32,110,114,118, 46,100,111,110,101,
-/* 0x5000 */  10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82, 95, 77, 73, 80, 83,
-/* 0x5010 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x5020 */  10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x5030 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x5040 */  10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 77, 73, 80, 83,
-/* 0x5050 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x5060 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5070 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,118, 50,101, 46,
-/* 0x5080 */ 115,109, 97,108,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5090 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50a0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50b0 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x50c0 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x50d0 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x50e0 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 51,
-/* 0x50f0 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x5100 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x5110 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x5120 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 53,
-/* 0x5130 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x5140 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x5150 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x5160 */  32, 32, 32, 32,110,114,118, 46,100,111,110,101, 10, 48, 48, 48,
-/* 0x5170 */  48, 48, 48, 57, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x5180 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x5190 */  48, 48, 48, 97, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x51a0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x51b0 */  48, 48, 48, 98, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x51c0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x51d0 */  48, 48, 48, 99, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x51e0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 10, 82, 69,
-/* 0x51f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5200 */  32, 70, 79, 82, 32, 91,108,122,109, 97, 46,105,110,105,116, 93,
-/* 0x5210 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5220 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5230 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73,
-/* 0x5240 */  80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x5250 */ 109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10,
-/* 0x5260 */  48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 77, 73, 80, 83, 95,
-/* 0x5270 */  72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x5280 */  99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82,
-/* 0x5290 */  95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x52a0 */  32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x52b0 */  48, 48, 49, 52, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54,
-/* 0x52c0 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,
-/* 0x52d0 */ 110, 10, 48, 48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 77, 73, 80,
-/* 0x52e0 */  83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x52f0 */  97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 52,
-/* 0x5300 */  32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32,
-/* 0x5310 */  32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
-/* 0x5320 */ 101,115, 10, 48, 48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 77, 73,
-/* 0x5330 */  80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x5340 */ 109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 48, 48,
-/* 0x5350 */  48, 48, 48, 48, 51, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67,
-/* 0x5360 */  49, 54, 32, 32, 32, 32, 32, 32, 32,100,101, 99,111,109,112,114,
-/* 0x5370 */ 101,115,115,111,114, 46,115,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x5380 */  48, 48, 52, 52, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,
-/* 0x5390 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,
-/* 0x53a0 */ 107, 95, 97,100,106,117,115,116, 10
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  0, 45, 39,  0,  0,  0, 57,  0,  0,  0,
+/* 0x2840 */  78,  0,  0,  0, 96, 13,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x2850 */  20,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 72,  0,  0,  0,
+/* 0x2860 */  28,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,100,  0,  0,  0,
+/* 0x2870 */  24,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,124,  0,  0,  0,
+/* 0x2880 */  32,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,156,  0,  0,  0,
+/* 0x2890 */   8,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,164,  0,  0,  0,
+/* 0x28a0 */   8,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,172,  0,  0,  0,
+/* 0x28b0 */   4,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,176,  0,  0,  0,
+/* 0x28c0 */  40,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,216,  0,  0,  0,
+/* 0x28d0 */  48,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,  8,  1,  0,  0,
+/* 0x28e0 */  28,  0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0, 36,  1,  0,  0,
+/* 0x28f0 */   4,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0, 40,  1,  0,  0,
+/* 0x2900 */   4,  0,  0,  0,  0,  0,  0,  0,138,  0,  0,  0, 44,  1,  0,  0,
+/* 0x2910 */  12,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,  0, 56,  1,  0,  0,
+/* 0x2920 */   8,  0,  0,  0,  0,  0,  0,  0,157,  0,  0,  0, 64,  1,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,  0, 64,  1,  0,  0,
+/* 0x2940 */  44,  0,  0,  0,  0,  0,  0,  0,176,  0,  0,  0,108,  1,  0,  0,
+/* 0x2950 */  28,  0,  0,  0,  0,  0,  0,  0,195,  0,  0,  0,136,  1,  0,  0,
+/* 0x2960 */  36,  0,  0,  0,  0,  0,  0,  0,214,  0,  0,  0,172,  1,  0,  0,
+/* 0x2970 */  56,  0,  0,  0,  0,  0,  0,  0,228,  0,  0,  0,228,  1,  0,  0,
+/* 0x2980 */  44,  0,  0,  0,  0,  0,  0,  0,237,  0,  0,  0, 16,  2,  0,  0,
+/* 0x2990 */  20,  0,  0,  0,  0,  0,  0,  0,250,  0,  0,  0, 36,  2,  0,  0,
+/* 0x29a0 */  24,  0,  0,  0,  0,  0,  0,  0,  6,  1,  0,  0, 60,  2,  0,  0,
+/* 0x29b0 */ 236,  1,  0,  0,  0,  0,  0,  0, 17,  1,  0,  0, 40,  4,  0,  0,
+/* 0x29c0 */  40,  2,  0,  0,  0,  0,  0,  0, 28,  1,  0,  0, 80,  6,  0,  0,
+/* 0x29d0 */  80,  2,  0,  0,  0,  0,  0,  0, 39,  1,  0,  0,160,  8,  0,  0,
+/* 0x29e0 */ 236,  1,  0,  0,  0,  0,  0,  0, 51,  1,  0,  0,140, 10,  0,  0,
+/* 0x29f0 */  40,  2,  0,  0,  0,  0,  0,  0, 63,  1,  0,  0,180, 12,  0,  0,
+/* 0x2a00 */  80,  2,  0,  0,  0,  0,  0,  0, 75,  1,  0,  0,  4, 15,  0,  0,
+/* 0x2a10 */  36,  0,  0,  0,  0,  0,  0,  0, 84,  1,  0,  0, 40, 15,  0,  0,
+/* 0x2a20 */  44,  0,  0,  0,  0,  0,  0,  0, 94,  1,  0,  0, 84, 15,  0,  0,
+/* 0x2a30 */ 212,  0,  0,  0,  0,  0,  0,  0,106,  1,  0,  0, 40, 16,  0,  0,
+/* 0x2a40 */ 240,  0,  0,  0,  0,  0,  0,  0,118,  1,  0,  0, 24, 17,  0,  0,
+/* 0x2a50 */   0,  1,  0,  0,  0,  0,  0,  0,130,  1,  0,  0, 24, 18,  0,  0,
+/* 0x2a60 */   0,  0,  0,  0,  0,  0,  0,  0,139,  1,  0,  0, 24, 18,  0,  0,
+/* 0x2a70 */   0,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 24, 18,  0,  0,
+/* 0x2a80 */  80,  0,  0,  0,  0,  0,  0,  0,168,  1,  0,  0,104, 18,  0,  0,
+/* 0x2a90 */ 216, 10,  0,  0,  0,  0,  0,  0,179,  1,  0,  0, 64, 29,  0,  0,
+/* 0x2aa0 */ 216, 10,  0,  0,  0,  0,  0,  0,190,  1,  0,  0, 24, 40,  0,  0,
+/* 0x2ab0 */  32,  0,  0,  0,  0,  0,  0,  0,130,  1,  0,  0, 33,  0,  0,  0,
+/* 0x2ac0 */   0,  0,  0,  0,  0,  0,  0,  0,139,  1,  0,  0, 34,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2af0 */   0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2b00 */   0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2b20 */   0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2b30 */   0,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,  6,  0,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2b50 */   0,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2b60 */   0,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2b80 */   0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2b90 */   0,  0,  0,  0,  0,  0,  0,  0,138,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,  0, 13,  0,  0,  0,
+/* 0x2bb0 */   0,  0,  0,  0,  0,  0,  0,  0,157,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2bc0 */   0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0,  0,  0,176,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2be0 */   0,  0,  0,  0,  0,  0,  0,  0,195,  0,  0,  0, 17,  0,  0,  0,
+/* 0x2bf0 */   0,  0,  0,  0,  0,  0,  0,  0,214,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0,  0,  0,228,  0,  0,  0, 19,  0,  0,  0,
+/* 0x2c10 */   0,  0,  0,  0,  0,  0,  0,  0,237,  0,  0,  0, 20,  0,  0,  0,
+/* 0x2c20 */   0,  0,  0,  0,  0,  0,  0,  0,250,  0,  0,  0, 21,  0,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  1,  0,  0, 22,  0,  0,  0,
+/* 0x2c40 */   0,  0,  0,  0,  0,  0,  0,  0, 17,  1,  0,  0, 23,  0,  0,  0,
+/* 0x2c50 */   0,  0,  0,  0,  0,  0,  0,  0, 28,  1,  0,  0, 24,  0,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,  0,  0,  0,  0, 39,  1,  0,  0, 25,  0,  0,  0,
+/* 0x2c70 */   0,  0,  0,  0,  0,  0,  0,  0, 51,  1,  0,  0, 26,  0,  0,  0,
+/* 0x2c80 */   0,  0,  0,  0,  0,  0,  0,  0, 63,  1,  0,  0, 27,  0,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0,  0,  0, 75,  1,  0,  0, 28,  0,  0,  0,
+/* 0x2ca0 */   0,  0,  0,  0,  0,  0,  0,  0, 84,  1,  0,  0, 29,  0,  0,  0,
+/* 0x2cb0 */   0,  0,  0,  0,  0,  0,  0,  0, 94,  1,  0,  0, 30,  0,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,  0,106,  1,  0,  0, 31,  0,  0,  0,
+/* 0x2cd0 */   0,  0,  0,  0,  0,  0,  0,  0,118,  1,  0,  0, 32,  0,  0,  0,
+/* 0x2ce0 */   0,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 35,  0,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0,  0,  0,168,  1,  0,  0, 36,  0,  0,  0,
+/* 0x2d00 */   0,  0,  0,  0,  0,  0,  0,  0,179,  1,  0,  0, 37,  0,  0,  0,
+/* 0x2d10 */   0,  0,  0,  0,  0,  0,  0,  0,190,  1,  0,  0, 38,  0,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0,  0,  0,199,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2d30 */ 173,222,173,222,  0,  0,  0,  0,204,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2d40 */ 173,222,173,222,  0,  0,  0,  0,209,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2d50 */ 173,222,173,222,  0,  0,  0,  0,216,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2d60 */ 173,222,173,222,  0,  0,  0,  0,225,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2d70 */ 173,222,173,222,  0,  0,  0,  0,230,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2d80 */ 173,222,173,222,  0,  0,  0,  0,236,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2d90 */ 173,222,173,222,  0,  0,  0,  0,241,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2da0 */ 173,222,173,222,  0,  0,  0,  0,255,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2db0 */ 173,222,173,222,  0,  0,  0,  0,  3,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2dc0 */ 173,222,173,222,  0,  0,  0,  0, 10,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2dd0 */ 173,222,173,222,  0,  0,  0,  0, 13,  2,  0,  0, 28,  0,  0,  0,
+/* 0x2de0 */  20,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 29,  0,  0,  0,
+/* 0x2df0 */  28,  0,  0,  0,  0,  0,  0,  0, 26,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2e00 */ 173,222,173,222,  0,  0,  0,  0, 31,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2e10 */ 173,222,173,222,  0,  0,  0,  0, 49,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2e20 */ 173,222,173,222,  0,  0,  0,  0, 60,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2e30 */ 173,222,173,222,  0,  0,  0,  0, 71,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2e40 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e50 */  87,  2,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e60 */   0,  0,  0,  0,  4,  0,  0,  0, 99,  2,  0,  0, 39,  0,  0,  0,
+/* 0x2e70 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 20,  0,  0,  0,
+/* 0x2e80 */  87,  2,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e90 */   1,  0,  0,  0, 24,  0,  0,  0, 99,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2ea0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */  87,  2,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ec0 */   2,  0,  0,  0,  4,  0,  0,  0, 99,  2,  0,  0, 39,  0,  0,  0,
+/* 0x2ed0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2ee0 */  99,  2,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ef0 */   3,  0,  0,  0, 24,  0,  0,  0, 99,  2,  0,  0, 42,  0,  0,  0,
+/* 0x2f00 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */  87,  2,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f20 */   4,  0,  0,  0,  4,  0,  0,  0, 99,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2f30 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */  87,  2,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f50 */   5,  0,  0,  0,  4,  0,  0,  0, 99,  2,  0,  0, 43,  0,  0,  0,
+/* 0x2f60 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */  87,  2,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f80 */   7,  0,  0,  0, 32,  0,  0,  0,111,  2,  0,  0, 44,  0,  0,  0,
+/* 0x2f90 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */  99,  2,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fb0 */   8,  0,  0,  0, 40,  0,  0,  0, 87,  2,  0,  0, 45,  0,  0,  0,
+/* 0x2fc0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 44,  0,  0,  0,
+/* 0x2fd0 */  99,  2,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fe0 */   9,  0,  0,  0,  0,  0,  0,  0, 99,  2,  0,  0, 41,  0,  0,  0,
+/* 0x2ff0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */  99,  2,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3010 */  11,  0,  0,  0,  0,  0,  0,  0, 99,  2,  0,  0, 47,  0,  0,  0,
+/* 0x3020 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */  87,  2,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3040 */  12,  0,  0,  0,  8,  0,  0,  0, 99,  2,  0,  0, 43,  0,  0,  0,
+/* 0x3050 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3060 */  87,  2,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3070 */  15,  0,  0,  0, 36,  0,  0,  0,111,  2,  0,  0, 44,  0,  0,  0,
+/* 0x3080 */   0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */  87,  2,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30a0 */  16,  0,  0,  0,  4,  0,  0,  0, 99,  2,  0,  0, 39,  0,  0,  0,
+/* 0x30b0 */   0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0, 12,  0,  0,  0,
+/* 0x30c0 */  87,  2,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30d0 */  16,  0,  0,  0, 16,  0,  0,  0, 99,  2,  0,  0, 48,  0,  0,  0,
+/* 0x30e0 */   0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0, 28,  0,  0,  0,
+/* 0x30f0 */  99,  2,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3100 */  18,  0,  0,  0,  0,  0,  0,  0, 87,  2,  0,  0, 48,  0,  0,  0,
+/* 0x3110 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3120 */  99,  2,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3130 */  18,  0,  0,  0, 48,  0,  0,  0, 87,  2,  0,  0, 45,  0,  0,  0,
+/* 0x3140 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 52,  0,  0,  0,
+/* 0x3150 */  99,  2,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3160 */  19,  0,  0,  0, 36,  0,  0,  0,111,  2,  0,  0, 44,  0,  0,  0,
+/* 0x3170 */   0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */  99,  2,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3190 */  21,  0,  0,  0,  0,  0,  0,  0, 99,  2,  0,  0, 49,  0,  0,  0,
+/* 0x31a0 */   0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,196,  0,  0,  0,
+/* 0x31b0 */ 121,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31c0 */  23,  0,  0,  0, 28,  1,  0,  0,121,  2,  0,  0,  0,  0,  0,  0,
+/* 0x31d0 */   0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0, 28,  1,  0,  0,
+/* 0x31e0 */ 121,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31f0 */  25,  0,  0,  0,196,  0,  0,  0,121,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3200 */   0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0, 28,  1,  0,  0,
+/* 0x3210 */ 121,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3220 */  27,  0,  0,  0, 28,  1,  0,  0,121,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3230 */   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 12,  0,  0,  0,
+/* 0x3240 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3250 */  30,  0,  0,  0, 44,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x3260 */   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 52,  0,  0,  0,
+/* 0x3270 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3280 */  30,  0,  0,  0,100,  0,  0,  0,121,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3290 */   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,108,  0,  0,  0,
+/* 0x32a0 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32b0 */  30,  0,  0,  0,120,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x32c0 */   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,144,  0,  0,  0,
+/* 0x32d0 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32e0 */  30,  0,  0,  0,152,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x32f0 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 12,  0,  0,  0,
+/* 0x3300 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3310 */  31,  0,  0,  0, 44,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x3320 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 52,  0,  0,  0,
+/* 0x3330 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3340 */  31,  0,  0,  0, 68,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x3350 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 92,  0,  0,  0,
+/* 0x3360 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3370 */  31,  0,  0,  0,124,  0,  0,  0,121,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3380 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,148,  0,  0,  0,
+/* 0x3390 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33a0 */  31,  0,  0,  0,172,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x33b0 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,180,  0,  0,  0,
+/* 0x33c0 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33d0 */  32,  0,  0,  0, 12,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x33e0 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 44,  0,  0,  0,
+/* 0x33f0 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3400 */  32,  0,  0,  0, 52,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x3410 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 68,  0,  0,  0,
+/* 0x3420 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3430 */  32,  0,  0,  0, 92,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x3440 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,124,  0,  0,  0,
+/* 0x3450 */ 121,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3460 */  32,  0,  0,  0,148,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x3470 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,172,  0,  0,  0,
+/* 0x3480 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3490 */  32,  0,  0,  0,188,  0,  0,  0,121,  2,  0,  0, 52,  0,  0,  0,
+/* 0x34a0 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,196,  0,  0,  0,
+/* 0x34b0 */ 121,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34c0 */  35,  0,  0,  0,  0,  0,  0,  0, 99,  2,  0,  0, 53,  0,  0,  0,
+/* 0x34d0 */   0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 12,  0,  0,  0,
+/* 0x34e0 */  87,  2,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34f0 */  35,  0,  0,  0, 16,  0,  0,  0, 99,  2,  0,  0, 54,  0,  0,  0,
+/* 0x3500 */   0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 20,  0,  0,  0,
+/* 0x3510 */  87,  2,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3520 */  35,  0,  0,  0, 24,  0,  0,  0, 99,  2,  0,  0, 55,  0,  0,  0,
+/* 0x3530 */   0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 36,  0,  0,  0,
+/* 0x3540 */  87,  2,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3550 */  35,  0,  0,  0, 40,  0,  0,  0, 99,  2,  0,  0, 56,  0,  0,  0,
+/* 0x3560 */   0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 52,  0,  0,  0,
+/* 0x3570 */ 121,  2,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3580 */  35,  0,  0,  0, 68,  0,  0,  0, 99,  2,  0,  0, 53,  0,  0,  0,
+/* 0x3590 */   0,  0,  0,  0,  0,  0,  0,  0, 99,100, 98, 46,115,116, 97,114,
+/* 0x35a0 */ 116,  0, 99,100, 98, 46,101,110,116,114,121,  0, 99,100, 98, 46,
+/* 0x35b0 */ 115,116, 97,114,116, 46,108,122,109, 97,  0, 99,100, 98, 46,101,
+/* 0x35c0 */ 110,116,114,121, 46,108,122,109, 97,  0, 99,100, 98, 46,108,122,
+/* 0x35d0 */ 109, 97, 46, 99,112,114,  0, 99,100, 98, 46,100,101, 99, 46,112,
+/* 0x35e0 */ 116,114,  0, 99,100, 98, 46,100,101, 99, 46,112,116,114, 46,104,
+/* 0x35f0 */ 105,  0, 99,100, 98, 46,101,120,105,116,  0, 99,111,110, 46,115,
+/* 0x3600 */ 116, 97,114,116,  0, 99,111,110, 46,109, 99,112,121,  0,108,122,
+/* 0x3610 */ 109, 97, 46,112,114,101,112,  0, 99,111,110, 46,112, 97,100, 99,
+/* 0x3620 */ 100,  0,100,101, 99, 46,112,116,114,  0,100,101, 99, 46,112,116,
+/* 0x3630 */ 114, 46,104,105,  0, 99,111,110, 46,101,110,116,114,121,  0, 99,
+/* 0x3640 */ 111,110, 46,101,120,105,116,  0, 98,115,115, 46, 99,100, 98, 46,
+/* 0x3650 */ 115,116, 97,114,116, 46,108,122,109, 97,  0, 98,115,115, 46, 99,
+/* 0x3660 */ 100, 98, 46,101,110,116,114,121, 46,108,122,109, 97,  0, 98,115,
+/* 0x3670 */ 115, 46, 99,111,110, 46,115,116, 97,114,116,  0, 98,115,115, 46,
+/* 0x3680 */ 101,120,105,116,  0,109,101,109,115,101,116, 46,115,104,111,114,
+/* 0x3690 */ 116,  0,109,101,109,115,101,116, 46,108,111,110,103,  0,110,114,
+/* 0x36a0 */ 118, 50, 98, 46, 56, 98,105,116,  0,110,114,118, 50,100, 46, 56,
+/* 0x36b0 */  98,105,116,  0,110,114,118, 50,101, 46, 56, 98,105,116,  0,110,
+/* 0x36c0 */ 114,118, 50, 98, 46, 51, 50, 98,105,116,  0,110,114,118, 50,100,
+/* 0x36d0 */  46, 51, 50, 98,105,116,  0,110,114,118, 50,101, 46, 51, 50, 98,
+/* 0x36e0 */ 105,116,  0, 56, 98,105,116, 46,115,117, 98,  0, 51, 50, 98,105,
+/* 0x36f0 */ 116, 46,115,117, 98,  0,110,114,118, 50, 98, 46,115,109, 97,108,
+/* 0x3700 */ 108,  0,110,114,118, 50,100, 46,115,109, 97,108,108,  0,110,114,
+/* 0x3710 */ 118, 50,101, 46,115,109, 97,108,108,  0,110,114,118, 46,100,111,
+/* 0x3720 */ 110,101,  0,100,101, 99,111,109,112,114,101,115,115,111,114, 46,
+/* 0x3730 */ 115,116, 97,114,116,  0,108,122,109, 97, 46,105,110,105,116,  0,
+/* 0x3740 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95,
+/* 0x3750 */  68, 69, 67, 50, 48,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 80,
+/* 0x3760 */  83, 86, 82,  0, 67, 80, 68, 79,  0,108,100,114, 95,115,122,  0,
+/* 0x3770 */ 108,122,109, 97, 95, 99,112,114,  0, 68, 69, 67, 79,  0,101,110,
+/* 0x3780 */ 116,114,121,  0, 68, 67, 82, 84,  0,108,122,109, 97, 95,105,110,
+/* 0x3790 */ 105,116, 95,111,102,102,  0, 80, 65, 68,  0,119,114,107,109,101,
+/* 0x37a0 */ 109,  0, 83, 67,  0,103, 98, 56, 95,101,  0,103, 98, 51, 50, 95,
+/* 0x37b0 */ 101,  0,103, 98, 95,101,  0,108,122,109, 97, 95,115,116, 97, 99,
+/* 0x37c0 */ 107, 95, 97,100,106,117,115,116,  0,108,122,109, 97, 95, 99, 95,
+/* 0x37d0 */ 108,101,110,  0,108,122,109, 97, 95,117, 95,108,101,110,  0,108,
+/* 0x37e0 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,  0, 82,
+/* 0x37f0 */  95, 77, 73, 80, 83, 95, 72, 73, 49, 54,  0, 82, 95, 77, 73, 80,
+/* 0x3800 */  83, 95, 76, 79, 49, 54,  0, 82, 95, 77, 73, 80, 83, 95, 50, 54,
+/* 0x3810 */   0, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54,  0, 56, 40,  0,
+/* 0x3820 */   0, 85, 80, 88, 76
 };
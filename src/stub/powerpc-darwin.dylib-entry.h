@@ -1,5 +1,5 @@
 /* powerpc-darwin.dylib-entry.h
-   created from powerpc-darwin.dylib-entry.bin, 8997 (0x2325) bytes
+   created from powerpc-darwin.dylib-entry.bin, 7333 (0x1ca5) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC_DARWIN_DYLIB_ENTRY_SIZE    8997
-#define STUB_POWERPC_DARWIN_DYLIB_ENTRY_ADLER32 0xfdf268dd
-#define STUB_POWERPC_DARWIN_DYLIB_ENTRY_CRC32   0xcf49c4b1
+#define STUB_POWERPC_DARWIN_DYLIB_ENTRY_SIZE    7333
+#define STUB_POWERPC_DARWIN_DYLIB_ENTRY_ADLER32 0xd7e99ff7
+#define STUB_POWERPC_DARWIN_DYLIB_ENTRY_CRC32   0x9f3d36a3
 
-unsigned char stub_powerpc_darwin_dylib_entry[8997] = {
+unsigned char stub_powerpc_darwin_dylib_entry[7333] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 20,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 26,124,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -449,154 +449,50 @@ unsigned char stub_powerpc_darwin_dylib_entry[8997] = {
 /* 0x19a0 */  85, 96,  2,186,124,  3,  0, 80,124,  0, 58, 20, 80, 11,  1,186,
 /* 0x19b0 */ 145, 99,  0,  0, 78, 64,  0, 32,133, 99,  0,  4, 85, 96, 85,190,
 /* 0x19c0 */ 124,  0, 40, 64, 65,162,255,220, 66,  0,255,240, 78,128,  0, 32,
-/* 0x19d0 */  75,255,253,252,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x19e0 */ 101,108,102, 51, 50, 45,112,111,119,101,114,112, 99, 10, 10, 83,
-/* 0x19f0 */ 101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,
-/* 0x1a00 */ 101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32,
-/* 0x1a10 */  32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x1a20 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,
-/* 0x1a30 */ 102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32,
-/* 0x1a40 */  32, 48, 32, 77, 65, 67, 79, 83, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1a50 */  32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1a80 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1a90 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86,
-/* 0x1aa0 */  95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x1ad0 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1ae0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32,
-/* 0x1af0 */  78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1b00 */  48, 48, 48, 49, 52, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b10 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1b20 */  48, 48, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1b30 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1b40 */  68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32,
-/* 0x1b50 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50, 99,
-/* 0x1b60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 56, 52, 32, 32,
-/* 0x1b80 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1b90 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1ba0 */  32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1bb0 */  32, 32, 48, 48, 48, 48, 48, 48,102, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1bd0 */  48, 48, 48, 48, 48, 50, 98, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1be0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1bf0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76, 90,
-/* 0x1c00 */  77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 57, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x1c30 */  97, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1c40 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1c50 */  78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1c60 */  49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57, 57, 99, 32, 32,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 51, 48, 32, 32, 50, 42,
-/* 0x1c90 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1ca0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95,
-/* 0x1cb0 */  68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57, 57,
-/* 0x1cc0 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 99, 99, 32,
-/* 0x1ce0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1cf0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90,
-/* 0x1d00 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1d10 */  48, 48, 50, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55,
-/* 0x1d30 */  54, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1d40 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57,
-/* 0x1d50 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d60 */  48, 48, 48, 48, 48, 49, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d70 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d80 */  48, 49, 55, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1d90 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1da0 */  32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32,
-/* 0x1db0 */  32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1dd0 */  48, 48, 48, 48, 49, 55, 97, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1de0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1df0 */  76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32,
-/* 0x1e00 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 32, 32, 48, 48, 48, 48, 49, 55, 99, 99, 32, 32, 50, 42, 42,
-/* 0x1e30 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1e40 */  68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1e50 */  78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 50, 48, 56,
-/* 0x1e60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 99, 99, 32, 32,
-/* 0x1e80 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1e90 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x1ea0 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1eb0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1ec0 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x1ed0 */  95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ee0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x1ef0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65,
-/* 0x1f00 */  73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1f10 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48,
-/* 0x1f30 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1f40 */  77, 65, 67, 79, 83, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f50 */  48, 32, 77, 65, 67, 79, 83, 48, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95,
-/* 0x1f70 */  72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x1f80 */  86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f90 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48,
-/* 0x1fa0 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1fc0 */  86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x1fd0 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1fe0 */  32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x2010 */  76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2020 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2040 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2050 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2060 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2070 */  69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2080 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,
-/* 0x20a0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70, 76, 85, 83, 72,
-/* 0x20b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x20c0 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48,
-/* 0x20d0 */  48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65,
-/* 0x20f0 */  67, 79, 83, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2100 */  95,115,116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2110 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2120 */  77, 65, 67, 79, 83, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2130 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x2150 */  48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52,
-/* 0x2160 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43,
-/* 0x2170 */  48,120, 48, 48, 48, 48, 48, 50, 48, 52, 10, 10, 82, 69, 76, 79,
-/* 0x2180 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2190 */  79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83,
-/* 0x21a0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x21c0 */  48, 48, 48, 98, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49,
-/* 0x21d0 */  52, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x21e0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x21f0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x2200 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2210 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2220 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 80, 80,
-/* 0x2230 */  67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2240 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2250 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2260 */  78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2270 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2280 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 57,
-/* 0x2290 */  48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x22a0 */  32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69,
-/* 0x22b0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x22c0 */  32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x22d0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x22e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x22f0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80,
-/* 0x2300 */  80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2310 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48,
-/* 0x2320 */  48, 48, 50, 52, 10
+/* 0x19d0 */  75,255,253,252, 13,  0,  0,  0, 14,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19e0 */  56,  2,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  8,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0,  9,  0,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0, 18,  0,  0,  0, 60,  0,  0,  0, 72,  1,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0, 24,  0,  0,  0,132,  1,  0,  0, 44,  1,  0,  0,
+/* 0x1a20 */   0,  0,  0,  0, 30,  0,  0,  0,176,  2,  0,  0,240,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0, 36,  0,  0,  0,160,  3,  0,  0,144,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0, 47,  0,  0,  0, 48,  4,  0,  0,156,  9,  0,  0,
+/* 0x1a50 */   0,  0,  0,  0, 58,  0,  0,  0,204, 13,  0,  0,156,  9,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0, 69,  0,  0,  0,104, 23,  0,  0, 36,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0, 80,  0,  0,  0,140, 23,  0,  0, 28,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0, 89,  0,  0,  0,168, 23,  0,  0, 36,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0, 96,  0,  0,  0,204, 23,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,105,  0,  0,  0,204, 23,  0,  0,  8,  2,  0,  0,
+/* 0x1ab0 */   0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */   0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */   0,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,121,  0,  0,  0,
+/* 0x1ba0 */   2,  0,  0,  0,  4,  2,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1bb0 */ 180,  0,  0,  0,133,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  3,  0,  0,  0,180,  0,  0,  0,133,  0,  0,  0,
+/* 0x1bd0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1be0 */ 144,  0,  0,  0,133,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  5,  0,  0,  0,  4,  0,  0,  0,133,  0,  0,  0,
+/* 0x1c00 */   0,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 77, 65, 67, 79,
+/* 0x1c10 */  83, 48, 48, 48,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82,
+/* 0x1c20 */  86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0,
+/* 0x1c30 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95,
+/* 0x1c40 */  68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
+/* 0x1c50 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95,
+/* 0x1c60 */  84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77,
+/* 0x1c70 */  65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,
+/* 0x1c80 */ 116, 97,114,116,  0, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52,
+/* 0x1c90 */   0, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52,  0,212, 25,  0,
+/* 0x1ca0 */   0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* powerpc-darwin.macho-entry.h
-   created from powerpc-darwin.macho-entry.bin, 8924 (0x22dc) bytes
+   created from powerpc-darwin.macho-entry.bin, 7085 (0x1bad) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC_DARWIN_MACHO_ENTRY_SIZE    8924
-#define STUB_POWERPC_DARWIN_MACHO_ENTRY_ADLER32 0xc5741a3d
-#define STUB_POWERPC_DARWIN_MACHO_ENTRY_CRC32   0xb1818d3a
+#define STUB_POWERPC_DARWIN_MACHO_ENTRY_SIZE    7085
+#define STUB_POWERPC_DARWIN_MACHO_ENTRY_ADLER32 0x4eda22dd
+#define STUB_POWERPC_DARWIN_MACHO_ENTRY_CRC32   0xeb993308
 
-unsigned char stub_powerpc_darwin_macho_entry[8924] = {
+unsigned char stub_powerpc_darwin_macho_entry[7085] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 20,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 25, 68,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -428,170 +428,55 @@ unsigned char stub_powerpc_darwin_macho_entry[8924] = {
 /* 0x1850 */  56, 99,  0,192,140,  5,255,255,156,  3,255,255, 66,  0,255,248,
 /* 0x1860 */ 127,233,  3,166, 56,172,  0,128,144,193,255,252, 56,193,255,252,
 /* 0x1870 */ 148, 33,255,232, 78,128,  4, 32,127,232,  2,166, 75,255,255,181,
-/* 0x1880 */  72,  0,  0,128,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1890 */ 109, 97,116, 32,101,108,102, 51, 50, 45,112,111,119,101,114,112,
-/* 0x18a0 */  99, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x18b0 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x18c0 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x18d0 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x18e0 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x18f0 */ 103,115, 10, 32, 32, 48, 32, 80, 80, 67, 51, 50, 66, 88, 88, 32,
-/* 0x1900 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 54, 56, 32, 32, 48,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1920 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42,
-/* 0x1930 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1940 */  68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 77, 65, 67, 77, 65, 73,
-/* 0x1950 */  78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x1960 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1970 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 99, 32, 32,
-/* 0x1980 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1990 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x19a0 */  32, 32, 50, 32, 77, 65, 67, 72, 95, 85, 78, 67, 32, 32, 32, 32,
-/* 0x19b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x19c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x19d0 */  48, 48, 48, 48, 48, 48, 97, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x19e0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x19f0 */  76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32,
-/* 0x1a00 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a20 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 97, 48, 32, 32, 50, 42, 42,
-/* 0x1a30 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1a40 */  68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1a50 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 52, 56,
-/* 0x1a60 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 97, 48, 32, 32,
-/* 0x1a80 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1a90 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1aa0 */  32, 32, 53, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ab0 */  32, 32, 48, 48, 48, 48, 48, 49, 50, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 49,101, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1ae0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1af0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 78, 82,
-/* 0x1b00 */  86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1b10 */  48, 48,102, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1b20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x1b30 */  49, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b40 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1b50 */  78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1b60 */  48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 48, 32, 32,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 48, 52, 32, 32, 50, 42,
-/* 0x1b90 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1ba0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1bb0 */  56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x1bc0 */  48, 48, 48, 48, 48, 57, 57, 99, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1be0 */  48, 48, 48, 52, 57, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1bf0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1c00 */  10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x1c10 */  32, 32, 32, 48, 48, 48, 48, 48, 57, 57, 99, 32, 32, 48, 48, 48,
-/* 0x1c20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c30 */  32, 48, 48, 48, 48, 48,101, 51, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c40 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1c50 */  78, 76, 89, 10, 32, 49, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1c60 */  51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 99, 99, 32, 32, 50, 42,
-/* 0x1c90 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1ca0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 78, 82, 86, 95, 84,
-/* 0x1cb0 */  65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x1cc0 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55,102, 48, 32,
-/* 0x1ce0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1cf0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 67, 70,
-/* 0x1d00 */  76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1d10 */  48, 48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,
-/* 0x1d30 */  48, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1d40 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51,
-/* 0x1d50 */  32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 48,
-/* 0x1d60 */  48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d70 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d80 */  48, 49, 56, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1d90 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1da0 */  32, 49, 52, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 32, 32, 32,
-/* 0x1db0 */  32, 32, 48, 48, 48, 48, 48, 48, 53, 56, 32, 32, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1dd0 */  48, 48, 48, 48, 49, 56, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1de0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1df0 */  76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x1e00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1e10 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1e30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1e40 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65,
-/* 0x1e70 */  67, 72, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e80 */  32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 80, 67, 51,
-/* 0x1ea0 */  50, 66, 88, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 80,
-/* 0x1eb0 */  67, 51, 50, 66, 88, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ec0 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 77, 65, 73, 78, 88,
-/* 0x1ed0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 77, 65, 73,
-/* 0x1ee0 */  78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1ef0 */  32,100, 32, 32, 77, 65, 67, 72, 95, 85, 78, 67,  9, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 95, 85, 78, 67, 10, 48,
-/* 0x1f10 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1f20 */  78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f30 */  48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1f50 */  69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69,
-/* 0x1f60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1f70 */  32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f80 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f90 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48,
-/* 0x1fa0 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1fc0 */  77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1ff0 */  77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x2020 */  77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2040 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70,
-/* 0x2050 */  76, 85, 83, 72,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70,
-/* 0x2060 */  76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2070 */  32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,  9,
-/* 0x2080 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x2090 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x20a0 */  32, 32, 32, 32, 77, 65, 67, 77, 65, 73, 78, 88,  9, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 10, 82, 69,
-/* 0x20c0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x20d0 */  32, 70, 79, 82, 32, 91, 77, 65, 67, 77, 65, 73, 78, 88, 93, 58,
-/* 0x20e0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x20f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2100 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 80, 80, 67,
-/* 0x2110 */  95, 82, 69, 76, 50, 52, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67,
-/* 0x2120 */  72, 77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2130 */  56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2140 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69,
-/* 0x2150 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2160 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2170 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 80,
-/* 0x2180 */  80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2190 */  82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x21a0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x21b0 */  91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x21c0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21d0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x21e0 */  98, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32,
-/* 0x21f0 */  32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82,
-/* 0x2200 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x2210 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79,
-/* 0x2220 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2230 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2240 */  48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 80, 80, 67, 95, 82,
-/* 0x2250 */  69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84,
-/* 0x2260 */  65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x2270 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77,
-/* 0x2280 */  65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2290 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22a0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x22b0 */  48, 48, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32,
-/* 0x22c0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x22d0 */  43, 48,120, 48, 48, 48, 48, 48, 48, 50, 52, 10
+/* 0x1880 */  72,  0,  0,128,  0,  0,  0,  0, 15,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1890 */   5,  0,  0,  0,120,  2,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x18a0 */ 104,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,156,  0,  0,  0,
+/* 0x18b0 */   4,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,160,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,160,  0,  0,  0,
+/* 0x18d0 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,160,  0,  0,  0,
+/* 0x18e0 */  72,  1,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,232,  1,  0,  0,
+/* 0x18f0 */  44,  1,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0, 20,  3,  0,  0,
+/* 0x1900 */ 240,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  4,  4,  0,  0,
+/* 0x1910 */ 144,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,148,  4,  0,  0,
+/* 0x1920 */ 156,  9,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0, 48, 14,  0,  0,
+/* 0x1930 */ 156,  9,  0,  0,  0,  0,  0,  0, 87,  0,  0,  0,204, 23,  0,  0,
+/* 0x1940 */  36,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,240, 23,  0,  0,
+/* 0x1950 */  28,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0, 12, 24,  0,  0,
+/* 0x1960 */  32,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0, 44, 24,  0,  0,
+/* 0x1970 */   4,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,  0, 48, 24,  0,  0,
+/* 0x1980 */  88,  0,  0,  0,  0,  0,  0,  0, 87,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1990 */   0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,  0, 14,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1a20 */   0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1a50 */   0,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0,  0,  0,134,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */ 141,  0,  0,  0,  2,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   4,  0,  0,  0,180,  0,  0,  0,153,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,180,  0,  0,  0,
+/* 0x1ac0 */ 153,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   6,  0,  0,  0,144,  0,  0,  0,153,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1af0 */ 153,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */  80, 80, 67, 51, 50, 66, 88, 88,  0, 77, 65, 67, 77, 65, 73, 78,
+/* 0x1b10 */  88,  0, 77, 65, 67, 72, 95, 85, 78, 67,  0, 78, 82, 86, 95, 72,
+/* 0x1b20 */  69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0,
+/* 0x1b30 */  78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
+/* 0x1b40 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65,
+/* 0x1b50 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51,
+/* 0x1b60 */  48,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83,
+/* 0x1b70 */  72,  0, 77, 65, 67, 72, 77, 65, 73, 78, 89,  0, 77, 65, 67, 72,
+/* 0x1b80 */  77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0, 82, 95, 80,
+/* 0x1b90 */  80, 67, 95, 82, 69, 76, 50, 52,  0, 82, 95, 80, 80, 67, 95, 82,
+/* 0x1ba0 */  69, 76, 49, 52,  0,136, 24,  0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* powerpc-linux.elf-entry.h
-   created from powerpc-linux.elf-entry.bin, 9144 (0x23b8) bytes
+   created from powerpc-linux.elf-entry.bin, 7302 (0x1c86) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC_LINUX_ELF_ENTRY_SIZE    9144
-#define STUB_POWERPC_LINUX_ELF_ENTRY_ADLER32 0x3faf5db0
-#define STUB_POWERPC_LINUX_ELF_ENTRY_CRC32   0x825ccfba
+#define STUB_POWERPC_LINUX_ELF_ENTRY_SIZE    7302
+#define STUB_POWERPC_LINUX_ELF_ENTRY_ADLER32 0x1310635c
+#define STUB_POWERPC_LINUX_ELF_ENTRY_CRC32   0xd810ac6b
 
-unsigned char stub_powerpc_linux_elf_entry[9144] = {
+unsigned char stub_powerpc_linux_elf_entry[7302] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 20,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 26, 16,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -442,170 +442,55 @@ unsigned char stub_powerpc_linux_elf_entry[9144] = {
 /* 0x1930 */ 124,122, 27,120,128,  3,  0,  0,128,131,  0,  4, 56, 99,  0,  8,
 /* 0x1940 */  47,128,  0,  6, 65,158,  0, 16, 44,  0,  0,  0, 64,130,255,232,
 /* 0x1950 */  56,128, 16,  0,127,196,  0,208, 75,255,254,165,  0,  0,  0,  0,
-/* 0x1960 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1970 */  50, 45,112,111,119,101,114,112, 99, 10, 10, 83,101, 99,116,105,
-/* 0x1980 */ 111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32,
-/* 0x1990 */  32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32,
-/* 0x19a0 */  32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32,
-/* 0x19b0 */  32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,
-/* 0x19c0 */ 108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69,
-/* 0x19d0 */  76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x19f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1a00 */  48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1a10 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1a20 */  79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x1a30 */  68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1a40 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 56, 32, 32, 50,
-/* 0x1a60 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1a70 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 50,
-/* 0x1a80 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1a90 */  52, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 56,
-/* 0x1ab0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1ac0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1ad0 */  89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32,
-/* 0x1ae0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50, 99, 32, 32, 48, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b00 */  32, 32, 48, 48, 48, 48, 48, 49, 56, 48, 32, 32, 50, 42, 42, 48,
-/* 0x1b10 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1b20 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32,
-/* 0x1b30 */  78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48,102, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1b60 */  48, 50, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1b70 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1b80 */  68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 69,
-/* 0x1b90 */  76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 48,
-/* 0x1ba0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 57, 99, 32, 32,
-/* 0x1bc0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1bd0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1be0 */  32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32,
-/* 0x1bf0 */  32, 32, 48, 48, 48, 48, 48, 57, 57, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1c00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1c10 */  48, 48, 48, 48, 48, 52, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c20 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1c30 */  76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1c40 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57, 57, 99, 32, 32, 48,
-/* 0x1c50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 32, 32, 48, 48, 48, 48, 48,100, 99, 56, 32, 32, 50, 42, 42,
-/* 0x1c70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1c80 */  68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1c90 */  69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52,
-/* 0x1ca0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 54, 52, 32, 32,
-/* 0x1cc0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1cd0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 82, 86,
-/* 0x1ce0 */  95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 49, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 56,
-/* 0x1d10 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1d20 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32,
-/* 0x1d30 */  67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 50, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1d60 */  49, 55, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1d70 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1d80 */  49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32,
-/* 0x1d90 */  32, 48, 48, 48, 48, 48, 48, 49, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1db0 */  48, 48, 48, 49, 55, 99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1dc0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1dd0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69, 76, 70,
-/* 0x1de0 */  77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1df0 */  49, 56, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55,100,
-/* 0x1e10 */  99, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1e20 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1e30 */  76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x1e40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1e50 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1e70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1e80 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x1eb0 */  70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ec0 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1ee0 */  78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77,
-/* 0x1ef0 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1f00 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48,
-/* 0x1f10 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x1f20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1f30 */  32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f50 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48,
-/* 0x1f60 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1f80 */  86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x1f90 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1fa0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1fc0 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1fd0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1ff0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2000 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2020 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2030 */  32,100, 32, 32, 67, 70, 76, 85, 83, 72,  9, 48, 48, 48, 48, 48,
-/* 0x2040 */  48, 48, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x2060 */  65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76,
-/* 0x2070 */  70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2080 */ 103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x2090 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116,
-/* 0x20a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20b0 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20c0 */  32, 79, 95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x20d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x20e0 */  32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70,
-/* 0x20f0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2100 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76,
-/* 0x2120 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2130 */  90, 43, 48,120, 48, 48, 48, 48, 48, 49, 51, 99, 10, 10, 82, 69,
-/* 0x2140 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2150 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70,
-/* 0x2160 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2180 */  48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69,
-/* 0x2190 */  76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65,
-/* 0x21a0 */  73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x21b0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50,
-/* 0x21c0 */  68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x21d0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x21e0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95,
-/* 0x21f0 */  80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2200 */  78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2210 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2220 */  32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2230 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2240 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2250 */  48, 57, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32,
-/* 0x2260 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10,
-/* 0x2270 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2280 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2290 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x22a0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22b0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x22c0 */  95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32,
-/* 0x22d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 50, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x22f0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2300 */  69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2310 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2320 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52,
-/* 0x2340 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x2350 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2360 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2370 */  90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x2380 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2390 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95,
-/* 0x23a0 */  80, 80, 67, 95, 65, 68, 68, 82, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x23b0 */  79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1960 */  13,  0,  0,  0, 15,  0,  0,  0,  7,  0,  0,  0,120,  2,  0,  0,
+/* 0x1970 */   0,  0,  0,  0, 52,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1980 */   9,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */  18,  0,  0,  0, 56,  0,  0,  0, 72,  1,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */  24,  0,  0,  0,128,  1,  0,  0, 44,  1,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */  30,  0,  0,  0,172,  2,  0,  0,240,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */  36,  0,  0,  0,156,  3,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */  47,  0,  0,  0, 44,  4,  0,  0,156,  9,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */  58,  0,  0,  0,200, 13,  0,  0,156,  9,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */  69,  0,  0,  0,100, 23,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */  80,  0,  0,  0,136, 23,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */  89,  0,  0,  0,164, 23,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */  96,  0,  0,  0,200, 23,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */ 105,  0,  0,  0,220, 23,  0,  0,132,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1a40 */  69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */  80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */ 105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */  18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */  24,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */  30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */  36,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */  47,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */  58,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */  96,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */ 114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */ 121,  0,  0,  0, 14,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1b40 */  60,  1,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,180,  0,  0,  0,
+/* 0x1b50 */ 141,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */   3,  0,  0,  0,180,  0,  0,  0,141,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1b70 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,
+/* 0x1b80 */ 141,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   5,  0,  0,  0,  4,  0,  0,  0,141,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */  36,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */ 129,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */  12,  0,  0,  0,128,  1,  0,  0,153,  0,  0,  0, 14,  0,  0,  0,
+/* 0x1bd0 */   0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,
+/* 0x1be0 */   0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0,
+/* 0x1bf0 */  78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65,
+/* 0x1c00 */  95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x1c10 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77,
+/* 0x1c20 */  65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 84, 65, 73, 76,
+/* 0x1c30 */   0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,
+/* 0x1c40 */   0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,
+/* 0x1c50 */   0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 80, 80, 67, 95, 82,
+/* 0x1c60 */  69, 76, 50, 52,  0, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52,
+/* 0x1c70 */   0, 82, 95, 80, 80, 67, 95, 65, 68, 68, 82, 51, 50,  0, 96, 25,
+/* 0x1c80 */   0,  0, 85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* powerpc64-linux.elf-entry.h
-   created from powerpc64-linux.elf-entry.bin, 11568 (0x2d30) bytes
+   created from powerpc64-linux.elf-entry.bin, 8897 (0x22c1) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64_LINUX_ELF_ENTRY_SIZE    11568
-#define STUB_POWERPC64_LINUX_ELF_ENTRY_ADLER32 0xcfb7d090
-#define STUB_POWERPC64_LINUX_ELF_ENTRY_CRC32   0xe0324858
+#define STUB_POWERPC64_LINUX_ELF_ENTRY_SIZE    8897
+#define STUB_POWERPC64_LINUX_ELF_ENTRY_ADLER32 0xf0df2d0c
+#define STUB_POWERPC64_LINUX_ELF_ENTRY_CRC32   0xc5ca3eab
 
-unsigned char stub_powerpc64_linux_elf_entry[11568] = {
+unsigned char stub_powerpc64_linux_elf_entry[8897] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 21,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,120,
@@ -534,229 +534,63 @@ unsigned char stub_powerpc64_linux_elf_entry[11568] = {
 /* 0x1ef0 */  75,255,255,105, 75,255,255,101,124,122, 27,120,232,  3,  0,  0,
 /* 0x1f00 */ 232,131,  0,  8, 56, 99,  0, 16, 47,160,  0,  6, 65,222,  0, 16,
 /* 0x1f10 */  44, 32,  0,  0, 64,226,255,232, 60,128,  0,  1,127,196,  0,208,
-/* 0x1f20 */  75,255,254, 49,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1f30 */ 109, 97,116, 32,101,108,102, 54, 52, 45,112,111,119,101,114,112,
-/* 0x1f40 */  99, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x1f50 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x1f60 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32,
-/* 0x1f80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x1f90 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x1fa0 */ 103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1fd0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x1ff0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2000 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49,
-/* 0x2010 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2040 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2060 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2070 */  32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2080 */  32, 32, 48, 48, 48, 48, 48, 49, 53, 52, 32, 32, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x20b0 */  48, 48, 48, 48, 48, 48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x20c0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x20d0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82,
-/* 0x20e0 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x20f0 */  48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2100 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2120 */  57, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2130 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2140 */  78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32,
-/* 0x2150 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 56, 32, 32,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2180 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50,100, 99, 32, 32, 50, 42,
-/* 0x2190 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x21a0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x21b0 */  53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32,
-/* 0x21c0 */  48, 48, 48, 48, 48, 48, 57, 52, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x21f0 */  48, 48, 48, 51,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2200 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2210 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65,
-/* 0x2220 */  95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  50, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2250 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 54, 56,
-/* 0x2260 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2270 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76,
-/* 0x2280 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2290 */  48, 48, 98, 99, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x22c0 */  52, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x22d0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x22e0 */  56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x22f0 */  48, 48, 48, 48, 48, 99, 55, 52, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2320 */  48, 48, 49, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2330 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2340 */  10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32,
-/* 0x2350 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 99, 32, 32, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2370 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2380 */  32, 48, 48, 48, 48, 49, 99, 99, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2390 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x23a0 */  78, 76, 89, 10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32,
-/* 0x23b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32,
-/* 0x23c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23e0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 99,101, 48, 32, 32, 50, 42,
-/* 0x23f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2400 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65,
-/* 0x2410 */  73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x2420 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2430 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2440 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,100, 48, 52, 32,
-/* 0x2450 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2460 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2470 */  10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90,101, 32, 32,
-/* 0x2480 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 56, 32, 32, 48, 48, 48,
-/* 0x2490 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x24a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x24b0 */  32, 48, 48, 48, 48, 49,100, 49, 56, 32, 32, 50, 42, 42, 51, 32,
-/* 0x24c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x24d0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 69,
-/* 0x24e0 */  76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x24f0 */  48, 48, 49,102, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2500 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2510 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x2520 */ 100, 51, 48, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2530 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2540 */  79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76,
-/* 0x2550 */  69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2560 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x2570 */  95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2580 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2590 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95,
-/* 0x25b0 */  84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25c0 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48,
-/* 0x25d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x25e0 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x25f0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2600 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x2610 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2620 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48,
-/* 0x2630 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76,
-/* 0x2640 */  70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2650 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2660 */  78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2670 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69,
-/* 0x2680 */  65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2690 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x26a0 */  69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26b0 */  48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x26d0 */  32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x26f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2700 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48,
-/* 0x2710 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x2720 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2730 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x2740 */  77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2750 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69,
-/* 0x2760 */  76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2770 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x2780 */  77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2790 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x27a0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x27c0 */  77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x27e0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70,
-/* 0x2800 */  76, 85, 83, 72,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2810 */  48, 48, 48, 48, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48,
-/* 0x2820 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2830 */  32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48,
-/* 0x2840 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2850 */  69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2860 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2870 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90,101,  9, 48, 48, 48, 48,
-/* 0x2880 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70,
-/* 0x2890 */  77, 65, 73, 78, 90,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28a0 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x28b0 */  69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116,
-/* 0x28d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28e0 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x28f0 */  78, 90,101,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2900 */  48, 48, 48, 48, 32,101,110,116,114,121, 95,100,101,115, 99,114,
-/* 0x2910 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2920 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x2930 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2940 */  32, 79, 95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2950 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2960 */  32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70,
-/* 0x2970 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x2980 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2990 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29a0 */  48, 48, 48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82,
-/* 0x29b0 */  69, 76, 50, 52, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x29c0 */  90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29d0 */  48, 49, 51, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x29e0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x29f0 */  86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x2a00 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2a10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2a20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99, 48, 32,
-/* 0x2a30 */  82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x2a40 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79,
-/* 0x2a50 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2a60 */  79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2a70 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2a80 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2a90 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2aa0 */  48, 48, 48, 99, 99, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69,
-/* 0x2ab0 */  76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2ac0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2ad0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93,
-/* 0x2ae0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2af0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b00 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2b10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 80, 80,
-/* 0x2b20 */  67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2b30 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2b40 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2b50 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x2b60 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x2b70 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b80 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b90 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82,
-/* 0x2ba0 */  69, 76, 49, 52, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2bb0 */  67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2bc0 */  48, 48, 48, 48, 50, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2bd0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2be0 */  69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2bf0 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2c00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2c10 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c20 */  48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
-/* 0x2c30 */  50, 52, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x2c40 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2c50 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2c60 */  90,101, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2c70 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2c80 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2c90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82,
-/* 0x2ca0 */  95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82, 54, 52, 32, 32, 32,
-/* 0x2cb0 */  32, 95,115,116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x2cc0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x2cd0 */  91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2ce0 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2cf0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2d00 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d10 */  48, 48, 49,102, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 65, 68,
-/* 0x2d20 */  68, 82, 51, 50, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1f20 */  75,255,254, 49,  0,  0,  0,  0, 14,  0,  0,  0, 17,  0,  0,  0,
+/* 0x1f30 */   8,  0,  0,  0,192,  2,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x1f40 */   4,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1f60 */  84,  1,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,152,  1,  0,  0,
+/* 0x1f70 */  68,  1,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,220,  2,  0,  0,
+/* 0x1f80 */ 248,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,212,  3,  0,  0,
+/* 0x1f90 */ 148,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,104,  4,  0,  0,
+/* 0x1fa0 */  40,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,144,  4,  0,  0,
+/* 0x1fb0 */ 192, 11,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 80, 16,  0,  0,
+/* 0x1fc0 */ 116, 12,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,196, 28,  0,  0,
+/* 0x1fd0 */  28,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,224, 28,  0,  0,
+/* 0x1fe0 */  36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,  4, 29,  0,  0,
+/* 0x1ff0 */  18,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 24, 29,  0,  0,
+/* 0x2000 */  24,  0,  0,  0,  3,  0,  0,  0,115,  0,  0,  0, 48, 29,  0,  0,
+/* 0x2010 */ 248,  1,  0,  0,  2,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,  0,  0,  0,  0,115,  0,  0,  0, 13,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,  0,  0,131,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0,  0,  0,  0,  0,143,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2120 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */ 151,  0,  0,  0,  2,  0,  0,  0, 60,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   2,  0,  0,  0,192,  0,  0,  0,165,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,
+/* 0x2160 */ 165,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   4,  0,  0,  0,152,  0,  0,  0,165,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2190 */ 165,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */  11,  0,  0,  0,  0,  0,  0,  0,151,  0,  0,  0,  2,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */ 179,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */  13,  0,  0,  0,244,  1,  0,  0,194,  0,  0,  0, 16,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,
+/* 0x21f0 */   0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0,
+/* 0x2200 */  78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65,
+/* 0x2210 */  95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51,
+/* 0x2220 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77,
+/* 0x2230 */  65, 95, 68, 69, 67, 50, 48,  0, 78, 82, 86, 95, 84, 65, 73, 76,
+/* 0x2240 */   0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,
+/* 0x2250 */   0, 69, 76, 70, 77, 65, 73, 78, 90,101,  0, 69, 76, 70, 77, 65,
+/* 0x2260 */  73, 78, 90,  0, 95,115,116, 97,114,116,  0,101,110,116,114,121,
+/* 0x2270 */  95,100,101,115, 99,114,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82,
+/* 0x2280 */  95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 50, 52,  0, 82, 95, 80,
+/* 0x2290 */  80, 67, 54, 52, 95, 82, 69, 76, 49, 52,  0, 82, 95, 80, 80, 67,
+/* 0x22a0 */  54, 52, 95, 65, 68, 68, 82, 54, 52,  0, 82, 95, 80, 80, 67, 54,
+/* 0x22b0 */  52, 95, 65, 68, 68, 82, 51, 50,  0, 40, 31,  0,  0, 85, 80, 88,
+/* 0x22c0 */  76
 };
@@ -1,5 +1,5 @@
 /* powerpc64le-darwin.dylib-entry.h
-   created from powerpc64le-darwin.dylib-entry.bin, 11099 (0x2b5b) bytes
+   created from powerpc64le-darwin.dylib-entry.bin, 8893 (0x22bd) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64LE_DARWIN_DYLIB_ENTRY_SIZE    11099
-#define STUB_POWERPC64LE_DARWIN_DYLIB_ENTRY_ADLER32 0xb665b4bf
-#define STUB_POWERPC64LE_DARWIN_DYLIB_ENTRY_CRC32   0x9c7d235f
+#define STUB_POWERPC64LE_DARWIN_DYLIB_ENTRY_SIZE    8893
+#define STUB_POWERPC64LE_DARWIN_DYLIB_ENTRY_ADLER32 0x631489c1
+#define STUB_POWERPC64LE_DARWIN_DYLIB_ENTRY_CRC32   0x1cc4970b
 
-unsigned char stub_powerpc64le_darwin_dylib_entry[11099] = {
+unsigned char stub_powerpc64le_darwin_dylib_entry[8893] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 21,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,120, 34,  0,  0,  0,  0,  0,  0,
@@ -546,188 +546,50 @@ unsigned char stub_powerpc64le_darwin_dylib_entry[11099] = {
 /* 0x1fb0 */  28,  0,  0, 72,186,  2, 11, 84, 80, 88, 99,125, 20, 58,107,125,
 /* 0x1fc0 */ 186,  1, 96, 81,  0,  0,  3,144, 32,  0, 64, 79,  4,  0,  3,132,
 /* 0x1fd0 */ 190, 85, 11, 84, 64, 40, 11,124,220,255,194, 65,240,255, 32, 67,
-/* 0x1fe0 */  32,  0,128, 78, 28,253,255, 75,102,105,108,101, 32,102,111,114,
-/* 0x1ff0 */ 109, 97,116, 32,101,108,102, 54, 52, 45,112,111,119,101,114,112,
-/* 0x2000 */  99,108,101, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x2010 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2020 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x2030 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x2040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x2050 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x2060 */ 108, 97,103,115, 10, 32, 32, 48, 32, 77, 65, 67, 79, 83, 48, 48,
-/* 0x2070 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32,
-/* 0x2080 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50,
-/* 0x20b0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x20c0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x20d0 */  32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x20e0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2100 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2120 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2130 */  89, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 53, 52, 32, 32, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42, 48,
-/* 0x2180 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2190 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32,
-/* 0x21a0 */  78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x21b0 */  48, 48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x21e0 */  48, 49, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x21f0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2200 */  68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32,
-/* 0x2210 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 56,
-/* 0x2220 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,101, 48, 32, 32,
-/* 0x2250 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2260 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2270 */  32, 32, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32,
-/* 0x2280 */  32, 32, 48, 48, 48, 48, 48, 48, 57, 52, 32, 32, 48, 48, 48, 48,
-/* 0x2290 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x22a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x22b0 */  48, 48, 48, 48, 48, 51,100, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x22c0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x22d0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90,
-/* 0x22e0 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x22f0 */  48, 48, 50, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,
-/* 0x2320 */  54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2330 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55,
-/* 0x2340 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48,
-/* 0x2350 */  48, 48, 48, 48, 98, 98, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2370 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2380 */  48, 48, 52, 57, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2390 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x23a0 */  32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32,
-/* 0x23b0 */  32, 32, 48, 48, 48, 48, 48, 99, 55, 52, 32, 32, 48, 48, 48, 48,
-/* 0x23c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x23e0 */  48, 48, 48, 48, 49, 48, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x23f0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2400 */  76, 89, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32,
-/* 0x2410 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 99, 32, 32, 48,
-/* 0x2420 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2430 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2440 */  48, 32, 32, 48, 48, 48, 48, 49, 99, 99, 48, 32, 32, 50, 42, 42,
-/* 0x2450 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2460 */  68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72,
-/* 0x2470 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52,
-/* 0x2480 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2490 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24a0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 99,100, 99, 32, 32,
-/* 0x24b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x24c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70,
-/* 0x24d0 */  77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x24e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2500 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,100, 48,
-/* 0x2510 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2520 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32,
-/* 0x2530 */  69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2540 */  48, 48, 48, 50,101, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2550 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2560 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2570 */  49,100, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2580 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83,
-/* 0x2590 */  89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48,
-/* 0x25a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x25b0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x25c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25d0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x25e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x25f0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48,
-/* 0x2600 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2610 */  78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2620 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2630 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48,
-/* 0x2640 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77,
-/* 0x2650 */  65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2660 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65,
-/* 0x2670 */  67, 79, 83, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2680 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 79, 83, 48, 48, 48,
-/* 0x2690 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69,
-/* 0x26b0 */  65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26c0 */  48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x26d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x26e0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48,
-/* 0x26f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x2700 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2710 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x2720 */  68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2730 */  48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2740 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2750 */  32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2760 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x2770 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2780 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2790 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27a0 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48,
-/* 0x27b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x27c0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x27d0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27e0 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x27f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2800 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2810 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2820 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2830 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2840 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,  9, 48,
-/* 0x2850 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2860 */  67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2870 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2880 */  69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2890 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x28a0 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28b0 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 79,
-/* 0x28c0 */  83, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28d0 */  48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 10, 82, 69,
-/* 0x28e0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x28f0 */  32, 70, 79, 82, 32, 91, 77, 65, 67, 79, 83, 48, 48, 48, 93, 58,
-/* 0x2900 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2910 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2920 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2930 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67,
-/* 0x2940 */  54, 52, 95, 82, 69, 76, 50, 52, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x2950 */  77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2960 */  48, 48, 48, 48, 48, 50,101, 52, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2970 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2980 */  32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2990 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x29a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x29b0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29c0 */  48, 99, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49,
-/* 0x29d0 */  52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10,
-/* 0x29e0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x29f0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10,
-/* 0x2a00 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a10 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a20 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a30 */  48, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 80, 80, 67, 54,
-/* 0x2a40 */  52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x2a50 */  84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2a60 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x2a70 */  86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x2a80 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2a90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2aa0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 56, 32,
-/* 0x2ab0 */  82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x2ac0 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79,
-/* 0x2ad0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2ae0 */  79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58,
-/* 0x2af0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b00 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b10 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2b20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67,
-/* 0x2b30 */  54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2b40 */  65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48,
-/* 0x2b50 */  48, 48, 48, 48, 48, 48, 48, 48, 50, 56, 10
+/* 0x1fe0 */  32,  0,128, 78, 28,253,255, 75, 13,  0,  0,  0, 14,  0,  0,  0,
+/* 0x1ff0 */   5,  0,  0,  0, 56,  2,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x2000 */   8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 72,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 72,  0,  0,  0,
+/* 0x2020 */  84,  1,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,156,  1,  0,  0,
+/* 0x2030 */  68,  1,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,224,  2,  0,  0,
+/* 0x2040 */ 248,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,216,  3,  0,  0,
+/* 0x2050 */ 148,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,108,  4,  0,  0,
+/* 0x2060 */  40,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,148,  4,  0,  0,
+/* 0x2070 */ 184, 11,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 76, 16,  0,  0,
+/* 0x2080 */ 116, 12,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,192, 28,  0,  0,
+/* 0x2090 */  28,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,220, 28,  0,  0,
+/* 0x20a0 */  36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,  0, 29,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,  0, 29,  0,  0,
+/* 0x20c0 */ 232,  2,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x21b0 */ 121,  0,  0,  0,  2,  0,  0,  0,228,  2,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */   2,  0,  0,  0,192,  0,  0,  0,135,  0,  0,  0,  1,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,
+/* 0x21e0 */ 135,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */   4,  0,  0,  0,152,  0,  0,  0,135,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2210 */ 135,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */  77, 65, 67, 79, 83, 48, 48, 48,  0, 78, 82, 86, 95, 72, 69, 65,
+/* 0x2230 */  68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82,
+/* 0x2240 */  86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76,
+/* 0x2250 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x2260 */  69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0,
+/* 0x2270 */  78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0,
+/* 0x2280 */  69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x2290 */  90,  0, 95,115,116, 97,114,116,  0, 82, 95, 80, 80, 67, 54, 52,
+/* 0x22a0 */  95, 82, 69, 76, 50, 52,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82,
+/* 0x22b0 */  69, 76, 49, 52,  0,232, 31,  0,  0, 85, 80, 88, 76
 };
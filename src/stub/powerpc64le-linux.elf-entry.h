@@ -1,5 +1,5 @@
 /* powerpc64le-linux.elf-entry.h
-   created from powerpc64le-linux.elf-entry.bin, 11186 (0x2bb2) bytes
+   created from powerpc64le-linux.elf-entry.bin, 8756 (0x2234) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_SIZE    11186
-#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_ADLER32 0xe9ae82c5
-#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_CRC32   0x1c0624dc
+#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_SIZE    8756
+#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_ADLER32 0x72e31db0
+#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_CRC32   0x06485b99
 
-unsigned char stub_powerpc64le_linux_elf_entry[11186] = {
+unsigned char stub_powerpc64le_linux_elf_entry[8756] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 21,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,240, 33,  0,  0,  0,  0,  0,  0,
@@ -532,208 +532,56 @@ unsigned char stub_powerpc64le_linux_elf_entry[11186] = {
 /* 0x1ed0 */ 105,255,255, 75,101,255,255, 75,120, 27,122,124,  0,  0,  3,232,
 /* 0x1ee0 */   8,  0,131,232, 16,  0, 99, 56,  6,  0,160, 47, 16,  0,222, 65,
 /* 0x1ef0 */   0,  0, 32, 44,232,255,226, 64,  1,  0,128, 60,208,  0,196,127,
-/* 0x1f00 */  49,254,255, 75,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1f10 */ 109, 97,116, 32,101,108,102, 54, 52, 45,112,111,119,101,114,112,
-/* 0x1f20 */  99,108,101, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x1f30 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f40 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x1f50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x1f60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x1f70 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x1f80 */ 108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1f90 */  88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x1fa0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50,
-/* 0x1fd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1fe0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1ff0 */  32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x2000 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2040 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2050 */  89, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32,
-/* 0x2060 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 53, 52, 32, 32, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2080 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  32, 32, 48, 48, 48, 48, 48, 48, 52, 52, 32, 32, 50, 42, 42, 48,
-/* 0x20a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x20b0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32,
-/* 0x20c0 */  78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x20d0 */  48, 48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2100 */  48, 49, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2110 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2120 */  68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32,
-/* 0x2130 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 56,
-/* 0x2140 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2150 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2160 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,100, 99, 32, 32,
-/* 0x2170 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2180 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2190 */  32, 32, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32,
-/* 0x21a0 */  32, 32, 48, 48, 48, 48, 48, 48, 57, 52, 32, 32, 48, 48, 48, 48,
-/* 0x21b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x21c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x21d0 */  48, 48, 48, 48, 48, 51,100, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x21e0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x21f0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90,
-/* 0x2200 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2210 */  48, 48, 50, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2220 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,
-/* 0x2240 */  54, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2250 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55,
-/* 0x2260 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48,
-/* 0x2270 */  48, 48, 48, 48, 98, 98, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2290 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x22a0 */  48, 48, 52, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x22b0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x22c0 */  32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32,
-/* 0x22d0 */  32, 32, 48, 48, 48, 48, 48, 99, 55, 52, 32, 32, 48, 48, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x22f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2300 */  48, 48, 48, 48, 49, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2310 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2320 */  76, 89, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32,
-/* 0x2330 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 99, 32, 32, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2350 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2360 */  48, 32, 32, 48, 48, 48, 48, 49, 99, 98, 99, 32, 32, 50, 42, 42,
-/* 0x2370 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2380 */  68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72,
-/* 0x2390 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52,
-/* 0x23a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 99,100, 56, 32, 32,
-/* 0x23d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x23e0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70,
-/* 0x23f0 */  77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2400 */  48, 49, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2410 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2420 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 99,102,
-/* 0x2430 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2440 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2450 */  76, 89, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x2460 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49,102, 56, 32, 32, 48,
-/* 0x2470 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2480 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2490 */  48, 32, 32, 48, 48, 48, 48, 49,100, 49, 48, 32, 32, 50, 42, 42,
-/* 0x24a0 */  50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x24b0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77,
-/* 0x24c0 */  66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x24e0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48,
-/* 0x24f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2500 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2510 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2520 */  32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x2540 */  86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2550 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2560 */  69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x2580 */  78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2590 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x25a0 */  65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25b0 */  48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48,
-/* 0x25c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x25d0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x25e0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25f0 */  48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48,
-/* 0x2600 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2610 */  32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2620 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69,
-/* 0x2630 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2640 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9,
-/* 0x2650 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2660 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2670 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2680 */  78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2690 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x26a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x26b0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x26c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x26e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x26f0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x2700 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2710 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x2720 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2730 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2740 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2750 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2760 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2770 */  32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,  9, 48, 48, 48,
-/* 0x2780 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70,
-/* 0x2790 */  76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x27b0 */  70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27c0 */  48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x27d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27e0 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x27f0 */  78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2800 */  48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48,
-/* 0x2810 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x2820 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2830 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79, 95, 66, 73, 78,
-/* 0x2840 */  70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x2850 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77,
-/* 0x2860 */  65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2870 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2880 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2890 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28a0 */  32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 50, 52, 32, 32,
-/* 0x28b0 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120, 48, 48,
-/* 0x28c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 51, 99, 10, 10,
-/* 0x28d0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x28e0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10,
-/* 0x28f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2900 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2910 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2920 */  48, 48, 48, 48, 48, 48, 48, 99, 48, 32, 82, 95, 80, 80, 67, 54,
-/* 0x2930 */  52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x2940 */  84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2950 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x2960 */  86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x2970 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2980 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2990 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99, 99, 32,
-/* 0x29a0 */  82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x29b0 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79,
-/* 0x29c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x29d0 */  79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83,
-/* 0x29e0 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x29f0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2a00 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a10 */  48, 48, 48, 57, 56, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69,
-/* 0x2a20 */  76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2a30 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2a40 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69,
-/* 0x2a50 */  76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2a60 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2a70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2a80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2a90 */  32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32,
-/* 0x2aa0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120,
-/* 0x2ab0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 56,
-/* 0x2ac0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2ad0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73,
-/* 0x2ae0 */  78, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2af0 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2b00 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2b10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82,
-/* 0x2b20 */  95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 50, 52, 32, 32, 32, 32,
-/* 0x2b30 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2b40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2b50 */  82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70,
-/* 0x2b60 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x2b70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b90 */  48, 48, 48, 48, 49,102, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95,
-/* 0x2ba0 */  65, 68, 68, 82, 51, 50, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70,
-/* 0x2bb0 */  79, 10
+/* 0x1f00 */  49,254,255, 75,  0,  0,  0,  0, 13,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f10 */   7,  0,  0,  0,120,  2,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x1f20 */   4,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1f40 */  84,  1,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,152,  1,  0,  0,
+/* 0x1f50 */  68,  1,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,220,  2,  0,  0,
+/* 0x1f60 */ 248,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,212,  3,  0,  0,
+/* 0x1f70 */ 148,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,104,  4,  0,  0,
+/* 0x1f80 */  40,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,144,  4,  0,  0,
+/* 0x1f90 */ 184, 11,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 72, 16,  0,  0,
+/* 0x1fa0 */ 116, 12,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,188, 28,  0,  0,
+/* 0x1fb0 */  28,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,216, 28,  0,  0,
+/* 0x1fc0 */  36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,252, 28,  0,  0,
+/* 0x1fd0 */  18,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 16, 29,  0,  0,
+/* 0x1fe0 */ 248,  1,  0,  0,  2,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  0,  0,  0,  0,121,  0,  0,  0, 14,  0,  0,  0,
+/* 0x20d0 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */ 129,  0,  0,  0,  2,  0,  0,  0, 60,  1,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   2,  0,  0,  0,192,  0,  0,  0,143,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,
+/* 0x2110 */ 143,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   4,  0,  0,  0,152,  0,  0,  0,143,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2140 */ 143,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */  11,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,244,  1,  0,  0,
+/* 0x2170 */ 157,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */  69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65,
+/* 0x2190 */  68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82,
+/* 0x21a0 */  86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76,
+/* 0x21b0 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x21c0 */  69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0,
+/* 0x21d0 */  78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0,
+/* 0x21e0 */  69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x21f0 */  90,  0, 95,115,116, 97,114,116,  0, 79, 95, 66, 73, 78, 70, 79,
+/* 0x2200 */   0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 50, 52,  0, 82,
+/* 0x2210 */  95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52,  0, 82, 95, 80,
+/* 0x2220 */  80, 67, 54, 52, 95, 65, 68, 68, 82, 51, 50,  0,  8, 31,  0,  0,
+/* 0x2230 */  85, 80, 88, 76
 };
@@ -1,5 +1,5 @@
 /* powerpc64le-linux.kernel.vmlinux.h
-   created from powerpc64le-linux.kernel.vmlinux.bin, 11072 (0x2b40) bytes
+   created from powerpc64le-linux.kernel.vmlinux.bin, 8488 (0x2128) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_SIZE    11072
-#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_ADLER32 0x32d31c65
-#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_CRC32   0x6f42ed9b
+#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_SIZE    8488
+#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_ADLER32 0xdcdf8ff7
+#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_CRC32   0xb9d104d7
 
-unsigned char stub_powerpc64le_linux_kernel_vmlinux[11072] = {
+unsigned char stub_powerpc64le_linux_kernel_vmlinux[8488] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 21,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0, 72, 30,  0,  0,  0,  0,  0,  0,
@@ -508,224 +508,63 @@ unsigned char stub_powerpc64le_linux_kernel_vmlinux[11072] = {
 /* 0x1d50 */  32,  0,156,123, 32,  0, 74,121,152,254,255, 75,  0,  0,192, 58,
 /* 0x1d60 */  12,253,255, 75,  0,  0,  0,  0,  0,  0,  0,  0, 85, 80, 88, 33,
 /* 0x1d70 */ 161,216,208,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x1d80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,102,105,108,101,
-/* 0x1d90 */  32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,112,111,
-/* 0x1da0 */ 119,101,114,112, 99,108,101, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1db0 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1dc0 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1dd0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1de0 */  32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1df0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1e00 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 76, 73, 78,
-/* 0x1e10 */  85, 88, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52,
-/* 0x1e50 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1e60 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1e70 */  76, 89, 10, 32, 32, 49, 32, 76, 73, 78, 85, 88, 48, 49, 48, 32,
-/* 0x1e80 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48,
-/* 0x1e90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ea0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42,
-/* 0x1ec0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1ed0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50,
-/* 0x1ee0 */  32, 76, 73, 78, 85, 88, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 54, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1f30 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1f40 */  32, 32, 51, 32, 76, 73, 78, 85, 88, 48, 51, 48, 32, 32, 32, 32,
-/* 0x1f50 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1f60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f80 */  48, 48, 48, 48, 48, 48, 98, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1fa0 */  76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 56, 32, 32, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1fd0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 98, 52, 32, 32, 50, 42, 42,
-/* 0x1ff0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2000 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53,
-/* 0x2010 */  32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2020 */  48, 48, 48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2040 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2050 */  48, 48, 49, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2060 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2070 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 78, 82, 86, 50, 69,
-/* 0x2080 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 53,
-/* 0x2090 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,102, 48, 32,
-/* 0x20c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x20d0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x20e0 */  10, 32, 32, 55, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32,
-/* 0x20f0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 99, 32, 32, 48, 48, 48,
-/* 0x2100 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2120 */  32, 48, 48, 48, 48, 48, 52, 52, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2130 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2140 */  78, 76, 89, 10, 32, 32, 56, 32, 67, 70, 76, 85, 83, 72, 32, 32,
-/* 0x2150 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2180 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 54, 48, 32, 32, 50, 42,
-/* 0x2190 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x21a0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 76, 90, 77, 65, 32,
-/* 0x21b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21c0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 56, 52, 32,
-/* 0x21f0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2200 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 76, 90,
-/* 0x2210 */  77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2220 */  48, 48, 57, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,
-/* 0x2250 */  56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2260 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2270 */  78, 76, 89, 10, 32, 49, 49, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2280 */  51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 56, 32, 32,
-/* 0x2290 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 53, 49, 56, 32, 32, 50, 42,
-/* 0x22c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x22d0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 76, 90, 77, 65, 95,
-/* 0x22e0 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 98, 98,
-/* 0x22f0 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 53, 52, 48, 32,
-/* 0x2320 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2330 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 76, 90,
-/* 0x2340 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2350 */  48, 99, 55, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2370 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 48,
-/* 0x2380 */ 102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2390 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 52,
-/* 0x23a0 */  32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48,
-/* 0x23b0 */  48, 48, 48, 48, 48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x23e0 */  48, 49,100, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x23f0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2400 */  83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48,
-/* 0x2410 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2420 */  32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 50, 48,  9,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2440 */  32, 76, 73, 78, 85, 88, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2450 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2460 */ 100, 32, 32, 76, 73, 78, 85, 88, 48, 51, 48,  9, 48, 48, 48, 48,
-/* 0x2470 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 73, 78,
-/* 0x2480 */  85, 88, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2490 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x24a0 */  82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x24c0 */  76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x24e0 */  68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24f0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x2500 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2510 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88,
-/* 0x2520 */  48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 32, 76, 73, 78, 85, 88, 48, 48, 48, 10, 48, 48,
-/* 0x2540 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2550 */  32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 49, 48,  9,
-/* 0x2560 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */  32, 76, 73, 78, 85, 88, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2580 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2590 */ 100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10,
-/* 0x25b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48,
-/* 0x25d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x25e0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25f0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x2600 */  82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2610 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x2620 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2630 */  32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,  9, 48, 48, 48, 48,
-/* 0x2640 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70, 76,
-/* 0x2650 */  85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2660 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x2670 */  65,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2680 */  48, 48, 32, 76, 90, 77, 65, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2690 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x26a0 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48,
-/* 0x26b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77,
-/* 0x26c0 */  65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x26e0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48,
-/* 0x26f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77,
-/* 0x2700 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2710 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2720 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48,
-/* 0x2730 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77,
-/* 0x2740 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2750 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2760 */  32, 85, 80, 88, 49, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2770 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 85, 80, 88, 49, 72,
-/* 0x2780 */  69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2790 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x27a0 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27b0 */  48, 48, 48, 32,102,105,108,116,101,114, 95,108,101,110,103,116,
-/* 0x27c0 */ 104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27d0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x27e0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27f0 */  48, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 10, 82, 69,
-/* 0x2800 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2810 */  32, 70, 79, 82, 32, 91, 76, 73, 78, 85, 88, 48, 48, 48, 93, 58,
-/* 0x2820 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2830 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2840 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2850 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 80, 80, 67,
-/* 0x2860 */  54, 52, 95, 82, 69, 76, 50, 52, 32, 32, 32, 32, 32, 76, 73, 78,
-/* 0x2870 */  85, 88, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2880 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82,
-/* 0x2890 */  69, 76, 50, 52, 32, 32, 32, 32, 32, 76, 73, 78, 85, 88, 48, 50,
-/* 0x28a0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x28b0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 73, 78, 85, 88,
-/* 0x28c0 */  48, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x28d0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x28e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x28f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2900 */  82, 95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82, 51, 50, 32, 32,
-/* 0x2910 */  32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10,
-/* 0x2920 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2930 */  32, 82, 95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82, 51, 50, 32,
-/* 0x2940 */  32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 10, 82,
-/* 0x2950 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x2960 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79,
-/* 0x2970 */  70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2980 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2990 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29a0 */  48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 80, 80, 67, 54, 52,
-/* 0x29b0 */  95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84,
-/* 0x29c0 */  65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x29d0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x29e0 */  50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x29f0 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2a00 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2a10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82,
-/* 0x2a20 */  95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32,
-/* 0x2a30 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2a40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2a50 */  82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2a60 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2a70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2a80 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a90 */  48, 48, 99, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
-/* 0x2aa0 */  49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10,
-/* 0x2ab0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2ac0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76,
-/* 0x2ad0 */  70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x2ae0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2af0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2b00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x2b10 */  82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x2b20 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48,
-/* 0x2b30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 56, 10
+/* 0x1d80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45, 15,  0,  0,  0,
+/* 0x1d90 */  17,  0,  0,  0,  8,  0,  0,  0,208,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */  64,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1db0 */  72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1dc0 */  80,  0,  0,  0,100,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1dd0 */ 180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1de0 */ 180,  0,  0,  0,248,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,
+/* 0x1df0 */ 172,  1,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,
+/* 0x1e00 */ 240,  2,  0,  0, 84,  1,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x1e10 */  68,  4,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x1e20 */  96,  4,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,
+/* 0x1e30 */ 132,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,
+/* 0x1e40 */ 132,  4,  0,  0,148,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,
+/* 0x1e50 */  24,  5,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,
+/* 0x1e60 */  64,  5,  0,  0,184, 11,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
+/* 0x1e70 */ 248, 16,  0,  0,116, 12,  0,  0,  0,  0,  0,  0,119,  0,  0,  0,
+/* 0x1e80 */ 108, 29,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1e90 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1ea0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x1eb0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,
+/* 0x1ec0 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1ee0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1ef0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,
+/* 0x1f00 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,
+/* 0x1f10 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x1f20 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,
+/* 0x1f30 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,
+/* 0x1f40 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,
+/* 0x1f50 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
+/* 0x1f60 */  13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,119,  0,  0,  0,
+/* 0x1f70 */  14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,
+/* 0x1f80 */  16,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,142,  0,  0,  0,
+/* 0x1f90 */  16,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,153,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,153,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,167,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,167,  0,  0,  0,
+/* 0x1ff0 */  16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2000 */ 152,  0,  0,  0,182,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  5,  0,  0,  0,204,  0,  0,  0,182,  0,  0,  0,
+/* 0x2020 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x2030 */ 192,  0,  0,  0,182,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0, 10,  0,  0,  0,  4,  0,  0,  0,182,  0,  0,  0,
+/* 0x2050 */   3,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0, 76, 73, 78, 85,
+/* 0x2060 */  88, 48, 48, 48,  0, 76, 73, 78, 85, 88, 48, 49, 48,  0, 76, 73,
+/* 0x2070 */  78, 85, 88, 48, 50, 48,  0, 76, 73, 78, 85, 88, 48, 51, 48,  0,
+/* 0x2080 */  78, 82, 86, 50, 66,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50,
+/* 0x2090 */  69,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83,
+/* 0x20a0 */  72,  0, 76, 90, 77, 65,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48,
+/* 0x20b0 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90, 77,
+/* 0x20c0 */  65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x20d0 */  50, 48,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0,102,105,108,116,
+/* 0x20e0 */ 101,114, 95,108,101,110,103,116,104,  0,102,105,108,116,101,114,
+/* 0x20f0 */  95, 99,116,111,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
+/* 0x2100 */  50, 52,  0, 82, 95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82, 51,
+/* 0x2110 */  50,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52,  0,
+/* 0x2120 */ 140, 29,  0,  0, 85, 80, 88, 76
 };
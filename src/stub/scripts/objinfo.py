@@ -0,0 +1,228 @@
+#! /usr/bin/env python
+## vim:set ts=4 sw=4 et: -*- coding: utf-8 -*-
+#
+#  objinfo.py -- append binary link tables to a stub object
+#
+#  This file is part of the UPX executable compressor.
+#
+#  Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+#  All Rights Reserved.
+#
+#  UPX and the UCL library are free software; you can redistribute them
+#  and/or modify them under the terms of the GNU General Public License as
+#  published by the Free Software Foundation; either version 2 of
+#  the License, or (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program; see the file COPYING.
+#  If not, write to the Free Software Foundation, Inc.,
+#  59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+#
+#  Markus F.X.J. Oberhumer              Laszlo Molnar
+#  <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+#
+
+
+#
+# The sections, symbols and relocations of "objdump -htr" are converted
+# into the tables which ElfLinker::preprocessLinkInfo() reads directly,
+# so that upx does not have to parse any text at run time.
+#
+# All values are little endian:
+#
+#   link info:
+#     LE32  number of sections (without *ABS* and *UND*)
+#     LE32  number of symbols
+#     LE32  number of relocations
+#     LE32  offset of the string table (relative to the link info)
+#     sections[]:    LE32 name, LE32 file offset, LE32 size, LE32 p2align
+#     symbols[]:     LE32 name, LE32 section, LE64 value
+#     relocations[]: LE32 section, LE32 offset, LE32 type, LE32 symbol, LE64 addend
+#     string table:  NUL terminated strings
+#   trailer:
+#     LE32  file offset of the link info
+#     "UPXL"
+#
+# Section indices nsections and nsections+1 denote *ABS* and *UND*.
+#
+
+import getopt, re, struct, sys
+
+
+class opts:
+    dry_run = 0
+    verbose = 0
+    with_dump = None
+    dump_in_file = 0
+
+
+MAGIC = b"UPXL"
+
+
+# /***********************************************************************
+# // parse the dump just like ElfLinker::preprocess{Sections,Symbols,Relocations}
+# ************************************************************************/
+
+class ObjInfo:
+    def __init__(self):
+        self.sections = []      # (name, offset, size, p2align)
+        self.section_index = {}
+        self.symbols = []       # (name, section, value)
+        self.symbol_index = {}
+        self.relocs = []        # (section, offset, type, symbol, add)
+
+    def add_section(self, name, offset, size, p2align):
+        assert name and not name.endswith(":"), name
+        assert name not in self.section_index, ("duplicate section", name)
+        self.section_index[name] = len(self.sections)
+        self.sections.append((name, offset, size, p2align))
+
+    def add_symbol(self, name, section, value):
+        assert name and not name.endswith(":"), name
+        assert name not in self.symbol_index, ("duplicate symbol", name)
+        self.symbol_index[name] = len(self.symbols)
+        self.symbols.append((name, self.section_index[section], value))
+
+
+def parse_dump(d):
+    psections = d.find("Sections:\n")
+    assert psections >= 0, "no sections"
+    psymbols = d.find("SYMBOL TABLE:\n", psections)
+    assert psymbols >= 0, "no symbol table"
+    prelocs = d.find("RELOCATION RECORDS FOR ", psymbols)
+    assert prelocs >= 0, "no relocations"
+    info = ObjInfo()
+    # preprocessSections
+    for l in d[psections:psymbols].split("\n"):
+        f = l.split()
+        if len(f) >= 7 and re.search(r"^\d+$", f[0]) and f[6].startswith("2**"):
+            info.add_section(f[1], int(f[5], 16), int(f[2], 16), int(f[6][3:], 10))
+    nsections = len(info.sections)
+    info.add_section("*ABS*", 0, 0, 0)
+    info.add_section("*UND*", 0, 0, 0)
+    # preprocessSymbols
+    for l in d[psymbols:prelocs].split("\n"):
+        m = re.search(r"^\s*([0-9a-fA-F]+)\s+g\s+\*ABS\*\s+([0-9a-fA-F]+)\s+(\S+)", l)
+        if m:
+            assert int(m.group(2), 16) == 0, l
+            info.add_symbol(m.group(3), "*ABS*", int(m.group(1), 16))
+            continue
+        m = re.search(r"^\s*([0-9a-fA-F]+)", l)
+        if not m:
+            continue
+        f = l[m.end() + 8:].split()
+        if len(f) >= 3 and re.search(r"^[0-9a-fA-F]+", f[1]):
+            value = int(m.group(1), 16)
+            if f[0] == "*UND*":
+                value = 0xdeaddead
+            assert f[0] != "*ABS*", l
+            info.add_symbol(f[2], f[0], value)
+    # preprocessRelocations
+    section = None
+    for l in d[prelocs:].split("\n"):
+        m = re.search(r"^RELOCATION RECORDS FOR \[([^]]*)", l)
+        if m:
+            section = info.section_index[m.group(1)]
+        m = re.search(r"^\s*([0-9a-fA-F]+)\s+(\S+)\s+(\S+)", l)
+        if not m or section is None:
+            continue
+        symbol, add = m.group(3), 0
+        p = symbol.find("+0x")
+        if p < 0:
+            p = symbol.find("-0x")
+        if p >= 0:
+            assert len(symbol[p+3:]) in [8, 16], l
+            add = int(symbol[p+3:], 16)
+            if symbol[p] == "-":
+                add = (0 - add) & 0xffffffffffffffff
+            symbol = symbol[:p]
+        info.relocs.append((section, int(m.group(1), 16), m.group(2),
+                            info.symbol_index[symbol], add))
+    return info, nsections
+
+
+# /***********************************************************************
+# // write the tables
+# ************************************************************************/
+
+def encode(info, nsections, base):
+    strings = []
+    string_index = {}
+    def s(x):
+        if x not in string_index:
+            string_index[x] = sum([len(y) + 1 for y in strings])
+            strings.append(x)
+        return string_index[x]
+    secs, syms, rels = [], [], []
+    for name, offset, size, p2align in info.sections[:nsections]:
+        assert offset + size <= base, (name, offset, size, base)
+        secs.append(struct.pack("<IIII", s(name), offset, size, p2align))
+    for name, section, value in info.symbols:
+        syms.append(struct.pack("<IIQ", s(name), section, value))
+    for section, offset, rtype, symbol, add in info.relocs:
+        rels.append(struct.pack("<IIIIQ", section, offset, s(rtype), symbol, add))
+    head_len = 16 + 16 * len(secs) + 16 * len(syms) + 24 * len(rels)
+    head = struct.pack("<IIII", nsections, len(syms), len(rels), head_len)
+    strtab = b"".join([x.encode("latin-1") + b"\0" for x in strings])
+    return head + b"".join(secs + syms + rels) + strtab + struct.pack("<I", base) + MAGIC
+
+
+def do_file(fn):
+    fp = open(fn, "rb")
+    idata = fp.read()
+    fp.close()
+    assert idata[-len(MAGIC):] != MAGIC, ("already converted", fn)
+    if opts.dump_in_file:
+        # the dump was appended by an older "cat $1.dump >> $1"
+        pos = idata.rfind(b"file format ", 0, idata.find(b"Sections:\n"))
+        assert pos > 0, ("no dump", fn)
+        idata, dump = idata[:pos], idata[pos:]
+    else:
+        dump = open(opts.with_dump, "rb").read()
+    dump = dump.decode("latin-1").replace("\r\n", "\n")
+    info, nsections = parse_dump(dump)
+    odata = idata + encode(info, nsections, len(idata))
+    if opts.verbose > 0:
+        print("%s: %d sections, %d symbols, %d relocations, %d -> %d bytes" % (
+              fn, nsections, len(info.symbols), len(info.relocs), len(idata) + len(dump), len(odata)))
+    if not opts.dry_run:
+        fp = open(fn, "wb")
+        fp.write(odata)
+        fp.close()
+
+
+def main(argv):
+    try: assert 0
+    except AssertionError: pass
+    else: raise Exception("fatal error - assertions not enabled")
+    shortopts, longopts = "qv", [
+        "dry-run", "dump-in-file", "quiet", "verbose", "with-dump="
+    ]
+    xopts, args = getopt.gnu_getopt(argv[1:], shortopts, longopts)
+    for opt, optarg in xopts:
+        if 0: pass
+        elif opt in ["-q", "--quiet"]: opts.verbose = opts.verbose - 1
+        elif opt in ["-v", "--verbose"]: opts.verbose = opts.verbose + 1
+        elif opt in ["--dry-run"]: opts.dry_run = opts.dry_run + 1
+        elif opt in ["--dump-in-file"]: opts.dump_in_file = 1
+        elif opt in ["--with-dump"]: opts.with_dump = optarg
+        else: assert 0, ("getopt problem:", opt, optarg, xopts, args)
+    if not args:
+        raise Exception("error: no arguments given")
+    if not opts.with_dump and not opts.dump_in_file:
+        raise Exception("error: need --with-dump or --dump-in-file")
+    if opts.with_dump:
+        assert len(args) == 1, "need exactly one file"
+    # process arguments
+    for arg in args:
+        do_file(arg)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,200 @@
+/* thread.cpp --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2020 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+#include "conf.h"
+#include "thread.h"
+
+#if (WITH_THREADS)
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+
+/*************************************************************************
+//
+**************************************************************************/
+
+unsigned upx_thread_get_cpu_count(void)
+{
+    long n = 1;
+#if (WITH_THREADS) && defined(_SC_NPROCESSORS_ONLN)
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (n < 1)
+        n = 1;
+    if (n > 256)
+        n = 256;
+    return (unsigned) n;
+}
+
+
+unsigned upx_thread_get_nthreads(int threads)
+{
+#if (WITH_THREADS)
+    if (threads <= 0)
+        return upx_thread_get_cpu_count();
+    return (unsigned) UPX_MIN(threads, 256);
+#else
+    UNUSED(threads);
+    return 1;
+#endif
+}
+
+
+/*************************************************************************
+// upx_thread_run_tasks
+**************************************************************************/
+
+struct ThreadTaskRunner
+{
+    upx_thread_task_t task;
+    void *user;
+    unsigned ntasks;
+    bool *task_ok;
+    unsigned next;
+    unsigned nfailed;
+    options_t *options;     // the caller's current options
+    Mutex mutex;
+
+    bool getNext(unsigned *index, bool prev_ok)
+    {
+        MutexLocker lock(&mutex);
+        if (!prev_ok)
+            nfailed++;
+        if (next >= ntasks)
+            return false;
+        *index = next++;
+        return true;
+    }
+
+    void work()
+    {
+        unsigned index = 0;
+        bool ok = true;
+        while (getNext(&index, ok))
+        {
+            ok = false;
+            try {
+                task(user, index);
+                ok = true;
+            } catch (...) {
+            }
+            if (task_ok)
+                task_ok[index] = ok;
+        }
+    }
+};
+
+#if (WITH_THREADS)
+extern "C" {
+static void *upx_thread_start(void *p)
+{
+    ThreadTaskRunner *r = (ThreadTaskRunner *) p;
+    opt = r->options;   // "opt" is per-thread, see options.h
+    r->work();
+    return NULL;
+}
+}
+#endif
+
+
+bool upx_thread_run_tasks(upx_thread_task_t task, void *user,
+                          unsigned ntasks, unsigned nthreads,
+                          bool *task_ok)
+{
+    ThreadTaskRunner r;
+    r.task = task;
+    r.user = user;
+    r.ntasks = ntasks;
+    r.task_ok = task_ok;
+    r.next = 0;
+    r.nfailed = 0;
+    r.options = opt;
+
+    if (nthreads > ntasks)
+        nthreads = ntasks;
+#if (WITH_THREADS)
+    pthread_t tids[256];
+    unsigned nstarted = 0;
+    while (nstarted + 1 < nthreads && nstarted < 256)
+    {
+        if (pthread_create(&tids[nstarted], NULL, upx_thread_start, &r) != 0)
+            break;  // just use fewer threads
+        nstarted++;
+    }
+    r.work();
+    for (unsigned i = 0; i < nstarted; i++)
+        pthread_join(tids[i], NULL);
+#else
+    UNUSED(nthreads);
+    r.work();
+#endif
+    return r.nfailed == 0;
+}
+
+
+/*************************************************************************
+// mutex
+**************************************************************************/
+
+Mutex::Mutex() : m(NULL)
+{
+#if (WITH_THREADS)
+    pthread_mutex_t *pm = new pthread_mutex_t;
+    if (pthread_mutex_init(pm, NULL) != 0)
+    {
+        delete pm;
+        throwInternalError("pthread_mutex_init failed");
+    }
+    m = pm;
+#endif
+}
+
+Mutex::~Mutex()
+{
+#if (WITH_THREADS)
+    pthread_mutex_t *pm = (pthread_mutex_t *) m;
+    pthread_mutex_destroy(pm);
+    delete pm;
+#endif
+}
+
+void Mutex::lock()
+{
+#if (WITH_THREADS)
+    pthread_mutex_lock((pthread_mutex_t *) m);
+#endif
+}
+
+void Mutex::unlock()
+{
+#if (WITH_THREADS)
+    pthread_mutex_unlock((pthread_mutex_t *) m);
+#endif
+}
+
+/* vim:set ts=4 sw=4 et: */
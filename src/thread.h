@@ -0,0 +1,82 @@
+/* thread.h --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2020 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2020 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+#ifndef __UPX_THREAD_H
+#define __UPX_THREAD_H 1
+
+/*************************************************************************
+// very simple fork/join helpers
+//
+// Tasks are numbered 0..ntasks-1 and handed out in increasing order.
+// The calling thread acts as a worker as well; if WITH_THREADS is not
+// set (or if creating a thread fails) all tasks simply run serially.
+// Worker threads start with the caller's current "opt".
+**************************************************************************/
+
+typedef void (*upx_thread_task_t)(void *user, unsigned index);
+
+// number of online CPUs, at least 1
+unsigned upx_thread_get_cpu_count(void);
+// map a "--threads" style value (0 means "all CPUs") to a thread count
+unsigned upx_thread_get_nthreads(int threads);
+
+// Run all tasks and wait for them. Exceptions never propagate out of a
+// worker: if task_ok is not NULL then task_ok[index] records if
+// the task returned normally. Returns true if all tasks did.
+bool upx_thread_run_tasks(upx_thread_task_t task, void *user,
+                          unsigned ntasks, unsigned nthreads,
+                          bool *task_ok = NULL);
+
+
+/*************************************************************************
+// mutex
+**************************************************************************/
+
+class Mutex : private noncopyable
+{
+public:
+    Mutex();
+    ~Mutex();
+    void lock();
+    void unlock();
+private:
+    void *m;
+};
+
+class MutexLocker : private noncopyable
+{
+public:
+    explicit MutexLocker(Mutex *mutex) : m(mutex) { m->lock(); }
+    ~MutexLocker() { m->unlock(); }
+private:
+    Mutex *m;
+};
+
+
+#endif /* already included */
+
+/* vim:set ts=4 sw=4 et: */
@@ -30,6 +30,7 @@
 #include "ui.h"
 #include "screen.h"
 #include "packer.h"
+#include "packmast.h"
 
 #if 1 && (USE_SCREEN)
 #define UI_USE_SCREEN 1
@@ -76,16 +77,7 @@ struct UiPacker::State {
 #endif
 };
 
-unsigned UiPacker::total_files = 0;
-unsigned UiPacker::total_files_done = 0;
-upx_uint64_t UiPacker::total_c_len = 0;
-upx_uint64_t UiPacker::total_u_len = 0;
-upx_uint64_t UiPacker::total_fc_len = 0;
-upx_uint64_t UiPacker::total_fu_len = 0;
-unsigned UiPacker::update_c_len = 0;
-unsigned UiPacker::update_u_len = 0;
-unsigned UiPacker::update_fc_len = 0;
-unsigned UiPacker::update_fu_len = 0;
+UiTotals::UiTotals() : files(0), files_done(0), c_len(0), u_len(0), fc_len(0), fu_len(0) {}
 
 /*************************************************************************
 // constants
@@ -129,7 +121,7 @@ static void init_global_constants(void) {
 static const char *mkline(upx_uint64_t fu_len, upx_uint64_t fc_len, upx_uint64_t u_len,
                           upx_uint64_t c_len, const char *format_name, const char *filename,
                           bool decompress = false) {
-    static char buf[2048];
+    static UPX_THREAD_LOCAL char buf[2048];
     char r[7 + 1];
     char fn[15 + 1];
     const char *f;
@@ -173,7 +165,7 @@ UiPacker::UiPacker(const Packer *p_) : ui_pass(0), ui_total_passes(0), p(p_), s(
 
     if (opt->verbose < 0)
         s->mode = M_QUIET;
-    else if (opt->verbose == 0 || !acc_isatty(STDOUT_FILENO))
+    else if (opt->verbose == 0 || !acc_isatty(STDOUT_FILENO) || con_capture)
         s->mode = M_INFO;
     else if (opt->verbose == 1 || opt->no_progress)
         s->mode = M_MSG;
@@ -446,7 +438,7 @@ void UiPacker::doCallback(unsigned isize, unsigned osize) {
 **************************************************************************/
 
 void UiPacker::uiPackStart(const OutputFile *fo) {
-    total_files++;
+    countFile();
     UNUSED(fo);
 }
 
@@ -471,9 +463,9 @@ void UiPacker::uiPackEnd(const OutputFile *fo) {
     printSetNl(0);
 }
 
-void UiPacker::uiPackTotal() {
-    uiListTotal();
-    uiFooter("Packed");
+void UiPacker::uiPackTotal(const UiTotals *t) {
+    uiListTotal(t);
+    uiFooter(t, "Packed");
 }
 
 /*************************************************************************
@@ -481,7 +473,7 @@ void UiPacker::uiPackTotal() {
 **************************************************************************/
 
 void UiPacker::uiUnpackStart(const OutputFile *fo) {
-    total_files++;
+    countFile();
     UNUSED(fo);
 }
 
@@ -501,16 +493,16 @@ void UiPacker::uiUnpackEnd(const OutputFile *fo) {
     printSetNl(0);
 }
 
-void UiPacker::uiUnpackTotal() {
-    uiListTotal(true);
-    uiFooter("Unpacked");
+void UiPacker::uiUnpackTotal(const UiTotals *t) {
+    uiListTotal(t, true);
+    uiFooter(t, "Unpacked");
 }
 
 /*************************************************************************
 // list
 **************************************************************************/
 
-void UiPacker::uiListStart() { total_files++; }
+void UiPacker::uiListStart() { countFile(); }
 
 void UiPacker::uiList() {
     const char *name = p->fi->getName();
@@ -521,13 +513,13 @@ void UiPacker::uiList() {
 
 void UiPacker::uiListEnd() { uiUpdate(); }
 
-void UiPacker::uiListTotal(bool decompress) {
-    if (opt->verbose >= 1 && total_files >= 2) {
+void UiPacker::uiListTotal(const UiTotals *t, bool decompress) {
+    if (opt->verbose >= 1 && t->files >= 2) {
         char name[32];
-        upx_snprintf(name, sizeof(name), "[ %u file%s ]", total_files_done,
-                     total_files_done == 1 ? "" : "s");
-        con_fprintf(stdout, "%s%s\n", header_line2, mkline(total_fu_len, total_fc_len, total_u_len,
-                                                           total_c_len, "", name, decompress));
+        upx_snprintf(name, sizeof(name), "[ %u file%s ]", t->files_done,
+                     t->files_done == 1 ? "" : "s");
+        con_fprintf(stdout, "%s%s\n", header_line2,
+                    mkline(t->fu_len, t->fc_len, t->u_len, t->c_len, "", name, decompress));
         printSetNl(0);
     }
 }
@@ -537,7 +529,7 @@ void UiPacker::uiListTotal(bool decompress) {
 **************************************************************************/
 
 void UiPacker::uiTestStart() {
-    total_files++;
+    countFile();
 
     if (opt->verbose >= 1) {
         con_fprintf(stdout, "testing %s ", p->fi->getName());
@@ -555,7 +547,7 @@ void UiPacker::uiTestEnd() {
     uiUpdate();
 }
 
-void UiPacker::uiTestTotal() { uiFooter("Tested"); }
+void UiPacker::uiTestTotal(const UiTotals *t) { uiFooter(t, "Tested"); }
 
 /*************************************************************************
 // info
@@ -567,7 +559,7 @@ bool UiPacker::uiFileInfoStart() {
 #else
 #define PRLLD "lld"
 #endif
-    total_files++;
+    countFile();
 
     int fg = con_fg(stdout, FG_CYAN);
     con_fprintf(stdout, "%s [%s, %s]\n", p->fi->getName(), p->getFullName(opt), p->getName());
@@ -588,7 +580,7 @@ bool UiPacker::uiFileInfoStart() {
 
 void UiPacker::uiFileInfoEnd() { uiUpdate(); }
 
-void UiPacker::uiFileInfoTotal() {}
+void UiPacker::uiFileInfoTotal(const UiTotals *t) { UNUSED(t); }
 
 /*************************************************************************
 // util
@@ -606,16 +598,16 @@ void UiPacker::uiHeader() {
     }
 }
 
-void UiPacker::uiFooter(const char *t) {
+void UiPacker::uiFooter(const UiTotals *tt, const char *t) {
     static bool done = false;
     if (done)
         return;
     done = true;
     if (opt->verbose >= 1) {
-        assert(total_files >= total_files_done);
-        unsigned n1 = total_files;
-        unsigned n2 = total_files_done;
-        unsigned n3 = total_files - total_files_done;
+        assert(tt->files >= tt->files_done);
+        unsigned n1 = tt->files;
+        unsigned n2 = tt->files_done;
+        unsigned n3 = tt->files - tt->files_done;
         if (n3 == 0)
             con_fprintf(stdout, "\n%s %u file%s.\n", t, n1, n1 == 1 ? "" : "s");
         else
@@ -625,18 +617,32 @@ void UiPacker::uiFooter(const char *t) {
 }
 
 void UiPacker::uiUpdate(off_t fc_len, off_t fu_len) {
-    update_fc_len = (fc_len >= 0) ? fc_len : p->file_size;
-    update_fu_len = (fu_len >= 0) ? fu_len : p->ph.u_file_size;
-    update_c_len = p->ph.c_len;
-    update_u_len = p->ph.u_len;
+    PackContext *ctx = p->ctx;
+    assert(ctx != NULL);
+    ctx->update_fc_len = (fc_len >= 0) ? fc_len : p->file_size;
+    ctx->update_fu_len = (fu_len >= 0) ? fu_len : p->ph.u_file_size;
+    ctx->update_c_len = p->ph.c_len;
+    ctx->update_u_len = p->ph.u_len;
 }
 
-void UiPacker::uiConfirmUpdate() {
-    total_files_done++;
-    total_fc_len += update_fc_len;
-    total_fu_len += update_fu_len;
-    total_c_len += update_c_len;
-    total_u_len += update_u_len;
+void UiPacker::countFile() {
+    UiTotals *t = p->ctx ? p->ctx->totals : NULL;
+    if (t == NULL)
+        return;
+    MutexLocker lock(&t->mutex);
+    t->files++;
+}
+
+void UiPacker::uiConfirmUpdate(PackContext *ctx) {
+    UiTotals *t = ctx->totals;
+    if (t == NULL)
+        return;
+    MutexLocker lock(&t->mutex);
+    t->files_done++;
+    t->fc_len += ctx->update_fc_len;
+    t->fu_len += ctx->update_fu_len;
+    t->c_len += ctx->update_c_len;
+    t->u_len += ctx->update_u_len;
 }
 
 /* vim:set ts=4 sw=4 et: */
@@ -28,10 +28,29 @@
 #ifndef __UPX_UI_H
 #define __UPX_UI_H 1
 
+#include "thread.h"
+
 class InputFile;
 class OutputFile;
 class Packer;
 class UiPacker;
+struct PackContext;
+
+/*************************************************************************
+// the totals of all files of a run
+**************************************************************************/
+
+struct UiTotals {
+    UiTotals();
+
+    unsigned files;
+    unsigned files_done;
+    upx_uint64_t c_len;
+    upx_uint64_t u_len;
+    upx_uint64_t fc_len;
+    upx_uint64_t fu_len;
+    Mutex mutex;
+};
 
 /*************************************************************************
 //
@@ -44,12 +63,12 @@ public:
 public:
     virtual ~UiPacker();
 
-    static void uiConfirmUpdate();
-    static void uiPackTotal();
-    static void uiUnpackTotal();
-    static void uiListTotal(bool uncompress = false);
-    static void uiTestTotal();
-    static void uiFileInfoTotal();
+    static void uiConfirmUpdate(PackContext *ctx);
+    static void uiPackTotal(const UiTotals *t);
+    static void uiUnpackTotal(const UiTotals *t);
+    static void uiListTotal(const UiTotals *t, bool uncompress = false);
+    static void uiTestTotal(const UiTotals *t);
+    static void uiFileInfoTotal(const UiTotals *t);
 
 public:
     virtual void uiPackStart(const OutputFile *fo);
@@ -78,10 +97,11 @@ protected:
 
 protected:
     virtual void uiUpdate(off_t fc_len = -1, off_t fu_len = -1);
+    virtual void countFile();
 
 public:
     static void uiHeader();
-    static void uiFooter(const char *n);
+    static void uiFooter(const UiTotals *t, const char *n);
 
     int ui_pass;
     int ui_total_passes;
@@ -96,18 +116,6 @@ protected:
     // internal state
     struct State;
     State *s;
-
-    // totals
-    static unsigned total_files;
-    static unsigned total_files_done;
-    static upx_uint64_t total_c_len;
-    static upx_uint64_t total_u_len;
-    static upx_uint64_t total_fc_len;
-    static upx_uint64_t total_fu_len;
-    static unsigned update_c_len;
-    static unsigned update_u_len;
-    static unsigned update_fc_len;
-    static unsigned update_fu_len;
 };
 
 #endif /* already included */
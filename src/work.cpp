@@ -30,6 +30,8 @@
 #include "packmast.h"
 #include "packer.h"
 #include "ui.h"
+#include "cache.h"
+#include "thread.h"
 
 #if (ACC_OS_DOS32) && defined(__DJGPP__)
 #define USE_FTIME 1
@@ -52,11 +54,15 @@
 // ignore errors in some cases and silence __attribute__((__warn_unused_result__))
 #define IGNORE_ERROR(var) ACC_UNUSED(var)
 
+#if (WITH_THREAD_LOCAL)
+static void check_jobs_commit(void);
+#endif
+
 /*************************************************************************
 // process one file
 **************************************************************************/
 
-void do_one_file(const char *iname, char *oname) {
+void do_one_file(const char *iname, char *oname, UiTotals *totals) {
     int r;
     struct stat st;
     memset(&st, 0, sizeof(st));
@@ -99,6 +105,7 @@ void do_one_file(const char *iname, char *oname) {
     InputFile fi;
     fi.st = st;
     fi.sopen(iname, O_RDONLY | O_BINARY, SH_DENYWR);
+    (void) fi.map(); // optional
 
 #if (USE_FTIME)
     struct ftime fi_ftime;
@@ -117,25 +124,7 @@ void do_one_file(const char *iname, char *oname) {
                 throwIOException("data not written to a terminal; Use '-f' to force.");
         } else {
             char tname[ACC_FN_PATH_MAX + 1];
-            if (opt->output_name)
-                strcpy(tname, opt->output_name);
-            else {
-                if (!maketempname(tname, sizeof(tname), iname, ".upx"))
-                    throwIOException("could not create a temporary file name");
-            }
-            if (opt->force >= 2) {
-#if (HAVE_CHMOD)
-                r = chmod(tname, 0777);
-                IGNORE_ERROR(r);
-#endif
-                r = unlink(tname);
-                IGNORE_ERROR(r);
-            }
             int flags = O_CREAT | O_WRONLY | O_BINARY;
-            if (opt->force)
-                flags |= O_TRUNC;
-            else
-                flags |= O_EXCL;
             int shmode = SH_DENYWR;
 #if defined(__MINT__)
             flags |= O_TRUNC;
@@ -146,14 +135,46 @@ void do_one_file(const char *iname, char *oname) {
             int omode = 0600;
             if (!opt->preserve_mode)
                 omode = 0666;
-            fo.sopen(tname, flags, shmode, omode);
+            if (opt->output_name) {
+                strcpy(tname, opt->output_name);
+                if (opt->force >= 2) {
+#if (HAVE_CHMOD)
+                    r = chmod(tname, 0777);
+                    IGNORE_ERROR(r);
+#endif
+                    r = unlink(tname);
+                    IGNORE_ERROR(r);
+                }
+                if (opt->force)
+                    flags |= O_TRUNC;
+                else
+                    flags |= O_EXCL;
+                fo.sopen(tname, flags, shmode, omode);
+            } else {
+                // The temporary file is always a new one. With "--jobs"
+                // another file may pick the same name at the same time
+                // (foo.exe and foo.dll both give foo.upx), so create it
+                // exclusively and take the next free name if we lose.
+                for (int tries = 0;; tries++) {
+                    if (!maketempname(tname, sizeof(tname), iname, ".upx"))
+                        throwIOException("could not create a temporary file name");
+                    try {
+                        fo.sopen(tname, flags | O_EXCL, shmode, omode);
+                        break;
+                    } catch (const FileAlreadyExistsException &) {
+                        if (tries >= 1000)
+                            throw;
+                    }
+                }
+            }
             // open succeeded - now set oname[]
             strcpy(oname, tname);
         }
     }
 
     // handle command
-    PackMaster pm(&fi, opt);
+    PackContext ctx(opt, totals, con_capture);
+    PackMaster pm(&fi, &ctx);
     if (opt->cmd == CMD_COMPRESS)
         pm.pack(&fo);
     else if (opt->cmd == CMD_DECOMPRESS)
@@ -187,6 +208,9 @@ void do_one_file(const char *iname, char *oname) {
 
     // rename or delete files
     if (oname[0] && !opt->output_name) {
+#if (WITH_THREAD_LOCAL)
+        check_jobs_commit();
+#endif
         // FIXME: .exe or .cof etc.
         if (!opt->backup) {
 #if (HAVE_CHMOD)
@@ -235,11 +259,11 @@ void do_one_file(const char *iname, char *oname) {
 #endif
     }
 
-    UiPacker::uiConfirmUpdate();
+    UiPacker::uiConfirmUpdate(&ctx);
 }
 
 /*************************************************************************
-// process all files from the commandline
+// process one file from the commandline and report errors
 **************************************************************************/
 
 static void unlink_ofile(char *oname) {
@@ -254,66 +278,208 @@ static void unlink_ofile(char *oname) {
     }
 }
 
+// process one file and report any errors; returns false if the error
+// is fatal and no further files must be processed
+static bool do_files_one(const char *iname, UiTotals *totals, int *ec) {
+    infoHeader();
+
+    char oname[ACC_FN_PATH_MAX + 1];
+    oname[0] = 0;
+    *ec = EXIT_OK;
+
+    try {
+        do_one_file(iname, oname, totals);
+    } catch (const Exception &e) {
+        unlink_ofile(oname);
+        if (opt->verbose >= 1 || (opt->verbose >= 0 && !e.isWarning()))
+            printErr(iname, &e);
+        *ec = e.isWarning() ? EXIT_WARN : EXIT_ERROR;
+    } catch (const Error &e) {
+        unlink_ofile(oname);
+        printErr(iname, &e);
+        return false;
+    } catch (std::bad_alloc *e) {
+        unlink_ofile(oname);
+        printErr(iname, "out of memory");
+        UNUSED(e);
+        // delete e;
+        return false;
+    } catch (const std::bad_alloc &) {
+        unlink_ofile(oname);
+        printErr(iname, "out of memory");
+        return false;
+    } catch (std::exception *e) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, e);
+        // delete e;
+        return false;
+    } catch (const std::exception &e) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, &e);
+        return false;
+    } catch (...) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, NULL);
+        return false;
+    }
+    return true;
+}
+
+/*************************************************************************
+// process several files at the same time ("--jobs")
+//
+// The output of each file is captured and written out in command line
+// order as soon as all previous files are done, so that the output and
+// the exit code are the same as for a serial run. After a fatal error
+// no further files are started, files that are still running do not
+// replace their input file, and the output of all files after the
+// failed one is discarded - just as if they never ran. Only a file
+// that was already replaced before the error happened is reported.
+**************************************************************************/
+
+#if (WITH_THREAD_LOCAL)
+
+struct DoFilesJobs {
+    char **files;
+    unsigned nfiles;
+    UiTotals *totals;
+    ConsoleCapture *captures;
+    int *exit_codes;
+    bool *done;
+    bool *committed;        // the input file was replaced
+    unsigned next_replay;   // first file whose output is not yet written
+    unsigned fatal;         // first file with a fatal error, or nfiles
+    Mutex mutex;
+};
+
+// the "--jobs" run and file of the current thread, if any
+static UPX_THREAD_LOCAL DoFilesJobs *jobs_current = NULL;
+static UPX_THREAD_LOCAL unsigned jobs_index = 0;
+
+// called by do_one_file() right before the input file is replaced
+static void check_jobs_commit(void) {
+    DoFilesJobs *j = jobs_current;
+    if (j == NULL)
+        return;
+    MutexLocker lock(&j->mutex);
+    if (jobs_index > j->fatal)
+        throwIOException("not replaced after a fatal error");
+    j->committed[jobs_index] = true;
+}
+
+static void do_files_job(void *user, unsigned index) {
+    DoFilesJobs *j = (DoFilesJobs *) user;
+    {
+        MutexLocker lock(&j->mutex);
+        if (index > j->fatal)
+            return;
+    }
+
+    bool ok = false;
+    con_capture = &j->captures[index];
+    jobs_current = j;
+    jobs_index = index;
+    try {
+        ok = do_files_one(j->files[index], j->totals, &j->exit_codes[index]);
+    } catch (...) {
+        // printing the error failed; treat as fatal
+    }
+    jobs_current = NULL;
+    con_capture = NULL;
+
+    MutexLocker lock(&j->mutex);
+    j->done[index] = true;
+    if (!ok && index < j->fatal)
+        j->fatal = index;
+    while (j->next_replay <= j->fatal && j->next_replay < j->nfiles &&
+           j->done[j->next_replay]) {
+        j->captures[j->next_replay].replay();
+        set_exit_code(j->exit_codes[j->next_replay]);
+        j->next_replay++;
+    }
+}
+
+static void do_files_jobs(char **files, unsigned nfiles, UiTotals *totals, unsigned njobs) {
+    DoFilesJobs j;
+    j.files = files;
+    j.nfiles = nfiles;
+    j.totals = totals;
+    j.captures = new ConsoleCapture[nfiles];
+    j.exit_codes = new int[nfiles];
+    j.done = new bool[nfiles];
+    j.committed = new bool[nfiles];
+    for (unsigned k = 0; k < nfiles; k++) {
+        j.exit_codes[k] = EXIT_OK;
+        j.done[k] = false;
+        j.committed[k] = false;
+    }
+    j.next_replay = 0;
+    j.fatal = nfiles;
+
+    upx_thread_run_tasks(do_files_job, &j, nfiles, njobs);
+    assert(j.next_replay == UPX_MIN(j.fatal + 1, nfiles));
+    bool fatal = j.fatal < nfiles;
+    // these had already replaced their input file when the fatal error
+    // happened; the output of all others is dropped
+    for (unsigned k = j.next_replay; k < nfiles; k++) {
+        if (j.done[k] && j.committed[k]) {
+            j.captures[k].replay();
+            set_exit_code(j.exit_codes[k]);
+        }
+    }
+
+    delete[] j.committed;
+    delete[] j.done;
+    delete[] j.exit_codes;
+    delete[] j.captures;
+    if (fatal)
+        e_exit(EXIT_ERROR);
+}
+
+#endif /* WITH_THREAD_LOCAL */
+
+/*************************************************************************
+// process all files from the commandline
+**************************************************************************/
+
 void do_files(int i, int argc, char *argv[]) {
     if (opt->verbose >= 1) {
         show_head();
         UiPacker::uiHeader();
     }
 
+    UiTotals totals;
+#if (WITH_THREAD_LOCAL)
+    unsigned njobs = 1;
+    // "--list" and "--fileinfo" are cheap, and "--stdout" needs the
+    // files one after another anyway
+    if (!opt->to_stdout &&
+        (opt->cmd == CMD_COMPRESS || opt->cmd == CMD_DECOMPRESS || opt->cmd == CMD_TEST))
+        njobs = upx_thread_get_nthreads(opt->jobs);
+    if (njobs > 1 && argc - i >= 2) {
+        do_files_jobs(argv + i, argc - i, &totals, njobs);
+        i = argc;
+    }
+#endif
     for (; i < argc; i++) {
-        infoHeader();
-
-        const char *iname = argv[i];
-        char oname[ACC_FN_PATH_MAX + 1];
-        oname[0] = 0;
-
-        try {
-            do_one_file(iname, oname);
-        } catch (const Exception &e) {
-            unlink_ofile(oname);
-            if (opt->verbose >= 1 || (opt->verbose >= 0 && !e.isWarning()))
-                printErr(iname, &e);
-            set_exit_code(e.isWarning() ? EXIT_WARN : EXIT_ERROR);
-        } catch (const Error &e) {
-            unlink_ofile(oname);
-            printErr(iname, &e);
-            e_exit(EXIT_ERROR);
-        } catch (std::bad_alloc *e) {
-            unlink_ofile(oname);
-            printErr(iname, "out of memory");
-            UNUSED(e);
-            // delete e;
+        int ec;
+        if (!do_files_one(argv[i], &totals, &ec))
             e_exit(EXIT_ERROR);
-        } catch (const std::bad_alloc &) {
-            unlink_ofile(oname);
-            printErr(iname, "out of memory");
-            e_exit(EXIT_ERROR);
-        } catch (std::exception *e) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, e);
-            // delete e;
-            e_exit(EXIT_ERROR);
-        } catch (const std::exception &e) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, &e);
-            e_exit(EXIT_ERROR);
-        } catch (...) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, NULL);
-            e_exit(EXIT_ERROR);
-        }
+        set_exit_code(ec);
     }
 
-    if (opt->cmd == CMD_COMPRESS)
-        UiPacker::uiPackTotal();
+    if (opt->cmd == CMD_COMPRESS) {
+        upx_cache_trim();       // once per run, not per file
+        UiPacker::uiPackTotal(&totals);
+    }
     else if (opt->cmd == CMD_DECOMPRESS)
-        UiPacker::uiUnpackTotal();
+        UiPacker::uiUnpackTotal(&totals);
     else if (opt->cmd == CMD_LIST)
-        UiPacker::uiListTotal();
+        UiPacker::uiListTotal(&totals);
     else if (opt->cmd == CMD_TEST)
-        UiPacker::uiTestTotal();
+        UiPacker::uiTestTotal(&totals);
     else if (opt->cmd == CMD_FILEINFO)
-        UiPacker::uiFileInfoTotal();
+        UiPacker::uiFileInfoTotal(&totals);
 }
 
 /* vim:set ts=4 sw=4 et: */